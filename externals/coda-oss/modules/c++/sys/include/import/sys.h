@@ -25,6 +25,7 @@
 #define __IMPORT_SYS_H__
 
 #include "sys/AtomicCounter.h"
+#include "sys/ByteSwap.h"
 #include "sys/ConditionVar.h"
 #include "sys/Conf.h"
 #include "sys/DateTime.h"
@@ -0,0 +1,141 @@
+/* =========================================================================
+ * This file is part of sys-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * sys-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SYS_BYTE_SWAP_H__
+#define __SYS_BYTE_SWAP_H__
+
+#include <stddef.h>
+#include <complex>
+
+/*!
+ *  \file ByteSwap.h
+ *  \brief Byte swapping kernels behind sys::byteSwap()
+ *
+ *  Element sizes of 2, 4, and 8 bytes have dedicated kernels.  On x86,
+ *  the best of AVX2, SSSE3, or plain C++ is picked at runtime based on what
+ *  the CPU supports.  Other element sizes use a generic loop.
+ *
+ *  Most code should keep calling sys::byteSwap(), which goes through these.
+ *  Call these directly to avoid a separate copy when swapping out-of-place,
+ *  or to swap and convert to float in one pass.
+ */
+namespace sys
+{
+//! The instruction sets the byte swapping kernels can use
+enum ByteSwapInstructionSet
+{
+    BYTE_SWAP_SCALAR = 0,
+    BYTE_SWAP_SSSE3,
+    BYTE_SWAP_AVX2
+};
+
+/*!
+ *  \return The best instruction set the running CPU supports.  This is
+ *  what the kernels use unless told otherwise.
+ */
+ByteSwapInstructionSet getByteSwapInstructionSet();
+
+/*!
+ *  \param instructionSet Instruction set to check
+ *
+ *  \return True if this build and the running CPU support the instruction set
+ */
+bool isByteSwapInstructionSetSupported(ByteSwapInstructionSet instructionSet);
+
+//! \return A printable name for the instruction set
+const char* getByteSwapInstructionSetName(
+        ByteSwapInstructionSet instructionSet);
+
+/*!
+ *  Swap bytes.  Note that a complex pixel is equivalent to two floats so
+ *  elemSize and numElems must be adjusted accordingly.
+ *
+ *  \param input Buffer to swap
+ *  \param elemSize Size of each element in bytes
+ *  \param numElems Number of elements
+ *  \param[out] output Swapped elements.  May be the same as 'input' to swap
+ *  in place, but must not otherwise overlap it.
+ */
+void byteSwapElements(const void* input,
+                      unsigned short elemSize,
+                      size_t numElems,
+                      void* output);
+
+/*!
+ *  Same as above, but uses a specific instruction set.  Mainly for testing
+ *  and benchmarking.
+ *
+ *  \throw except::Exception if the instruction set is not supported
+ */
+void byteSwapElements(const void* input,
+                      unsigned short elemSize,
+                      size_t numElems,
+                      void* output,
+                      ByteSwapInstructionSet instructionSet);
+
+/*!
+ *  Swap big endian samples and convert them to native floats in one pass
+ *
+ *  \param input Big endian samples
+ *  \param elemSize 1 for signed 8-bit integers (which need no swapping), 2
+ *  for signed 16-bit integers, or 4 for floats
+ *  \param numElems Number of samples
+ *  \param[out] output Native floats.  Must not overlap 'input'.
+ *
+ *  \throw except::Exception if elemSize is not supported
+ */
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        float* output);
+
+/*!
+ *  Same as above, but uses a specific instruction set.  Mainly for testing
+ *  and benchmarking.
+ *
+ *  \throw except::Exception if the instruction set is not supported
+ */
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        float* output,
+                        ByteSwapInstructionSet instructionSet);
+
+/*!
+ *  Swap big endian complex pixels and convert them to native complex floats
+ *  in one pass
+ *
+ *  \param input Big endian pixels, real part first
+ *  \param elemSize Size of each complex pixel: 2 for 8-bit integer parts, 4
+ *  for 16-bit integer parts, or 8 for float parts
+ *  \param numElems Number of pixels
+ *  \param[out] output Native pixels.  Must not overlap 'input'.
+ *
+ *  \throw except::Exception if elemSize is not supported
+ */
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        std::complex<float>* output);
+}
+
+#endif
@@ -168,6 +168,7 @@ namespace sys
 #endif
 
 #include "except/Exception.h"
+#include "sys/ByteSwap.h"
 
 #define FmtX str::format
 
@@ -200,7 +201,8 @@ namespace sys
    /*!
      *  Swap bytes in-place.  Note that a complex pixel
      *  is equivalent to two floats so elemSize and numElems
-     *  must be adjusted accordingly.
+     *  must be adjusted accordingly.  Goes through the
+     *  SIMD kernels in sys/ByteSwap.h when possible.
      *
      *  \param [inout] buffer to transform
      *  \param elemSize
@@ -210,29 +212,17 @@ namespace sys
                          unsigned short elemSize,
                          size_t numElems)
     {
-        sys::byte* bufferPtr = static_cast<sys::byte*>(buffer);
-        if (!bufferPtr || elemSize < 2 || !numElems)
+        if (!buffer || elemSize < 2 || !numElems)
             return;
 
-        unsigned short half = elemSize >> 1;
-        size_t offset = 0, innerOff = 0, innerSwap = 0;
-
-        for(size_t i = 0; i < numElems; ++i, offset += elemSize)
-        {
-            for(unsigned short j = 0; j < half; ++j)
-            {
-                innerOff = offset + j;
-                innerSwap = offset + elemSize - 1 - j;
-
-                std::swap(bufferPtr[innerOff], bufferPtr[innerSwap]);
-            }
-        }
+        byteSwapElements(buffer, elemSize, numElems, buffer);
     }
 
     /*!
      *  Swap bytes into output buffer.  Note that a complex pixel
      *  is equivalent to two floats so elemSize and numElems
-     *  must be adjusted accordingly.
+     *  must be adjusted accordingly.  Goes through the
+     *  SIMD kernels in sys/ByteSwap.h when possible.
      *
      *  \param buffer to transform
      *  \param elemSize
@@ -244,28 +234,12 @@ namespace sys
                           size_t numElems,
                           void* outputBuffer)
     {
-        const sys::byte* bufferPtr = static_cast<const sys::byte*>(buffer);
-        sys::byte* outputBufferPtr = static_cast<sys::byte*>(outputBuffer);
-
-        if (!numElems || !bufferPtr || !outputBufferPtr)
+        if (!numElems || !buffer || !outputBuffer)
         {
             return;
         }
 
-        const unsigned short half = elemSize >> 1;
-        size_t offset = 0;
-
-        for (size_t ii = 0; ii < numElems; ++ii, offset += elemSize)
-        {
-            for (unsigned short jj = 0; jj < half; ++jj)
-            {
-                const size_t innerOff = offset + jj;
-                const size_t innerSwap = offset + elemSize - 1 - jj;
-
-                outputBufferPtr[innerOff] = bufferPtr[innerSwap];
-                outputBufferPtr[innerSwap] = bufferPtr[innerOff];
-            }
-        }
+        byteSwapElements(buffer, elemSize, numElems, outputBuffer);
     }
 
     /*!
@@ -0,0 +1,498 @@
+/* =========================================================================
+ * This file is part of sys-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * sys-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+
+#include "sys/Conf.h"
+#include "sys/ByteSwap.h"
+
+// The x86 kernels need per-function target attributes (GCC 4.9+ and clang)
+// so the rest of the library doesn't require SSSE3 or AVX2.  MSVC lets any
+// function use any intrinsic.
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+     (defined(__clang__) || __GNUC__ > 4 || \
+      (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || \
+    (defined(_MSC_VER) && _MSC_VER >= 1700 && \
+     (defined(_M_X64) || defined(_M_IX86)))
+#   define SYS_BYTE_SWAP_X86
+#   include <immintrin.h>
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#       define SYS_TARGET(ISA)
+#   else
+#       define SYS_TARGET(ISA) __attribute__((target(ISA)))
+#   endif
+#endif
+
+namespace
+{
+// The shifts below are recognized as byte swaps by the compiler.  memcpy()
+// is used to load and store so we don't require any particular alignment.
+inline
+sys::Uint16_T swapElement(sys::Uint16_T val)
+{
+    return static_cast<sys::Uint16_T>((val >> 8) | (val << 8));
+}
+
+inline
+sys::Uint32_T swapElement(sys::Uint32_T val)
+{
+    return ((val >> 24) & 0x000000FF) |
+           ((val >>  8) & 0x0000FF00) |
+           ((val <<  8) & 0x00FF0000) |
+           ((val << 24) & 0xFF000000);
+}
+
+inline
+sys::Uint64_T swapElement(sys::Uint64_T val)
+{
+    return (static_cast<sys::Uint64_T>(
+                    swapElement(static_cast<sys::Uint32_T>(val))) << 32) |
+            swapElement(static_cast<sys::Uint32_T>(val >> 32));
+}
+
+template <typename T>
+void swapScalar(const sys::ubyte* input,
+                size_t numElems,
+                sys::ubyte* output)
+{
+    for (size_t ii = 0; ii < numElems; ++ii)
+    {
+        T val;
+        ::memcpy(&val, input + ii * sizeof(T), sizeof(T));
+        val = swapElement(val);
+        ::memcpy(output + ii * sizeof(T), &val, sizeof(T));
+    }
+}
+
+// Handles any element size, in place or not
+void swapGeneric(const sys::ubyte* input,
+                 unsigned short elemSize,
+                 size_t numElems,
+                 sys::ubyte* output)
+{
+    const unsigned short half = elemSize >> 1;
+    for (size_t ii = 0, offset = 0; ii < numElems; ++ii, offset += elemSize)
+    {
+        for (unsigned short jj = 0; jj < half; ++jj)
+        {
+            const size_t innerOff = offset + jj;
+            const size_t innerSwap = offset + elemSize - 1 - jj;
+
+            const sys::ubyte lhs = input[innerOff];
+            const sys::ubyte rhs = input[innerSwap];
+            output[innerOff] = rhs;
+            output[innerSwap] = lhs;
+        }
+
+        if (elemSize & 1)
+        {
+            output[offset + half] = input[offset + half];
+        }
+    }
+}
+
+void swapScalar(const sys::ubyte* input,
+                unsigned short elemSize,
+                size_t numElems,
+                sys::ubyte* output)
+{
+    switch (elemSize)
+    {
+    case 1:
+        if (output != input)
+        {
+            ::memcpy(output, input, numElems);
+        }
+        break;
+    case 2:
+        swapScalar<sys::Uint16_T>(input, numElems, output);
+        break;
+    case 4:
+        swapScalar<sys::Uint32_T>(input, numElems, output);
+        break;
+    case 8:
+        swapScalar<sys::Uint64_T>(input, numElems, output);
+        break;
+    default:
+        swapGeneric(input, elemSize, numElems, output);
+    }
+}
+
+void promoteScalar(const sys::ubyte* input,
+                   unsigned short elemSize,
+                   size_t numElems,
+                   float* output)
+{
+    switch (elemSize)
+    {
+    case 1:
+        for (size_t ii = 0; ii < numElems; ++ii)
+        {
+            output[ii] = static_cast<sys::Int8_T>(input[ii]);
+        }
+        break;
+    case 2:
+        for (size_t ii = 0; ii < numElems; ++ii)
+        {
+            sys::Uint16_T val;
+            ::memcpy(&val, input + ii * 2, 2);
+            output[ii] = static_cast<sys::Int16_T>(swapElement(val));
+        }
+        break;
+    case 4:
+        swapScalar<sys::Uint32_T>(input, numElems,
+                                  reinterpret_cast<sys::ubyte*>(output));
+        break;
+    }
+}
+
+#ifdef SYS_BYTE_SWAP_X86
+// Shuffle mask that reverses each elemSize byte element in 16 bytes
+void getShuffleMask(unsigned short elemSize, char* mask)
+{
+    for (int ii = 0; ii < 16; ++ii)
+    {
+        mask[ii] = static_cast<char>((ii / elemSize) * elemSize +
+                                     elemSize - 1 - ii % elemSize);
+    }
+}
+
+// 16 bytes is a multiple of every element size that gets here, so whatever
+// is left over for the scalar loop is whole elements
+SYS_TARGET("ssse3")
+void swapSSSE3(const sys::ubyte* input,
+               unsigned short elemSize,
+               size_t numElems,
+               sys::ubyte* output)
+{
+    char maskBytes[16];
+    getShuffleMask(elemSize, maskBytes);
+    const __m128i mask =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(maskBytes));
+
+    const size_t numBytes = numElems * elemSize;
+    size_t ii = 0;
+    for (; ii + 16 <= numBytes; ii += 16)
+    {
+        const __m128i val =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + ii));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + ii),
+                         _mm_shuffle_epi8(val, mask));
+    }
+
+    swapScalar(input + ii, elemSize, (numBytes - ii) / elemSize, output + ii);
+}
+
+SYS_TARGET("avx2")
+void swapAVX2(const sys::ubyte* input,
+              unsigned short elemSize,
+              size_t numElems,
+              sys::ubyte* output)
+{
+    // vpshufb shuffles within each 128 bit lane, so the same mask goes in
+    // both
+    char maskBytes[16];
+    getShuffleMask(elemSize, maskBytes);
+    const __m256i mask = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(maskBytes)));
+
+    const size_t numBytes = numElems * elemSize;
+    size_t ii = 0;
+    for (; ii + 32 <= numBytes; ii += 32)
+    {
+        const __m256i val = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(input + ii));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + ii),
+                            _mm256_shuffle_epi8(val, mask));
+    }
+
+    swapSSSE3(input + ii, elemSize, (numBytes - ii) / elemSize, output + ii);
+}
+
+SYS_TARGET("ssse3")
+void promoteInt16SSSE3(const sys::ubyte* input,
+                       size_t numElems,
+                       float* output)
+{
+    const __m128i mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9,
+                                      6, 7, 4, 5, 2, 3, 0, 1);
+    size_t ii = 0;
+    for (; ii + 8 <= numElems; ii += 8)
+    {
+        const __m128i val = _mm_shuffle_epi8(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(input + ii * 2)), mask);
+
+        // Put each sample in the upper half of a 32 bit lane, then shift it
+        // back down to sign extend it
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(val, val), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(val, val), 16);
+        _mm_storeu_ps(output + ii, _mm_cvtepi32_ps(lo));
+        _mm_storeu_ps(output + ii + 4, _mm_cvtepi32_ps(hi));
+    }
+
+    promoteScalar(input + ii * 2, 2, numElems - ii, output + ii);
+}
+
+SYS_TARGET("avx2")
+void promoteInt16AVX2(const sys::ubyte* input,
+                      size_t numElems,
+                      float* output)
+{
+    const __m128i mask = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9,
+                                      6, 7, 4, 5, 2, 3, 0, 1);
+    size_t ii = 0;
+    for (; ii + 8 <= numElems; ii += 8)
+    {
+        const __m128i val = _mm_shuffle_epi8(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(input + ii * 2)), mask);
+        _mm256_storeu_ps(output + ii,
+                         _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(val)));
+    }
+
+    promoteScalar(input + ii * 2, 2, numElems - ii, output + ii);
+}
+
+struct CPUFeatures
+{
+    CPUFeatures() :
+        ssse3(false),
+        avx2(false)
+    {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        const int maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        ssse3 = (info[2] & (1 << 9)) != 0;
+
+        // AVX2 also needs the OS to save the YMM registers
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (maxLeaf >= 7 && osxsave && avx &&
+            (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+#else
+        // These account for OS support of the wider registers
+        __builtin_cpu_init();
+        ssse3 = __builtin_cpu_supports("ssse3") != 0;
+        avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+
+    bool ssse3;
+    bool avx2;
+};
+#endif
+
+// If sys::byteSwap() is called during another library's static
+// initialization before this is constructed, 'best' is still zero and the
+// scalar kernels get used
+const struct InstructionSetInfo
+{
+    InstructionSetInfo() :
+        best(sys::BYTE_SWAP_SCALAR)
+    {
+#ifdef SYS_BYTE_SWAP_X86
+        const CPUFeatures features;
+        if (features.avx2)
+        {
+            best = sys::BYTE_SWAP_AVX2;
+        }
+        else if (features.ssse3)
+        {
+            best = sys::BYTE_SWAP_SSSE3;
+        }
+#endif
+    }
+
+    // Each instruction set implies the ones before it
+    bool supports(sys::ByteSwapInstructionSet instructionSet) const
+    {
+        return instructionSet >= sys::BYTE_SWAP_SCALAR &&
+                instructionSet <= best;
+    }
+
+    sys::ByteSwapInstructionSet best;
+} INSTRUCTION_SET_INFO;
+
+void checkInstructionSet(sys::ByteSwapInstructionSet instructionSet)
+{
+    if (!INSTRUCTION_SET_INFO.supports(instructionSet))
+    {
+        throw except::Exception(Ctxt(
+                std::string("Byte swapping with ") +
+                sys::getByteSwapInstructionSetName(instructionSet) +
+                " is not supported on this system"));
+    }
+}
+}
+
+namespace sys
+{
+ByteSwapInstructionSet getByteSwapInstructionSet()
+{
+    return INSTRUCTION_SET_INFO.best;
+}
+
+bool isByteSwapInstructionSetSupported(ByteSwapInstructionSet instructionSet)
+{
+    return INSTRUCTION_SET_INFO.supports(instructionSet);
+}
+
+const char* getByteSwapInstructionSetName(
+        ByteSwapInstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+    case BYTE_SWAP_SCALAR:
+        return "scalar";
+    case BYTE_SWAP_SSSE3:
+        return "SSSE3";
+    case BYTE_SWAP_AVX2:
+        return "AVX2";
+    default:
+        return "unknown";
+    }
+}
+
+void byteSwapElements(const void* input,
+                      unsigned short elemSize,
+                      size_t numElems,
+                      void* output)
+{
+    byteSwapElements(input, elemSize, numElems, output,
+                     INSTRUCTION_SET_INFO.best);
+}
+
+void byteSwapElements(const void* input,
+                      unsigned short elemSize,
+                      size_t numElems,
+                      void* output,
+                      ByteSwapInstructionSet instructionSet)
+{
+    checkInstructionSet(instructionSet);
+    if (!input || !output || numElems == 0 || elemSize == 0)
+    {
+        return;
+    }
+
+    const sys::ubyte* const in = static_cast<const sys::ubyte*>(input);
+    sys::ubyte* const out = static_cast<sys::ubyte*>(output);
+
+    // The vector kernels only know the power of two sizes
+    const bool isVectorSize =
+            (elemSize == 2 || elemSize == 4 || elemSize == 8);
+
+#ifdef SYS_BYTE_SWAP_X86
+    if (isVectorSize && instructionSet == BYTE_SWAP_AVX2)
+    {
+        swapAVX2(in, elemSize, numElems, out);
+        return;
+    }
+    if (isVectorSize && instructionSet == BYTE_SWAP_SSSE3)
+    {
+        swapSSSE3(in, elemSize, numElems, out);
+        return;
+    }
+#else
+    (void)isVectorSize;
+#endif
+
+    swapScalar(in, elemSize, numElems, out);
+}
+
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        float* output)
+{
+    byteSwapAndPromote(input, elemSize, numElems, output,
+                       INSTRUCTION_SET_INFO.best);
+}
+
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        float* output,
+                        ByteSwapInstructionSet instructionSet)
+{
+    checkInstructionSet(instructionSet);
+    if (elemSize != 1 && elemSize != 2 && elemSize != 4)
+    {
+        throw except::Exception(Ctxt(
+                "Can't promote elements of size " + str::toString(elemSize)));
+    }
+    if (!input || !output || numElems == 0)
+    {
+        return;
+    }
+
+    const sys::ubyte* const in = static_cast<const sys::ubyte*>(input);
+
+    // Floats just need to be swapped
+    if (elemSize == 4)
+    {
+        byteSwapElements(input, elemSize, numElems, output, instructionSet);
+        return;
+    }
+
+#ifdef SYS_BYTE_SWAP_X86
+    if (elemSize == 2 && instructionSet == BYTE_SWAP_AVX2)
+    {
+        promoteInt16AVX2(in, numElems, output);
+        return;
+    }
+    if (elemSize == 2 && instructionSet == BYTE_SWAP_SSSE3)
+    {
+        promoteInt16SSSE3(in, numElems, output);
+        return;
+    }
+#endif
+
+    promoteScalar(in, elemSize, numElems, output);
+}
+
+void byteSwapAndPromote(const void* input,
+                        unsigned short elemSize,
+                        size_t numElems,
+                        std::complex<float>* output)
+{
+    if (elemSize != 2 && elemSize != 4 && elemSize != 8)
+    {
+        throw except::Exception(Ctxt(
+                "Can't promote complex elements of size " +
+                str::toString(elemSize)));
+    }
+
+    // The real and imaginary parts are stored one after the other, just
+    // like std::complex<float>
+    byteSwapAndPromote(input,
+                       static_cast<unsigned short>(elemSize / 2),
+                       numElems * 2,
+                       reinterpret_cast<float*>(output));
+}
+}
@@ -0,0 +1,205 @@
+/* =========================================================================
+ * This file is part of sys-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * sys-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times each byte swapping kernel for every element size, in place and out
+// of place, along with the swap + promote to float kernels.
+// Usage: ByteSwapBenchmark [MB per buffer] [repetitions]
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <sys/ByteSwap.h>
+#include <sys/StopWatch.h>
+
+namespace
+{
+const sys::ByteSwapInstructionSet INSTRUCTION_SETS[] =
+{
+    sys::BYTE_SWAP_SCALAR, sys::BYTE_SWAP_SSSE3, sys::BYTE_SWAP_AVX2
+};
+const size_t NUM_INSTRUCTION_SETS =
+        sizeof(INSTRUCTION_SETS) / sizeof(INSTRUCTION_SETS[0]);
+
+void printResult(const std::string& name,
+                 sys::ByteSwapInstructionSet instructionSet,
+                 size_t numBytes,
+                 size_t numReps,
+                 double elapsedMS)
+{
+    const double numMB = static_cast<double>(numBytes) * numReps /
+            (1024 * 1024);
+    std::cout << std::left << std::setw(28) << name << std::setw(8)
+              << sys::getByteSwapInstructionSetName(instructionSet)
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << numMB / (elapsedMS / 1000) << " MB/s\n";
+}
+
+// This is the loop sys::byteSwap() used to be
+void legacyByteSwap(sys::ubyte* buffer,
+                    unsigned short elemSize,
+                    size_t numElems)
+{
+    const unsigned short half = elemSize >> 1;
+    for (size_t ii = 0, offset = 0; ii < numElems; ++ii, offset += elemSize)
+    {
+        for (unsigned short jj = 0; jj < half; ++jj)
+        {
+            std::swap(buffer[offset + jj], buffer[offset + elemSize - 1 - jj]);
+        }
+    }
+}
+
+void benchmarkSwap(unsigned short elemSize,
+                   std::vector<sys::ubyte>& input,
+                   std::vector<sys::ubyte>& output,
+                   size_t numReps)
+{
+    const size_t numElems = input.size() / elemSize;
+    const size_t numBytes = numElems * elemSize;
+    std::ostringstream name;
+    name << elemSize << " byte";
+
+    sys::RealTimeStopWatch legacyWatch;
+    legacyWatch.start();
+    for (size_t rep = 0; rep < numReps; ++rep)
+    {
+        legacyByteSwap(&input[0], elemSize, numElems);
+    }
+    std::cout << std::left << std::setw(28) << (name.str() + " in place")
+              << std::setw(8) << "legacy" << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10)
+              << static_cast<double>(numBytes) * numReps / (1024 * 1024) /
+                    (legacyWatch.stop() / 1000)
+              << " MB/s\n";
+
+    for (size_t ii = 0; ii < NUM_INSTRUCTION_SETS; ++ii)
+    {
+        if (!sys::isByteSwapInstructionSetSupported(INSTRUCTION_SETS[ii]))
+        {
+            continue;
+        }
+
+        sys::RealTimeStopWatch inPlaceWatch;
+        inPlaceWatch.start();
+        for (size_t rep = 0; rep < numReps; ++rep)
+        {
+            sys::byteSwapElements(&input[0], elemSize, numElems, &input[0],
+                                  INSTRUCTION_SETS[ii]);
+        }
+        printResult(name.str() + " in place", INSTRUCTION_SETS[ii],
+                    numBytes, numReps, inPlaceWatch.stop());
+
+        sys::RealTimeStopWatch outOfPlaceWatch;
+        outOfPlaceWatch.start();
+        for (size_t rep = 0; rep < numReps; ++rep)
+        {
+            sys::byteSwapElements(&input[0], elemSize, numElems, &output[0],
+                                  INSTRUCTION_SETS[ii]);
+        }
+        printResult(name.str() + " out of place", INSTRUCTION_SETS[ii],
+                    numBytes, numReps, outOfPlaceWatch.stop());
+    }
+}
+
+void benchmarkPromote(unsigned short elemSize,
+                      const std::vector<sys::ubyte>& input,
+                      std::vector<float>& output,
+                      size_t numReps)
+{
+    const size_t numElems = input.size() / elemSize;
+    std::ostringstream name;
+    name << elemSize << " byte promote";
+
+    for (size_t ii = 0; ii < NUM_INSTRUCTION_SETS; ++ii)
+    {
+        if (!sys::isByteSwapInstructionSetSupported(INSTRUCTION_SETS[ii]))
+        {
+            continue;
+        }
+
+        sys::RealTimeStopWatch watch;
+        watch.start();
+        for (size_t rep = 0; rep < numReps; ++rep)
+        {
+            sys::byteSwapAndPromote(&input[0], elemSize, numElems,
+                                    &output[0], INSTRUCTION_SETS[ii]);
+        }
+
+        // Rate is in terms of input bytes
+        printResult(name.str(), INSTRUCTION_SETS[ii], numElems * elemSize,
+                    numReps, watch.stop());
+    }
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numMB = (argc > 1) ? ::atoi(argv[1]) : 64;
+        const size_t numReps = (argc > 2) ? ::atoi(argv[2]) : 10;
+        const size_t numBytes = numMB * 1024 * 1024;
+
+        std::cout << "Best instruction set: "
+                  << sys::getByteSwapInstructionSetName(
+                          sys::getByteSwapInstructionSet())
+                  << "\n" << numMB << " MB buffers, " << numReps
+                  << " repetitions\n\n";
+
+        std::vector<sys::ubyte> input(numBytes);
+        for (size_t ii = 0; ii < numBytes; ++ii)
+        {
+            input[ii] = static_cast<sys::ubyte>(ii);
+        }
+        std::vector<sys::ubyte> output(numBytes);
+
+        const unsigned short elemSizes[] = {2, 4, 8, 3, 16};
+        for (size_t ii = 0; ii < sizeof(elemSizes) / sizeof(elemSizes[0]);
+             ++ii)
+        {
+            benchmarkSwap(elemSizes[ii], input, output, numReps);
+        }
+
+        std::cout << "\n";
+        std::vector<float> promoted(numBytes);
+        const unsigned short promoteSizes[] = {1, 2, 4};
+        for (size_t ii = 0; ii < 3; ++ii)
+        {
+            benchmarkPromote(promoteSizes[ii], input, promoted, numReps);
+        }
+
+        return 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
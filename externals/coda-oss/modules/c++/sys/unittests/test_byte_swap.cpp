@@ -20,8 +20,12 @@
  *
  */
 
+#include <algorithm>
+#include <vector>
+
 #include "TestCase.h"
 #include <sys/Conf.h>
+#include <sys/ByteSwap.h>
 
 namespace
 {
@@ -54,10 +58,166 @@ TEST_CASE(testByteSwap)
         TEST_ASSERT_EQ(values1[ii], swappedValues2[ii]);
     }
 }
+
+// Reference implementation: reverse the bytes of each element
+std::vector<sys::ubyte> reverseElements(const std::vector<sys::ubyte>& input,
+                                        size_t elemSize)
+{
+    std::vector<sys::ubyte> output(input.size());
+    for (size_t ii = 0; ii < input.size(); ii += elemSize)
+    {
+        std::reverse_copy(&input[ii], &input[ii] + elemSize, &output[ii]);
+    }
+    return output;
+}
+
+std::vector<sys::ubyte> createBytes(size_t numBytes)
+{
+    std::vector<sys::ubyte> bytes(numBytes);
+    for (size_t ii = 0; ii < numBytes; ++ii)
+    {
+        bytes[ii] = static_cast<sys::ubyte>(ii * 7 + ii / 256);
+    }
+    return bytes;
+}
+
+TEST_CASE(testKernels)
+{
+    const sys::ByteSwapInstructionSet instructionSets[] =
+    {
+        sys::BYTE_SWAP_SCALAR, sys::BYTE_SWAP_SSSE3, sys::BYTE_SWAP_AVX2
+    };
+
+    // Odd element counts and offsets exercise the leftovers after the
+    // vector loops and unaligned loads
+    const unsigned short elemSizes[] = {2, 3, 4, 8, 12};
+    const size_t numElems[] = {1, 7, 33, 1001};
+    for (size_t ss = 0; ss < 3; ++ss)
+    {
+        if (!sys::isByteSwapInstructionSetSupported(instructionSets[ss]))
+        {
+            std::cout << "Skipping "
+                      << sys::getByteSwapInstructionSetName(instructionSets[ss])
+                      << std::endl;
+            continue;
+        }
+
+        for (size_t ee = 0; ee < sizeof(elemSizes) / sizeof(elemSizes[0]);
+             ++ee)
+        {
+            const unsigned short elemSize = elemSizes[ee];
+            for (size_t nn = 0; nn < sizeof(numElems) / sizeof(size_t); ++nn)
+            {
+                for (size_t offset = 0; offset < 3; ++offset)
+                {
+                    const size_t numBytes = elemSize * numElems[nn];
+                    const std::vector<sys::ubyte> original(
+                            createBytes(numBytes + offset));
+                    const std::vector<sys::ubyte> unswapped(
+                            original.begin() + offset, original.end());
+                    const std::vector<sys::ubyte> expected(
+                            reverseElements(unswapped, elemSize));
+
+                    // Out of place
+                    std::vector<sys::ubyte> output(numBytes + offset);
+                    sys::byteSwapElements(&original[offset], elemSize,
+                                          numElems[nn], &output[offset],
+                                          instructionSets[ss]);
+                    TEST_ASSERT(std::equal(expected.begin(), expected.end(),
+                                           output.begin() + offset));
+
+                    // In place
+                    std::vector<sys::ubyte> buffer(original);
+                    sys::byteSwapElements(&buffer[offset], elemSize,
+                                          numElems[nn], &buffer[offset],
+                                          instructionSets[ss]);
+                    TEST_ASSERT(std::equal(expected.begin(), expected.end(),
+                                           buffer.begin() + offset));
+                }
+            }
+        }
+    }
+
+    // The odd-sized middle byte comes along too
+    const sys::ubyte input[3] = {1, 2, 3};
+    sys::ubyte output[3] = {0, 0, 0};
+    sys::byteSwap(input, 3, 1, output);
+    TEST_ASSERT_EQ(output[0], 3);
+    TEST_ASSERT_EQ(output[1], 2);
+    TEST_ASSERT_EQ(output[2], 1);
+}
+
+TEST_CASE(testPromote)
+{
+    static const size_t NUM_SAMPLES = 1003;
+
+    std::vector<sys::Int16_T> ints(NUM_SAMPLES);
+    std::vector<float> floats(NUM_SAMPLES);
+    std::vector<sys::Int8_T> bytes(NUM_SAMPLES);
+    for (size_t ii = 0; ii < NUM_SAMPLES; ++ii)
+    {
+        ints[ii] = static_cast<sys::Int16_T>(ii * 97 - 30000);
+        floats[ii] = static_cast<float>(ii) * -1.5f + 0.25f;
+        bytes[ii] = static_cast<sys::Int8_T>(ii * 3);
+    }
+
+    std::vector<sys::Int16_T> swappedInts(ints);
+    sys::byteSwap(&swappedInts[0], sizeof(sys::Int16_T), NUM_SAMPLES);
+    std::vector<float> swappedFloats(floats);
+    sys::byteSwap(&swappedFloats[0], sizeof(float), NUM_SAMPLES);
+
+    const sys::ByteSwapInstructionSet instructionSets[] =
+    {
+        sys::BYTE_SWAP_SCALAR, sys::BYTE_SWAP_SSSE3, sys::BYTE_SWAP_AVX2
+    };
+    for (size_t ss = 0; ss < 3; ++ss)
+    {
+        if (!sys::isByteSwapInstructionSetSupported(instructionSets[ss]))
+        {
+            continue;
+        }
+
+        std::vector<float> output(NUM_SAMPLES);
+        sys::byteSwapAndPromote(&swappedInts[0], 2, NUM_SAMPLES, &output[0],
+                                instructionSets[ss]);
+        for (size_t ii = 0; ii < NUM_SAMPLES; ++ii)
+        {
+            TEST_ASSERT_EQ(output[ii], static_cast<float>(ints[ii]));
+        }
+
+        sys::byteSwapAndPromote(&swappedFloats[0], 4, NUM_SAMPLES,
+                                &output[0], instructionSets[ss]);
+        TEST_ASSERT(output == floats);
+
+        sys::byteSwapAndPromote(&bytes[0], 1, NUM_SAMPLES, &output[0],
+                                instructionSets[ss]);
+        for (size_t ii = 0; ii < NUM_SAMPLES; ++ii)
+        {
+            TEST_ASSERT_EQ(output[ii], static_cast<float>(bytes[ii]));
+        }
+    }
+
+    // Complex pixels are pairs of samples
+    std::vector<std::complex<float> > pixels(NUM_SAMPLES / 2);
+    sys::byteSwapAndPromote(&swappedInts[0], 4, pixels.size(), &pixels[0]);
+    for (size_t ii = 0; ii < pixels.size(); ++ii)
+    {
+        TEST_ASSERT_EQ(pixels[ii].real(), ints[ii * 2]);
+        TEST_ASSERT_EQ(pixels[ii].imag(), ints[ii * 2 + 1]);
+    }
+
+    std::vector<float> output(NUM_SAMPLES);
+    TEST_EXCEPTION(sys::byteSwapAndPromote(&swappedInts[0], 8, 1,
+                                           &output[0]));
+    TEST_EXCEPTION(sys::byteSwapAndPromote(&swappedInts[0], 3, 1,
+                                           &pixels[0]));
+}
 }
 
 int main(int /*argc*/, char** /*argv*/)
 {
     TEST_CHECK(testByteSwap);
+    TEST_CHECK(testKernels);
+    TEST_CHECK(testPromote);
     return 0;
 }
@@ -56,10 +56,16 @@ namespace nitf
  * - Image segments and data extension segments are supported.
  * - TREs are supported in the file header and/or image subheaders in either
  * the user-defined or extended sections
- * - Multiple image segments are supported, but only where the images are
- * intended to be vertically stacked (so the number of columns must match and
- * all indexing will be as if the image segments are intended to be vertically
- * stacked in order.  ILOC and IALVL are not checked).
+ * - Multiple image segments are supported where the images are intended to
+ * be vertically stacked (so the number of columns must match and all indexing
+ * will be as if the image segments are intended to be vertically stacked in
+ * order.  ILOC and IALVL are not checked).
+ * - Inheriting classes may also lay the image segments out as several
+ * unrelated image products, each of which is a run of vertically stacked
+ * segments with its own row indexing, optionally followed by image segments
+ * that are written along with it (such as a legend).  Each product is then
+ * requested by index via the getNumBytes() and getBytes() overloads that
+ * take one.
  *
  * The NITF layout is
  * (lastSeg = mImageSubheaderFileOffsets.size() - 1):
@@ -172,7 +178,8 @@ public:
      * number of bytes that will appear in the NITF on disk (including NITF
      * file header, image subheader(s), and DES subheader(s) and data).  Calling
      * this method repeatedly, eventually providing the entire range of the
-     * image, will produce the total number of bytes in the full NITF.
+     * image, will produce the total number of bytes in the full NITF.  If
+     * the NITF holds several image products, this is for the first one.
      *
      * \param startRow The global start row in pixels as to where these pixels
      * are in the image.  If this is a multi-segment NITF, this is still simply
@@ -183,6 +190,22 @@ public:
      */
     virtual nitf::Off getNumBytes(size_t startRow, size_t numRows) const;
 
+    /*!
+     * Same as above but for one image product of a NITF holding several
+     * unrelated images.  The bytes of any image segments that trail the
+     * product (e.g. a legend) are included with its last row.
+     *
+     * \param product The image product index
+     * \param startRow The start row in pixels relative to the first row of
+     * the product
+     * \param numRows The number of rows
+     *
+     * \return The associated number of bytes in the NITF
+     */
+    nitf::Off getNumBytes(size_t product,
+                          size_t startRow,
+                          size_t numRows) const;
+
     /*!
      * The caller provides an AOI of the pixel data.  This method provides back
      * a list of contiguous buffers corresponding to the raw NITF bytes for
@@ -196,7 +219,8 @@ public:
      * out to disk in order with respect to the start pixel rows this method is
      * called with (or out of order but seeking to the provided file offset
      * each time), and in the order contained in the buffer list, it will form
-     * a valid NITF.
+     * a valid NITF.  If the NITF holds several image products, this provides
+     * the first one.
      *
      * \note This method does not perform byte swapping on the pixel data for
      * efficiency reasons, but NITFs are written out in big endian order.  This
@@ -230,11 +254,63 @@ public:
                           NITFBufferList& buffers) const;
 
     /*!
-     * \return ImageBlocker with settings in sync with how the image will be
-     * blocked in the NITF
+     * Same as above but for one image product of a NITF holding several
+     * unrelated images.  Products are independent of each other, so they may
+     * be provided in any order and from different threads.  The bytes of any
+     * image segments that trail the product (e.g. a legend) are in the buffer
+     * list along with its last row.
+     *
+     * \param product The image product index
+     * \param imageData The image data pixels to write. Must be in big endian
+     * order and blocked if the product is.
+     * \param startRow The start row in pixels relative to the first row of
+     * the product
+     * \param numRows The number of rows in the provided 'imageData'
+     * \param[out] fileOffset The offset in bytes in the NITF where these
+     * buffers should be written
+     * \param[out] buffers One or more pointers to raw bytes of data
+     */
+    void getBytes(size_t product,
+                  const void* imageData,
+                  size_t startRow,
+                  size_t numRows,
+                  nitf::Off& fileOffset,
+                  NITFBufferList& buffers) const;
+
+    //! \return The number of image products in the NITF
+    size_t getNumImageProducts() const
+    {
+        return mImageProducts.size();
+    }
+
+    /*!
+     * \param product The image product index
+     *
+     * \return The number of rows in the image product
+     */
+    size_t getNumRows(size_t product) const;
+
+    /*!
+     * \param product The image product index
+     *
+     * \return The number of columns in the image product
+     */
+    size_t getNumCols(size_t product) const;
+
+    /*!
+     * \return ImageBlocker with settings in sync with how the first image
+     * product will be blocked in the NITF
      */
     std::auto_ptr<const ImageBlocker> getImageBlocker() const;
 
+    /*!
+     * \param product The image product index
+     *
+     * \return ImageBlocker with settings in sync with how this image product
+     * will be blocked in the NITF
+     */
+    std::auto_ptr<const ImageBlocker> getImageBlocker(size_t product) const;
+
 protected:
     /*!
      * Default constructor.  Expectation is that if an inheriting class uses
@@ -259,6 +335,33 @@ protected:
                     size_t numRowsPerBlock = 0,
                     size_t numColsPerBlock = 0);
 
+    /*!
+     * Same as above but for a record holding several unrelated image
+     * products.  The record's image segments are, in order, each product's
+     * vertically stacked segments followed by that product's trailing
+     * segments.
+     *
+     * \param record Pre-populated NITF record.  Record won't be modified.
+     * \param numSegmentsPerProduct The number of vertically stacked image
+     * segments in each product
+     * \param trailingImageData For each product, the big endian pixel data
+     * of each image segment that immediately follows the product's segments
+     * but isn't part of its image (such as a SIDD legend).  The data is
+     * copied, so it only needs to be valid for the duration of this call.
+     * \param desData Optional DES data (one per DES subheader)
+     * \param numRowsPerBlock The number of rows per block.  Defaults to no
+     * blocking.
+     * \param numColsPerBlock The number of columns per block, capped at
+     * each product's number of columns.  Defaults to no blocking.
+     */
+    void initialize(Record& record,
+                    const std::vector<size_t>& numSegmentsPerProduct,
+                    const std::vector<std::vector<PtrAndLength> >&
+                            trailingImageData,
+                    const std::vector<PtrAndLength>& desData,
+                    size_t numRowsPerBlock = 0,
+                    size_t numColsPerBlock = 0);
+
     static void copyFromStreamAndClear(io::ByteStream& stream,
                                        std::vector<sys::byte>& rawBytes);
 
@@ -291,10 +394,16 @@ protected:
     bool shouldAddHeader(size_t seg, size_t startRow) const;
     bool shouldAddSubheader(size_t seg, size_t startRow) const;
     bool shouldAddDES(size_t seg, size_t imageDataEndRow) const;
+    bool shouldAddTrailingSegments(size_t seg, size_t imageDataEndRow) const;
 
     void addDES(size_t seg, size_t imageDataEndRow,
                 NITFBufferList& buffers) const;
 
+    size_t countBytesForTrailingSegments(size_t seg,
+                                         size_t imageDataEndRow) const;
+    void addTrailingSegments(size_t seg, size_t imageDataEndRow,
+                             NITFBufferList& buffers) const;
+
     void getFileLayout(nitf::Record& inRecord,
                        const std::vector<PtrAndLength>& desData);
 
@@ -310,6 +419,14 @@ protected:
             size_t numRowsPerBlock,
             size_t numColsPerBlock);
 
+    void initializeImpl(
+            Record& record,
+            const std::vector<size_t>& numSegmentsPerProduct,
+            const std::vector<std::vector<PtrAndLength> >& trailingImageData,
+            const std::vector<PtrAndLength>& desData,
+            size_t numRowsPerBlock,
+            size_t numColsPerBlock);
+
     // Represents the row information for a NITF image segment
     struct SegmentInfo
     {
@@ -338,6 +455,43 @@ protected:
         size_t numRows;
     };
 
+    // Represents one image product: a run of vertically stacked image
+    // segments followed by any segments that are written along with it
+    struct ProductInfo
+    {
+        ProductInfo() :
+            firstSegment(0),
+            numSegments(0),
+            numTrailingSegments(0),
+            numCols(0),
+            numRowsPerBlock(0),
+            numColsPerBlock(0),
+            numBytesPerPixel(0),
+            numBytesPerRow(0)
+        {
+        }
+
+        size_t endSegment() const
+        {
+            return (firstSegment + numSegments);
+        }
+
+        size_t firstSegment;
+        size_t numSegments;
+        size_t numTrailingSegments;
+        size_t numCols;
+        size_t numRowsPerBlock;
+        size_t numColsPerBlock;
+        size_t numBytesPerPixel;
+        size_t numBytesPerRow;
+
+        // Subheaders and data of the trailing segments, contiguously
+        std::vector<sys::byte> trailingSegments;
+    };
+
+    const ProductInfo& getProductInfo(size_t product) const;
+
+    // These are for the first image product
     size_t mNumCols;
     size_t mOverallNumRowsPerBlock;
 
@@ -346,7 +500,10 @@ protected:
     size_t mNumBytesPerRow;
     size_t mNumBytesPerPixel;
 
+    // Rows are relative to the start of the segment's product
     std::vector<SegmentInfo> mImageSegmentInfo; // Per segment
+    std::vector<size_t> mSegmentProducts; // Per segment
+    std::vector<ProductInfo> mImageProducts;
 
     std::vector<sys::byte> mFileHeader;
     std::vector<std::vector<sys::byte> > mImageSubheaders; // Per segment
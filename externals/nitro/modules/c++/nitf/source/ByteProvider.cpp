@@ -76,35 +76,194 @@ void ByteProvider::initializeImpl(Record& record,
                                   size_t numRowsPerBlock,
                                   size_t numColsPerBlock)
 {
-    // Get all the file headers and offsets
-    getFileLayout(record, desData);
-    mOverallNumRowsPerBlock = numRowsPerBlock;
+    // All the image segments are stacked into a single product
+    std::vector<size_t> numSegmentsPerProduct;
+    std::vector<std::vector<PtrAndLength> > trailingImageData;
+    if (record.getNumImages() > 0)
+    {
+        numSegmentsPerProduct.push_back(record.getNumImages());
+        trailingImageData.resize(1);
+    }
 
-    size_t numColsWithPad;
-    if (numColsPerBlock != 0)
+    initializeImpl(record, numSegmentsPerProduct, trailingImageData, desData,
+                   numRowsPerBlock, numColsPerBlock);
+}
+
+void ByteProvider::initializeImpl(
+        Record& record,
+        const std::vector<size_t>& numSegmentsPerProduct,
+        const std::vector<std::vector<PtrAndLength> >& trailingImageData,
+        const std::vector<PtrAndLength>& desData,
+        size_t numRowsPerBlock,
+        size_t numColsPerBlock)
+{
+    if (numSegmentsPerProduct.size() != trailingImageData.size())
     {
-        mNumColsPerBlock = numColsPerBlock;
-        numColsWithPad = ImageSubheader::getActualImageDim(
-                mNumCols, mNumColsPerBlock);
+        std::ostringstream ostr;
+        ostr << "Have " << numSegmentsPerProduct.size()
+             << " image products but trailing image data for "
+             << trailingImageData.size();
+        throw except::Exception(Ctxt(ostr.str()));
     }
-    else
+
+    const size_t numImages = record.getNumImages();
+    size_t numSegmentsInProducts(0);
+    for (size_t ii = 0; ii < numSegmentsPerProduct.size(); ++ii)
     {
-        mNumColsPerBlock = mNumCols;
-        numColsWithPad = mNumCols;
+        if (numSegmentsPerProduct[ii] == 0)
+        {
+            std::ostringstream ostr;
+            ostr << "Image product " << ii << " has no image segments";
+            throw except::Exception(Ctxt(ostr.str()));
+        }
+        numSegmentsInProducts +=
+                numSegmentsPerProduct[ii] + trailingImageData[ii].size();
     }
 
-    mNumBytesPerRow = numColsWithPad * mNumBytesPerPixel;
-    if (mOverallNumRowsPerBlock == 0)
+    if (numSegmentsInProducts != numImages)
     {
-        mNumRowsPerBlock.resize(record.getNumImages());
-        for (size_t ii = 0; ii < mNumRowsPerBlock.size(); ++ii)
+        std::ostringstream ostr;
+        ostr << "Record has " << numImages << " image segments but the image "
+             << "products account for " << numSegmentsInProducts;
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    // Get all the file headers and offsets
+    getFileLayout(record, desData);
+
+    mImageProducts.resize(numSegmentsPerProduct.size());
+    mSegmentProducts.resize(numImages);
+    mNumRowsPerBlock.resize(numImages);
+
+    size_t seg(0);
+    for (size_t product = 0; product < mImageProducts.size(); ++product)
+    {
+        ProductInfo& productInfo(mImageProducts[product]);
+        productInfo.firstSegment = seg;
+        productInfo.numSegments = numSegmentsPerProduct[product];
+
+        // Rows are indexed from the top of each product, and every segment
+        // within a product must line up
+        size_t productNumRows(0);
+        for (; seg < productInfo.endSegment(); ++seg)
+        {
+            nitf::ImageSegment imageSegment = record.getImages()[seg];
+            nitf::ImageSubheader subheader = imageSegment.getSubheader();
+
+            const size_t numCols = subheader.getNumCols();
+            const size_t numBands = subheader.getNumImageBands();
+            const size_t numBytesPerPixel =
+                    NITF_NBPP_TO_BYTES(subheader.getActualBitsPerPixel()) *
+                    numBands;
+            if (seg == productInfo.firstSegment)
+            {
+                productInfo.numCols = numCols;
+                productInfo.numBytesPerPixel = numBytesPerPixel;
+            }
+            else
+            {
+                if (numCols != productInfo.numCols)
+                {
+                    std::ostringstream ostr;
+                    ostr << "First image segment of product " << product
+                         << " had " << productInfo.numCols
+                         << " columns but image segment " << seg << " has "
+                         << numCols;
+                    throw except::Exception(Ctxt(ostr.str()));
+                }
+
+                if (numBytesPerPixel != productInfo.numBytesPerPixel)
+                {
+                    std::ostringstream ostr;
+                    ostr << "First image segment of product " << product
+                         << " had " << productInfo.numBytesPerPixel
+                         << " bytes/pixel but image segment " << seg
+                         << " has " << numBytesPerPixel;
+                    throw except::Exception(Ctxt(ostr.str()));
+                }
+            }
+
+            mImageSegmentInfo[seg].firstRow = productNumRows;
+            productNumRows += mImageSegmentInfo[seg].numRows;
+            mSegmentProducts[seg] = product;
+        }
+
+        productInfo.numRowsPerBlock = numRowsPerBlock;
+
+        size_t numColsWithPad;
+        if (numColsPerBlock != 0)
         {
-            mNumRowsPerBlock[ii] = mImageSegmentInfo[ii].numRows;
+            productInfo.numColsPerBlock =
+                    std::min(numColsPerBlock, productInfo.numCols);
+            numColsWithPad = ImageSubheader::getActualImageDim(
+                    productInfo.numCols, productInfo.numColsPerBlock);
+        }
+        else
+        {
+            productInfo.numColsPerBlock = productInfo.numCols;
+            numColsWithPad = productInfo.numCols;
+        }
+        productInfo.numBytesPerRow =
+                numColsWithPad * productInfo.numBytesPerPixel;
+
+        if (numRowsPerBlock == 0)
+        {
+            for (size_t ii = productInfo.firstSegment;
+                 ii < productInfo.endSegment();
+                 ++ii)
+            {
+                mNumRowsPerBlock[ii] = mImageSegmentInfo[ii].numRows;
+            }
+        }
+        else
+        {
+            const std::vector<size_t> numRowsPerBlockInProduct =
+                    getImageBlocker(product)->getNumRowsPerBlock();
+            std::copy(numRowsPerBlockInProduct.begin(),
+                      numRowsPerBlockInProduct.end(),
+                      mNumRowsPerBlock.begin() + productInfo.firstSegment);
+        }
+
+        // Anything trailing the product is written out as-is along with the
+        // product's last row
+        const std::vector<PtrAndLength>& trailing(trailingImageData[product]);
+        productInfo.numTrailingSegments = trailing.size();
+        productInfo.trailingSegments.clear();
+        for (size_t ii = 0; ii < trailing.size(); ++ii, ++seg)
+        {
+            if (trailing[ii].second != mImageDataLengths[seg])
+            {
+                std::ostringstream ostr;
+                ostr << "Image segment " << seg << " has "
+                     << mImageDataLengths[seg] << " bytes of image data but "
+                     << trailing[ii].second << " bytes were provided";
+                throw except::Exception(Ctxt(ostr.str()));
+            }
+
+            const std::vector<sys::byte>& subheader(mImageSubheaders[seg]);
+            const sys::byte* const data =
+                    static_cast<const sys::byte*>(trailing[ii].first);
+            productInfo.trailingSegments.insert(
+                    productInfo.trailingSegments.end(),
+                    subheader.begin(), subheader.end());
+            productInfo.trailingSegments.insert(
+                    productInfo.trailingSegments.end(),
+                    data, data + trailing[ii].second);
+
+            mImageSegmentInfo[seg].firstRow = 0;
+            mNumRowsPerBlock[seg] = mImageSegmentInfo[seg].numRows;
+            mSegmentProducts[seg] = product;
         }
     }
-    else
+
+    if (!mImageProducts.empty())
     {
-        mNumRowsPerBlock = getImageBlocker()->getNumRowsPerBlock();
+        const ProductInfo& firstProduct(mImageProducts[0]);
+        mNumCols = firstProduct.numCols;
+        mOverallNumRowsPerBlock = firstProduct.numRowsPerBlock;
+        mNumColsPerBlock = firstProduct.numColsPerBlock;
+        mNumBytesPerPixel = firstProduct.numBytesPerPixel;
+        mNumBytesPerRow = firstProduct.numBytesPerRow;
     }
 }
 
@@ -125,6 +284,27 @@ void ByteProvider::initialize(Record& record,
     initializeImpl(record, desData, numRowsPerBlock, numColsPerBlock);
 }
 
+void ByteProvider::initialize(
+        Record& record,
+        const std::vector<size_t>& numSegmentsPerProduct,
+        const std::vector<std::vector<PtrAndLength> >& trailingImageData,
+        const std::vector<PtrAndLength>& desData,
+        size_t numRowsPerBlock,
+        size_t numColsPerBlock)
+{
+    // Set image lengths
+    const size_t numImages = record.getNumImages();
+    mImageDataLengths.resize(numImages);
+    for (size_t ii = 0; ii < numImages; ++ii)
+    {
+        nitf::ImageSegment imageSegment = record.getImages()[ii];
+        nitf::ImageSubheader subheader = imageSegment.getSubheader();
+        mImageDataLengths[ii] = subheader.getNumBytesOfImageData();
+    }
+    initializeImpl(record, numSegmentsPerProduct, trailingImageData, desData,
+                   numRowsPerBlock, numColsPerBlock);
+}
+
 void ByteProvider::getFileLayout(nitf::Record& inRecord,
                                  const std::vector<PtrAndLength>& desData)
 {
@@ -169,40 +349,7 @@ void ByteProvider::getFileLayout(nitf::Record& inRecord,
                                    comratOff);
         copyFromStreamAndClear(*byteStream, mImageSubheaders[ii]);
 
-        const size_t numCols = subheader.getNumCols();
-        const size_t numBands = subheader.getNumImageBands();
-        const size_t numBytesPerPixel =
-                NITF_NBPP_TO_BYTES(subheader.getActualBitsPerPixel()) *
-                numBands;
-        if (ii == 0)
-        {
-            mNumCols = numCols;
-            mNumBytesPerPixel = numBytesPerPixel;
-        }
-        else
-        {
-            if (numCols != mNumCols)
-            {
-                std::ostringstream ostr;
-                ostr << "First image segment had " << mNumCols
-                     << " columns but image segment " << ii << " has "
-                     << numCols;
-                throw except::Exception(Ctxt(ostr.str()));
-            }
-
-            if (numBytesPerPixel != mNumBytesPerPixel)
-            {
-                std::ostringstream ostr;
-                ostr << "First image segment had " << mNumBytesPerPixel
-                     << " bytes/pxeil but image segment " << ii << " has "
-                     << numBytesPerPixel;
-                throw except::Exception(Ctxt(ostr.str()));
-            }
-        }
-
-        mImageSegmentInfo[ii].firstRow = (ii == 0) ?
-                0 : mImageSegmentInfo[ii - 1].endRow();
-
+        // The first rows are filled in once we know the image products
         mImageSegmentInfo[ii].numRows = subheader.getNumRows();
     }
 
@@ -309,19 +456,53 @@ void ByteProvider::getFileLayout(nitf::Record& inRecord,
     mDesSubheaderFileOffset = offset;
 }
 
+const ByteProvider::ProductInfo&
+ByteProvider::getProductInfo(size_t product) const
+{
+    if (product >= mImageProducts.size())
+    {
+        std::ostringstream ostr;
+        ostr << "Image product " << product << " requested but there are only "
+             << mImageProducts.size();
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    return mImageProducts[product];
+}
+
+size_t ByteProvider::getNumRows(size_t product) const
+{
+    const ProductInfo& productInfo(getProductInfo(product));
+    return mImageSegmentInfo[productInfo.endSegment() - 1].endRow();
+}
+
+size_t ByteProvider::getNumCols(size_t product) const
+{
+    return getProductInfo(product).numCols;
+}
+
 std::auto_ptr<const ImageBlocker> ByteProvider::getImageBlocker() const
 {
-    std::vector<size_t> numRowsPerSegment(mImageSegmentInfo.size());
-    for (size_t ii = 0; ii < mImageSegmentInfo.size(); ++ii)
+    return getImageBlocker(0);
+}
+
+std::auto_ptr<const ImageBlocker>
+ByteProvider::getImageBlocker(size_t product) const
+{
+    const ProductInfo& productInfo(getProductInfo(product));
+
+    std::vector<size_t> numRowsPerSegment(productInfo.numSegments);
+    for (size_t ii = 0; ii < numRowsPerSegment.size(); ++ii)
     {
-        numRowsPerSegment[ii] = mImageSegmentInfo[ii].numRows;
+        numRowsPerSegment[ii] =
+                mImageSegmentInfo[productInfo.firstSegment + ii].numRows;
     }
 
     std::auto_ptr<const ImageBlocker> blocker(new ImageBlocker(
             numRowsPerSegment,
-            mNumCols,
-            mOverallNumRowsPerBlock,
-            mNumColsPerBlock));
+            productInfo.numCols,
+            productInfo.numRowsPerBlock,
+            productInfo.numColsPerBlock));
 
     return blocker;
 }
@@ -330,7 +511,7 @@ void ByteProvider::checkBlocking(size_t seg,
                                  size_t startGlobalRowToWrite,
                                  size_t numRowsToWrite) const
 {
-    if (mOverallNumRowsPerBlock != 0)
+    if (mImageProducts[mSegmentProducts[seg]].numRowsPerBlock != 0)
     {
         const SegmentInfo& imageSegmentInfo(mImageSegmentInfo[seg]);
         const size_t segStartRow = imageSegmentInfo.firstRow;
@@ -399,13 +580,15 @@ void ByteProvider::addImageData(
 {
     const SegmentInfo& imageSegmentInfo = mImageSegmentInfo[seg];
     const size_t segStartRow = imageSegmentInfo.firstRow;
+    const size_t numBytesPerRow =
+            mImageProducts[mSegmentProducts[seg]].numBytesPerRow;
 
     // Figure out what offset of 'imageData' we're writing from
     const size_t startLocalRowToWrite =
             startGlobalRowToWrite - startRow + numPadRowsSoFar;
     const sys::byte* imageDataPtr =
             static_cast<const sys::byte*>(imageData) +
-            startLocalRowToWrite * mNumBytesPerRow;
+            startLocalRowToWrite * numBytesPerRow;
 
     if (buffers.empty())
     {
@@ -414,14 +597,14 @@ void ByteProvider::addImageData(
 
         fileOffset = mImageSubheaderFileOffsets[seg] +
                 mImageSubheaders[seg].size() +
-                rowsInSegmentSkipped * mNumBytesPerRow;
+                rowsInSegmentSkipped * numBytesPerRow;
     }
 
     const size_t numPadRows = countPadRows(seg, numRowsToWrite, imageDataEndRow);
     numRowsToWrite += numPadRows;
     numPadRowsSoFar += numPadRows;
 
-    buffers.pushBack(imageDataPtr, numRowsToWrite * mNumBytesPerRow);
+    buffers.pushBack(imageDataPtr, numRowsToWrite * numBytesPerRow);
 }
 
 size_t ByteProvider::countBytesForHeaders(size_t seg, size_t startRow) const
@@ -474,10 +657,41 @@ bool ByteProvider::shouldAddDES(size_t seg, size_t imageDataEndRow) const
 {
     // When we write out the last row of the last image segment, we
     // tack on the DES(s)
-    return (seg == mImageSegmentInfo.size() - 1 &&
+    return (!mImageProducts.empty() &&
+            seg == mImageProducts.back().endSegment() - 1 &&
+            mImageSegmentInfo[seg].endRow() == imageDataEndRow);
+}
+
+bool ByteProvider::shouldAddTrailingSegments(size_t seg,
+                                             size_t imageDataEndRow) const
+{
+    // Same idea as the DES(s), but for the end of each product
+    const ProductInfo& productInfo(mImageProducts[mSegmentProducts[seg]]);
+    return (seg == productInfo.endSegment() - 1 &&
             mImageSegmentInfo[seg].endRow() == imageDataEndRow);
 }
 
+size_t ByteProvider::countBytesForTrailingSegments(
+        size_t seg, size_t imageDataEndRow) const
+{
+    return shouldAddTrailingSegments(seg, imageDataEndRow) ?
+            mImageProducts[mSegmentProducts[seg]].trailingSegments.size() : 0;
+}
+
+void ByteProvider::addTrailingSegments(size_t seg, size_t imageDataEndRow,
+        NITFBufferList& buffers) const
+{
+    if (shouldAddTrailingSegments(seg, imageDataEndRow))
+    {
+        const std::vector<sys::byte>& trailingSegments(
+                mImageProducts[mSegmentProducts[seg]].trailingSegments);
+        if (!trailingSegments.empty())
+        {
+            buffers.pushBack(trailingSegments);
+        }
+    }
+}
+
 size_t ByteProvider::countBytesForDES(size_t seg, size_t imageDataEndRow) const
 {
     return shouldAddDES(seg, imageDataEndRow) ? mDesSubheaderAndData.size() : 0;
@@ -494,10 +708,21 @@ void ByteProvider::addDES(size_t seg, size_t imageDataEndRow,
 
 nitf::Off ByteProvider::getNumBytes(size_t startRow, size_t numRows) const
 {
+    return mImageProducts.empty() ? 0 : getNumBytes(0, startRow, numRows);
+}
+
+nitf::Off ByteProvider::getNumBytes(size_t product,
+                                    size_t startRow,
+                                    size_t numRows) const
+{
+    const ProductInfo& productInfo(getProductInfo(product));
+
     nitf::Off numBytes(0);
     const size_t imageDataEndRow = startRow + numRows;
 
-    for (size_t seg = 0; seg < mImageSegmentInfo.size(); ++seg)
+    for (size_t seg = productInfo.firstSegment;
+         seg < productInfo.endSegment();
+         ++seg)
     {
         // See if we're in this segment
         const SegmentInfo& imageSegmentInfo(mImageSegmentInfo[seg]);
@@ -510,9 +735,10 @@ nitf::Off ByteProvider::getNumBytes(size_t startRow, size_t numRows) const
         {
             checkBlocking(seg, startGlobalRowToWrite, numRowsToWrite);
             numBytes += countBytesForHeaders(seg, startRow);
-            numBytes += mNumBytesPerRow *
+            numBytes += productInfo.numBytesPerRow *
                     (numRowsToWrite +
                      countPadRows(seg, numRowsToWrite, imageDataEndRow));
+            numBytes += countBytesForTrailingSegments(seg, imageDataEndRow);
             numBytes += countBytesForDES(seg, imageDataEndRow);
         }
     }
@@ -526,13 +752,34 @@ void ByteProvider::getBytes(const void* imageData,
                             nitf::Off& fileOffset,
                             NITFBufferList& buffers) const
 {
+    if (mImageProducts.empty())
+    {
+        fileOffset = std::numeric_limits<nitf::Off>::max();
+        buffers.clear();
+        return;
+    }
+
+    getBytes(0, imageData, startRow, numRows, fileOffset, buffers);
+}
+
+void ByteProvider::getBytes(size_t product,
+                            const void* imageData,
+                            size_t startRow,
+                            size_t numRows,
+                            nitf::Off& fileOffset,
+                            NITFBufferList& buffers) const
+{
+    const ProductInfo& productInfo(getProductInfo(product));
+
     fileOffset = std::numeric_limits<nitf::Off>::max();
     buffers.clear();
 
     const size_t imageDataEndRow = startRow + numRows;
     size_t numPadRowsSoFar(0);
 
-    for (size_t seg = 0; seg < mImageSegmentInfo.size(); ++seg)
+    for (size_t seg = productInfo.firstSegment;
+         seg < productInfo.endSegment();
+         ++seg)
     {
         // See if we're in this segment
         const SegmentInfo& imageSegmentInfo(mImageSegmentInfo[seg]);
@@ -555,6 +802,7 @@ void ByteProvider::getBytes(const void* imageData,
                     fileOffset,
                     buffers);
 
+            addTrailingSegments(seg, imageDataEndRow, buffers);
             addDES(seg, imageDataEndRow, buffers);
         }
     }
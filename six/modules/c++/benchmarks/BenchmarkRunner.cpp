@@ -0,0 +1,351 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#ifndef WIN32
+#include <sys/resource.h>
+#endif
+
+#include <except/Exception.h>
+#include <sys/StopWatch.h>
+
+#include "BenchmarkRunner.h"
+
+namespace
+{
+// Looks up a "Name:   1234 kB" line in /proc/self/status
+size_t readStatusKB(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, field.length(), field) == 0 &&
+            line.length() > field.length() && line[field.length()] == ':')
+        {
+            std::istringstream value(line.substr(field.length() + 1));
+            size_t kb = 0;
+            value >> kb;
+            return kb;
+        }
+    }
+    return 0;
+}
+
+std::string escapeJSON(const std::string& str)
+{
+    std::ostringstream os;
+    for (size_t ii = 0; ii < str.length(); ++ii)
+    {
+        const char c = str[ii];
+        switch (c)
+        {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\r':
+            os << "\\r";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<int>(c) << std::dec << std::setfill(' ');
+            }
+            else
+            {
+                os << c;
+            }
+        }
+    }
+    return os.str();
+}
+
+double perSecond(double amount, double elapsedMS)
+{
+    return elapsedMS > 0.0 ? amount * 1000.0 / elapsedMS : 0.0;
+}
+}
+
+namespace benchmark
+{
+bool resetPeakRSS()
+{
+    // Writing 5 to clear_refs resets VmHWM to the current RSS
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (!clearRefs)
+    {
+        return false;
+    }
+    clearRefs << "5";
+    clearRefs.close();
+    return !clearRefs.fail();
+}
+
+size_t getPeakRSSKB()
+{
+    const size_t kb = readStatusKB("VmHWM");
+    if (kb != 0)
+    {
+        return kb;
+    }
+
+#ifndef WIN32
+    // No procfs, so settle for the peak over the life of the process
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return static_cast<size_t>(usage.ru_maxrss);
+    }
+#endif
+    return 0;
+}
+
+size_t getCurrentRSSKB()
+{
+    return readStatusKB("VmRSS");
+}
+
+Scenario::Scenario(const std::string& name, const std::string& itemUnit) :
+    mName(name),
+    mItemUnit(itemUnit)
+{
+}
+
+Scenario::~Scenario()
+{
+}
+
+void Scenario::setUp()
+{
+}
+
+void Scenario::tearDown()
+{
+}
+
+Result::Result() :
+    numIterations(0),
+    minMS(0.0),
+    medianMS(0.0),
+    maxMS(0.0),
+    numBytes(0),
+    numItems(0),
+    megabytesPerSecond(0.0),
+    itemsPerSecond(0.0),
+    startRSSKB(0),
+    peakRSSKB(0),
+    peakRSSIsPerScenario(false)
+{
+}
+
+Runner::Runner(size_t numIterations, size_t numWarmups, std::ostream* log) :
+    mNumIterations(std::max<size_t>(numIterations, 1)),
+    mNumWarmups(numWarmups),
+    mLog(log)
+{
+}
+
+const Result& Runner::run(Scenario& scenario)
+{
+    mResults.push_back(Result());
+    Result& result = mResults.back();
+    result.name = scenario.getName();
+    result.itemUnit = scenario.getItemUnit();
+
+    try
+    {
+        runImpl(scenario, result);
+    }
+    catch (const except::Exception& ex)
+    {
+        result.error = ex.getMessage();
+    }
+    catch (const std::exception& ex)
+    {
+        result.error = ex.what();
+    }
+    catch (...)
+    {
+        result.error = "Unknown exception";
+    }
+
+    six::setInstrumentationSink(NULL);
+    print(result);
+    return result;
+}
+
+void Runner::runImpl(Scenario& scenario, Result& result)
+{
+    result.startRSSKB = getCurrentRSSKB();
+    result.peakRSSIsPerScenario = resetPeakRSS();
+
+    scenario.setUp();
+    for (size_t ii = 0; ii < mNumWarmups; ++ii)
+    {
+        scenario.run();
+    }
+
+    six::StatisticsSink statistics;
+    six::setInstrumentationSink(&statistics);
+
+    std::vector<double> elapsedMS(mNumIterations);
+    for (size_t ii = 0; ii < mNumIterations; ++ii)
+    {
+        sys::RealTimeStopWatch watch;
+        watch.start();
+        scenario.run();
+        elapsedMS[ii] = watch.stop();
+    }
+
+    six::setInstrumentationSink(NULL);
+    result.peakRSSKB = getPeakRSSKB();
+    result.stages = statistics.getSnapshot();
+    result.numBytes = scenario.getNumBytes();
+    result.numItems = scenario.getNumItems();
+    scenario.tearDown();
+
+    std::sort(elapsedMS.begin(), elapsedMS.end());
+    result.numIterations = elapsedMS.size();
+    result.minMS = elapsedMS.front();
+    result.maxMS = elapsedMS.back();
+    result.medianMS = elapsedMS[elapsedMS.size() / 2];
+    result.megabytesPerSecond =
+            perSecond(static_cast<double>(result.numBytes) / (1024 * 1024),
+                      result.medianMS);
+    result.itemsPerSecond =
+            perSecond(static_cast<double>(result.numItems), result.medianMS);
+}
+
+void Runner::print(const Result& result) const
+{
+    if (!mLog)
+    {
+        return;
+    }
+
+    std::ostream& os = *mLog;
+    os << std::left << std::setw(28) << result.name << std::right;
+    if (!result.error.empty())
+    {
+        os << "FAILED: " << result.error << "\n";
+        return;
+    }
+
+    os << std::fixed << std::setprecision(2)
+       << std::setw(10) << result.medianMS << " ms"
+       << std::setw(10) << std::setprecision(1)
+       << result.megabytesPerSecond << " MB/s"
+       << std::setw(12) << std::setprecision(0)
+       << result.itemsPerSecond << " " << result.itemUnit << "/s"
+       << std::setw(10) << result.peakRSSKB / 1024 << " MB peak\n";
+}
+
+bool Runner::hasErrors() const
+{
+    for (size_t ii = 0; ii < mResults.size(); ++ii)
+    {
+        if (!mResults[ii].error.empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Runner::writeJSON(const std::map<std::string, std::string>& config,
+                       std::ostream& os) const
+{
+    os << "{\n  \"config\": {";
+    for (std::map<std::string, std::string>::const_iterator iter =
+                 config.begin();
+         iter != config.end();
+         ++iter)
+    {
+        os << (iter == config.begin() ? "\n" : ",\n")
+           << "    \"" << escapeJSON(iter->first) << "\": \""
+           << escapeJSON(iter->second) << "\"";
+    }
+    os << "\n  },\n  \"results\": [";
+
+    os << std::fixed;
+    for (size_t ii = 0; ii < mResults.size(); ++ii)
+    {
+        const Result& result = mResults[ii];
+        os << (ii == 0 ? "\n" : ",\n")
+           << "    {\n"
+           << "      \"name\": \"" << escapeJSON(result.name) << "\",\n";
+        if (!result.error.empty())
+        {
+            os << "      \"error\": \"" << escapeJSON(result.error)
+               << "\"\n    }";
+            continue;
+        }
+
+        os << std::setprecision(3)
+           << "      \"iterations\": " << result.numIterations << ",\n"
+           << "      \"minMS\": " << result.minMS << ",\n"
+           << "      \"medianMS\": " << result.medianMS << ",\n"
+           << "      \"maxMS\": " << result.maxMS << ",\n"
+           << "      \"bytes\": " << result.numBytes << ",\n"
+           << "      \"items\": " << result.numItems << ",\n"
+           << "      \"itemUnit\": \"" << escapeJSON(result.itemUnit)
+           << "\",\n"
+           << "      \"megabytesPerSecond\": " << result.megabytesPerSecond
+           << ",\n"
+           << "      \"itemsPerSecond\": " << result.itemsPerSecond << ",\n"
+           << "      \"startRSSKB\": " << result.startRSSKB << ",\n"
+           << "      \"peakRSSKB\": " << result.peakRSSKB << ",\n"
+           << "      \"peakRSSIsPerScenario\": "
+           << (result.peakRSSIsPerScenario ? "true" : "false") << ",\n"
+           << "      \"stages\": {";
+
+        for (six::StatisticsSink::Snapshot::const_iterator iter =
+                     result.stages.begin();
+             iter != result.stages.end();
+             ++iter)
+        {
+            const six::StageStatistics& stage = iter->second;
+            os << (iter == result.stages.begin() ? "\n" : ",\n")
+               << "        \"" << escapeJSON(iter->first) << "\": {"
+               << "\"count\": " << stage.count
+               << ", \"totalMS\": " << stage.totalMS
+               << ", \"bytes\": " << stage.numBytes
+               << ", \"rows\": " << stage.numRows << "}";
+        }
+        os << (result.stages.empty() ? "}\n" : "\n      }\n") << "    }";
+    }
+    os << "\n  ]\n}\n";
+}
+}
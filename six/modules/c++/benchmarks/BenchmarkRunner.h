@@ -0,0 +1,191 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_BENCHMARK_RUNNER_H__
+#define __SIX_BENCHMARK_RUNNER_H__
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <six/Instrumentation.h>
+
+namespace benchmark
+{
+/*!
+ * Resets the peak resident set size the kernel reports for this process, so
+ * the next getPeakRSSKB() only covers what happened since.  This needs
+ * Linux 4.0 or later.
+ *
+ * \return False if the peak couldn't be reset.  getPeakRSSKB() is then the
+ * peak over the life of the process.
+ */
+bool resetPeakRSS();
+
+//! \return Peak resident set size of this process in kB, or 0 if unknown
+size_t getPeakRSSKB();
+
+//! \return Current resident set size of this process in kB, or 0 if unknown
+size_t getCurrentRSSKB();
+
+/*!
+ * \class Scenario
+ * \brief One timed operation
+ *
+ * setUp() and tearDown() run once around all of the timed run()s.  Memory
+ * allocated in setUp() counts toward the scenario's peak RSS, since it's
+ * part of what the operation needs.
+ */
+class Scenario
+{
+public:
+    /*!
+     * \param name Dotted name, starting with the product
+     * (e.g. "sicd.read.aoi")
+     * \param itemUnit What getNumItems() counts (e.g. "rows")
+     */
+    Scenario(const std::string& name, const std::string& itemUnit);
+
+    virtual ~Scenario();
+
+    const std::string& getName() const
+    {
+        return mName;
+    }
+
+    const std::string& getItemUnit() const
+    {
+        return mItemUnit;
+    }
+
+    virtual void setUp();
+
+    //! The part that's timed
+    virtual void run() = 0;
+
+    virtual void tearDown();
+
+    //! \return Bytes of pixels (or samples) one run() moves
+    virtual sys::Uint64_T getNumBytes() const = 0;
+
+    //! \return Items one run() processes
+    virtual sys::Uint64_T getNumItems() const = 0;
+
+private:
+    const std::string mName;
+    const std::string mItemUnit;
+};
+
+/*!
+ * \struct Result
+ * \brief Timing and memory use of one scenario
+ */
+struct Result
+{
+    Result();
+
+    std::string name;
+    std::string itemUnit;
+
+    //! What went wrong, if the scenario threw.  Nothing else is set then.
+    std::string error;
+
+    size_t numIterations;
+    double minMS;
+    double medianMS;
+    double maxMS;
+    sys::Uint64_T numBytes;
+    sys::Uint64_T numItems;
+
+    //! Throughput of the median iteration
+    double megabytesPerSecond;
+    double itemsPerSecond;
+
+    //! RSS before setUp()
+    size_t startRSSKB;
+
+    //! Peak RSS from setUp() through the last run()
+    size_t peakRSSKB;
+
+    //! False if the peak couldn't be reset, so peakRSSKB includes earlier
+    //! scenarios
+    bool peakRSSIsPerScenario;
+
+    //! Stage timings from six's instrumentation, over the timed runs
+    six::StatisticsSink::Snapshot stages;
+};
+
+/*!
+ * \class Runner
+ * \brief Times scenarios and reports the results
+ */
+class Runner
+{
+public:
+    /*!
+     * \param numIterations Timed runs per scenario
+     * \param numWarmups Untimed runs per scenario before the timed ones, to
+     * get files into the page cache and allocators warmed up
+     * \param log Stream to print each result to as it finishes, or NULL
+     */
+    Runner(size_t numIterations, size_t numWarmups, std::ostream* log);
+
+    /*!
+     * Runs a scenario.  If it throws, the error's recorded in its result
+     * and the runner moves on.
+     *
+     * \return The scenario's result
+     */
+    const Result& run(Scenario& scenario);
+
+    const std::vector<Result>& getResults() const
+    {
+        return mResults;
+    }
+
+    //! \return True if any scenario threw
+    bool hasErrors() const;
+
+    /*!
+     * Writes every result as JSON
+     *
+     * \param config Settings to record alongside the results
+     * \param os Stream to write to
+     */
+    void writeJSON(const std::map<std::string, std::string>& config,
+                   std::ostream& os) const;
+
+private:
+    void runImpl(Scenario& scenario, Result& result);
+
+    void print(const Result& result) const;
+
+private:
+    const size_t mNumIterations;
+    const size_t mNumWarmups;
+    std::ostream* const mLog;
+    std::vector<Result> mResults;
+};
+}
+
+#endif
@@ -0,0 +1,777 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <complex>
+
+#include <io/TempFile.h>
+#include <mem/BufferView.h>
+#include <scene/ProjectionModel.h>
+#include <tasks/TaskScheduler.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/Wideband.h>
+#include <six/NITFHeaderCreator.h>
+#include <six/NITFReadControl.h>
+#include <six/NITFWriteControl.h>
+#include <six/ParallelNITFFileSink.h>
+#include <six/Region.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sicd/SICDByteProvider.h>
+#include <six/sicd/SICDWriteControl.h>
+#include <six/sidd/DerivedXMLControl.h>
+
+#include "Scenarios.h"
+#include "SyntheticData.h"
+
+namespace
+{
+// AOI reads take the middle half of the rows and columns
+void getAOI(const types::RowCol<size_t>& dims,
+            types::RowCol<size_t>& offset,
+            types::RowCol<size_t>& aoiDims)
+{
+    aoiDims.row = std::max<size_t>(dims.row / 2, 1);
+    aoiDims.col = std::max<size_t>(dims.col / 2, 1);
+    offset.row = (dims.row - aoiDims.row) / 2;
+    offset.col = (dims.col - aoiDims.col) / 2;
+}
+
+void addCreators(six::XMLControlRegistry& registry)
+{
+    registry.addCreator(six::DataType::COMPLEX,
+                        new six::XMLControlCreatorT<
+                                six::sicd::ComplexXMLControl>());
+    registry.addCreator(six::DataType::DERIVED,
+                        new six::XMLControlCreatorT<
+                                six::sidd::DerivedXMLControl>());
+}
+
+six::Options getWriterOptions(const benchmark::Settings& settings)
+{
+    six::Options options;
+    options.setParameter(six::NITFHeaderCreator::OPT_MAX_ILOC_ROWS,
+                         settings.maxRowsPerSegment);
+    return options;
+}
+
+// Opens the file and parses the XML, but doesn't touch the pixels
+class NITFParseScenario : public benchmark::Scenario
+{
+public:
+    NITFParseScenario(const std::string& name, const std::string& pathname) :
+        Scenario(name, "files"),
+        mPathname(pathname)
+    {
+        addCreators(mRegistry);
+    }
+
+    virtual void run()
+    {
+        six::NITFReadControl reader;
+        reader.setXMLControlRegistry(&mRegistry);
+        reader.load(mPathname, std::vector<std::string>());
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return 0;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return 1;
+    }
+
+private:
+    const std::string mPathname;
+    six::XMLControlRegistry mRegistry;
+};
+
+// Reads every image in the file through NITFReadControl::interleaved()
+class NITFReadScenario : public benchmark::Scenario
+{
+public:
+    NITFReadScenario(const std::string& name,
+                     const std::string& pathname,
+                     bool aoi) :
+        Scenario(name, "rows"),
+        mPathname(pathname),
+        mAOI(aoi),
+        mNumBytes(0),
+        mNumRows(0)
+    {
+        addCreators(mRegistry);
+    }
+
+    virtual void setUp()
+    {
+        mReader.reset(new six::NITFReadControl());
+        mReader->setXMLControlRegistry(&mRegistry);
+        mReader->load(mPathname, std::vector<std::string>());
+
+        const mem::SharedPtr<six::Container> container =
+                mReader->getContainer();
+        size_t maxBytes = 0;
+        for (size_t ii = 0; ii < container->getNumData(); ++ii)
+        {
+            const six::Data* const data = container->getData(ii);
+            Image image;
+            image.number = ii;
+            image.offset = types::RowCol<size_t>(0, 0);
+            image.dims = types::RowCol<size_t>(data->getNumRows(),
+                                               data->getNumCols());
+            if (mAOI)
+            {
+                getAOI(types::RowCol<size_t>(image.dims), image.offset,
+                       image.dims);
+            }
+
+            const size_t numBytes =
+                    image.dims.area() * data->getNumBytesPerPixel();
+            maxBytes = std::max(maxBytes, numBytes);
+            mNumBytes += numBytes;
+            mNumRows += image.dims.row;
+            mImages.push_back(image);
+        }
+        mBuffer.resize(maxBytes);
+    }
+
+    virtual void run()
+    {
+        for (size_t ii = 0; ii < mImages.size(); ++ii)
+        {
+            const Image& image = mImages[ii];
+            six::Region region;
+            region.setStartRow(image.offset.row);
+            region.setStartCol(image.offset.col);
+            region.setNumRows(image.dims.row);
+            region.setNumCols(image.dims.col);
+            region.setBuffer(&mBuffer[0]);
+            mReader->interleaved(region, image.number);
+        }
+    }
+
+    virtual void tearDown()
+    {
+        mReader.reset();
+        std::vector<six::UByte>().swap(mBuffer);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return mNumBytes;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return mNumRows;
+    }
+
+private:
+    struct Image
+    {
+        size_t number;
+        types::RowCol<size_t> offset;
+        types::RowCol<size_t> dims;
+    };
+
+    const std::string mPathname;
+    const bool mAOI;
+    six::XMLControlRegistry mRegistry;
+    std::auto_ptr<six::NITFReadControl> mReader;
+    std::vector<Image> mImages;
+    std::vector<six::UByte> mBuffer;
+    sys::Uint64_T mNumBytes;
+    sys::Uint64_T mNumRows;
+};
+
+// Shared by the write scenarios: the pixels to write and somewhere to put
+// them
+class NITFWriteScenarioBase : public benchmark::Scenario
+{
+public:
+    NITFWriteScenarioBase(const std::string& name,
+                          mem::SharedPtr<six::Container> container,
+                          const benchmark::Settings& settings) :
+        Scenario(name, "rows"),
+        mContainer(container),
+        mSettings(settings),
+        mNumBytes(0),
+        mNumRows(0)
+    {
+        addCreators(mRegistry);
+    }
+
+    virtual void setUp()
+    {
+        mOutput.reset(new io::TempFile(mSettings.outputDir));
+        mImages.resize(mContainer->getNumData());
+        mBuffers.resize(mImages.size());
+        for (size_t ii = 0; ii < mImages.size(); ++ii)
+        {
+            const six::Data* const data = mContainer->getData(ii);
+            const size_t numPixels = data->getNumRows() * data->getNumCols();
+            mImages[ii].resize(numPixels * data->getNumBytesPerPixel());
+            benchmark::fillPixels(
+                    data->getPixelType(), numPixels,
+                    mSettings.seed + static_cast<sys::Uint32_T>(ii),
+                    &mImages[ii][0]);
+            mBuffers[ii] = &mImages[ii][0];
+            mNumBytes += mImages[ii].size();
+            mNumRows += data->getNumRows();
+        }
+    }
+
+    virtual void tearDown()
+    {
+        mOutput.reset();
+        mBuffers.clear();
+        std::vector<std::vector<six::UByte> >().swap(mImages);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return mNumBytes;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return mNumRows;
+    }
+
+protected:
+    const mem::SharedPtr<six::Container> mContainer;
+    const benchmark::Settings mSettings;
+    six::XMLControlRegistry mRegistry;
+    std::auto_ptr<io::TempFile> mOutput;
+    std::vector<std::vector<six::UByte> > mImages;
+    six::BufferList mBuffers;
+    sys::Uint64_T mNumBytes;
+    sys::Uint64_T mNumRows;
+};
+
+// All of the pixels in memory, written with NITFWriteControl::save()
+class NITFWriteScenario : public NITFWriteScenarioBase
+{
+public:
+    NITFWriteScenario(const std::string& name,
+                      mem::SharedPtr<six::Container> container,
+                      const benchmark::Settings& settings) :
+        NITFWriteScenarioBase(name, container, settings)
+    {
+    }
+
+    virtual void run()
+    {
+        six::NITFWriteControl writer(getWriterOptions(mSettings), mContainer,
+                                     &mRegistry);
+        writer.save(mBuffers, mOutput->pathname(),
+                    std::vector<std::string>());
+    }
+};
+
+// Band by band in order with SICDWriteControl
+class SICDStreamingWriteScenario : public NITFWriteScenarioBase
+{
+public:
+    SICDStreamingWriteScenario(const std::string& name,
+                               mem::SharedPtr<six::Container> container,
+                               const benchmark::Settings& settings) :
+        NITFWriteScenarioBase(name, container, settings)
+    {
+    }
+
+    virtual void run()
+    {
+        const six::Data& data = *mContainer->getData(0);
+        const types::RowCol<size_t> dims(data.getNumRows(),
+                                         data.getNumCols());
+        const size_t numBytesPerRow = dims.col * data.getNumBytesPerPixel();
+
+        six::sicd::SICDWriteControl writer(mOutput->pathname(),
+                                           std::vector<std::string>());
+        writer.setXMLControlRegistry(&mRegistry);
+        writer.initialize(getWriterOptions(mSettings), mContainer);
+        for (size_t row = 0; row < dims.row; row += mSettings.numRowsPerBand)
+        {
+            const size_t numRows =
+                    std::min(mSettings.numRowsPerBand, dims.row - row);
+            writer.save(&mImages[0][row * numBytesPerRow],
+                        types::RowCol<size_t>(row, 0),
+                        types::RowCol<size_t>(numRows, dims.col));
+        }
+        writer.close();
+    }
+};
+
+class BandWriter
+{
+public:
+    BandWriter(six::ParallelNITFFileSink& sink,
+               const six::UByte* image,
+               size_t numRows,
+               size_t numBytesPerRow,
+               size_t numRowsPerBand) :
+        mSink(sink),
+        mImage(image),
+        mNumRows(numRows),
+        mNumBytesPerRow(numBytesPerRow),
+        mNumRowsPerBand(numRowsPerBand)
+    {
+    }
+
+    void operator()(size_t band) const
+    {
+        const size_t startRow = band * mNumRowsPerBand;
+        const size_t numRows = std::min(mNumRowsPerBand, mNumRows - startRow);
+        mSink.writeNativeEndian(mImage + startRow * mNumBytesPerRow,
+                                startRow, numRows);
+    }
+
+private:
+    six::ParallelNITFFileSink& mSink;
+    const six::UByte* const mImage;
+    const size_t mNumRows;
+    const size_t mNumBytesPerRow;
+    const size_t mNumRowsPerBand;
+};
+
+// Bands in parallel through a SICDByteProvider and ParallelNITFFileSink
+class SICDParallelWriteScenario : public NITFWriteScenarioBase
+{
+public:
+    SICDParallelWriteScenario(const std::string& name,
+                              mem::SharedPtr<six::Container> container,
+                              const benchmark::Settings& settings) :
+        NITFWriteScenarioBase(name, container, settings)
+    {
+    }
+
+    virtual void run()
+    {
+        const six::Data& data = *mContainer->getData(0);
+        const size_t numRows = data.getNumRows();
+        const size_t numRowsPerBand = mSettings.numRowsPerBand;
+
+        // Going through a writer gets the same segmentation as the others
+        const six::NITFWriteControl writer(getWriterOptions(mSettings),
+                                           mContainer, &mRegistry);
+        const six::sicd::SICDByteProvider provider(
+                writer, std::vector<std::string>());
+        six::ParallelNITFFileSink sink(provider, mOutput->pathname());
+
+        tasks::parallelFor((numRows + numRowsPerBand - 1) / numRowsPerBand,
+                           mSettings.numThreads,
+                           BandWriter(sink, &mImages[0][0], numRows,
+                                      data.getNumCols() *
+                                              data.getNumBytesPerPixel(),
+                                      numRowsPerBand),
+                           "six_benchmark.sicd.write.parallel");
+        sink.finalize();
+    }
+};
+
+// Reads the header, XML and VBM
+class CPHDParseScenario : public benchmark::Scenario
+{
+public:
+    CPHDParseScenario(const std::string& name,
+                      const std::string& pathname,
+                      size_t numThreads) :
+        Scenario(name, "files"),
+        mPathname(pathname),
+        mNumThreads(numThreads)
+    {
+    }
+
+    virtual void run()
+    {
+        const cphd::CPHDReader reader(mPathname, mNumThreads);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return 0;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return 1;
+    }
+
+private:
+    const std::string mPathname;
+    const size_t mNumThreads;
+};
+
+// Every channel with CPHDReader::readChannels(), or the middle of each
+// channel with Wideband::read()
+class CPHDReadScenario : public benchmark::Scenario
+{
+public:
+    CPHDReadScenario(const std::string& name,
+                     const std::string& pathname,
+                     size_t numThreads,
+                     bool aoi) :
+        Scenario(name, "vectors"),
+        mPathname(pathname),
+        mNumThreads(numThreads),
+        mAOI(aoi),
+        mNumBytes(0),
+        mNumVectors(0)
+    {
+    }
+
+    virtual void setUp()
+    {
+        mReader.reset(new cphd::CPHDReader(mPathname, mNumThreads));
+        const size_t numChannels = mReader->getNumChannels();
+        mOffsets.resize(numChannels);
+        mDims.resize(numChannels);
+        mData.resize(numChannels);
+        for (size_t ii = 0; ii < numChannels; ++ii)
+        {
+            mDims[ii] = types::RowCol<size_t>(mReader->getNumVectors(ii),
+                                              mReader->getNumSamples(ii));
+            if (mAOI)
+            {
+                getAOI(types::RowCol<size_t>(mDims[ii]), mOffsets[ii],
+                       mDims[ii]);
+            }
+
+            mData[ii].resize(mDims[ii].area() *
+                             mReader->getNumBytesPerSample());
+            mNumBytes += mData[ii].size();
+            mNumVectors += mDims[ii].row;
+            mViews.push_back(mem::BufferView<sys::ubyte>(&mData[ii][0],
+                                                         mData[ii].size()));
+        }
+    }
+
+    virtual void run()
+    {
+        if (!mAOI)
+        {
+            mReader->readChannels(mNumThreads, mViews);
+            return;
+        }
+
+        cphd::Wideband& wideband = mReader->getWideband();
+        for (size_t ii = 0; ii < mViews.size(); ++ii)
+        {
+            wideband.read(ii,
+                          mOffsets[ii].row,
+                          mOffsets[ii].row + mDims[ii].row - 1,
+                          mOffsets[ii].col,
+                          mOffsets[ii].col + mDims[ii].col - 1,
+                          mNumThreads,
+                          mViews[ii]);
+        }
+    }
+
+    virtual void tearDown()
+    {
+        mReader.reset();
+        mViews.clear();
+        std::vector<std::vector<sys::ubyte> >().swap(mData);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return mNumBytes;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return mNumVectors;
+    }
+
+private:
+    const std::string mPathname;
+    const size_t mNumThreads;
+    const bool mAOI;
+    std::auto_ptr<cphd::CPHDReader> mReader;
+    std::vector<types::RowCol<size_t> > mOffsets;
+    std::vector<types::RowCol<size_t> > mDims;
+    std::vector<std::vector<sys::ubyte> > mData;
+    std::vector<mem::BufferView<sys::ubyte> > mViews;
+    sys::Uint64_T mNumBytes;
+    sys::Uint64_T mNumVectors;
+};
+
+// Every channel with CPHDWriter::addImage() and write()
+class CPHDWriteScenario : public benchmark::Scenario
+{
+public:
+    CPHDWriteScenario(const std::string& name,
+                      const cphd::Metadata& metadata,
+                      const benchmark::Settings& settings) :
+        Scenario(name, "vectors"),
+        mMetadata(metadata),
+        mSettings(settings),
+        mNumBytes(0),
+        mNumVectors(0)
+    {
+    }
+
+    virtual void setUp()
+    {
+        mOutput.reset(new io::TempFile(mSettings.outputDir));
+        const cphd::VBM vbm = benchmark::createVBM(mMetadata);
+        const size_t numChannels = mMetadata.getNumChannels();
+        mData.resize(numChannels);
+        mVBMData.resize(numChannels);
+        for (size_t ii = 0; ii < numChannels; ++ii)
+        {
+            const size_t numSamples = mMetadata.getNumVectors(ii) *
+                    mMetadata.getNumSamples(ii);
+            mData[ii].resize(numSamples * mMetadata.getNumBytesPerSample());
+            benchmark::fillSamples(
+                    mMetadata.getSampleType(), numSamples,
+                    mSettings.seed + static_cast<sys::Uint32_T>(ii),
+                    &mData[ii][0]);
+            vbm.getVBMdata(ii, mVBMData[ii]);
+            mNumBytes += mData[ii].size();
+            mNumVectors += mMetadata.getNumVectors(ii);
+        }
+    }
+
+    virtual void run()
+    {
+        cphd::CPHDWriter writer(mMetadata, mSettings.numThreads);
+        for (size_t ii = 0; ii < mData.size(); ++ii)
+        {
+            const types::RowCol<size_t> dims(mMetadata.getNumVectors(ii),
+                                             mMetadata.getNumSamples(ii));
+            const void* const data = &mData[ii][0];
+            switch (mMetadata.getSampleType())
+            {
+            case cphd::SampleType::RE32F_IM32F:
+                writer.addImage(
+                        static_cast<const std::complex<float>*>(data),
+                        dims, &mVBMData[ii][0]);
+                break;
+            case cphd::SampleType::RE16I_IM16I:
+                writer.addImage(
+                        static_cast<const std::complex<sys::Int16_T>*>(data),
+                        dims, &mVBMData[ii][0]);
+                break;
+            default:
+                writer.addImage(
+                        static_cast<const std::complex<sys::Int8_T>*>(data),
+                        dims, &mVBMData[ii][0]);
+                break;
+            }
+        }
+        writer.write(mOutput->pathname());
+    }
+
+    virtual void tearDown()
+    {
+        mOutput.reset();
+        std::vector<std::vector<sys::ubyte> >().swap(mData);
+        std::vector<std::vector<sys::ubyte> >().swap(mVBMData);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return mNumBytes;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return mNumVectors;
+    }
+
+private:
+    const cphd::Metadata mMetadata;
+    const benchmark::Settings mSettings;
+    std::auto_ptr<io::TempFile> mOutput;
+    std::vector<std::vector<sys::ubyte> > mData;
+    std::vector<std::vector<sys::ubyte> > mVBMData;
+    sys::Uint64_T mNumBytes;
+    sys::Uint64_T mNumVectors;
+};
+
+// A batch of points spread over a 2 km x 2 km image
+class ProjectionScenario : public benchmark::Scenario
+{
+public:
+    ProjectionScenario(const std::string& name,
+                       size_t numPoints,
+                       bool sceneToImage) :
+        Scenario(name, "points"),
+        mNumPoints(numPoints),
+        mSceneToImage(sceneToImage),
+        mChecksum(0.0)
+    {
+    }
+
+    virtual void setUp()
+    {
+        mModel.reset(benchmark::createProjectionModel().release());
+        mImagePoints.resize(mNumPoints);
+        mScenePoints.resize(mNumPoints);
+        for (size_t ii = 0; ii < mNumPoints; ++ii)
+        {
+            mImagePoints[ii].row = 2000.0 * (ii % 100) / 99.0 - 1000.0;
+            mImagePoints[ii].col =
+                    2000.0 * ((ii / 100) % 100) / 99.0 - 1000.0;
+            mScenePoints[ii] = mModel->imageToScene(mImagePoints[ii], 0.0);
+        }
+    }
+
+    virtual void run()
+    {
+        // Accumulate something so the work isn't optimized away
+        if (mSceneToImage)
+        {
+            for (size_t ii = 0; ii < mNumPoints; ++ii)
+            {
+                mChecksum += mModel->sceneToImage(mScenePoints[ii]).row;
+            }
+        }
+        else
+        {
+            for (size_t ii = 0; ii < mNumPoints; ++ii)
+            {
+                mChecksum += mModel->imageToScene(mImagePoints[ii], 0.0)[0];
+            }
+        }
+    }
+
+    virtual void tearDown()
+    {
+        mModel.reset();
+        std::vector<types::RowCol<double> >().swap(mImagePoints);
+        std::vector<scene::Vector3>().swap(mScenePoints);
+    }
+
+    virtual sys::Uint64_T getNumBytes() const
+    {
+        return 0;
+    }
+
+    virtual sys::Uint64_T getNumItems() const
+    {
+        return mNumPoints;
+    }
+
+private:
+    const size_t mNumPoints;
+    const bool mSceneToImage;
+    std::auto_ptr<scene::ProjectionModel> mModel;
+    std::vector<types::RowCol<double> > mImagePoints;
+    std::vector<scene::Vector3> mScenePoints;
+    double mChecksum;
+};
+}
+
+namespace benchmark
+{
+Settings::Settings() :
+    outputDir("."),
+    numThreads(0),
+    numRowsPerBand(256),
+    maxRowsPerSegment(1024),
+    numPoints(10000),
+    seed(12345)
+{
+}
+
+void addSICDScenarios(const std::string& pathname,
+                      const six::sicd::ComplexData& data,
+                      const Settings& settings,
+                      Scenarios& scenarios)
+{
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::COMPLEX));
+    container->addData(data.clone());
+
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFParseScenario("sicd.parse", pathname)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFReadScenario("sicd.read.full", pathname, false)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFReadScenario("sicd.read.aoi", pathname, true)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFWriteScenario("sicd.write.full", container, settings)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new SICDStreamingWriteScenario("sicd.write.streaming",
+                                           container, settings)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new SICDParallelWriteScenario("sicd.write.parallel",
+                                          container, settings)));
+}
+
+void addSIDDScenarios(const std::string& pathname,
+                      const six::sidd::DerivedData& data,
+                      size_t numImages,
+                      const Settings& settings,
+                      Scenarios& scenarios)
+{
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::DERIVED));
+    for (size_t ii = 0; ii < numImages; ++ii)
+    {
+        container->addData(data.clone());
+    }
+
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFParseScenario("sidd.parse", pathname)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFReadScenario("sidd.read.full", pathname, false)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFReadScenario("sidd.read.aoi", pathname, true)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new NITFWriteScenario("sidd.write.full", container, settings)));
+}
+
+void addCPHDScenarios(const std::string& pathname,
+                      const cphd::Metadata& metadata,
+                      const Settings& settings,
+                      Scenarios& scenarios)
+{
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new CPHDParseScenario("cphd.parse", pathname,
+                                  settings.numThreads)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new CPHDReadScenario("cphd.read.full", pathname,
+                                 settings.numThreads, false)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new CPHDReadScenario("cphd.read.aoi", pathname,
+                                 settings.numThreads, true)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new CPHDWriteScenario("cphd.write.full", metadata, settings)));
+}
+
+void addProjectionScenarios(const Settings& settings, Scenarios& scenarios)
+{
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new ProjectionScenario("projection.sceneToImage",
+                                   settings.numPoints, true)));
+    scenarios.push_back(mem::SharedPtr<Scenario>(
+            new ProjectionScenario("projection.imageToScene",
+                                   settings.numPoints, false)));
+}
+}
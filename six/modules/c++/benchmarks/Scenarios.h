@@ -0,0 +1,118 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_BENCHMARK_SCENARIOS_H__
+#define __SIX_BENCHMARK_SCENARIOS_H__
+
+#include <string>
+#include <vector>
+
+#include <mem/SharedPtr.h>
+#include <cphd/Metadata.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sidd/DerivedData.h>
+
+#include "BenchmarkRunner.h"
+
+namespace benchmark
+{
+typedef std::vector<mem::SharedPtr<Scenario> > Scenarios;
+
+/*!
+ * \struct Settings
+ * \brief What the scenarios share
+ */
+struct Settings
+{
+    Settings();
+
+    //! Directory for the output of write scenarios
+    std::string outputDir;
+
+    //! Threads to use where the code takes a thread count (0 for all)
+    size_t numThreads;
+
+    //! Rows per band for streaming writes
+    size_t numRowsPerBand;
+
+    //! Image segments hold at most this many rows
+    size_t maxRowsPerSegment;
+
+    //! Points per projection batch
+    size_t numPoints;
+
+    //! Seed for the synthetic pixels
+    sys::Uint32_T seed;
+};
+
+/*!
+ * Adds parse, full and AOI read, and full, streaming and parallel write
+ * scenarios for a SICD
+ *
+ * \param pathname SICD written with writeSICD()
+ * \param data The SICD's metadata
+ * \param settings Shared settings
+ * \param scenarios Scenarios to add to
+ */
+void addSICDScenarios(const std::string& pathname,
+                      const six::sicd::ComplexData& data,
+                      const Settings& settings,
+                      Scenarios& scenarios);
+
+/*!
+ * Adds parse, full and AOI read, and write scenarios for a SIDD
+ *
+ * \param pathname SIDD written with writeSIDD()
+ * \param data Metadata of each of the SIDD's products
+ * \param numImages Number of products in the SIDD
+ * \param settings Shared settings
+ * \param scenarios Scenarios to add to
+ */
+void addSIDDScenarios(const std::string& pathname,
+                      const six::sidd::DerivedData& data,
+                      size_t numImages,
+                      const Settings& settings,
+                      Scenarios& scenarios);
+
+/*!
+ * Adds parse, full and AOI read, and write scenarios for a CPHD
+ *
+ * \param pathname CPHD written with writeCPHD()
+ * \param metadata The CPHD's metadata
+ * \param settings Shared settings
+ * \param scenarios Scenarios to add to
+ */
+void addCPHDScenarios(const std::string& pathname,
+                      const cphd::Metadata& metadata,
+                      const Settings& settings,
+                      Scenarios& scenarios);
+
+/*!
+ * Adds scene to image and image to scene batches against
+ * createProjectionModel()
+ *
+ * \param settings Shared settings
+ * \param scenarios Scenarios to add to
+ */
+void addProjectionScenarios(const Settings& settings, Scenarios& scenarios);
+}
+
+#endif
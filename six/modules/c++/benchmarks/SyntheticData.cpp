@@ -0,0 +1,376 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <complex>
+#include <cstring>
+
+#include <except/Exception.h>
+#include <math/linear/VectorN.h>
+#include <mem/SharedPtr.h>
+#include <scene/SceneGeometry.h>
+#include <scene/Utilities.h>
+#include <cphd/CPHDWriter.h>
+#include <six/Container.h>
+#include <six/NITFHeaderCreator.h>
+#include <six/NITFWriteControl.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sicd/Utilities.h>
+#include <six/sidd/DerivedXMLControl.h>
+#include <six/sidd/Utilities.h>
+
+#include "SyntheticData.h"
+
+namespace
+{
+// Numerical Recipes' LCG.  Plenty random enough to defeat run-length
+// tricks, and fast enough not to dominate generating large images.
+class Pattern
+{
+public:
+    explicit Pattern(sys::Uint32_T seed) :
+        mState(seed)
+    {
+    }
+
+    sys::Uint32_T next()
+    {
+        mState = mState * 1664525u + 1013904223u;
+        return mState;
+    }
+
+    float nextFloat()
+    {
+        return (next() >> 8) * (2000.0f / 16777216.0f) - 1000.0f;
+    }
+
+private:
+    sys::Uint32_T mState;
+};
+
+void fillBytes(size_t numBytes, sys::Uint32_T seed, void* buffer)
+{
+    Pattern pattern(seed);
+    sys::ubyte* const bytes = static_cast<sys::ubyte*>(buffer);
+    for (size_t ii = 0; ii < numBytes; ii += sizeof(sys::Uint32_T))
+    {
+        const sys::Uint32_T value = pattern.next();
+        std::memcpy(bytes + ii, &value,
+                    std::min(sizeof(value), numBytes - ii));
+    }
+}
+
+void fillFloats(size_t numFloats, sys::Uint32_T seed, void* buffer)
+{
+    Pattern pattern(seed);
+    float* const floats = static_cast<float*>(buffer);
+    for (size_t ii = 0; ii < numFloats; ++ii)
+    {
+        floats[ii] = pattern.nextFloat();
+    }
+}
+
+size_t getNumBytesPerPixel(six::PixelType pixelType)
+{
+    switch (pixelType)
+    {
+    case six::PixelType::RE32F_IM32F:
+        return 8;
+    case six::PixelType::RE16I_IM16I:
+        return 4;
+    case six::PixelType::MONO16I:
+        return 2;
+    case six::PixelType::MONO8I:
+    case six::PixelType::MONO8LU:
+    case six::PixelType::RGB8LU:
+        return 1;
+    case six::PixelType::RGB24I:
+        return 3;
+    default:
+        throw except::Exception(Ctxt(
+                "Unsupported pixel type " + pixelType.toString()));
+    }
+}
+
+void save(mem::SharedPtr<six::Container> container,
+          const six::BufferList& buffers,
+          size_t maxRowsPerSegment,
+          const std::string& pathname)
+{
+    six::XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator(six::DataType::COMPLEX,
+                           new six::XMLControlCreatorT<
+                                   six::sicd::ComplexXMLControl>());
+    xmlRegistry.addCreator(six::DataType::DERIVED,
+                           new six::XMLControlCreatorT<
+                                   six::sidd::DerivedXMLControl>());
+
+    six::Options options;
+    options.setParameter(six::NITFHeaderCreator::OPT_MAX_ILOC_ROWS,
+                         maxRowsPerSegment);
+
+    six::NITFWriteControl writer(options, container, &xmlRegistry);
+    writer.save(buffers, pathname, std::vector<std::string>());
+}
+
+template <typename T>
+void writeCPHDImpl(const std::string& pathname,
+                   const cphd::Metadata& metadata,
+                   size_t numThreads,
+                   sys::Uint32_T seed)
+{
+    const cphd::VBM vbm = benchmark::createVBM(metadata);
+    const size_t numChannels = metadata.getNumChannels();
+
+    // The writer holds onto pointers until write()
+    std::vector<std::vector<T> > data(numChannels);
+    std::vector<std::vector<sys::ubyte> > vbmData(numChannels);
+
+    cphd::CPHDWriter writer(metadata, numThreads);
+    for (size_t ii = 0; ii < numChannels; ++ii)
+    {
+        const types::RowCol<size_t> dims(metadata.getNumVectors(ii),
+                                         metadata.getNumSamples(ii));
+        data[ii].resize(dims.area());
+        benchmark::fillSamples(metadata.getSampleType(), dims.area(),
+                               seed + static_cast<sys::Uint32_T>(ii),
+                               &data[ii][0]);
+        vbm.getVBMdata(ii, vbmData[ii]);
+        writer.addImage(&data[ii][0], dims, &vbmData[ii][0]);
+    }
+    writer.write(pathname);
+}
+}
+
+namespace benchmark
+{
+void fillPixels(six::PixelType pixelType,
+                size_t numPixels,
+                sys::Uint32_T seed,
+                void* buffer)
+{
+    if (pixelType == six::PixelType::RE32F_IM32F)
+    {
+        fillFloats(numPixels * 2, seed, buffer);
+    }
+    else
+    {
+        fillBytes(numPixels * getNumBytesPerPixel(pixelType), seed, buffer);
+    }
+}
+
+void fillSamples(cphd::SampleType sampleType,
+                 size_t numSamples,
+                 sys::Uint32_T seed,
+                 void* buffer)
+{
+    switch (sampleType)
+    {
+    case cphd::SampleType::RE32F_IM32F:
+        fillFloats(numSamples * 2, seed, buffer);
+        break;
+    case cphd::SampleType::RE16I_IM16I:
+        fillBytes(numSamples * 4, seed, buffer);
+        break;
+    case cphd::SampleType::RE08I_IM08I:
+        fillBytes(numSamples * 2, seed, buffer);
+        break;
+    default:
+        throw except::Exception(Ctxt("Unsupported sample type"));
+    }
+}
+
+std::auto_ptr<six::sicd::ComplexData>
+createComplexData(const types::RowCol<size_t>& dims,
+                  six::PixelType pixelType)
+{
+    std::auto_ptr<six::sicd::ComplexData> data =
+            six::sicd::Utilities::createFakeComplexData();
+    data->setNumRows(dims.row);
+    data->setNumCols(dims.col);
+    data->setPixelType(pixelType);
+    return data;
+}
+
+std::auto_ptr<six::sidd::DerivedData>
+createDerivedData(const types::RowCol<size_t>& dims,
+                  six::PixelType pixelType)
+{
+    std::auto_ptr<six::sidd::DerivedData> data =
+            six::sidd::Utilities::createFakeDerivedData();
+    data->setNumRows(dims.row);
+    data->setNumCols(dims.col);
+    data->setPixelType(pixelType);
+    return data;
+}
+
+void writeSICD(const std::string& pathname,
+               const six::sicd::ComplexData& data,
+               size_t maxRowsPerSegment,
+               sys::Uint32_T seed)
+{
+    const size_t numPixels = data.getNumRows() * data.getNumCols();
+    std::vector<six::UByte> image(numPixels * data.getNumBytesPerPixel());
+    fillPixels(data.getPixelType(), numPixels, seed, &image[0]);
+
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::COMPLEX));
+    container->addData(data.clone());
+
+    save(container, six::BufferList(1, &image[0]), maxRowsPerSegment,
+         pathname);
+}
+
+void writeSIDD(const std::string& pathname,
+               const six::sidd::DerivedData& data,
+               size_t numImages,
+               size_t maxRowsPerSegment,
+               sys::Uint32_T seed)
+{
+    const size_t numPixels = data.getNumRows() * data.getNumCols();
+
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::DERIVED));
+    std::vector<std::vector<six::UByte> > images(numImages);
+    six::BufferList buffers(numImages);
+    for (size_t ii = 0; ii < numImages; ++ii)
+    {
+        images[ii].resize(numPixels * data.getNumBytesPerPixel());
+        fillPixels(data.getPixelType(), numPixels,
+                   seed + static_cast<sys::Uint32_T>(ii), &images[ii][0]);
+        buffers[ii] = &images[ii][0];
+        container->addData(data.clone());
+    }
+
+    save(container, buffers, maxRowsPerSegment, pathname);
+}
+
+cphd::Metadata createCPHDMetadata(size_t numChannels,
+                                  const types::RowCol<size_t>& dims,
+                                  cphd::SampleType sampleType)
+{
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = numChannels;
+    metadata.data.sampleType = sampleType;
+    for (size_t ii = 0; ii < numChannels; ++ii)
+    {
+        metadata.data.arraySize.push_back(
+                cphd::ArraySize(dims.row, dims.col));
+        metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    }
+
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+
+    metadata.data.numBytesVBP = createVBM(metadata).getNumBytesVBP();
+    return metadata;
+}
+
+cphd::VBM createVBM(const cphd::Metadata& metadata)
+{
+    std::vector<size_t> numVectors(metadata.getNumChannels());
+    for (size_t ii = 0; ii < numVectors.size(); ++ii)
+    {
+        numVectors[ii] = metadata.getNumVectors(ii);
+    }
+    return cphd::VBM(numVectors.size(), numVectors, false, false, false,
+                     metadata.global.domainType);
+}
+
+void writeCPHD(const std::string& pathname,
+               const cphd::Metadata& metadata,
+               size_t numThreads,
+               sys::Uint32_T seed)
+{
+    switch (metadata.getSampleType())
+    {
+    case cphd::SampleType::RE32F_IM32F:
+        writeCPHDImpl<std::complex<float> >(pathname, metadata, numThreads,
+                                            seed);
+        break;
+    case cphd::SampleType::RE16I_IM16I:
+        writeCPHDImpl<std::complex<sys::Int16_T> >(pathname, metadata,
+                                                   numThreads, seed);
+        break;
+    case cphd::SampleType::RE08I_IM08I:
+        writeCPHDImpl<std::complex<sys::Int8_T> >(pathname, metadata,
+                                                  numThreads, seed);
+        break;
+    default:
+        throw except::Exception(Ctxt("Unsupported sample type"));
+    }
+}
+
+std::auto_ptr<scene::ProjectionModel> createProjectionModel()
+{
+    const scene::Vector3 scp = scene::Utilities::latLonToECEF(
+            scene::LatLonAlt(34.0, -112.0, 100.0));
+
+    scene::Vector3 up(scp);
+    up.normalize();
+    scene::Vector3 zAxis(0.0);
+    zAxis[2] = 1.0;
+    scene::Vector3 east = math::linear::cross(zAxis, up);
+    east.normalize();
+    const scene::Vector3 north = math::linear::cross(up, east);
+
+    const scene::Vector3 arp = scp + up * 7000.0 - north * 12000.0;
+    const scene::Vector3 vel = east * 160.0;
+
+    math::poly::OneD<scene::Vector3> arpPoly(2);
+    arpPoly[0] = arp;
+    arpPoly[1] = vel;
+    arpPoly[2] = (north * 0.4 - up * 0.2) * 0.5;
+
+    const scene::SceneGeometry geometry(vel, arp, scp);
+    const scene::Vector3 slantNormal = geometry.getSlantPlaneZ();
+    scene::Vector3 rowVector = scp - arp;
+    const double range = rowVector.norm();
+    rowVector.normalize();
+    scene::Vector3 colVector = math::linear::cross(slantNormal, rowVector);
+    if (colVector.dot(vel) < 0.0)
+    {
+        colVector = colVector * -1.0;
+    }
+
+    // Spotlight collections have a constant COA time
+    const math::poly::TwoD<double> timeCOAPoly(0, 0);
+
+    math::poly::OneD<double> polarAnglePoly(1);
+    polarAnglePoly[1] = -vel.norm() / range;
+    math::poly::OneD<double> ksfPoly(0);
+    ksfPoly[0] = 1.0;
+
+    return std::auto_ptr<scene::ProjectionModel>(
+            new scene::RangeAzimProjectionModel(
+                    polarAnglePoly, ksfPoly, slantNormal, rowVector, colVector,
+                    scp, arpPoly, timeCOAPoly, geometry.getSideOfTrack()));
+}
+}
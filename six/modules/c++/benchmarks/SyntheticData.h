@@ -0,0 +1,138 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_BENCHMARK_SYNTHETIC_DATA_H__
+#define __SIX_BENCHMARK_SYNTHETIC_DATA_H__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <types/RowCol.h>
+#include <scene/ProjectionModel.h>
+#include <cphd/Metadata.h>
+#include <cphd/VBM.h>
+#include <six/Enums.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sidd/DerivedData.h>
+
+/*!
+ * Generators for the products the benchmarks read and write.  Everything is
+ * built from the fake metadata in six.sicd and six.sidd plus a pseudorandom
+ * pattern seeded by the caller, so the same sizes and seed always give the
+ * same bytes and no test data is needed.
+ */
+namespace benchmark
+{
+/*!
+ * Fills a buffer with pseudorandom pixels.  Floating point pixel types get
+ * finite values in [-1000, 1000); everything else gets random bytes.
+ *
+ * \param pixelType Pixel type to generate
+ * \param numPixels Number of pixels to generate
+ * \param seed Seed for the pattern
+ * \param buffer Output buffer, numPixels * bytes per pixel in size
+ */
+void fillPixels(six::PixelType pixelType,
+                size_t numPixels,
+                sys::Uint32_T seed,
+                void* buffer);
+
+//! Same as above for CPHD samples
+void fillSamples(cphd::SampleType sampleType,
+                 size_t numSamples,
+                 sys::Uint32_T seed,
+                 void* buffer);
+
+//! \return Fake SICD metadata for an image of the given size and type
+std::auto_ptr<six::sicd::ComplexData>
+createComplexData(const types::RowCol<size_t>& dims,
+                  six::PixelType pixelType);
+
+//! \return Fake SIDD metadata for an image of the given size and type
+std::auto_ptr<six::sidd::DerivedData>
+createDerivedData(const types::RowCol<size_t>& dims,
+                  six::PixelType pixelType);
+
+/*!
+ * Writes a SICD with NITFWriteControl
+ *
+ * \param pathname Output pathname
+ * \param data SICD metadata
+ * \param maxRowsPerSegment Image segments are split to hold at most this
+ * many rows, so small values give multi-segment files
+ * \param seed Seed for the pixels
+ */
+void writeSICD(const std::string& pathname,
+               const six::sicd::ComplexData& data,
+               size_t maxRowsPerSegment,
+               sys::Uint32_T seed);
+
+/*!
+ * Writes a SIDD holding several products with the same metadata
+ *
+ * \param pathname Output pathname
+ * \param data Metadata shared by every product
+ * \param numImages Number of products
+ * \param maxRowsPerSegment As for writeSICD()
+ * \param seed Seed for the pixels.  Each product gets different ones.
+ */
+void writeSIDD(const std::string& pathname,
+               const six::sidd::DerivedData& data,
+               size_t numImages,
+               size_t maxRowsPerSegment,
+               sys::Uint32_T seed);
+
+/*!
+ * \return The smallest CPHD metadata CPHDWriter and CPHDReader accept for
+ * numChannels FX domain channels of the given size
+ */
+cphd::Metadata createCPHDMetadata(size_t numChannels,
+                                  const types::RowCol<size_t>& dims,
+                                  cphd::SampleType sampleType);
+
+//! \return A VBM for 'metadata', with all values zeroed
+cphd::VBM createVBM(const cphd::Metadata& metadata);
+
+/*!
+ * Writes a CPHD
+ *
+ * \param pathname Output pathname
+ * \param metadata From createCPHDMetadata()
+ * \param numThreads Number of threads the writer uses
+ * \param seed Seed for the samples.  Each channel gets different ones.
+ */
+void writeCPHD(const std::string& pathname,
+               const cphd::Metadata& metadata,
+               size_t numThreads,
+               sys::Uint32_T seed);
+
+/*!
+ * The fake SICD metadata doesn't describe a real collection, so projections
+ * are timed against this model of a spotlight collection instead
+ *
+ * \return A range/azimuth (PFA) model looking at a scene at 34N, 112W
+ */
+std::auto_ptr<scene::ProjectionModel> createProjectionModel();
+}
+
+#endif
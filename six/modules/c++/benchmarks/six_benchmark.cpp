@@ -0,0 +1,306 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times the common read, write, parse and projection paths against
+// synthetic SICDs, SIDDs and CPHDs, so releases can be compared without any
+// test data.  The inputs are generated into --dir first, so reads mostly
+// come from the page cache.  Results go to stdout as a table and, with
+// --json, to a file for scripts to compare.
+
+#include <fstream>
+#include <iostream>
+#include <map>
+
+#include <import/cli.h>
+#include <import/str.h>
+#include <io/TempFile.h>
+#include <sys/OS.h>
+#include <sys/StopWatch.h>
+#include <tasks/TaskScheduler.h>
+
+#include "BenchmarkRunner.h"
+#include "Scenarios.h"
+#include "SyntheticData.h"
+
+namespace
+{
+bool isSelected(const std::string& name,
+                const std::vector<std::string>& filters)
+{
+    if (filters.empty())
+    {
+        return true;
+    }
+    for (size_t ii = 0; ii < filters.size(); ++ii)
+    {
+        if (name.find(filters[ii]) != std::string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Keeps the scenarios that match and notes which products they need
+benchmark::Scenarios select(const benchmark::Scenarios& scenarios,
+                            const std::vector<std::string>& filters,
+                            std::map<std::string, bool>& neededProducts)
+{
+    benchmark::Scenarios selected;
+    for (size_t ii = 0; ii < scenarios.size(); ++ii)
+    {
+        const std::string& name = scenarios[ii]->getName();
+        if (isSelected(name, filters))
+        {
+            selected.push_back(scenarios[ii]);
+            neededProducts[name.substr(0, name.find('.'))] = true;
+        }
+    }
+    return selected;
+}
+
+template <typename T>
+void addConfig(const std::string& name,
+               const T& value,
+               std::map<std::string, std::string>& config)
+{
+    config[name] = str::toString(value);
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        cli::ArgumentParser parser;
+        parser.setDescription("Times reading, writing, parsing and "
+                              "projecting synthetic SICD, SIDD and CPHD "
+                              "products.");
+        parser.addArgument("--rows", "SICD and SIDD rows", cli::STORE,
+                           "rows", "ROWS")->setDefault(2048);
+        parser.addArgument("--cols", "SICD and SIDD columns", cli::STORE,
+                           "cols", "COLS")->setDefault(2048);
+        parser.addArgument("--pixel-type", "SICD pixel type", cli::STORE,
+                           "pixelType", "TYPE")->setChoices(
+                           str::split("RE32F_IM32F RE16I_IM16I"))
+                           ->setDefault("RE32F_IM32F");
+        parser.addArgument("--sidd-pixel-type", "SIDD pixel type",
+                           cli::STORE, "siddPixelType", "TYPE")->setChoices(
+                           str::split("MONO8I MONO16I RGB24I"))->setDefault(
+                           "MONO8I");
+        parser.addArgument("--sidd-images", "Number of products in the SIDD",
+                           cli::STORE, "siddImages", "NUM")->setDefault(3);
+        parser.addArgument("--segment-rows",
+                           "Max rows per NITF image segment",
+                           cli::STORE, "segmentRows", "ROWS")->setDefault(
+                           1024);
+        parser.addArgument("--band-rows", "Rows per band for streaming writes",
+                           cli::STORE, "bandRows", "ROWS")->setDefault(256);
+        parser.addArgument("--channels", "Number of CPHD channels",
+                           cli::STORE, "channels", "NUM")->setDefault(2);
+        parser.addArgument("--vectors", "CPHD vectors per channel",
+                           cli::STORE, "vectors", "NUM")->setDefault(2048);
+        parser.addArgument("--samples", "CPHD samples per vector",
+                           cli::STORE, "samples", "NUM")->setDefault(2048);
+        parser.addArgument("--sample-type", "CPHD sample type", cli::STORE,
+                           "sampleType", "TYPE")->setChoices(
+                           str::split("RE32F_IM32F RE16I_IM16I RE08I_IM08I"))
+                           ->setDefault("RE16I_IM16I");
+        parser.addArgument("--points", "Points per projection batch",
+                           cli::STORE, "points", "NUM")->setDefault(10000);
+        parser.addArgument("-t --threads",
+                           "Number of threads to use (default: one per core)",
+                           cli::STORE, "threads", "NUM")->setDefault(0);
+        parser.addArgument("-n --iterations", "Timed runs per scenario",
+                           cli::STORE, "iterations", "NUM")->setDefault(5);
+        parser.addArgument("--warmups", "Untimed runs per scenario",
+                           cli::STORE, "warmups", "NUM")->setDefault(1);
+        parser.addArgument("--seed", "Seed for the synthetic pixels",
+                           cli::STORE, "seed", "SEED")->setDefault(12345);
+        parser.addArgument("-f --filter",
+                           "Only run scenarios whose names contain one of "
+                           "these (e.g. sicd.read or .parse)",
+                           cli::STORE, "filter", "NAME", 0);
+        parser.addArgument("-d --dir", "Directory for the synthetic files",
+                           cli::STORE, "dir", "DIR")->setDefault(".");
+        parser.addArgument("--json", "Write the results as JSON to FILE",
+                           cli::STORE, "json", "FILE");
+        parser.addArgument("-l --list", "List the scenarios and exit",
+                           cli::STORE_TRUE, "list");
+
+        const std::auto_ptr<cli::Results> options(parser.parse(argc, argv));
+
+        const types::RowCol<size_t> dims(options->get<size_t>("rows"),
+                                         options->get<size_t>("cols"));
+        const six::PixelType pixelType(
+                options->get<std::string>("pixelType"));
+        const six::PixelType siddPixelType(
+                options->get<std::string>("siddPixelType"));
+        const size_t numSIDDImages(options->get<size_t>("siddImages"));
+        const size_t numChannels(options->get<size_t>("channels"));
+        const types::RowCol<size_t> cphdDims(
+                options->get<size_t>("vectors"),
+                options->get<size_t>("samples"));
+        const cphd::SampleType sampleType(
+                options->get<std::string>("sampleType"));
+        const size_t numIterations(options->get<size_t>("iterations"));
+        const size_t numWarmups(options->get<size_t>("warmups"));
+
+        benchmark::Settings settings;
+        settings.outputDir = options->get<std::string>("dir");
+        settings.numThreads = options->get<size_t>("threads");
+        settings.numRowsPerBand =
+                std::max<size_t>(options->get<size_t>("bandRows"), 1);
+        settings.maxRowsPerSegment = options->get<size_t>("segmentRows");
+        settings.numPoints = options->get<size_t>("points");
+        settings.seed = options->get<sys::Uint32_T>("seed");
+
+        std::vector<std::string> filters;
+        if (options->hasValue("filter"))
+        {
+            const cli::Value* const value = options->getValue("filter");
+            for (size_t ii = 0; ii < value->size(); ++ii)
+            {
+                filters.push_back(value->get<std::string>(ii));
+            }
+        }
+
+        const std::auto_ptr<six::sicd::ComplexData> complexData =
+                benchmark::createComplexData(dims, pixelType);
+        const std::auto_ptr<six::sidd::DerivedData> derivedData =
+                benchmark::createDerivedData(dims, siddPixelType);
+        const cphd::Metadata cphdMetadata = benchmark::createCPHDMetadata(
+                numChannels, cphdDims, sampleType);
+
+        const io::TempFile sicdFile(settings.outputDir);
+        const io::TempFile siddFile(settings.outputDir);
+        const io::TempFile cphdFile(settings.outputDir);
+
+        benchmark::Scenarios allScenarios;
+        benchmark::addSICDScenarios(sicdFile.pathname(), *complexData,
+                                    settings, allScenarios);
+        benchmark::addSIDDScenarios(siddFile.pathname(), *derivedData,
+                                    numSIDDImages, settings, allScenarios);
+        benchmark::addCPHDScenarios(cphdFile.pathname(), cphdMetadata,
+                                    settings, allScenarios);
+        benchmark::addProjectionScenarios(settings, allScenarios);
+
+        std::map<std::string, bool> neededProducts;
+        const benchmark::Scenarios scenarios =
+                select(allScenarios, filters, neededProducts);
+
+        if (options->get<bool>("list"))
+        {
+            for (size_t ii = 0; ii < scenarios.size(); ++ii)
+            {
+                std::cout << scenarios[ii]->getName() << "\n";
+            }
+            return 0;
+        }
+
+        // Only generate what the selected scenarios read
+        sys::RealTimeStopWatch generateWatch;
+        generateWatch.start();
+        if (neededProducts["sicd"])
+        {
+            benchmark::writeSICD(sicdFile.pathname(), *complexData,
+                                 settings.maxRowsPerSegment, settings.seed);
+        }
+        if (neededProducts["sidd"])
+        {
+            benchmark::writeSIDD(siddFile.pathname(), *derivedData,
+                                 numSIDDImages, settings.maxRowsPerSegment,
+                                 settings.seed);
+        }
+        if (neededProducts["cphd"])
+        {
+            benchmark::writeCPHD(cphdFile.pathname(), cphdMetadata,
+                                 settings.numThreads, settings.seed);
+        }
+        std::cout << "Generated inputs in " << generateWatch.stop()
+                  << " ms\n\n";
+
+        benchmark::Runner runner(numIterations, numWarmups, &std::cout);
+        for (size_t ii = 0; ii < scenarios.size(); ++ii)
+        {
+            runner.run(*scenarios[ii]);
+        }
+
+        if (options->hasValue("json"))
+        {
+            const sys::OS os;
+            std::map<std::string, std::string> config;
+            addConfig("platform", os.getPlatformName(), config);
+            addConfig("numCPUs", os.getNumCPUs(), config);
+            addConfig("numSchedulerThreads",
+                      tasks::SharedTaskScheduler::getInstance().getNumThreads(),
+                      config);
+#ifdef SIX_DISABLE_INSTRUMENTATION
+            addConfig("instrumentation", "disabled", config);
+#else
+            addConfig("instrumentation", "enabled", config);
+#endif
+            addConfig("rows", dims.row, config);
+            addConfig("cols", dims.col, config);
+            addConfig("pixelType", pixelType.toString(), config);
+            addConfig("siddPixelType", siddPixelType.toString(), config);
+            addConfig("siddImages", numSIDDImages, config);
+            addConfig("segmentRows", settings.maxRowsPerSegment, config);
+            addConfig("bandRows", settings.numRowsPerBand, config);
+            addConfig("channels", numChannels, config);
+            addConfig("vectors", cphdDims.row, config);
+            addConfig("samples", cphdDims.col, config);
+            addConfig("sampleType", sampleType.toString(), config);
+            addConfig("points", settings.numPoints, config);
+            addConfig("threads", settings.numThreads, config);
+            addConfig("iterations", numIterations, config);
+            addConfig("warmups", numWarmups, config);
+            addConfig("seed", settings.seed, config);
+
+            const std::string pathname = options->get<std::string>("json");
+            std::ofstream json(pathname.c_str());
+            runner.writeJSON(config, json);
+            json.close();
+            if (json.fail())
+            {
+                throw except::Exception(Ctxt("Couldn't write " + pathname));
+            }
+        }
+
+        return runner.hasErrors() ? 1 : 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+        return 1;
+    }
+}
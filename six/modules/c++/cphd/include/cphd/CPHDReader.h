@@ -23,7 +23,9 @@
 #ifndef __CPHD_CPHD_READER_H__
 #define __CPHD_CPHD_READER_H__
 
+#include <complex>
 #include <memory>
+#include <vector>
 
 #include <sys/Conf.h>
 #include <cphd/Metadata.h>
@@ -123,7 +125,48 @@ public:
         return *mWideband;
     }
 
+    /*
+     * Reads every sample of every channel, reading the channels in
+     * parallel.  The numThreads threads are split among the channels, so
+     * channels read from a pathname are truly read at the same time (see
+     * Wideband).  Performs endian swapping if necessary.
+     *
+     * \param numThreads Number of threads to use
+     * \param data One buffer per channel, each at least
+     * getNumVectors(channel) * getNumSamples(channel) *
+     * getNumBytesPerSample() bytes
+     */
+    void readChannels(size_t numThreads,
+                      const std::vector<mem::BufferView<sys::ubyte> >& data);
+
+    /*
+     * Same as above but promotes the samples to complex<float>, applying
+     * each vector's AmpSF if the VBM has them
+     *
+     * \param numThreads Number of threads to use
+     * \param data One buffer per channel, each at least
+     * getNumVectors(channel) * getNumSamples(channel) samples
+     */
+    void readChannels(
+            size_t numThreads,
+            const std::vector<mem::BufferView<std::complex<float> > >& data);
+
+    // Pathname the reader was opened from, or empty if it was given a stream
+    const std::string& getPathname() const
+    {
+        return mPathname;
+    }
+
 private:
+    template <typename T>
+    class ChannelReader;
+
+    template <typename T>
+    void readChannelsImpl(size_t numThreads,
+                          const std::vector<mem::BufferView<T> >& data);
+
+    std::string mPathname;
+
     // Keep info about the CPHD collection
     FileHeader mFileHeader;
     std::auto_ptr<Metadata> mMetadata;
@@ -28,7 +28,9 @@
 
 #include <sys/Conf.h>
 #include <mem/SharedPtr.h>
+#include <cphd/FileHeader.h>
 #include <cphd/Metadata.h>
+#include <cphd/Quantization.h>
 #include <types/RowCol.h>
 #include <io/OutputStream.h>
 #include <cphd/VBM.h>
@@ -59,7 +61,9 @@ public:
      *  \param numThreads The number of threads to use for processing.
      *  \param scratchSpaceSize The maximum size of internal scratch space
      *         that may be used if byte swapping is necessary.
-     *         Default is 4 MB
+     *         Default is 4 MB.  When writing to a stream, this is split in
+     *         two so one half can be swapped while the other is written.
+     *         When writing a file from addImage, each thread gets this much.
      */
     CPHDWriter(const Metadata& metadata,
                size_t numThreads = 0,
@@ -84,6 +88,31 @@ public:
                   const types::RowCol<size_t>& dims,
                   const sys::ubyte* vbmData);
 
+    /*
+     *  \func addQuantizedImage
+     *  \brief Like addImage, but takes complex<float> samples and quantizes
+     *         them to the writer's sample type, which must be RE08I_IM08I
+     *         or RE16I_IM16I.  Each vector gets its own scale factor (see
+     *         cphd::quantize()), which is recorded as its AmpSF, so the
+     *         file is a half or a quarter the size it would be as floats
+     *         and Wideband::read() with the AmpSF gets the floats back.
+     *         Unlike addImage, the writer keeps its own copy of the
+     *         quantized samples and the VBM.
+     *
+     *  \param image The image to be added. This should be sized to match the
+     *         dims parameter.
+     *  \param dims The dimensions of the image.
+     *  \param vbm The vector based metadata for all of the channels. It must
+     *         have AmpSF enabled. The AmpSF of this image's channel (the
+     *         number of images added before it) are overwritten.
+     *
+     *  \return The quantization error
+     */
+    QuantizationStatistics addQuantizedImage(
+            const std::complex<float>* image,
+            const types::RowCol<size_t>& dims,
+            VBM& vbm);
+
     /*
      *  \func writeMetadata
      *  \brief Writes the header, metadata, and VBM into the file. This should
@@ -147,6 +176,13 @@ public:
      *  \brief Writes the CPHD file to disk. This should only be called
      *         if you are writing using addImage.
      *
+     *         Since every channel is available up front, the offsets of
+     *         each VBM and wideband region are known once the header is
+     *         built.  Where positional writes are available, the regions
+     *         are split into chunks that numThreads threads byte swap and
+     *         write in parallel, so one thread's swapping overlaps
+     *         another's I/O.
+     *
      *  \param pathname The desired pathname of the file.
      *  \param classification The classification of the file. Optional
      *         By default, CPHD will not be populated with this value.
@@ -181,6 +217,38 @@ public:
     }
 
 private:
+    struct Chunk
+    {
+        const sys::ubyte* data;
+        size_t numBytes;
+        size_t elementSize;
+        sys::Off_T offset;
+    };
+
+    class ChunkWriter;
+
+    void addImageImpl(const sys::ubyte* image,
+                      const types::RowCol<size_t>& dims,
+                      const sys::ubyte* vbmData);
+
+    // Everything in front of the VBM: header, XML, and pad bytes
+    std::string getPreamble(size_t vbmSize,
+                            size_t cphdSize,
+                            const std::string& classification,
+                            const std::string& releaseInfo,
+                            FileHeader& header) const;
+
+    void writePositional(const std::string& pathname,
+                         const std::string& classification,
+                         const std::string& releaseInfo);
+
+    // Splits a region into chunks no bigger than the scratch space
+    void addChunks(const sys::ubyte* data,
+                   size_t numBytes,
+                   size_t elementSize,
+                   sys::Off_T offset,
+                   std::vector<Chunk>& chunks) const;
+
     void writeMetadata(size_t vbmSize,
                        size_t cphdSize,
                        const std::string& classification = "",
@@ -221,6 +289,9 @@ private:
                                 size_t elementSize);
 
     private:
+        class SwapRunnable;
+
+        // Each half of the scratch space
         const size_t mScratchSize;
         const mem::ScopedArray<sys::byte> mScratch;
     };
@@ -248,6 +319,9 @@ private:
     std::vector<const sys::ubyte*> mCPHDData;
     std::vector<const sys::ubyte*> mVBMData;
 
+    // Buffers made by addQuantizedImage
+    std::vector<mem::SharedPtr<std::vector<sys::ubyte> > > mOwnedData;
+
     size_t mCPHDSize;
     size_t mVBMSize;
 };
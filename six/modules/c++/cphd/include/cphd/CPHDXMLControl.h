@@ -32,6 +32,7 @@
 #include <xml/lite/Document.h>
 #include <six/XMLParser.h>
 #include <six/SICommonXMLParser10x.h>
+#include <six/XMLStreamWriter.h>
 #include <cphd/Metadata.h>
 
 namespace cphd
@@ -62,7 +63,13 @@ public:
 
     std::auto_ptr<Metadata> fromXML(const std::string& xmlString);
 
+    /*!
+     *  Writes the XML straight to a string, without building a DOM.  The
+     *  result is identical to printing the document from toXML().
+     */
     std::string toXMLString(const Metadata& metadata);
+
+    //! \return toXMLString(metadata).size(), without building the string
     size_t getXMLsize(const Metadata& metadata);
 
 private:
@@ -104,6 +111,32 @@ private:
             const AreaDirectionParameters& obj,
             XMLElem parent = NULL);
 
+    // Streaming write functions.  These emit the same XML as the toXML()
+    // functions above.
+    void write(const Metadata& metadata, six::XMLStreamWriter& writer) const;
+    void write(const CollectionInformation& obj,
+               six::XMLStreamWriter& writer) const;
+    void write(const Data& obj, six::XMLStreamWriter& writer) const;
+    void write(const Global& obj, six::XMLStreamWriter& writer) const;
+    void write(const Channel& obj, six::XMLStreamWriter& writer) const;
+    void write(const SRP& obj, six::XMLStreamWriter& writer) const;
+    void write(const Antenna& obj, six::XMLStreamWriter& writer) const;
+    void write(const std::string& name, size_t index,
+               const AntennaParameters& ap,
+               six::XMLStreamWriter& writer) const;
+    void write(const VectorParameters& obj,
+               six::XMLStreamWriter& writer) const;
+    void writeLatLonAltFootprint(const std::string& name,
+                                 const std::string& cornerName,
+                                 const LatLonAltCorners& corners,
+                                 six::XMLStreamWriter& writer) const;
+    void writeAreaDirectionParameters(const std::string& name,
+                                      const std::string& spacingName,
+                                      const std::string& numName,
+                                      const std::string& firstName,
+                                      const AreaDirectionParameters& obj,
+                                      six::XMLStreamWriter& writer) const;
+
     // Read functions
     void fromXML(const XMLElem dataXML, Data& obj);
     void fromXML(const XMLElem globalXML, Global& obj);
@@ -0,0 +1,92 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_FFT_H__
+#define __CPHD_FFT_H__
+
+#include <complex>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <types/RowCol.h>
+
+namespace cphd
+{
+/*!
+ * \class FFT
+ * \brief In-place radix-2 FFT of complex<float> data.  The twiddle factors
+ * and bit reversal table are built once in the constructor, so one FFT can
+ * transform any number of vectors (from any number of threads) of its size.
+ * Nothing is normalized in either direction.
+ */
+class FFT
+{
+public:
+    /*!
+     * \param size Number of samples.  Must be a power of 2.
+     * \param sign Sign of the exponent, +1 or -1
+     */
+    FFT(size_t size, int sign);
+
+    size_t getSize() const
+    {
+        return mSize;
+    }
+
+    int getSign() const
+    {
+        return mSign;
+    }
+
+    //! Transform 'size' contiguous samples in place
+    void transform(std::complex<float>* data) const;
+
+    //! \return The smallest power of 2 that's at least 'size'
+    static size_t nextPowerOfTwo(size_t size);
+
+private:
+    const size_t mSize;
+    const int mSign;
+    std::vector<size_t> mBitReversed;
+
+    // For each stage, half the stage's length twiddles, one stage after
+    // another
+    std::vector<std::complex<float> > mTwiddles;
+};
+
+/*!
+ * Transform a row-major image in place along both dimensions, rows first.
+ * Rows are transformed in parallel, then columns in parallel, a few at a time
+ * so each pass over the image reads whole cache lines.
+ *
+ * \param data dims.row x dims.col samples.  Both must be powers of 2.
+ * \param dims Dimensions of 'data'
+ * \param sign Sign of the exponent, +1 or -1
+ * \param numThreads Number of threads to use.  If 0, uses the number of CPUs.
+ */
+void fft2D(std::complex<float>* data,
+           const types::RowCol<size_t>& dims,
+           int sign,
+           size_t numThreads);
+}
+
+#endif
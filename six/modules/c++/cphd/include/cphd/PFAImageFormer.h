@@ -0,0 +1,187 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_PFA_IMAGE_FORMER_H__
+#define __CPHD_PFA_IMAGE_FORMER_H__
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <types/RowCol.h>
+#include <six/sicd/ComplexData.h>
+#include <cphd/CPHDReader.h>
+
+namespace cphd
+{
+/*!
+ * \class PFAImageFormer
+ * \brief Reference polar format algorithm (PFA) image formation from an FX
+ * domain CPHD channel to a slant plane SICD.
+ *
+ * The image plane holds the line of sight and the velocity at the center
+ * vector, and is centered on that vector's SRP, which becomes the SCP.
+ * Each vector's samples lie along a line through the origin of the plane's
+ * spatial frequency (Krg, Kaz) domain.  form() resamples them onto the
+ * largest rectangle inside the polar annulus, in two separable passes of an
+ * 8-tap windowed sinc interpolator:
+ *
+ *  1. Range.  Pulse blocks are streamed from the file with a
+ *     PulseBlockReader and each vector is resampled to the output Krg
+ *     samples.  The results are stored transposed, in tiles, so the
+ *     azimuth pass reads contiguous memory.
+ *  2. Azimuth.  For each Krg sample, the vectors are resampled to the output
+ *     Kaz samples.
+ *
+ * The rectangle is then zero padded to powers of 2 and turned into the image
+ * with a 2D FFT.  Both passes and the FFT run on numThreads threads.
+ *
+ * This is a reference: the planar wavefront approximation isn't corrected
+ * for, no aperture weighting is applied, and the vectors are assumed to be
+ * in order of polar angle.
+ *
+ * \code
+    cphd::CPHDReader reader(cphdPathname, numThreads);
+    cphd::PFAImageFormer former(reader, 0, numThreads);
+    former.form();
+
+    std::auto_ptr<six::sicd::ComplexData> data = ...; // Collection info, etc.
+    former.populateComplexData(*data);
+    former.write(*data, schemaPaths, "out.nitf");
+ * \endcode
+ */
+class PFAImageFormer
+{
+public:
+    /*!
+     * Works out the geometry and the output grid.  No wideband is read.
+     *
+     * \param reader Reader for an FX domain CPHD whose VBM has the transmit
+     * and receive times and positions and the SRP positions.  Must outlive
+     * this object.
+     * \param channel The channel to form
+     * \param numThreads The number of threads to use.  If 0, uses the number
+     * of CPUs.
+     * \param numVectorsPerBlock The number of vectors read at a time
+     */
+    PFAImageFormer(CPHDReader& reader,
+                   size_t channel = 0,
+                   size_t numThreads = 0,
+                   size_t numVectorsPerBlock = 256);
+
+    //! \return The dimensions of the image form() makes
+    const types::RowCol<size_t>& getDims() const
+    {
+        return mDims;
+    }
+
+    //! \return The dimensions of the rectangle resampled out of k-space
+    const types::RowCol<size_t>& getNumKSamples() const
+    {
+        return mNumKSamples;
+    }
+
+    //! Read the channel and form the image
+    void form();
+
+    //! \return The image, getDims() pixels.  form() must have been called.
+    const std::complex<float>* getImage() const;
+
+    /*!
+     * Fill in the parts of 'data' that describe the image: ImageData (as
+     * RE32F_IM32F), the SCP, Grid, PFA, ImageFormation, the ARP polynomial,
+     * and the transmit frequencies in RadarCollection.  The SCPCOA and image
+     * corners are then derived from those.  Collection information, etc. are
+     * left to the caller.
+     *
+     * \param[in,out] data Complex data to update
+     */
+    void populateComplexData(six::sicd::ComplexData& data) const;
+
+    /*!
+     * Write the image as a SICD NITF, in row bands on numThreads threads.
+     * form() must have been called.
+     *
+     * \param data Complex data for the image, typically updated via
+     * populateComplexData()
+     * \param schemaPaths Directories or files of schema locations
+     * \param pathname The output pathname
+     * \param numRowsPerBand The number of rows written at a time
+     */
+    void write(const six::sicd::ComplexData& data,
+               const std::vector<std::string>& schemaPaths,
+               const std::string& pathname,
+               size_t numRowsPerBand = 256) const;
+
+private:
+    // Per-vector geometry
+    struct VectorGeometry
+    {
+        double time;
+        Vector3 arpPos;
+
+        // Krg and Kaz per Hz
+        double krgPerHz;
+        double kazPerHz;
+
+        double fx0;
+        double fxSS;
+    };
+
+    class RangeInterpolator;
+    class AzimuthInterpolator;
+
+    void computeGeometry();
+    void computeGrid();
+
+    double getPolarAngle(size_t vector) const;
+
+private:
+    CPHDReader& mReader;
+    const size_t mChannel;
+    const size_t mNumThreads;
+    const size_t mNumVectorsPerBlock;
+    const size_t mNumVectors;
+    const size_t mNumSamples;
+    const int mPhaseSign;
+
+    Vector3 mSCP;
+    Vector3 mRowUnitVector;
+    Vector3 mColUnitVector;
+    Vector3 mImagePlaneNormal;
+    size_t mRefVector;
+    std::vector<VectorGeometry> mVectors;
+
+    // Output k-space rectangle
+    double mKrg1;
+    double mKrg2;
+    double mKaz1;
+    double mKaz2;
+    types::RowCol<size_t> mNumKSamples;
+    types::RowCol<size_t> mDims;
+
+    std::vector<std::complex<float> > mImage;
+};
+}
+
+#endif
@@ -0,0 +1,173 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_PULSE_BLOCK_READER_H__
+#define __CPHD_PULSE_BLOCK_READER_H__
+
+#include <complex>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <sys/ConditionVar.h>
+#include <sys/Mutex.h>
+#include <except/Exception.h>
+#include <mt/ThreadGroup.h>
+#include <cphd/CPHDReader.h>
+
+namespace cphd
+{
+/*!
+ * \class PulseBlockReader
+ * \brief Iterates over a channel's wideband in blocks of vectors, reading
+ * ahead on a background thread
+ *
+ * While the caller works on one block, a producer thread reads the next
+ * numBlocksAhead blocks and byte swaps, scales (by AmpSF, if the VBM has it),
+ * and converts them to complex<float>.  Blocks are read into a fixed pool of
+ * buffers that get recycled, so nothing is allocated after construction.
+ * When the CPHD was opened from a file (and the platform has posix_fadvise),
+ * the OS is also told which block is coming next so it can start paging it
+ * in while the current one is being converted.
+ *
+ * The producer reads through the CPHDReader's Wideband, so the Wideband must
+ * not be used for anything else until this object is destroyed.
+ */
+class PulseBlockReader
+{
+public:
+    /*!
+     * \struct Block
+     * \brief One block of vectors
+     *
+     * The VBM entries for the block are vbm->get*(channel, firstVector + ii)
+     * for ii in [0, numVectors).
+     */
+    struct Block
+    {
+        Block();
+
+        size_t channel;
+        size_t firstVector;
+        size_t numVectors;
+        size_t numSamples;
+
+        //! The reader's VBM
+        const VBM* vbm;
+
+        /*!
+         * numVectors x numSamples converted samples.  This is only valid
+         * until the next call to next().
+         */
+        const std::complex<float>* data;
+    };
+
+    /*!
+     * Starts reading ahead
+     *
+     * \param reader Reader to read from.  Must outlive this object.
+     * \param channel 0-based channel to read
+     * \param numVectorsPerBlock Vectors per block.  The last block may be
+     * shorter.
+     * \param numBlocksAhead Number of blocks to read ahead of the one the
+     * caller has
+     * \param numThreads Number of threads to use for byte swapping and
+     * conversion
+     */
+    PulseBlockReader(CPHDReader& reader,
+                     size_t channel,
+                     size_t numVectorsPerBlock,
+                     size_t numBlocksAhead = 4,
+                     size_t numThreads = 1);
+
+    //! Stops reading ahead and joins the producer thread
+    ~PulseBlockReader();
+
+    //! \return The total number of blocks in the channel
+    size_t getNumBlocks() const
+    {
+        return mNumBlocks;
+    }
+
+    /*!
+     * Gets the next block, waiting for it to be read if necessary.  If the
+     * producer failed to read it, rethrows its exception.
+     *
+     * \param block Will contain the next block
+     *
+     * \return False once all blocks have been returned
+     */
+    bool next(Block& block);
+
+private:
+    struct Slot
+    {
+        Block block;
+        std::vector<std::complex<float> > data;
+        std::vector<sys::ubyte> scratch;
+        std::vector<double> scaleFactors;
+    };
+
+    class ProducerRunnable;
+
+    // Noncopyable
+    PulseBlockReader(const PulseBlockReader& );
+    const PulseBlockReader& operator=(const PulseBlockReader& );
+
+    void produce();
+
+    void readBlock(size_t blockNum, Slot& slot);
+
+    void adviseWillNeed(size_t blockNum);
+
+    void stop();
+
+    CPHDReader& mReader;
+    const size_t mChannel;
+    const size_t mNumVectors;
+    const size_t mNumSamples;
+    const size_t mNumVectorsPerBlock;
+    const size_t mNumBlocks;
+    const size_t mNumThreads;
+
+    // Descriptor used only for read ahead hints, or -1
+    int mAdviceFD;
+
+    std::vector<Slot> mSlots;
+    Slot* mCurrent;
+    size_t mNumReturned;
+
+    // Guards everything below
+    sys::Mutex mMutex;
+    sys::ConditionVar mStateChanged;
+    std::deque<Slot*> mFree;
+    std::deque<Slot*> mReady;
+    bool mStop;
+    bool mFailed;
+    except::Exception mException;
+
+    std::auto_ptr<mt::ThreadGroup> mThread;
+};
+}
+
+#endif
@@ -0,0 +1,96 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_QUANTIZATION_H__
+#define __CPHD_QUANTIZATION_H__
+
+#include <complex>
+
+#include <sys/Conf.h>
+#include <types/RowCol.h>
+
+namespace cphd
+{
+/*!
+ * \struct QuantizationStatistics
+ * \brief How much error quantizing introduced
+ */
+struct QuantizationStatistics
+{
+    QuantizationStatistics();
+
+    //! Merges in statistics for more samples
+    void add(const QuantizationStatistics& other);
+
+    //! \return Signal to quantization noise ratio in dB, or infinity if
+    //! there was no error
+    double getSQNR() const;
+
+    //! \return RMS error per complex sample
+    double getRMSError() const;
+
+    size_t numSamples;
+
+    //! Sum of |input|^2
+    double signalPower;
+
+    //! Sum of |input - output * scale|^2
+    double errorPower;
+
+    //! Largest error in any one component (real or imaginary)
+    double maxError;
+};
+
+/*
+ * Block floating point quantization: each vector (row) gets its own scale
+ * factor, chosen so the vector's largest real or imaginary component maps to
+ * the largest integer.  Reading the output back with the scale factors as
+ * AmpSF (see Wideband::read()) recovers the input to within half a scale
+ * factor per component.  Vectors of all zeros get a scale factor of 1.
+ * Input with NaN or infinite components is rejected with an exception.
+ *
+ * Rows are split across numThreads threads.
+ *
+ * \param input dims.row x dims.col samples
+ * \param dims Number of vectors and samples per vector
+ * \param numThreads Number of threads to use
+ * \param output dims.row x dims.col quantized samples
+ * \param scaleFactors dims.row scale factors
+ * \param stats Error statistics for all of the samples
+ */
+void quantize(const std::complex<float>* input,
+              const types::RowCol<size_t>& dims,
+              size_t numThreads,
+              std::complex<sys::Int8_T>* output,
+              double* scaleFactors,
+              QuantizationStatistics& stats);
+
+// Same as above but for 16-bit output
+void quantize(const std::complex<float>* input,
+              const types::RowCol<size_t>& dims,
+              size_t numThreads,
+              std::complex<sys::Int16_T>* output,
+              double* scaleFactors,
+              QuantizationStatistics& stats);
+}
+
+#endif
@@ -0,0 +1,149 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __CPHD_READ_PLANNER_H__
+#define __CPHD_READ_PLANNER_H__
+
+#include <vector>
+
+#include <sys/Conf.h>
+#include <sys/File.h>
+#include <io/SeekableStreams.h>
+
+namespace cphd
+{
+/*!
+ * \class ReadPlanner
+ * \brief Turns many small reads from a file into a few large ones
+ *
+ * Callers add fragments (a file offset, a length, and where the bytes go).
+ * The planner sorts them by offset and merges neighbors into spans as long
+ * as the gap between them is at most maxGapBytes.  The bytes in the gaps are
+ * read and thrown away, which is cheaper than another system call when the
+ * gaps are small.
+ *
+ * With a file, each span is one positional read.  Where preadv() is
+ * available, the fragments are scattered straight into their destinations;
+ * otherwise the span is read into a scratch buffer and copied out.  Since
+ * positional reads don't share a file offset, spans are read in parallel.
+ */
+class ReadPlanner
+{
+public:
+    //! Default largest gap to read through (64 KiB)
+    static const size_t DEFAULT_MAX_GAP_BYTES;
+
+    //! Default largest span to read at once (16 MiB)
+    static const size_t DEFAULT_MAX_SPAN_BYTES;
+
+    /*!
+     * \struct Span
+     * \brief One contiguous read covering one or more fragments
+     */
+    struct Span
+    {
+        sys::Off_T offset;
+        size_t numBytes;
+        size_t firstFragment;
+        size_t numFragments;
+    };
+
+    /*!
+     * \param maxGapBytes Fragments separated by at most this many bytes are
+     * read together.  0 only merges fragments that touch.
+     * \param maxSpanBytes Spans are not grown past this many bytes (a single
+     * fragment larger than this is still read in one go)
+     */
+    explicit ReadPlanner(size_t maxGapBytes = DEFAULT_MAX_GAP_BYTES,
+                         size_t maxSpanBytes = DEFAULT_MAX_SPAN_BYTES);
+
+    /*!
+     * Adds a fragment.  Fragments may be added in any order but must not
+     * overlap each other in the file.
+     *
+     * \param offset Offset of the fragment in the file
+     * \param numBytes Length of the fragment
+     * \param dest Where to put it.  Must stay valid until read() returns.
+     */
+    void add(sys::Off_T offset, size_t numBytes, void* dest);
+
+    //! Removes all fragments
+    void clear();
+
+    size_t getNumFragments() const
+    {
+        return mFragments.size();
+    }
+
+    /*!
+     * Sorts and merges the fragments.  read() does this itself; it's public
+     * so the plan can be inspected.
+     *
+     * \return The spans that will be read, in file order
+     */
+    const std::vector<Span>& plan();
+
+    /*!
+     * Reads all fragments using positional reads.  This does not use or
+     * move the file's offset, so the same file may be read from several
+     * threads at once.
+     *
+     * \param file File to read from
+     * \param numThreads Number of threads to read spans on.  0 uses the
+     * shared scheduler's thread count.
+     */
+    void read(sys::File& file, size_t numThreads);
+
+    /*!
+     * Reads all fragments with one seek and read per span
+     *
+     * \param inStream Stream to read from
+     */
+    void read(io::SeekableInputStream& inStream);
+
+private:
+    struct Fragment
+    {
+        bool operator<(const Fragment& other) const
+        {
+            return offset < other.offset;
+        }
+
+        sys::Off_T offset;
+        size_t numBytes;
+        sys::ubyte* dest;
+    };
+
+    class SpanReader;
+
+    // Copies the fragments of a span out of a buffer holding all of it
+    void scatter(const Span& span, const sys::ubyte* buffer) const;
+
+    const size_t mMaxGapBytes;
+    const size_t mMaxSpanBytes;
+    std::vector<Fragment> mFragments;
+    std::vector<Span> mSpans;
+    bool mPlanned;
+};
+}
+
+#endif
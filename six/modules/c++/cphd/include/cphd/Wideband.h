@@ -23,10 +23,13 @@
 #ifndef __CPHD_WIDEBAND_H__
 #define __CPHD_WIDEBAND_H__
 
+#include <memory>
 #include <string>
 #include <complex>
 
 #include <sys/Conf.h>
+#include <sys/File.h>
+#include <sys/Mutex.h>
 #include <cphd/Data.h>
 #include <mem/ScopedArray.h>
 #include <mem/SharedPtr.h>
@@ -41,6 +44,10 @@ namespace cphd
 //
 //  Due to the large size of CPHD wideband, this object does not contain
 //  any actual wideband data
+//
+//  read() may be called from several threads at once.  When opened from a
+//  pathname every read is positional, so they don't share a file position
+//  and run concurrently; when given a stream they take turns with it.
 
 class Wideband
 {
@@ -157,6 +164,25 @@ public:
         return mData.sampleType;
     }
 
+    /*
+     * Reads of only some of the samples in each vector are planned with a
+     * ReadPlanner.  Vectors whose pieces are at most this many bytes apart
+     * in the file are read together and the bytes in between thrown away.
+     * When the Wideband was opened from a pathname the reads are also
+     * positional and spread across numThreads.
+     * Defaults to ReadPlanner::DEFAULT_MAX_GAP_BYTES.  Don't change this
+     * while other threads are reading.
+     */
+    void setMaxGapBytes(size_t maxGapBytes)
+    {
+        mMaxGapBytes = maxGapBytes;
+    }
+
+    size_t getMaxGapBytes() const
+    {
+        return mMaxGapBytes;
+    }
+
 private:
     void initialize();
 
@@ -174,8 +200,15 @@ private:
                   size_t lastVector,
                   size_t firstSample,
                   size_t lastSample,
+                  size_t numThreads,
                   void* data);
 
+    // Reads one contiguous piece of the file
+    void readContiguous(sys::Off_T offset,
+                        size_t numBytes,
+                        size_t numThreads,
+                        void* data);
+
     static
     bool allOnes(const std::vector<double>& vectorScaleFactors);
 
@@ -186,12 +219,15 @@ private:
 
 private:
     const mem::SharedPtr<io::SeekableInputStream> mInStream;
+    sys::Mutex mStreamMutex;          // held while mInStream is in use
+    std::auto_ptr<sys::File> mFile;   // for positional reads, if available
     cphd::Data mData;                 // contains numChan, numVectors
     const sys::Off_T mWBOffset;       // offset in bytes to start of wideband
     const size_t mWBSize;             // total size in bytes of wideband
     const size_t mElementSize;        // element size (bytes / complex sample)
 
     std::vector<sys::Off_T> mOffsets; // Offset to start of each channel
+    size_t mMaxGapBytes;              // see setMaxGapBytes()
 
     friend std::ostream& operator<< (std::ostream& os, const Wideband& d);
 };
@@ -21,32 +21,13 @@
  */
 
 #include <sys/Conf.h>
+#include <sys/ByteSwap.h>
 #include <mt/ThreadPlanner.h>
-#include <mt/ThreadGroup.h>
+#include <tasks/TaskScheduler.h>
 #include <cphd/ByteSwap.h>
 
 namespace
 {
-// TODO: Maybe this should go in sys/Conf.h
-//       It's more flexible in that it properly handles float's - you can't
-//       just call sys::byteSwap(floatVal) because the compiler may change the
-//       byte-swapped float value into a valid IEEE value beforehand.
-// TODO: If we're really looking to optimize this, could specialize it for
-//       sizes of 2, 4, and 8 to eliminate the for loop
-template <typename T>
-inline
-void byteSwap(const void* in, T& out)
-{
-    const sys::ubyte* const inPtr = static_cast<const sys::ubyte*>(in);
-    sys::ubyte* const outPtr = reinterpret_cast<sys::ubyte*>(&out);
-
-    for (size_t ii = 0, jj = sizeof(T) - 1; ii < jj; ++ii, --jj)
-    {
-        outPtr[ii] = inPtr[jj];
-        outPtr[jj] = inPtr[ii];
-    }
-}
-
 class ByteSwapRunnable : public sys::Runnable
 {
 public:
@@ -71,65 +52,48 @@ private:
     const size_t mNumElements;
 };
 
-template <typename InT>
 class ByteSwapAndPromoteRunnable : public sys::Runnable
 {
 public:
     ByteSwapAndPromoteRunnable(const void* input,
-                             size_t startRow,
-                             size_t numRows,
-                             size_t numCols,
-                             std::complex<float>* output) :
+                               size_t elementSize,
+                               size_t startRow,
+                               size_t numRows,
+                               size_t numCols,
+                               std::complex<float>* output) :
         mInput(static_cast<const sys::ubyte*>(input) +
-                       startRow * numCols * sizeof(std::complex<InT>)),
-        mDims(numRows, numCols),
+                       startRow * numCols * elementSize),
+        mElementSize(static_cast<unsigned short>(elementSize)),
+        mNumPixels(numRows * numCols),
         mOutput(output + startRow * numCols)
     {
     }
 
     virtual void run()
     {
-        InT real(0);
-        InT imag(0);
-
-        for (size_t row = 0, inIdx = 0, outIdx = 0; row < mDims.row; ++row)
-        {
-            for (size_t col = 0;
-                 col < mDims.col;
-                 ++col, inIdx += sizeof(std::complex<InT>), ++outIdx)
-            {
-                // Have to be careful here - can't treat mInput as a
-                // std::complex<InT> directly in case InT is a float (see
-                // explanation in byteSwap() comments)
-                const sys::ubyte* const input = mInput + inIdx;
-                byteSwap(input, real);
-                byteSwap(input + sizeof(InT), imag);
-
-                mOutput[outIdx] = std::complex<float>(real,
-                                                      imag);
-            }
-        }
+        sys::byteSwapAndPromote(mInput, mElementSize, mNumPixels, mOutput);
     }
 
 private:
     const sys::ubyte* const mInput;
-    const types::RowCol<size_t> mDims;
+    const unsigned short mElementSize;
+    const size_t mNumPixels;
     std::complex<float>* const mOutput;
 };
 
-
-template <typename InT>
 class ByteSwapAndScaleRunnable : public sys::Runnable
 {
 public:
     ByteSwapAndScaleRunnable(const void* input,
+                             size_t elementSize,
                              size_t startRow,
                              size_t numRows,
                              size_t numCols,
                              const double* scaleFactors,
                              std::complex<float>* output) :
         mInput(static_cast<const sys::ubyte*>(input) +
-                       startRow * numCols * sizeof(std::complex<InT>)),
+                       startRow * numCols * elementSize),
+        mElementSize(static_cast<unsigned short>(elementSize)),
         mDims(numRows, numCols),
         mScaleFactors(scaleFactors + startRow),
         mOutput(output + startRow * numCols)
@@ -138,51 +102,48 @@ public:
 
     virtual void run()
     {
-        InT real(0);
-        InT imag(0);
-
-        for (size_t row = 0, inIdx = 0, outIdx = 0; row < mDims.row; ++row)
+        for (size_t row = 0; row < mDims.row; ++row)
         {
-            const double scaleFactor(mScaleFactors[row]);
+            // Promote the row in place, then scale it.  Integer samples
+            // promote to float exactly, so this matches scaling the
+            // original samples in double precision.
+            std::complex<float>* const output = mOutput + row * mDims.col;
+            sys::byteSwapAndPromote(mInput + row * mDims.col * mElementSize,
+                                    mElementSize,
+                                    mDims.col,
+                                    output);
 
-            for (size_t col = 0;
-                 col < mDims.col;
-                 ++col, inIdx += sizeof(std::complex<InT>), ++outIdx)
+            const double scaleFactor(mScaleFactors[row]);
+            float* const samples = reinterpret_cast<float*>(output);
+            for (size_t ii = 0; ii < mDims.col * 2; ++ii)
             {
-                // Have to be careful here - can't treat mInput as a
-                // std::complex<InT> directly in case InT is a float (see
-                // explanation in byteSwap() comments)
-                const sys::ubyte* const input = mInput + inIdx;
-                byteSwap(input, real);
-                byteSwap(input + sizeof(InT), imag);
-
-                mOutput[outIdx] = std::complex<float>(
-                        static_cast<float>(real * scaleFactor),
-                        static_cast<float>(imag * scaleFactor));
+                samples[ii] = static_cast<float>(samples[ii] * scaleFactor);
             }
         }
     }
 
 private:
     const sys::ubyte* const mInput;
+    const unsigned short mElementSize;
     const types::RowCol<size_t> mDims;
     const double* const mScaleFactors;
     std::complex<float>* const mOutput;
 };
 
-template <typename InT>
-void byteSwapAndPromote(const void* input,
-                      const types::RowCol<size_t>& dims,
-                      size_t numThreads,
-                      std::complex<float>* output)
+void byteSwapAndPromoteImpl(const void* input,
+                            size_t elementSize,
+                            const types::RowCol<size_t>& dims,
+                            size_t numThreads,
+                            std::complex<float>* output)
 {
     if (numThreads <= 1)
     {
-        ByteSwapAndPromoteRunnable<InT>(input, 0, dims.row, dims.col,output).run();
+        ByteSwapAndPromoteRunnable(input, elementSize, 0, dims.row, dims.col,
+                                   output).run();
     }
     else
     {
-        mt::ThreadGroup threads;
+        tasks::TaskGroup threads;
         const mt::ThreadPlanner planner(dims.row, numThreads);
 
         size_t threadNum(0);
@@ -193,34 +154,35 @@ void byteSwapAndPromote(const void* input,
                                      numRowsThisThread))
         {
             std::auto_ptr<sys::Runnable> scaler(
-                new ByteSwapAndPromoteRunnable<InT>(
+                new ByteSwapAndPromoteRunnable(
                     input,
+                    elementSize,
                     startRow,
                     numRowsThisThread,
                     dims.col,
                     output));
-            threads.createThread(scaler);
+            threads.createTask(scaler);
         }
 
-        threads.joinAll();
+        threads.wait();
     }
 }
 
-template <typename InT>
-void byteSwapAndScale(const void* input,
-                      const types::RowCol<size_t>& dims,
-                      const double* scaleFactors,
-                      size_t numThreads,
-                      std::complex<float>* output)
+void byteSwapAndScaleImpl(const void* input,
+                          size_t elementSize,
+                          const types::RowCol<size_t>& dims,
+                          const double* scaleFactors,
+                          size_t numThreads,
+                          std::complex<float>* output)
 {
     if (numThreads <= 1)
     {
-        ByteSwapAndScaleRunnable<InT>(input, 0, dims.row, dims.col,
-                                      scaleFactors, output).run();
+        ByteSwapAndScaleRunnable(input, elementSize, 0, dims.row, dims.col,
+                                 scaleFactors, output).run();
     }
     else
     {
-        mt::ThreadGroup threads;
+        tasks::TaskGroup threads;
         const mt::ThreadPlanner planner(dims.row, numThreads);
 
         size_t threadNum(0);
@@ -230,17 +192,18 @@ void byteSwapAndScale(const void* input,
                                      startRow,
                                      numRowsThisThread))
         {
-            std::auto_ptr<sys::Runnable> scaler(new ByteSwapAndScaleRunnable<InT>(
+            std::auto_ptr<sys::Runnable> scaler(new ByteSwapAndScaleRunnable(
                     input,
+                    elementSize,
                     startRow,
                     numRowsThisThread,
                     dims.col,
                     scaleFactors,
                     output));
-            threads.createThread(scaler);
+            threads.createTask(scaler);
         }
 
-        threads.joinAll();
+        threads.wait();
     }
 }
 }
@@ -260,7 +223,7 @@ void byteSwap(void* buffer,
     }
     else
     {
-        mt::ThreadGroup threads;
+        tasks::TaskGroup threads;
         const mt::ThreadPlanner planner(numElements, numThreads);
 
         size_t threadNum(0);
@@ -276,9 +239,9 @@ void byteSwap(void* buffer,
                     startElement,
                     numElementsThisThread));
 
-            threads.createThread(thread);
+            threads.createTask(thread);
         }
-        threads.joinAll();
+        threads.wait();
     }
 }
 
@@ -291,13 +254,9 @@ void byteSwapAndPromote(const void* input,
     switch (elementSize)
     {
     case 2:
-        ::byteSwapAndPromote<sys::Int8_T>(input, dims, numThreads, output);
-        break;
     case 4:
-        ::byteSwapAndPromote<sys::Int16_T>(input, dims, numThreads, output);
-        break;
     case 8:
-        ::byteSwapAndPromote<float>(input, dims, numThreads, output);
+        byteSwapAndPromoteImpl(input, elementSize, dims, numThreads, output);
         break;
     default:
         throw except::Exception(Ctxt(
@@ -315,16 +274,10 @@ void byteSwapAndScale(const void* input,
     switch (elementSize)
     {
     case 2:
-        ::byteSwapAndScale<sys::Int8_T>(input, dims, scaleFactors, numThreads,
-                                        output);
-        break;
     case 4:
-        ::byteSwapAndScale<sys::Int16_T>(input, dims, scaleFactors, numThreads,
-                                         output);
-        break;
     case 8:
-        ::byteSwapAndScale<float>(input, dims, scaleFactors, numThreads,
-                                  output);
+        byteSwapAndScaleImpl(input, elementSize, dims, scaleFactors,
+                             numThreads, output);
         break;
     default:
         throw except::Exception(Ctxt(
@@ -20,7 +20,10 @@
  *
  */
 
+#include <algorithm>
+
 #include <sys/Conf.h>
+#include <sys/OS.h>
 #include <except/Exception.h>
 #include <io/StringStream.h>
 #include <io/FileInputStream.h>
@@ -28,6 +31,7 @@
 #include <mem/ScopedArray.h>
 #include <mem/SharedPtr.h>
 #include <xml/lite/MinidomParser.h>
+#include <tasks/TaskScheduler.h>
 #include <cphd/CPHDReader.h>
 #include <cphd/CPHDXMLControl.h>
 
@@ -42,7 +46,8 @@ CPHDReader::CPHDReader(mem::SharedPtr<io::SeekableInputStream> inStream,
 
 CPHDReader::CPHDReader(const std::string& fromFile,
                        size_t numThreads,
-                       mem::SharedPtr<logging::Logger> logger)
+                       mem::SharedPtr<logging::Logger> logger) :
+    mPathname(fromFile)
 {
     initialize(mem::SharedPtr<io::SeekableInputStream>(
         new io::FileInputStream(fromFile)), numThreads, logger);
@@ -76,9 +81,119 @@ void CPHDReader::initialize(mem::SharedPtr<io::SeekableInputStream> inStream,
                mFileHeader.getVBMsize(),
                numThreads);
 
-    // Setup for wideband reading
-    mWideband.reset(new Wideband(inStream, mMetadata->data,
-                                 mFileHeader.getCPHDoffset(),
-                                 mFileHeader.getCPHDsize()));
+    // Setup for wideband reading.  Given a pathname, it can also do
+    // positional reads.
+    if (mPathname.empty())
+    {
+        mWideband.reset(new Wideband(inStream, mMetadata->data,
+                                     mFileHeader.getCPHDoffset(),
+                                     mFileHeader.getCPHDsize()));
+    }
+    else
+    {
+        mWideband.reset(new Wideband(mPathname, mMetadata->data,
+                                     mFileHeader.getCPHDoffset(),
+                                     mFileHeader.getCPHDsize()));
+    }
+}
+
+template <typename T>
+class CPHDReader::ChannelReader
+{
+public:
+    ChannelReader(CPHDReader& reader,
+                  size_t numThreads,
+                  const std::vector<mem::BufferView<T> >& data) :
+        mReader(reader),
+        mNumThreads(numThreads),
+        mData(data)
+    {
+    }
+
+    void operator()(size_t channel) const
+    {
+        read(channel, mData[channel]);
+    }
+
+private:
+    void read(size_t channel, const mem::BufferView<sys::ubyte>& data) const
+    {
+        mReader.getWideband().read(channel, 0, Wideband::ALL,
+                                   0, Wideband::ALL, mNumThreads, data);
+    }
+
+    void read(size_t channel,
+              const mem::BufferView<std::complex<float> >& data) const
+    {
+        const VBM& vbm(mReader.getVBM());
+        const size_t numVectors = mReader.getNumVectors(channel);
+        std::vector<double> scaleFactors(numVectors, 1.0);
+        if (vbm.haveAmpSF())
+        {
+            for (size_t ii = 0; ii < numVectors; ++ii)
+            {
+                scaleFactors[ii] = vbm.getAmpSF(channel, ii);
+            }
+        }
+
+        // Floats that don't need scaling are read in place
+        std::vector<sys::ubyte> scratch;
+        if (mReader.getNumBytesPerSample() != 8 || vbm.haveAmpSF())
+        {
+            scratch.resize(numVectors * mReader.getNumSamples(channel) *
+                           mReader.getNumBytesPerSample());
+        }
+
+        mReader.getWideband().read(
+                channel, 0, Wideband::ALL, 0, Wideband::ALL,
+                scaleFactors, mNumThreads,
+                mem::BufferView<sys::ubyte>(
+                        scratch.empty() ? NULL : &scratch[0],
+                        scratch.size()),
+                data);
+    }
+
+    CPHDReader& mReader;
+    const size_t mNumThreads;
+    const std::vector<mem::BufferView<T> >& mData;
+};
+
+template <typename T>
+void CPHDReader::readChannelsImpl(size_t numThreads,
+                                  const std::vector<mem::BufferView<T> >& data)
+{
+    const size_t numChannels = getNumChannels();
+    if (data.size() != numChannels)
+    {
+        throw except::Exception(Ctxt(
+                "Expected " + str::toString(numChannels) +
+                " buffers but got " + str::toString(data.size())));
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = sys::OS().getNumCPUs();
+    }
+
+    // Each channel gets its share of the threads to read and convert with
+    const size_t numThreadsPerChannel =
+            std::max<size_t>(numThreads / numChannels, 1);
+    tasks::parallelFor(numChannels, numThreads,
+                       ChannelReader<T>(*this, numThreadsPerChannel, data),
+                       "cphd.CPHDReader.readChannels");
+}
+
+void CPHDReader::readChannels(
+        size_t numThreads,
+        const std::vector<mem::BufferView<sys::ubyte> >& data)
+{
+    readChannelsImpl(numThreads, data);
+}
+
+void CPHDReader::readChannels(
+        size_t numThreads,
+        const std::vector<mem::BufferView<std::complex<float> > >& data)
+{
+    readChannelsImpl(numThreads, data);
 }
 }
@@ -20,14 +20,53 @@
  *
  */
 
+#include <algorithm>
+#include <cstring>
+
+#ifndef WIN32
+#include <errno.h>
+#include <unistd.h>
+#endif
+
 #include <except/Exception.h>
 #include <io/FileOutputStream.h>
+#include <str/Convert.h>
+#include <sys/Err.h>
+#include <sys/File.h>
+#include <tasks/TaskScheduler.h>
 #include <cphd/CPHDWriter.h>
 #include <cphd/CPHDXMLControl.h>
 #include <cphd/Utilities.h>
 #include <cphd/FileHeader.h>
 #include <cphd/ByteSwap.h>
 
+namespace
+{
+#ifndef WIN32
+void pwriteFully(int fd, const void* buffer, size_t numBytes, sys::Off_T offset)
+{
+    const sys::ubyte* ptr = static_cast<const sys::ubyte*>(buffer);
+    while (numBytes > 0)
+    {
+        const ssize_t numWritten = ::pwrite(fd, ptr, numBytes, offset);
+        if (numWritten < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw except::IOException(Ctxt(
+                    "Positional write failed: " + sys::Err().toString()));
+        }
+
+        ptr += numWritten;
+        numBytes -= numWritten;
+        offset += numWritten;
+    }
+}
+#endif
+}
+
 namespace cphd
 {
 CPHDWriter::DataWriter::DataWriter(mem::SharedPtr<io::OutputStream>& stream,
@@ -41,13 +80,44 @@ CPHDWriter::DataWriter::~DataWriter()
 {
 }
 
+class CPHDWriter::DataWriterLittleEndian::SwapRunnable : public sys::Runnable
+{
+public:
+    SwapRunnable(const sys::ubyte* data,
+                 size_t numBytes,
+                 size_t elementSize,
+                 size_t numThreads,
+                 sys::byte* scratch) :
+        mData(data),
+        mNumBytes(numBytes),
+        mElementSize(elementSize),
+        mNumThreads(numThreads),
+        mScratch(scratch)
+    {
+    }
+
+    virtual void run()
+    {
+        memcpy(mScratch, mData, mNumBytes);
+        byteSwap(mScratch, mElementSize, mNumBytes / mElementSize,
+                 mNumThreads);
+    }
+
+private:
+    const sys::ubyte* const mData;
+    const size_t mNumBytes;
+    const size_t mElementSize;
+    const size_t mNumThreads;
+    sys::byte* const mScratch;
+};
+
 CPHDWriter::DataWriterLittleEndian::DataWriterLittleEndian(
         mem::SharedPtr<io::OutputStream>& stream,
         size_t numThreads,
         size_t scratchSize) :
     DataWriter(stream, numThreads),
-    mScratchSize(scratchSize),
-    mScratch(new sys::byte[mScratchSize])
+    mScratchSize(std::max<size_t>(scratchSize / 2, sizeof(double))),
+    mScratch(new sys::byte[mScratchSize * 2])
 {
 }
 
@@ -56,26 +126,39 @@ void CPHDWriter::DataWriterLittleEndian::operator()(
         size_t numElements,
         size_t elementSize)
 {
-    size_t dataProcessed = 0;
     const size_t dataSize = numElements * elementSize;
+    const size_t chunkSize = mScratchSize / elementSize * elementSize;
+    const size_t numChunks = (dataSize + chunkSize - 1) / chunkSize;
+    sys::byte* const buffers[] = {mScratch.get(),
+                                  mScratch.get() + mScratchSize};
 
-    while (dataProcessed < dataSize)
+    if (numChunks == 0)
     {
-        const size_t dataToProcess =
-                std::min(mScratchSize, dataSize - dataProcessed);
-
-        memcpy(mScratch.get(),
-               data + dataProcessed,
-               dataToProcess);
+        return;
+    }
 
-        byteSwap(mScratch.get(),
-                 elementSize,
-                 dataToProcess / elementSize,
-                 mNumThreads);
+    SwapRunnable(data, std::min(chunkSize, dataSize), elementSize,
+                 mNumThreads, buffers[0]).run();
 
-        mStream->write(mScratch.get(), dataToProcess);
+    for (size_t chunk = 0; chunk < numChunks; ++chunk)
+    {
+        // Swap the next chunk into the other buffer while this one is
+        // being written
+        tasks::TaskGroup swapper("cphd.CPHDWriter.swap");
+        const size_t nextOffset = (chunk + 1) * chunkSize;
+        if (nextOffset < dataSize)
+        {
+            swapper.createTask(new SwapRunnable(
+                    data + nextOffset,
+                    std::min(chunkSize, dataSize - nextOffset),
+                    elementSize,
+                    mNumThreads,
+                    buffers[(chunk + 1) % 2]));
+        }
 
-        dataProcessed += dataToProcess;
+        mStream->write(buffers[chunk % 2],
+                       std::min(chunkSize, dataSize - chunk * chunkSize));
+        swapper.wait();
     }
 }
 
@@ -127,6 +210,13 @@ void CPHDWriter::addImage(const T* image,
                 "Incorrect buffer data type used for metadata!"));
     }
 
+    addImageImpl(reinterpret_cast<const sys::ubyte*>(image), dims, vbmData);
+}
+
+void CPHDWriter::addImageImpl(const sys::ubyte* image,
+                              const types::RowCol<size_t>& dims,
+                              const sys::ubyte* vbmData)
+{
     //! If this is the first time you called addImage. We will clear
     //  out the metadata image here and start adding it manually.
     if (mCPHDData.empty())
@@ -136,7 +226,7 @@ void CPHDWriter::addImage(const T* image,
     }
 
     mVBMData.push_back(vbmData);
-    mCPHDData.push_back(reinterpret_cast<const sys::ubyte*>(image));
+    mCPHDData.push_back(image);
 
     mCPHDSize += dims.area() * mElementSize;
     mVBMSize += dims.row * mMetadata.data.getNumBytesVBP();
@@ -163,14 +253,133 @@ void CPHDWriter::addImage<std::complex<float> >(
         const types::RowCol<size_t>& dims,
         const sys::ubyte* vbmData);
 
-void CPHDWriter::writeMetadata(size_t vbmSize,
-                               size_t cphdSize,
-                               const std::string& classification,
-                               const std::string& releaseInfo)
+QuantizationStatistics CPHDWriter::addQuantizedImage(
+        const std::complex<float>* image,
+        const types::RowCol<size_t>& dims,
+        VBM& vbm)
+{
+    const size_t channel = mCPHDData.size();
+    if (!vbm.haveAmpSF())
+    {
+        throw except::Exception(Ctxt(
+                "Quantized images need a VBM with AmpSF enabled"));
+    }
+
+    // Every vector gets a scale factor, so the image has to line up with
+    // the VBM's vectors for its channel
+    if (channel >= vbm.getNumChannels())
+    {
+        throw except::Exception(Ctxt(
+                "The VBM has no channel " + str::toString(channel) +
+                " for this image"));
+    }
+    const size_t numVectors =
+            vbm.getVBMsize(channel) / vbm.getNumBytesVBP();
+    if (dims.row != numVectors || dims.col == 0)
+    {
+        throw except::Exception(Ctxt(
+                "Image of " + str::toString(dims.row) + " x " +
+                str::toString(dims.col) + " samples doesn't match the " +
+                str::toString(numVectors) + " vectors of channel " +
+                str::toString(channel) + " in the VBM"));
+    }
+
+    const size_t numThreads =
+            (mNumThreads == 0) ? sys::OS().getNumCPUs() : mNumThreads;
+    mem::SharedPtr<std::vector<sys::ubyte> > samples(
+            new std::vector<sys::ubyte>(dims.area() * mElementSize));
+    std::vector<double> scaleFactors(dims.row);
+    QuantizationStatistics stats;
+    switch (mElementSize)
+    {
+    case 2:
+        quantize(image, dims, numThreads,
+                 reinterpret_cast<std::complex<sys::Int8_T>*>(&(*samples)[0]),
+                 &scaleFactors[0], stats);
+        break;
+    case 4:
+        quantize(image, dims, numThreads,
+                 reinterpret_cast<std::complex<sys::Int16_T>*>(
+                         &(*samples)[0]),
+                 &scaleFactors[0], stats);
+        break;
+    default:
+        throw except::Exception(Ctxt(
+                "Quantized images must be written as RE08I_IM08I or "
+                "RE16I_IM16I"));
+    }
+
+    for (size_t ii = 0; ii < scaleFactors.size(); ++ii)
+    {
+        vbm.setAmpSF(scaleFactors[ii], channel, ii);
+    }
+
+    mem::SharedPtr<std::vector<sys::ubyte> > vbmData(
+            new std::vector<sys::ubyte>());
+    vbm.getVBMdata(channel, *vbmData);
+    mOwnedData.push_back(samples);
+    mOwnedData.push_back(vbmData);
+
+    mMetadata.data.numBytesVBP = vbm.getNumBytesVBP();
+    addImageImpl(&(*samples)[0], dims, &(*vbmData)[0]);
+    return stats;
+}
+
+#ifndef WIN32
+class CPHDWriter::ChunkWriter : public sys::Runnable
+{
+public:
+    ChunkWriter(const std::vector<Chunk>& chunks,
+                size_t firstChunk,
+                size_t chunkStride,
+                int fd,
+                size_t scratchSize,
+                bool swap) :
+        mChunks(chunks),
+        mFirstChunk(firstChunk),
+        mChunkStride(chunkStride),
+        mFD(fd),
+        mScratchSize(scratchSize),
+        mSwap(swap)
+    {
+    }
+
+    virtual void run()
+    {
+        std::vector<sys::ubyte> scratch(mSwap ? mScratchSize : 0);
+        for (size_t ii = mFirstChunk; ii < mChunks.size(); ii += mChunkStride)
+        {
+            const Chunk& chunk(mChunks[ii]);
+            const sys::ubyte* buffer = chunk.data;
+            if (mSwap && chunk.elementSize > 1)
+            {
+                memcpy(&scratch[0], chunk.data, chunk.numBytes);
+                byteSwap(&scratch[0], chunk.elementSize,
+                         chunk.numBytes / chunk.elementSize, 1);
+                buffer = &scratch[0];
+            }
+            pwriteFully(mFD, buffer, chunk.numBytes, chunk.offset);
+        }
+    }
+
+private:
+    const std::vector<Chunk>& mChunks;
+    const size_t mFirstChunk;
+    const size_t mChunkStride;
+    const int mFD;
+    const size_t mScratchSize;
+    const bool mSwap;
+};
+#endif
+
+std::string CPHDWriter::getPreamble(size_t vbmSize,
+                                    size_t cphdSize,
+                                    const std::string& classification,
+                                    const std::string& releaseInfo,
+                                    FileHeader& header) const
 {
     const std::string xmlMetadata(CPHDXMLControl().toXMLString(mMetadata));
 
-    FileHeader header;
     if (!classification.empty())
     {
         header.setClassification(classification);
@@ -182,18 +391,109 @@ void CPHDWriter::writeMetadata(size_t vbmSize,
 
     // set header size, final step before write
     header.set(xmlMetadata.size(), vbmSize, cphdSize);
-    mOutStream->write(header.toString().c_str(), header.size());
-    mOutStream->write("\f\n", 2);
-    mOutStream->write(xmlMetadata.c_str(), xmlMetadata.size());
-    mOutStream->write("\f\n", 2);
+
+    std::string preamble(header.toString());
+    preamble += "\f\n";
+    preamble += xmlMetadata;
+    preamble += "\f\n";
 
     // Pad bytes
-    char zero = 0;
-    for (sys::Off_T ii = 0; ii < header.getPadBytes(); ++ii)
+    preamble.append(static_cast<size_t>(header.getPadBytes()), '\0');
+    return preamble;
+}
+
+void CPHDWriter::writeMetadata(size_t vbmSize,
+                               size_t cphdSize,
+                               const std::string& classification,
+                               const std::string& releaseInfo)
+{
+    FileHeader header;
+    const std::string preamble =
+            getPreamble(vbmSize, cphdSize, classification, releaseInfo,
+                        header);
+    mOutStream->write(preamble.c_str(), preamble.size());
+}
+
+void CPHDWriter::addChunks(const sys::ubyte* data,
+                           size_t numBytes,
+                           size_t elementSize,
+                           sys::Off_T offset,
+                           std::vector<Chunk>& chunks) const
+{
+    const size_t chunkSize = std::max(
+            elementSize, mScratchSpaceSize / elementSize * elementSize);
+    for (size_t ii = 0; ii < numBytes; ii += chunkSize)
+    {
+        Chunk chunk;
+        chunk.data = data + ii;
+        chunk.numBytes = std::min(chunkSize, numBytes - ii);
+        chunk.elementSize = elementSize;
+        chunk.offset = offset + ii;
+        chunks.push_back(chunk);
+    }
+}
+
+#ifndef WIN32
+void CPHDWriter::writePositional(const std::string& pathname,
+                                 const std::string& classification,
+                                 const std::string& releaseInfo)
+{
+    FileHeader header;
+    const std::string preamble =
+            getPreamble(mVBMSize, mCPHDSize, classification, releaseInfo,
+                        header);
+
+    std::vector<Chunk> chunks;
+    addChunks(reinterpret_cast<const sys::ubyte*>(preamble.data()),
+              preamble.size(), 1, 0, chunks);
+
+    //! The vector based parameters are always 64 bit
+    sys::Off_T offset = header.getVBMoffset();
+    for (size_t ii = 0; ii < mVBMData.size(); ++ii)
+    {
+        const size_t size = mMetadata.data.arraySize[ii].numVectors *
+                mMetadata.data.getNumBytesVBP();
+        addChunks(mVBMData[ii], size, 8, offset, chunks);
+        offset += size;
+    }
+
+    //! Samples are swapped as though they were not complex
+    offset = header.getCPHDoffset();
+    for (size_t ii = 0; ii < mCPHDData.size(); ++ii)
+    {
+        const size_t size = mMetadata.data.arraySize[ii].numVectors *
+                mMetadata.data.arraySize[ii].numSamples * mElementSize;
+        addChunks(mCPHDData[ii], size, mElementSize / 2, offset, chunks);
+        offset += size;
+    }
+
+    // A chunk is never smaller than its element, so it can outgrow
+    // mScratchSpaceSize
+    size_t scratchSize = 0;
+    for (size_t ii = 0; ii < chunks.size(); ++ii)
+    {
+        scratchSize = std::max(scratchSize, chunks[ii].numBytes);
+    }
+
+    // Chunks are dealt out round robin so the threads write near each other
+    sys::File file(pathname, sys::File::WRITE_ONLY,
+                   sys::File::CREATE | sys::File::TRUNCATE);
+    const size_t numThreads =
+            (mNumThreads == 0) ? sys::OS().getNumCPUs() : mNumThreads;
+    const size_t numWriters = std::min(numThreads, chunks.size());
+    const bool swap = !sys::isBigEndianSystem();
+
+    tasks::TaskGroup writers("cphd.CPHDWriter.write");
+    for (size_t ii = 0; ii < numWriters; ++ii)
     {
-        mOutStream->write(&zero, 1);
+        writers.createTask(new ChunkWriter(chunks, ii, numWriters,
+                                           file.getHandle(),
+                                           scratchSize, swap));
     }
+    writers.wait();
+    file.close();
 }
+#endif
 
 void CPHDWriter::writeVBMData(const sys::ubyte* vbm,
                               size_t index)
@@ -288,9 +588,13 @@ void CPHDWriter::write(const std::string& pathname,
                        const std::string& classification,
                        const std::string& releaseInfo)
 {
+#ifndef WIN32
+    writePositional(pathname, classification, releaseInfo);
+#else
     mem::SharedPtr<io::OutputStream> outStream(
             new io::FileOutputStream(pathname));
     write(outStream, classification, releaseInfo);
+#endif
 }
 
 void CPHDWriter::write(mem::SharedPtr<io::OutputStream> outStream,
@@ -61,16 +61,18 @@ std::string CPHDXMLControl::getSICommonURI() const
 
 std::string CPHDXMLControl::toXMLString(const Metadata& metadata)
 {
-    std::auto_ptr<xml::lite::Document> doc(toXML(metadata));
-    io::StringStream ss;
-    doc->getRootElement()->print(ss);
-
-    return (std::string("<?xml version=\"1.0\"?>") + ss.stream().str());
+    std::string xml;
+    xml.reserve(getXMLsize(metadata));
+    six::XMLStreamWriter writer(&xml);
+    write(metadata, writer);
+    return xml;
 }
 
 size_t CPHDXMLControl::getXMLsize(const Metadata& metadata)
 {
-    return toXMLString(metadata).size();
+    six::XMLStreamWriter counter;
+    write(metadata, counter);
+    return counter.getNumBytes();
 }
 
 std::auto_ptr<xml::lite::Document> CPHDXMLControl::toXML(const Metadata& metadata)
@@ -512,6 +514,433 @@ XMLElem CPHDXMLControl::areaSampleDirectionParametersToXML(
     return adpXML;
 }
 
+void CPHDXMLControl::write(const Metadata& metadata,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.writeRaw("<?xml version=\"1.0\"?>");
+    writer.startElement("CPHD");
+    writer.setNamespacePrefix("", getDefaultURI());
+
+    write(metadata.collectionInformation, writer);
+    write(metadata.data, writer);
+    write(metadata.global, writer);
+    write(metadata.channel, writer);
+    write(metadata.srp, writer);
+    if (metadata.antenna.get())
+    {
+        write(*metadata.antenna, writer);
+    }
+    write(metadata.vectorParameters, writer);
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const CollectionInformation& collInfo,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("CollectionInfo");
+
+    writeString(writer, "CollectorName", collInfo.collectorName);
+    if (!collInfo.illuminatorName.empty())
+        writeString(writer, "IlluminatorName", collInfo.illuminatorName);
+    writeString(writer, "CoreName", collInfo.coreName);
+    if (!six::Init::isUndefined(collInfo.collectType))
+    {
+        writeString(writer, "CollectType",
+                    six::toString(collInfo.collectType));
+    }
+
+    writer.startElement("RadarMode");
+    writeString(writer, "ModeType", six::toString(collInfo.radarMode));
+    if (!collInfo.radarModeID.empty())
+        writeString(writer, "ModeID", collInfo.radarModeID);
+    writer.endElement();
+
+    writeString(writer, "Classification", collInfo.classification.level);
+
+    for (std::vector<std::string>::const_iterator it =
+            collInfo.countryCodes.begin(); it != collInfo.countryCodes.end(); ++it)
+    {
+        writeString(writer, "CountryCode", *it);
+    }
+    mCommon.writeParameters(writer, "Parameter", collInfo.parameters);
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::writeLatLonAltFootprint(
+        const std::string& name,
+        const std::string& cornerName,
+        const LatLonAltCorners& corners,
+        six::XMLStreamWriter& writer) const
+{
+    writer.startElement(name);
+
+    // Write the corners in CW order
+    const six::LatLonAlt* const vertices[] = {&corners.upperLeft,
+                                              &corners.upperRight,
+                                              &corners.lowerRight,
+                                              &corners.lowerLeft};
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        writer.addAttributeToNext("index", str::toString(ii + 1));
+        mCommon.writeLatLonAlt(writer, cornerName, *vertices[ii]);
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const Data& data,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("Data");
+
+    writeString(writer, "SampleType", data.sampleType.toString());
+
+    writeInt(writer, "NumCPHDChannels", data.numCPHDChannels);
+    writeInt(writer, "NumBytesVBP", data.numBytesVBP);
+    for (size_t ii = 0; ii < data.numCPHDChannels; ++ii)
+    {
+        const ArraySize& arraySize(data.arraySize.at(ii));
+        writer.startElement("ArraySize");
+        writer.addAttribute("index", str::toString(ii + 1));
+        writeInt(writer, "NumVectors", arraySize.numVectors);
+        writeInt(writer, "NumSamples", arraySize.numSamples);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const Global& global,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("Global");
+
+    writeString(writer, "DomainType", global.domainType.toString());
+    writeString(writer, "PhaseSGN", global.phaseSGN.toString());
+
+    if (!six::Init::isUndefined(global.refFrequencyIndex))
+    {
+        writeInt(writer, "RefFreqIndex", global.refFrequencyIndex);
+    }
+
+    writeDateTime(writer, "CollectStart", global.collectStart);
+    writeDouble(writer, "CollectDuration", global.collectDuration);
+    writeDouble(writer, "TxTime1", global.txTime1);
+    writeDouble(writer, "TxTime2", global.txTime2);
+
+    writer.startElement("ImageArea");
+
+    const ImageArea& area = global.imageArea;
+    writeLatLonAltFootprint("Corners", "ACP", area.acpCorners, writer);
+
+    if (area.plane.get())
+    {
+        const AreaPlane& plane = *area.plane;
+
+        writer.startElement("Plane");
+        writer.startElement("RefPt");
+
+        const six::ReferencePoint& refPt = plane.referencePoint;
+        if (!refPt.name.empty())
+        {
+            writer.addAttribute("name", refPt.name);
+        }
+
+        mCommon.writeVector3D(writer, "ECF", refPt.ecef);
+        writeDouble(writer, "Line", refPt.rowCol.row);
+        writeDouble(writer, "Sample", refPt.rowCol.col);
+        writer.endElement();
+
+        writeAreaDirectionParameters("XDir", "LineSpacing", "NumLines",
+                                     "FirstLine", plane.xDirection, writer);
+        writeAreaDirectionParameters("YDir", "SampleSpacing", "NumSamples",
+                                     "FirstSample", plane.yDirection, writer);
+
+        if (plane.dwellTime.get())
+        {
+            writer.startElement("DwellTime");
+            mCommon.writePoly2D(writer, "CODTimePoly",
+                                plane.dwellTime->codTimePoly);
+            mCommon.writePoly2D(writer, "DwellTimePoly",
+                                plane.dwellTime->dwellTimePoly);
+            writer.endElement();
+        }
+
+        writer.endElement();
+    }
+
+    writer.endElement();
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const Channel& channel,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("Channel");
+
+    for (size_t ii = 0; ii < channel.parameters.size(); ++ii)
+    {
+        writer.startElement("Parameters");
+        writer.addAttribute("index", str::toString(ii + 1));
+
+        const ChannelParameters& cp = channel.parameters[ii];
+        writeInt(writer, "SRP_Index", cp.srpIndex);
+        writeDouble(writer, "NomTOARateSF", cp.nomTOARateSF);
+        writeDouble(writer, "FxCtrNom", cp.fxCtrNom);
+        writeDouble(writer, "BWSavedNom", cp.bwSavedNom);
+        writeDouble(writer, "TOASavedNom", cp.toaSavedNom);
+
+        if (!six::Init::isUndefined(cp.txAntIndex))
+        {
+            writeInt(writer, "TxAnt_Index", cp.txAntIndex);
+        }
+
+        if (!six::Init::isUndefined(cp.rcvAntIndex))
+        {
+            writeInt(writer, "RcvAnt_Index", cp.rcvAntIndex);
+        }
+
+        if (!six::Init::isUndefined(cp.twAntIndex))
+        {
+            writeInt(writer, "TWAnt_Index", cp.twAntIndex);
+        }
+
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const SRP& srp, six::XMLStreamWriter& writer) const
+{
+    writer.startElement("SRP");
+
+    writeString(writer, "SRPType", srp.srpType.toString());
+    writeInt(writer, "NumSRPs", srp.numSRPs);
+
+    switch ((int)srp.srpType)
+    {
+    case cphd::SRPType::FIXEDPT:
+        if (srp.srpPT.size() != srp.numSRPs)
+        {
+            throw except::Exception(Ctxt(
+                    "SRP: number of FIXEDPT entries must match NumSRPs"));
+        }
+        for (size_t ii = 0; ii < srp.srpPT.size(); ++ii)
+        {
+            writer.startElement("FIXEDPT");
+            writer.addAttribute("index", str::toString(ii + 1));
+            mCommon.writeVector3D(writer, "SRPPT", srp.srpPT[ii]);
+            writer.endElement();
+        }
+        break;
+
+    case cphd::SRPType::PVTPOLY:
+        if (srp.srpPVTPoly.size() != srp.numSRPs)
+        {
+            throw except::Exception(Ctxt(
+                    "SRP: number of PVTPOLY entries must match NumSRPs"));
+        }
+        for (size_t ii = 0; ii < srp.srpPVTPoly.size(); ++ii)
+        {
+            writer.startElement("PVTPOLY");
+            writer.addAttribute("index", str::toString(ii + 1));
+            mCommon.writePolyXYZ(writer, "SRPPVTPoly", srp.srpPVTPoly[ii]);
+            writer.endElement();
+        }
+        break;
+
+    case cphd::SRPType::PVVPOLY:
+        if (srp.srpPVVPoly.size() != srp.numSRPs)
+        {
+            throw except::Exception(Ctxt(
+                    "SRP: number of PVVPOLY entries must match NumSRPs"));
+        }
+        for (size_t ii = 0; ii < srp.srpPVVPoly.size(); ++ii)
+        {
+            writer.startElement("PVVPOLY");
+            writer.addAttribute("index", str::toString(ii + 1));
+            mCommon.writePolyXYZ(writer, "SRPPVVPoly", srp.srpPVVPoly[ii]);
+            writer.endElement();
+        }
+        break;
+
+    case cphd::SRPType::STEPPED:
+        if (srp.numSRPs != 0)
+        {
+            throw except::Exception(Ctxt(
+                    "SRP: SRPType of STEPPED must have NumSRPs equal zero"));
+        }
+        break;
+
+    default:
+        throw except::Exception(Ctxt(
+                "Invalid SRPType: " + srp.srpType.toString()));
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const Antenna& antenna,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("Antenna");
+
+    writeInt(writer, "NumTxAnt", antenna.numTxAnt);
+    writeInt(writer, "NumRcvAnt", antenna.numRcvAnt);
+    writeInt(writer, "NumTWAnt", antenna.numTWAnt);
+
+    for (size_t ii = 0; ii < antenna.tx.size(); ++ii)
+    {
+        write("Tx", ii, antenna.tx[ii], writer);
+    }
+    for (size_t ii = 0; ii < antenna.rcv.size(); ++ii)
+    {
+        write("Rcv", ii, antenna.rcv[ii], writer);
+    }
+    for (size_t ii = 0; ii < antenna.twoWay.size(); ++ii)
+    {
+        write("TwoWay", ii, antenna.twoWay[ii], writer);
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const std::string& name,
+                           size_t index,
+                           const AntennaParameters& params,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement(name);
+    writer.addAttribute("index", str::toString(index + 1));
+
+    mCommon.writePolyXYZ(writer, "XAxisPoly", params.xAxisPoly);
+    mCommon.writePolyXYZ(writer, "YAxisPoly", params.yAxisPoly);
+    writeDouble(writer, "FreqZero", params.frequencyZero);
+
+    if (params.electricalBoresight.get())
+    {
+        writer.startElement("EB");
+        mCommon.writePoly1D(writer, "DCXPoly",
+                            params.electricalBoresight->dcxPoly);
+        mCommon.writePoly1D(writer, "DCYPoly",
+                            params.electricalBoresight->dcyPoly);
+        writer.endElement();
+    }
+    if (params.halfPowerBeamwidths.get())
+    {
+        writer.startElement("HPBW");
+        writeDouble(writer, "DCX", params.halfPowerBeamwidths->dcx);
+        writeDouble(writer, "DCY", params.halfPowerBeamwidths->dcy);
+        writer.endElement();
+    }
+    if (params.array.get())
+    {
+        writer.startElement("Array");
+        mCommon.writePoly2D(writer, "GainPoly", params.array->gainPoly);
+        mCommon.writePoly2D(writer, "PhasePoly", params.array->phasePoly);
+        writer.endElement();
+    }
+    if (params.element.get())
+    {
+        writer.startElement("Elem");
+        mCommon.writePoly2D(writer, "GainPoly", params.element->gainPoly);
+        mCommon.writePoly2D(writer, "PhasePoly", params.element->phasePoly);
+        writer.endElement();
+    }
+    if (!params.gainBSPoly.empty())
+    {
+        mCommon.writePoly1D(writer, "GainBSPoly", params.gainBSPoly);
+    }
+
+    writeBooleanType(writer, "EBFreqShift",
+                     params.electricalBoresightFrequencyShift);
+    writeBooleanType(writer, "MLFreqDilation",
+                     params.mainlobeFrequencyDilation);
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::write(const VectorParameters& vp,
+                           six::XMLStreamWriter& writer) const
+{
+    writer.startElement("VectorParameters");
+
+    writeInt(writer, "TxTime", vp.txTime);
+    writeInt(writer, "TxPos", vp.txPos);
+    writeInt(writer, "RcvTime", vp.rcvTime);
+    writeInt(writer, "RcvPos", vp.rcvPos);
+
+    if (!six::Init::isUndefined(vp.srpTime))
+    {
+        writeInt(writer, "SRPTime", vp.srpTime);
+    }
+
+    writeInt(writer, "SRPPos", vp.srpPos);
+
+    if (!six::Init::isUndefined(vp.ampSF))
+    {
+        writeInt(writer, "AmpSF", vp.ampSF);
+    }
+
+    if (!six::Init::isUndefined(vp.tropoSRP))
+    {
+        writeInt(writer, "TropoSRP", vp.tropoSRP);
+    }
+
+    if (vp.fxParameters.get() == NULL && vp.toaParameters.get() == NULL)
+    {
+        throw except::Exception(Ctxt(
+                "VectorParameters: either FxParameters or TOAParameters must "
+                "be present"));
+    }
+
+    if (vp.fxParameters.get() != NULL && vp.toaParameters.get() != NULL)
+    {
+        throw except::Exception(Ctxt(
+                "VectorParameters: FxParameters and TOAParameters cannot both "
+                "be present"));
+    }
+
+    if (vp.fxParameters.get() != NULL)
+    {
+        writer.startElement("FxParameters");
+        writeInt(writer, "Fx0", vp.fxParameters->Fx0);
+        writeInt(writer, "Fx_SS", vp.fxParameters->FxSS);
+        writeInt(writer, "Fx1", vp.fxParameters->Fx1);
+        writeInt(writer, "Fx2", vp.fxParameters->Fx2);
+        writer.endElement();
+    }
+
+    if (vp.toaParameters.get() != NULL)
+    {
+        writer.startElement("TOAParameters");
+        writeInt(writer, "DeltaTOA0", vp.toaParameters->deltaTOA0);
+        writeInt(writer, "TOA_SS", vp.toaParameters->toaSS);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void CPHDXMLControl::writeAreaDirectionParameters(
+        const std::string& name,
+        const std::string& spacingName,
+        const std::string& numName,
+        const std::string& firstName,
+        const AreaDirectionParameters& adp,
+        six::XMLStreamWriter& writer) const
+{
+    writer.startElement(name);
+    mCommon.writeVector3D(writer, "UVectECF", adp.unitVector);
+    writeDouble(writer, spacingName, adp.spacing);
+    writeInt(writer, numName, adp.elements);
+    writeInt(writer, firstName, adp.first);
+    writer.endElement();
+}
+
 std::auto_ptr<Metadata> CPHDXMLControl::fromXML(const std::string& xmlString)
 {
     io::StringStream stringStream;
@@ -0,0 +1,222 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <math.h>
+#include <algorithm>
+
+#include <except/Exception.h>
+#include <str/Convert.h>
+#include <tasks/TaskScheduler.h>
+#include <cphd/FFT.h>
+
+namespace
+{
+// Number of columns gathered together for the column pass.  16 complex
+// floats are 128 bytes, two cache lines.
+const size_t NUM_COLS_PER_BLOCK = 16;
+
+class RowTransformer
+{
+public:
+    RowTransformer(const cphd::FFT& fft, std::complex<float>* data) :
+        mFFT(fft),
+        mData(data)
+    {
+    }
+
+    void operator()(size_t row) const
+    {
+        mFFT.transform(mData + row * mFFT.getSize());
+    }
+
+private:
+    const cphd::FFT& mFFT;
+    std::complex<float>* const mData;
+};
+
+class ColumnTransformer
+{
+public:
+    ColumnTransformer(const cphd::FFT& fft,
+                      const types::RowCol<size_t>& dims,
+                      std::complex<float>* data) :
+        mFFT(fft),
+        mDims(dims),
+        mData(data)
+    {
+    }
+
+    void operator()(size_t block) const
+    {
+        const size_t firstCol = block * NUM_COLS_PER_BLOCK;
+        const size_t numCols =
+                std::min(NUM_COLS_PER_BLOCK, mDims.col - firstCol);
+
+        // Gather the block's columns so each is contiguous, transform them,
+        // and put them back
+        std::vector<std::complex<float> > columns(numCols * mDims.row);
+        for (size_t row = 0; row < mDims.row; ++row)
+        {
+            const std::complex<float>* const input =
+                    mData + row * mDims.col + firstCol;
+            for (size_t col = 0; col < numCols; ++col)
+            {
+                columns[col * mDims.row + row] = input[col];
+            }
+        }
+
+        for (size_t col = 0; col < numCols; ++col)
+        {
+            mFFT.transform(&columns[col * mDims.row]);
+        }
+
+        for (size_t row = 0; row < mDims.row; ++row)
+        {
+            std::complex<float>* const output =
+                    mData + row * mDims.col + firstCol;
+            for (size_t col = 0; col < numCols; ++col)
+            {
+                output[col] = columns[col * mDims.row + row];
+            }
+        }
+    }
+
+private:
+    const cphd::FFT& mFFT;
+    const types::RowCol<size_t> mDims;
+    std::complex<float>* const mData;
+};
+}
+
+namespace cphd
+{
+FFT::FFT(size_t size, int sign) :
+    mSize(size),
+    mSign(sign)
+{
+    if (mSize == 0 || (mSize & (mSize - 1)) != 0)
+    {
+        throw except::Exception(Ctxt(
+                "FFT size must be a power of 2, not " +
+                str::toString(mSize)));
+    }
+    if (mSign != 1 && mSign != -1)
+    {
+        throw except::Exception(Ctxt("FFT sign must be +1 or -1"));
+    }
+
+    size_t numBits = 0;
+    while ((static_cast<size_t>(1) << numBits) < mSize)
+    {
+        ++numBits;
+    }
+
+    mBitReversed.resize(mSize);
+    for (size_t ii = 0; ii < mSize; ++ii)
+    {
+        size_t reversed = 0;
+        for (size_t bit = 0; bit < numBits; ++bit)
+        {
+            reversed |= ((ii >> bit) & 1) << (numBits - 1 - bit);
+        }
+        mBitReversed[ii] = reversed;
+    }
+
+    // Computed in double so the error doesn't build up with the size
+    mTwiddles.reserve(mSize);
+    for (size_t halfLength = 1; halfLength < mSize; halfLength *= 2)
+    {
+        for (size_t ii = 0; ii < halfLength; ++ii)
+        {
+            const double angle = mSign * M_PI * ii / halfLength;
+            mTwiddles.push_back(std::complex<float>(
+                    static_cast<float>(::cos(angle)),
+                    static_cast<float>(::sin(angle))));
+        }
+    }
+}
+
+void FFT::transform(std::complex<float>* data) const
+{
+    for (size_t ii = 0; ii < mSize; ++ii)
+    {
+        const size_t jj = mBitReversed[ii];
+        if (ii < jj)
+        {
+            std::swap(data[ii], data[jj]);
+        }
+    }
+
+    // Butterflies are written out on the real and imaginary parts; going
+    // through std::complex's operator* costs NaN checks
+    const std::complex<float>* twiddles = &mTwiddles[0];
+    for (size_t halfLength = 1; halfLength < mSize; halfLength *= 2)
+    {
+        const size_t length = halfLength * 2;
+        for (size_t start = 0; start < mSize; start += length)
+        {
+            std::complex<float>* const lo = data + start;
+            std::complex<float>* const hi = lo + halfLength;
+            for (size_t ii = 0; ii < halfLength; ++ii)
+            {
+                const float twReal = twiddles[ii].real();
+                const float twImag = twiddles[ii].imag();
+                const float hiReal = hi[ii].real();
+                const float hiImag = hi[ii].imag();
+                const std::complex<float> product(
+                        hiReal * twReal - hiImag * twImag,
+                        hiReal * twImag + hiImag * twReal);
+                hi[ii] = lo[ii] - product;
+                lo[ii] += product;
+            }
+        }
+        twiddles += halfLength;
+    }
+}
+
+size_t FFT::nextPowerOfTwo(size_t size)
+{
+    size_t power = 1;
+    while (power < size)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+void fft2D(std::complex<float>* data,
+           const types::RowCol<size_t>& dims,
+           int sign,
+           size_t numThreads)
+{
+    const FFT rowFFT(dims.col, sign);
+    tasks::parallelFor(dims.row, numThreads, RowTransformer(rowFFT, data),
+                       "cphd.fft2D.rows");
+
+    const FFT colFFT(dims.row, sign);
+    const size_t numBlocks =
+            (dims.col + NUM_COLS_PER_BLOCK - 1) / NUM_COLS_PER_BLOCK;
+    tasks::parallelFor(numBlocks, numThreads,
+                       ColumnTransformer(colFFT, dims, data),
+                       "cphd.fft2D.cols");
+}
+}
@@ -0,0 +1,723 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CPHD_PFA_SSE2
+#endif
+
+#include <except/Exception.h>
+#include <math/Constants.h>
+#include <math/poly/Fit.h>
+#include <sys/OS.h>
+#include <scene/ECEFToLLATransform.h>
+#include <tasks/TaskScheduler.h>
+#include <six/Init.h>
+#include <six/Instrumentation.h>
+#include <six/ParallelNITFFileSink.h>
+#include <six/sicd/SICDByteProvider.h>
+#include <cphd/FFT.h>
+#include <cphd/PulseBlockReader.h>
+#include <cphd/PFAImageFormer.h>
+
+namespace
+{
+// Vectors range interpolated and transposed together.  16 complex floats are
+// two cache lines of each keystone row.
+const size_t NUM_VECTORS_PER_TILE = 16;
+
+/*
+ * 8-tap windowed sinc interpolator, tabulated at 512 fractional offsets.
+ * Each tap's weight is stored twice, once for the real part and once for the
+ * imaginary part, so complex samples can be multiplied four floats at a time.
+ */
+class Interpolator
+{
+public:
+    static const size_t NUM_TAPS = 8;
+    static const size_t NUM_PHASES = 512;
+
+    Interpolator() :
+        mWeights((NUM_PHASES + 1) * NUM_TAPS * 2)
+    {
+        const double halfWidth = NUM_TAPS / 2;
+        for (size_t phase = 0; phase <= NUM_PHASES; ++phase)
+        {
+            const double fraction = static_cast<double>(phase) / NUM_PHASES;
+            double weights[NUM_TAPS];
+            double sum = 0.0;
+            for (size_t tap = 0; tap < NUM_TAPS; ++tap)
+            {
+                // Distance from the tap to the point being interpolated
+                const double x = static_cast<double>(tap) -
+                        (halfWidth - 1) - fraction;
+                const double sinc = (x == 0.0) ?
+                        1.0 : ::sin(M_PI * x) / (M_PI * x);
+                const double window =
+                        0.5 * (1.0 + ::cos(M_PI * x / (halfWidth + 1)));
+                weights[tap] = sinc * window;
+                sum += weights[tap];
+            }
+
+            // Keep the DC gain at 1
+            float* const output = &mWeights[phase * NUM_TAPS * 2];
+            for (size_t tap = 0; tap < NUM_TAPS; ++tap)
+            {
+                output[tap * 2] = output[tap * 2 + 1] =
+                        static_cast<float>(weights[tap] / sum);
+            }
+        }
+    }
+
+    /*
+     * \param input Uniformly spaced samples
+     * \param numSamples Number of samples in 'input'
+     * \param position Fractional sample to interpolate at.  Samples off
+     * either end are taken to be 0.
+     */
+    std::complex<float> operator()(const std::complex<float>* input,
+                                   size_t numSamples,
+                                   double position) const
+    {
+        const double floorPosition = ::floor(position);
+        ptrdiff_t first = static_cast<ptrdiff_t>(floorPosition) -
+                static_cast<ptrdiff_t>(NUM_TAPS / 2 - 1);
+        size_t phase = static_cast<size_t>(
+                (position - floorPosition) * NUM_PHASES + 0.5);
+        const float* const weights = &mWeights[phase * NUM_TAPS * 2];
+
+        if (first >= 0 &&
+            first + static_cast<ptrdiff_t>(NUM_TAPS) <=
+                    static_cast<ptrdiff_t>(numSamples))
+        {
+            return apply(input + first, weights);
+        }
+
+        float real = 0.0f;
+        float imag = 0.0f;
+        for (size_t tap = 0; tap < NUM_TAPS; ++tap)
+        {
+            const ptrdiff_t sample = first + static_cast<ptrdiff_t>(tap);
+            if (sample >= 0 && sample < static_cast<ptrdiff_t>(numSamples))
+            {
+                real += weights[tap * 2] * input[sample].real();
+                imag += weights[tap * 2] * input[sample].imag();
+            }
+        }
+        return std::complex<float>(real, imag);
+    }
+
+private:
+    static std::complex<float> apply(const std::complex<float>* input,
+                                     const float* weights)
+    {
+        const float* const samples = reinterpret_cast<const float*>(input);
+#ifdef CPHD_PFA_SSE2
+        // Two complex samples at a time: (re0, im0, re1, im1)
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(samples),
+                                _mm_loadu_ps(weights));
+        for (size_t ii = 4; ii < NUM_TAPS * 2; ii += 4)
+        {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(samples + ii),
+                                             _mm_loadu_ps(weights + ii)));
+        }
+        float output[4];
+        _mm_storeu_ps(output, sum);
+        return std::complex<float>(output[0] + output[2],
+                                   output[1] + output[3]);
+#else
+        float real = 0.0f;
+        float imag = 0.0f;
+        for (size_t ii = 0; ii < NUM_TAPS * 2; ii += 2)
+        {
+            real += weights[ii] * samples[ii];
+            imag += weights[ii + 1] * samples[ii + 1];
+        }
+        return std::complex<float>(real, imag);
+#endif
+    }
+
+    std::vector<float> mWeights;
+};
+
+class BandWriter
+{
+public:
+    BandWriter(six::ParallelNITFFileSink& sink,
+               const std::complex<float>* image,
+               const types::RowCol<size_t>& dims,
+               size_t numRowsPerBand) :
+        mSink(sink),
+        mImage(image),
+        mDims(dims),
+        mNumRowsPerBand(numRowsPerBand)
+    {
+    }
+
+    void operator()(size_t band) const
+    {
+        const size_t startRow = band * mNumRowsPerBand;
+        const size_t numRows =
+                std::min(mNumRowsPerBand, mDims.row - startRow);
+        mSink.writeNativeEndian(mImage + startRow * mDims.col, startRow,
+                                numRows);
+    }
+
+private:
+    six::ParallelNITFFileSink& mSink;
+    const std::complex<float>* const mImage;
+    const types::RowCol<size_t> mDims;
+    const size_t mNumRowsPerBand;
+};
+
+six::Poly1D fit(const std::vector<double>& x,
+                const std::vector<double>& y,
+                size_t maxOrder)
+{
+    return math::poly::fit(x.size(), &x[0], &y[0],
+                           std::min(maxOrder, x.size() - 1));
+}
+
+void setDirection(const six::Vector3& unitVector,
+                  double kCenter,
+                  double bandwidth,
+                  size_t numKSamples,
+                  size_t numPixels,
+                  int phaseSign,
+                  six::sicd::DirectionParameters& direction)
+{
+    // Zero padding to numPixels oversamples the image
+    const double deltaK = bandwidth / numKSamples;
+    direction.unitVector = unitVector;
+    direction.sampleSpacing = 1.0 / (numPixels * deltaK);
+    direction.impulseResponseWidth = 0.886 / bandwidth;
+    direction.sign = six::FFTSign(phaseSign);
+    direction.impulseResponseBandwidth = bandwidth;
+    direction.kCenter = kCenter;
+    direction.deltaK1 = -bandwidth / 2;
+    direction.deltaK2 = bandwidth / 2;
+    direction.deltaKCOAPoly = six::Poly2D(0, 0);
+    direction.deltaKCOAPoly[0][0] = 0.0;
+    direction.weightType.reset(new six::sicd::WeightType());
+    direction.weightType->windowName = "UNIFORM";
+    direction.weights.clear();
+}
+}
+
+namespace cphd
+{
+/*
+ * Resamples a tile of vectors from a pulse block to the output Krg samples
+ * and stores them in the keystone, which is Krg samples x vectors
+ */
+class PFAImageFormer::RangeInterpolator
+{
+public:
+    RangeInterpolator(const PFAImageFormer& former,
+                      const Interpolator& interpolator,
+                      const PulseBlockReader::Block& block,
+                      std::complex<float>* keystone) :
+        mFormer(former),
+        mInterpolator(interpolator),
+        mBlock(block),
+        mKeystone(keystone)
+    {
+    }
+
+    void operator()(size_t tile) const
+    {
+        const size_t numKrg = mFormer.mNumKSamples.row;
+        const size_t numSamples = mBlock.numSamples;
+        const size_t firstVector = tile * NUM_VECTORS_PER_TILE;
+        const size_t numVectors = std::min(NUM_VECTORS_PER_TILE,
+                                           mBlock.numVectors - firstVector);
+        const double deltaKrg = (mFormer.mKrg2 - mFormer.mKrg1) / numKrg;
+
+        std::vector<std::complex<float> > resampled(numVectors * numKrg);
+        for (size_t ii = 0; ii < numVectors; ++ii)
+        {
+            const size_t vector = mBlock.firstVector + firstVector + ii;
+            const VectorGeometry& geometry(mFormer.mVectors[vector]);
+            const std::complex<float>* const input =
+                    mBlock.data + (firstVector + ii) * numSamples;
+            std::complex<float>* const output = &resampled[ii * numKrg];
+            for (size_t jj = 0; jj < numKrg; ++jj)
+            {
+                const double krg = mFormer.mKrg1 + jj * deltaKrg;
+                const double frequency = krg / geometry.krgPerHz;
+                output[jj] = mInterpolator(
+                        input, numSamples,
+                        (frequency - geometry.fx0) / geometry.fxSS);
+            }
+        }
+
+        // Transposed a tile at a time
+        const size_t numCols = mFormer.mNumVectors;
+        for (size_t jj = 0; jj < numKrg; ++jj)
+        {
+            std::complex<float>* const output = mKeystone + jj * numCols +
+                    mBlock.firstVector + firstVector;
+            for (size_t ii = 0; ii < numVectors; ++ii)
+            {
+                output[ii] = resampled[ii * numKrg + jj];
+            }
+        }
+    }
+
+private:
+    const PFAImageFormer& mFormer;
+    const Interpolator& mInterpolator;
+    const PulseBlockReader::Block& mBlock;
+    std::complex<float>* const mKeystone;
+};
+
+/*
+ * Resamples one Krg sample of the keystone to the output Kaz samples and
+ * stores them in the zero padded image, ready for the FFT
+ */
+class PFAImageFormer::AzimuthInterpolator
+{
+public:
+    AzimuthInterpolator(const PFAImageFormer& former,
+                        const Interpolator& interpolator,
+                        const std::complex<float>* keystone,
+                        std::complex<float>* image) :
+        mFormer(former),
+        mInterpolator(interpolator),
+        mKeystone(keystone),
+        mImage(image),
+        mTanAngles(former.mNumVectors)
+    {
+        // Made increasing so they can be searched
+        const double sign =
+                (former.getPolarAngle(former.mNumVectors - 1) <
+                 former.getPolarAngle(0)) ? -1.0 : 1.0;
+        mSign = sign;
+        for (size_t ii = 0; ii < mTanAngles.size(); ++ii)
+        {
+            const VectorGeometry& geometry(former.mVectors[ii]);
+            mTanAngles[ii] = sign * geometry.kazPerHz / geometry.krgPerHz;
+        }
+    }
+
+    void operator()(size_t krgSample) const
+    {
+        const types::RowCol<size_t>& numK(mFormer.mNumKSamples);
+        const types::RowCol<size_t>& dims(mFormer.mDims);
+        const double krg = mFormer.mKrg1 +
+                krgSample * (mFormer.mKrg2 - mFormer.mKrg1) / numK.row;
+        const double deltaKaz = (mFormer.mKaz2 - mFormer.mKaz1) / numK.col;
+        const std::complex<float>* const input =
+                mKeystone + krgSample * mFormer.mNumVectors;
+
+        // Sample m (counting from the center of the rectangle) goes to m
+        // modulo the padded size, times (-1)^m so the FFT puts the SCP in
+        // the middle of the image
+        const size_t row = (krgSample + dims.row - numK.row / 2) % dims.row;
+        std::complex<float>* const output = mImage + row * dims.col;
+        for (size_t ii = 0; ii < numK.col; ++ii)
+        {
+            const double tanAngle =
+                    mSign * (mFormer.mKaz1 + ii * deltaKaz) / krg;
+            const std::complex<float> value = mInterpolator(
+                    input, mFormer.mNumVectors, getPosition(tanAngle));
+
+            const size_t col = (ii + dims.col - numK.col / 2) % dims.col;
+            output[col] = ((krgSample + ii + numK.row / 2 + numK.col / 2) & 1)
+                    ? -value : value;
+        }
+    }
+
+private:
+    // Fractional vector with this tangent of the polar angle
+    double getPosition(double tanAngle) const
+    {
+        const std::vector<double>::const_iterator upper = std::upper_bound(
+                mTanAngles.begin() + 1, mTanAngles.end() - 1, tanAngle);
+        const size_t index = (upper - mTanAngles.begin()) - 1;
+        return index + (tanAngle - mTanAngles[index]) /
+                (mTanAngles[index + 1] - mTanAngles[index]);
+    }
+
+    const PFAImageFormer& mFormer;
+    const Interpolator& mInterpolator;
+    const std::complex<float>* const mKeystone;
+    std::complex<float>* const mImage;
+    std::vector<double> mTanAngles;
+    double mSign;
+};
+
+PFAImageFormer::PFAImageFormer(CPHDReader& reader,
+                               size_t channel,
+                               size_t numThreads,
+                               size_t numVectorsPerBlock) :
+    mReader(reader),
+    mChannel(channel),
+    mNumThreads(numThreads == 0 ? sys::OS().getNumCPUs() : numThreads),
+    mNumVectorsPerBlock(std::max<size_t>(numVectorsPerBlock, 1)),
+    mNumVectors(channel < reader.getNumChannels() ?
+            reader.getNumVectors(channel) : 0),
+    mNumSamples(channel < reader.getNumChannels() ?
+            reader.getNumSamples(channel) : 0),
+    mPhaseSign(reader.getMetadata().global.phaseSGN == PhaseSGN::PLUS_1 ?
+            1 : -1),
+    mRefVector(mNumVectors / 2)
+{
+    if (channel >= reader.getNumChannels())
+    {
+        throw except::Exception(Ctxt("Invalid channel number"));
+    }
+    if (!reader.isFX())
+    {
+        throw except::Exception(Ctxt("PFA needs FX domain phase history"));
+    }
+    if (mNumVectors < 2 || mNumSamples < 2)
+    {
+        throw except::Exception(Ctxt(
+                "PFA needs at least two vectors of two samples"));
+    }
+
+    computeGeometry();
+    computeGrid();
+}
+
+void PFAImageFormer::computeGeometry()
+{
+    const VBM& vbm(mReader.getVBM());
+    const double speedOfLight = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+
+    mVectors.resize(mNumVectors);
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        VectorGeometry& geometry(mVectors[ii]);
+        geometry.time = (vbm.getTxTime(mChannel, ii) +
+                         vbm.getRcvTime(mChannel, ii)) / 2;
+        geometry.arpPos = 0.5 * (vbm.getTxPos(mChannel, ii) +
+                                 vbm.getRcvPos(mChannel, ii));
+        geometry.fx0 = vbm.getFx0(mChannel, ii);
+        geometry.fxSS = vbm.getFxSS(mChannel, ii);
+        if (geometry.fxSS <= 0.0)
+        {
+            throw except::Exception(Ctxt(
+                    "Vector " + str::toString(ii) +
+                    " has a non-positive sample spacing"));
+        }
+    }
+
+    // The reference vector's line of sight and the velocity define the
+    // image plane.  Rows increase away from the radar and columns along
+    // the track.
+    mSCP = vbm.getSRPPos(mChannel, mRefVector);
+    const double duration =
+            mVectors.back().time - mVectors.front().time;
+    if (duration <= 0.0)
+    {
+        throw except::Exception(Ctxt("Vectors must be in time order"));
+    }
+    const Vector3 velocity = (1.0 / duration) *
+            (mVectors.back().arpPos - mVectors.front().arpPos);
+
+    mRowUnitVector = (mSCP - mVectors[mRefVector].arpPos).unit();
+    mColUnitVector = (velocity -
+            velocity.dot(mRowUnitVector) * mRowUnitVector).unit();
+    mImagePlaneNormal = math::linear::cross(mRowUnitVector, mColUnitVector);
+    if (mImagePlaneNormal.dot(mSCP) < 0.0)
+    {
+        mImagePlaneNormal = -mImagePlaneNormal;
+    }
+
+    // Each sample's spatial frequency is f/c times the sum of the unit
+    // vectors from the SRP to the transmitter and receiver.  It points
+    // toward the radar, and rows increase away from it.
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        const Vector3 srpPos = vbm.getSRPPos(mChannel, ii);
+        const Vector3 kPerHz = (-1.0 / speedOfLight) *
+                ((vbm.getTxPos(mChannel, ii) - srpPos).unit() +
+                 (vbm.getRcvPos(mChannel, ii) - srpPos).unit());
+
+        VectorGeometry& geometry(mVectors[ii]);
+        geometry.krgPerHz = kPerHz.dot(mRowUnitVector);
+        geometry.kazPerHz = kPerHz.dot(mColUnitVector);
+        if (geometry.krgPerHz <= 0.0)
+        {
+            throw except::Exception(Ctxt(
+                    "Vector " + str::toString(ii) +
+                    " looks away from the SCP"));
+        }
+    }
+}
+
+void PFAImageFormer::computeGrid()
+{
+    // The largest rectangle inside the annulus.  Its Krg extent is limited
+    // by the vectors with the highest first and lowest last Krg.
+    mKrg1 = -std::numeric_limits<double>::max();
+    mKrg2 = std::numeric_limits<double>::max();
+    double minTanAngle = std::numeric_limits<double>::max();
+    double maxTanAngle = -std::numeric_limits<double>::max();
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        const VectorGeometry& geometry(mVectors[ii]);
+        const double lastFrequency =
+                geometry.fx0 + (mNumSamples - 1) * geometry.fxSS;
+        mKrg1 = std::max(mKrg1, geometry.fx0 * geometry.krgPerHz);
+        mKrg2 = std::min(mKrg2, lastFrequency * geometry.krgPerHz);
+
+        const double tanAngle = geometry.kazPerHz / geometry.krgPerHz;
+        minTanAngle = std::min(minTanAngle, tanAngle);
+        maxTanAngle = std::max(maxTanAngle, tanAngle);
+    }
+    if (mKrg2 <= mKrg1)
+    {
+        throw except::Exception(Ctxt(
+                "The vectors' spatial frequencies don't overlap"));
+    }
+
+    // Its Kaz extent is limited by the edge vectors, at whichever end of the
+    // Krg extent they're closer to the Krg axis
+    mKaz1 = minTanAngle * ((minTanAngle < 0.0) ? mKrg1 : mKrg2);
+    mKaz2 = maxTanAngle * ((maxTanAngle > 0.0) ? mKrg1 : mKrg2);
+
+    // The azimuth pass looks vectors up by polar angle
+    const bool increasing = getPolarAngle(mNumVectors - 1) > getPolarAngle(0);
+    for (size_t ii = 1; ii < mNumVectors; ++ii)
+    {
+        if ((getPolarAngle(ii) > getPolarAngle(ii - 1)) != increasing ||
+            getPolarAngle(ii) == getPolarAngle(ii - 1))
+        {
+            throw except::Exception(Ctxt(
+                    "Vectors must be in order of polar angle"));
+        }
+    }
+
+    // As many samples as went in, padded out for the FFT
+    mNumKSamples = types::RowCol<size_t>(mNumSamples, mNumVectors);
+    mDims = types::RowCol<size_t>(FFT::nextPowerOfTwo(mNumSamples),
+                                  FFT::nextPowerOfTwo(mNumVectors));
+}
+
+double PFAImageFormer::getPolarAngle(size_t vector) const
+{
+    return ::atan2(mVectors[vector].kazPerHz, mVectors[vector].krgPerHz);
+}
+
+void PFAImageFormer::form()
+{
+    const Interpolator interpolator;
+    mImage.assign(mDims.area(), std::complex<float>(0.0f, 0.0f));
+
+    {
+        std::vector<std::complex<float> > keystone(
+                mNumKSamples.row * mNumVectors);
+        {
+            six::ScopedStageTimer timer("cphd.PFA.range");
+            timer.addRows(mNumVectors);
+            timer.addBytes(mNumVectors * mNumSamples *
+                           sizeof(std::complex<float>));
+
+            PulseBlockReader blocks(mReader, mChannel, mNumVectorsPerBlock,
+                                    2, mNumThreads);
+            PulseBlockReader::Block block;
+            while (blocks.next(block))
+            {
+                const size_t numTiles =
+                        (block.numVectors + NUM_VECTORS_PER_TILE - 1) /
+                        NUM_VECTORS_PER_TILE;
+                tasks::parallelFor(numTiles, mNumThreads,
+                                   RangeInterpolator(*this, interpolator,
+                                                     block, &keystone[0]),
+                                   "cphd.PFA.range");
+            }
+        }
+
+        six::ScopedStageTimer timer("cphd.PFA.azimuth");
+        timer.addRows(mNumKSamples.row);
+        timer.addBytes(keystone.size() * sizeof(std::complex<float>));
+        tasks::parallelFor(mNumKSamples.row, mNumThreads,
+                           AzimuthInterpolator(*this, interpolator,
+                                               &keystone[0], &mImage[0]),
+                           "cphd.PFA.azimuth");
+    }
+
+    six::ScopedStageTimer timer("cphd.PFA.fft");
+    timer.addRows(mDims.row);
+    timer.addBytes(mImage.size() * sizeof(std::complex<float>));
+    fft2D(&mImage[0], mDims, -mPhaseSign, mNumThreads);
+}
+
+const std::complex<float>* PFAImageFormer::getImage() const
+{
+    if (mImage.empty())
+    {
+        throw except::Exception(Ctxt("The image hasn't been formed"));
+    }
+    return &mImage[0];
+}
+
+void PFAImageFormer::populateComplexData(six::sicd::ComplexData& data) const
+{
+    const double refTime = mVectors[mRefVector].time;
+    const double speedOfLight = math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+
+    six::sicd::ImageData& imageData(*data.imageData);
+    imageData.pixelType = six::PixelType::RE32F_IM32F;
+    imageData.numRows = mDims.row;
+    imageData.numCols = mDims.col;
+    imageData.firstRow = 0;
+    imageData.firstCol = 0;
+    imageData.fullImage = six::RowColInt(mDims.row, mDims.col);
+    imageData.scpPixel = six::RowColInt(mDims.row / 2, mDims.col / 2);
+    imageData.validData.resize(4);
+    imageData.validData[0] = six::RowColInt(0, 0);
+    imageData.validData[1] = six::RowColInt(0, mDims.col - 1);
+    imageData.validData[2] = six::RowColInt(mDims.row - 1, mDims.col - 1);
+    imageData.validData[3] = six::RowColInt(mDims.row - 1, 0);
+
+    // Corners get derived below
+    data.geoData->scp.ecf = mSCP;
+    data.geoData->scp.llh = scene::ECEFToLLATransform().transform(mSCP);
+    data.geoData->imageCorners =
+            six::Init::undefined<six::LatLonCorners>();
+    data.geoData->validData.clear();
+
+    six::sicd::Grid& grid(*data.grid);
+    grid.imagePlane = six::ComplexImagePlaneType::SLANT;
+    grid.type = six::ComplexImageGridType::RGAZIM;
+    grid.timeCOAPoly = six::Poly2D(0, 0);
+    grid.timeCOAPoly[0][0] = refTime;
+    setDirection(mRowUnitVector, (mKrg1 + mKrg2) / 2, mKrg2 - mKrg1,
+                 mNumKSamples.row, mDims.row, mPhaseSign, *grid.row);
+    setDirection(mColUnitVector, (mKaz1 + mKaz2) / 2, mKaz2 - mKaz1,
+                 mNumKSamples.col, mDims.col, mPhaseSign, *grid.col);
+
+    std::vector<double> times(mNumVectors);
+    std::vector<double> angles(mNumVectors);
+    std::vector<double> scaleFactors(mNumVectors);
+    std::vector<double> arpPos[3];
+    double minFrequency = std::numeric_limits<double>::max();
+    double maxFrequency = 0.0;
+    double minProcFrequency = std::numeric_limits<double>::max();
+    double maxProcFrequency = 0.0;
+    for (size_t ii = 0; ii < mNumVectors; ++ii)
+    {
+        const VectorGeometry& geometry(mVectors[ii]);
+        times[ii] = geometry.time;
+        angles[ii] = getPolarAngle(ii);
+
+        // The spatial frequency is KSF * 2f/c
+        scaleFactors[ii] = ::sqrt(geometry.krgPerHz * geometry.krgPerHz +
+                                  geometry.kazPerHz * geometry.kazPerHz) *
+                speedOfLight / 2;
+        for (size_t jj = 0; jj < 3; ++jj)
+        {
+            arpPos[jj].push_back(geometry.arpPos[jj]);
+        }
+
+        minFrequency = std::min(minFrequency, geometry.fx0);
+        maxFrequency = std::max(maxFrequency,
+                                geometry.fx0 +
+                                        (mNumSamples - 1) * geometry.fxSS);
+        minProcFrequency = std::min(minProcFrequency,
+                                    mKrg1 / geometry.krgPerHz);
+        maxProcFrequency = std::max(maxProcFrequency,
+                                    mKrg2 / geometry.krgPerHz);
+    }
+
+    data.pfa.reset(new six::sicd::PFA());
+    data.pfa->focusPlaneNormal = mImagePlaneNormal;
+    data.pfa->imagePlaneNormal = mImagePlaneNormal;
+    data.pfa->polarAngleRefTime = refTime;
+    data.pfa->polarAnglePoly = fit(times, angles, 3);
+    data.pfa->spatialFrequencyScaleFactorPoly =
+            fit(angles, scaleFactors, 3);
+    data.pfa->krg1 = mKrg1;
+    data.pfa->krg2 = mKrg2;
+    data.pfa->kaz1 = mKaz1;
+    data.pfa->kaz2 = mKaz2;
+
+    six::sicd::ImageFormation& imageFormation(*data.imageFormation);
+    imageFormation.imageFormationAlgorithm = six::ImageFormationType::PFA;
+    imageFormation.tStartProc = times.front();
+    imageFormation.tEndProc = times.back();
+    imageFormation.txFrequencyProcMin = minProcFrequency;
+    imageFormation.txFrequencyProcMax = maxProcFrequency;
+    imageFormation.rcvChannelProcessed.reset(
+            new six::sicd::RcvChannelProcessed());
+    imageFormation.rcvChannelProcessed->numChannelsProcessed = 1;
+    imageFormation.rcvChannelProcessed->prfScaleFactor = 1.0;
+    imageFormation.rcvChannelProcessed->channelIndex.push_back(
+            static_cast<int>(mChannel + 1));
+
+    data.radarCollection->txFrequencyMin = minFrequency;
+    data.radarCollection->txFrequencyMax = maxFrequency;
+
+    const six::Poly1D xPoly = fit(times, arpPos[0], 5);
+    const six::Poly1D yPoly = fit(times, arpPos[1], 5);
+    const six::Poly1D zPoly = fit(times, arpPos[2], 5);
+    data.position->arpPoly = six::PolyXYZ(xPoly.order());
+    for (size_t ii = 0; ii <= xPoly.order(); ++ii)
+    {
+        data.position->arpPoly[ii][0] = xPoly[ii];
+        data.position->arpPoly[ii][1] = yPoly[ii];
+        data.position->arpPoly[ii][2] = zPoly[ii];
+    }
+
+    // Everything derived from the ARP at the SCP time starts over
+    data.scpcoa.reset(new six::sicd::SCPCOA());
+    data.scpcoa->scpTime = refTime;
+    data.fillDerivedFields(false);
+}
+
+void PFAImageFormer::write(const six::sicd::ComplexData& data,
+                           const std::vector<std::string>& schemaPaths,
+                           const std::string& pathname,
+                           size_t numRowsPerBand) const
+{
+    const std::complex<float>* const image = getImage();
+    if (data.getNumRows() != mDims.row || data.getNumCols() != mDims.col ||
+        data.getPixelType() != six::PixelType::RE32F_IM32F)
+    {
+        throw except::Exception(Ctxt(
+                "Complex data must be RE32F_IM32F and match the image "
+                "dimensions"));
+    }
+
+    six::ScopedStageTimer timer("cphd.PFA.write");
+    timer.addRows(mDims.row);
+    timer.addBytes(mImage.size() * sizeof(std::complex<float>));
+
+    const six::sicd::SICDByteProvider provider(data, schemaPaths);
+    six::ParallelNITFFileSink sink(provider, pathname);
+
+    numRowsPerBand = std::max<size_t>(numRowsPerBand, 1);
+    const size_t numBands = (mDims.row + numRowsPerBand - 1) / numRowsPerBand;
+    tasks::parallelFor(numBands, mNumThreads,
+                       BandWriter(sink, image, mDims, numRowsPerBand),
+                       "cphd.PFA.write");
+    sink.finalize();
+}
+}
@@ -0,0 +1,303 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <mem/BufferView.h>
+#include <mt/CriticalSection.h>
+#include <cphd/PulseBlockReader.h>
+
+namespace cphd
+{
+class PulseBlockReader::ProducerRunnable : public sys::Runnable
+{
+public:
+    ProducerRunnable(PulseBlockReader& reader) :
+        mReader(reader)
+    {
+    }
+
+    virtual void run()
+    {
+        std::string message;
+        try
+        {
+            mReader.produce();
+            return;
+        }
+        catch (const except::Exception& ex)
+        {
+            fail(ex);
+            return;
+        }
+        catch (const std::exception& ex)
+        {
+            message = ex.what();
+        }
+        catch (...)
+        {
+            message = "Unknown exception reading pulse block";
+        }
+        fail(except::Exception(Ctxt(message)));
+    }
+
+private:
+    void fail(const except::Exception& ex)
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mReader.mMutex);
+        mReader.mFailed = true;
+        mReader.mException = ex;
+        mReader.mStateChanged.broadcast();
+    }
+
+    PulseBlockReader& mReader;
+};
+
+PulseBlockReader::Block::Block() :
+    channel(0),
+    firstVector(0),
+    numVectors(0),
+    numSamples(0),
+    vbm(NULL),
+    data(NULL)
+{
+}
+
+PulseBlockReader::PulseBlockReader(CPHDReader& reader,
+                                   size_t channel,
+                                   size_t numVectorsPerBlock,
+                                   size_t numBlocksAhead,
+                                   size_t numThreads) :
+    mReader(reader),
+    mChannel(channel),
+    mNumVectors(reader.getNumVectors(channel)),
+    mNumSamples(reader.getNumSamples(channel)),
+    mNumVectorsPerBlock(numVectorsPerBlock),
+    mNumBlocks(numVectorsPerBlock == 0 ? 0 :
+            (mNumVectors + numVectorsPerBlock - 1) / numVectorsPerBlock),
+    mNumThreads(numThreads),
+    mAdviceFD(-1),
+    mCurrent(NULL),
+    mNumReturned(0),
+    mStateChanged(&mMutex),
+    mStop(false),
+    mFailed(false)
+{
+    if (numVectorsPerBlock == 0)
+    {
+        throw except::Exception(Ctxt("Need at least one vector per block"));
+    }
+
+    // One slot for the block the caller has plus one per block ahead
+    const size_t numSlots = std::min(numBlocksAhead + 1, mNumBlocks);
+    const size_t numPixels =
+            std::min(mNumVectorsPerBlock, mNumVectors) * mNumSamples;
+    mSlots.resize(numSlots);
+    for (size_t ii = 0; ii < mSlots.size(); ++ii)
+    {
+        mSlots[ii].data.resize(numPixels);
+        mSlots[ii].scratch.resize(numPixels * reader.getNumBytesPerSample());
+        mSlots[ii].scaleFactors.reserve(mNumVectorsPerBlock);
+        mFree.push_back(&mSlots[ii]);
+    }
+
+#ifdef POSIX_FADV_WILLNEED
+    // The hints go through a descriptor of our own.  WILLNEED populates the
+    // page cache, which is shared with the reader's stream.
+    if (!reader.getPathname().empty())
+    {
+        mAdviceFD = ::open(reader.getPathname().c_str(), O_RDONLY);
+    }
+#endif
+
+    if (mNumBlocks > 0)
+    {
+        mThread.reset(new mt::ThreadGroup());
+        mThread->createThread(new ProducerRunnable(*this));
+    }
+}
+
+PulseBlockReader::~PulseBlockReader()
+{
+    try
+    {
+        stop();
+    }
+    catch (...)
+    {
+    }
+
+#ifndef WIN32
+    if (mAdviceFD >= 0)
+    {
+        ::close(mAdviceFD);
+    }
+#endif
+}
+
+void PulseBlockReader::stop()
+{
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mStop = true;
+        mStateChanged.broadcast();
+    }
+
+    if (mThread.get())
+    {
+        mThread->joinAll();
+        mThread.reset();
+    }
+}
+
+bool PulseBlockReader::next(Block& block)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+
+    // The caller is done with the last block we gave them
+    if (mCurrent)
+    {
+        mFree.push_back(mCurrent);
+        mCurrent = NULL;
+        mStateChanged.broadcast();
+    }
+
+    if (mNumReturned == mNumBlocks)
+    {
+        return false;
+    }
+
+    while (mReady.empty() && !mFailed)
+    {
+        mStateChanged.wait();
+    }
+
+    // Blocks read before a failure are still handed out first
+    if (mReady.empty())
+    {
+        throw mException;
+    }
+
+    mCurrent = mReady.front();
+    mReady.pop_front();
+    ++mNumReturned;
+
+    block = mCurrent->block;
+    return true;
+}
+
+void PulseBlockReader::produce()
+{
+    for (size_t blockNum = 0; blockNum < mNumBlocks; ++blockNum)
+    {
+        Slot* slot;
+        {
+            mt::CriticalSection<sys::Mutex> lock(&mMutex);
+            while (mFree.empty() && !mStop)
+            {
+                mStateChanged.wait();
+            }
+
+            if (mStop)
+            {
+                return;
+            }
+
+            slot = mFree.front();
+            mFree.pop_front();
+        }
+
+        // Get the OS started on the next block while we read this one
+        adviseWillNeed(blockNum + 1);
+        readBlock(blockNum, *slot);
+
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mReady.push_back(slot);
+        mStateChanged.broadcast();
+    }
+}
+
+void PulseBlockReader::readBlock(size_t blockNum, Slot& slot)
+{
+    const size_t firstVector = blockNum * mNumVectorsPerBlock;
+    const size_t numVectors =
+            std::min(mNumVectorsPerBlock, mNumVectors - firstVector);
+
+    const VBM& vbm = mReader.getVBM();
+    slot.scaleFactors.assign(numVectors, 1.0);
+    if (vbm.haveAmpSF())
+    {
+        for (size_t ii = 0; ii < numVectors; ++ii)
+        {
+            slot.scaleFactors[ii] = vbm.getAmpSF(mChannel, firstVector + ii);
+        }
+    }
+
+    mReader.getWideband().read(
+            mChannel,
+            firstVector,
+            firstVector + numVectors - 1,
+            0,
+            Wideband::ALL,
+            slot.scaleFactors,
+            mNumThreads,
+            mem::BufferView<sys::ubyte>(&slot.scratch[0],
+                                        slot.scratch.size()),
+            mem::BufferView<std::complex<float> >(&slot.data[0],
+                                                  slot.data.size()));
+
+    slot.block.channel = mChannel;
+    slot.block.firstVector = firstVector;
+    slot.block.numVectors = numVectors;
+    slot.block.numSamples = mNumSamples;
+    slot.block.vbm = &vbm;
+    slot.block.data = &slot.data[0];
+}
+
+void PulseBlockReader::adviseWillNeed(size_t blockNum)
+{
+#ifdef POSIX_FADV_WILLNEED
+    if (mAdviceFD < 0 || blockNum >= mNumBlocks)
+    {
+        return;
+    }
+
+    const size_t firstVector = blockNum * mNumVectorsPerBlock;
+    const size_t numVectors =
+            std::min(mNumVectorsPerBlock, mNumVectors - firstVector);
+    const sys::Off_T offset =
+            mReader.getFileOffset(mChannel, firstVector, 0);
+    const sys::Off_T length = static_cast<sys::Off_T>(numVectors) *
+            mNumSamples * mReader.getNumBytesPerSample();
+
+    // This is only a hint, so failures don't matter
+    ::posix_fadvise(mAdviceFD, offset, length, POSIX_FADV_WILLNEED);
+#else
+    (void)blockNum;
+#endif
+}
+}
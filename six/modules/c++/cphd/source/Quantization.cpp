@@ -0,0 +1,286 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CPHD_QUANTIZE_SSE2
+#endif
+
+#include <except/Exception.h>
+#include <mt/ThreadPlanner.h>
+#include <str/Convert.h>
+#include <tasks/TaskScheduler.h>
+#include <cphd/Quantization.h>
+
+namespace
+{
+// Finds the largest magnitude of any component.  std::max doesn't
+// vectorize on its own since the compiler has to keep its NaN ordering, so
+// this keeps separate running maxima (eight with SSE2, four without) and
+// combines them at the end.  A component is finite exactly when its
+// magnitude compares <= the largest float, which is false for NaN, so that
+// check rides along.
+//
+// \return False if any component is NaN or infinite
+bool getMaxAbs(const float* input, size_t numComponents, float& maxAbs)
+{
+    const float maxFinite = std::numeric_limits<float>::max();
+    float lanes[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    bool allFinite = true;
+    size_t ii = 0;
+
+#ifdef CPHD_QUANTIZE_SSE2
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 maxFiniteVec = _mm_set1_ps(maxFinite);
+    __m128 max0 = _mm_setzero_ps();
+    __m128 max1 = _mm_setzero_ps();
+    __m128 finite = _mm_cmpeq_ps(max0, max0);
+    for (; ii + 8 <= numComponents; ii += 8)
+    {
+        const __m128 abs0 = _mm_andnot_ps(signMask, _mm_loadu_ps(input + ii));
+        const __m128 abs1 =
+                _mm_andnot_ps(signMask, _mm_loadu_ps(input + ii + 4));
+        max0 = _mm_max_ps(max0, abs0);
+        max1 = _mm_max_ps(max1, abs1);
+        finite = _mm_and_ps(finite,
+                            _mm_and_ps(_mm_cmple_ps(abs0, maxFiniteVec),
+                                       _mm_cmple_ps(abs1, maxFiniteVec)));
+    }
+    _mm_storeu_ps(lanes, _mm_max_ps(max0, max1));
+    allFinite = (_mm_movemask_ps(finite) == 0xF);
+#else
+    for (; ii + 4 <= numComponents; ii += 4)
+    {
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            const float value = std::abs(input[ii + lane]);
+            allFinite &= (value <= maxFinite);
+            lanes[lane] = (value > lanes[lane]) ? value : lanes[lane];
+        }
+    }
+#endif
+
+    for (; ii < numComponents; ++ii)
+    {
+        const float value = std::abs(input[ii]);
+        allFinite &= (value <= maxFinite);
+        lanes[0] = (value > lanes[0]) ? value : lanes[0];
+    }
+
+    maxAbs = std::max(std::max(lanes[0], lanes[1]),
+                      std::max(lanes[2], lanes[3]));
+    return allFinite;
+}
+
+template <typename OutT>
+class QuantizeRunnable : public sys::Runnable
+{
+public:
+    QuantizeRunnable(const std::complex<float>* input,
+                     size_t startRow,
+                     size_t numRows,
+                     size_t numCols,
+                     std::complex<OutT>* output,
+                     double* scaleFactors,
+                     cphd::QuantizationStatistics& stats) :
+        mInput(reinterpret_cast<const float*>(input + startRow * numCols)),
+        mStartRow(startRow),
+        mDims(numRows, numCols),
+        mOutput(reinterpret_cast<OutT*>(output + startRow * numCols)),
+        mScaleFactors(scaleFactors + startRow),
+        mStats(stats)
+    {
+    }
+
+    virtual void run()
+    {
+        // Real and imaginary parts are treated alike, so the rows are
+        // walked as flat arrays of components to keep the loops simple
+        // enough for the compiler to vectorize
+        const size_t numComponents = mDims.col * 2;
+        const float maxValue =
+                static_cast<float>(std::numeric_limits<OutT>::max());
+        const double maxFloat = std::numeric_limits<float>::max();
+
+        for (size_t row = 0; row < mDims.row; ++row)
+        {
+            const float* const input = mInput + row * numComponents;
+            OutT* const output = mOutput + row * numComponents;
+
+            float maxAbs;
+            if (!getMaxAbs(input, numComponents, maxAbs))
+            {
+                throw except::Exception(Ctxt(
+                        "Can't quantize vector " +
+                        str::toString(mStartRow + row) +
+                        ": it has a NaN or infinite sample"));
+            }
+
+            // If the vector is so small that 1 / scale would overflow a
+            // float, use the smallest scale whose inverse fits.  Its
+            // samples then all quantize to less than maxValue.
+            const double scale = (maxAbs > 0.0f) ?
+                    std::max<double>(maxAbs / maxValue, 1.0 / maxFloat) : 1.0;
+            mScaleFactors[row] = scale;
+
+            // The largest component lands within rounding of maxValue, so
+            // nothing can overflow
+            const float invScale = static_cast<float>(1.0 / scale);
+            for (size_t ii = 0; ii < numComponents; ++ii)
+            {
+                const float value = input[ii] * invScale;
+                output[ii] = static_cast<OutT>(
+                        (value < 0.0f) ? value - 0.5f : value + 0.5f);
+            }
+
+            double signalPower = 0.0;
+            double errorPower = 0.0;
+            double maxError = 0.0;
+            for (size_t ii = 0; ii < numComponents; ++ii)
+            {
+                const double error = input[ii] - output[ii] * scale;
+                signalPower += static_cast<double>(input[ii]) * input[ii];
+                errorPower += error * error;
+                maxError = std::max(maxError, std::abs(error));
+            }
+
+            mStats.numSamples += mDims.col;
+            mStats.signalPower += signalPower;
+            mStats.errorPower += errorPower;
+            mStats.maxError = std::max(mStats.maxError, maxError);
+        }
+    }
+
+private:
+    const float* const mInput;
+    const size_t mStartRow;
+    const types::RowCol<size_t> mDims;
+    OutT* const mOutput;
+    double* const mScaleFactors;
+    cphd::QuantizationStatistics& mStats;
+};
+
+template <typename OutT>
+void quantizeImpl(const std::complex<float>* input,
+                  const types::RowCol<size_t>& dims,
+                  size_t numThreads,
+                  std::complex<OutT>* output,
+                  double* scaleFactors,
+                  cphd::QuantizationStatistics& stats)
+{
+    stats = cphd::QuantizationStatistics();
+    if (numThreads <= 1)
+    {
+        QuantizeRunnable<OutT>(input, 0, dims.row, dims.col, output,
+                               scaleFactors, stats).run();
+        return;
+    }
+
+    const mt::ThreadPlanner planner(dims.row, numThreads);
+    std::vector<cphd::QuantizationStatistics> threadStats(numThreads);
+
+    tasks::TaskGroup threads("cphd.quantize");
+    size_t threadNum(0);
+    size_t startRow(0);
+    size_t numRowsThisThread(0);
+    while (planner.getThreadInfo(threadNum,
+                                 startRow,
+                                 numRowsThisThread))
+    {
+        std::auto_ptr<sys::Runnable> quantizer(new QuantizeRunnable<OutT>(
+                input,
+                startRow,
+                numRowsThisThread,
+                dims.col,
+                output,
+                scaleFactors,
+                threadStats[threadNum]));
+        threads.createTask(quantizer);
+        ++threadNum;
+    }
+    threads.wait();
+
+    for (size_t ii = 0; ii < threadStats.size(); ++ii)
+    {
+        stats.add(threadStats[ii]);
+    }
+}
+}
+
+namespace cphd
+{
+QuantizationStatistics::QuantizationStatistics() :
+    numSamples(0),
+    signalPower(0.0),
+    errorPower(0.0),
+    maxError(0.0)
+{
+}
+
+void QuantizationStatistics::add(const QuantizationStatistics& other)
+{
+    numSamples += other.numSamples;
+    signalPower += other.signalPower;
+    errorPower += other.errorPower;
+    maxError = std::max(maxError, other.maxError);
+}
+
+double QuantizationStatistics::getSQNR() const
+{
+    if (errorPower == 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return 10.0 * std::log10(signalPower / errorPower);
+}
+
+double QuantizationStatistics::getRMSError() const
+{
+    return (numSamples == 0) ? 0.0 : std::sqrt(errorPower / numSamples);
+}
+
+void quantize(const std::complex<float>* input,
+              const types::RowCol<size_t>& dims,
+              size_t numThreads,
+              std::complex<sys::Int8_T>* output,
+              double* scaleFactors,
+              QuantizationStatistics& stats)
+{
+    quantizeImpl(input, dims, numThreads, output, scaleFactors, stats);
+}
+
+void quantize(const std::complex<float>* input,
+              const types::RowCol<size_t>& dims,
+              size_t numThreads,
+              std::complex<sys::Int16_T>* output,
+              double* scaleFactors,
+              QuantizationStatistics& stats)
+{
+    quantizeImpl(input, dims, numThreads, output, scaleFactors, stats);
+}
+}
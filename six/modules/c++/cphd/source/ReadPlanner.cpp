@@ -0,0 +1,333 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef WIN32
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#define CPHD_HAVE_PREADV
+#endif
+#endif
+
+#include <except/Exception.h>
+#include <sys/Err.h>
+#include <tasks/TaskScheduler.h>
+#include <cphd/ReadPlanner.h>
+
+namespace
+{
+#ifndef WIN32
+void preadFully(int fd, void* buffer, size_t numBytes, sys::Off_T offset)
+{
+    sys::ubyte* ptr = static_cast<sys::ubyte*>(buffer);
+    while (numBytes > 0)
+    {
+        const ssize_t numRead = ::pread(fd, ptr, numBytes, offset);
+        if (numRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw except::IOException(Ctxt(
+                    "Positional read failed: " + sys::Err().toString()));
+        }
+        if (numRead == 0)
+        {
+            throw except::IOException(Ctxt("Unexpected end of file"));
+        }
+
+        ptr += numRead;
+        numBytes -= numRead;
+        offset += numRead;
+    }
+}
+#endif
+
+#ifdef CPHD_HAVE_PREADV
+#ifdef IOV_MAX
+const size_t MAX_IOVECS = IOV_MAX;
+#else
+const size_t MAX_IOVECS = 1024;
+#endif
+
+// Modifies iov as it goes to pick up after short reads
+void preadvFully(int fd, std::vector<iovec>& iov, sys::Off_T offset)
+{
+    size_t first = 0;
+    while (first < iov.size())
+    {
+        const int count =
+                static_cast<int>(std::min(iov.size() - first, MAX_IOVECS));
+        const ssize_t numRead = ::preadv(fd, &iov[first], count, offset);
+        if (numRead < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw except::IOException(Ctxt(
+                    "Positional read failed: " + sys::Err().toString()));
+        }
+        if (numRead == 0)
+        {
+            throw except::IOException(Ctxt("Unexpected end of file"));
+        }
+
+        offset += numRead;
+        size_t remaining = static_cast<size_t>(numRead);
+        while (first < iov.size() && remaining >= iov[first].iov_len)
+        {
+            remaining -= iov[first].iov_len;
+            ++first;
+        }
+        if (remaining > 0)
+        {
+            iov[first].iov_base =
+                    static_cast<sys::ubyte*>(iov[first].iov_base) + remaining;
+            iov[first].iov_len -= remaining;
+        }
+    }
+}
+#endif
+}
+
+namespace cphd
+{
+const size_t ReadPlanner::DEFAULT_MAX_GAP_BYTES = 64 * 1024;
+const size_t ReadPlanner::DEFAULT_MAX_SPAN_BYTES = 16 * 1024 * 1024;
+
+#ifndef WIN32
+class ReadPlanner::SpanReader
+{
+public:
+    SpanReader(const ReadPlanner& planner, sys::File& file) :
+        mPlanner(planner),
+        mFile(file)
+    {
+    }
+
+    void operator()(size_t spanNum) const
+    {
+        const Span& span(mPlanner.mSpans[spanNum]);
+        const int fd = mFile.getHandle();
+        if (span.numFragments == 1)
+        {
+            const Fragment& fragment(mPlanner.mFragments[span.firstFragment]);
+            preadFully(fd, fragment.dest, fragment.numBytes, fragment.offset);
+            return;
+        }
+
+#ifdef CPHD_HAVE_PREADV
+        // Scatter each fragment straight to where it goes.  The gaps all
+        // land in one buffer that gets thrown away.
+        size_t maxGap = 0;
+        const size_t end = span.firstFragment + span.numFragments;
+        for (size_t ii = span.firstFragment + 1; ii < end; ++ii)
+        {
+            const Fragment& previous(mPlanner.mFragments[ii - 1]);
+            const size_t gap = static_cast<size_t>(
+                    mPlanner.mFragments[ii].offset -
+                    (previous.offset + previous.numBytes));
+            maxGap = std::max(maxGap, gap);
+        }
+        std::vector<sys::ubyte> discard(maxGap);
+
+        std::vector<iovec> iov;
+        iov.reserve(span.numFragments * 2);
+        for (size_t ii = span.firstFragment; ii < end; ++ii)
+        {
+            const Fragment& fragment(mPlanner.mFragments[ii]);
+            if (ii > span.firstFragment)
+            {
+                const Fragment& previous(mPlanner.mFragments[ii - 1]);
+                const size_t gap = static_cast<size_t>(
+                        fragment.offset -
+                        (previous.offset + previous.numBytes));
+                if (gap > 0)
+                {
+                    iovec gapVec;
+                    gapVec.iov_base = &discard[0];
+                    gapVec.iov_len = gap;
+                    iov.push_back(gapVec);
+                }
+            }
+
+            iovec fragmentVec;
+            fragmentVec.iov_base = fragment.dest;
+            fragmentVec.iov_len = fragment.numBytes;
+            iov.push_back(fragmentVec);
+        }
+        preadvFully(fd, iov, span.offset);
+#else
+        std::vector<sys::ubyte> buffer(span.numBytes);
+        preadFully(fd, &buffer[0], span.numBytes, span.offset);
+        mPlanner.scatter(span, &buffer[0]);
+#endif
+    }
+
+private:
+    const ReadPlanner& mPlanner;
+    sys::File& mFile;
+};
+#endif
+
+ReadPlanner::ReadPlanner(size_t maxGapBytes, size_t maxSpanBytes) :
+    mMaxGapBytes(maxGapBytes),
+    mMaxSpanBytes(maxSpanBytes),
+    mPlanned(true)
+{
+}
+
+void ReadPlanner::add(sys::Off_T offset, size_t numBytes, void* dest)
+{
+    if (numBytes == 0)
+    {
+        return;
+    }
+
+    Fragment fragment;
+    fragment.offset = offset;
+    fragment.numBytes = numBytes;
+    fragment.dest = static_cast<sys::ubyte*>(dest);
+    mFragments.push_back(fragment);
+    mPlanned = false;
+}
+
+void ReadPlanner::clear()
+{
+    mFragments.clear();
+    mSpans.clear();
+    mPlanned = true;
+}
+
+const std::vector<ReadPlanner::Span>& ReadPlanner::plan()
+{
+    if (mPlanned)
+    {
+        return mSpans;
+    }
+
+    std::sort(mFragments.begin(), mFragments.end());
+
+    mSpans.clear();
+    for (size_t ii = 0; ii < mFragments.size(); ++ii)
+    {
+        const Fragment& fragment(mFragments[ii]);
+        if (!mSpans.empty())
+        {
+            Span& span(mSpans.back());
+            const sys::Off_T spanEnd = span.offset + span.numBytes;
+            const sys::Off_T fragmentEnd = fragment.offset + fragment.numBytes;
+            if (fragment.offset >= spanEnd &&
+                static_cast<size_t>(fragment.offset - spanEnd) <=
+                        mMaxGapBytes &&
+                static_cast<size_t>(fragmentEnd - span.offset) <=
+                        mMaxSpanBytes)
+            {
+                span.numBytes = static_cast<size_t>(fragmentEnd - span.offset);
+                ++span.numFragments;
+                continue;
+            }
+        }
+
+        Span span;
+        span.offset = fragment.offset;
+        span.numBytes = fragment.numBytes;
+        span.firstFragment = ii;
+        span.numFragments = 1;
+        mSpans.push_back(span);
+    }
+
+    mPlanned = true;
+    return mSpans;
+}
+
+void ReadPlanner::read(sys::File& file, size_t numThreads)
+{
+    plan();
+
+#ifndef WIN32
+    tasks::parallelFor(mSpans.size(), numThreads, SpanReader(*this, file),
+                       "cphd.ReadPlanner.read");
+#else
+    // Windows has positional reads, but not through sys::File, so seek
+    (void)numThreads;
+    std::vector<sys::ubyte> buffer;
+    for (size_t ii = 0; ii < mSpans.size(); ++ii)
+    {
+        const Span& span(mSpans[ii]);
+        file.seekTo(span.offset, sys::File::FROM_START);
+        if (span.numFragments == 1)
+        {
+            file.readInto(mFragments[span.firstFragment].dest, span.numBytes);
+        }
+        else
+        {
+            buffer.resize(span.numBytes);
+            file.readInto(&buffer[0], span.numBytes);
+            scatter(span, &buffer[0]);
+        }
+    }
+#endif
+}
+
+void ReadPlanner::read(io::SeekableInputStream& inStream)
+{
+    plan();
+
+    std::vector<sys::ubyte> buffer;
+    for (size_t ii = 0; ii < mSpans.size(); ++ii)
+    {
+        const Span& span(mSpans[ii]);
+        inStream.seek(span.offset, io::Seekable::START);
+        if (span.numFragments == 1)
+        {
+            inStream.read(mFragments[span.firstFragment].dest, span.numBytes);
+        }
+        else
+        {
+            buffer.resize(span.numBytes);
+            inStream.read(&buffer[0], span.numBytes);
+            scatter(span, &buffer[0]);
+        }
+    }
+}
+
+void ReadPlanner::scatter(const Span& span, const sys::ubyte* buffer) const
+{
+    const size_t end = span.firstFragment + span.numFragments;
+    for (size_t ii = span.firstFragment; ii < end; ++ii)
+    {
+        const Fragment& fragment(mFragments[ii]);
+        std::memcpy(fragment.dest,
+                    buffer + (fragment.offset - span.offset),
+                    fragment.numBytes);
+    }
+}
+}
@@ -24,6 +24,7 @@
 #include <string.h>
 
 #include <six/Init.h>
+#include <six/Instrumentation.h>
 #include <cphd/ByteSwap.h>
 #include <cphd/VBM.h>
 
@@ -757,7 +758,13 @@ sys::Off_T VBM::load(io::SeekableInputStream& inStream,
         if (!data.empty())
         {
             sys::byte* const buf = reinterpret_cast<sys::byte*>(&data[0]);
-            sys::SSize_T bytesThisRead = inStream.read(buf, data.size());
+            sys::SSize_T bytesThisRead;
+            {
+                six::ScopedStageTimer timer("cphd.VBM.load.io");
+                bytesThisRead = inStream.read(buf, data.size());
+                timer.addBytes(data.size());
+                timer.addRows(mData[ii].size());
+            }
             if (bytesThisRead == io::InputStream::IS_EOF)
             {
                 std::ostringstream oss;
@@ -770,6 +777,8 @@ sys::Off_T VBM::load(io::SeekableInputStream& inStream,
             // necessary
             if (swapToLittleEndian)
             {
+                six::ScopedStageTimer timer("cphd.VBM.load.byteSwap");
+                timer.addBytes(data.size());
                 byteSwap(buf,
                          sizeof(double),
                          data.size() / sizeof(double),
@@ -20,15 +20,19 @@
  *
  */
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 
 #include <sys/Conf.h>
-#include <mt/ThreadGroup.h>
+#include <mt/CriticalSection.h>
 #include <mt/ThreadPlanner.h>
+#include <tasks/TaskScheduler.h>
 #include <except/Exception.h>
 #include <io/FileInputStream.h>
+#include <six/Instrumentation.h>
 #include <cphd/ByteSwap.h>
+#include <cphd/ReadPlanner.h>
 #include <cphd/Utilities.h>
 #include <cphd/Wideband.h>
 
@@ -119,7 +123,7 @@ void promote(const void* input,
     }
     else
     {
-        mt::ThreadGroup threads;
+        tasks::TaskGroup threads;
         const mt::ThreadPlanner planner(dims.row, numThreads);
 
         size_t threadNum(0);
@@ -135,10 +139,10 @@ void promote(const void* input,
                     numRowsThisThread,
                     dims.col,
                     output));
-            threads.createThread(scaler);
+            threads.createTask(scaler);
         }
 
-        threads.joinAll();
+        threads.wait();
 
     }
 }
@@ -179,7 +183,7 @@ void scale(const void* input,
     }
     else
     {
-        mt::ThreadGroup threads;
+        tasks::TaskGroup threads;
         const mt::ThreadPlanner planner(dims.row, numThreads);
 
         size_t threadNum(0);
@@ -196,10 +200,10 @@ void scale(const void* input,
                     dims.col,
                     scaleFactors,
                     output));
-            threads.createThread(scaler);
+            threads.createTask(scaler);
         }
 
-        threads.joinAll();
+        threads.wait();
     }
 }
 
@@ -241,8 +245,12 @@ Wideband::Wideband(const std::string& pathname,
     mWBOffset(startWB),
     mWBSize(sizeWB),
     mElementSize(getNumBytesPerSample(mData.sampleType)),
-    mOffsets(mData.getNumChannels())
+    mOffsets(mData.getNumChannels()),
+    mMaxGapBytes(ReadPlanner::DEFAULT_MAX_GAP_BYTES)
 {
+#ifndef WIN32
+    mFile.reset(new sys::File(pathname));
+#endif
     initialize();
 }
 
@@ -255,7 +263,8 @@ Wideband::Wideband(mem::SharedPtr<io::SeekableInputStream> inStream,
     mWBOffset(startWB),
     mWBSize(sizeWB),
     mElementSize(getNumBytesPerSample(mData.sampleType)),
-    mOffsets(mData.getNumChannels())
+    mOffsets(mData.getNumChannels()),
+    mMaxGapBytes(ReadPlanner::DEFAULT_MAX_GAP_BYTES)
 {
     initialize();
 }
@@ -349,12 +358,17 @@ void Wideband::readImpl(size_t channel,
                         size_t lastVector,
                         size_t firstSample,
                         size_t lastSample,
+                        size_t numThreads,
                         void* data)
 {
     types::RowCol<size_t> dims;
     checkReadInputs(channel, firstVector, lastVector, firstSample, lastSample,
                     dims);
 
+    six::ScopedStageTimer timer("cphd.Wideband.read.io");
+    timer.addBytes(dims.row * dims.col * mElementSize);
+    timer.addRows(dims.row);
+
     // Compute the byte offset into this channel's wideband in the CPHD file
     // First to the start of the first pulse we're going to read
     sys::Off_T inOffset = getFileOffset(channel, firstVector, firstSample);
@@ -362,26 +376,68 @@ void Wideband::readImpl(size_t channel,
     sys::byte* dataPtr = static_cast<sys::byte*>(data);
     if (dims.col == mData.getNumSamples(channel))
     {
-        // Life is easy - can do a single seek and read
-        mInStream->seek(inOffset, io::FileInputStream::START);
-        mInStream->read(dataPtr, dims.row * dims.col * mElementSize);
+        // Life is easy - it's all one piece of the file
+        readContiguous(inOffset, dims.row * dims.col * mElementSize,
+                       numThreads, dataPtr);
     }
     else
     {
-        // We're stuck reading a row at a time since we're only reading some
-        // of the columns
+        // Each vector is its own piece of the file, so let the planner
+        // merge them into as few reads as it can
         const size_t bytesPerVectorAOI = dims.col * mElementSize;
         const size_t bytesPerVectorFile =
                     mData.getNumSamples(channel) * mElementSize;
 
+        ReadPlanner planner(mMaxGapBytes);
         for (size_t row = 0; row < dims.row; ++row)
         {
-            mInStream->seek(inOffset, io::FileInputStream::START);
-            mInStream->read(dataPtr, bytesPerVectorAOI);
+            planner.add(inOffset, bytesPerVectorAOI, dataPtr);
             dataPtr += bytesPerVectorAOI;
             inOffset += bytesPerVectorFile;
         }
+
+        if (mFile.get())
+        {
+            planner.read(*mFile, numThreads);
+        }
+        else
+        {
+            mt::CriticalSection<sys::Mutex> lock(&mStreamMutex);
+            planner.read(*mInStream);
+        }
+    }
+}
+
+void Wideband::readContiguous(sys::Off_T offset,
+                              size_t numBytes,
+                              size_t numThreads,
+                              void* data)
+{
+    if (!mFile.get())
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mStreamMutex);
+        mInStream->seek(offset, io::FileInputStream::START);
+        mInStream->read(static_cast<sys::byte*>(data), numBytes);
+        return;
     }
+
+    // Split it up so the pieces can be read in parallel, but not so finely
+    // that the system calls start to cost more than the copies
+    const size_t minChunkBytes = 1024 * 1024;
+    const size_t numChunks = std::max<size_t>(numThreads, 1);
+    const size_t chunkBytes =
+            std::max((numBytes + numChunks - 1) / numChunks, minChunkBytes);
+
+    ReadPlanner planner(0, chunkBytes);
+    sys::ubyte* dataPtr = static_cast<sys::ubyte*>(data);
+    for (size_t chunkOffset = 0; chunkOffset < numBytes;
+         chunkOffset += chunkBytes)
+    {
+        planner.add(offset + chunkOffset,
+                    std::min(chunkBytes, numBytes - chunkOffset),
+                    dataPtr + chunkOffset);
+    }
+    planner.read(*mFile, numThreads);
 }
 
 void Wideband::read(size_t channel,
@@ -409,12 +465,14 @@ void Wideband::read(size_t channel,
 
     // Perform the read
     readImpl(channel, firstVector, lastVector, firstSample, lastSample,
-             data.data);
+             numThreads, data.data);
 
     // Byte swap to little endian if necessary
     // Element size is half mElementSize because it's complex
     if (!sys::isBigEndianSystem() && mElementSize > 2)
     {
+        six::ScopedStageTimer timer("cphd.Wideband.read.byteSwap");
+        timer.addBytes(numPixels * mElementSize);
         byteSwap(data.data, mElementSize / 2, numPixels * 2, numThreads);
     }
 }
@@ -509,7 +567,10 @@ void Wideband::read(size_t channel,
 
         // Perform the read into the scratch buffer
         readImpl(channel, firstVector, lastVector, firstSample, lastSample,
-                 scratch.data);
+                 numThreads, scratch.data);
+
+        six::ScopedStageTimer timer("cphd.Wideband.read.convert");
+        timer.addBytes(numPixels * mElementSize);
 
         // Byte swap to little endian if necessary
         if (!sys::isBigEndianSystem() && mElementSize > 2)
@@ -530,8 +591,10 @@ void Wideband::read(size_t channel,
     {
         // Perform the read into the scratch buffer
         readImpl(channel, firstVector, lastVector, firstSample, lastSample,
-                 scratch.data);
+                 numThreads, scratch.data);
 
+        six::ScopedStageTimer timer("cphd.Wideband.read.convert");
+        timer.addBytes(numPixels * mElementSize);
         if (!sys::isBigEndianSystem() && mElementSize > 2)
         {
             byteSwapAndPromote(scratch.data, mElementSize, dims, numThreads,
@@ -546,12 +609,14 @@ void Wideband::read(size_t channel,
     {
         // Perform the read directly into the output buffer
         readImpl(channel, firstVector, lastVector, firstSample, lastSample,
-                 data.data);
+                 numThreads, data.data);
 
         // Byte swap to little endian if necessary
         // Element size is half mElementSize because it's complex
         if (!sys::isBigEndianSystem() && mElementSize > 2)
         {
+            six::ScopedStageTimer timer("cphd.Wideband.read.byteSwap");
+            timer.addBytes(numPixels * mElementSize);
             byteSwap(data.data, mElementSize / 2, numPixels * 2, numThreads);
         }
     }
@@ -0,0 +1,191 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times reading a window of samples out of every vector of a channel, for a
+// few window widths: a seek and read per vector (what Wideband used to do),
+// then Wideband through a stream and through a pathname with and without
+// merging reads across gaps.  The file is written first, so it's read from
+// the page cache; this measures system call overhead, not the disk.
+// Usage: benchmark_partial_read [vectors] [samples] [threads]
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <io/FileInputStream.h>
+#include <io/TempFile.h>
+#include <mem/SharedPtr.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/ReadPlanner.h>
+
+namespace
+{
+void printResult(const std::string& name, size_t numBytes, double elapsedMS)
+{
+    std::cout << "  " << std::left << std::setw(34) << name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(10)
+              << elapsedMS << " ms" << std::setw(10)
+              << numBytes / (elapsedMS * 1000) << " MB/s\n";
+}
+
+void writeCPHD(const std::string& pathname, const types::RowCol<size_t>& dims)
+{
+    // 8-bit samples don't need byte swapping, so the reads are all I/O
+    std::vector<std::complex<sys::Int8_T> > data(dims.area());
+    for (size_t ii = 0; ii < data.size(); ++ii)
+    {
+        data[ii] = std::complex<sys::Int8_T>(
+                static_cast<sys::Int8_T>(ii), static_cast<sys::Int8_T>(ii));
+    }
+
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = 1;
+    metadata.data.arraySize.push_back(cphd::ArraySize(dims.row, dims.col));
+    metadata.data.sampleType = cphd::SampleType::RE08I_IM08I;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    const cphd::VBM vbm(1, std::vector<size_t>(1, dims.row), false, false,
+                        false, metadata.global.domainType);
+
+    cphd::CPHDWriter writer(metadata, 1);
+    writer.writeMetadata(pathname, vbm);
+    writer.writeCPHDData(&data[0], dims.area());
+}
+
+void readPerVector(cphd::CPHDReader& reader,
+                   const std::string& pathname,
+                   size_t firstSample,
+                   size_t numSamples,
+                   std::vector<sys::ubyte>& output)
+{
+    io::FileInputStream inStream(pathname);
+    const size_t numVectors = reader.getNumVectors(0);
+    const size_t elementSize = reader.getNumBytesPerSample();
+    sys::ubyte* dest = &output[0];
+    for (size_t vector = 0; vector < numVectors; ++vector)
+    {
+        inStream.seek(reader.getFileOffset(0, vector, firstSample),
+                      io::Seekable::START);
+        inStream.read(dest, numSamples * elementSize);
+        dest += numSamples * elementSize;
+    }
+}
+
+void readWideband(cphd::Wideband& wideband,
+                  size_t maxGapBytes,
+                  size_t firstSample,
+                  size_t numSamples,
+                  size_t numThreads,
+                  std::vector<sys::ubyte>& output)
+{
+    wideband.setMaxGapBytes(maxGapBytes);
+    wideband.read(0, 0, cphd::Wideband::ALL,
+                  firstSample, firstSample + numSamples - 1, numThreads,
+                  mem::BufferView<sys::ubyte>(&output[0], output.size()));
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numVectors = (argc > 1) ? ::atoi(argv[1]) : 20000;
+        const size_t numSamples = (argc > 2) ? ::atoi(argv[2]) : 1024;
+        const size_t numThreads = (argc > 3) ? ::atoi(argv[3]) : 0;
+        const types::RowCol<size_t> dims(numVectors, numSamples);
+
+        io::TempFile tempfile;
+        writeCPHD(tempfile.pathname(), dims);
+
+        cphd::CPHDReader pathReader(tempfile.pathname(), 1);
+        cphd::CPHDReader streamReader(mem::SharedPtr<io::SeekableInputStream>(
+                new io::FileInputStream(tempfile.pathname())), 1);
+        const size_t elementSize = pathReader.getNumBytesPerSample();
+
+        std::cout << numVectors << " vectors x " << numSamples
+                  << " samples\n";
+
+        const size_t widths[] = {8, 32, 128, 512};
+        for (size_t ii = 0; ii < sizeof(widths) / sizeof(widths[0]); ++ii)
+        {
+            const size_t width = std::min(widths[ii], numSamples);
+            const size_t firstSample = (numSamples - width) / 2;
+            const size_t numBytes = numVectors * width * elementSize;
+            std::vector<sys::ubyte> output(numBytes);
+
+            std::cout << "\n" << width << " sample window\n";
+
+            sys::RealTimeStopWatch perVectorWatch;
+            perVectorWatch.start();
+            readPerVector(pathReader, tempfile.pathname(), firstSample, width,
+                          output);
+            printResult("seek + read per vector", numBytes,
+                        perVectorWatch.stop());
+
+            sys::RealTimeStopWatch streamWatch;
+            streamWatch.start();
+            readWideband(streamReader.getWideband(),
+                         cphd::ReadPlanner::DEFAULT_MAX_GAP_BYTES,
+                         firstSample, width, 1, output);
+            printResult("stream, merged", numBytes, streamWatch.stop());
+
+            sys::RealTimeStopWatch unmergedWatch;
+            unmergedWatch.start();
+            readWideband(pathReader.getWideband(), 0, firstSample, width,
+                         numThreads, output);
+            printResult("positional, unmerged", numBytes,
+                        unmergedWatch.stop());
+
+            sys::RealTimeStopWatch mergedWatch;
+            mergedWatch.start();
+            readWideband(pathReader.getWideband(),
+                         cphd::ReadPlanner::DEFAULT_MAX_GAP_BYTES,
+                         firstSample, width, numThreads, output);
+            printResult("positional, merged", numBytes, mergedWatch.stop());
+        }
+
+        return 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
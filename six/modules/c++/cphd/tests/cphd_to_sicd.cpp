@@ -0,0 +1,112 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Forms one channel of an FX domain CPHD into a SICD with PFAImageFormer and
+// reports how long each step took.  Everything in the SICD not derived from
+// the CPHD (collection information, etc.) is placeholder.
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <memory>
+
+#include <sys/OS.h>
+#include <sys/StopWatch.h>
+#include <cli/ArgumentParser.h>
+#include <six/sicd/Utilities.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/PFAImageFormer.h>
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        // Parse the command line
+        cli::ArgumentParser parser;
+        parser.setDescription("Form a SICD from a CPHD channel with PFA.");
+        parser.addArgument("-t --threads",
+                           "Specify the number of threads to use",
+                           cli::STORE,
+                           "threads",
+                           "NUM")->setDefault(sys::OS().getNumCPUs());
+        parser.addArgument("-c --channel", "0-based channel to form",
+                           cli::STORE, "channel", "NUM")->setDefault(0);
+        parser.addArgument("-s --schema",
+                           "Specify a schema or directory of schemas",
+                           cli::STORE)->setDefault("");
+        parser.addArgument("input", "Input pathname", cli::STORE, "input",
+                           "CPHD", 1, 1);
+        parser.addArgument("output", "Output pathname", cli::STORE, "output",
+                           "SICD", 1, 1);
+        const std::auto_ptr<cli::Results> options(parser.parse(argc, argv));
+        const std::string inPathname(options->get<std::string>("input"));
+        const std::string outPathname(options->get<std::string>("output"));
+        const size_t numThreads(options->get<size_t>("threads"));
+        const size_t channel(options->get<size_t>("channel"));
+        const std::string schema(options->get<std::string>("schema"));
+
+        std::vector<std::string> schemaPaths;
+        if (!schema.empty())
+        {
+            schemaPaths.push_back(schema);
+        }
+
+        cphd::CPHDReader reader(inPathname, numThreads);
+        cphd::PFAImageFormer former(reader, channel, numThreads);
+        std::cout << reader.getNumVectors(channel) << " vectors x "
+                  << reader.getNumSamples(channel) << " samples -> "
+                  << former.getDims().row << " x " << former.getDims().col
+                  << " image\n";
+
+        sys::RealTimeStopWatch formWatch;
+        formWatch.start();
+        former.form();
+        std::cout << "Formed in " << formWatch.stop() << " ms\n";
+
+        std::auto_ptr<six::sicd::ComplexData> data =
+                six::sicd::Utilities::createFakeComplexData();
+        former.populateComplexData(*data);
+
+        sys::RealTimeStopWatch writeWatch;
+        writeWatch.start();
+        former.write(*data, schemaPaths, outPathname);
+        std::cout << "Wrote " << outPathname << " in " << writeWatch.stop()
+                  << " ms\n";
+
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+        return 1;
+    }
+}
@@ -22,6 +22,8 @@
 
 #include <cphd/CPHDWriter.h>
 #include <cphd/CPHDReader.h>
+#include <io/FileInputStream.h>
+#include <io/FileOutputStream.h>
 #include <types/RowCol.h>
 
 #include "TestCase.h"
@@ -319,14 +321,9 @@ void addTwoWayParams(cphd::Metadata& metadata)
     }
 }
 
-void runCPHDTest(const std::string& testName,
-                 cphd::Metadata& metadata)
+void fillVBM(const cphd::Metadata& metadata, cphd::VBM& vbm)
 {
-    metadata.data.numCPHDChannels = NUM_IMAGES;
-    cphd::CPHDWriter writer(metadata, NUM_THREADS);
-
-    cphd::VBM vbm(metadata.data, metadata.vectorParameters);
-    for (size_t ii = 0; ii < NUM_IMAGES; ++ii)
+    for (size_t ii = 0; ii < vbm.getNumChannels(); ++ii)
     {
         for (size_t jj = 0; jj < metadata.getNumVectors(ii); ++jj)
         {
@@ -361,6 +358,17 @@ void runCPHDTest(const std::string& testName,
             }
         }
     }
+}
+
+void runCPHDTest(const std::string& testName,
+                 cphd::Metadata& metadata)
+{
+    metadata.data.numCPHDChannels = NUM_IMAGES;
+    cphd::CPHDWriter writer(metadata, NUM_THREADS);
+
+    cphd::VBM vbm(metadata.data, metadata.vectorParameters);
+    fillVBM(metadata, vbm);
+
     //std::vector<std::vector<sys::ubyte> >vbm(NUM_IMAGES);
     std::vector<std::vector<std::complex<float> > >data(NUM_IMAGES);
     std::vector<types::RowCol<size_t> > dims(NUM_IMAGES);
@@ -413,6 +421,130 @@ void runCPHDTest(const std::string& testName,
     }
 }
 
+std::vector<sys::ubyte> readFile(const std::string& pathname)
+{
+    io::FileInputStream inStream(pathname);
+    std::vector<sys::ubyte> contents(
+            static_cast<size_t>(inStream.available()));
+    inStream.read(&contents[0], contents.size());
+    return contents;
+}
+
+TEST_CASE(testWriteAddImage)
+{
+    // write() to a pathname writes the regions in parallel and write() to a
+    // stream swaps one chunk while writing the last.  A small scratch space
+    // makes both use lots of chunks.  They should match exactly.
+    cphd::Metadata metadata;
+    buildRandomMetadata(metadata);
+    addFXParams(metadata);
+    addOneWayParams(metadata);
+    metadata.data.numCPHDChannels = NUM_IMAGES;
+
+    cphd::VBM vbm(metadata.data, metadata.vectorParameters);
+    fillVBM(metadata, vbm);
+    metadata.data.numBytesVBP = vbm.getNumBytesVBP();
+
+    std::vector<std::vector<std::complex<sys::Int16_T> > > data(NUM_IMAGES);
+    std::vector<std::vector<sys::ubyte> > vbmData(NUM_IMAGES);
+    std::vector<types::RowCol<size_t> > dims(NUM_IMAGES);
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    cphd::CPHDWriter positionalWriter(metadata, NUM_THREADS, 1000);
+    cphd::CPHDWriter streamWriter(metadata, NUM_THREADS, 1000);
+    for (size_t ii = 0; ii < NUM_IMAGES; ++ii)
+    {
+        dims[ii] = types::RowCol<size_t>(metadata.getNumVectors(ii),
+                                         metadata.getNumSamples(ii));
+        data[ii].resize(dims[ii].area());
+        for (size_t jj = 0; jj < data[ii].size(); ++jj)
+        {
+            data[ii][jj] = std::complex<sys::Int16_T>(
+                    static_cast<sys::Int16_T>(getRandomInt(0, 1000)),
+                    static_cast<sys::Int16_T>(getRandomInt(0, 1000)));
+        }
+        vbm.getVBMdata(ii, vbmData[ii]);
+
+        positionalWriter.addImage(&data[ii][0], dims[ii], &vbmData[ii][0]);
+        streamWriter.addImage(&data[ii][0], dims[ii], &vbmData[ii][0]);
+    }
+
+    const std::string streamPathname("stream_" + FILE_NAME);
+    positionalWriter.write(FILE_NAME);
+    streamWriter.write(mem::SharedPtr<io::OutputStream>(
+            new io::FileOutputStream(streamPathname)));
+    TEST_ASSERT(readFile(FILE_NAME) == readFile(streamPathname));
+
+    cphd::CPHDReader reader(FILE_NAME, NUM_THREADS);
+    TEST_ASSERT_EQ(vbm, reader.getVBM());
+    for (size_t ii = 0; ii < NUM_IMAGES; ++ii)
+    {
+        mem::ScopedArray<sys::ubyte> readData;
+        reader.getWideband().read(ii,
+                                  0, cphd::Wideband::ALL,
+                                  0, cphd::Wideband::ALL,
+                                  NUM_THREADS, readData);
+        const std::complex<sys::Int16_T>* readBuffer =
+                reinterpret_cast<std::complex<sys::Int16_T>* >(
+                        readData.get());
+        for (size_t jj = 0; jj < dims[ii].area(); ++jj)
+        {
+            TEST_ASSERT_EQ(readBuffer[jj], data[ii][jj]);
+        }
+    }
+}
+
+TEST_CASE(testWriteOverwritesLargerFile)
+{
+    // Overwriting a larger file must not leave its tail behind.  A scratch
+    // space smaller than an element still gives one element per chunk.
+    cphd::Metadata metadata;
+    buildRandomMetadata(metadata);
+    addFXParams(metadata);
+    addOneWayParams(metadata);
+    metadata.data.numCPHDChannels = NUM_IMAGES;
+
+    cphd::VBM vbm(metadata.data, metadata.vectorParameters);
+    fillVBM(metadata, vbm);
+    metadata.data.numBytesVBP = vbm.getNumBytesVBP();
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+
+    std::vector<std::vector<std::complex<sys::Int16_T> > > data(NUM_IMAGES);
+    std::vector<std::vector<sys::ubyte> > vbmData(NUM_IMAGES);
+    cphd::CPHDWriter positionalWriter(metadata, NUM_THREADS, 1);
+    cphd::CPHDWriter streamWriter(metadata, NUM_THREADS, 1);
+    for (size_t ii = 0; ii < NUM_IMAGES; ++ii)
+    {
+        const types::RowCol<size_t> dims(metadata.getNumVectors(ii),
+                                         metadata.getNumSamples(ii));
+        data[ii].resize(dims.area());
+        for (size_t jj = 0; jj < data[ii].size(); ++jj)
+        {
+            data[ii][jj] = std::complex<sys::Int16_T>(
+                    static_cast<sys::Int16_T>(getRandomInt(0, 1000)),
+                    static_cast<sys::Int16_T>(getRandomInt(0, 1000)));
+        }
+        vbm.getVBMdata(ii, vbmData[ii]);
+
+        positionalWriter.addImage(&data[ii][0], dims, &vbmData[ii][0]);
+        streamWriter.addImage(&data[ii][0], dims, &vbmData[ii][0]);
+    }
+
+    const std::string streamPathname("stream_" + FILE_NAME);
+    streamWriter.write(mem::SharedPtr<io::OutputStream>(
+            new io::FileOutputStream(streamPathname)));
+    const std::vector<sys::ubyte> expected(readFile(streamPathname));
+
+    {
+        const std::vector<sys::ubyte> garbage(expected.size() * 2, 0xFF);
+        io::FileOutputStream larger(FILE_NAME);
+        larger.write(&garbage[0], garbage.size());
+        larger.close();
+    }
+
+    positionalWriter.write(FILE_NAME);
+    TEST_ASSERT(readFile(FILE_NAME) == expected);
+}
+
 TEST_CASE(testWriteFXOneWay)
 {
     cphd::Metadata metadata;
@@ -461,7 +593,10 @@ int main(int , char** )
     TEST_CHECK(testWriteFXTwoWay);
     TEST_CHECK(testWriteTOAOneWay);
     TEST_CHECK(testWriteTOATwoWay);
+    TEST_CHECK(testWriteAddImage);
+    TEST_CHECK(testWriteOverwritesLargerFile);
     sys::OS().remove(FILE_NAME);
+    sys::OS().remove("stream_" + FILE_NAME);
     return 0;
 }
 
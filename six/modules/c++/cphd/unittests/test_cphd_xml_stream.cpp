@@ -0,0 +1,267 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string>
+
+#include <io/StringStream.h>
+#include <cphd/CPHDXMLControl.h>
+
+#include "TestCase.h"
+
+namespace
+{
+six::PolyXYZ makePolyXYZ(size_t order, double offset)
+{
+    six::PolyXYZ poly(order);
+    for (size_t ii = 0; ii <= order; ++ii)
+    {
+        for (size_t jj = 0; jj < 3; ++jj)
+        {
+            poly[ii][jj] = offset + ii * 10.5 - jj * 1e-7;
+        }
+    }
+    return poly;
+}
+
+six::Poly1D makePoly1D(size_t order, double value)
+{
+    six::Poly1D poly(order);
+    for (size_t ii = 0; ii <= order; ++ii)
+    {
+        poly[ii] = value / (ii + 1);
+    }
+    return poly;
+}
+
+six::Poly2D makePoly2D(size_t orderX, size_t orderY)
+{
+    six::Poly2D poly(orderX, orderY);
+    for (size_t ii = 0; ii <= orderX; ++ii)
+    {
+        for (size_t jj = 0; jj <= orderY; ++jj)
+        {
+            poly[ii][jj] = -1.25e12 * ii + jj;
+        }
+    }
+    return poly;
+}
+
+cphd::AntennaParameters makeAntennaParameters(bool optional)
+{
+    cphd::AntennaParameters params;
+    params.xAxisPoly = makePolyXYZ(2, 1.0);
+    params.yAxisPoly = makePolyXYZ(1, -3.0);
+    params.frequencyZero = 9.6e9;
+    if (optional)
+    {
+        params.electricalBoresight.reset(new cphd::ElectricalBoresight());
+        params.electricalBoresight->dcxPoly = makePoly1D(2, 0.5);
+        params.electricalBoresight->dcyPoly = makePoly1D(0, -0.5);
+        params.halfPowerBeamwidths.reset(new cphd::HalfPowerBeamwidths());
+        params.halfPowerBeamwidths->dcx = 0.01;
+        params.halfPowerBeamwidths->dcy = 0.02;
+        params.array.reset(new cphd::GainAndPhasePolys());
+        params.array->gainPoly = makePoly2D(1, 2);
+        params.array->phasePoly = makePoly2D(0, 0);
+        params.element.reset(new cphd::GainAndPhasePolys());
+        params.element->gainPoly = makePoly2D(2, 1);
+        params.element->phasePoly = makePoly2D(1, 1);
+        params.gainBSPoly = makePoly1D(1, 3.0);
+        params.electricalBoresightFrequencyShift = six::BooleanType::IS_TRUE;
+    }
+    params.mainlobeFrequencyDilation = six::BooleanType::IS_FALSE;
+    return params;
+}
+
+// Everything optional filled in
+cphd::Metadata makeMetadata()
+{
+    cphd::Metadata metadata;
+    cphd::CollectionInformation& collInfo(metadata.collectionInformation);
+    collInfo.collectorName = "Collector";
+    collInfo.illuminatorName = "Illuminator";
+    collInfo.coreName = "Core";
+    collInfo.collectType = six::CollectType::MONOSTATIC;
+    collInfo.radarMode = cphd::RadarModeType::SPOTLIGHT;
+    collInfo.radarModeID = "Mode";
+    collInfo.classification.level = "UNCLASSIFIED";
+    collInfo.countryCodes.push_back("US");
+    collInfo.countryCodes.push_back("CA");
+    six::Parameter parameter(42);
+    parameter.setName("Answer");
+    collInfo.parameters.push_back(parameter);
+
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    metadata.data.numCPHDChannels = 2;
+    metadata.data.numBytesVBP = 160;
+    metadata.data.arraySize.push_back(cphd::ArraySize(100, 200));
+    metadata.data.arraySize.push_back(cphd::ArraySize(300, 400));
+
+    cphd::Global& global(metadata.global);
+    global.domainType = cphd::DomainType::FX;
+    global.phaseSGN = cphd::PhaseSGN::PLUS_1;
+    global.refFrequencyIndex = 3;
+    global.collectStart = six::DateTime(2018, 6, 1, 12, 30, 15.125);
+    global.collectDuration = 3.5;
+    global.txTime1 = 0.0;
+    global.txTime2 = 3.5;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        global.imageArea.acpCorners.getCorner(ii).setLat(ii * 0.25);
+        global.imageArea.acpCorners.getCorner(ii).setLon(-ii * 0.5);
+        global.imageArea.acpCorners.getCorner(ii).setAlt(100.0 + ii);
+    }
+    global.imageArea.plane.reset(new cphd::AreaPlane());
+    cphd::AreaPlane& plane(*global.imageArea.plane);
+    plane.referencePoint.name = "Ref";
+    plane.referencePoint.ecef[0] = 6378137.0;
+    plane.referencePoint.ecef[1] = 1.0;
+    plane.referencePoint.ecef[2] = -2.0;
+    plane.referencePoint.rowCol.row = 512.0;
+    plane.referencePoint.rowCol.col = 256.5;
+    plane.xDirection.unitVector[0] = 1.0;
+    plane.xDirection.unitVector[1] = 0.0;
+    plane.xDirection.unitVector[2] = 0.0;
+    plane.xDirection.spacing = 0.5;
+    plane.xDirection.elements = 1024;
+    plane.xDirection.first = 0;
+    plane.yDirection = plane.xDirection;
+    plane.yDirection.unitVector[0] = 0.0;
+    plane.yDirection.unitVector[1] = 1.0;
+    plane.yDirection.elements = 512;
+    plane.dwellTime.reset(new cphd::DwellTimeParameters());
+    plane.dwellTime->codTimePoly = makePoly2D(1, 1);
+    plane.dwellTime->dwellTimePoly = makePoly2D(2, 0);
+
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        cphd::ChannelParameters params;
+        params.srpIndex = ii;
+        params.nomTOARateSF = 1.0;
+        params.fxCtrNom = 9.6e9;
+        params.bwSavedNom = 1.5e8;
+        params.toaSavedNom = 1e-6;
+        if (ii == 1)
+        {
+            params.txAntIndex = 1;
+            params.rcvAntIndex = 1;
+            params.twAntIndex = 1;
+        }
+        metadata.channel.parameters.push_back(params);
+    }
+
+    metadata.srp.srpType = cphd::SRPType::PVTPOLY;
+    metadata.srp.numSRPs = 2;
+    metadata.srp.srpPVTPoly.push_back(makePolyXYZ(3, 6378137.0));
+    metadata.srp.srpPVTPoly.push_back(makePolyXYZ(0, -1.0));
+
+    metadata.antenna.reset(new cphd::Antenna());
+    metadata.antenna->numTxAnt = 2;
+    metadata.antenna->numRcvAnt = 1;
+    metadata.antenna->numTWAnt = 0;
+    metadata.antenna->tx.push_back(makeAntennaParameters(true));
+    metadata.antenna->tx.push_back(makeAntennaParameters(false));
+    metadata.antenna->rcv.push_back(makeAntennaParameters(false));
+
+    cphd::VectorParameters& vp(metadata.vectorParameters);
+    vp.txTime = 8;
+    vp.txPos = 24;
+    vp.rcvTime = 8;
+    vp.rcvPos = 24;
+    vp.srpTime = 8;
+    vp.srpPos = 24;
+    vp.ampSF = 8;
+    vp.tropoSRP = 8;
+    vp.toaParameters.reset(new cphd::TOAParameters());
+    vp.toaParameters->deltaTOA0 = 8;
+    vp.toaParameters->toaSS = 8;
+    return metadata;
+}
+
+// What toXMLString() used to do
+std::string printDOM(const cphd::Metadata& metadata)
+{
+    std::auto_ptr<xml::lite::Document> doc(
+            cphd::CPHDXMLControl().toXML(metadata));
+    io::StringStream ss;
+    doc->getRootElement()->print(ss);
+    return std::string("<?xml version=\"1.0\"?>") + ss.stream().str();
+}
+
+TEST_CASE(testMatchesDOM)
+{
+    cphd::Metadata metadata = makeMetadata();
+    cphd::CPHDXMLControl control;
+    std::string xml = control.toXMLString(metadata);
+    TEST_ASSERT_EQ(xml, printDOM(metadata));
+    TEST_ASSERT_EQ(control.getXMLsize(metadata), xml.size());
+
+    // Round trips
+    TEST_ASSERT(*control.fromXML(xml) == metadata);
+
+    // Now with the optional parts missing and the other choices made
+    metadata.collectionInformation.illuminatorName.clear();
+    metadata.collectionInformation.radarModeID.clear();
+    metadata.collectionInformation.countryCodes.clear();
+    metadata.collectionInformation.parameters = six::ParameterCollection();
+    const cphd::AreaPlane plane = *metadata.global.imageArea.plane;
+    metadata.global.imageArea.plane.reset();
+    metadata.antenna.reset(new cphd::Antenna());
+    metadata.antenna->numTWAnt = 1;
+    metadata.antenna->twoWay.push_back(makeAntennaParameters(false));
+    metadata.srp.srpType = cphd::SRPType::FIXEDPT;
+    metadata.srp.srpPT.assign(2, plane.referencePoint.ecef);
+    metadata.vectorParameters.toaParameters.reset();
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    metadata.vectorParameters.fxParameters->Fx0 = 8;
+    metadata.vectorParameters.fxParameters->FxSS = 8;
+    metadata.vectorParameters.fxParameters->Fx1 = 8;
+    metadata.vectorParameters.fxParameters->Fx2 = 8;
+
+    xml = control.toXMLString(metadata);
+    TEST_ASSERT_EQ(xml, printDOM(metadata));
+    TEST_ASSERT_EQ(control.getXMLsize(metadata), xml.size());
+}
+
+TEST_CASE(testInvalidMetadata)
+{
+    // Same checks as the DOM
+    cphd::Metadata metadata = makeMetadata();
+    metadata.srp.numSRPs = 3;
+    TEST_EXCEPTION(cphd::CPHDXMLControl().toXMLString(metadata));
+
+    metadata = makeMetadata();
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    TEST_EXCEPTION(cphd::CPHDXMLControl().getXMLsize(metadata));
+
+    metadata = makeMetadata();
+    metadata.global.collectDuration = six::Init::undefined<double>();
+    TEST_EXCEPTION(cphd::CPHDXMLControl().toXMLString(metadata));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testMatchesDOM);
+    TEST_CHECK(testInvalidMetadata);
+    return 0;
+}
@@ -0,0 +1,276 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <math.h>
+#include <algorithm>
+#include <vector>
+
+#include <io/TempFile.h>
+#include <math/Constants.h>
+#include <six/sicd/Utilities.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/FFT.h>
+#include <cphd/PFAImageFormer.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const size_t NUM_VECTORS = 128;
+const size_t NUM_SAMPLES = 128;
+const double CENTER_FREQUENCY = 10e9;
+const double BANDWIDTH = 150e6;
+
+cphd::Vector3 makeVector(double x, double y, double z)
+{
+    cphd::Vector3 vector;
+    vector[0] = x;
+    vector[1] = y;
+    vector[2] = z;
+    return vector;
+}
+
+const cphd::Vector3 SRP = makeVector(6378137.0, 0.0, 0.0);
+
+// A point target off the SRP, in the slant plane
+cphd::Vector3 getTarget()
+{
+    return SRP + makeVector(4.0, 20.0, 15.0);
+}
+
+// Platform 10 km up, 17 km to the side, flying along z at 200 m/s for 1.5 s.
+// Monostatic, so the transmit and receive positions are the same.
+void writeCPHD(const std::string& pathname)
+{
+    const double speedOfLight =
+            math::Constants::SPEED_OF_LIGHT_METERS_PER_SEC;
+    const types::RowCol<size_t> dims(NUM_VECTORS, NUM_SAMPLES);
+
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = 1;
+    metadata.data.arraySize.push_back(cphd::ArraySize(dims.row, dims.col));
+    metadata.data.sampleType = cphd::SampleType::RE32F_IM32F;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.global.phaseSGN = cphd::PhaseSGN::MINUS_1;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    metadata.vectorParameters.fxParameters->Fx0 = 8;
+    metadata.vectorParameters.fxParameters->FxSS = 8;
+    metadata.vectorParameters.fxParameters->Fx1 = 8;
+    metadata.vectorParameters.fxParameters->Fx2 = 8;
+    metadata.vectorParameters.txTime = 8;
+    metadata.vectorParameters.txPos = 24;
+    metadata.vectorParameters.rcvTime = 8;
+    metadata.vectorParameters.rcvPos = 24;
+    metadata.vectorParameters.srpPos = 24;
+
+    cphd::VBM vbm(1, std::vector<size_t>(1, dims.row), false, false, false,
+                  metadata.global.domainType);
+
+    const double fx0 = CENTER_FREQUENCY - BANDWIDTH / 2;
+    const double fxSS = BANDWIDTH / NUM_SAMPLES;
+    const cphd::Vector3 target = getTarget();
+    std::vector<std::complex<float> > data(dims.area());
+    for (size_t ii = 0; ii < NUM_VECTORS; ++ii)
+    {
+        const double time = 1.5 * ii / (NUM_VECTORS - 1);
+        const cphd::Vector3 position =
+                SRP + makeVector(10000.0, 17000.0, 200.0 * (time - 0.75));
+        vbm.setTxTime(time, 0, ii);
+        vbm.setTxPos(position, 0, ii);
+        vbm.setRcvTime(time, 0, ii);
+        vbm.setRcvPos(position, 0, ii);
+        vbm.setSRPPos(SRP, 0, ii);
+        vbm.setFx0(fx0, 0, ii);
+        vbm.setFxSS(fxSS, 0, ii);
+        vbm.setFx1(fx0, 0, ii);
+        vbm.setFx2(fx0 + (NUM_SAMPLES - 1) * fxSS, 0, ii);
+
+        // Relative to the SRP, with PhaseSGN -1
+        const double deltaTOA = 2 * ((position - target).norm() -
+                                     (position - SRP).norm()) / speedOfLight;
+        for (size_t jj = 0; jj < NUM_SAMPLES; ++jj)
+        {
+            const double phase =
+                    -2 * M_PI * (fx0 + jj * fxSS) * deltaTOA;
+            data[ii * NUM_SAMPLES + jj] = std::complex<float>(
+                    static_cast<float>(::cos(phase)),
+                    static_cast<float>(::sin(phase)));
+        }
+    }
+
+    cphd::CPHDWriter writer(metadata, 1);
+    writer.writeMetadata(pathname, vbm);
+    writer.writeCPHDData(&data[0], dims.area());
+}
+
+types::RowCol<size_t> findPeak(const std::complex<float>* image,
+                               const types::RowCol<size_t>& dims)
+{
+    size_t peak = 0;
+    for (size_t ii = 1; ii < dims.area(); ++ii)
+    {
+        if (std::norm(image[ii]) > std::norm(image[peak]))
+        {
+            peak = ii;
+        }
+    }
+    return types::RowCol<size_t>(peak / dims.col, peak % dims.col);
+}
+
+TEST_CASE(testFFT)
+{
+    // Against a DFT
+    const size_t size = 64;
+    std::vector<std::complex<float> > data(size);
+    for (size_t ii = 0; ii < size; ++ii)
+    {
+        data[ii] = std::complex<float>(static_cast<float>(ii % 5),
+                                       static_cast<float>(ii % 3) - 1.0f);
+    }
+
+    for (int sign = -1; sign <= 1; sign += 2)
+    {
+        std::vector<std::complex<float> > transformed(data);
+        cphd::FFT(size, sign).transform(&transformed[0]);
+        for (size_t ii = 0; ii < size; ++ii)
+        {
+            std::complex<double> expected(0.0, 0.0);
+            for (size_t jj = 0; jj < size; ++jj)
+            {
+                expected += std::complex<double>(data[jj]) *
+                        std::polar(1.0, sign * 2 * M_PI * ii * jj / size);
+            }
+            TEST_ASSERT_ALMOST_EQ_EPS(transformed[ii].real(),
+                                      expected.real(), 1e-3);
+            TEST_ASSERT_ALMOST_EQ_EPS(transformed[ii].imag(),
+                                      expected.imag(), 1e-3);
+        }
+    }
+
+    TEST_EXCEPTION(cphd::FFT(48, -1));
+    TEST_ASSERT_EQ(cphd::FFT::nextPowerOfTwo(48), static_cast<size_t>(64));
+    TEST_ASSERT_EQ(cphd::FFT::nextPowerOfTwo(64), static_cast<size_t>(64));
+}
+
+TEST_CASE(testFFT2D)
+{
+    // A single pixel transforms to a plane wave
+    const types::RowCol<size_t> dims(32, 64);
+    std::vector<std::complex<float> > data(dims.area());
+    data[3 * dims.col + 5] = std::complex<float>(1.0f, 0.0f);
+    cphd::fft2D(&data[0], dims, 1, 3);
+    for (size_t row = 0; row < dims.row; ++row)
+    {
+        for (size_t col = 0; col < dims.col; ++col)
+        {
+            const std::complex<double> expected = std::polar(
+                    1.0, 2 * M_PI * (3.0 * row / dims.row +
+                                     5.0 * col / dims.col));
+            const std::complex<float>& value = data[row * dims.col + col];
+            TEST_ASSERT_ALMOST_EQ_EPS(value.real(), expected.real(), 1e-4);
+            TEST_ASSERT_ALMOST_EQ_EPS(value.imag(), expected.imag(), 1e-4);
+        }
+    }
+}
+
+TEST_CASE(testFormImage)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname());
+
+    cphd::CPHDReader reader(tempfile.pathname(), 2);
+    cphd::PFAImageFormer former(reader, 0, 3, 50);
+    TEST_ASSERT_EQ(former.getDims().row, NUM_SAMPLES);
+    TEST_ASSERT_EQ(former.getDims().col, NUM_VECTORS);
+    TEST_EXCEPTION(former.getImage());
+    former.form();
+
+    std::auto_ptr<six::sicd::ComplexData> data =
+            six::sicd::Utilities::createFakeComplexData();
+    former.populateComplexData(*data);
+    TEST_ASSERT_EQ(data->getNumRows(), NUM_SAMPLES);
+    TEST_ASSERT_EQ(data->getNumCols(), NUM_VECTORS);
+    TEST_ASSERT_EQ(data->imageFormation->imageFormationAlgorithm,
+                   six::ImageFormationType::PFA);
+    TEST_ASSERT(data->pfa->krg1 < data->grid->row->kCenter);
+    TEST_ASSERT(data->grid->row->kCenter < data->pfa->krg2);
+    TEST_ASSERT_ALMOST_EQ_EPS(data->pfa->kaz1 + data->pfa->kaz2,
+                              2 * data->grid->col->kCenter, 1e-9);
+    TEST_ASSERT_EQ(data->grid->row->sign, six::FFTSign::NEG);
+
+    // The grid's unit vectors and sample spacings say where the target
+    // should be
+    const cphd::Vector3 offset = getTarget() - SRP;
+    const double expectedRow = data->imageData->scpPixel.row +
+            offset.dot(data->grid->row->unitVector) /
+            data->grid->row->sampleSpacing;
+    const double expectedCol = data->imageData->scpPixel.col +
+            offset.dot(data->grid->col->unitVector) /
+            data->grid->col->sampleSpacing;
+
+    const types::RowCol<size_t> peak =
+            findPeak(former.getImage(), former.getDims());
+    TEST_ASSERT(::fabs(peak.row - expectedRow) <= 1.0);
+    TEST_ASSERT(::fabs(peak.col - expectedCol) <= 1.0);
+
+    // Round trip through a SICD
+    io::TempFile sicdFile;
+    const std::vector<std::string> schemaPaths;
+    former.write(*data, schemaPaths, sicdFile.pathname(), 40);
+
+    std::auto_ptr<six::sicd::ComplexData> readData;
+    std::vector<std::complex<float> > image;
+    six::sicd::Utilities::readSicd(sicdFile.pathname(), schemaPaths,
+                                   readData, image);
+    TEST_ASSERT_EQ(image.size(), former.getDims().area());
+    TEST_ASSERT(std::equal(image.begin(), image.end(), former.getImage()));
+    TEST_ASSERT_ALMOST_EQ(readData->pfa->krg1, data->pfa->krg1);
+}
+
+TEST_CASE(testBadChannel)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname());
+    cphd::CPHDReader reader(tempfile.pathname(), 1);
+    TEST_EXCEPTION(cphd::PFAImageFormer(reader, 1));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testFFT);
+    TEST_CHECK(testFFT2D);
+    TEST_CHECK(testFormImage);
+    TEST_CHECK(testBadChannel);
+    return 0;
+}
@@ -0,0 +1,206 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/PulseBlockReader.h>
+#include <io/TempFile.h>
+#include <types/RowCol.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<size_t> DIMS(37, 16);
+
+// Writes DIMS worth of RE16I_IM16I samples, optionally with AmpSF set to
+// 1 + vector / 4
+void writeCPHD(const std::string& pathname, bool ampSF)
+{
+    std::vector<std::complex<sys::Int16_T> > writeData(DIMS.area());
+    srand(0);
+    for (size_t ii = 0; ii < writeData.size(); ++ii)
+    {
+        writeData[ii] = std::complex<sys::Int16_T>(
+                static_cast<sys::Int16_T>(rand() % 1000),
+                static_cast<sys::Int16_T>(rand() % 1000));
+    }
+
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = 1;
+    metadata.data.arraySize.push_back(cphd::ArraySize(DIMS.row, DIMS.col));
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    if (ampSF)
+    {
+        // The reader only finds AmpSF from its offset, so the sizes of
+        // everything in front of it need to be filled in
+        metadata.vectorParameters.txTime = 8;
+        metadata.vectorParameters.txPos = 24;
+        metadata.vectorParameters.rcvTime = 8;
+        metadata.vectorParameters.rcvPos = 24;
+        metadata.vectorParameters.srpPos = 24;
+        metadata.vectorParameters.ampSF = 8;
+    }
+
+    cphd::VBM vbm(1,
+                  std::vector<size_t>(1, DIMS.row),
+                  false,
+                  false,
+                  ampSF,
+                  metadata.global.domainType);
+    if (ampSF)
+    {
+        for (size_t ii = 0; ii < DIMS.row; ++ii)
+        {
+            vbm.setAmpSF(1.0 + ii / 4.0, 0, ii);
+        }
+    }
+
+    cphd::CPHDWriter writer(metadata, 1);
+    writer.writeMetadata(pathname, vbm);
+    writer.writeCPHDData(&writeData[0], DIMS.area());
+}
+
+std::vector<std::complex<float> > readAll(cphd::CPHDReader& reader)
+{
+    std::vector<double> scaleFactors(DIMS.row, 1.0);
+    if (reader.getVBM().haveAmpSF())
+    {
+        for (size_t ii = 0; ii < DIMS.row; ++ii)
+        {
+            scaleFactors[ii] = reader.getVBM().getAmpSF(0, ii);
+        }
+    }
+
+    std::vector<std::complex<float> > data(DIMS.area());
+    std::vector<sys::ubyte> scratch(DIMS.area() * 4);
+    reader.getWideband().read(
+            0, 0, cphd::Wideband::ALL, 0, cphd::Wideband::ALL,
+            scaleFactors, 1,
+            mem::BufferView<sys::ubyte>(&scratch[0], scratch.size()),
+            mem::BufferView<std::complex<float> >(&data[0], data.size()));
+    return data;
+}
+
+bool readBlocks(bool ampSF,
+                size_t numVectorsPerBlock,
+                size_t numBlocksAhead,
+                size_t numThreads)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname(), ampSF);
+
+    cphd::CPHDReader reader(tempfile.pathname(), 1);
+    if (reader.getVBM().haveAmpSF() != ampSF)
+    {
+        std::cerr << "AmpSF didn't round trip" << std::endl;
+        return false;
+    }
+    const std::vector<std::complex<float> > expected = readAll(reader);
+
+    cphd::PulseBlockReader blocks(reader, 0, numVectorsPerBlock,
+                                  numBlocksAhead, numThreads);
+
+    size_t nextVector = 0;
+    size_t numBlocks = 0;
+    cphd::PulseBlockReader::Block block;
+    while (blocks.next(block))
+    {
+        if (block.firstVector != nextVector ||
+            block.numSamples != DIMS.col ||
+            block.vbm != &reader.getVBM())
+        {
+            std::cerr << "Bad block " << numBlocks << std::endl;
+            return false;
+        }
+
+        const size_t numPixels = block.numVectors * block.numSamples;
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            if (block.data[ii] != expected[nextVector * DIMS.col + ii])
+            {
+                std::cerr << "Value mismatch in block " << numBlocks
+                          << " at index " << ii << std::endl;
+                return false;
+            }
+        }
+
+        nextVector += block.numVectors;
+        ++numBlocks;
+    }
+
+    return nextVector == DIMS.row && numBlocks == blocks.getNumBlocks() &&
+            !blocks.next(block);
+}
+
+TEST_CASE(testUnscaled)
+{
+    TEST_ASSERT(readBlocks(false, 5, 4, 1));
+    TEST_ASSERT(readBlocks(false, 1, 2, 2));
+    TEST_ASSERT(readBlocks(false, 100, 4, 1));
+}
+
+TEST_CASE(testScaled)
+{
+    TEST_ASSERT(readBlocks(true, 5, 4, 1));
+    TEST_ASSERT(readBlocks(true, 8, 0, 2));
+}
+
+TEST_CASE(testStopEarly)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname(), false);
+    cphd::CPHDReader reader(tempfile.pathname(), 1);
+
+    // Destroying the reader with the producer waiting on a free buffer
+    // shouldn't hang
+    cphd::PulseBlockReader blocks(reader, 0, 2, 3);
+    cphd::PulseBlockReader::Block block;
+    TEST_ASSERT(blocks.next(block));
+    TEST_ASSERT_EQ(block.firstVector, static_cast<size_t>(0));
+    TEST_ASSERT_EQ(block.numVectors, static_cast<size_t>(2));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testUnscaled);
+    TEST_CHECK(testScaled);
+    TEST_CHECK(testStopEarly);
+    return 0;
+}
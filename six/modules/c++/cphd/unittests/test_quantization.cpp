@@ -0,0 +1,282 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/Quantization.h>
+#include <io/TempFile.h>
+#include <types/RowCol.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<size_t> DIMS(33, 20);
+
+// Each vector has a different dynamic range, and one is all zeros
+std::vector<std::complex<float> > makeImage()
+{
+    std::vector<std::complex<float> > image(DIMS.area());
+    srand(0);
+    for (size_t row = 0; row < DIMS.row; ++row)
+    {
+        const float amplitude = (row == 5) ? 0.0f : std::pow(2.0f, row % 12);
+        for (size_t col = 0; col < DIMS.col; ++col)
+        {
+            image[row * DIMS.col + col] = std::complex<float>(
+                    amplitude * (rand() / static_cast<float>(RAND_MAX) - 0.5f),
+                    amplitude * (rand() / static_cast<float>(RAND_MAX) - 0.5f));
+        }
+    }
+    return image;
+}
+
+template <typename OutT>
+bool checkQuantize(size_t numThreads, double minSQNR)
+{
+    const std::vector<std::complex<float> > image = makeImage();
+    std::vector<std::complex<OutT> > output(DIMS.area());
+    std::vector<double> scaleFactors(DIMS.row);
+    cphd::QuantizationStatistics stats;
+    cphd::quantize(&image[0], DIMS, numThreads, &output[0], &scaleFactors[0],
+                   stats);
+
+    if (stats.numSamples != DIMS.area() || stats.getSQNR() < minSQNR ||
+        scaleFactors[5] != 1.0)
+    {
+        return false;
+    }
+
+    for (size_t row = 0; row < DIMS.row; ++row)
+    {
+        for (size_t col = 0; col < DIMS.col; ++col)
+        {
+            const size_t idx = row * DIMS.col + col;
+            const double realError = std::abs(
+                    output[idx].real() * scaleFactors[row] - image[idx].real());
+            const double imagError = std::abs(
+                    output[idx].imag() * scaleFactors[row] - image[idx].imag());
+
+            // Half a step, plus a little for float rounding of the input
+            const double tolerance = scaleFactors[row] * 0.51;
+            if (realError > tolerance || imagError > tolerance ||
+                std::max(realError, imagError) > stats.maxError)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+cphd::Metadata makeMetadata(cphd::SampleType sampleType)
+{
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = 1;
+    metadata.data.arraySize.push_back(cphd::ArraySize(DIMS.row, DIMS.col));
+    metadata.data.sampleType = sampleType;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+
+    // The reader only finds AmpSF from its offset, so the sizes of
+    // everything in front of it need to be filled in
+    metadata.vectorParameters.txTime = 8;
+    metadata.vectorParameters.txPos = 24;
+    metadata.vectorParameters.rcvTime = 8;
+    metadata.vectorParameters.rcvPos = 24;
+    metadata.vectorParameters.srpPos = 24;
+    metadata.vectorParameters.ampSF = 8;
+    return metadata;
+}
+
+bool roundTrip(cphd::SampleType sampleType, double minSQNR)
+{
+    const std::vector<std::complex<float> > image = makeImage();
+    cphd::VBM vbm(1, std::vector<size_t>(1, DIMS.row), false, false, true,
+                  cphd::DomainType::FX);
+
+    io::TempFile tempfile;
+    cphd::CPHDWriter writer(makeMetadata(sampleType), 2);
+    const cphd::QuantizationStatistics stats =
+            writer.addQuantizedImage(&image[0], DIMS, vbm);
+    writer.write(tempfile.pathname());
+    if (stats.getSQNR() < minSQNR)
+    {
+        return false;
+    }
+
+    cphd::CPHDReader reader(tempfile.pathname(), 1);
+    if (!reader.getVBM().haveAmpSF() ||
+        reader.getNumBytesPerSample() != (sampleType ==
+                cphd::SampleType::RE08I_IM08I ? 2u : 4u))
+    {
+        return false;
+    }
+
+    std::vector<double> scaleFactors(DIMS.row);
+    for (size_t ii = 0; ii < DIMS.row; ++ii)
+    {
+        scaleFactors[ii] = reader.getVBM().getAmpSF(0, ii);
+        if (scaleFactors[ii] != vbm.getAmpSF(0, ii))
+        {
+            return false;
+        }
+    }
+
+    std::vector<std::complex<float> > data(DIMS.area());
+    std::vector<sys::ubyte> scratch(DIMS.area() * 4);
+    reader.getWideband().read(
+            0, 0, cphd::Wideband::ALL, 0, cphd::Wideband::ALL,
+            scaleFactors, 1,
+            mem::BufferView<sys::ubyte>(&scratch[0], scratch.size()),
+            mem::BufferView<std::complex<float> >(&data[0], data.size()));
+
+    for (size_t ii = 0; ii < data.size(); ++ii)
+    {
+        const double tolerance = scaleFactors[ii / DIMS.col] * 0.51;
+        if (std::abs(data[ii].real() - image[ii].real()) > tolerance ||
+            std::abs(data[ii].imag() - image[ii].imag()) > tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE(testQuantize8)
+{
+    // Uniform error over a uniform signal gives ~6 dB per bit
+    TEST_ASSERT(checkQuantize<sys::Int8_T>(1, 35.0));
+    TEST_ASSERT(checkQuantize<sys::Int8_T>(4, 35.0));
+}
+
+TEST_CASE(testQuantize16)
+{
+    TEST_ASSERT(checkQuantize<sys::Int16_T>(1, 85.0));
+    TEST_ASSERT(checkQuantize<sys::Int16_T>(3, 85.0));
+}
+
+TEST_CASE(testNonFinite)
+{
+    std::vector<std::complex<float> > image = makeImage();
+    std::vector<std::complex<sys::Int16_T> > output(DIMS.area());
+    std::vector<double> scaleFactors(DIMS.row);
+    cphd::QuantizationStatistics stats;
+
+    // In the vectorized part of a row and in its tail
+    image[7 * DIMS.col + 1] = std::complex<float>(
+            0.0f, std::numeric_limits<float>::quiet_NaN());
+    TEST_EXCEPTION(cphd::quantize(&image[0], DIMS, 1, &output[0],
+                                  &scaleFactors[0], stats));
+
+    image = makeImage();
+    image[8 * DIMS.col + DIMS.col - 1] = std::complex<float>(
+            -std::numeric_limits<float>::infinity(), 0.0f);
+    TEST_EXCEPTION(cphd::quantize(&image[0], DIMS, 3, &output[0],
+                                  &scaleFactors[0], stats));
+}
+
+TEST_CASE(testTinyVector)
+{
+    // Small enough that maxValue / maxAbs overflows a float
+    std::vector<std::complex<float> > image = makeImage();
+    for (size_t col = 0; col < DIMS.col; ++col)
+    {
+        image[2 * DIMS.col + col] = std::complex<float>(
+                (col % 2) ? 1.0e-40f : 0.0f, -1.0e-40f);
+    }
+
+    std::vector<std::complex<sys::Int8_T> > output(DIMS.area());
+    std::vector<double> scaleFactors(DIMS.row);
+    cphd::QuantizationStatistics stats;
+    cphd::quantize(&image[0], DIMS, 1, &output[0], &scaleFactors[0], stats);
+
+    // Every sample is within half a step of zero
+    TEST_ASSERT(scaleFactors[2] * 0.5 >= 1.0e-40);
+    for (size_t col = 0; col < DIMS.col; ++col)
+    {
+        TEST_ASSERT_EQ(output[2 * DIMS.col + col].real(), 0);
+        TEST_ASSERT_EQ(output[2 * DIMS.col + col].imag(), 0);
+    }
+}
+
+TEST_CASE(testRoundTrip)
+{
+    TEST_ASSERT(roundTrip(cphd::SampleType::RE08I_IM08I, 35.0));
+    TEST_ASSERT(roundTrip(cphd::SampleType::RE16I_IM16I, 85.0));
+}
+
+TEST_CASE(testBadInput)
+{
+    const std::vector<std::complex<float> > image = makeImage();
+
+    // Floats can't be quantized
+    cphd::VBM vbm(1, std::vector<size_t>(1, DIMS.row), false, false, true,
+                  cphd::DomainType::FX);
+    cphd::CPHDWriter floatWriter(makeMetadata(cphd::SampleType::RE32F_IM32F));
+    TEST_EXCEPTION(floatWriter.addQuantizedImage(&image[0], DIMS, vbm));
+
+    // Nowhere to put the scale factors
+    cphd::VBM noAmpSF(1, std::vector<size_t>(1, DIMS.row), false, false,
+                      false, cphd::DomainType::FX);
+    cphd::CPHDWriter writer(makeMetadata(cphd::SampleType::RE16I_IM16I));
+    TEST_EXCEPTION(writer.addQuantizedImage(&image[0], DIMS, noAmpSF));
+
+    // The image has to have one row per vector in the VBM
+    cphd::VBM moreVectors(1, std::vector<size_t>(1, DIMS.row + 1), false,
+                          false, true, cphd::DomainType::FX);
+    TEST_EXCEPTION(writer.addQuantizedImage(&image[0], DIMS, moreVectors));
+    const types::RowCol<size_t> fewerRows(DIMS.row - 1, DIMS.col);
+    TEST_EXCEPTION(writer.addQuantizedImage(&image[0], fewerRows, vbm));
+
+    // and a channel in the VBM to go in
+    writer.addQuantizedImage(&image[0], DIMS, vbm);
+    TEST_EXCEPTION(writer.addQuantizedImage(&image[0], DIMS, vbm));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testQuantize8);
+    TEST_CHECK(testQuantize16);
+    TEST_CHECK(testNonFinite);
+    TEST_CHECK(testTinyVector);
+    TEST_CHECK(testRoundTrip);
+    TEST_CHECK(testBadInput);
+    return 0;
+}
@@ -0,0 +1,261 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstdlib>
+#include <vector>
+
+#include <io/FileInputStream.h>
+#include <io/TempFile.h>
+#include <mem/SharedPtr.h>
+#include <tasks/TaskScheduler.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const size_t NUM_CHANNELS = 3;
+
+types::RowCol<size_t> getDims(size_t channel)
+{
+    return types::RowCol<size_t>(40 + channel * 7, 30 - channel * 4);
+}
+
+// Quantized, so the channels have AmpSF
+void writeCPHD(const std::string& pathname)
+{
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = NUM_CHANNELS;
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    metadata.vectorParameters.txTime = 8;
+    metadata.vectorParameters.txPos = 24;
+    metadata.vectorParameters.rcvTime = 8;
+    metadata.vectorParameters.rcvPos = 24;
+    metadata.vectorParameters.srpPos = 24;
+    metadata.vectorParameters.ampSF = 8;
+
+    std::vector<size_t> numVectors;
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        metadata.channel.parameters.push_back(cphd::ChannelParameters());
+        numVectors.push_back(getDims(ii).row);
+    }
+    cphd::VBM vbm(NUM_CHANNELS, numVectors, false, false, true,
+                  metadata.global.domainType);
+
+    cphd::CPHDWriter writer(metadata, 2);
+    std::vector<std::vector<std::complex<float> > > images(NUM_CHANNELS);
+    srand(0);
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        images[ii].resize(getDims(ii).area());
+        for (size_t jj = 0; jj < images[ii].size(); ++jj)
+        {
+            images[ii][jj] = std::complex<float>(
+                    static_cast<float>(rand() % 2000) / (jj % 13 + 1),
+                    static_cast<float>(rand() % 2000) / (jj % 7 + 1));
+        }
+        writer.addQuantizedImage(&images[ii][0], getDims(ii), vbm);
+    }
+    writer.write(pathname);
+}
+
+// One channel at a time on this thread
+std::vector<std::vector<std::complex<float> > >
+readSequential(cphd::CPHDReader& reader)
+{
+    std::vector<std::vector<std::complex<float> > > data(NUM_CHANNELS);
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        const types::RowCol<size_t> dims = getDims(ii);
+        std::vector<double> scaleFactors(dims.row);
+        for (size_t jj = 0; jj < dims.row; ++jj)
+        {
+            scaleFactors[jj] = reader.getVBM().getAmpSF(ii, jj);
+        }
+
+        data[ii].resize(dims.area());
+        std::vector<sys::ubyte> scratch(dims.area() * 4);
+        reader.getWideband().read(
+                ii, 0, cphd::Wideband::ALL, 0, cphd::Wideband::ALL,
+                scaleFactors, 1,
+                mem::BufferView<sys::ubyte>(&scratch[0], scratch.size()),
+                mem::BufferView<std::complex<float> >(&data[ii][0],
+                                                      data[ii].size()));
+    }
+    return data;
+}
+
+bool readChannels(cphd::CPHDReader& reader, size_t numThreads)
+{
+    const std::vector<std::vector<std::complex<float> > > expected =
+            readSequential(reader);
+
+    std::vector<std::vector<std::complex<float> > > data(NUM_CHANNELS);
+    std::vector<mem::BufferView<std::complex<float> > > buffers;
+    std::vector<std::vector<sys::ubyte> > raw(NUM_CHANNELS);
+    std::vector<mem::BufferView<sys::ubyte> > rawBuffers;
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        data[ii].resize(getDims(ii).area());
+        buffers.push_back(mem::BufferView<std::complex<float> >(
+                &data[ii][0], data[ii].size()));
+        raw[ii].resize(getDims(ii).area() * 4);
+        rawBuffers.push_back(mem::BufferView<sys::ubyte>(
+                &raw[ii][0], raw[ii].size()));
+    }
+    reader.readChannels(numThreads, buffers);
+    reader.readChannels(numThreads, rawBuffers);
+
+    for (size_t ii = 0; ii < NUM_CHANNELS; ++ii)
+    {
+        const std::complex<sys::Int16_T>* const samples =
+                reinterpret_cast<std::complex<sys::Int16_T>*>(&raw[ii][0]);
+        for (size_t jj = 0; jj < data[ii].size(); ++jj)
+        {
+            const double scale =
+                    reader.getVBM().getAmpSF(ii, jj / getDims(ii).col);
+            const std::complex<float> rescaled(
+                    static_cast<float>(samples[jj].real() * scale),
+                    static_cast<float>(samples[jj].imag() * scale));
+            if (data[ii][jj] != expected[ii][jj] ||
+                rescaled != expected[ii][jj])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Reads a different window from each task, all through the same Wideband
+class WindowReader
+{
+public:
+    WindowReader(cphd::Wideband& wideband,
+                 std::vector<std::vector<sys::ubyte> >& windows) :
+        mWideband(wideband),
+        mWindows(windows)
+    {
+    }
+
+    // Odd windows are 11 samples out of each vector, even ones are whole
+    // vectors
+    void operator()(size_t window) const
+    {
+        const size_t channel = window % NUM_CHANNELS;
+        const size_t firstVector = window % 11;
+        const size_t firstSample = (window % 2) ? window % 5 : 0;
+        const size_t lastSample = (window % 2) ?
+                firstSample + 10 : getDims(channel).col - 1;
+
+        std::vector<sys::ubyte>& output(mWindows[window]);
+        output.resize((getDims(channel).row - firstVector) *
+                      (lastSample - firstSample + 1) * 4);
+        mWideband.read(channel, firstVector, cphd::Wideband::ALL,
+                       firstSample, lastSample, 1,
+                       mem::BufferView<sys::ubyte>(&output[0],
+                                                   output.size()));
+    }
+
+private:
+    cphd::Wideband& mWideband;
+    std::vector<std::vector<sys::ubyte> >& mWindows;
+};
+
+bool readConcurrently(cphd::CPHDReader& reader)
+{
+    const size_t numWindows = 24;
+    std::vector<std::vector<sys::ubyte> > sequential(numWindows);
+    std::vector<std::vector<sys::ubyte> > concurrent(numWindows);
+
+    const WindowReader sequentialReader(reader.getWideband(), sequential);
+    for (size_t ii = 0; ii < numWindows; ++ii)
+    {
+        sequentialReader(ii);
+    }
+
+    // One window per task
+    tasks::parallelFor(numWindows, numWindows,
+                       WindowReader(reader.getWideband(), concurrent));
+    return sequential == concurrent;
+}
+
+TEST_CASE(testReadChannels)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname());
+
+    cphd::CPHDReader pathReader(tempfile.pathname(), 1);
+    TEST_ASSERT(pathReader.getVBM().haveAmpSF());
+    TEST_ASSERT(readChannels(pathReader, 1));
+    TEST_ASSERT(readChannels(pathReader, 2));
+    TEST_ASSERT(readChannels(pathReader, 8));
+
+    cphd::CPHDReader streamReader(mem::SharedPtr<io::SeekableInputStream>(
+            new io::FileInputStream(tempfile.pathname())), 1);
+    TEST_ASSERT(readChannels(streamReader, 4));
+}
+
+TEST_CASE(testReadConcurrently)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname());
+
+    cphd::CPHDReader pathReader(tempfile.pathname(), 1);
+    TEST_ASSERT(readConcurrently(pathReader));
+
+    cphd::CPHDReader streamReader(mem::SharedPtr<io::SeekableInputStream>(
+            new io::FileInputStream(tempfile.pathname())), 1);
+    TEST_ASSERT(readConcurrently(streamReader));
+}
+
+TEST_CASE(testWrongNumberOfBuffers)
+{
+    io::TempFile tempfile;
+    writeCPHD(tempfile.pathname());
+    cphd::CPHDReader reader(tempfile.pathname(), 1);
+
+    std::vector<mem::BufferView<sys::ubyte> > buffers(NUM_CHANNELS - 1);
+    TEST_EXCEPTION(reader.readChannels(1, buffers));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testReadChannels);
+    TEST_CHECK(testReadConcurrently);
+    TEST_CHECK(testWrongNumberOfBuffers);
+    return 0;
+}
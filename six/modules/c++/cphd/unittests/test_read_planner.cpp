@@ -0,0 +1,234 @@
+/* =========================================================================
+ * This file is part of cphd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * cphd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <vector>
+
+#include <io/FileInputStream.h>
+#include <io/FileOutputStream.h>
+#include <io/TempFile.h>
+#include <mem/SharedPtr.h>
+#include <cphd/CPHDReader.h>
+#include <cphd/CPHDWriter.h>
+#include <cphd/ReadPlanner.h>
+
+#include "TestCase.h"
+
+namespace
+{
+const size_t FILE_SIZE = 4096;
+
+std::vector<sys::ubyte> writeFile(const std::string& pathname)
+{
+    std::vector<sys::ubyte> contents(FILE_SIZE);
+    for (size_t ii = 0; ii < contents.size(); ++ii)
+    {
+        contents[ii] = static_cast<sys::ubyte>(ii * 7 + ii / 256);
+    }
+
+    io::FileOutputStream outStream(pathname);
+    outStream.write(&contents[0], contents.size());
+    outStream.close();
+    return contents;
+}
+
+// Every 64 bytes, a 10 byte fragment, added in reverse order
+void addFragments(cphd::ReadPlanner& planner, std::vector<sys::ubyte>& dest)
+{
+    const size_t numFragments = FILE_SIZE / 64;
+    dest.assign(numFragments * 10, 0);
+    for (size_t ii = numFragments; ii > 0; --ii)
+    {
+        planner.add((ii - 1) * 64, 10, &dest[(ii - 1) * 10]);
+    }
+}
+
+bool checkFragments(const std::vector<sys::ubyte>& contents,
+                    const std::vector<sys::ubyte>& dest)
+{
+    for (size_t ii = 0; ii < dest.size(); ++ii)
+    {
+        if (dest[ii] != contents[(ii / 10) * 64 + ii % 10])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE(testPlan)
+{
+    std::vector<sys::ubyte> dest;
+
+    // Gaps are 54 bytes
+    cphd::ReadPlanner separate(53);
+    addFragments(separate, dest);
+    TEST_ASSERT_EQ(separate.plan().size(), FILE_SIZE / 64);
+
+    cphd::ReadPlanner merged(54);
+    addFragments(merged, dest);
+    const std::vector<cphd::ReadPlanner::Span>& spans = merged.plan();
+    TEST_ASSERT_EQ(spans.size(), static_cast<size_t>(1));
+    TEST_ASSERT_EQ(spans[0].offset, static_cast<sys::Off_T>(0));
+    TEST_ASSERT_EQ(spans[0].numBytes, FILE_SIZE - 54);
+    TEST_ASSERT_EQ(spans[0].numFragments, FILE_SIZE / 64);
+
+    // Four fragments fit in 202 bytes
+    cphd::ReadPlanner capped(54, 202);
+    addFragments(capped, dest);
+    TEST_ASSERT_EQ(capped.plan().size(), FILE_SIZE / 64 / 4);
+}
+
+TEST_CASE(testReadFile)
+{
+    io::TempFile tempfile;
+    const std::vector<sys::ubyte> contents = writeFile(tempfile.pathname());
+    sys::File file(tempfile.pathname());
+
+    const size_t gaps[] = {0, 54, 1000};
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        for (size_t numThreads = 1; numThreads <= 4; numThreads += 3)
+        {
+            cphd::ReadPlanner planner(gaps[ii], 512);
+            std::vector<sys::ubyte> dest;
+            addFragments(planner, dest);
+            planner.read(file, numThreads);
+            TEST_ASSERT(checkFragments(contents, dest));
+        }
+    }
+}
+
+TEST_CASE(testReadStream)
+{
+    io::TempFile tempfile;
+    const std::vector<sys::ubyte> contents = writeFile(tempfile.pathname());
+    io::FileInputStream inStream(tempfile.pathname());
+
+    const size_t gaps[] = {0, 54, 1000};
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        cphd::ReadPlanner planner(gaps[ii], 512);
+        std::vector<sys::ubyte> dest;
+        addFragments(planner, dest);
+        planner.read(inStream);
+        TEST_ASSERT(checkFragments(contents, dest));
+    }
+}
+
+TEST_CASE(testReadPastEnd)
+{
+    io::TempFile tempfile;
+    writeFile(tempfile.pathname());
+    sys::File file(tempfile.pathname());
+
+    cphd::ReadPlanner planner;
+    std::vector<sys::ubyte> dest(20);
+    planner.add(FILE_SIZE - 10, 20, &dest[0]);
+    TEST_EXCEPTION(planner.read(file, 1));
+}
+
+TEST_CASE(testWidebandWindow)
+{
+    // Same window read through a stream and through a pathname (which uses
+    // positional reads) with a few gap thresholds
+    const types::RowCol<size_t> dims(50, 40);
+    std::vector<std::complex<sys::Int16_T> > writeData(dims.area());
+    for (size_t ii = 0; ii < writeData.size(); ++ii)
+    {
+        writeData[ii] = std::complex<sys::Int16_T>(
+                static_cast<sys::Int16_T>(ii),
+                static_cast<sys::Int16_T>(-static_cast<int>(ii)));
+    }
+
+    cphd::Metadata metadata;
+    metadata.data.numCPHDChannels = 1;
+    metadata.data.arraySize.push_back(cphd::ArraySize(dims.row, dims.col));
+    metadata.data.sampleType = cphd::SampleType::RE16I_IM16I;
+    metadata.collectionInformation.radarMode =
+            cphd::RadarModeType::SPOTLIGHT;
+    for (size_t ii = 0; ii < six::LatLonAltCorners::NUM_CORNERS; ++ii)
+    {
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLat(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setLon(0.0);
+        metadata.global.imageArea.acpCorners.getCorner(ii).setAlt(0.0);
+    }
+    metadata.channel.parameters.push_back(cphd::ChannelParameters());
+    metadata.srp.srpType = cphd::SRPType::STEPPED;
+    metadata.global.domainType = cphd::DomainType::FX;
+    metadata.vectorParameters.fxParameters.reset(new cphd::FxParameters());
+    const cphd::VBM vbm(1, std::vector<size_t>(1, dims.row), false, false,
+                        false, metadata.global.domainType);
+
+    io::TempFile tempfile;
+    cphd::CPHDWriter writer(metadata, 1);
+    writer.writeMetadata(tempfile.pathname(), vbm);
+    writer.writeCPHDData(&writeData[0], dims.area());
+
+    const size_t firstVector = 3;
+    const size_t lastVector = 45;
+    const size_t firstSample = 7;
+    const size_t lastSample = 20;
+
+    cphd::CPHDReader pathReader(tempfile.pathname(), 1);
+    cphd::CPHDReader streamReader(mem::SharedPtr<io::SeekableInputStream>(
+            new io::FileInputStream(tempfile.pathname())), 1);
+    cphd::CPHDReader* readers[] = {&pathReader, &streamReader};
+
+    const size_t gaps[] = {0, 100, 1000};
+    for (size_t ii = 0; ii < 2; ++ii)
+    {
+        for (size_t jj = 0; jj < 3; ++jj)
+        {
+            cphd::Wideband& wideband = readers[ii]->getWideband();
+            wideband.setMaxGapBytes(gaps[jj]);
+
+            mem::ScopedArray<sys::ubyte> data;
+            wideband.read(0, firstVector, lastVector, firstSample,
+                          lastSample, 2, data);
+
+            const std::complex<sys::Int16_T>* const samples =
+                    reinterpret_cast<std::complex<sys::Int16_T>*>(
+                            data.get());
+            for (size_t vector = firstVector, idx = 0; vector <= lastVector;
+                 ++vector)
+            {
+                for (size_t sample = firstSample; sample <= lastSample;
+                     ++sample, ++idx)
+                {
+                    TEST_ASSERT_EQ(samples[idx],
+                                   writeData[vector * dims.col + sample]);
+                }
+            }
+        }
+    }
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testPlan);
+    TEST_CHECK(testReadFile);
+    TEST_CHECK(testReadStream);
+    TEST_CHECK(testReadPastEnd);
+    TEST_CHECK(testWidebandWindow);
+    return 0;
+}
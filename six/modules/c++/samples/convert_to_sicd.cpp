@@ -0,0 +1,107 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <iostream>
+
+#include <import/cli.h>
+#include <import/six.h>
+#include <import/six/convert.h>
+#include <import/six/sicd.h>
+#include <sys/StopWatch.h>
+#include "utils.h"
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        cli::ArgumentParser parser;
+        parser.setDescription("This program converts a vendor format image "
+                              "to SICD a band of rows at a time, without "
+                              "holding the whole image in memory.");
+        parser.addArgument("-p --plugin",
+                           "Specify a plugin or directory of plugins for "
+                           "converting from external vendor format to SICD",
+                           cli::STORE, "plugin", "PLUGIN", 1, 1);
+        parser.addArgument("-t --threads",
+                           "Number of threads to use (default: one per core)",
+                           cli::STORE, "threads", "NUM")->setDefault(0);
+        parser.addArgument("-b --band", "Max size of a band of rows",
+                           cli::STORE, "bandMB", "MB")->setDefault(
+                           six::convert::StreamingConverter::
+                                   DEFAULT_MAX_BAND_BYTES / (1024 * 1024));
+        parser.addArgument("-s --schema",
+                           "Specify a schema or directory of schemas",
+                           cli::STORE);
+        parser.addArgument("input", "Input file", cli::STORE, "input",
+                           "INPUT", 1, 1);
+        parser.addArgument("output", "Output SICD", cli::STORE, "output",
+                           "OUTPUT", 1, 1);
+
+        const std::auto_ptr<cli::Results> options(parser.parse(argc, argv));
+        const std::string plugin(options->get<std::string>("plugin"));
+        const std::string inputFile(options->get<std::string>("input"));
+        const std::string outputFile(options->get<std::string>("output"));
+        const size_t numThreads(options->get<size_t>("threads"));
+        const size_t maxBandBytes(
+                options->get<size_t>("bandMB") * 1024 * 1024);
+        std::vector<std::string> schemaPaths;
+        getSchemaPaths(*options, "--schema", "schema", schemaPaths);
+
+        six::XMLControlRegistry xmlRegistry;
+        xmlRegistry.addCreator(six::DataType::COMPLEX,
+                               new six::XMLControlCreatorT<
+                                       six::sicd::ComplexXMLControl>());
+
+        sys::RealTimeStopWatch watch;
+        watch.start();
+
+        six::convert::ConvertingReadControl reader(plugin);
+        reader.setXMLControlRegistry(&xmlRegistry);
+        reader.load(inputFile, schemaPaths);
+
+        const six::convert::StreamingConverter converter(
+                reader, numThreads, maxBandBytes);
+        std::cout << "Converting " << reader.getConverter().getFileType()
+                  << " in bands of " << converter.getNumRowsPerBand()
+                  << " rows\n";
+        converter.convert(outputFile, schemaPaths);
+
+        std::cout << "Wrote " << outputFile << " in " << watch.stop()
+                  << " ms\n";
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << ex.toString() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+        return 1;
+    }
+    return 0;
+}
@@ -37,5 +37,7 @@
 #include <scene/Utilities.h>
 #include <scene/ProjectionModel.h>
 #include <scene/ProjectionPolynomialFitter.h>
+#include <scene/RPCModel.h>
+#include <scene/RPCFitter.h>
 
 #endif
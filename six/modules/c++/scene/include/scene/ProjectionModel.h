@@ -280,6 +280,61 @@ public:
             const Vector3& scenePoint,
             double delta = 0.0001) const;
 
+    /*!
+     * The partials below are closed-form alternatives to the finite
+     * difference partials above.  Each needs both the scene point and the
+     * image grid point it projects to, and costs about as much as one
+     * imageToScene() rather than one projection per partial.  They solve the
+     * linearized R/Rdot contour equations directly rather than perturbing
+     * and re-projecting, so the finite difference versions remain the
+     * reference to validate against.
+     *
+     * The rotation of the RIC frame over the image is not included when
+     * adjustable parameters are set, which is well below the finite
+     * difference error.
+     */
+
+    //! Closed-form version of sceneToImagePartials()
+    math::linear::MatrixMxN<2, 3> sceneToImagePartialsAnalytic(
+            const Vector3& scenePoint,
+            const types::RowCol<double>& imageGridPoint) const;
+
+    //! Closed-form version of sceneToImageSensorPartials()
+    math::linear::MatrixMxN<2, 7> sceneToImageSensorPartialsAnalytic(
+            const Vector3& scenePoint,
+            const types::RowCol<double>& imageGridPoint) const;
+
+    /*!
+     * Closed-form version of imageToScenePartials().  The height is taken
+     * from scenePoint.
+     */
+    math::linear::MatrixMxN<3, 2> imageToScenePartialsAnalytic(
+            const types::RowCol<double>& imageGridPoint,
+            const Vector3& scenePoint) const;
+
+    //! Closed-form version of imageToSceneSensorPartials()
+    math::linear::MatrixMxN<3, 7> imageToSceneSensorPartialsAnalytic(
+            const types::RowCol<double>& imageGridPoint,
+            const Vector3& scenePoint) const;
+
+    //! Closed-form version of imageToSceneHeightPartial()
+    math::linear::MatrixMxN<3, 1> imageToSceneHeightPartialAnalytic(
+            const types::RowCol<double>& imageGridPoint,
+            const Vector3& scenePoint) const;
+
+    /*!
+     * Computes the derivatives of the R/Rdot contour with respect to the
+     * image grid point.  These are total derivatives, so they include the
+     * change in timeCOA (and so ARP position and velocity) across the grid.
+     *
+     * This implementation uses central differences of computeContour().
+     * Subclasses override it with closed forms where they have them.
+     *
+     * \return [dR/dRow dR/dCol; dRdot/dRow dRdot/dCol]
+     */
+    virtual math::linear::MatrixMxN<2, 2> computeContourPartials(
+            const types::RowCol<double>& imageGridPoint) const;
+
     /*!
      * Provides sensor error covariance matrix with tropo and iono errors
      * rolled in
@@ -351,6 +406,38 @@ protected:
                                 Vector3& arpCOA,
                                 Vector3& velCOA) const;
 
+    // Evaluates timeCOA, ARP position, and ARP velocity at the image grid
+    // point, then computeContour()
+    void computeContourAt(const types::RowCol<double>& imageGridPoint,
+                          double* r,
+                          double* rDot) const;
+
+    // Derivatives of dTimeCOA/dRow and dTimeCOA/dCol
+    types::RowCol<double> computeImageTimePartials(
+            const types::RowCol<double>& imageGridPoint) const;
+
+    // The scene point and image grid point are tied together by two
+    // equations: the scene point's range from the adjusted ARP must equal
+    // the adjusted contour range, and its range rate must equal the contour
+    // range rate.  These are the derivatives of those two residuals.
+    struct ContourResidualPartials
+    {
+        math::linear::MatrixMxN<2, 2> image;
+        math::linear::MatrixMxN<2, 3> scene;
+        math::linear::MatrixMxN<2, 7> sensor;
+    };
+
+    void computeContourResidualPartials(
+            const Vector3& scenePoint,
+            const types::RowCol<double>& imageGridPoint,
+            ContourResidualPartials& partials) const;
+
+    // Inverse of the residual partials w.r.t. the scene point, augmented by
+    // the constant height constraint at the scene point
+    math::linear::MatrixMxN<3, 3> getHeightConstrainedInverse(
+            const Vector3& scenePoint,
+            const ContourResidualPartials& partials) const;
+
 protected:
     Vector3 mSlantPlaneNormal;
     Vector3 mImagePlaneNormal;
@@ -358,7 +445,10 @@ protected:
     double mScaleFactor;
     math::poly::OneD<Vector3> mARPPoly;
     math::poly::OneD<Vector3> mARPVelPoly;
+    math::poly::OneD<Vector3> mARPAccPoly;
     math::poly::TwoD<double> mTimeCOAPoly;
+    math::poly::TwoD<double> mTimeCOAPolyRowPrime;
+    math::poly::TwoD<double> mTimeCOAPolyColPrime;
     int mLookDir;
 
     AdjustableParams mAdjustableParams;
@@ -410,11 +500,16 @@ public:
                                 double* r,
                                 double* rDot) const;
 
+    virtual math::linear::MatrixMxN<2, 2> computeContourPartials(
+            const types::RowCol<double>& imageGridPoint) const;
+
 private:
     math::poly::OneD<double> mPolarAnglePoly;
     math::poly::OneD<double> mPolarAnglePolyPrime;
+    math::poly::OneD<double> mPolarAnglePolyPrime2;
     math::poly::OneD<double> mKSFPoly;
     math::poly::OneD<double> mKSFPolyPrime;
+    math::poly::OneD<double> mKSFPolyPrime2;
 };
 
 class RangeZeroProjectionModel : public ProjectionModelWithImageVectors
@@ -439,9 +534,15 @@ public:
                                 double* r,
                                 double* rDot) const;
 
+    virtual math::linear::MatrixMxN<2, 2> computeContourPartials(
+            const types::RowCol<double>& imageGridPoint) const;
+
 private:
     math::poly::OneD<double> mTimeCAPoly;
+    math::poly::OneD<double> mTimeCAPolyPrime;
     math::poly::TwoD<double> mDSRFPoly;
+    math::poly::TwoD<double> mDSRFPolyRowPrime;
+    math::poly::TwoD<double> mDSRFPolyColPrime;
     double mRangeCA;
 };
 
@@ -463,6 +564,9 @@ public:
                                 const types::RowCol<double>& imageGridPoint,
                                 double* r,
                                 double* rDot) const;
+
+    virtual math::linear::MatrixMxN<2, 2> computeContourPartials(
+            const types::RowCol<double>& imageGridPoint) const;
 };
 
 typedef PlaneProjectionModel XRGYCRProjectionModel;
@@ -22,7 +22,14 @@
 #ifndef __SCENE_PROJECTION_POLYNOMIAL_FITTER_H__
 #define __SCENE_PROJECTION_POLYNOMIAL_FITTER_H__
 
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <math/poly/Fit.h>
+#include <mem/SharedPtr.h>
+#include <sys/Mutex.h>
 #include <scene/GridECEFTransform.h>
 #include <scene/ProjectionModel.h>
 #include <math/linear/Matrix2D.h>
@@ -33,13 +40,19 @@ namespace scene
  * \class ProjectionPolynomialFitter
  * \brief Used to fit output --> slant and/or time COA polynomials based on
  * sampling sceneToImage() across the output plane
- * versa
+ *
+ * The samples are projected in parallel.  Since every polynomial this class
+ * fits is a function of either the output plane samples or the slant plane
+ * samples (up to a scale and shift, which the normalization that
+ * math::poly::fit() does cancels out), the least squares solution for each
+ * polynomial order is computed once and reused across all fits of that
+ * order.
  */
 class ProjectionPolynomialFitter
 {
 public:
     static const size_t DEFAULTS_POINTS_1D;
-
+    static const size_t DEFAULT_MAX_POINTS_1D;
 
     /* Samples a numPoints1D x numPoints1D grid of points that spans
      * outExtent using sceneToImage().
@@ -55,13 +68,17 @@ public:
      * \param outExtent Output extent in pixels
      * \param numPoints1D Number of points to use in each direction when
      * sampling the grid.  Defaults to 10.
+     * \param numThreads Number of threads to use when sampling.  If 0, uses
+     * all the workers in tasks::SharedTaskScheduler.  projModel and
+     * gridTransform must be safe to call concurrently.
      */
     ProjectionPolynomialFitter(
             const ProjectionModel& projModel,
             const GridECEFTransform& gridTransform,
             const types::RowCol<double>& outPixelStart,
             const types::RowCol<size_t>& outExtent,
-            size_t numPoints1D = DEFAULTS_POINTS_1D);
+            size_t numPoints1D = DEFAULTS_POINTS_1D,
+            size_t numThreads = 0);
 
     /* Samples a numPoints1D x numPoints1D grid of points that spans
      * the extent of a polygon using sceneToImage().
@@ -80,6 +97,9 @@ public:
      * determine the grid of points.
      * \param numPoints1D Number of points to use in each direction when
      * sampling the grid.  Defaults to 10.
+     * \param numThreads Number of threads to use when sampling.  If 0, uses
+     * all the workers in tasks::SharedTaskScheduler.  projModel and
+     * gridTransform must be safe to call concurrently.
      */
     ProjectionPolynomialFitter(
             const ProjectionModel& projModel,
@@ -88,7 +108,62 @@ public:
             const types::RowCol<double>& outPixelStart,
             const types::RowCol<size_t>& outExtent,
             const std::vector<types::RowCol<double> >& polygon,
-            size_t numPoints1D = DEFAULTS_POINTS_1D);
+            size_t numPoints1D = DEFAULTS_POINTS_1D,
+            size_t numThreads = 0);
+
+    /* Samples the same grid as the first constructor, but picks the
+     * density adaptively.  Starting at numPoints1D, the density is raised
+     * from N to 2N - 1 points in each direction until output --> slant
+     * polynomials of the given order fit at one density predict every
+     * sample of the next density to within maxResidualError slant plane
+     * pixels, or until maxNumPoints1D is reached.  The fitter for the last
+     * density sampled is returned.
+     *
+     * \param projModel Projection model that knows how to use sceneToImage()
+     * to convert from an ECEF location to meters from the slant plane SCP
+     * \param gridTransform Transform that knows how to convert from
+     * output row/col pixel space to ECEF space
+     * \param outPixelStart Output space start pixel
+     * \param outExtent Output extent in pixels
+     * \param slantSampleSpacing Slant plane sample spacing, used to convert
+     * the residuals from meters to pixels
+     * \param polyOrderX Polynomial order that will be used when fitting the
+     * polynomials in the x direction
+     * \param polyOrderY Polynomial order that will be used when fitting the
+     * polynomials in the y direction
+     * \param maxResidualError Largest acceptable residual error in slant
+     * plane pixels
+     * \param numPoints1D Number of points in each direction to start with
+     * \param maxNumPoints1D Most points in each direction to sample
+     * \param numThreads Number of threads to use when sampling.  If 0, uses
+     * all the workers in tasks::SharedTaskScheduler.
+     * \param achievedResidualError [output] Optional.  Largest residual
+     * error in slant plane pixels at the returned density.  If the bound was
+     * not met, this is larger than maxResidualError.
+     *
+     * \return The fitter
+     */
+    static std::auto_ptr<ProjectionPolynomialFitter> createAdaptive(
+            const ProjectionModel& projModel,
+            const GridECEFTransform& gridTransform,
+            const types::RowCol<double>& outPixelStart,
+            const types::RowCol<size_t>& outExtent,
+            const types::RowCol<double>& slantSampleSpacing,
+            size_t polyOrderX,
+            size_t polyOrderY,
+            double maxResidualError,
+            size_t numPoints1D = DEFAULTS_POINTS_1D,
+            size_t maxNumPoints1D = DEFAULT_MAX_POINTS_1D,
+            size_t numThreads = 0,
+            double* achievedResidualError = NULL);
+
+    ~ProjectionPolynomialFitter();
+
+    //! Number of points sampled in each direction
+    size_t getNumPoints1D() const
+    {
+        return mNumPoints1D;
+    }
 
     // Returns the output plane rows used during sampling in case you want to
     // do your own polynomial fitting
@@ -318,12 +393,29 @@ public:
     }
 
 private:
-    void projectToSlantPlane(const ProjectionModel& projModel,
-                             const GridECEFTransform& gridTransform,
-                             const types::RowCol<double>& outPixelStart,
-                             const types::RowCol<double>& currentOffset,
-                             size_t row,
-                             size_t col);
+    class LeastSquaresSolver;
+    typedef std::pair<size_t, size_t> PolyOrder;
+    typedef std::map<PolyOrder, mem::SharedPtr<const LeastSquaresSolver> >
+            SolverCache;
+
+    // Projects the output plane pixels, which are in row-major order, into
+    // the slant plane
+    void projectToSlantPlane(
+            const ProjectionModel& projModel,
+            const GridECEFTransform& gridTransform,
+            const types::RowCol<double>& outPixelStart,
+            const std::vector<types::RowCol<double> >& outputPixels,
+            size_t numThreads);
+
+    // Returns the cached solver for fits whose inputs are the output plane
+    // samples
+    const LeastSquaresSolver& getOutputPlaneSolver(size_t polyOrderX,
+                                                   size_t polyOrderY) const;
+
+    // Returns the cached solver for fits whose inputs are the slant plane
+    // samples
+    const LeastSquaresSolver& getSlantPlaneSolver(size_t polyOrderX,
+                                                  size_t polyOrderY) const;
 
     void getSlantPlaneSamples(
             const types::RowCol<size_t>& inPixelStart,
@@ -339,6 +431,10 @@ private:
     math::linear::Matrix2D<double> mOutputPlaneCols;
     math::linear::Matrix2D<types::RowCol<double> > mSceneCoordinates;
     math::linear::Matrix2D<double> mTimeCOA;
+
+    mutable sys::Mutex mSolverMutex;
+    mutable SolverCache mOutputPlaneSolvers;
+    mutable SolverCache mSlantPlaneSolvers;
 };
 }
 
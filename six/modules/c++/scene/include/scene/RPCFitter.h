@@ -0,0 +1,117 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SCENE_RPC_FITTER_H__
+#define __SCENE_RPC_FITTER_H__
+
+#include <vector>
+
+#include <types/RowCol.h>
+#include <scene/ProjectionModel.h>
+#include <scene/RPCModel.h>
+
+namespace scene
+{
+/*!
+ * \class RPCFitter
+ * \brief Used to fit an RPCModel to a rigorous projection model by sampling
+ * imageToScene() over a 3D grid
+ *
+ * Like ProjectionPolynomialFitter, this samples a numPoints1D x numPoints1D
+ * grid of pixels spanning the image.  Since an RPC is a function of height
+ * as well, each pixel is projected to numHeights heights spread evenly
+ * between a min and max height.
+ */
+class RPCFitter
+{
+public:
+    static const size_t DEFAULT_POINTS_1D;
+    static const size_t DEFAULT_NUM_HEIGHTS;
+
+    /*
+     * Samples the grid described above
+     *
+     * \param projModel Projection model that knows how to use
+     * imageToScene() to convert from meters from the SCP to ECEF
+     * \param sceneCenter Pixel in row/col of the point projModel's image
+     * coordinates are relative to (i.e. the SCP pixel, accounting for any
+     * AOI)
+     * \param sampleSpacing Sample spacing in meters/pixel
+     * \param extent Image extent in pixels
+     * \param minHeight Lowest height to sample in meters above the WGS-84
+     * ellipsoid
+     * \param maxHeight Highest height to sample in meters above the WGS-84
+     * ellipsoid
+     * \param numPoints1D Number of points to use in each direction when
+     * sampling the image.  Defaults to 10.
+     * \param numHeights Number of heights to sample each point at.
+     * Defaults to 5.
+     */
+    RPCFitter(const ProjectionModel& projModel,
+              const types::RowCol<double>& sceneCenter,
+              const types::RowCol<double>& sampleSpacing,
+              const types::RowCol<size_t>& extent,
+              double minHeight,
+              double maxHeight,
+              size_t numPoints1D = DEFAULT_POINTS_1D,
+              size_t numHeights = DEFAULT_NUM_HEIGHTS);
+
+    // Returns the pixels used during sampling in case you want to do your
+    // own fitting
+    const std::vector<types::RowCol<double> >& getImagePoints() const
+    {
+        return mImagePoints;
+    }
+
+    // Returns the ground point computed for each pixel in
+    // getImagePoints() in case you want to do your own fitting
+    const std::vector<LatLonAlt>& getGroundPoints() const
+    {
+        return mGroundPoints;
+    }
+
+    /*
+     * Uses the samples computed in the constructor to fit an RPC.  The
+     * offsets and scales are chosen so that they're exactly representable
+     * in an RPC00B TRE.  The coefficients are solved for via linear least
+     * squares, reweighted by the denominators from the previous pass so
+     * that the residuals minimized approach the pixel errors.  Optionally
+     * reports the residual errors in pixels between the RPC and the
+     * samples.
+     *
+     * \param rpc [output] The fit RPC.  The error bias and random error are
+     * left unknown since they describe the rigorous model, not the fit.
+     * \param rmsResidualError [output] Optional.  Root mean square residual
+     * error in the line and sample.
+     * \param maxResidualError [output] Optional.  Maximum absolute residual
+     * error in the line and sample.
+     */
+    void fit(RPCModel& rpc,
+             types::RowCol<double>* rmsResidualError = NULL,
+             types::RowCol<double>* maxResidualError = NULL) const;
+
+private:
+    std::vector<types::RowCol<double> > mImagePoints;
+    std::vector<LatLonAlt> mGroundPoints;
+};
+}
+
+#endif
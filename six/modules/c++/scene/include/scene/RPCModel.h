@@ -0,0 +1,184 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SCENE_RPC_MODEL_H__
+#define __SCENE_RPC_MODEL_H__
+
+#include <stddef.h>
+
+#include <types/RowCol.h>
+#include <scene/Types.h>
+
+namespace scene
+{
+/*!
+ * \class RPCModel
+ * \brief Rational polynomial camera model, laid out like the NITF RPC00B TRE
+ *
+ * Maps a geodetic ground point to an image pixel as the ratio of two cubic
+ * polynomials in normalized latitude, longitude, and height, one pair for
+ * the line (row) and one for the sample (column).  Each polynomial has
+ * NUM_COEFFS coefficients in RPC00B term order:
+ *
+ *   1, L, P, H, LP, LH, PH, L^2, P^2, H^2, PLH, L^3, LP^2, LH^2, L^2P, P^3,
+ *   PH^2, L^2H, P^2H, H^3
+ *
+ * where P, L, and H are latitude, longitude, and height minus their offset
+ * over their scale.  The line and sample come back normalized the same way.
+ *
+ * Pixels are 0-based with 0,0 at the center of the first pixel, matching
+ * the rest of SIX.  Latitudes and longitudes are in degrees and heights are
+ * meters above the WGS-84 ellipsoid.
+ *
+ * This is an approximation of the rigorous model it was fit from (see
+ * RPCFitter), but evaluating it is a few dozen multiply-adds per point
+ * rather than an iterative R/Rdot solution.
+ */
+class RPCModel
+{
+public:
+    static const size_t NUM_COEFFS = 20;
+
+    //! Zero offsets and numerators, unit scales and denominators
+    RPCModel();
+
+    /*!
+     * Project a ground point into the image
+     *
+     * \param groundPt Ground point
+     *
+     * \return The pixel
+     */
+    types::RowCol<double> groundToImage(const LatLonAlt& groundPt) const;
+
+    /*!
+     * Project an array of ground points into the image.  The points are
+     * worked on in blocks so the polynomial evaluation vectorizes, which
+     * makes this much faster per point than calling the method above in a
+     * loop.
+     *
+     * \param groundPts Ground points
+     * \param numPoints Number of points
+     * \param imagePts [output] Pixels.  Must hold numPoints elements.
+     */
+    void groundToImage(const LatLonAlt* groundPts,
+                       size_t numPoints,
+                       types::RowCol<double>* imagePts) const;
+
+    //! Same as groundToImage() but takes an ECEF point
+    types::RowCol<double> sceneToImage(const Vector3& scenePt) const;
+
+    /*!
+     * Project a pixel to the ground at a given height.  This inverts the
+     * RPC via Newton's method.
+     *
+     * \param imagePt Pixel
+     * \param height Height in meters above the WGS-84 ellipsoid
+     * \param tolerance Convergence tolerance in pixels
+     * \param maxNumIters Maximum number of iterations to perform
+     *
+     * \return The ground point
+     *
+     * \throws except::Exception if the iteration doesn't converge
+     */
+    LatLonAlt imageToGround(const types::RowCol<double>& imagePt,
+                            double height,
+                            double tolerance = 1e-6,
+                            size_t maxNumIters = 20) const;
+
+    /*!
+     * Project an array of pixels to the ground
+     *
+     * \param imagePts Pixels
+     * \param heights Height of each pixel in meters above the WGS-84
+     * ellipsoid
+     * \param numPoints Number of points
+     * \param groundPts [output] Ground points.  Must hold numPoints elements.
+     *
+     * \throws except::Exception if any point doesn't converge
+     */
+    void imageToGround(const types::RowCol<double>* imagePts,
+                       const double* heights,
+                       size_t numPoints,
+                       LatLonAlt* groundPts) const;
+
+    //! Same as imageToGround() but returns an ECEF point
+    Vector3 imageToScene(const types::RowCol<double>& imagePt,
+                         double height) const;
+
+    /*!
+     * Normalize a ground point by the offsets and scales
+     *
+     * \param groundPt Ground point
+     * \param lat [output] Normalized latitude (P)
+     * \param lon [output] Normalized longitude (L)
+     * \param height [output] Normalized height (H)
+     */
+    void normalize(const LatLonAlt& groundPt,
+                   double& lat,
+                   double& lon,
+                   double& height) const;
+
+    /*!
+     * Compute the polynomial terms for a normalized ground point
+     *
+     * \param lat Normalized latitude (P)
+     * \param lon Normalized longitude (L)
+     * \param height Normalized height (H)
+     * \param terms [output] The NUM_COEFFS terms in RPC00B order
+     */
+    static void computeTerms(double lat,
+                             double lon,
+                             double height,
+                             double* terms);
+
+    bool operator==(const RPCModel& rhs) const;
+
+    bool operator!=(const RPCModel& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+public:
+    //! Bias and random error in meters, or negative if unknown
+    double errorBias;
+    double errorRandom;
+
+    double lineOffset;
+    double sampleOffset;
+    double latOffset;
+    double lonOffset;
+    double heightOffset;
+
+    double lineScale;
+    double sampleScale;
+    double latScale;
+    double lonScale;
+    double heightScale;
+
+    double lineNumCoeffs[NUM_COEFFS];
+    double lineDenCoeffs[NUM_COEFFS];
+    double sampleNumCoeffs[NUM_COEFFS];
+    double sampleDenCoeffs[NUM_COEFFS];
+};
+}
+
+#endif
@@ -49,6 +49,40 @@ scene::Vector3 computeUnitVector(const scene::LatLonAlt& latLon)
     return unitVector;
 }
 
+// Grid step for the central difference contour partials
+const double CONTOUR_PARTIALS_DELTA = 0.01;
+
+template<typename PolyType>
+PolyType derivativeOrEmpty(const PolyType& polynomial)
+{
+    return polynomial.empty() ? PolyType() : polynomial.derivative();
+}
+
+math::poly::TwoD<double> rowDerivativeOrEmpty(
+        const math::poly::TwoD<double>& polynomial)
+{
+    return polynomial.empty() ? math::poly::TwoD<double>() :
+                                polynomial.derivativeX();
+}
+
+math::poly::TwoD<double> colDerivativeOrEmpty(
+        const math::poly::TwoD<double>& polynomial)
+{
+    return polynomial.empty() ? math::poly::TwoD<double>() :
+                                polynomial.derivativeY();
+}
+
+scene::Vector3 getColumn(const math::linear::MatrixMxN<3, 3>& matrix,
+                         size_t col)
+{
+    scene::Vector3 vec;
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        vec[ii] = matrix(ii, col);
+    }
+    return vec;
+}
+
 template<typename PolyType>
 PolyType verboseDerivative(const PolyType& polynomial, const std::string& name)
 {
@@ -74,7 +108,10 @@ ProjectionModel(const Vector3& slantPlaneNormal,
     mSCP(scp),
     mARPPoly(arpPoly),
     mARPVelPoly(verboseDerivative(arpPoly, "arpPoly")),
+    mARPAccPoly(mARPVelPoly.derivative()),
     mTimeCOAPoly(timeCOAPoly),
+    mTimeCOAPolyRowPrime(rowDerivativeOrEmpty(timeCOAPoly)),
+    mTimeCOAPolyColPrime(colDerivativeOrEmpty(timeCOAPoly)),
     mLookDir(lookDir),
     mErrors(errors)
 {
@@ -618,6 +655,226 @@ math::linear::MatrixMxN<2, 3> ProjectionModel::sceneToImagePartials(
     return sceneToImagePartials(scenePoint, imagePt, delta);
 }
 
+void ProjectionModel::computeContourAt(
+        const types::RowCol<double>& imageGridPoint,
+        double* r,
+        double* rDot) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    computeContour(mARPPoly(timeCOA), mARPVelPoly(timeCOA), timeCOA,
+                   imageGridPoint, r, rDot);
+}
+
+types::RowCol<double> ProjectionModel::computeImageTimePartials(
+        const types::RowCol<double>& imageGridPoint) const
+{
+    return types::RowCol<double>(
+            mTimeCOAPolyRowPrime(imageGridPoint.row, imageGridPoint.col),
+            mTimeCOAPolyColPrime(imageGridPoint.row, imageGridPoint.col));
+}
+
+math::linear::MatrixMxN<2, 2> ProjectionModel::computeContourPartials(
+        const types::RowCol<double>& imageGridPoint) const
+{
+    math::linear::MatrixMxN<2, 2> partials(0.0);
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        types::RowCol<double> plus(imageGridPoint);
+        types::RowCol<double> minus(imageGridPoint);
+        double& plusCoord = (idx == 0) ? plus.row : plus.col;
+        double& minusCoord = (idx == 0) ? minus.row : minus.col;
+        plusCoord += CONTOUR_PARTIALS_DELTA;
+        minusCoord -= CONTOUR_PARTIALS_DELTA;
+
+        double rPlus;
+        double rDotPlus;
+        double rMinus;
+        double rDotMinus;
+        computeContourAt(plus, &rPlus, &rDotPlus);
+        computeContourAt(minus, &rMinus, &rDotMinus);
+
+        partials(0, idx) = (rPlus - rMinus) / (2 * CONTOUR_PARTIALS_DELTA);
+        partials(1, idx) =
+                (rDotPlus - rDotMinus) / (2 * CONTOUR_PARTIALS_DELTA);
+    }
+    return partials;
+}
+
+void ProjectionModel::computeContourResidualPartials(
+        const Vector3& scenePoint,
+        const types::RowCol<double>& imageGridPoint,
+        ContourResidualPartials& partials) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const Vector3 arpCOA = mARPPoly(timeCOA);
+    const Vector3 velCOA = mARPVelPoly(timeCOA);
+    const Vector3 accCOA = mARPAccPoly(timeCOA);
+
+    // The residuals are evaluated against the adjusted ARP
+    double rangeBias(0.0);
+    Vector3 adjustedARP(arpCOA);
+    Vector3 adjustedVel(velCOA);
+    imageToSceneAdjustment(AdjustableParams(), timeCOA, rangeBias,
+                           adjustedARP, adjustedVel);
+
+    // Residuals are
+    //   |P - ARP| - (R + range bias)
+    //   -(P - ARP) . V / |P - ARP| - Rdot
+    // so w.r.t. the ARP they have partials [-u; w] and w.r.t. V [0; -u]
+    const Vector3 los = scenePoint - adjustedARP;
+    const double range = los.norm();
+    const Vector3 u = los * (1.0 / range);
+    const Vector3 w = (adjustedVel - u * u.dot(adjustedVel)) * (1.0 / range);
+
+    const math::linear::MatrixMxN<2, 2> contourPartials =
+            computeContourPartials(imageGridPoint);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        const double dTime = (idx == 0) ? timePartials.row : timePartials.col;
+        const Vector3 dARP = velCOA * dTime;
+        const Vector3 dVel = accCOA * dTime;
+        partials.image(0, idx) = -u.dot(dARP) - contourPartials(0, idx);
+        partials.image(1, idx) =
+                w.dot(dARP) - u.dot(dVel) - contourPartials(1, idx);
+    }
+
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        partials.scene(0, idx) = u[idx];
+        partials.scene(1, idx) = -w[idx];
+    }
+
+    // Same frames imageToSceneAdjustment() applies a delta in
+    math::linear::MatrixMxN<3, 3> deltaToECEF(0.0);
+    switch (mErrors.mFrameType.mValue)
+    {
+    case FrameType::RIC_ECF:
+        deltaToECEF = getRICtoECEFTransformMatrix(0.0, timeCOA);
+        break;
+    case FrameType::RIC_ECI:
+        deltaToECEF = getRICtoECEFTransformMatrix(EARTH_ROTATION_RATE,
+                                                  timeCOA);
+        break;
+    case FrameType::ECF:
+        deltaToECEF(0, 0) = deltaToECEF(1, 1) = deltaToECEF(2, 2) = 1.0;
+        break;
+    default:
+        throw except::Exception(Ctxt(
+                "Reference Frame for error parameters undefined"));
+    }
+
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        const Vector3 direction = getColumn(deltaToECEF, idx);
+        partials.sensor(0, AdjustableParams::ARP_RADIAL + idx) =
+                -u.dot(direction);
+        partials.sensor(1, AdjustableParams::ARP_RADIAL + idx) =
+                w.dot(direction);
+        partials.sensor(0, AdjustableParams::ARP_VEL_RADIAL + idx) = 0.0;
+        partials.sensor(1, AdjustableParams::ARP_VEL_RADIAL + idx) =
+                -u.dot(direction);
+    }
+    partials.sensor(0, AdjustableParams::RANGE_BIAS) = -1.0;
+    partials.sensor(1, AdjustableParams::RANGE_BIAS) = 0.0;
+}
+
+math::linear::MatrixMxN<3, 3> ProjectionModel::getHeightConstrainedInverse(
+        const Vector3& scenePoint,
+        const ContourResidualPartials& partials) const
+{
+    // The gradient of height above the ellipsoid is the geodetic up vector
+    const Vector3 up = computeUnitVector(Utilities::ecefToLatLon(scenePoint));
+
+    math::linear::MatrixMxN<3, 3> constraints;
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        constraints(0, idx) = partials.scene(0, idx);
+        constraints(1, idx) = partials.scene(1, idx);
+        constraints(2, idx) = up[idx];
+    }
+    return math::linear::inverse<3, double>(constraints);
+}
+
+math::linear::MatrixMxN<2, 3> ProjectionModel::sceneToImagePartialsAnalytic(
+        const Vector3& scenePoint,
+        const types::RowCol<double>& imageGridPoint) const
+{
+    ContourResidualPartials partials;
+    computeContourResidualPartials(scenePoint, imageGridPoint, partials);
+
+    // The residuals stay zero, so d(image) = -inv(dF/dImage) dF/dScene
+    return -1.0 * (math::linear::inverse<2, double>(partials.image) *
+                   partials.scene);
+}
+
+math::linear::MatrixMxN<2, 7>
+ProjectionModel::sceneToImageSensorPartialsAnalytic(
+        const Vector3& scenePoint,
+        const types::RowCol<double>& imageGridPoint) const
+{
+    ContourResidualPartials partials;
+    computeContourResidualPartials(scenePoint, imageGridPoint, partials);
+    return -1.0 * (math::linear::inverse<2, double>(partials.image) *
+                   partials.sensor);
+}
+
+math::linear::MatrixMxN<3, 2> ProjectionModel::imageToScenePartialsAnalytic(
+        const types::RowCol<double>& imageGridPoint,
+        const Vector3& scenePoint) const
+{
+    ContourResidualPartials partials;
+    computeContourResidualPartials(scenePoint, imageGridPoint, partials);
+
+    math::linear::MatrixMxN<3, 2> residuals(0.0);
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        residuals(0, idx) = partials.image(0, idx);
+        residuals(1, idx) = partials.image(1, idx);
+    }
+    return -1.0 * (getHeightConstrainedInverse(scenePoint, partials) *
+                   residuals);
+}
+
+math::linear::MatrixMxN<3, 7>
+ProjectionModel::imageToSceneSensorPartialsAnalytic(
+        const types::RowCol<double>& imageGridPoint,
+        const Vector3& scenePoint) const
+{
+    ContourResidualPartials partials;
+    computeContourResidualPartials(scenePoint, imageGridPoint, partials);
+
+    math::linear::MatrixMxN<3, 7> residuals(0.0);
+    for (size_t idx = 0; idx < 7; ++idx)
+    {
+        residuals(0, idx) = partials.sensor(0, idx);
+        residuals(1, idx) = partials.sensor(1, idx);
+    }
+    return -1.0 * (getHeightConstrainedInverse(scenePoint, partials) *
+                   residuals);
+}
+
+math::linear::MatrixMxN<3, 1>
+ProjectionModel::imageToSceneHeightPartialAnalytic(
+        const types::RowCol<double>& imageGridPoint,
+        const Vector3& scenePoint) const
+{
+    ContourResidualPartials partials;
+    computeContourResidualPartials(scenePoint, imageGridPoint, partials);
+
+    const math::linear::MatrixMxN<3, 3> inverse =
+            getHeightConstrainedInverse(scenePoint, partials);
+    math::linear::MatrixMxN<3, 1> jacobian;
+    for (size_t idx = 0; idx < 3; ++idx)
+    {
+        jacobian(idx, 0) = inverse(idx, 2);
+    }
+    return jacobian;
+}
+
 math::linear::MatrixMxN<7, 7> ProjectionModel::getErrorCovariance(
         const Vector3& scenePoint,
         double timeCOA) const
@@ -805,8 +1062,10 @@ RangeAzimProjectionModel(const math::poly::OneD<double>& polarAnglePoly,
                                     errors),
     mPolarAnglePoly(polarAnglePoly),
     mPolarAnglePolyPrime(verboseDerivative(mPolarAnglePoly, "mPolarAnglePoly")),
+    mPolarAnglePolyPrime2(mPolarAnglePolyPrime.derivative()),
     mKSFPoly(ksfPoly),
-    mKSFPolyPrime(verboseDerivative(mKSFPoly, "mKSFPoly"))
+    mKSFPolyPrime(verboseDerivative(mKSFPoly, "mKSFPoly")),
+    mKSFPolyPrime2(mKSFPolyPrime.derivative())
 {
 }
 
@@ -850,6 +1109,70 @@ computeContour(const Vector3& arpCOA,
 
 }
 
+math::linear::MatrixMxN<2, 2> RangeAzimProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+    const Vector3 arpCOA = mARPPoly(timeCOA);
+    const Vector3 velCOA = mARPVelPoly(timeCOA);
+    const Vector3 accCOA = mARPAccPoly(timeCOA);
+
+    const double thetaCOA = mPolarAnglePoly(timeCOA);
+    const double dThetaDt = mPolarAnglePolyPrime(timeCOA);
+    const double d2ThetaDt2 = mPolarAnglePolyPrime2(timeCOA);
+
+    const double ksf = mKSFPoly(thetaCOA);
+    const double dKSFDTheta = mKSFPolyPrime(thetaCOA);
+    const double d2KSFDTheta2 = mKSFPolyPrime2(thetaCOA);
+
+    const double cosTheta = cos(thetaCOA);
+    const double sinTheta = sin(thetaCOA);
+
+    const double slopeRadial =
+        imageGridPoint.row * cosTheta + imageGridPoint.col * sinTheta;
+    const double slopeCrossRadial =
+        -imageGridPoint.row * sinTheta + imageGridPoint.col * cosTheta;
+    const double dDrDTheta =
+        dKSFDTheta * slopeRadial + ksf * slopeCrossRadial;
+
+    const Vector3 vec = arpCOA - mSCP;
+    const double range = vec.norm();
+    const double velDotVec = velCOA.dot(vec);
+
+    math::linear::MatrixMxN<2, 2> partials;
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        const double dTime = (idx == 0) ? timePartials.row : timePartials.col;
+        const double dTheta = dThetaDt * dTime;
+
+        // Both the grid point and theta move
+        const double dSlopeRadial =
+            ((idx == 0) ? cosTheta : sinTheta) + slopeCrossRadial * dTheta;
+        const double dSlopeCrossRadial =
+            ((idx == 0) ? -sinTheta : cosTheta) - slopeRadial * dTheta;
+        const double dKSF = dKSFDTheta * dTheta;
+
+        const double dRange = velDotVec * dTime / range;
+        const double dRangeDot =
+            (accCOA.dot(vec) + velCOA.dot(velCOA)) * dTime / range -
+            velDotVec * dRange / (range * range);
+
+        const double dDR = dKSF * slopeRadial + ksf * dSlopeRadial;
+        const double dDDrDTheta = d2KSFDTheta2 * dTheta * slopeRadial +
+            dKSFDTheta * dSlopeRadial + dKSF * slopeCrossRadial +
+            ksf * dSlopeCrossRadial;
+        const double dDRDot =
+            dDDrDTheta * dThetaDt + dDrDTheta * d2ThetaDt2 * dTime;
+
+        partials(0, idx) = dRange + dDR;
+        partials(1, idx) = dRangeDot + dDRDot;
+    }
+    return partials;
+}
+
 
 RangeZeroProjectionModel::
 RangeZeroProjectionModel(const math::poly::OneD<double>& timeCAPoly,
@@ -872,7 +1195,10 @@ RangeZeroProjectionModel(const math::poly::OneD<double>& timeCAPoly,
                                     lookDir,
                                     errors),
     mTimeCAPoly(timeCAPoly),
+    mTimeCAPolyPrime(derivativeOrEmpty(timeCAPoly)),
     mDSRFPoly(dsrfPoly),
+    mDSRFPolyRowPrime(rowDerivativeOrEmpty(dsrfPoly)),
+    mDSRFPolyColPrime(colDerivativeOrEmpty(dsrfPoly)),
     mRangeCA(rangeCA)
 {
 }
@@ -905,6 +1231,61 @@ computeContour(const Vector3& /*arpCOA*/,
     *rDot = dsrf / (*r) * t * velocityMagCA;
 }
 
+math::linear::MatrixMxN<2, 2> RangeZeroProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+
+    const double timeCA = mTimeCAPoly(imageGridPoint.col);
+    const double dTimeCADCol = mTimeCAPolyPrime(imageGridPoint.col);
+    const double deltaTimeCOA = timeCOA - timeCA;
+
+    const Vector3 velCA = mARPVelPoly(timeCA);
+    const double velocityMagCA = velCA.norm();
+    const double dVelocityMagCADt =
+        velCA.dot(mARPAccPoly(timeCA)) / velocityMagCA;
+
+    const double t = deltaTimeCOA * velocityMagCA;
+
+    const double dsrf = mDSRFPoly(imageGridPoint.row, imageGridPoint.col);
+    const double rangeCA = mRangeCA + imageGridPoint.row;
+
+    const double r = sqrt(rangeCA * rangeCA + dsrf * (t * t));
+    const double rDot = dsrf / r * t * velocityMagCA;
+
+    math::linear::MatrixMxN<2, 2> partials;
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        // Time of closest approach and range at closest approach each only
+        // depend on one of the grid coordinates
+        const double dTimeCA = (idx == 0) ? 0.0 : dTimeCADCol;
+        const double dRangeCA = (idx == 0) ? 1.0 : 0.0;
+        const double dTimeCOA =
+            (idx == 0) ? timePartials.row : timePartials.col;
+        const double dDSRF = (idx == 0) ?
+            mDSRFPolyRowPrime(imageGridPoint.row, imageGridPoint.col) :
+            mDSRFPolyColPrime(imageGridPoint.row, imageGridPoint.col);
+
+        const double dVelocityMagCA = dVelocityMagCADt * dTimeCA;
+        const double dT = (dTimeCOA - dTimeCA) * velocityMagCA +
+            deltaTimeCOA * dVelocityMagCA;
+
+        const double dR = (rangeCA * dRangeCA + 0.5 * dDSRF * t * t +
+                           dsrf * t * dT) / r;
+        const double dRDot = (dDSRF * t * velocityMagCA +
+                              dsrf * dT * velocityMagCA +
+                              dsrf * t * dVelocityMagCA) / r -
+            rDot * dR / r;
+
+        partials(0, idx) = dR;
+        partials(1, idx) = dRDot;
+    }
+    return partials;
+}
+
 PlaneProjectionModel::
 PlaneProjectionModel(const Vector3& slantPlaneNormal,
                      const Vector3& imagePlaneRowVector,
@@ -939,6 +1320,35 @@ computeContour(const Vector3& arpCOA,
     *rDot = velCOA.dot(vec) / *r;
 }
 
+math::linear::MatrixMxN<2, 2> PlaneProjectionModel::
+computeContourPartials(const types::RowCol<double>& imageGridPoint) const
+{
+    const double timeCOA = mTimeCOAPoly(imageGridPoint.row,
+                                        imageGridPoint.col);
+    const types::RowCol<double> timePartials =
+            computeImageTimePartials(imageGridPoint);
+    const Vector3 velCOA = mARPVelPoly(timeCOA);
+    const Vector3 accCOA = mARPAccPoly(timeCOA);
+
+    const Vector3 vec = mARPPoly(timeCOA) - imageGridToECEF(imageGridPoint);
+    const double r = vec.norm();
+    const double velDotVec = velCOA.dot(vec);
+
+    math::linear::MatrixMxN<2, 2> partials;
+    for (size_t idx = 0; idx < 2; ++idx)
+    {
+        const double dTime = (idx == 0) ? timePartials.row : timePartials.col;
+        const Vector3 dVec = velCOA * dTime -
+            ((idx == 0) ? mImagePlaneRowVector : mImagePlaneColVector);
+
+        const double dR = vec.dot(dVec) / r;
+        partials(0, idx) = dR;
+        partials(1, idx) = (accCOA.dot(vec) * dTime + velCOA.dot(dVec)) / r -
+            velDotVec * dR / (r * r);
+    }
+    return partials;
+}
+
 GeodeticProjectionModel::GeodeticProjectionModel(
         const Vector3& slantPlaneNormal,
         const Vector3& scp,
@@ -20,39 +20,248 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+#include <mt/CriticalSection.h>
+#include <tasks/TaskScheduler.h>
 #include <scene/ProjectionPolynomialFitter.h>
 #include <polygon/PolygonMask.h>
 
 namespace
 {
-class Shift
+// sceneToImage() is an iterative solve, but not so slow that it's worth
+// spinning up a thread for just a few samples
+const size_t MIN_SAMPLES_PER_THREAD = 64;
+
+class ProjectSample
 {
 public:
-    Shift(double shift) :
-        mShift(shift)
+    ProjectSample(
+            const scene::ProjectionModel& projModel,
+            const scene::GridECEFTransform& gridTransform,
+            const std::vector<types::RowCol<double> >& outputPixels,
+            math::linear::Matrix2D<types::RowCol<double> >& sceneCoordinates,
+            math::linear::Matrix2D<double>& timeCOA) :
+        mProjModel(projModel),
+        mGridTransform(gridTransform),
+        mOutputPixels(outputPixels),
+        mSceneCoordinates(sceneCoordinates),
+        mTimeCOA(timeCOA)
     {
     }
 
-    inline double operator()(double input) const
+    void operator()(size_t idx) const
     {
-        return (input - mShift);
+        const size_t row = idx / mSceneCoordinates.cols();
+        const size_t col = idx % mSceneCoordinates.cols();
+
+        // Find ECEF of the output plane pixel.
+        const scene::Vector3 ecef =
+                mGridTransform.rowColToECEF(mOutputPixels[idx]);
+
+        // Project ECEF coordinate into the slant plane and get meters from
+        // the slant plane scene center point.
+        double timeCOA(0.0);
+        mSceneCoordinates(row, col) = mProjModel.sceneToImage(ecef, &timeCOA);
+        mTimeCOA(row, col) = timeCOA;
     }
 
 private:
-    const double mShift;
+    const scene::ProjectionModel& mProjModel;
+    const scene::GridECEFTransform& mGridTransform;
+    const std::vector<types::RowCol<double> >& mOutputPixels;
+    math::linear::Matrix2D<types::RowCol<double> >& mSceneCoordinates;
+    math::linear::Matrix2D<double>& mTimeCOA;
 };
+
+void splitSceneCoordinates(
+        const math::linear::Matrix2D<types::RowCol<double> >& sceneCoordinates,
+        math::linear::Matrix2D<double>& rows,
+        math::linear::Matrix2D<double>& cols)
+{
+    rows = math::linear::Matrix2D<double>(sceneCoordinates.rows(),
+                                          sceneCoordinates.cols());
+    cols = math::linear::Matrix2D<double>(sceneCoordinates.rows(),
+                                          sceneCoordinates.cols());
+    for (size_t ii = 0; ii < sceneCoordinates.rows(); ++ii)
+    {
+        for (size_t jj = 0; jj < sceneCoordinates.cols(); ++jj)
+        {
+            rows(ii, jj) = sceneCoordinates(ii, jj).row;
+            cols(ii, jj) = sceneCoordinates(ii, jj).col;
+        }
+    }
+}
+
+// Largest difference in slant plane pixels between the scene coordinates and
+// the polynomials evaluated at the output plane samples
+double getMaxResidualError(const scene::ProjectionPolynomialFitter& fitter,
+                           const math::poly::TwoD<double>& outputToSceneRow,
+                           const math::poly::TwoD<double>& outputToSceneCol,
+                           const types::RowCol<double>& slantSampleSpacing)
+{
+    const math::linear::Matrix2D<double>& rows(fitter.getOutputPlaneRows());
+    const math::linear::Matrix2D<double>& cols(fitter.getOutputPlaneCols());
+    const math::linear::Matrix2D<types::RowCol<double> >& sceneCoordinates(
+            fitter.getSceneCoordinates());
+
+    double maxError(0.0);
+    for (size_t ii = 0; ii < rows.rows(); ++ii)
+    {
+        for (size_t jj = 0; jj < rows.cols(); ++jj)
+        {
+            const double row(rows(ii, jj));
+            const double col(cols(ii, jj));
+            const types::RowCol<double>& sceneCoord(sceneCoordinates(ii, jj));
+
+            maxError = std::max(maxError, std::abs(
+                    (sceneCoord.row - outputToSceneRow(row, col)) /
+                    slantSampleSpacing.row));
+            maxError = std::max(maxError, std::abs(
+                    (sceneCoord.col - outputToSceneCol(row, col)) /
+                    slantSampleSpacing.col));
+        }
+    }
+    return maxError;
+}
 }
 
 namespace scene
 {
 const size_t ProjectionPolynomialFitter::DEFAULTS_POINTS_1D = 10;
+const size_t ProjectionPolynomialFitter::DEFAULT_MAX_POINTS_1D = 100;
+
+/*
+ * Least squares solution for fitting 2D polynomials to values at a fixed set
+ * of sample locations.  This does the same normalization and solves the same
+ * normal equations as math::poly::fit(), but keeps (A^T A)^-1 A^T around so
+ * each fit is just a matrix-vector product.
+ */
+class ProjectionPolynomialFitter::LeastSquaresSolver
+{
+public:
+    LeastSquaresSolver(const math::linear::Matrix2D<double>& x,
+                       const math::linear::Matrix2D<double>& y,
+                       size_t polyOrderX,
+                       size_t polyOrderY) :
+        mPolyOrderX(polyOrderX),
+        mPolyOrderY(polyOrderY)
+    {
+        const size_t m = x.rows();
+        const size_t n = x.cols();
+        const size_t mxn = x.size();
+
+        // Shift to zero mean and scale to unit RMS
+        mXOffset = std::accumulate(x.get(), x.get() + mxn, 0.0) / mxn;
+        mYOffset = std::accumulate(y.get(), y.get() + mxn, 0.0) / mxn;
+
+        math::linear::Matrix2D<double> xp =
+                x - math::linear::Matrix2D<double>(m, n, mXOffset);
+        math::linear::Matrix2D<double> yp =
+                y - math::linear::Matrix2D<double>(m, n, mYOffset);
+
+        mXScale = 1 / std::sqrt(xp.normSq() / mxn);
+        mYScale = 1 / std::sqrt(yp.normSq() / mxn);
+        xp.scale(mXScale);
+        yp.scale(mYScale);
+
+        const size_t acols = (polyOrderX + 1) * (polyOrderY + 1);
+        if (mxn < acols)
+        {
+            std::ostringstream ostr;
+            ostr << "Not enough points for a unique fit solution (" << mxn
+                 << " points for a " << acols << "-coefficient fit)";
+            throw except::Exception(Ctxt(ostr.str()));
+        }
+
+        math::linear::Matrix2D<double> A(mxn, acols);
+        for (size_t ii = 0, idx = 0; ii < m; ++ii)
+        {
+            for (size_t jj = 0; jj < n; ++jj, ++idx)
+            {
+                const double xij = xp(ii, jj);
+                const double yij = yp(ii, jj);
+
+                double xacc = 1;
+                for (size_t kk = 0, col = 0; kk <= polyOrderX; ++kk)
+                {
+                    double yacc = 1;
+                    for (size_t ll = 0; ll <= polyOrderY; ++ll, ++col)
+                    {
+                        A(idx, col) = xacc * yacc;
+                        yacc *= yij;
+                    }
+                    xacc *= xij;
+                }
+            }
+        }
+
+        const math::linear::Matrix2D<double> At = A.transpose();
+        mPseudoInverse = math::linear::inverse<double>(At * A) * At;
+    }
+
+    /*
+     * Fits z.  The returned polynomial's inputs are the sample locations
+     * transformed by x * xScale + xShift and y * yScale + yShift.  Since the
+     * locations are normalized before solving, this comes for free.
+     */
+    math::poly::TwoD<double> solve(const math::linear::Matrix2D<double>& z,
+                                   double xScale = 1.0,
+                                   double xShift = 0.0,
+                                   double yScale = 1.0,
+                                   double yShift = 0.0) const
+    {
+        const math::linear::Matrix2D<double> zVec(z.size(), 1, z.get());
+        const math::linear::Matrix2D<double> C = mPseudoInverse * zVec;
+
+        // Remove the normalization scaling
+        const double xRatio = mXScale / xScale;
+        const double yRatio = mYScale / yScale;
+        math::poly::TwoD<double> coeffs(mPolyOrderX, mPolyOrderY);
+        double xacc = 1;
+        for (size_t ii = 0, p = 0; ii <= mPolyOrderX; ++ii)
+        {
+            double yacc = 1;
+            for (size_t jj = 0; jj <= mPolyOrderY; ++jj, ++p)
+            {
+                coeffs[ii][jj] = C(p, 0) * (xacc * yacc);
+                yacc *= yRatio;
+            }
+            xacc *= xRatio;
+        }
+
+        // Shift the polynomial back from its centered offset
+        math::poly::TwoD<double> xShiftPoly(1, 1);
+        math::poly::TwoD<double> yShiftPoly(1, 1);
+        xShiftPoly[0][0] = -(xShift + mXOffset * xScale);
+        xShiftPoly[1][0] = 1;
+        yShiftPoly[0][0] = -(yShift + mYOffset * yScale);
+        yShiftPoly[0][1] = 1;
+
+        return coeffs.transformInput(xShiftPoly, yShiftPoly);
+    }
+
+private:
+    const size_t mPolyOrderX;
+    const size_t mPolyOrderY;
+    double mXOffset;
+    double mYOffset;
+    double mXScale;
+    double mYScale;
+    math::linear::Matrix2D<double> mPseudoInverse;
+};
 
 ProjectionPolynomialFitter::ProjectionPolynomialFitter(
     const ProjectionModel& projModel,
     const GridECEFTransform& gridTransform,
     const types::RowCol<double>& outPixelStart,
     const types::RowCol<size_t>& outExtent,
-    size_t numPoints1D) :
+    size_t numPoints1D,
+    size_t numThreads) :
     mNumPoints1D(numPoints1D),
     mOutputPlaneRows(numPoints1D, numPoints1D),
     mOutputPlaneCols(numPoints1D, numPoints1D),
@@ -70,6 +279,9 @@ ProjectionPolynomialFitter::ProjectionPolynomialFitter(
         static_cast<double>(outExtent.row - 1) / (mNumPoints1D - 1),
         static_cast<double>(outExtent.col - 1) / (mNumPoints1D - 1));
 
+    std::vector<types::RowCol<double> > outputPixels;
+    outputPixels.reserve(mNumPoints1D * mNumPoints1D);
+
     types::RowCol<double> currentOffset(outPixelStart);
 
     for (size_t ii = 0;
@@ -82,10 +294,12 @@ ProjectionPolynomialFitter::ProjectionPolynomialFitter(
              jj < mNumPoints1D;
              ++jj, currentOffset.col += skip.col)
         {
-            projectToSlantPlane(projModel, gridTransform, outPixelStart,
-                                currentOffset, ii, jj);
+            outputPixels.push_back(currentOffset);
         }
     }
+
+    projectToSlantPlane(projModel, gridTransform, outPixelStart, outputPixels,
+                        numThreads);
 }
 
 ProjectionPolynomialFitter::ProjectionPolynomialFitter(
@@ -95,7 +309,8 @@ ProjectionPolynomialFitter::ProjectionPolynomialFitter(
         const types::RowCol<double>& outPixelStart,
         const types::RowCol<size_t>& outExtent,
         const std::vector<types::RowCol<double> >& polygon,
-        size_t numPoints1D) :
+        size_t numPoints1D,
+        size_t numThreads) :
     mNumPoints1D(numPoints1D),
     mOutputPlaneRows(numPoints1D, numPoints1D),
     mOutputPlaneCols(numPoints1D, numPoints1D),
@@ -190,6 +405,9 @@ ProjectionPolynomialFitter::ProjectionPolynomialFitter(
          static_cast<double>(newExtentRow - 1) / 
          static_cast<double>(numPoints1D - 1);
 
+    std::vector<types::RowCol<double> > outputPixels;
+    outputPixels.reserve(numPoints1D * numPoints1D);
+
     double currentOffsetRow = static_cast<double>(newStartRow);
     for (size_t ii = 0; ii < numPoints1D; ++ii, currentOffsetRow += newDeltaRow)
     {
@@ -216,34 +434,179 @@ ProjectionPolynomialFitter::ProjectionPolynomialFitter(
         double currentCol = static_cast<double>(colRange.mStartElement);
         for (size_t jj = 0; jj < numPoints1D; ++jj, currentCol += newDeltaCol)
         {
-            const types::RowCol<double> currentOffset(currentRow, currentCol);
-            projectToSlantPlane(projModel, gridTransform, outPixelStart,
-                currentOffset, ii, jj);
+            outputPixels.push_back(
+                    types::RowCol<double>(currentRow, currentCol));
         }
     }
+
+    projectToSlantPlane(projModel, gridTransform, outPixelStart, outputPixels,
+                        numThreads);
+}
+
+ProjectionPolynomialFitter::~ProjectionPolynomialFitter()
+{
+}
+
+std::auto_ptr<ProjectionPolynomialFitter>
+ProjectionPolynomialFitter::createAdaptive(
+        const ProjectionModel& projModel,
+        const GridECEFTransform& gridTransform,
+        const types::RowCol<double>& outPixelStart,
+        const types::RowCol<size_t>& outExtent,
+        const types::RowCol<double>& slantSampleSpacing,
+        size_t polyOrderX,
+        size_t polyOrderY,
+        double maxResidualError,
+        size_t numPoints1D,
+        size_t maxNumPoints1D,
+        size_t numThreads,
+        double* achievedResidualError)
+{
+    if (maxNumPoints1D < numPoints1D)
+    {
+        throw except::Exception(Ctxt(
+                "Max number of points must be at least the starting number"));
+    }
+
+    std::auto_ptr<ProjectionPolynomialFitter> fitter(
+            new ProjectionPolynomialFitter(projModel,
+                                           gridTransform,
+                                           outPixelStart,
+                                           outExtent,
+                                           numPoints1D,
+                                           numThreads));
+
+    double residualError(std::numeric_limits<double>::max());
+    bool refined(false);
+    while (true)
+    {
+        // Fit meters from the slant plane SCP.  This differs from the
+        // output --> slant polynomials by just a scale and shift.
+        math::linear::Matrix2D<double> sceneRows;
+        math::linear::Matrix2D<double> sceneCols;
+        splitSceneCoordinates(fitter->mSceneCoordinates, sceneRows, sceneCols);
+
+        const LeastSquaresSolver& solver(
+                fitter->getOutputPlaneSolver(polyOrderX, polyOrderY));
+        const math::poly::TwoD<double> outputToSceneRow =
+                solver.solve(sceneRows);
+        const math::poly::TwoD<double> outputToSceneCol =
+                solver.solve(sceneCols);
+
+        if (fitter->mNumPoints1D >= maxNumPoints1D)
+        {
+            if (!refined)
+            {
+                residualError = getMaxResidualError(*fitter,
+                                                    outputToSceneRow,
+                                                    outputToSceneCol,
+                                                    slantSampleSpacing);
+            }
+            break;
+        }
+
+        // Check the fit against a denser grid, half of whose points in each
+        // direction fall between the ones we fit to
+        const size_t nextNumPoints1D =
+                std::min(2 * fitter->mNumPoints1D - 1, maxNumPoints1D);
+        fitter.reset(new ProjectionPolynomialFitter(projModel,
+                                                    gridTransform,
+                                                    outPixelStart,
+                                                    outExtent,
+                                                    nextNumPoints1D,
+                                                    numThreads));
+        refined = true;
+
+        residualError = getMaxResidualError(*fitter,
+                                            outputToSceneRow,
+                                            outputToSceneCol,
+                                            slantSampleSpacing);
+        if (residualError <= maxResidualError)
+        {
+            break;
+        }
+    }
+
+    if (achievedResidualError)
+    {
+        *achievedResidualError = residualError;
+    }
+    return fitter;
 }
 
 void ProjectionPolynomialFitter::projectToSlantPlane(
-    const ProjectionModel& projModel,
-    const GridECEFTransform& gridTransform,
-    const types::RowCol<double>& outPixelStart,
-    const types::RowCol<double>& currentOffset,
-    size_t row,
-    size_t col)
+        const ProjectionModel& projModel,
+        const GridECEFTransform& gridTransform,
+        const types::RowCol<double>& outPixelStart,
+        const std::vector<types::RowCol<double> >& outputPixels,
+        size_t numThreads)
+{
+    // Get the coordinates relative to the outPixelStart.
+    for (size_t ii = 0, idx = 0; ii < mNumPoints1D; ++ii)
+    {
+        for (size_t jj = 0; jj < mNumPoints1D; ++jj, ++idx)
+        {
+            mOutputPlaneRows(ii, jj) = outputPixels[idx].row - outPixelStart.row;
+            mOutputPlaneCols(ii, jj) = outputPixels[idx].col - outPixelStart.col;
+        }
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = tasks::SharedTaskScheduler::getInstance().getNumThreads();
+    }
+    numThreads = std::max<size_t>(
+            std::min(numThreads, outputPixels.size() / MIN_SAMPLES_PER_THREAD),
+            1);
+
+    const ProjectSample projectSample(projModel,
+                                      gridTransform,
+                                      outputPixels,
+                                      mSceneCoordinates,
+                                      mTimeCOA);
+    tasks::parallelFor(outputPixels.size(), numThreads, projectSample,
+                       "ProjectionPolynomialFitter");
+}
+
+const ProjectionPolynomialFitter::LeastSquaresSolver&
+ProjectionPolynomialFitter::getOutputPlaneSolver(size_t polyOrderX,
+                                                 size_t polyOrderY) const
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mSolverMutex);
+
+    // Map entries are never removed, so the reference stays valid after we
+    // unlock
+    mem::SharedPtr<const LeastSquaresSolver>& solver =
+            mOutputPlaneSolvers[PolyOrder(polyOrderX, polyOrderY)];
+    if (!solver.get())
+    {
+        solver.reset(new LeastSquaresSolver(mOutputPlaneRows,
+                                            mOutputPlaneCols,
+                                            polyOrderX,
+                                            polyOrderY));
+    }
+    return *solver;
+}
+
+const ProjectionPolynomialFitter::LeastSquaresSolver&
+ProjectionPolynomialFitter::getSlantPlaneSolver(size_t polyOrderX,
+                                                size_t polyOrderY) const
 {
-    // Get the coordinate relative to the outPixelStart.
-    mOutputPlaneRows(row, col) = currentOffset.row - outPixelStart.row;
-    mOutputPlaneCols(row, col) = currentOffset.col - outPixelStart.col;
-
-    // Find ECEF of the output plane pixel.
-    const scene::Vector3 ecef =
-        gridTransform.rowColToECEF(currentOffset);
-
-    // Project ECEF coordinate into the slant plane and get meters from
-    // the slant plane scene center point.
-    double timeCOA(0.0);
-    mSceneCoordinates(row, col) = projModel.sceneToImage(ecef, &timeCOA);
-    mTimeCOA(row, col) = timeCOA;
+    mt::CriticalSection<sys::Mutex> obtainLock(&mSolverMutex);
+
+    mem::SharedPtr<const LeastSquaresSolver>& solver =
+            mSlantPlaneSolvers[PolyOrder(polyOrderX, polyOrderY)];
+    if (!solver.get())
+    {
+        math::linear::Matrix2D<double> sceneRows;
+        math::linear::Matrix2D<double> sceneCols;
+        splitSceneCoordinates(mSceneCoordinates, sceneRows, sceneCols);
+        solver.reset(new LeastSquaresSolver(sceneRows,
+                                            sceneCols,
+                                            polyOrderX,
+                                            polyOrderY));
+    }
+    return *solver;
 }
 
 void ProjectionPolynomialFitter::getSlantPlaneSamples(
@@ -304,15 +667,10 @@ void ProjectionPolynomialFitter::fitOutputToSlantPolynomials(
                          slantPlaneCols);
 
     // Now fit the polynomials
-    outputToSlantRow = math::poly::fit(mOutputPlaneRows,
-                                       mOutputPlaneCols,
-                                       slantPlaneRows,
-                                       polyOrderX, polyOrderY);
-
-    outputToSlantCol = math::poly::fit(mOutputPlaneRows,
-                                       mOutputPlaneCols,
-                                       slantPlaneCols,
-                                       polyOrderX, polyOrderY);
+    const LeastSquaresSolver& solver(
+            getOutputPlaneSolver(polyOrderX, polyOrderY));
+    outputToSlantRow = solver.solve(slantPlaneRows);
+    outputToSlantCol = solver.solve(slantPlaneCols);
 
     // Optionally report the residual error
     if (meanResidualErrorRow || meanResidualErrorCol)
@@ -371,16 +729,26 @@ void ProjectionPolynomialFitter::fitSlantToOutputPolynomials(
                          slantPlaneRows,
                          slantPlaneCols);
 
-    // Now fit the polynomials
-    slantToOutputRow = math::poly::fit(slantPlaneRows,
-                                       slantPlaneCols,
-                                       mOutputPlaneRows,
-                                       polyOrderX, polyOrderY);
-
-    slantToOutputCol = math::poly::fit(slantPlaneRows,
-                                       slantPlaneCols,
-                                       mOutputPlaneCols,
-                                       polyOrderX, polyOrderY);
+    // Now fit the polynomials.  The slant plane samples are just the scene
+    // coordinates scaled and shifted the same way getSlantPlaneSamples()
+    // does.
+    const types::RowCol<double> ratio(interimSceneCenter / inSceneCenter);
+    const types::RowCol<double> slantShift(
+            interimSceneCenter.row - inPixelStart.row * ratio.row,
+            interimSceneCenter.col - inPixelStart.col * ratio.col);
+
+    const LeastSquaresSolver& solver(
+            getSlantPlaneSolver(polyOrderX, polyOrderY));
+    slantToOutputRow = solver.solve(mOutputPlaneRows,
+                                    1.0 / interimSampleSpacing.row,
+                                    slantShift.row,
+                                    1.0 / interimSampleSpacing.col,
+                                    slantShift.col);
+    slantToOutputCol = solver.solve(mOutputPlaneCols,
+                                    1.0 / interimSampleSpacing.row,
+                                    slantShift.row,
+                                    1.0 / interimSampleSpacing.col,
+                                    slantShift.col);
 
     // Optionally report the residual error
     if (meanResidualErrorRow || meanResidualErrorCol)
@@ -444,8 +812,12 @@ void ProjectionPolynomialFitter::fitTimeCOAPolynomial(
     }
 
     // Now fit the polynomial
-    timeCOAPoly = math::poly::fit(rowMapping, colMapping, mTimeCOA,
-                                  polyOrderX, polyOrderY);
+    timeCOAPoly = getOutputPlaneSolver(polyOrderX, polyOrderY).solve(
+            mTimeCOA,
+            outSampleSpacing.row,
+            -outSceneCenter.row * outSampleSpacing.row,
+            outSampleSpacing.col,
+            -outSceneCenter.col * outSampleSpacing.col);
 
     // Optionally report the residual error
     if (meanResidualError)
@@ -475,11 +847,31 @@ void ProjectionPolynomialFitter::fitPixelBasedTimeCOAPolynomial(
         math::poly::TwoD<double>& timeCOAPoly,
         double* meanResidualError) const
 {
-    fitPixelBasedTimeCOAPolynomial<Shift, Shift>(Shift(outPixelShift.row),
-                                                 Shift(outPixelShift.col),
-                                                 polyOrderX,
-                                                 polyOrderY,
-                                                 timeCOAPoly,
-                                                 meanResidualError);
+    timeCOAPoly = getOutputPlaneSolver(polyOrderX, polyOrderY).solve(
+            mTimeCOA,
+            1.0,
+            -outPixelShift.row,
+            1.0,
+            -outPixelShift.col);
+
+    // Optionally report the residual error
+    if (meanResidualError)
+    {
+        double errorSum(0.0);
+
+        for (size_t ii = 0; ii < mNumPoints1D; ++ii)
+        {
+            for (size_t jj = 0; jj < mNumPoints1D; ++jj)
+            {
+                const double row(mOutputPlaneRows(ii, jj) - outPixelShift.row);
+                const double col(mOutputPlaneCols(ii, jj) - outPixelShift.col);
+
+                const double diff = mTimeCOA(ii, jj) - timeCOAPoly(row, col);
+                errorSum += diff * diff;
+            }
+        }
+
+        *meanResidualError = errorSum / (mNumPoints1D * mNumPoints1D);
+    }
 }
 }
@@ -0,0 +1,325 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <except/Exception.h>
+#include <math/Round.h>
+#include <math/linear/Matrix2D.h>
+#include <scene/ProjectionPolynomialFitter.h>
+#include <scene/RPCFitter.h>
+#include <scene/Utilities.h>
+
+namespace
+{
+const size_t NUM_COEFFS = scene::RPCModel::NUM_COEFFS;
+
+// The denominators' constant terms are fixed at 1
+const size_t NUM_UNKNOWNS = 2 * NUM_COEFFS - 1;
+
+// The first pass is unweighted; the rest are weighted by the previous
+// pass's denominators
+const size_t NUM_PASSES = 3;
+
+// Tikhonov regularization, relative to the mean of the normal matrix's
+// diagonal.  The denominator terms are nearly collinear with the numerator
+// terms for smooth geometries like SAR, so without this the normal equations
+// are ill-conditioned enough that the residuals get several times worse.
+const double REGULARIZATION = 1e-9;
+
+// Rounds an offset to 'precision' and a scale up to it so the scale still
+// covers [min, max] after the offset is rounded
+void getOffsetAndScale(double min,
+                       double max,
+                       double precision,
+                       double& offset,
+                       double& scale)
+{
+    offset = math::round((min + max) / 2.0 / precision) * precision;
+    const double halfSpan = std::max(offset - min, max - offset);
+    scale = std::max(std::ceil(halfSpan / precision), 1.0) * precision;
+}
+
+/*
+ * Solves for the numerator and denominator coefficients of one of the RPC's
+ * ratios.  'terms' holds the NUM_COEFFS terms of each point back to back and
+ * 'values' holds the normalized line or sample of each point.  Linearizing
+ * value = num / den gives num - value * (den - 1) = value.
+ */
+void fitRatio(const std::vector<double>& terms,
+              const std::vector<double>& values,
+              double* numCoeffs,
+              double* denCoeffs)
+{
+    const size_t numPoints = values.size();
+    std::vector<double> weights(numPoints, 1.0);
+    double row[NUM_UNKNOWNS];
+
+    for (size_t pass = 0; pass < NUM_PASSES; ++pass)
+    {
+        math::linear::Matrix2D<double> normal(NUM_UNKNOWNS, NUM_UNKNOWNS, 0.0);
+        math::linear::Matrix2D<double> rhs(NUM_UNKNOWNS, 1, 0.0);
+
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            const double* const pointTerms = &terms[ii * NUM_COEFFS];
+            const double weight(weights[ii]);
+            const double value(values[ii]);
+
+            for (size_t kk = 0; kk < NUM_COEFFS; ++kk)
+            {
+                row[kk] = weight * pointTerms[kk];
+            }
+            for (size_t kk = 1; kk < NUM_COEFFS; ++kk)
+            {
+                row[NUM_COEFFS + kk - 1] = -value * row[kk];
+            }
+
+            // Only accumulate the lower triangle
+            const double weightedValue = weight * value;
+            for (size_t aa = 0; aa < NUM_UNKNOWNS; ++aa)
+            {
+                rhs(aa, 0) += row[aa] * weightedValue;
+                for (size_t bb = 0; bb <= aa; ++bb)
+                {
+                    normal(aa, bb) += row[aa] * row[bb];
+                }
+            }
+        }
+
+        double trace(0.0);
+        for (size_t aa = 0; aa < NUM_UNKNOWNS; ++aa)
+        {
+            trace += normal(aa, aa);
+            for (size_t bb = 0; bb < aa; ++bb)
+            {
+                normal(bb, aa) = normal(aa, bb);
+            }
+        }
+        const double ridge = REGULARIZATION * trace / NUM_UNKNOWNS;
+        for (size_t aa = 0; aa < NUM_UNKNOWNS; ++aa)
+        {
+            normal(aa, aa) += ridge;
+        }
+
+        const math::linear::Matrix2D<double> solution =
+                math::linear::inverse<double>(normal) * rhs;
+
+        numCoeffs[0] = solution(0, 0);
+        denCoeffs[0] = 1.0;
+        for (size_t kk = 1; kk < NUM_COEFFS; ++kk)
+        {
+            numCoeffs[kk] = solution(kk, 0);
+            denCoeffs[kk] = solution(NUM_COEFFS + kk - 1, 0);
+        }
+
+        // Weight each point by 1 / den so the next pass minimizes
+        // approximately (num / den - value) rather than (num - value * den)
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            const double* const pointTerms = &terms[ii * NUM_COEFFS];
+            double den(0.0);
+            for (size_t kk = 0; kk < NUM_COEFFS; ++kk)
+            {
+                den += denCoeffs[kk] * pointTerms[kk];
+            }
+            weights[ii] = 1.0 / den;
+        }
+    }
+}
+}
+
+namespace scene
+{
+const size_t RPCFitter::DEFAULT_POINTS_1D =
+        ProjectionPolynomialFitter::DEFAULTS_POINTS_1D;
+const size_t RPCFitter::DEFAULT_NUM_HEIGHTS = 5;
+
+RPCFitter::RPCFitter(const ProjectionModel& projModel,
+                     const types::RowCol<double>& sceneCenter,
+                     const types::RowCol<double>& sampleSpacing,
+                     const types::RowCol<size_t>& extent,
+                     double minHeight,
+                     double maxHeight,
+                     size_t numPoints1D,
+                     size_t numHeights)
+{
+    if (numPoints1D < 2 || numHeights < 2)
+    {
+        throw except::Exception(Ctxt(
+                "Need at least 2 points in each direction to fit an RPC"));
+    }
+
+    // Same sampling of the image as ProjectionPolynomialFitter, repeated
+    // at each height
+    const types::RowCol<double> skip(
+        static_cast<double>(extent.row - 1) / (numPoints1D - 1),
+        static_cast<double>(extent.col - 1) / (numPoints1D - 1));
+    const double heightSkip = (maxHeight - minHeight) / (numHeights - 1);
+
+    const size_t numPoints = numPoints1D * numPoints1D * numHeights;
+    mImagePoints.reserve(numPoints);
+    mGroundPoints.reserve(numPoints);
+
+    for (size_t hh = 0; hh < numHeights; ++hh)
+    {
+        const double height = minHeight + hh * heightSkip;
+
+        for (size_t ii = 0; ii < numPoints1D; ++ii)
+        {
+            for (size_t jj = 0; jj < numPoints1D; ++jj)
+            {
+                const types::RowCol<double> pixel(ii * skip.row,
+                                                  jj * skip.col);
+
+                // imageToScene() wants meters from the SCP
+                const types::RowCol<double> imagePt(
+                        (pixel.row - sceneCenter.row) * sampleSpacing.row,
+                        (pixel.col - sceneCenter.col) * sampleSpacing.col);
+
+                mImagePoints.push_back(pixel);
+                mGroundPoints.push_back(Utilities::ecefToLatLon(
+                        projModel.imageToScene(imagePt, height)));
+            }
+        }
+    }
+}
+
+void RPCFitter::fit(RPCModel& rpc,
+                    types::RowCol<double>* rmsResidualError,
+                    types::RowCol<double>* maxResidualError) const
+{
+    const size_t numPoints = mImagePoints.size();
+
+    // Offsets and scales at the precision RPC00B stores them in.
+    // Longitudes are taken relative to the first point so the extent
+    // doesn't blow up across the antimeridian.
+    const double refLon = mGroundPoints[0].getLon();
+    types::RowCol<double> minPixel(std::numeric_limits<double>::max(),
+                                   std::numeric_limits<double>::max());
+    types::RowCol<double> maxPixel(-std::numeric_limits<double>::max(),
+                                   -std::numeric_limits<double>::max());
+    double minLat(std::numeric_limits<double>::max());
+    double maxLat(-std::numeric_limits<double>::max());
+    double minLon(std::numeric_limits<double>::max());
+    double maxLon(-std::numeric_limits<double>::max());
+    double minHeight(std::numeric_limits<double>::max());
+    double maxHeight(-std::numeric_limits<double>::max());
+    for (size_t ii = 0; ii < numPoints; ++ii)
+    {
+        const types::RowCol<double>& pixel(mImagePoints[ii]);
+        const LatLonAlt& groundPt(mGroundPoints[ii]);
+
+        double lon = groundPt.getLon() - refLon;
+        if (lon >= 180.0)
+        {
+            lon -= 360.0;
+        }
+        else if (lon < -180.0)
+        {
+            lon += 360.0;
+        }
+
+        minPixel.row = std::min(minPixel.row, pixel.row);
+        maxPixel.row = std::max(maxPixel.row, pixel.row);
+        minPixel.col = std::min(minPixel.col, pixel.col);
+        maxPixel.col = std::max(maxPixel.col, pixel.col);
+        minLat = std::min(minLat, groundPt.getLat());
+        maxLat = std::max(maxLat, groundPt.getLat());
+        minLon = std::min(minLon, lon);
+        maxLon = std::max(maxLon, lon);
+        minHeight = std::min(minHeight, groundPt.getAlt());
+        maxHeight = std::max(maxHeight, groundPt.getAlt());
+    }
+
+    rpc = RPCModel();
+    getOffsetAndScale(minPixel.row, maxPixel.row, 1.0,
+                      rpc.lineOffset, rpc.lineScale);
+    getOffsetAndScale(minPixel.col, maxPixel.col, 1.0,
+                      rpc.sampleOffset, rpc.sampleScale);
+    getOffsetAndScale(minLat, maxLat, 1e-4, rpc.latOffset, rpc.latScale);
+    getOffsetAndScale(refLon + minLon, refLon + maxLon, 1e-4,
+                      rpc.lonOffset, rpc.lonScale);
+    getOffsetAndScale(minHeight, maxHeight, 1.0,
+                      rpc.heightOffset, rpc.heightScale);
+    if (rpc.lonOffset >= 180.0)
+    {
+        rpc.lonOffset -= 360.0;
+    }
+    else if (rpc.lonOffset < -180.0)
+    {
+        rpc.lonOffset += 360.0;
+    }
+
+    // Normalize everything
+    std::vector<double> terms(numPoints * NUM_COEFFS);
+    std::vector<double> lines(numPoints);
+    std::vector<double> samples(numPoints);
+    for (size_t ii = 0; ii < numPoints; ++ii)
+    {
+        double P;
+        double L;
+        double H;
+        rpc.normalize(mGroundPoints[ii], P, L, H);
+        RPCModel::computeTerms(P, L, H, &terms[ii * NUM_COEFFS]);
+
+        lines[ii] = (mImagePoints[ii].row - rpc.lineOffset) / rpc.lineScale;
+        samples[ii] =
+                (mImagePoints[ii].col - rpc.sampleOffset) / rpc.sampleScale;
+    }
+
+    fitRatio(terms, lines, rpc.lineNumCoeffs, rpc.lineDenCoeffs);
+    fitRatio(terms, samples, rpc.sampleNumCoeffs, rpc.sampleDenCoeffs);
+
+    // Optionally report the residual error
+    if (rmsResidualError || maxResidualError)
+    {
+        std::vector<types::RowCol<double> > fitPoints(numPoints);
+        rpc.groundToImage(&mGroundPoints[0], numPoints, &fitPoints[0]);
+
+        types::RowCol<double> errorSum(0.0, 0.0);
+        types::RowCol<double> maxError(0.0, 0.0);
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            const types::RowCol<double> diff(
+                    std::abs(fitPoints[ii].row - mImagePoints[ii].row),
+                    std::abs(fitPoints[ii].col - mImagePoints[ii].col));
+            errorSum.row += diff.row * diff.row;
+            errorSum.col += diff.col * diff.col;
+            maxError.row = std::max(maxError.row, diff.row);
+            maxError.col = std::max(maxError.col, diff.col);
+        }
+
+        if (rmsResidualError)
+        {
+            rmsResidualError->row = std::sqrt(errorSum.row / numPoints);
+            rmsResidualError->col = std::sqrt(errorSum.col / numPoints);
+        }
+        if (maxResidualError)
+        {
+            *maxResidualError = maxError;
+        }
+    }
+}
+}
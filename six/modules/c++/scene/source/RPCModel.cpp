@@ -0,0 +1,395 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include <except/Exception.h>
+#include <scene/RPCModel.h>
+#include <scene/Utilities.h>
+
+namespace
+{
+const size_t NUM_COEFFS = scene::RPCModel::NUM_COEFFS;
+
+// Number of points groundToImage() evaluates at once.  Small enough that
+// the terms for a block stay in L1 cache.
+const size_t BLOCK_SIZE = 64;
+
+// Puts a longitude difference in [-180, 180)
+inline double wrapLon(double lon)
+{
+    if (lon >= 180.0)
+    {
+        return lon - 360.0;
+    }
+    if (lon < -180.0)
+    {
+        return lon + 360.0;
+    }
+    return lon;
+}
+
+// Computes the derivatives of the RPC00B terms with respect to P and L
+inline void computeTermPartials(double P, double L, double H,
+                                double* dP, double* dL)
+{
+    std::fill_n(dP, NUM_COEFFS, 0.0);
+    std::fill_n(dL, NUM_COEFFS, 0.0);
+
+    dL[1] = 1.0;
+    dP[2] = 1.0;
+    dL[4] = P;
+    dP[4] = L;
+    dL[5] = H;
+    dP[6] = H;
+    dL[7] = 2.0 * L;
+    dP[8] = 2.0 * P;
+    dL[10] = P * H;
+    dP[10] = L * H;
+    dL[11] = 3.0 * L * L;
+    dL[12] = P * P;
+    dP[12] = 2.0 * L * P;
+    dL[13] = H * H;
+    dL[14] = 2.0 * L * P;
+    dP[14] = L * L;
+    dP[15] = 3.0 * P * P;
+    dP[16] = H * H;
+    dL[17] = 2.0 * L * H;
+    dP[18] = 2.0 * P * H;
+}
+
+inline double dot(const double* coeffs, const double* terms)
+{
+    double sum(0.0);
+    for (size_t ii = 0; ii < NUM_COEFFS; ++ii)
+    {
+        sum += coeffs[ii] * terms[ii];
+    }
+    return sum;
+}
+
+// Evaluates one polynomial for a block of points, where 'terms' holds term
+// ii for point jj at terms[ii * BLOCK_SIZE + jj]
+inline void evaluateBlock(const double* coeffs,
+                          const double* terms,
+                          size_t numPoints,
+                          double* values)
+{
+    std::fill_n(values, numPoints, 0.0);
+    for (size_t ii = 0; ii < NUM_COEFFS; ++ii)
+    {
+        const double coeff(coeffs[ii]);
+        const double* const termRow = terms + ii * BLOCK_SIZE;
+        for (size_t jj = 0; jj < numPoints; ++jj)
+        {
+            values[jj] += coeff * termRow[jj];
+        }
+    }
+}
+}
+
+namespace scene
+{
+const size_t RPCModel::NUM_COEFFS;
+
+RPCModel::RPCModel() :
+    errorBias(-1.0),
+    errorRandom(-1.0),
+    lineOffset(0.0),
+    sampleOffset(0.0),
+    latOffset(0.0),
+    lonOffset(0.0),
+    heightOffset(0.0),
+    lineScale(1.0),
+    sampleScale(1.0),
+    latScale(1.0),
+    lonScale(1.0),
+    heightScale(1.0)
+{
+    std::fill_n(lineNumCoeffs, NUM_COEFFS, 0.0);
+    std::fill_n(lineDenCoeffs, NUM_COEFFS, 0.0);
+    std::fill_n(sampleNumCoeffs, NUM_COEFFS, 0.0);
+    std::fill_n(sampleDenCoeffs, NUM_COEFFS, 0.0);
+    lineDenCoeffs[0] = 1.0;
+    sampleDenCoeffs[0] = 1.0;
+}
+
+void RPCModel::normalize(const LatLonAlt& groundPt,
+                         double& lat,
+                         double& lon,
+                         double& height) const
+{
+    lat = (groundPt.getLat() - latOffset) / latScale;
+    lon = wrapLon(groundPt.getLon() - lonOffset) / lonScale;
+    height = (groundPt.getAlt() - heightOffset) / heightScale;
+}
+
+void RPCModel::computeTerms(double lat,
+                            double lon,
+                            double height,
+                            double* terms)
+{
+    const double P(lat);
+    const double L(lon);
+    const double H(height);
+
+    terms[0] = 1.0;
+    terms[1] = L;
+    terms[2] = P;
+    terms[3] = H;
+    terms[4] = L * P;
+    terms[5] = L * H;
+    terms[6] = P * H;
+    terms[7] = L * L;
+    terms[8] = P * P;
+    terms[9] = H * H;
+    terms[10] = P * L * H;
+    terms[11] = L * L * L;
+    terms[12] = L * P * P;
+    terms[13] = L * H * H;
+    terms[14] = L * L * P;
+    terms[15] = P * P * P;
+    terms[16] = P * H * H;
+    terms[17] = L * L * H;
+    terms[18] = P * P * H;
+    terms[19] = H * H * H;
+}
+
+types::RowCol<double> RPCModel::groundToImage(const LatLonAlt& groundPt) const
+{
+    double P;
+    double L;
+    double H;
+    normalize(groundPt, P, L, H);
+
+    double terms[NUM_COEFFS];
+    computeTerms(P, L, H, terms);
+
+    return types::RowCol<double>(
+            dot(lineNumCoeffs, terms) / dot(lineDenCoeffs, terms) *
+                    lineScale + lineOffset,
+            dot(sampleNumCoeffs, terms) / dot(sampleDenCoeffs, terms) *
+                    sampleScale + sampleOffset);
+}
+
+void RPCModel::groundToImage(const LatLonAlt* groundPts,
+                             size_t numPoints,
+                             types::RowCol<double>* imagePts) const
+{
+    // Laid out term-major so each pass over a term is a contiguous run of
+    // points
+    double terms[NUM_COEFFS * BLOCK_SIZE];
+    double P[BLOCK_SIZE];
+    double L[BLOCK_SIZE];
+    double H[BLOCK_SIZE];
+    double lineNum[BLOCK_SIZE];
+    double lineDen[BLOCK_SIZE];
+    double sampleNum[BLOCK_SIZE];
+    double sampleDen[BLOCK_SIZE];
+
+    for (size_t start = 0; start < numPoints; start += BLOCK_SIZE)
+    {
+        const size_t count = std::min(BLOCK_SIZE, numPoints - start);
+
+        for (size_t jj = 0; jj < count; ++jj)
+        {
+            normalize(groundPts[start + jj], P[jj], L[jj], H[jj]);
+        }
+
+        double* const t0 = terms;
+        double* const t1 = terms + BLOCK_SIZE;
+        double* const t2 = terms + 2 * BLOCK_SIZE;
+        double* const t3 = terms + 3 * BLOCK_SIZE;
+        double* const t4 = terms + 4 * BLOCK_SIZE;
+        double* const t5 = terms + 5 * BLOCK_SIZE;
+        double* const t6 = terms + 6 * BLOCK_SIZE;
+        double* const t7 = terms + 7 * BLOCK_SIZE;
+        double* const t8 = terms + 8 * BLOCK_SIZE;
+        double* const t9 = terms + 9 * BLOCK_SIZE;
+        double* const t10 = terms + 10 * BLOCK_SIZE;
+        double* const t11 = terms + 11 * BLOCK_SIZE;
+        double* const t12 = terms + 12 * BLOCK_SIZE;
+        double* const t13 = terms + 13 * BLOCK_SIZE;
+        double* const t14 = terms + 14 * BLOCK_SIZE;
+        double* const t15 = terms + 15 * BLOCK_SIZE;
+        double* const t16 = terms + 16 * BLOCK_SIZE;
+        double* const t17 = terms + 17 * BLOCK_SIZE;
+        double* const t18 = terms + 18 * BLOCK_SIZE;
+        double* const t19 = terms + 19 * BLOCK_SIZE;
+        for (size_t jj = 0; jj < count; ++jj)
+        {
+            const double p(P[jj]);
+            const double l(L[jj]);
+            const double h(H[jj]);
+            t0[jj] = 1.0;
+            t1[jj] = l;
+            t2[jj] = p;
+            t3[jj] = h;
+            t4[jj] = l * p;
+            t5[jj] = l * h;
+            t6[jj] = p * h;
+            t7[jj] = l * l;
+            t8[jj] = p * p;
+            t9[jj] = h * h;
+            t10[jj] = p * l * h;
+            t11[jj] = l * l * l;
+            t12[jj] = l * p * p;
+            t13[jj] = l * h * h;
+            t14[jj] = l * l * p;
+            t15[jj] = p * p * p;
+            t16[jj] = p * h * h;
+            t17[jj] = l * l * h;
+            t18[jj] = p * p * h;
+            t19[jj] = h * h * h;
+        }
+
+        evaluateBlock(lineNumCoeffs, terms, count, lineNum);
+        evaluateBlock(lineDenCoeffs, terms, count, lineDen);
+        evaluateBlock(sampleNumCoeffs, terms, count, sampleNum);
+        evaluateBlock(sampleDenCoeffs, terms, count, sampleDen);
+
+        for (size_t jj = 0; jj < count; ++jj)
+        {
+            types::RowCol<double>& imagePt(imagePts[start + jj]);
+            imagePt.row = lineNum[jj] / lineDen[jj] * lineScale + lineOffset;
+            imagePt.col = sampleNum[jj] / sampleDen[jj] * sampleScale +
+                    sampleOffset;
+        }
+    }
+}
+
+types::RowCol<double> RPCModel::sceneToImage(const Vector3& scenePt) const
+{
+    return groundToImage(Utilities::ecefToLatLon(scenePt));
+}
+
+LatLonAlt RPCModel::imageToGround(const types::RowCol<double>& imagePt,
+                                  double height,
+                                  double tolerance,
+                                  size_t maxNumIters) const
+{
+    const double line = (imagePt.row - lineOffset) / lineScale;
+    const double sample = (imagePt.col - sampleOffset) / sampleScale;
+    const double H = (height - heightOffset) / heightScale;
+
+    double terms[NUM_COEFFS];
+    double dP[NUM_COEFFS];
+    double dL[NUM_COEFFS];
+
+    // Start from the middle of the ground volume
+    double P(0.0);
+    double L(0.0);
+    for (size_t iter = 0; iter < maxNumIters; ++iter)
+    {
+        computeTerms(P, L, H, terms);
+
+        const double lineNum = dot(lineNumCoeffs, terms);
+        const double lineDen = dot(lineDenCoeffs, terms);
+        const double sampleNum = dot(sampleNumCoeffs, terms);
+        const double sampleDen = dot(sampleDenCoeffs, terms);
+
+        const double lineError = lineNum / lineDen - line;
+        const double sampleError = sampleNum / sampleDen - sample;
+
+        if (std::abs(lineError * lineScale) < tolerance &&
+            std::abs(sampleError * sampleScale) < tolerance)
+        {
+            LatLonAlt groundPt(P * latScale + latOffset,
+                               L * lonScale + lonOffset,
+                               height);
+            groundPt.setLon(wrapLon(groundPt.getLon()));
+            return groundPt;
+        }
+
+        // Quotient rule for the Jacobian of (line, sample) wrt (P, L)
+        computeTermPartials(P, L, H, dP, dL);
+        const double lineDen2 = lineDen * lineDen;
+        const double sampleDen2 = sampleDen * sampleDen;
+
+        const double dLine_dP = (dot(lineNumCoeffs, dP) * lineDen -
+                lineNum * dot(lineDenCoeffs, dP)) / lineDen2;
+        const double dLine_dL = (dot(lineNumCoeffs, dL) * lineDen -
+                lineNum * dot(lineDenCoeffs, dL)) / lineDen2;
+        const double dSample_dP = (dot(sampleNumCoeffs, dP) * sampleDen -
+                sampleNum * dot(sampleDenCoeffs, dP)) / sampleDen2;
+        const double dSample_dL = (dot(sampleNumCoeffs, dL) * sampleDen -
+                sampleNum * dot(sampleDenCoeffs, dL)) / sampleDen2;
+
+        const double det = dLine_dP * dSample_dL - dLine_dL * dSample_dP;
+        if (det == 0.0)
+        {
+            break;
+        }
+
+        P -= (dSample_dL * lineError - dLine_dL * sampleError) / det;
+        L -= (dLine_dP * sampleError - dSample_dP * lineError) / det;
+    }
+
+    std::ostringstream ostr;
+    ostr << "RPC image to ground projection of pixel (" << imagePt.row
+         << ", " << imagePt.col << ") did not converge";
+    throw except::Exception(Ctxt(ostr.str()));
+}
+
+void RPCModel::imageToGround(const types::RowCol<double>* imagePts,
+                             const double* heights,
+                             size_t numPoints,
+                             LatLonAlt* groundPts) const
+{
+    for (size_t ii = 0; ii < numPoints; ++ii)
+    {
+        groundPts[ii] = imageToGround(imagePts[ii], heights[ii]);
+    }
+}
+
+Vector3 RPCModel::imageToScene(const types::RowCol<double>& imagePt,
+                               double height) const
+{
+    return Utilities::latLonToECEF(imageToGround(imagePt, height));
+}
+
+bool RPCModel::operator==(const RPCModel& rhs) const
+{
+    return errorBias == rhs.errorBias &&
+           errorRandom == rhs.errorRandom &&
+           lineOffset == rhs.lineOffset &&
+           sampleOffset == rhs.sampleOffset &&
+           latOffset == rhs.latOffset &&
+           lonOffset == rhs.lonOffset &&
+           heightOffset == rhs.heightOffset &&
+           lineScale == rhs.lineScale &&
+           sampleScale == rhs.sampleScale &&
+           latScale == rhs.latScale &&
+           lonScale == rhs.lonScale &&
+           heightScale == rhs.heightScale &&
+           std::equal(lineNumCoeffs, lineNumCoeffs + NUM_COEFFS,
+                      rhs.lineNumCoeffs) &&
+           std::equal(lineDenCoeffs, lineDenCoeffs + NUM_COEFFS,
+                      rhs.lineDenCoeffs) &&
+           std::equal(sampleNumCoeffs, sampleNumCoeffs + NUM_COEFFS,
+                      rhs.sampleNumCoeffs) &&
+           std::equal(sampleDenCoeffs, sampleDenCoeffs + NUM_COEFFS,
+                      rhs.sampleDenCoeffs);
+}
+}
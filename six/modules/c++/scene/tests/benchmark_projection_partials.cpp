@@ -0,0 +1,185 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times the finite difference partials against the closed-form ones for a
+// synthetic spotlight (PFA) collection.
+// Usage: benchmark_projection_partials [number of points]
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <scene/ProjectionModel.h>
+#include <scene/SceneGeometry.h>
+#include <scene/Utilities.h>
+
+namespace
+{
+void printResult(const std::string& name, size_t numPoints, double elapsedMS)
+{
+    std::cout << std::left << std::setw(36) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(10)
+              << elapsedMS * 1000 / numPoints << " us/point\n";
+}
+
+std::auto_ptr<scene::ProjectionModel> createModel()
+{
+    const scene::Vector3 scp = scene::Utilities::latLonToECEF(
+            scene::LatLonAlt(34.0, -112.0, 100.0));
+
+    scene::Vector3 up(scp);
+    up.normalize();
+    scene::Vector3 zAxis(0.0);
+    zAxis[2] = 1.0;
+    scene::Vector3 east = math::linear::cross(zAxis, up);
+    east.normalize();
+    const scene::Vector3 north = math::linear::cross(up, east);
+
+    const scene::Vector3 arp = scp + up * 7000.0 - north * 12000.0;
+    const scene::Vector3 vel = east * 160.0;
+
+    math::poly::OneD<scene::Vector3> arpPoly(2);
+    arpPoly[0] = arp;
+    arpPoly[1] = vel;
+    arpPoly[2] = (north * 0.4 - up * 0.2) * 0.5;
+
+    const scene::SceneGeometry geometry(vel, arp, scp);
+    const scene::Vector3 slantNormal = geometry.getSlantPlaneZ();
+    scene::Vector3 rowVector = scp - arp;
+    const double range = rowVector.norm();
+    rowVector.normalize();
+    scene::Vector3 colVector = math::linear::cross(slantNormal, rowVector);
+    if (colVector.dot(vel) < 0.0)
+    {
+        colVector = colVector * -1.0;
+    }
+
+    // Spotlight collections have a constant COA time
+    const math::poly::TwoD<double> timeCOAPoly(0, 0);
+
+    math::poly::OneD<double> polarAnglePoly(1);
+    polarAnglePoly[1] = -vel.norm() / range;
+    math::poly::OneD<double> ksfPoly(0);
+    ksfPoly[0] = 1.0;
+
+    return std::auto_ptr<scene::ProjectionModel>(
+            new scene::RangeAzimProjectionModel(
+                    polarAnglePoly, ksfPoly, slantNormal, rowVector, colVector,
+                    scp, arpPoly, timeCOAPoly, geometry.getSideOfTrack()));
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numPoints = (argc > 1) ? ::atoi(argv[1]) : 10000;
+        const std::auto_ptr<scene::ProjectionModel> model = createModel();
+
+        // Points spread over a 2 km x 2 km image
+        std::vector<types::RowCol<double> > gridPoints(numPoints);
+        std::vector<scene::Vector3> scenePoints(numPoints, scene::Vector3(0.0));
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            gridPoints[ii].row = 2000.0 * (ii % 100) / 99.0 - 1000.0;
+            gridPoints[ii].col = 2000.0 * ((ii / 100) % 100) / 99.0 - 1000.0;
+            scenePoints[ii] = model->imageToScene(gridPoints[ii], 0.0);
+        }
+
+        // Accumulate something so the work isn't optimized away
+        double checksum = 0.0;
+
+        sys::RealTimeStopWatch finiteDiffWatch;
+        finiteDiffWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->sceneToImageSensorPartials(
+                    scenePoints[ii], gridPoints[ii])(0, 0);
+        }
+        printResult("sceneToImageSensorPartials", numPoints,
+                    finiteDiffWatch.stop());
+
+        sys::RealTimeStopWatch analyticWatch;
+        analyticWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->sceneToImageSensorPartialsAnalytic(
+                    scenePoints[ii], gridPoints[ii])(0, 0);
+        }
+        printResult("sceneToImageSensorPartialsAnalytic", numPoints,
+                    analyticWatch.stop());
+
+        sys::RealTimeStopWatch groundWatch;
+        groundWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->sceneToImagePartials(
+                    scenePoints[ii], gridPoints[ii])(0, 0);
+        }
+        printResult("sceneToImagePartials", numPoints, groundWatch.stop());
+
+        sys::RealTimeStopWatch groundAnalyticWatch;
+        groundAnalyticWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->sceneToImagePartialsAnalytic(
+                    scenePoints[ii], gridPoints[ii])(0, 0);
+        }
+        printResult("sceneToImagePartialsAnalytic", numPoints,
+                    groundAnalyticWatch.stop());
+
+        sys::RealTimeStopWatch imageWatch;
+        imageWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->imageToSceneSensorPartials(
+                    gridPoints[ii], 0.0, scenePoints[ii])(0, 0);
+        }
+        printResult("imageToSceneSensorPartials", numPoints,
+                    imageWatch.stop());
+
+        sys::RealTimeStopWatch imageAnalyticWatch;
+        imageAnalyticWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            checksum += model->imageToSceneSensorPartialsAnalytic(
+                    gridPoints[ii], scenePoints[ii])(0, 0);
+        }
+        printResult("imageToSceneSensorPartialsAnalytic", numPoints,
+                    imageAnalyticWatch.stop());
+
+        std::cout << "\nChecksum: " << checksum << "\n";
+        return 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
@@ -0,0 +1,268 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <memory>
+
+#include <scene/ProjectionModel.h>
+#include <scene/SceneGeometry.h>
+#include <scene/Utilities.h>
+#include "TestCase.h"
+
+namespace
+{
+enum ModelType
+{
+    PLANE,
+    RANGE_AZIM,
+    RANGE_ZERO
+};
+
+const scene::FrameType::FrameTypesEnum FRAME_TYPES[] =
+{
+    scene::FrameType::RIC_ECF,
+    scene::FrameType::RIC_ECI,
+    scene::FrameType::ECF
+};
+
+// Image grid points (meters from the SCP)
+const double GRID_POINTS[][2] =
+{
+    {0.0, 0.0},
+    {350.0, -420.0},
+    {-800.0, 640.0}
+};
+const size_t NUM_GRID_POINTS = sizeof(GRID_POINTS) / sizeof(GRID_POINTS[0]);
+
+const double HEIGHT = 250.0;
+
+// An airborne collection looking north at a point in the southwest US, with
+// the ARP broadside to the SCP at time 0
+std::auto_ptr<scene::ProjectionModel> createModel(
+        ModelType type,
+        scene::FrameType::FrameTypesEnum frameType)
+{
+    const scene::Vector3 scp = scene::Utilities::latLonToECEF(
+            scene::LatLonAlt(34.0, -112.0, 100.0));
+
+    scene::Vector3 up(scp);
+    up.normalize();
+    scene::Vector3 zAxis(0.0);
+    zAxis[2] = 1.0;
+    scene::Vector3 east = math::linear::cross(zAxis, up);
+    east.normalize();
+    const scene::Vector3 north = math::linear::cross(up, east);
+
+    const scene::Vector3 arp = scp + up * 7000.0 - north * 12000.0;
+    const scene::Vector3 vel = east * 160.0;
+    const scene::Vector3 acc = north * 0.4 - up * 0.2;
+
+    math::poly::OneD<scene::Vector3> arpPoly(2);
+    arpPoly[0] = arp;
+    arpPoly[1] = vel;
+    arpPoly[2] = acc * 0.5;
+
+    const scene::SceneGeometry geometry(vel, arp, scp);
+    const int lookDir = geometry.getSideOfTrack();
+    const scene::Vector3 slantNormal = geometry.getSlantPlaneZ();
+
+    scene::Vector3 rowVector = scp - arp;
+    const double rangeSCP = rowVector.norm();
+    rowVector.normalize();
+    scene::Vector3 colVector = math::linear::cross(slantNormal, rowVector);
+    colVector.normalize();
+    if (colVector.dot(vel) < 0.0)
+    {
+        colVector = colVector * -1.0;
+    }
+
+    const double speed = vel.norm();
+
+    // Time mostly follows the column, with a little row dependence so the
+    // time partials are exercised too
+    math::poly::TwoD<double> timeCOAPoly(1, 1);
+    timeCOAPoly[0][1] = 1.0 / speed;
+    timeCOAPoly[1][0] = 2e-5;
+    timeCOAPoly[1][1] = 1e-8;
+
+    scene::Errors errors;
+    errors.mFrameType = frameType;
+
+    std::auto_ptr<scene::ProjectionModel> model;
+    switch (type)
+    {
+    case PLANE:
+        model.reset(new scene::PlaneProjectionModel(
+                slantNormal, rowVector, colVector, scp, arpPoly, timeCOAPoly,
+                lookDir, errors));
+        break;
+    case RANGE_AZIM:
+    {
+        const double thetaRate = -speed / rangeSCP;
+        math::poly::OneD<double> polarAnglePoly(2);
+        polarAnglePoly[1] = thetaRate;
+        polarAnglePoly[2] = 0.05 * thetaRate;
+
+        math::poly::OneD<double> ksfPoly(2);
+        ksfPoly[0] = 1.0;
+        ksfPoly[1] = 0.02;
+        ksfPoly[2] = 0.01;
+
+        model.reset(new scene::RangeAzimProjectionModel(
+                polarAnglePoly, ksfPoly, slantNormal, rowVector, colVector,
+                scp, arpPoly, timeCOAPoly, lookDir, errors));
+        break;
+    }
+    case RANGE_ZERO:
+    {
+        math::poly::OneD<double> timeCAPoly(2);
+        timeCAPoly[1] = 1.0 / speed;
+        timeCAPoly[2] = 1e-9;
+
+        math::poly::TwoD<double> dsrfPoly(1, 1);
+        dsrfPoly[0][0] = 1.0;
+        dsrfPoly[1][0] = 1e-6;
+        dsrfPoly[0][1] = -2e-6;
+
+        model.reset(new scene::RangeZeroProjectionModel(
+                timeCAPoly, dsrfPoly, rangeSCP, slantNormal, rowVector,
+                colVector, scp, arpPoly, timeCOAPoly, lookDir, errors));
+        break;
+    }
+    }
+    return model;
+}
+
+// Relative to the largest partial in the matrix, since some partials are
+// zero and finite differences only get so close to them
+template <size_t M, size_t N>
+double getMaxDifference(const math::linear::MatrixMxN<M, N>& analytic,
+                        const math::linear::MatrixMxN<M, N>& finiteDiff)
+{
+    double maxValue = 0.0;
+    double maxDiff = 0.0;
+    for (size_t ii = 0; ii < M; ++ii)
+    {
+        for (size_t jj = 0; jj < N; ++jj)
+        {
+            maxValue = std::max(maxValue, std::abs(finiteDiff(ii, jj)));
+            maxDiff = std::max(maxDiff,
+                               std::abs(analytic(ii, jj) - finiteDiff(ii, jj)));
+        }
+    }
+    return maxDiff / maxValue;
+}
+
+void testModel(const std::string& testName, ModelType type)
+{
+    for (size_t ff = 0; ff < sizeof(FRAME_TYPES) / sizeof(FRAME_TYPES[0]);
+         ++ff)
+    {
+        const std::auto_ptr<scene::ProjectionModel> model =
+                createModel(type, FRAME_TYPES[ff]);
+
+        for (size_t ii = 0; ii < NUM_GRID_POINTS; ++ii)
+        {
+            const types::RowCol<double> gridPoint(GRID_POINTS[ii][0],
+                                                  GRID_POINTS[ii][1]);
+            const scene::Vector3 scenePoint =
+                    model->imageToScene(gridPoint, HEIGHT);
+
+            TEST_ASSERT_LESSER(getMaxDifference(
+                    model->imageToScenePartialsAnalytic(gridPoint,
+                                                        scenePoint),
+                    model->imageToScenePartials(gridPoint, HEIGHT,
+                                                scenePoint)), 1e-4);
+            TEST_ASSERT_LESSER(getMaxDifference(
+                    model->imageToSceneSensorPartialsAnalytic(gridPoint,
+                                                              scenePoint),
+                    model->imageToSceneSensorPartials(gridPoint, HEIGHT,
+                                                      scenePoint)), 1e-4);
+            TEST_ASSERT_LESSER(getMaxDifference(
+                    model->imageToSceneHeightPartialAnalytic(gridPoint,
+                                                             scenePoint),
+                    model->imageToSceneHeightPartial(gridPoint, HEIGHT,
+                                                     scenePoint)), 1e-4);
+
+            const types::RowCol<double> projected =
+                    model->sceneToImage(scenePoint);
+            TEST_ASSERT_LESSER(getMaxDifference(
+                    model->sceneToImagePartialsAnalytic(scenePoint,
+                                                        projected),
+                    model->sceneToImagePartials(scenePoint, projected)),
+                    1e-4);
+            TEST_ASSERT_LESSER(getMaxDifference(
+                    model->sceneToImageSensorPartialsAnalytic(scenePoint,
+                                                              projected),
+                    model->sceneToImageSensorPartials(scenePoint,
+                                                      projected)), 1e-4);
+        }
+    }
+}
+
+TEST_CASE(testPlanePartials)
+{
+    testModel(testName, PLANE);
+}
+
+TEST_CASE(testRangeAzimPartials)
+{
+    testModel(testName, RANGE_AZIM);
+}
+
+TEST_CASE(testRangeZeroPartials)
+{
+    testModel(testName, RANGE_ZERO);
+}
+
+TEST_CASE(testContourPartials)
+{
+    // The closed-form contour partials should match the central difference
+    // ones in the base class
+    const ModelType types[] = {PLANE, RANGE_AZIM, RANGE_ZERO};
+    for (size_t tt = 0; tt < 3; ++tt)
+    {
+        const std::auto_ptr<scene::ProjectionModel> model =
+                createModel(types[tt], scene::FrameType::RIC_ECF);
+        for (size_t ii = 0; ii < NUM_GRID_POINTS; ++ii)
+        {
+            const types::RowCol<double> gridPoint(GRID_POINTS[ii][0],
+                                                  GRID_POINTS[ii][1]);
+            const math::linear::MatrixMxN<2, 2> analytic =
+                    model->computeContourPartials(gridPoint);
+            const math::linear::MatrixMxN<2, 2> finiteDiff =
+                    model->scene::ProjectionModel::computeContourPartials(
+                            gridPoint);
+            TEST_ASSERT_LESSER(getMaxDifference(analytic, finiteDiff), 1e-6);
+        }
+    }
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testPlanePartials);
+    TEST_CHECK(testRangeAzimPartials);
+    TEST_CHECK(testRangeZeroPartials);
+    TEST_CHECK(testContourPartials);
+    return 0;
+}
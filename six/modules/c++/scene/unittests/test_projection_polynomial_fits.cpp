@@ -0,0 +1,305 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cmath>
+#include <memory>
+
+#include <math/poly/Fit.h>
+#include <scene/GridECEFTransform.h>
+#include <scene/ProjectionModel.h>
+#include <scene/ProjectionPolynomialFitter.h>
+#include <scene/SceneGeometry.h>
+#include <scene/Utilities.h>
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<double> SLANT_SAMPLE_SPACING(0.75, 0.8);
+const types::RowCol<double> OUT_SAMPLE_SPACING(1.0, 1.0);
+const types::RowCol<double> OUT_SCENE_CENTER(750.0, 900.0);
+const types::RowCol<size_t> OUT_EXTENT(1500, 1800);
+
+// An airborne collection looking north at a point in the southwest US, with
+// the ARP broadside to the SCP at time 0.  The output plane is a
+// north/east plane tangent to the ellipsoid at the SCP.
+struct Geometry
+{
+    Geometry()
+    {
+        scp = scene::Utilities::latLonToECEF(
+                scene::LatLonAlt(34.0, -112.0, 100.0));
+
+        scene::Vector3 up(scp);
+        up.normalize();
+        scene::Vector3 zAxis(0.0);
+        zAxis[2] = 1.0;
+        east = math::linear::cross(zAxis, up);
+        east.normalize();
+        north = math::linear::cross(up, east);
+
+        const scene::Vector3 arp = scp + up * 7000.0 - north * 12000.0;
+        const scene::Vector3 vel = east * 160.0;
+
+        math::poly::OneD<scene::Vector3> arpPoly(2);
+        arpPoly[0] = arp;
+        arpPoly[1] = vel;
+        arpPoly[2] = (north * 0.4 - up * 0.2) * 0.5;
+
+        const scene::SceneGeometry geometry(vel, arp, scp);
+        const scene::Vector3 slantNormal = geometry.getSlantPlaneZ();
+        scene::Vector3 rowVector = scp - arp;
+        const double range = rowVector.norm();
+        rowVector.normalize();
+        scene::Vector3 colVector = math::linear::cross(slantNormal, rowVector);
+        if (colVector.dot(vel) < 0.0)
+        {
+            colVector = colVector * -1.0;
+        }
+
+        // Vary the COA time across the image so there's something to fit
+        math::poly::TwoD<double> timeCOAPoly(1, 1);
+        timeCOAPoly[0][1] = 1.0 / vel.norm();
+        timeCOAPoly[1][0] = 1.0e-4;
+
+        math::poly::OneD<double> polarAnglePoly(1);
+        polarAnglePoly[1] = -vel.norm() / range;
+        math::poly::OneD<double> ksfPoly(0);
+        ksfPoly[0] = 1.0;
+
+        model.reset(new scene::RangeAzimProjectionModel(
+                polarAnglePoly, ksfPoly, slantNormal, rowVector, colVector,
+                scp, arpPoly, timeCOAPoly, geometry.getSideOfTrack()));
+
+        gridTransform.reset(new scene::PlanarGridECEFTransform(
+                OUT_SAMPLE_SPACING, OUT_SCENE_CENTER, north * -1.0, east,
+                scp));
+    }
+
+    scene::Vector3 scp;
+    scene::Vector3 east;
+    scene::Vector3 north;
+    std::auto_ptr<scene::ProjectionModel> model;
+    std::auto_ptr<scene::GridECEFTransform> gridTransform;
+};
+
+double maxDifference(const math::poly::TwoD<double>& lhs,
+                     const math::poly::TwoD<double>& rhs,
+                     const math::linear::Matrix2D<double>& x,
+                     const math::linear::Matrix2D<double>& y)
+{
+    double maxDiff(0.0);
+    for (size_t ii = 0; ii < x.rows(); ++ii)
+    {
+        for (size_t jj = 0; jj < x.cols(); ++jj)
+        {
+            maxDiff = std::max(maxDiff, std::abs(lhs(x(ii, jj), y(ii, jj)) -
+                                                 rhs(x(ii, jj), y(ii, jj))));
+        }
+    }
+    return maxDiff;
+}
+
+TEST_CASE(testThreadedSampling)
+{
+    const Geometry geometry;
+    const types::RowCol<double> outPixelStart(0.0, 0.0);
+
+    const scene::ProjectionPolynomialFitter serial(
+            *geometry.model, *geometry.gridTransform, outPixelStart,
+            OUT_EXTENT, 20, 1);
+    const scene::ProjectionPolynomialFitter threaded(
+            *geometry.model, *geometry.gridTransform, outPixelStart,
+            OUT_EXTENT, 20, 4);
+
+    for (size_t ii = 0; ii < 20; ++ii)
+    {
+        for (size_t jj = 0; jj < 20; ++jj)
+        {
+            TEST_ASSERT_EQ(serial.getSceneCoordinates()(ii, jj).row,
+                           threaded.getSceneCoordinates()(ii, jj).row);
+            TEST_ASSERT_EQ(serial.getSceneCoordinates()(ii, jj).col,
+                           threaded.getSceneCoordinates()(ii, jj).col);
+            TEST_ASSERT_EQ(serial.getTimeCOA()(ii, jj),
+                           threaded.getTimeCOA()(ii, jj));
+        }
+    }
+}
+
+TEST_CASE(testFitsMatchDirectFits)
+{
+    const Geometry geometry;
+    const types::RowCol<double> outPixelStart(100.0, 200.0);
+    const scene::ProjectionPolynomialFitter fitter(
+            *geometry.model, *geometry.gridTransform, outPixelStart,
+            types::RowCol<size_t>(1200, 1400), 12);
+
+    const math::linear::Matrix2D<double>& outRows(fitter.getOutputPlaneRows());
+    const math::linear::Matrix2D<double>& outCols(fitter.getOutputPlaneCols());
+
+    // Slant plane pixels, computed the way the fitter does
+    const types::RowCol<size_t> inPixelStart(10, 20);
+    const types::RowCol<double> inSceneCenter(1000.0, 1200.0);
+    math::linear::Matrix2D<double> slantRows(12, 12);
+    math::linear::Matrix2D<double> slantCols(12, 12);
+    for (size_t ii = 0; ii < 12; ++ii)
+    {
+        for (size_t jj = 0; jj < 12; ++jj)
+        {
+            const types::RowCol<double> sceneCoord(
+                    fitter.getSceneCoordinates()(ii, jj));
+            slantRows(ii, jj) = sceneCoord.row / SLANT_SAMPLE_SPACING.row +
+                    inSceneCenter.row - inPixelStart.row;
+            slantCols(ii, jj) = sceneCoord.col / SLANT_SAMPLE_SPACING.col +
+                    inSceneCenter.col - inPixelStart.col;
+        }
+    }
+
+    for (size_t order = 1; order <= 4; ++order)
+    {
+        // Output --> slant shares its solution with the time COA fits
+        math::poly::TwoD<double> outputToSlantRow;
+        math::poly::TwoD<double> outputToSlantCol;
+        fitter.fitOutputToSlantPolynomials(
+                inPixelStart, inSceneCenter, inSceneCenter,
+                SLANT_SAMPLE_SPACING, order, order,
+                outputToSlantRow, outputToSlantCol);
+        TEST_ASSERT_LESSER(maxDifference(
+                outputToSlantRow,
+                math::poly::fit(outRows, outCols, slantRows, order, order),
+                outRows, outCols), 1e-8);
+        TEST_ASSERT_LESSER(maxDifference(
+                outputToSlantCol,
+                math::poly::fit(outRows, outCols, slantCols, order, order),
+                outRows, outCols), 1e-8);
+
+        math::poly::TwoD<double> slantToOutputRow;
+        math::poly::TwoD<double> slantToOutputCol;
+        fitter.fitSlantToOutputPolynomials(
+                inPixelStart, inSceneCenter, inSceneCenter,
+                SLANT_SAMPLE_SPACING, order, order,
+                slantToOutputRow, slantToOutputCol);
+        TEST_ASSERT_LESSER(maxDifference(
+                slantToOutputRow,
+                math::poly::fit(slantRows, slantCols, outRows, order, order),
+                slantRows, slantCols), 1e-8);
+        TEST_ASSERT_LESSER(maxDifference(
+                slantToOutputCol,
+                math::poly::fit(slantRows, slantCols, outCols, order, order),
+                slantRows, slantCols), 1e-8);
+
+        // Time COA in meters from the output plane scene center
+        math::linear::Matrix2D<double> rowMeters(12, 12);
+        math::linear::Matrix2D<double> colMeters(12, 12);
+        for (size_t ii = 0; ii < 12; ++ii)
+        {
+            for (size_t jj = 0; jj < 12; ++jj)
+            {
+                rowMeters(ii, jj) = (outRows(ii, jj) - OUT_SCENE_CENTER.row) *
+                        OUT_SAMPLE_SPACING.row;
+                colMeters(ii, jj) = (outCols(ii, jj) - OUT_SCENE_CENTER.col) *
+                        OUT_SAMPLE_SPACING.col;
+            }
+        }
+        math::poly::TwoD<double> timeCOAPoly;
+        fitter.fitTimeCOAPolynomial(OUT_SCENE_CENTER, OUT_SAMPLE_SPACING,
+                                    order, order, timeCOAPoly);
+        TEST_ASSERT_LESSER(maxDifference(
+                timeCOAPoly,
+                math::poly::fit(rowMeters, colMeters, fitter.getTimeCOA(),
+                                order, order),
+                rowMeters, colMeters), 1e-9);
+
+        // Time COA in 1-based pixels
+        math::linear::Matrix2D<double> oneBasedRows(12, 12);
+        math::linear::Matrix2D<double> oneBasedCols(12, 12);
+        for (size_t ii = 0; ii < 12; ++ii)
+        {
+            for (size_t jj = 0; jj < 12; ++jj)
+            {
+                oneBasedRows(ii, jj) = outRows(ii, jj) + 1.0;
+                oneBasedCols(ii, jj) = outCols(ii, jj) + 1.0;
+            }
+        }
+        fitter.fitPixelBasedTimeCOAPolynomial(
+                types::RowCol<double>(-1.0, -1.0), order, order, timeCOAPoly);
+        TEST_ASSERT_LESSER(maxDifference(
+                timeCOAPoly,
+                math::poly::fit(oneBasedRows, oneBasedCols,
+                                fitter.getTimeCOA(), order, order),
+                oneBasedRows, oneBasedCols), 1e-9);
+    }
+}
+
+TEST_CASE(testAdaptive)
+{
+    const Geometry geometry;
+    const types::RowCol<double> outPixelStart(0.0, 0.0);
+
+    // A linear fit can't get close, so this should run out of points
+    double residualError(0.0);
+    std::auto_ptr<scene::ProjectionPolynomialFitter> fitter =
+            scene::ProjectionPolynomialFitter::createAdaptive(
+                    *geometry.model, *geometry.gridTransform, outPixelStart,
+                    OUT_EXTENT, SLANT_SAMPLE_SPACING, 1, 1, 1e-6, 4, 30, 0,
+                    &residualError);
+    TEST_ASSERT_EQ(fitter->getNumPoints1D(), static_cast<size_t>(30));
+    TEST_ASSERT_GREATER(residualError, 1e-6);
+
+    // A cubic fit should get there well before that
+    fitter = scene::ProjectionPolynomialFitter::createAdaptive(
+            *geometry.model, *geometry.gridTransform, outPixelStart,
+            OUT_EXTENT, SLANT_SAMPLE_SPACING, 3, 3, 0.01, 4, 100, 0,
+            &residualError);
+    TEST_ASSERT_LESSER(fitter->getNumPoints1D(), static_cast<size_t>(100));
+    TEST_ASSERT_LESSER(residualError, 0.01);
+
+    // Check that bound against the rigorous model at a point halfway between
+    // samples
+    math::poly::TwoD<double> outputToSlantRow;
+    math::poly::TwoD<double> outputToSlantCol;
+    fitter->fitOutputToSlantPolynomials(
+            types::RowCol<size_t>(0, 0), types::RowCol<double>(1.0, 1.0),
+            types::RowCol<double>(1.0, 1.0), SLANT_SAMPLE_SPACING, 3, 3,
+            outputToSlantRow, outputToSlantCol);
+
+    const double skip = (OUT_EXTENT.row - 1.0) /
+            (fitter->getNumPoints1D() - 1);
+    const types::RowCol<double> outPixel(skip * 1.5, skip * 2.5);
+    const types::RowCol<double> sceneCoord = geometry.model->sceneToImage(
+            geometry.gridTransform->rowColToECEF(outPixel));
+    TEST_ASSERT_LESSER(std::abs(sceneCoord.row / SLANT_SAMPLE_SPACING.row +
+                                1.0 - outputToSlantRow(outPixel.row,
+                                                       outPixel.col)),
+                       0.01);
+    TEST_ASSERT_LESSER(std::abs(sceneCoord.col / SLANT_SAMPLE_SPACING.col +
+                                1.0 - outputToSlantCol(outPixel.row,
+                                                       outPixel.col)),
+                       0.01);
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testThreadedSampling);
+    TEST_CHECK(testFitsMatchDirectFits);
+    TEST_CHECK(testAdaptive);
+    return 0;
+}
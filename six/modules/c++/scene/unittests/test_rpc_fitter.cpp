@@ -0,0 +1,170 @@
+/* =========================================================================
+ * This file is part of scene-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * scene-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <scene/ProjectionModel.h>
+#include <scene/RPCFitter.h>
+#include <scene/SceneGeometry.h>
+#include <scene/Utilities.h>
+#include "TestCase.h"
+
+namespace
+{
+const types::RowCol<double> SCENE_CENTER(1000.0, 1200.0);
+const types::RowCol<double> SAMPLE_SPACING(0.75, 0.8);
+const types::RowCol<size_t> EXTENT(2000, 2400);
+const double MIN_HEIGHT = -200.0;
+const double MAX_HEIGHT = 800.0;
+
+// An airborne spotlight (PFA) collection looking north at a point in the
+// southwest US, with the ARP broadside to the SCP at time 0
+std::auto_ptr<scene::ProjectionModel> createModel()
+{
+    const scene::Vector3 scp = scene::Utilities::latLonToECEF(
+            scene::LatLonAlt(34.0, -112.0, 100.0));
+
+    scene::Vector3 up(scp);
+    up.normalize();
+    scene::Vector3 zAxis(0.0);
+    zAxis[2] = 1.0;
+    scene::Vector3 east = math::linear::cross(zAxis, up);
+    east.normalize();
+    const scene::Vector3 north = math::linear::cross(up, east);
+
+    const scene::Vector3 arp = scp + up * 7000.0 - north * 12000.0;
+    const scene::Vector3 vel = east * 160.0;
+
+    math::poly::OneD<scene::Vector3> arpPoly(2);
+    arpPoly[0] = arp;
+    arpPoly[1] = vel;
+    arpPoly[2] = (north * 0.4 - up * 0.2) * 0.5;
+
+    const scene::SceneGeometry geometry(vel, arp, scp);
+    const scene::Vector3 slantNormal = geometry.getSlantPlaneZ();
+    scene::Vector3 rowVector = scp - arp;
+    const double range = rowVector.norm();
+    rowVector.normalize();
+    scene::Vector3 colVector = math::linear::cross(slantNormal, rowVector);
+    if (colVector.dot(vel) < 0.0)
+    {
+        colVector = colVector * -1.0;
+    }
+
+    // Spotlight collections have a constant COA time
+    const math::poly::TwoD<double> timeCOAPoly(0, 0);
+
+    math::poly::OneD<double> polarAnglePoly(1);
+    polarAnglePoly[1] = -vel.norm() / range;
+    math::poly::OneD<double> ksfPoly(0);
+    ksfPoly[0] = 1.0;
+
+    return std::auto_ptr<scene::ProjectionModel>(
+            new scene::RangeAzimProjectionModel(
+                    polarAnglePoly, ksfPoly, slantNormal, rowVector, colVector,
+                    scp, arpPoly, timeCOAPoly, geometry.getSideOfTrack()));
+}
+
+TEST_CASE(testFit)
+{
+    const std::auto_ptr<scene::ProjectionModel> model = createModel();
+    const scene::RPCFitter fitter(*model, SCENE_CENTER, SAMPLE_SPACING,
+                                  EXTENT, MIN_HEIGHT, MAX_HEIGHT);
+
+    scene::RPCModel rpc;
+    types::RowCol<double> rmsError;
+    types::RowCol<double> maxError;
+    fitter.fit(rpc, &rmsError, &maxError);
+
+    TEST_ASSERT_LESSER(maxError.row, 0.01);
+    TEST_ASSERT_LESSER(maxError.col, 0.01);
+    TEST_ASSERT(rmsError.row <= maxError.row);
+    TEST_ASSERT(rmsError.col <= maxError.col);
+
+    // RPC00B only has so much precision for these
+    TEST_ASSERT_EQ(rpc.lineOffset, std::floor(rpc.lineOffset));
+    TEST_ASSERT_EQ(rpc.heightScale, std::floor(rpc.heightScale));
+    TEST_ASSERT_ALMOST_EQ_EPS(rpc.latOffset * 1e4,
+                              std::floor(rpc.latOffset * 1e4 + 0.5), 1e-6);
+
+    // Check against the rigorous model between the sample points
+    for (double row = 50.5; row < EXTENT.row; row += 387.0)
+    {
+        for (double col = 20.5; col < EXTENT.col; col += 411.0)
+        {
+            for (double height = MIN_HEIGHT + 50.0; height < MAX_HEIGHT;
+                 height += 310.0)
+            {
+                const types::RowCol<double> imagePt(
+                        (row - SCENE_CENTER.row) * SAMPLE_SPACING.row,
+                        (col - SCENE_CENTER.col) * SAMPLE_SPACING.col);
+                const scene::Vector3 scenePt =
+                        model->imageToScene(imagePt, height);
+
+                const types::RowCol<double> rpcPixel =
+                        rpc.sceneToImage(scenePt);
+                TEST_ASSERT_ALMOST_EQ_EPS(rpcPixel.row, row, 0.02);
+                TEST_ASSERT_ALMOST_EQ_EPS(rpcPixel.col, col, 0.02);
+
+                const scene::LatLonAlt groundPt =
+                        rpc.imageToGround(types::RowCol<double>(row, col),
+                                          height);
+                const scene::Vector3 rpcScenePt =
+                        scene::Utilities::latLonToECEF(groundPt);
+                TEST_ASSERT_LESSER((rpcScenePt - scenePt).norm(), 0.05);
+            }
+        }
+    }
+}
+
+TEST_CASE(testBulkGroundToImage)
+{
+    const std::auto_ptr<scene::ProjectionModel> model = createModel();
+    const scene::RPCFitter fitter(*model, SCENE_CENTER, SAMPLE_SPACING,
+                                  EXTENT, MIN_HEIGHT, MAX_HEIGHT);
+    scene::RPCModel rpc;
+    fitter.fit(rpc);
+
+    // Not a multiple of the block size
+    const std::vector<scene::LatLonAlt>& groundPts = fitter.getGroundPoints();
+    const size_t numPoints = groundPts.size() - 7;
+    std::vector<types::RowCol<double> > imagePts(numPoints);
+    rpc.groundToImage(&groundPts[0], numPoints, &imagePts[0]);
+
+    for (size_t ii = 0; ii < numPoints; ++ii)
+    {
+        const types::RowCol<double> imagePt = rpc.groundToImage(groundPts[ii]);
+        TEST_ASSERT_ALMOST_EQ_EPS(imagePts[ii].row, imagePt.row, 1e-9);
+        TEST_ASSERT_ALMOST_EQ_EPS(imagePts[ii].col, imagePt.col, 1e-9);
+    }
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testFit);
+    TEST_CHECK(testBulkGroundToImage);
+    return 0;
+}
@@ -26,6 +26,7 @@
 #include "six/convert/ConverterProviderRegistry.h"
 #include "six/convert/ConverterProvider.h"
 #include "six/convert/ConvertingReadControl.h"
+#include "six/convert/StreamingConverter.h"
 
 #endif
 
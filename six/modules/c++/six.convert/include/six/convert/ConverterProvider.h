@@ -78,6 +78,17 @@ public:
      * \return type of file being converted
      */
     virtual std::string getFileType() const = 0;
+
+    /*!
+     * \return true if the region version of readData() may be called from
+     * several threads at once (on disjoint regions).  StreamingConverter
+     * reads bands in parallel for converters that return true, and one at a
+     * time otherwise.
+     */
+    virtual bool isThreadSafe() const
+    {
+        return false;
+    }
 };
 }
 }
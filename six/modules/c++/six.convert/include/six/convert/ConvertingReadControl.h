@@ -102,6 +102,12 @@ public:
      */
     virtual UByte* interleaved(size_t imageNumber=0);
 
+    /*!
+     * \return The plugin converting the loaded file.  This is owned by the
+     * plugin registry.
+     */
+    ConverterProvider& getConverter();
+
 private:
     const std::vector<std::string> mPluginPathnames;
     ConverterProviderRegistry mRegistry;
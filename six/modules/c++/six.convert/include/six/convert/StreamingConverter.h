@@ -0,0 +1,111 @@
+/* =========================================================================
+ * This file is part of six.convert-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.convert-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_STREAMING_CONVERTER_H__
+#define __SIX_STREAMING_CONVERTER_H__
+
+#include <string>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <six/sicd/ComplexData.h>
+#include <six/convert/ConverterProvider.h>
+#include <six/convert/ConvertingReadControl.h>
+
+namespace six
+{
+namespace convert
+{
+/*!
+ * \class StreamingConverter
+ * \brief Converts a vendor image to a SICD a band of rows at a time
+ *
+ * Rather than reading the whole image into memory and saving it with
+ * NITFWriteControl, each band is read with the converter's region
+ * readData() and written straight to its place in the output file through
+ * a SICDByteProvider and a ParallelNITFFileSink.  Bands are processed on
+ * the shared scheduler's threads, each holding at most one band (plus the
+ * byte swapped copy the sink writes out), so memory stays proportional to
+ * numThreads * maxBandBytes however large the image is.
+ *
+ * Converters that report isThreadSafe() have their bands read in
+ * parallel.  For the rest, reads are serialized, but byte swapping and
+ * writing still overlap with the next read.
+ */
+class StreamingConverter
+{
+public:
+    //! Default band size limit
+    static const size_t DEFAULT_MAX_BAND_BYTES;
+
+    /*!
+     * \param converter Loaded converter to read pixels from
+     * \param data Metadata for the image, as returned by the converter's
+     * convert()
+     * \param numThreads Number of threads to use.  If 0, uses one per
+     * worker of the shared scheduler.
+     * \param maxBandBytes Size limit for a band of rows.  A band always
+     * holds at least one row.
+     */
+    StreamingConverter(ConverterProvider& converter,
+                       const six::sicd::ComplexData& data,
+                       size_t numThreads = 0,
+                       size_t maxBandBytes = DEFAULT_MAX_BAND_BYTES);
+
+    /*!
+     * Same as above for the file loaded into 'reader'
+     *
+     * \param reader Reader that has had load() called
+     */
+    StreamingConverter(ConvertingReadControl& reader,
+                       size_t numThreads = 0,
+                       size_t maxBandBytes = DEFAULT_MAX_BAND_BYTES);
+
+    //! \return The number of rows read and written at a time
+    size_t getNumRowsPerBand() const
+    {
+        return mNumRowsPerBand;
+    }
+
+    /*!
+     * Write the SICD.  The output only shows up at 'pathname' once all of
+     * it has been written.
+     *
+     * \param pathname Output pathname
+     * \param schemaPaths Schemas to validate the XML against
+     */
+    void convert(const std::string& pathname,
+                 const std::vector<std::string>& schemaPaths =
+                         std::vector<std::string>()) const;
+
+private:
+    void initialize(size_t maxBandBytes);
+
+private:
+    ConverterProvider& mConverter;
+    const six::sicd::ComplexData& mData;
+    const size_t mNumThreads;
+    size_t mNumRowsPerBand;
+};
+}
+}
+
+#endif
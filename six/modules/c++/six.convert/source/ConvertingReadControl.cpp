@@ -28,13 +28,15 @@ namespace convert
 {
 ConvertingReadControl::ConvertingReadControl(
         const std::string& pluginPathname) :
-    mPluginPathnames(std::vector<std::string>(1, pluginPathname))
+    mPluginPathnames(std::vector<std::string>(1, pluginPathname)),
+    mConverter(NULL)
 {
 }
 
 ConvertingReadControl::ConvertingReadControl(
         const std::vector<std::string>& pluginPathnames) :
-    mPluginPathnames(pluginPathnames)
+    mPluginPathnames(pluginPathnames),
+    mConverter(NULL)
 {
 }
 
@@ -67,6 +69,16 @@ std::string ConvertingReadControl::getFileType() const
     return mConverter->getFileType();
 }
 
+ConverterProvider& ConvertingReadControl::getConverter()
+{
+    if (mConverter == NULL)
+    {
+        throw except::Exception(Ctxt("Please load ConvertingReadControl "
+                "before calling getConverter()"));
+    }
+    return *mConverter;
+}
+
 UByte* ConvertingReadControl::interleaved(size_t imageNumber)
 {
     Region region;
@@ -0,0 +1,196 @@
+/* =========================================================================
+ * This file is part of six.convert-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.convert-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+
+#include <except/Exception.h>
+#include <mt/CriticalSection.h>
+#include <sys/Mutex.h>
+#include <tasks/TaskScheduler.h>
+#include <six/Instrumentation.h>
+#include <six/ParallelNITFFileSink.h>
+#include <six/StagingBufferPool.h>
+#include <six/sicd/SICDByteProvider.h>
+#include <six/convert/StreamingConverter.h>
+
+namespace
+{
+const six::sicd::ComplexData& getComplexData(
+        six::convert::ConvertingReadControl& reader)
+{
+    // Make sure the reader's been loaded before digging into its container
+    reader.getConverter();
+
+    const six::Data* const data = reader.getContainer()->getData(0);
+    if (data == NULL || data->getDataType() != six::DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Converter did not produce a SICD"));
+    }
+    return *static_cast<const six::sicd::ComplexData*>(data);
+}
+
+class BandConverter
+{
+public:
+    BandConverter(six::convert::ConverterProvider& converter,
+                  sys::Mutex* readMutex,
+                  six::ParallelNITFFileSink& sink,
+                  mem::SharedPtr<six::StagingBufferPool> bufferPool,
+                  const types::RowCol<size_t>& dims,
+                  size_t numBytesPerPixel,
+                  size_t numRowsPerBand) :
+        mConverter(converter),
+        mReadMutex(readMutex),
+        mSink(sink),
+        mBufferPool(bufferPool),
+        mDims(dims),
+        mNumBytesPerPixel(numBytesPerPixel),
+        mNumRowsPerBand(numRowsPerBand)
+    {
+    }
+
+    void operator()(size_t band) const
+    {
+        const size_t startRow = band * mNumRowsPerBand;
+        const size_t numRows =
+                std::min(mNumRowsPerBand, mDims.row - startRow);
+        const size_t numBytes = numRows * mDims.col * mNumBytesPerPixel;
+
+        six::StagingBuffer buffer;
+        sys::ubyte* const image = buffer.reserve(mBufferPool, numBytes);
+
+        {
+            six::ScopedStageTimer timer("six.convert.read");
+            timer.addRows(numRows);
+            timer.addBytes(numBytes);
+
+            const types::RowCol<size_t> start(startRow, 0);
+            const types::RowCol<size_t> dims(numRows, mDims.col);
+            if (mReadMutex)
+            {
+                mt::CriticalSection<sys::Mutex> obtainLock(mReadMutex);
+                mConverter.readData(start, dims, image);
+            }
+            else
+            {
+                mConverter.readData(start, dims, image);
+            }
+        }
+
+        mSink.writeNativeEndian(image, startRow, numRows);
+    }
+
+private:
+    six::convert::ConverterProvider& mConverter;
+    sys::Mutex* const mReadMutex;
+    six::ParallelNITFFileSink& mSink;
+    const mem::SharedPtr<six::StagingBufferPool> mBufferPool;
+    const types::RowCol<size_t> mDims;
+    const size_t mNumBytesPerPixel;
+    const size_t mNumRowsPerBand;
+};
+}
+
+namespace six
+{
+namespace convert
+{
+const size_t StreamingConverter::DEFAULT_MAX_BAND_BYTES = 32 * 1024 * 1024;
+
+StreamingConverter::StreamingConverter(ConverterProvider& converter,
+                                       const six::sicd::ComplexData& data,
+                                       size_t numThreads,
+                                       size_t maxBandBytes) :
+    mConverter(converter),
+    mData(data),
+    mNumThreads(numThreads == 0 ?
+            tasks::SharedTaskScheduler::getInstance().getNumThreads() :
+            numThreads),
+    mNumRowsPerBand(1)
+{
+    initialize(maxBandBytes);
+}
+
+StreamingConverter::StreamingConverter(ConvertingReadControl& reader,
+                                       size_t numThreads,
+                                       size_t maxBandBytes) :
+    mConverter(reader.getConverter()),
+    mData(getComplexData(reader)),
+    mNumThreads(numThreads == 0 ?
+            tasks::SharedTaskScheduler::getInstance().getNumThreads() :
+            numThreads),
+    mNumRowsPerBand(1)
+{
+    initialize(maxBandBytes);
+}
+
+void StreamingConverter::initialize(size_t maxBandBytes)
+{
+    const size_t numBytesPerRow =
+            mData.getNumCols() * mData.getNumBytesPerPixel();
+    if (mData.getNumRows() == 0 || numBytesPerRow == 0)
+    {
+        throw except::Exception(Ctxt("Image is empty"));
+    }
+
+    mNumRowsPerBand = std::max<size_t>(maxBandBytes / numBytesPerRow, 1);
+
+    // Without enough bands to go around, some threads would sit idle
+    const size_t numRowsPerThread =
+            (mData.getNumRows() + mNumThreads - 1) / mNumThreads;
+    mNumRowsPerBand = std::min(mNumRowsPerBand, numRowsPerThread);
+}
+
+void StreamingConverter::convert(
+        const std::string& pathname,
+        const std::vector<std::string>& schemaPaths) const
+{
+    const types::RowCol<size_t> dims(mData.getNumRows(), mData.getNumCols());
+    const size_t numBytesPerPixel = mData.getNumBytesPerPixel();
+
+    six::ScopedStageTimer timer("six.convert.toSICD");
+    timer.addRows(dims.row);
+    timer.addBytes(dims.area() * numBytesPerPixel);
+
+    const six::sicd::SICDByteProvider provider(mData, schemaPaths);
+    six::ParallelNITFFileSink sink(provider, pathname);
+
+    // One band per thread in flight
+    sys::Mutex readMutex;
+    const mem::SharedPtr<six::StagingBufferPool> bufferPool(
+            new six::StagingBufferPool(mNumThreads));
+
+    const size_t numBands =
+            (dims.row + mNumRowsPerBand - 1) / mNumRowsPerBand;
+    tasks::parallelFor(numBands, mNumThreads,
+                       BandConverter(mConverter,
+                                     mConverter.isThreadSafe() ?
+                                             NULL : &readMutex,
+                                     sink,
+                                     bufferPool,
+                                     dims,
+                                     numBytesPerPixel,
+                                     mNumRowsPerBand),
+                       "six.convert.toSICD");
+    sink.finalize();
+}
+}
+}
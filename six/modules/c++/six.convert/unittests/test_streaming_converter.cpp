@@ -0,0 +1,255 @@
+/* =========================================================================
+ * This file is part of six.convert-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.convert-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <vector>
+
+#include <io/ReadUtils.h>
+#include <io/TempFile.h>
+#include <mt/CriticalSection.h>
+#include <sys/Mutex.h>
+#include <six/NITFWriteControl.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sicd/Utilities.h>
+#include <six/convert/StreamingConverter.h>
+
+#include "TestCase.h"
+
+namespace
+{
+// Serves an image from memory and keeps track of how it was read
+class FakeConverter : public six::convert::ConverterProvider
+{
+public:
+    FakeConverter(const types::RowCol<size_t>& dims, bool threadSafe) :
+        mDims(dims),
+        mThreadSafe(threadSafe),
+        mImage(dims.area()),
+        mNumActiveReads(0),
+        mMaxActiveReads(0),
+        mMaxRowsPerRead(0)
+    {
+        for (size_t ii = 0; ii < mImage.size(); ++ii)
+        {
+            mImage[ii] = std::complex<float>(static_cast<float>(ii),
+                                             -static_cast<float>(ii) / 2);
+        }
+    }
+
+    virtual bool supports(const std::string& ) const
+    {
+        return true;
+    }
+
+    virtual void load(const std::string& )
+    {
+    }
+
+    virtual std::auto_ptr<six::sicd::ComplexData> convert()
+    {
+        std::auto_ptr<six::sicd::ComplexData> data =
+                six::sicd::Utilities::createFakeComplexData();
+        data->setNumRows(mDims.row);
+        data->setNumCols(mDims.col);
+        data->setPixelType(six::PixelType::RE32F_IM32F);
+        return data;
+    }
+
+    virtual void readData(const types::RowCol<size_t>& startingLocations,
+                          const types::RowCol<size_t>& dims,
+                          void* buffer)
+    {
+        {
+            mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+            ++mNumActiveReads;
+            mMaxActiveReads = std::max(mMaxActiveReads, mNumActiveReads);
+            mMaxRowsPerRead = std::max(mMaxRowsPerRead, dims.row);
+        }
+
+        std::complex<float>* const output =
+                static_cast<std::complex<float>*>(buffer);
+        for (size_t row = 0; row < dims.row; ++row)
+        {
+            std::memcpy(&output[row * dims.col],
+                        &mImage[(startingLocations.row + row) * mDims.col +
+                                startingLocations.col],
+                        dims.col * sizeof(std::complex<float>));
+        }
+
+        // Give other threads a chance to overlap
+        sys::OS().millisleep(1);
+
+        mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+        --mNumActiveReads;
+    }
+
+    virtual void readData(void* buffer)
+    {
+        readData(types::RowCol<size_t>(0, 0), mDims, buffer);
+    }
+
+    virtual size_t getDataSizeInBytes() const
+    {
+        return mImage.size() * sizeof(std::complex<float>);
+    }
+
+    virtual std::string getFileType() const
+    {
+        return "FAKE";
+    }
+
+    virtual bool isThreadSafe() const
+    {
+        return mThreadSafe;
+    }
+
+    std::vector<std::complex<float> >& getImage()
+    {
+        return mImage;
+    }
+
+    size_t getMaxActiveReads() const
+    {
+        return mMaxActiveReads;
+    }
+
+    size_t getMaxRowsPerRead() const
+    {
+        return mMaxRowsPerRead;
+    }
+
+private:
+    const types::RowCol<size_t> mDims;
+    const bool mThreadSafe;
+    std::vector<std::complex<float> > mImage;
+    sys::Mutex mMutex;
+    size_t mNumActiveReads;
+    size_t mMaxActiveReads;
+    size_t mMaxRowsPerRead;
+};
+
+// What NITFWriteControl writes with the whole image in memory
+std::vector<sys::byte> saveWhole(const six::sicd::ComplexData& data,
+                                 std::vector<std::complex<float> >& image)
+{
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::COMPLEX));
+    container->addData(data.clone());
+
+    six::XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator(six::DataType::COMPLEX,
+                           new six::XMLControlCreatorT<
+                                   six::sicd::ComplexXMLControl>());
+
+    six::NITFWriteControl writer(six::Options(), container, &xmlRegistry);
+    six::BufferList buffers(1, reinterpret_cast<six::UByte*>(&image[0]));
+
+    io::TempFile tempfile;
+    writer.save(buffers, tempfile.pathname(), std::vector<std::string>());
+
+    std::vector<sys::byte> contents;
+    io::readFileContents(tempfile.pathname(), contents);
+    return contents;
+}
+
+std::vector<sys::byte> convert(FakeConverter& converter,
+                               const six::sicd::ComplexData& data,
+                               size_t numThreads,
+                               size_t maxBandBytes,
+                               size_t& numRowsPerBand)
+{
+    const six::convert::StreamingConverter streamingConverter(
+            converter, data, numThreads, maxBandBytes);
+    numRowsPerBand = streamingConverter.getNumRowsPerBand();
+
+    io::TempFile tempfile;
+    streamingConverter.convert(tempfile.pathname());
+
+    std::vector<sys::byte> contents;
+    io::readFileContents(tempfile.pathname(), contents);
+    return contents;
+}
+
+TEST_CASE(testMatchesWholeImageSave)
+{
+    const types::RowCol<size_t> dims(123, 45);
+    const size_t numBytesPerRow = dims.col * sizeof(std::complex<float>);
+
+    FakeConverter reference(dims, false);
+    const std::auto_ptr<six::sicd::ComplexData> data(reference.convert());
+    const std::vector<sys::byte> expected =
+            saveWhole(*data, reference.getImage());
+
+    const size_t maxBandRows[] = {1, 10, 1000};
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        for (size_t numThreads = 1; numThreads <= 4; numThreads *= 2)
+        {
+            for (size_t threadSafe = 0; threadSafe < 2; ++threadSafe)
+            {
+                FakeConverter converter(dims, threadSafe != 0);
+                size_t numRowsPerBand = 0;
+                const std::vector<sys::byte> actual = convert(
+                        converter, *data, numThreads,
+                        maxBandRows[ii] * numBytesPerRow, numRowsPerBand);
+                TEST_ASSERT(actual == expected);
+
+                // Memory is bounded by the band size
+                TEST_ASSERT(numRowsPerBand <= maxBandRows[ii]);
+                TEST_ASSERT(converter.getMaxRowsPerRead() <= numRowsPerBand);
+
+                if (!threadSafe)
+                {
+                    TEST_ASSERT_EQ(converter.getMaxActiveReads(),
+                                   static_cast<size_t>(1));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE(testBandsSplitAcrossThreads)
+{
+    FakeConverter converter(types::RowCol<size_t>(100, 10), true);
+    const std::auto_ptr<six::sicd::ComplexData> data(converter.convert());
+
+    // Big bands would leave threads idle
+    const six::convert::StreamingConverter streamingConverter(
+            converter, *data, 4, 1024 * 1024);
+    TEST_ASSERT_EQ(streamingConverter.getNumRowsPerBand(),
+                   static_cast<size_t>(25));
+
+    // But there's always at least a row per band
+    const six::convert::StreamingConverter tinyBands(converter, *data, 4, 1);
+    TEST_ASSERT_EQ(tinyBands.getNumRowsPerBand(), static_cast<size_t>(1));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testMatchesWholeImageSave);
+    TEST_CHECK(testBandsSplitAcrossThreads);
+    return 0;
+}
@@ -37,6 +37,7 @@
 #include "six/sicd/ImageData.h"
 #include "six/sicd/ImageFormation.h"
 #include "six/sicd/MatchInformation.h"
+#include "six/sicd/MeshInterpolator.h"
 #include "six/sicd/PFA.h"
 #include "six/sicd/Position.h"
 #include "six/sicd/RadarCollection.h"
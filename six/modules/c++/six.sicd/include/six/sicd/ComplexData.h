@@ -26,6 +26,7 @@
 #include <mem/ScopedCopyablePtr.h>
 #include <types/RowCol.h>
 
+#include "six/CopyOnWritePtr.h"
 #include "six/Data.h"
 #include "six/ErrorStatistics.h"
 #include "six/Radiometric.h"
@@ -67,16 +68,22 @@ namespace sicd
  *  The best way to initialize a ComplexData object is using the
  *  ComplexDataBuilder, although it can be initialized directly.
  *
+ *  Copies (e.g. from clone()) share every block but the ImageData,
+ *  GeoData, Radiometric and ErrorStatistics until a block is modified
+ *  through the copy.  A block that has been accessed through a non-const
+ *  ComplexData is deep copied instead, until markShareable() is called.
+ *  See CopyOnWritePtr.
+ *
  *
  */
 class ComplexData: public Data
 {
 public:
     //!  CollectionInfo block.  Contains the general collection information
-    mem::ScopedCloneablePtr<CollectionInformation> collectionInformation;
+    CopyOnWritePtr<CollectionInformation> collectionInformation;
 
     //!  (Optional) Block contains general information about the image creation
-    mem::ScopedCloneablePtr<ImageCreation> imageCreation;
+    CopyOnWritePtr<ImageCreation> imageCreation;
 
     //!  Block describes the image pixel data
     mem::ScopedCopyablePtr<ImageData> imageData;
@@ -85,46 +92,46 @@ public:
     mem::ScopedCloneablePtr<GeoData> geoData;
 
     //!  Block of parameters describes the image sample grid
-    mem::ScopedCloneablePtr<Grid> grid;
+    CopyOnWritePtr<Grid> grid;
 
     //!  This block describes the imaging collection timeline
-    mem::ScopedCopyablePtr<Timeline> timeline;
+    CopyOnWritePtr<Timeline> timeline;
 
     //!  Describes the platform and the ground ref positions vs. time
-    mem::ScopedCopyablePtr<Position> position;
+    CopyOnWritePtr<Position> position;
 
     //!  This block describes the radar collection info
-    mem::ScopedCloneablePtr<RadarCollection> radarCollection;
+    CopyOnWritePtr<RadarCollection> radarCollection;
 
     //!  This block describes the image formation process
-    mem::ScopedCopyablePtr<ImageFormation> imageFormation;
+    CopyOnWritePtr<ImageFormation> imageFormation;
 
     //!  Describes Center of Aperture (COA) params for Scene Center Point (SCP)
-    mem::ScopedCopyablePtr<SCPCOA> scpcoa;
+    CopyOnWritePtr<SCPCOA> scpcoa;
 
     //!  (Optional) Radiometric calibration params
     mem::ScopedCopyablePtr<Radiometric> radiometric;
 
     //!  (Optional) Params describe the antenna during collection.
-    mem::ScopedCopyablePtr<Antenna> antenna;
+    CopyOnWritePtr<Antenna> antenna;
 
     //!  (Optional) Params needed for computing error statistics
     mem::ScopedCopyablePtr<ErrorStatistics> errorStatistics;
 
     //!  (Optional) Params describing other related imaging collections
-    mem::ScopedCopyablePtr<MatchInformation> matchInformation;
+    CopyOnWritePtr<MatchInformation> matchInformation;
 
     //!  (Optional/Choice) Polar Format Algorithm params -- if this is set,
     //          rma should remain NULL.
-    mem::ScopedCopyablePtr<PFA> pfa;
+    CopyOnWritePtr<PFA> pfa;
 
     //!  (Optional/Choice) Range Migration Algorithm params -- if this is
     //          set, pfa should remain NULL.
-    mem::ScopedCopyablePtr<RMA> rma;
+    CopyOnWritePtr<RMA> rma;
 
     //!  (Optional/Choice) Simple Range Doppler Compression params --
     //   if this is set, pfa & rma should remain NULL.
-    mem::ScopedCopyablePtr<RgAzComp> rgAzComp;
+    CopyOnWritePtr<RgAzComp> rgAzComp;
 
     ComplexData();
 
@@ -141,11 +148,24 @@ public:
     }
 
     /*!
-     *  Deep copy of this, including all initialized sub-params
-     *
+     *  Deep copy of this, including all initialized sub-params.  Blocks
+     *  held in a CopyOnWritePtr are shared with the copy rather than
+     *  copied, unless they've been accessed through a non-const
+     *  ComplexData since this was built, read, or last marked shareable.
+     *  That includes plain reads like data.grid->row through a non-const
+     *  reference, so call markShareable() before cloning if the data may
+     *  have been touched that way.
      */
     Data* clone() const;
 
+    /*!
+     *  Lets copies share the blocks that have been modified since this was
+     *  built or copied (see CopyOnWritePtr::markShareable()).  Only call
+     *  this once nothing holds on to a pointer or reference into one of
+     *  those blocks.
+     */
+    virtual void markShareable();
+
     /*!
      *  Utility function for getting the pixel type.
      *  This is stored in the SICD along with the width
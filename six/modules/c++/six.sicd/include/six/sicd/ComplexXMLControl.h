@@ -63,6 +63,15 @@ protected:
      */
     virtual xml::lite::Document* toXMLImpl(const Data* data);
 
+    /*!
+     *  This function writes a ComplexData object straight to 'writer'
+     *  as XML, without building a DOM.
+     *
+     *  \param data A ComplexData object
+     *  \param writer Where the XML goes
+     */
+    virtual void toXMLImpl(const Data* data, XMLStreamWriter& writer);
+
     /*!
      *  Function takes a DOM Document* node and creates a new-allocated
      *  ComplexData* populated by the DOM.  
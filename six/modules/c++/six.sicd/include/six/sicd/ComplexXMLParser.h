@@ -44,6 +44,12 @@ public:
 
     xml::lite::Document* toXML(const ComplexData* data) const;
 
+    /*!
+     * Write 'data' straight to 'writer', without building a DOM.  The
+     * result is identical to printing the root element from toXML().
+     */
+    void toXML(const ComplexData* data, XMLStreamWriter& writer) const;
+
     ComplexData* fromXML(const xml::lite::Document* doc) const;
 
 protected:
@@ -80,6 +86,38 @@ protected:
         const GainAndPhasePolys* obj,
         XMLElem parent = NULL) const = 0;
 
+    // streaming counterparts of the convert*ToXML() methods above
+    virtual void writeGeoInfo(XMLStreamWriter& writer,
+                              const GeoInfo *obj) const = 0;
+
+    virtual void writeWeightType(XMLStreamWriter& writer,
+                                 const WeightType& obj) const = 0;
+
+    virtual void writeRadarCollection(XMLStreamWriter& writer,
+                                      const RadarCollection *radar) const = 0;
+
+    virtual void writeImageFormation(XMLStreamWriter& writer,
+                                     const ImageFormation *obj,
+                                     const RadarCollection& radarCollection) const = 0;
+
+    virtual void writeImageFormationAlgo(XMLStreamWriter& writer,
+                                         const PFA* pfa, const RMA* rma,
+                                         const RgAzComp* rgAzComp) const = 0;
+
+    virtual void writeMatchInformation(XMLStreamWriter& writer,
+                                       const MatchInformation *obj) const = 0;
+
+    virtual void writeRMA(XMLStreamWriter& writer, const RMA* obj) const = 0;
+
+    virtual void writeRMAT(XMLStreamWriter& writer, const RMAT* obj) const = 0;
+
+    virtual void writeHPBW(XMLStreamWriter& writer,
+                           const HalfPowerBeamwidths* obj) const = 0;
+
+    virtual void writeAntennaParamArray(XMLStreamWriter& writer,
+                                        const std::string& name,
+                                        const GainAndPhasePolys* obj) const = 0;
+
     virtual void parseWeightTypeFromXML(const XMLElem gridRowColXML,
                         mem::ScopedCopyablePtr<WeightType>& obj) const = 0;
 
@@ -136,6 +174,34 @@ protected:
                                        XMLElem parent = NULL) const;
     virtual void convertDRateSFPolyToXML(const INCA* inca, XMLElem incaElem) const;
 
+    void writeTxFrequency(XMLStreamWriter& writer,
+                          const RadarCollection* radar) const;
+    void writeTxSequence(XMLStreamWriter& writer,
+                         const RadarCollection* radar) const;
+    void writeWaveform(XMLStreamWriter& writer,
+                       const RadarCollection* radar) const;
+    void writeArea(XMLStreamWriter& writer,
+                   const RadarCollection* radar) const;
+
+    void writePFA(XMLStreamWriter& writer, const PFA *obj) const;
+    void writeRgAzComp(XMLStreamWriter& writer, const RgAzComp *obj) const;
+    void writeRMCR(XMLStreamWriter& writer, const RMCR* obj) const;
+    void writeINCA(XMLStreamWriter& writer, const INCA* obj) const;
+    void writeRcvChanProc(XMLStreamWriter& writer,
+                          const std::string& version,
+                          const RcvChannelProcessed* obj) const;
+    void writeDistortion(XMLStreamWriter& writer,
+                         const std::string& version,
+                         const Distortion* obj) const;
+
+    virtual void writeSCPCOA(XMLStreamWriter& writer,
+                             const SCPCOA *obj) const;
+    //! The SCPCOA children common to every version
+    void writeSCPCOAParameters(XMLStreamWriter& writer,
+                               const SCPCOA *obj) const;
+    virtual void writeDRateSFPoly(XMLStreamWriter& writer,
+                                  const INCA* inca) const;
+
     virtual void parseSCPCOAFromXML(const XMLElem scpcoaXML, SCPCOA *obj) const;
     virtual void parseDRateSFPolyFromXML(const XMLElem incaElem, INCA* inca) const;
 
@@ -190,6 +256,29 @@ private:
             const AreaDirectionParameters *obj,
             XMLElem parent = NULL) const;
 
+    void writeCollectionInformation(XMLStreamWriter& writer,
+                                    const CollectionInformation *obj) const;
+    void writeImageCreation(XMLStreamWriter& writer,
+                            const ImageCreation *obj) const;
+    void writeImageData(XMLStreamWriter& writer, const ImageData *obj) const;
+    void writeGeoData(XMLStreamWriter& writer, const GeoData *obj) const;
+    void writeGrid(XMLStreamWriter& writer, const Grid *obj) const;
+    void writeDirectionParameters(XMLStreamWriter& writer,
+                                  const std::string& name,
+                                  const DirectionParameters *obj) const;
+    void writeTimeline(XMLStreamWriter& writer, const Timeline *obj) const;
+    void writePosition(XMLStreamWriter& writer, const Position *obj) const;
+    void writeAntenna(XMLStreamWriter& writer, const Antenna *obj) const;
+    void writeAntennaParameters(XMLStreamWriter& writer,
+                                const std::string& name,
+                                const AntennaParameters *ap) const;
+    void writeAreaLineDirectionParameters(XMLStreamWriter& writer,
+            const std::string& name,
+            const AreaDirectionParameters *obj) const;
+    void writeAreaSampleDirectionParameters(XMLStreamWriter& writer,
+            const std::string& name,
+            const AreaDirectionParameters *obj) const;
+
     void parseCollectionInformationFromXML(const XMLElem collectionInfoXML,
                                            CollectionInformation *obj) const;
     void parseImageCreationFromXML(const XMLElem imageCreationXML,
@@ -236,6 +325,19 @@ private:
                                   const SideOfTrackType& value, XMLElem parent =
                                           NULL) const;
 
+    void writeFFTSign(XMLStreamWriter& writer, const std::string& name,
+                      six::FFTSign sign) const;
+
+    void writeLatLonFootprint(XMLStreamWriter& writer,
+                              const std::string& name,
+                              const std::string& cornerName,
+                              const LatLonCorners& corners) const;
+
+    void writeLatLonAltFootprint(XMLStreamWriter& writer,
+                                 const std::string& name,
+                                 const std::string& cornerName,
+                                 const LatLonAltCorners& corners) const;
+
 private:
     std::auto_ptr<SICommonXMLParser> mCommon;
 };
@@ -44,6 +44,10 @@ protected:
     virtual void convertDRateSFPolyToXML(const INCA* inca, XMLElem incaElem) const;
     virtual void parseDRateSFPolyFromXML(const XMLElem incaElem, INCA* inca) const;
 
+    virtual void writeRMAT(XMLStreamWriter& writer, const RMAT* obj) const;
+    virtual void writeDRateSFPoly(XMLStreamWriter& writer,
+                                  const INCA* inca) const;
+
 };
 }
 }
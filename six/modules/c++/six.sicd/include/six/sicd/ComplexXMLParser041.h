@@ -50,6 +50,11 @@ protected:
             const PFA* pfa, const RMA* rma, 
             const RgAzComp* rgAzComp, 
             XMLElem parent = NULL) const;
+
+    virtual void writeRMAT(XMLStreamWriter& writer, const RMAT* obj) const;
+    virtual void writeImageFormationAlgo(XMLStreamWriter& writer,
+                                         const PFA* pfa, const RMA* rma,
+                                         const RgAzComp* rgAzComp) const;
 };
 }
 }
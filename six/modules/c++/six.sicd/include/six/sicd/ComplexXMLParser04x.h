@@ -42,6 +42,7 @@ protected:
     virtual XMLElem convertRMATToXML(const RMAT* obj, 
                                      XMLElem parent = NULL) const = 0;
     virtual void parseRMATFromXML(const XMLElem rmatElem, RMAT* obj) const = 0;
+    virtual void writeRMAT(XMLStreamWriter& writer, const RMAT* obj) const = 0;
 
 protected:
 
@@ -69,6 +70,27 @@ protected:
         const GainAndPhasePolys* obj, 
         XMLElem parent = NULL) const;
 
+    virtual void writeGeoInfo(XMLStreamWriter& writer,
+                              const GeoInfo *obj) const;
+    virtual void writeWeightType(XMLStreamWriter& writer,
+                                 const WeightType& obj) const;
+    virtual void writeRadarCollection(XMLStreamWriter& writer,
+                                      const RadarCollection *radar) const;
+    virtual void writeImageFormation(XMLStreamWriter& writer,
+                                     const ImageFormation *obj,
+                                     const RadarCollection& radarCollection) const;
+    virtual void writeImageFormationAlgo(XMLStreamWriter& writer,
+                                         const PFA* pfa, const RMA* rma,
+                                         const RgAzComp* rgAzComp) const;
+    virtual void writeMatchInformation(XMLStreamWriter& writer,
+                                       const MatchInformation *obj) const;
+    virtual void writeRMA(XMLStreamWriter& writer, const RMA *obj) const;
+    virtual void writeHPBW(XMLStreamWriter& writer,
+                           const HalfPowerBeamwidths* obj) const;
+    virtual void writeAntennaParamArray(XMLStreamWriter& writer,
+                                        const std::string& name,
+                                        const GainAndPhasePolys* obj) const;
+
     virtual void parseWeightTypeFromXML(const XMLElem gridRowColXML,
         mem::ScopedCopyablePtr<WeightType>& obj) const;
     virtual void parsePolarizationCalibrationFromXML(
@@ -88,6 +110,8 @@ protected:
 private:
     XMLElem createRcvChannels(const RadarCollection* radar,
                               XMLElem parent = NULL) const;
+    void writeRcvChannels(XMLStreamWriter& writer,
+                          const RadarCollection* radar) const;
 };
 }
 }
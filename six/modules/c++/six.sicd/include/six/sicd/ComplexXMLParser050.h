@@ -50,6 +50,14 @@ protected:
     virtual XMLElem convertMatchInformationToXML(const MatchInformation *obj, 
                                                  XMLElem parent = NULL) const;
 
+    virtual void writeWeightType(XMLStreamWriter& writer,
+                                 const WeightType& obj) const;
+    virtual void writeImageFormationAlgo(XMLStreamWriter& writer,
+                                         const PFA* pfa, const RMA* rma,
+                                         const RgAzComp* rgAzComp) const;
+    virtual void writeMatchInformation(XMLStreamWriter& writer,
+                                       const MatchInformation *obj) const;
+
 
 };
 }
@@ -39,6 +39,8 @@ protected:
 
     virtual XMLElem convertGeoInfoToXML(const GeoInfo *obj,
                                         XMLElem parent = NULL) const;
+    virtual void writeGeoInfo(XMLStreamWriter& writer,
+                              const GeoInfo *obj) const;
 
 };
 }
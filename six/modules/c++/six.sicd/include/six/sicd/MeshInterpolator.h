@@ -0,0 +1,277 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_SICD_MESH_INTERPOLATOR_H__
+#define __SIX_SICD_MESH_INTERPOLATOR_H__
+
+#include <vector>
+
+#include <types/RowCol.h>
+#include <six/sicd/SICDMesh.h>
+
+namespace six
+{
+namespace sicd
+{
+/*!
+ *  \struct RasterGrid
+ *  \brief A regularly sampled region of the (x,y) plane of a mesh.  x runs
+ *   along the rows and y along the columns, matching the mesh coordinates.
+ */
+struct RasterGrid
+{
+    /*!
+     * \param origin (x,y) of the first sample
+     * \param spacing Distance between samples in x and y
+     * \param dims Number of samples in x (rows) and y (cols)
+     */
+    RasterGrid(const types::RowCol<double>& origin,
+               const types::RowCol<double>& spacing,
+               const types::RowCol<size_t>& dims);
+
+    /*!
+     * Describe a region of pixels in an image whose mesh is in distance
+     * from the SCP (i.e. a SICD's slant plane or output plane mesh).  Pixel
+     * (r,c) maps to x = (r - scpPixel.row) * sampleSpacing.row and
+     * y = (c - scpPixel.col) * sampleSpacing.col.
+     *
+     * \param offset First pixel of the region
+     * \param dims Number of pixels in the region
+     * \param scpPixel Pixel location of the SCP
+     * \param sampleSpacing Row and column sample spacing
+     */
+    static RasterGrid fromPixels(const types::RowCol<size_t>& offset,
+                                 const types::RowCol<size_t>& dims,
+                                 const types::RowCol<double>& scpPixel,
+                                 const types::RowCol<double>& sampleSpacing);
+
+    types::RowCol<double> origin;
+    types::RowCol<double> spacing;
+    types::RowCol<size_t> dims;
+};
+
+/*!
+ *  \class MeshInterpolator
+ *  \brief Evaluates fields of a PlanarCoordinateMesh (i.e. the noise values
+ *   of a NoiseMesh) at arbitrary (x,y) locations.
+ *
+ *  The mesh nodes must lie on a rectilinear grid: x may only vary from row
+ *  to row and y from column to column, and both must be strictly monotonic.
+ *  This is how the SICD meshes are laid out.  Node spacing does not have to
+ *  be uniform, though uniform spacing makes finding a node's cell cheaper.
+ *
+ *  Bicubic interpolation uses the Catmull-Rom kernel in node index space, so
+ *  both methods reproduce the field exactly at the nodes, and both reproduce
+ *  linear fields exactly on uniformly spaced meshes.  Outside of the mesh,
+ *  both methods extrapolate linearly from the edge cell.
+ *
+ *  Finding the cell and computing the weights is separate from evaluating
+ *  the field, so several fields can be evaluated at the same points without
+ *  repeating that work:
+ *
+ *  \code
+    six::sicd::MeshInterpolator interpolator(noiseMesh);
+    six::sicd::MeshInterpolator::QueryPlan plan;
+    interpolator.plan(&x[0], &y[0], x.size(), plan);
+    interpolator.interpolate(plan, noiseMesh.getMainBeamNoise(), &mainBeam[0]);
+    interpolator.interpolate(plan, noiseMesh.getCombinedNoise(), &combined[0]);
+ *  \endcode
+ */
+class MeshInterpolator
+{
+public:
+    //! Interpolation method
+    enum Method
+    {
+        BILINEAR,
+        BICUBIC
+    };
+
+    //! The nodes and weights along one axis for one location
+    struct Stencil
+    {
+        size_t index[4];
+        double weight[4];
+    };
+
+    /*!
+     *  \class QueryPlan
+     *  \brief Precomputed stencils for a set of points.  Built by plan() and
+     *   only valid for the MeshInterpolator that built it.
+     */
+    class QueryPlan
+    {
+    public:
+        QueryPlan() :
+            mWidth(0)
+        {
+        }
+
+        //! \return The number of points
+        size_t size() const
+        {
+            return mRowStencils.size();
+        }
+
+    private:
+        friend class MeshInterpolator;
+
+        size_t mWidth;
+        std::vector<Stencil> mRowStencils;
+        std::vector<Stencil> mColStencils;
+    };
+
+    /*!
+     * \param mesh Mesh to interpolate.  The node coordinates are copied, so
+     * the mesh does not need to outlive this object.
+     * \param method Interpolation method
+     * \param numThreads The number of threads to use for the bulk
+     * operations.  If 0, uses the number of CPUs.
+     *
+     * \throw except::Exception if the mesh has fewer than two nodes in either
+     * dimension or its nodes are not on a monotonic rectilinear grid
+     */
+    MeshInterpolator(const PlanarCoordinateMesh& mesh,
+                     Method method = BILINEAR,
+                     size_t numThreads = 0);
+
+    //! \return The mesh dimensions
+    types::RowCol<size_t> getMeshDims() const
+    {
+        return mMeshDims;
+    }
+
+    //! \return The interpolation method
+    Method getMethod() const
+    {
+        return mMethod;
+    }
+
+    /*!
+     * Interpolate a field at one location
+     *
+     * \param field Flattened field values, one per mesh node
+     * \param x x-coordinate
+     * \param y y-coordinate
+     *
+     * \return The interpolated value
+     */
+    double interpolate(const std::vector<double>& field,
+                       double x,
+                       double y) const;
+
+    /*!
+     * Find the cell and weights for one location
+     *
+     * \param x x-coordinate
+     * \param y y-coordinate
+     * \param[out] rowStencil Mesh rows and weights
+     * \param[out] colStencil Mesh columns and weights
+     */
+    void getStencils(double x,
+                     double y,
+                     Stencil& rowStencil,
+                     Stencil& colStencil) const;
+
+    /*!
+     * Find the cells and weights for a set of points
+     *
+     * \param x x-coordinates
+     * \param y y-coordinates
+     * \param numPoints Number of points
+     * \param[out] plan Stencils for each point
+     */
+    void plan(const double* x,
+              const double* y,
+              size_t numPoints,
+              QueryPlan& plan) const;
+
+    /*!
+     * Interpolate a field at the points of a plan
+     *
+     * \param plan Plan from plan()
+     * \param field Flattened field values, one per mesh node
+     * \param[out] output One value per point
+     */
+    void interpolate(const QueryPlan& plan,
+                     const std::vector<double>& field,
+                     double* output) const;
+
+    /*!
+     * Interpolate a field at a set of points.  Same as calling plan() then
+     * interpolate().
+     *
+     * \param field Flattened field values, one per mesh node
+     * \param x x-coordinates
+     * \param y y-coordinates
+     * \param numPoints Number of points
+     * \param[out] output One value per point
+     */
+    void interpolate(const std::vector<double>& field,
+                     const double* x,
+                     const double* y,
+                     size_t numPoints,
+                     double* output) const;
+
+    /*!
+     * Interpolate a field over a regularly sampled region
+     *
+     * \param field Flattened field values, one per mesh node
+     * \param grid Region to fill
+     * \param[out] output grid.dims.row x grid.dims.col values
+     */
+    void fill(const std::vector<double>& field,
+              const RasterGrid& grid,
+              double* output) const;
+
+private:
+    struct Axis
+    {
+        void initialize(const std::vector<double>& nodes);
+
+        void getStencil(double value, Method method, Stencil& stencil) const;
+
+        // Stored in increasing order.  If the mesh is decreasing along this
+        // axis, both the nodes and the queries are negated.
+        std::vector<double> nodes;
+        double sign;
+        bool isUniform;
+        double invSpacing;
+    };
+
+    void checkField(const std::vector<double>& field) const;
+
+    size_t getStencilWidth() const
+    {
+        return (mMethod == BILINEAR) ? 2 : 4;
+    }
+
+private:
+    const Method mMethod;
+    const size_t mNumThreads;
+    types::RowCol<size_t> mMeshDims;
+    Axis mRowAxis;
+    Axis mColAxis;
+};
+}
+}
+
+#endif
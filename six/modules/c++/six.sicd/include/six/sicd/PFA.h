@@ -143,7 +143,7 @@ struct PFA
     void fillDefaultFields(const GeoData& geoData, const Grid&,
             const SCPCOA& scpcoa);
 
-    bool validate(const SCPCOA& scpcoa, logging::Logger& log);
+    bool validate(const SCPCOA& scpcoa, logging::Logger& log) const;
 };
 
 }
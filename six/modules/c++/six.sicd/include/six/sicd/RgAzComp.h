@@ -61,12 +61,12 @@ struct RgAzComp
     Poly1D kazPoly;
 
     //! Equality operator
-    bool operator==(const RgAzComp& rhs)
+    bool operator==(const RgAzComp& rhs) const
     {
         return azSF == rhs.azSF && kazPoly == rhs.kazPoly;
     }
 
-    bool operator!=(const RgAzComp& rhs)
+    bool operator!=(const RgAzComp& rhs) const
     {
         return !(*this == rhs);
     }
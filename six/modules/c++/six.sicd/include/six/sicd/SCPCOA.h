@@ -113,7 +113,7 @@ struct SCPCOA
     bool validate(const GeoData& geoData,
             const Grid& grid,
             const Position& position,
-            logging::Logger& log);
+            logging::Logger& log) const;
 
     Vector3 uLOS(const Vector3& scp) const;
     int look(const Vector3& scp) const;
@@ -24,6 +24,7 @@
 
 #include <mem/ScopedCopyablePtr.h>
 #include <six/Mesh.h>
+#include <six/Serialize.h>
 
 namespace six
 {
@@ -106,6 +107,9 @@ public:
      */
     virtual void serialize(std::vector<sys::byte>& values) const;
 
+    //! \return The number of bytes serialize() will append
+    virtual size_t getSerializedSize() const;
+
     /*!
      * Deserializes from binary to a mesh. 
      * \param values Data to deserialize.
@@ -184,6 +188,9 @@ public:
      */
     virtual void serialize(std::vector<sys::byte>& values) const;
 
+    //! \return The number of bytes serialize() will append
+    virtual size_t getSerializedSize() const;
+
     /*!
      * Deserializes from binary to a mesh. 
      * \param values Data to deserialize.
@@ -195,6 +202,45 @@ protected:
     std::vector<double> mAzimuthAmbiguityNoise;
     std::vector<double> mCombinedNoise;
 };
+
+/*!
+ *  \struct PlanarCoordinateMeshView
+ *  \brief Read-only view of a serialized PlanarCoordinateMesh that doesn't
+ *   copy the coordinates out of the serialized buffer (i.e. a memory
+ *   mapped DES).  The buffer must outlive the view.
+ */
+struct PlanarCoordinateMeshView
+{
+    /*!
+     * Point the view at a serialized mesh
+     * \param values Data to view. Pointer is incremented by the
+     *  serialized storage size of the mesh.
+     */
+    void deserialize(const sys::byte*& values);
+
+    types::RowCol<size_t> meshDims;
+    SerializedVectorView<double> x;
+    SerializedVectorView<double> y;
+};
+
+/*!
+ *  \struct NoiseMeshView
+ *  \brief Read-only view of a serialized NoiseMesh.  See
+ *   PlanarCoordinateMeshView.
+ */
+struct NoiseMeshView : public PlanarCoordinateMeshView
+{
+    /*!
+     * Point the view at a serialized mesh
+     * \param values Data to view. Pointer is incremented by the
+     *  serialized storage size of the mesh.
+     */
+    void deserialize(const sys::byte*& values);
+
+    SerializedVectorView<double> mainBeamNoise;
+    SerializedVectorView<double> azimuthAmbiguityNoise;
+    SerializedVectorView<double> combinedNoise;
+};
 }
 }
 #endif
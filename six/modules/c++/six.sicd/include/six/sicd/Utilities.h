@@ -29,6 +29,7 @@
 
 #include <scene/SceneGeometry.h>
 #include <scene/ProjectionModel.h>
+#include <scene/RPCFitter.h>
 #include <six/sicd/ComplexData.h>
 #include <six/sicd/SICDMesh.h>
 #include <six/NITFReadControl.h>
@@ -82,6 +83,23 @@ public:
                          scene::ProjectionPolynomialFitter::DEFAULTS_POINTS_1D,
                         bool sampleWithinValidDataPolygon = false);
 
+    /*!
+     * Build an RPCFitter from complexData.  The RPC it fits maps to the
+     * pixels of the image as stored (i.e. relative to the first row and
+     * column of the ImageData), which is what an RPC00B TRE expects.
+     * \param complexData ComplexData from which to construct fitter
+     * \param heightRange Range of heights in meters to sample, centered on
+     * the SCP height
+     * \param numPoints1D Number of points to use in each direction of grid.
+     * \param numHeights Number of heights to sample at each point
+     * \return RPCFitter from ComplexData
+     */
+    static std::auto_ptr<scene::RPCFitter>
+    getRPCFitter(const ComplexData& complexData,
+                 double heightRange = 1000.0,
+                 size_t numPoints1D = scene::RPCFitter::DEFAULT_POINTS_1D,
+                 size_t numHeights = scene::RPCFitter::DEFAULT_NUM_HEIGHTS);
+
     /*
      * If the SICD contains a valid data polygon, provides this.
      * If the SICD does not contain a valid data polygon, but it does contain
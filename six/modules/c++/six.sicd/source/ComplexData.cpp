@@ -32,6 +32,23 @@ Data* ComplexData::clone() const
     return new ComplexData(*this);
 }
 
+void ComplexData::markShareable()
+{
+    collectionInformation.markShareable();
+    imageCreation.markShareable();
+    grid.markShareable();
+    timeline.markShareable();
+    position.markShareable();
+    radarCollection.markShareable();
+    imageFormation.markShareable();
+    scpcoa.markShareable();
+    antenna.markShareable();
+    matchInformation.markShareable();
+    pfa.markShareable();
+    rma.markShareable();
+    rgAzComp.markShareable();
+}
+
 ComplexData::ComplexData() :
     collectionInformation(new CollectionInformation()),
     imageData(new ImageData()),
@@ -53,6 +53,17 @@ xml::lite::Document* ComplexXMLControl::toXMLImpl(const Data* data)
     return getParser(data->getVersion())->toXML(sicd);
 }
 
+void ComplexXMLControl::toXMLImpl(const Data* data, XMLStreamWriter& writer)
+{
+    if (data->getDataType() != DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Data must be SICD"));
+    }
+
+    const ComplexData* const sicd(reinterpret_cast<const ComplexData*>(data));
+    getParser(data->getVersion())->toXML(sicd, writer);
+}
+
 std::auto_ptr<ComplexXMLParser>
 ComplexXMLControl::getParser(const std::string& version) const
 {
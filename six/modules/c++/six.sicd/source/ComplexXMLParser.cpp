@@ -23,6 +23,7 @@
 #include <six/sicd/ComplexXMLParser.h>
 #include <six/sicd/ComplexDataBuilder.h>
 #include <six/Utilities.h>
+#include <six/XMLStreamWriter.h>
 
 
 namespace
@@ -136,6 +137,9 @@ ComplexData* ComplexXMLParser::fromXML(const xml::lite::Document* doc) const
         sicd->rgAzComp.reset(new RgAzComp());
         parseRgAzCompFromXML(rgAzCompXML, sicd->rgAzComp.get());
     }
+
+    // Nothing holds on to the blocks filled in above
+    sicd->markShareable();
     return sicd;
 }
 
@@ -184,6 +188,50 @@ xml::lite::Document* ComplexXMLParser::toXML(const ComplexData* sicd) const
     return doc;
 }
 
+void ComplexXMLParser::toXML(const ComplexData* sicd,
+                             XMLStreamWriter& writer) const
+{
+    writer.startElement("SICD", getDefaultURI());
+
+    //set the XMLNS
+    writer.setNamespacePrefix("", getDefaultURI());
+
+    writeCollectionInformation(writer, sicd->collectionInformation.get());
+    if (sicd->imageCreation.get())
+    {
+        writeImageCreation(writer, sicd->imageCreation.get());
+    }
+    writeImageData(writer, sicd->imageData.get());
+    writeGeoData(writer, sicd->geoData.get());
+    writeGrid(writer, sicd->grid.get());
+    writeTimeline(writer, sicd->timeline.get());
+    writePosition(writer, sicd->position.get());
+    writeRadarCollection(writer, sicd->radarCollection.get());
+    writeImageFormation(writer, sicd->imageFormation.get(),
+                        *sicd->radarCollection);
+    writeSCPCOA(writer, sicd->scpcoa.get());
+    if (sicd->radiometric.get())
+    {
+        common().writeRadiometry(writer, sicd->radiometric.get());
+    }
+    if (sicd->antenna.get())
+    {
+        writeAntenna(writer, sicd->antenna.get());
+    }
+    if (sicd->errorStatistics.get())
+    {
+        common().writeErrorStatistics(writer, sicd->errorStatistics.get());
+    }
+    if (sicd->matchInformation.get() && !sicd->matchInformation->types.empty())
+        writeMatchInformation(writer, sicd->matchInformation.get());
+
+    // parse the choice per version
+    writeImageFormationAlgo(writer, sicd->pfa.get(), sicd->rma.get(),
+                            sicd->rgAzComp.get());
+
+    writer.endElement();
+}
+
 XMLElem ComplexXMLParser::createFFTSign(const std::string& name, six::FFTSign sign,
                                          XMLElem parent) const
 {
@@ -919,6 +967,716 @@ XMLElem ComplexXMLParser::convertRgAzCompToXML(
     return rgAzCompXML;
 }
 
+void ComplexXMLParser::writeFFTSign(XMLStreamWriter& writer,
+                                    const std::string& name,
+                                    six::FFTSign sign) const
+{
+    writeInt(writer, name, getDefaultURI(),
+             (sign == FFTSign::NEG) ? "-1" : "+1");
+}
+
+void ComplexXMLParser::writeCollectionInformation(
+    XMLStreamWriter& writer,
+    const CollectionInformation *collInfo) const
+{
+    writer.startElement("CollectionInfo", getDefaultURI());
+
+    const std::string si = common().getSICommonURI();
+
+    writeString(writer, "CollectorName", si, collInfo->collectorName);
+    if (!collInfo->illuminatorName.empty())
+        writeString(writer, "IlluminatorName", si, collInfo->illuminatorName);
+    writeString(writer, "CoreName", si, collInfo->coreName);
+    if (!Init::isUndefined(collInfo->collectType))
+        writeString(writer, "CollectType", si,
+                    six::toString<six::CollectType>(collInfo->collectType));
+
+    writer.startElement("RadarMode", si);
+    writeString(writer, "ModeType", si, six::toString(collInfo->radarMode));
+    if (!collInfo->radarModeID.empty())
+        writeString(writer, "ModeID", si, collInfo->radarModeID);
+    writer.endElement();
+
+    writeString(writer, "Classification", si,
+                collInfo->classification.level);
+
+    for (std::vector<std::string>::const_iterator it =
+            collInfo->countryCodes.begin(); it != collInfo->countryCodes.end(); ++it)
+    {
+        writeString(writer, "CountryCode", si, *it);
+    }
+    common().writeParameters(writer, "Parameter", si, collInfo->parameters);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeImageCreation(
+    XMLStreamWriter& writer,
+    const ImageCreation *imageCreation) const
+{
+    writer.startElement("ImageCreation", getDefaultURI());
+
+    const std::string si = common().getSICommonURI();
+
+    if (!imageCreation->application.empty())
+        writeString(writer, "Application", si, imageCreation->application);
+    if (!Init::isUndefined(imageCreation->dateTime))
+        writeDateTime(writer, "DateTime", si, imageCreation->dateTime);
+    if (!imageCreation->site.empty())
+        writeString(writer, "Site", si, imageCreation->site);
+    if (!imageCreation->profile.empty())
+        writeString(writer, "Profile", si, imageCreation->profile);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeImageData(
+    XMLStreamWriter& writer, const ImageData *imageData) const
+{
+    writer.startElement("ImageData", getDefaultURI());
+
+    writeString(writer, "PixelType", six::toString(imageData->pixelType));
+    if (imageData->amplitudeTable.get())
+    {
+        AmplitudeTable& ampTable = *(imageData->amplitudeTable);
+        writer.startElement("AmpTable", getDefaultURI());
+        writer.addAttribute("size", str::toString(ampTable.numEntries));
+        for (unsigned int i = 0; i < ampTable.numEntries; ++i)
+        {
+            writer.addAttributeToNext("index", str::toString(i));
+            writeDouble(writer, "Amplitude", *(double*) ampTable[i]);
+        }
+        writer.endElement();
+    }
+    writeInt(writer, "NumRows", static_cast<int>(imageData->numRows));
+    writeInt(writer, "NumCols", static_cast<int>(imageData->numCols));
+    writeInt(writer, "FirstRow", static_cast<int>(imageData->firstRow));
+    writeInt(writer, "FirstCol", static_cast<int>(imageData->firstCol));
+
+    common().writeRowCol(writer, "FullImage", "NumRows", "NumCols",
+                         imageData->fullImage);
+    common().writeRowCol(writer, "SCPPixel", imageData->scpPixel);
+
+    //only if 3+ vertices
+    const size_t numVertices = imageData->validData.size();
+    if (numVertices >= 3)
+    {
+        writer.startElement("ValidData", getDefaultURI());
+        writer.addAttribute("size", str::toString(numVertices));
+
+        for (size_t ii = 0; ii < numVertices; ++ii)
+        {
+            writer.addAttributeToNext("index", str::toString(ii + 1));
+            common().writeRowCol(writer, "Vertex", imageData->validData[ii]);
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeGeoData(
+    XMLStreamWriter& writer, const GeoData *geoData) const
+{
+    writer.startElement("GeoData", getDefaultURI());
+
+    writeString(writer, "EarthModel", six::toString(geoData->earthModel));
+
+    writer.startElement("SCP", getDefaultURI());
+    common().writeVector3D(writer, "ECF", geoData->scp.ecf);
+    common().writeLatLonAlt(writer, "LLH", geoData->scp.llh);
+    writer.endElement();
+
+    writeLatLonFootprint(writer, "ImageCorners", "ICP", geoData->imageCorners);
+
+    //only if 3+ vertices
+    const size_t numVertices = geoData->validData.size();
+    if (numVertices >= 3)
+    {
+        writer.startElement("ValidData", getDefaultURI());
+        writer.addAttribute("size", str::toString(numVertices));
+
+        for (size_t ii = 0; ii < numVertices; ++ii)
+        {
+            writer.addAttributeToNext("index", str::toString(ii + 1));
+            common().writeLatLon(writer, "Vertex", geoData->validData[ii]);
+        }
+        writer.endElement();
+    }
+
+    for (size_t ii = 0; ii < geoData->geoInfos.size(); ++ii)
+    {
+        writeGeoInfo(writer, geoData->geoInfos[ii].get());
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeGrid(
+    XMLStreamWriter& writer, const Grid *grid) const
+{
+    writer.startElement("Grid", getDefaultURI());
+
+    writeString(writer, "ImagePlane", six::toString(grid->imagePlane));
+    writeString(writer, "Type", six::toString(grid->type));
+    common().writePoly2D(writer, "TimeCOAPoly", grid->timeCOAPoly);
+
+    writeDirectionParameters(writer, "Row", grid->row.get());
+    writeDirectionParameters(writer, "Col", grid->col.get());
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeDirectionParameters(
+    XMLStreamWriter& writer,
+    const std::string& name,
+    const DirectionParameters *dirParams) const
+{
+    writer.startElement(name, getDefaultURI());
+
+    common().writeVector3D(writer, "UVectECF", dirParams->unitVector);
+    writeDouble(writer, "SS", dirParams->sampleSpacing);
+    writeDouble(writer, "ImpRespWid", dirParams->impulseResponseWidth);
+    writeFFTSign(writer, "Sgn", dirParams->sign);
+    writeDouble(writer, "ImpRespBW", dirParams->impulseResponseBandwidth);
+    writeDouble(writer, "KCtr", dirParams->kCenter);
+    writeDouble(writer, "DeltaK1", dirParams->deltaK1);
+    writeDouble(writer, "DeltaK2", dirParams->deltaK2);
+
+    if (!Init::isUndefined(dirParams->deltaKCOAPoly))
+    {
+        common().writePoly2D(writer, "DeltaKCOAPoly",
+                             dirParams->deltaKCOAPoly);
+    }
+
+    if (dirParams->weightType.get())
+    {
+        writeWeightType(writer, *dirParams->weightType);
+    }
+
+    const size_t numWeights = dirParams->weights.size();
+    if (numWeights > 0)
+    {
+        writer.startElement("WgtFunct", getDefaultURI());
+        writer.addAttribute("size", str::toString(numWeights));
+
+        for (size_t i = 1; i <= numWeights; ++i)
+        {
+            writer.addAttributeToNext("index", str::toString(i));
+            writeDouble(writer, "Wgt", dirParams->weights[i - 1]);
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeTimeline(
+    XMLStreamWriter& writer, const Timeline *timeline) const
+{
+    writer.startElement("Timeline", getDefaultURI());
+
+    writeDateTime(writer, "CollectStart", timeline->collectStart);
+    writeDouble(writer, "CollectDuration", timeline->collectDuration);
+
+    if (timeline->interPulsePeriod.get())
+    {
+        writer.startElement("IPP", getDefaultURI());
+        size_t setSize = timeline->interPulsePeriod->sets.size();
+        writer.addAttribute("size", str::toString<size_t>(setSize));
+
+        for (size_t i = 0; i < setSize; ++i)
+        {
+            const TimelineSet& timelineSet = timeline->interPulsePeriod->sets[i];
+            writer.startElement("Set", getDefaultURI());
+            writer.addAttribute("index", str::toString<size_t>(i + 1));
+
+            writeDouble(writer, "TStart", timelineSet.tStart);
+            writeDouble(writer, "TEnd", timelineSet.tEnd);
+            writeInt(writer, "IPPStart", timelineSet.interPulsePeriodStart);
+            writeInt(writer, "IPPEnd", timelineSet.interPulsePeriodEnd);
+            common().writePoly1D(writer, "IPPPoly",
+                                 timelineSet.interPulsePeriodPoly);
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writePosition(
+    XMLStreamWriter& writer, const Position *position) const
+{
+    writer.startElement("Position", getDefaultURI());
+
+    common().writePolyXYZ(writer, "ARPPoly", position->arpPoly);
+    if (!Init::isUndefined(position->grpPoly))
+        common().writePolyXYZ(writer, "GRPPoly", position->grpPoly);
+    if (!Init::isUndefined(position->txAPCPoly))
+        common().writePolyXYZ(writer, "TxAPCPoly", position->txAPCPoly);
+    if (position->rcvAPC.get() && !position->rcvAPC->rcvAPCPolys.empty())
+    {
+        size_t numPolys = position->rcvAPC->rcvAPCPolys.size();
+        writer.startElement("RcvAPC", getDefaultURI());
+        writer.addAttribute("size", str::toString(numPolys));
+
+        for (size_t i = 0; i < numPolys; ++i)
+        {
+            writer.addAttributeToNext("index", str::toString(i + 1));
+            common().writePolyXYZ(writer, "RcvAPCPoly",
+                                  position->rcvAPC->rcvAPCPolys[i]);
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeTxFrequency(XMLStreamWriter& writer,
+                                        const RadarCollection* radar) const
+{
+    writer.startElement("TxFrequency", getDefaultURI());
+    writeDouble(writer, "Min", radar->txFrequencyMin);
+    writeDouble(writer, "Max", radar->txFrequencyMax);
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeTxSequence(XMLStreamWriter& writer,
+                                       const RadarCollection* radar) const
+{
+    if (!radar->txSequence.empty())
+    {
+        writer.startElement("TxSequence", getDefaultURI());
+        writer.addAttribute("size", str::toString(radar->txSequence.size()));
+
+        for (size_t ii = 0; ii < radar->txSequence.size(); ++ii)
+        {
+            const TxStep* const tx = radar->txSequence[ii].get();
+
+            writer.startElement("TxStep", getDefaultURI());
+            writer.addAttribute("index", str::toString(ii + 1));
+
+            if (!Init::isUndefined(tx->waveformIndex))
+            {
+                writeInt(writer, "WFIndex", tx->waveformIndex);
+            }
+            if (tx->txPolarization != PolarizationType::NOT_SET)
+            {
+                writeString(writer, "TxPolarization",
+                            six::toString(tx->txPolarization));
+            }
+            writer.endElement();
+        }
+
+        writer.endElement();
+    }
+}
+
+void ComplexXMLParser::writeWaveform(XMLStreamWriter& writer,
+                                     const RadarCollection* radar) const
+{
+    if (!radar->waveform.empty())
+    {
+        const size_t numWaveforms = radar->waveform.size();
+        writer.startElement("Waveform", getDefaultURI());
+        writer.addAttribute("size", str::toString(numWaveforms));
+
+        for (size_t ii = 0; ii < numWaveforms; ++ii)
+        {
+            const WaveformParameters* const wf = radar->waveform[ii].get();
+
+            writer.startElement("WFParameters", getDefaultURI());
+            writer.addAttribute("index", str::toString(ii + 1));
+
+            if (!Init::isUndefined(wf->txPulseLength))
+                writeDouble(writer, "TxPulseLength", wf->txPulseLength);
+            if (!Init::isUndefined(wf->txRFBandwidth))
+                writeDouble(writer, "TxRFBandwidth", wf->txRFBandwidth);
+            if (!Init::isUndefined(wf->txFrequencyStart))
+                writeDouble(writer, "TxFreqStart", wf->txFrequencyStart);
+            if (!Init::isUndefined(wf->txFMRate))
+                writeDouble(writer, "TxFMRate", wf->txFMRate);
+            if (wf->rcvDemodType != DemodType::NOT_SET)
+                writeString(writer, "RcvDemodType",
+                            six::toString(wf->rcvDemodType));
+            if (!Init::isUndefined(wf->rcvWindowLength))
+                writeDouble(writer, "RcvWindowLength", wf->rcvWindowLength);
+            if (!Init::isUndefined(wf->adcSampleRate))
+                writeDouble(writer, "ADCSampleRate", wf->adcSampleRate);
+            if (!Init::isUndefined(wf->rcvIFBandwidth))
+                writeDouble(writer, "RcvIFBandwidth", wf->rcvIFBandwidth);
+            if (!Init::isUndefined(wf->rcvFrequencyStart))
+                writeDouble(writer, "RcvFreqStart", wf->rcvFrequencyStart);
+            if (!Init::isUndefined(wf->rcvFMRate))
+                writeDouble(writer, "RcvFMRate", wf->rcvFMRate);
+            writer.endElement();
+        }
+
+        writer.endElement();
+    }
+}
+
+void ComplexXMLParser::writeArea(XMLStreamWriter& writer,
+                                 const RadarCollection* radar) const
+{
+    if (radar->area.get() != NULL)
+    {
+        writer.startElement("Area", getDefaultURI());
+        const Area* const area = radar->area.get();
+
+        bool haveACPCorners = true;
+
+        for (size_t ii = 0; ii < LatLonAltCorners::NUM_CORNERS; ++ii)
+        {
+            if (Init::isUndefined(area->acpCorners.getCorner(ii)))
+            {
+                haveACPCorners = false;
+                break;
+            }
+        }
+
+        if (haveACPCorners)
+        {
+            writeLatLonAltFootprint(writer, "Corner", "ACP", area->acpCorners);
+        }
+
+        const AreaPlane* const plane = area->plane.get();
+        if (plane)
+        {
+            writer.startElement("Plane", getDefaultURI());
+            writer.startElement("RefPt", getDefaultURI());
+
+            const ReferencePoint& refPt = plane->referencePoint;
+            if (!refPt.name.empty())
+                writer.addAttribute("name", refPt.name);
+
+            common().writeVector3D(writer, "ECF", refPt.ecef);
+            writeDouble(writer, "Line", refPt.rowCol.row);
+            writeDouble(writer, "Sample", refPt.rowCol.col);
+            writer.endElement();
+
+            writeAreaLineDirectionParameters(writer, "XDir",
+                                             plane->xDirection.get());
+            writeAreaSampleDirectionParameters(writer, "YDir",
+                                               plane->yDirection.get());
+
+            if (!plane->segmentList.empty())
+            {
+                writer.startElement("SegmentList", getDefaultURI());
+                writer.addAttribute("size",
+                                    str::toString(plane->segmentList.size()));
+
+                for (size_t ii = 0; ii < plane->segmentList.size(); ++ii)
+                {
+                    const Segment* const segment = plane->segmentList[ii].get();
+                    writer.startElement("Segment", getDefaultURI());
+                    writer.addAttribute("index", str::toString(ii + 1));
+
+                    writeInt(writer, "StartLine", segment->startLine);
+                    writeInt(writer, "StartSample", segment->startSample);
+                    writeInt(writer, "EndLine", segment->endLine);
+                    writeInt(writer, "EndSample", segment->endSample);
+                    writeString(writer, "Identifier", segment->identifier);
+                    writer.endElement();
+                }
+                writer.endElement();
+            }
+
+            if (!Init::isUndefined(plane->orientation))
+            {
+                writeString(writer, "Orientation",
+                            six::toString<OrientationType>(plane->orientation));
+            }
+            writer.endElement();
+        }
+
+        writer.endElement();
+    }
+}
+
+void ComplexXMLParser::writeAreaLineDirectionParameters(
+    XMLStreamWriter& writer,
+    const std::string& name,
+    const AreaDirectionParameters *adp) const
+{
+    writer.startElement(name, getDefaultURI());
+    common().writeVector3D(writer, "UVectECF", adp->unitVector);
+    writeDouble(writer, "LineSpacing", adp->spacing);
+    writeInt(writer, "NumLines", static_cast<int>(adp->elements));
+    writeInt(writer, "FirstLine", static_cast<int>(adp->first));
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeAreaSampleDirectionParameters(
+    XMLStreamWriter& writer,
+    const std::string& name,
+    const AreaDirectionParameters *adp) const
+{
+    writer.startElement(name, getDefaultURI());
+    common().writeVector3D(writer, "UVectECF", adp->unitVector);
+    writeDouble(writer, "SampleSpacing", adp->spacing);
+    writeInt(writer, "NumSamples", static_cast<int>(adp->elements));
+    writeInt(writer, "FirstSample", static_cast<int>(adp->first));
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeSCPCOA(
+    XMLStreamWriter& writer,
+    const SCPCOA *scpcoa) const
+{
+    writer.startElement("SCPCOA", getDefaultURI());
+    writeSCPCOAParameters(writer, scpcoa);
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeSCPCOAParameters(
+    XMLStreamWriter& writer,
+    const SCPCOA *scpcoa) const
+{
+    writeDouble(writer, "SCPTime", scpcoa->scpTime);
+    common().writeVector3D(writer, "ARPPos", scpcoa->arpPos);
+    common().writeVector3D(writer, "ARPVel", scpcoa->arpVel);
+    common().writeVector3D(writer, "ARPAcc", scpcoa->arpAcc);
+    writeString(writer, "SideOfTrack", six::toString(scpcoa->sideOfTrack));
+    writeDouble(writer, "SlantRange", scpcoa->slantRange);
+    writeDouble(writer, "GroundRange", scpcoa->groundRange);
+    writeDouble(writer, "DopplerConeAng", scpcoa->dopplerConeAngle);
+    writeDouble(writer, "GrazeAng", scpcoa->grazeAngle);
+    writeDouble(writer, "IncidenceAng", scpcoa->incidenceAngle);
+    writeDouble(writer, "TwistAng", scpcoa->twistAngle);
+    writeDouble(writer, "SlopeAng", scpcoa->slopeAngle);
+}
+
+void ComplexXMLParser::writeAntenna(
+    XMLStreamWriter& writer,
+    const Antenna *antenna) const
+{
+    writer.startElement("Antenna", getDefaultURI());
+
+    if (antenna->tx.get())
+    {
+        writeAntennaParameters(writer, "Tx", antenna->tx.get());
+    }
+    if (antenna->rcv.get())
+    {
+        writeAntennaParameters(writer, "Rcv", antenna->rcv.get());
+    }
+    if (antenna->twoWay.get())
+    {
+        writeAntennaParameters(writer, "TwoWay", antenna->twoWay.get());
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeAntennaParameters(
+    XMLStreamWriter& writer,
+    const std::string& name,
+    const AntennaParameters *params) const
+{
+    writer.startElement(name, getDefaultURI());
+
+    common().writePolyXYZ(writer, "XAxisPoly", params->xAxisPoly);
+    common().writePolyXYZ(writer, "YAxisPoly", params->yAxisPoly);
+    writeDouble(writer, "FreqZero", params->frequencyZero);
+
+    if (params->electricalBoresight.get())
+    {
+        writer.startElement("EB", getDefaultURI());
+        common().writePoly1D(writer, "DCXPoly",
+                             params->electricalBoresight->dcxPoly);
+        common().writePoly1D(writer, "DCYPoly",
+                             params->electricalBoresight->dcyPoly);
+        writer.endElement();
+    }
+
+    this->writeHPBW(writer, params->halfPowerBeamwidths.get());
+
+    this->writeAntennaParamArray(writer, name, params->array.get());
+
+    if (params->element.get())
+    {
+        writer.startElement("Elem", getDefaultURI());
+        common().writePoly2D(writer, "GainPoly", params->element->gainPoly);
+        common().writePoly2D(writer, "PhasePoly", params->element->phasePoly);
+        writer.endElement();
+    }
+    if (!params->gainBSPoly.empty())
+    {
+        common().writePoly1D(writer, "GainBSPoly", params->gainBSPoly);
+    }
+
+    writeBooleanType(writer, "EBFreqShift",
+                     params->electricalBoresightFrequencyShift);
+    writeBooleanType(writer, "MLFreqDilation",
+                     params->mainlobeFrequencyDilation);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writePFA(
+    XMLStreamWriter& writer,
+    const PFA *pfa) const
+{
+    writer.startElement("PFA", getDefaultURI());
+
+    common().writeVector3D(writer, "FPN", pfa->focusPlaneNormal);
+    common().writeVector3D(writer, "IPN", pfa->imagePlaneNormal);
+    writeDouble(writer, "PolarAngRefTime", pfa->polarAngleRefTime);
+    common().writePoly1D(writer, "PolarAngPoly", pfa->polarAnglePoly);
+    common().writePoly1D(writer, "SpatialFreqSFPoly",
+                         pfa->spatialFrequencyScaleFactorPoly);
+    writeDouble(writer, "Krg1", pfa->krg1);
+    writeDouble(writer, "Krg2", pfa->krg2);
+    writeDouble(writer, "Kaz1", pfa->kaz1);
+    writeDouble(writer, "Kaz2", pfa->kaz2);
+    if (pfa->slowTimeDeskew.get())
+    {
+        writer.startElement("STDeskew", getDefaultURI());
+        require(writeBooleanType(writer, "Applied",
+                                 pfa->slowTimeDeskew->applied), "Applied");
+
+        common().writePoly2D(writer, "STDSPhasePoly",
+                             pfa->slowTimeDeskew->slowTimeDeskewPhasePoly);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeDRateSFPoly(
+    XMLStreamWriter& writer, const INCA* inca) const
+{
+    //! Poly2D in 0.4.1
+    common().writePoly2D(writer, "DRateSFPoly",
+                         inca->dopplerRateScaleFactorPoly);
+}
+
+void ComplexXMLParser::writeRMCR(
+    XMLStreamWriter& writer,
+    const RMCR* rmcr) const
+{
+    writeString(writer, "ImageType", "RMCR");
+
+    writer.startElement("RMCR", getDefaultURI());
+
+    common().writeVector3D(writer, "PosRef", rmcr->refPos);
+    common().writeVector3D(writer, "VelRef", rmcr->refVel);
+    writeDouble(writer, "DopConeAngRef", rmcr->dopConeAngleRef);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeINCA(
+    XMLStreamWriter& writer,
+    const INCA* inca) const
+{
+    writeString(writer, "ImageType", "INCA");
+
+    writer.startElement("INCA", getDefaultURI());
+
+    common().writePoly1D(writer, "TimeCAPoly", inca->timeCAPoly);
+    writeDouble(writer, "R_CA_SCP", inca->rangeCA);
+    writeDouble(writer, "FreqZero", inca->freqZero);
+
+    writeDRateSFPoly(writer, inca);
+
+    if (!inca->dopplerCentroidPoly.empty())
+    {
+        common().writePoly2D(writer, "DopCentroidPoly",
+                             inca->dopplerCentroidPoly);
+    }
+
+    if (!Init::isUndefined(inca->dopplerCentroidCOA))
+    {
+        writeBooleanType(writer, "DopCentroidCOA", inca->dopplerCentroidCOA);
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeRcvChanProc(
+    XMLStreamWriter& writer,
+    const std::string& version,
+    const RcvChannelProcessed* rcvChanProc) const
+{
+    if (rcvChanProc)
+    {
+        writer.startElement("RcvChanProc", getDefaultURI());
+        writeInt(writer, "NumChanProc", rcvChanProc->numChannelsProcessed);
+        if (!Init::isUndefined(rcvChanProc->prfScaleFactor))
+            writeDouble(writer, "PRFScaleFactor",
+                        rcvChanProc->prfScaleFactor);
+
+        for (std::vector<int>::const_iterator it =
+                rcvChanProc->channelIndex.begin();
+             it != rcvChanProc->channelIndex.end(); ++it)
+        {
+            writeInt(writer, "ChanIndex", *it);
+        }
+        writer.endElement();
+    }
+    else
+    {
+        throw except::Exception(Ctxt(FmtX(
+            "[RcvChanProc] is a manditory field in ImageFormation in %s",
+            version.c_str())));
+    }
+}
+
+void ComplexXMLParser::writeDistortion(
+    XMLStreamWriter& writer,
+    const std::string& version,
+    const Distortion* distortion) const
+{
+    if (distortion)
+    {
+        writer.startElement("Distortion", getDefaultURI());
+
+        //This should be optionally added...
+        writeDateTime(writer, "CalibrationDate", distortion->calibrationDate);
+        writeDouble(writer, "A", distortion->a);
+        common().writeComplex(writer, "F1", distortion->f1);
+        common().writeComplex(writer, "Q1", distortion->q1);
+        common().writeComplex(writer, "Q2", distortion->q2);
+        common().writeComplex(writer, "F2", distortion->f2);
+        common().writeComplex(writer, "Q3", distortion->q3);
+        common().writeComplex(writer, "Q4", distortion->q4);
+
+        if (!Init::isUndefined(distortion->gainErrorA))
+            writeDouble(writer, "GainErrorA", distortion->gainErrorA);
+        if (!Init::isUndefined(distortion->gainErrorF1))
+            writeDouble(writer, "GainErrorF1", distortion->gainErrorF1);
+        if (!Init::isUndefined(distortion->gainErrorF2))
+            writeDouble(writer, "GainErrorF2", distortion->gainErrorF2);
+        if (!Init::isUndefined(distortion->phaseErrorF1))
+            writeDouble(writer, "PhaseErrorF1", distortion->phaseErrorF1);
+        if (!Init::isUndefined(distortion->phaseErrorF2))
+            writeDouble(writer, "PhaseErrorF2", distortion->phaseErrorF2);
+
+        writer.endElement();
+    }
+    else
+    {
+        throw except::Exception(Ctxt(FmtX(
+            "[Distortion] is a maditory field of ImageFormation in %s",
+            version.c_str())));
+    }
+}
+
+void ComplexXMLParser::writeRgAzComp(
+    XMLStreamWriter& writer,
+    const RgAzComp* rgAzComp) const
+{
+    writer.startElement("RgAzComp", getDefaultURI());
+
+    writeDouble(writer, "AzSF", rgAzComp->azSF);
+    common().writePoly1D(writer, "KazPoly", rgAzComp->kazPoly);
+
+    writer.endElement();
+}
+
 void ComplexXMLParser::parseDRateSFPolyFromXML(
     const XMLElem incaElem, INCA* inca) const
 {
@@ -1968,6 +2726,51 @@ XMLElem ComplexXMLParser::createLatLonAltFootprint(const std::string& name,
     return footprint;
 }
 
+void ComplexXMLParser::writeLatLonFootprint(XMLStreamWriter& writer,
+                                            const std::string& name,
+                                            const std::string& cornerName,
+                                            const LatLonCorners& corners) const
+{
+    writer.startElement(name, getDefaultURI());
+
+    // Write the corners in CW order
+    writer.addAttributeToNext("index", "1:FRFC");
+    common().writeLatLon(writer, cornerName, corners.upperLeft);
+
+    writer.addAttributeToNext("index", "2:FRLC");
+    common().writeLatLon(writer, cornerName, corners.upperRight);
+
+    writer.addAttributeToNext("index", "3:LRLC");
+    common().writeLatLon(writer, cornerName, corners.lowerRight);
+
+    writer.addAttributeToNext("index", "4:LRFC");
+    common().writeLatLon(writer, cornerName, corners.lowerLeft);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser::writeLatLonAltFootprint(XMLStreamWriter& writer,
+                                               const std::string& name,
+                                               const std::string& cornerName,
+                                               const LatLonAltCorners& corners) const
+{
+    writer.startElement(name, getDefaultURI());
+
+    // Write the corners in CW order
+    writer.addAttributeToNext("index", "1");
+    common().writeLatLonAlt(writer, cornerName, corners.upperLeft);
+
+    writer.addAttributeToNext("index", "2");
+    common().writeLatLonAlt(writer, cornerName, corners.upperRight);
+
+    writer.addAttributeToNext("index", "3");
+    common().writeLatLonAlt(writer, cornerName, corners.lowerRight);
+
+    writer.addAttributeToNext("index", "4");
+    common().writeLatLonAlt(writer, cornerName, corners.lowerLeft);
+
+    writer.endElement();
+}
 
 XMLElem ComplexXMLParser::createEarthModelType(const std::string& name,
                                                const EarthModelType& value,
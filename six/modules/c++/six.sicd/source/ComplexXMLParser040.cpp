@@ -22,6 +22,7 @@
 
 #include <six/sicd/ComplexXMLParser040.h>
 #include <six/SICommonXMLParser01x.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -107,6 +108,54 @@ void ComplexXMLParser040::convertDRateSFPolyToXML(
         oneDPoly, incaXML);
 }
 
+void ComplexXMLParser040::writeRMAT(
+    XMLStreamWriter& writer,
+    const RMAT* rmat) const
+{
+    writeString(writer, "ImageType", "RMAT");
+
+    writer.startElement("RMAT", getDefaultURI());
+
+    writeDouble(writer, "RMRefTime", rmat->refTime);
+    common().writeVector3D(writer, "RMPosRef", rmat->refPos);
+    common().writeVector3D(writer, "RMVelRef", rmat->refVel);
+    common().writePoly2D(writer, "CosDCACOAPoly", rmat->cosDCACOAPoly);
+    writeDouble(writer, "Kx1", rmat->kx1);
+    writeDouble(writer, "Kx2", rmat->kx2);
+    writeDouble(writer, "Ky1", rmat->ky1);
+    writeDouble(writer, "Ky2", rmat->ky2);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser040::writeDRateSFPoly(
+    XMLStreamWriter& writer, const INCA* inca) const
+{
+    //! Poly1D in 0.4.0
+    if (inca->dopplerRateScaleFactorPoly.orderX() != 0 &&
+        inca->dopplerRateScaleFactorPoly.orderY() != 0)
+    {
+        throw except::Exception(Ctxt("Verify the poly is stored in 1D form"));
+    }
+
+    // Reshape the data into a Poly1D for writing
+    six::Poly1D oneDPoly;
+    if (inca->dopplerRateScaleFactorPoly.orderX() != 0)
+    {
+        oneDPoly = six::Poly1D(inca->dopplerRateScaleFactorPoly.orderX());
+        for (size_t ii = 0; ii <= oneDPoly.order(); ++ii)
+        {
+            oneDPoly[ii] = inca->dopplerRateScaleFactorPoly[ii][0];
+        }
+    }
+    else
+    {
+        oneDPoly = inca->dopplerRateScaleFactorPoly[0];
+    }
+
+    common().writePoly1D(writer, "DRateSFPoly", oneDPoly);
+}
+
 void ComplexXMLParser040::parseDRateSFPolyFromXML(
     const XMLElem incaElem, INCA* inca) const
 {
@@ -22,6 +22,7 @@
 
 #include <six/sicd/ComplexXMLParser041.h>
 #include <six/SICommonXMLParser01x.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -109,6 +110,40 @@ XMLElem ComplexXMLParser041::convertImageFormationAlgoToXML(
             pfa, rma, rgAzComp, parent);
 }
 
+void ComplexXMLParser041::writeRMAT(
+    XMLStreamWriter& writer,
+    const RMAT* rmat) const
+{
+    writeString(writer, "ImageType", "RMAT");
+
+    writer.startElement("RMAT", getDefaultURI());
+
+    writeDouble(writer, "RefTime", rmat->refTime);
+    common().writeVector3D(writer, "PosRef", rmat->refPos);
+    common().writeVector3D(writer, "UnitVelRef", rmat->refVel);
+    common().writePoly1D(writer, "DistRLPoly", rmat->distRefLinePoly);
+    common().writePoly2D(writer, "CosDCACOAPoly", rmat->cosDCACOAPoly);
+    writeDouble(writer, "Kx1", rmat->kx1);
+    writeDouble(writer, "Kx2", rmat->kx2);
+    writeDouble(writer, "Ky1", rmat->ky1);
+    writeDouble(writer, "Ky2", rmat->ky2);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser041::writeImageFormationAlgo(
+    XMLStreamWriter& writer,
+    const PFA* pfa, const RMA* rma,
+    const RgAzComp* rgAzComp) const
+{
+    //! OTHER writes no image formation algorithm node, as above
+    if (pfa || rma || rgAzComp)
+    {
+        ComplexXMLParser04x::writeImageFormationAlgo(
+                writer, pfa, rma, rgAzComp);
+    }
+}
+
 }
 }
 
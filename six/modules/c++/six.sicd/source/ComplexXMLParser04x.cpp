@@ -21,6 +21,7 @@
  */
 
 #include <six/Utilities.h>
+#include <six/XMLStreamWriter.h>
 #include <six/sicd/ComplexXMLParser04x.h>
 
 namespace
@@ -358,6 +359,285 @@ XMLElem ComplexXMLParser04x::convertAntennaParamArrayToXML(
     }
 }
 
+void ComplexXMLParser04x::writeGeoInfo(
+    XMLStreamWriter& writer,
+    const GeoInfo *geoInfo) const
+{
+    //! 0.4.x has ordering (1. GeoInfo, 2. Desc, 3. choice)
+    writer.startElement("GeoInfo", getDefaultURI());
+    if (!geoInfo->name.empty())
+        writer.addAttribute("name", geoInfo->name);
+
+    for (size_t ii = 0; ii < geoInfo->geoInfos.size(); ++ii)
+    {
+        writeGeoInfo(writer, geoInfo->geoInfos[ii].get());
+    }
+
+    common().writeParameters(writer, "Desc", geoInfo->desc);
+
+    const size_t numLatLons = geoInfo->geometryLatLon.size();
+    if (numLatLons == 1)
+    {
+        common().writeLatLon(writer, "Point", geoInfo->geometryLatLon[0]);
+    }
+    else if (numLatLons >= 2)
+    {
+        writer.startElement(numLatLons == 2 ? "Line" : "Polygon",
+                            getDefaultURI());
+        writer.addAttribute("size", str::toString(numLatLons));
+
+        for (size_t ii = 0; ii < numLatLons; ++ii)
+        {
+            writer.addAttributeToNext("index", str::toString(ii + 1));
+            common().writeLatLon(writer,
+                                 numLatLons == 2 ? "Endpoint" : "Vertex",
+                                 geoInfo->geometryLatLon[ii]);
+        }
+        writer.endElement();
+    }
+    writer.endElement();
+}
+
+void ComplexXMLParser04x::writeWeightType(
+    XMLStreamWriter& writer,
+    const WeightType& obj) const
+{
+    writeString(writer, "WgtType", obj.windowName);
+}
+
+void ComplexXMLParser04x::writeRadarCollection(
+    XMLStreamWriter& writer,
+    const RadarCollection *radar) const
+{
+    writer.startElement("RadarCollection", getDefaultURI());
+
+    if (!Init::isUndefined(radar->refFrequencyIndex))
+    {
+        writeInt(writer, "RefFreqIndex", radar->refFrequencyIndex);
+    }
+
+    writeTxFrequency(writer, radar);
+
+    if (radar->txPolarization != PolarizationSequenceType::NOT_SET)
+    {
+        // In SICD 0.4, this is not allowed to contain UNKNOWN or SEQUENCE
+        writeString(writer, "TxPolarization",
+                six::toString(PolarizationType(radar->txPolarization.value)));
+    }
+
+    if (!Init::isUndefined(radar->polarizationHVAnglePoly))
+    {
+        common().writePoly1D(writer, "PolarizationHVAnglePoly",
+                             radar->polarizationHVAnglePoly);
+    }
+
+    writeTxSequence(writer, radar);
+    writeWaveform(writer, radar);
+    writeRcvChannels(writer, radar);
+    writeArea(writer, radar);
+    common().writeParameters(writer, "Parameter", radar->parameters);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser04x::writeMatchInformation(
+    XMLStreamWriter& writer,
+    const MatchInformation* matchInfo) const
+{
+    writer.startElement("MatchInfo", getDefaultURI());
+
+    for (size_t i = 0; i < matchInfo->types.size(); ++i)
+    {
+        const MatchType* mt = matchInfo->types[i].get();
+        writer.startElement("Collect", getDefaultURI());
+        writer.addAttribute("index", str::toString(i + 1));
+
+        writeString(writer, "CollectorName", mt->collectorName);
+        if (!mt->illuminatorName.empty())
+            writeString(writer, "IlluminatorName", mt->illuminatorName);
+        writeString(writer, "CoreName", mt->matchCollects[0].coreName);
+
+        for (std::vector<std::string>::const_iterator it =
+                mt->matchType.begin(); it != mt->matchType.end(); ++it)
+        {
+            writeString(writer, "MatchType", *it);
+        }
+        common().writeParameters(writer, "Parameter",
+                                 mt->matchCollects[0].parameters);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser04x::writeImageFormation(
+    XMLStreamWriter& writer,
+    const ImageFormation* imageFormation,
+    const RadarCollection& radarCollection) const
+{
+    writer.startElement("ImageFormation", getDefaultURI());
+
+    if (radarCollection.area.get() != NULL &&
+        radarCollection.area->plane.get() != NULL &&
+        !radarCollection.area->plane->segmentList.empty() &&
+        imageFormation->segmentIdentifier.empty())
+    {
+        throw except::Exception(Ctxt(
+            "ImageFormation.SegmentIdentifier must be included when a "
+            "RadarCollection.Area.Plane.SegmentList is included."));
+    }
+
+    if (!imageFormation->segmentIdentifier.empty())
+        writeString(writer, "SegmentIdentifier",
+                    imageFormation->segmentIdentifier);
+    writeRcvChanProc(writer, "0.4",
+                     imageFormation->rcvChannelProcessed.get());
+
+    if (imageFormation->txRcvPolarizationProc != DualPolarizationType::NOT_SET)
+    {
+        writeString(writer, "TxRcvPolarizationProc",
+                    six::toString(imageFormation->txRcvPolarizationProc));
+    }
+
+    writeString(writer, "ImageFormAlgo",
+                six::toString(imageFormation->imageFormationAlgorithm));
+
+    writeDouble(writer, "TStartProc", imageFormation->tStartProc);
+    writeDouble(writer, "TEndProc", imageFormation->tEndProc);
+
+    writer.startElement("TxFrequencyProc", getDefaultURI());
+    writeDouble(writer, "MinProc", imageFormation->txFrequencyProcMin);
+    writeDouble(writer, "MaxProc", imageFormation->txFrequencyProcMax);
+    writer.endElement();
+
+    writeString(writer, "STBeamComp",
+                six::toString(imageFormation->slowTimeBeamCompensation));
+    writeString(writer, "ImageBeamComp",
+                six::toString(imageFormation->imageBeamCompensation));
+    writeString(writer, "AzAutofocus",
+                six::toString(imageFormation->azimuthAutofocus));
+    writeString(writer, "RgAutofocus",
+                six::toString(imageFormation->rangeAutofocus));
+
+    for (size_t i = 0; i < imageFormation->processing.size(); ++i)
+    {
+        const Processing* proc = &imageFormation->processing[i];
+
+        writer.startElement("Processing", getDefaultURI());
+
+        writeString(writer, "Type", proc->type);
+        require(writeBooleanType(writer, "Applied", proc->applied), "Applied");
+        common().writeParameters(writer, "Parameter", proc->parameters);
+        writer.endElement();
+    }
+
+    if (imageFormation->polarizationCalibration.get())
+    {
+        writer.startElement("PolarizationCalibration", getDefaultURI());
+
+        require(writeBooleanType(writer,
+            "HVAngleCompApplied",
+            imageFormation->polarizationCalibration->hvAngleCompensationApplied),
+            "HVAngleCompApplied");
+
+        require(writeBooleanType(writer,
+            "DistortionCorrectionApplied",
+            imageFormation->polarizationCalibration->distortionCorrectionApplied),
+            "DistortionCorrectionApplied");
+
+        writeDistortion(writer, "0.4",
+            imageFormation->polarizationCalibration->distortion.get());
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser04x::writeImageFormationAlgo(
+    XMLStreamWriter& writer,
+    const PFA* pfa, const RMA* rma,
+    const RgAzComp* rgAzComp) const
+{
+    if (rgAzComp)
+    {
+        throw except::Exception(Ctxt(
+            "RgAzComp cannot be defined in SICD 0.4"));
+    }
+    else if (pfa && !rma)
+    {
+        writePFA(writer, pfa);
+    }
+    else if (!pfa && rma)
+    {
+        writeRMA(writer, rma);
+    }
+    else
+    {
+        //! See convertImageFormationAlgoToXML() -- 0.4.1 specializes this
+        //  to allow OTHER.
+        throw except::Exception(Ctxt(
+            "Only one PFA or RMA can be defined in SICD 0.4"));
+    }
+}
+
+void ComplexXMLParser04x::writeRMA(
+    XMLStreamWriter& writer,
+    const RMA* rma) const
+{
+    writer.startElement("RMA", getDefaultURI());
+
+    writeString(writer, "RMAlgoType",
+                six::toString<six::RMAlgoType>(rma->algoType));
+
+    if (rma->rmcr.get())
+    {
+        throw except::Exception(Ctxt(
+            "RMCR cannot be defined in SICD 0.4"));
+    }
+    else if (rma->rmat.get() && !rma->inca.get())
+    {
+        writeRMAT(writer, rma->rmat.get());
+    }
+    else if (!rma->rmat.get() && rma->inca.get())
+    {
+        writeINCA(writer, rma->inca.get());
+    }
+    else
+    {
+        throw except::Exception(Ctxt(
+            "RMAT or INCA must be defined in SICD 0.4"));
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser04x::writeHPBW(
+    XMLStreamWriter& writer,
+    const HalfPowerBeamwidths* halfPowerBeamwidths) const
+{
+    if (halfPowerBeamwidths)
+    {
+        writer.startElement("HPBW", getDefaultURI());
+        writeDouble(writer, "DCX", halfPowerBeamwidths->dcx);
+        writeDouble(writer, "DCY", halfPowerBeamwidths->dcy);
+        writer.endElement();
+    }
+}
+
+void ComplexXMLParser04x::writeAntennaParamArray(
+    XMLStreamWriter& writer,
+    const std::string& /*name*/,
+    const GainAndPhasePolys* array) const
+{
+    //! optional field in 0.4
+    if (array)
+    {
+        writer.startElement("Array", getDefaultURI());
+        common().writePoly2D(writer, "GainPoly", array->gainPoly);
+        common().writePoly2D(writer, "PhasePoly", array->phasePoly);
+        writer.endElement();
+    }
+}
 
 void ComplexXMLParser04x::parseWeightTypeFromXML(
     const XMLElem gridRowColXML,
@@ -509,6 +789,32 @@ XMLElem ComplexXMLParser04x::createRcvChannels(const RadarCollection* radar,
     return rcvChanXML;
 }
 
+void ComplexXMLParser04x::writeRcvChannels(XMLStreamWriter& writer,
+                                           const RadarCollection* radar) const
+{
+    const size_t numChannels = radar->rcvChannels.size();
+    writer.startElement("RcvChannels", getDefaultURI());
+    writer.addAttribute("size", str::toString(numChannels));
+    for (size_t ii = 0; ii < numChannels; ++ii)
+    {
+        const ChannelParameters* const cp = radar->rcvChannels[ii].get();
+        writer.startElement("ChanParameters", getDefaultURI());
+        writer.addAttribute("index", str::toString(ii + 1));
+
+        if (!Init::isUndefined(cp->rcvAPCIndex))
+            writeInt(writer, "RcvAPCIndex", cp->rcvAPCIndex);
+
+        if (cp->txRcvPolarization != DualPolarizationType::NOT_SET)
+        {
+            writeString(writer, "TxRcvPolarization", six::toString<
+                    DualPolarizationType>(cp->txRcvPolarization));
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 void ComplexXMLParser04x::parseRadarCollectionFromXML(
     const XMLElem radarCollectionXML,
     RadarCollection* radarCollection) const
@@ -22,6 +22,7 @@
 
 #include <six/Utilities.h>
 #include <six/SICommonXMLParser01x.h>
+#include <six/XMLStreamWriter.h>
 #include <six/sicd/ComplexXMLParser050.h>
 
 namespace
@@ -47,6 +48,10 @@ public:
     virtual void parseRadiometryFromXML(
         const XMLElem radiometricXML,
         six::Radiometric *obj) const;
+
+    virtual void writeRadiometry(
+        six::XMLStreamWriter& writer,
+        const six::Radiometric *obj) const;
 };
 
 XMLElem SICommonXMLParser050::convertRadiometryToXML(
@@ -109,6 +114,65 @@ XMLElem SICommonXMLParser050::convertRadiometryToXML(
     return rXML;
 }
 
+void SICommonXMLParser050::writeRadiometry(
+    six::XMLStreamWriter& writer, const six::Radiometric* r) const
+{
+    std::string defaultURI = getSICommonURI();
+    writer.startElement("Radiometric", getDefaultURI());
+
+    if (!r->noiseLevel.noisePoly.empty())
+    {
+        writePoly2D(writer, "NoisePoly", defaultURI, r->noiseLevel.noisePoly);
+    }
+
+    if (!r->noiseLevel.noiseType.empty())
+    {
+        writeString(writer, "NoiseLevelType", defaultURI,
+                    r->noiseLevel.noiseType);
+    }
+
+    if (!r->rcsSFPoly.empty())
+    {
+        writePoly2D(writer, "RCSSFPoly", defaultURI, r->rcsSFPoly);
+    }
+
+    if (!r->betaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "BetaZeroSFPoly", defaultURI, r->betaZeroSFPoly);
+    }
+
+    if (!r->sigmaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "SigmaZeroSFPoly", defaultURI,
+                    r->sigmaZeroSFPoly);
+    }
+
+    if (r->sigmaZeroSFIncidenceMap != six::AppliedType::NOT_SET)
+    {
+        writeString(
+            writer,
+            "SigmaZeroSFIncidenceMap",
+            defaultURI,
+            six::toString<six::AppliedType>(r->sigmaZeroSFIncidenceMap));
+    }
+
+    if (!r->gammaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "GammaZeroSFPoly", defaultURI,
+                    r->gammaZeroSFPoly);
+    }
+
+    if (r->gammaZeroSFIncidenceMap != six::AppliedType::NOT_SET)
+    {
+        writeString(
+            writer,
+            "GammaZeroSFIncidenceMap",
+            defaultURI,
+            six::toString<six::AppliedType>(r->gammaZeroSFIncidenceMap));
+    }
+    writer.endElement();
+}
+
 void SICommonXMLParser050::parseRadiometryFromXML(
     const XMLElem radiometricXML,
     six::Radiometric* radiometric) const
@@ -261,5 +325,50 @@ XMLElem ComplexXMLParser050::convertMatchInformationToXML(
     setAttribute(matchInfoXML, "size", str::toString(matchInfo->types.size()));
     return matchInfoXML;
 }
+
+void ComplexXMLParser050::writeWeightType(
+    XMLStreamWriter& writer,
+    const WeightType& obj) const
+{
+    writer.startElement("WgtType", getDefaultURI());
+    writeString(writer, "WindowName", obj.windowName);
+
+    common().writeParameters(writer, "Parameter", obj.parameters);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser050::writeImageFormationAlgo(
+    XMLStreamWriter& writer,
+    const PFA* pfa, const RMA* rma,
+    const RgAzComp* rgAzComp) const
+{
+    if (rgAzComp)
+    {
+        throw except::Exception(Ctxt(
+            "RGAZCOMP exists in SICD 0.5 but library does not support it"));
+    }
+    else if (pfa && !rma)
+    {
+        writePFA(writer, pfa);
+    }
+    else if (!pfa && rma)
+    {
+        writeRMA(writer, rma);
+    }
+    else if (pfa && rma)
+    {
+        throw except::Exception(Ctxt(
+            "Only one PFA or RMA can be defined in SICD 0.5"));
+    }
+}
+
+void ComplexXMLParser050::writeMatchInformation(
+    XMLStreamWriter& writer,
+    const MatchInformation* matchInfo) const
+{
+    writer.addAttributeToNext("size", str::toString(matchInfo->types.size()));
+    ComplexXMLParser04x::writeMatchInformation(writer, matchInfo);
+}
 }
 }
@@ -20,6 +20,7 @@
  *
  */
 
+#include <six/XMLStreamWriter.h>
 #include <six/sicd/ComplexXMLParser100.h>
 
 
@@ -75,5 +76,45 @@ XMLElem ComplexXMLParser100::convertGeoInfoToXML(
     return geoInfoXML;
 }
 
+void ComplexXMLParser100::writeGeoInfo(
+    XMLStreamWriter& writer,
+    const GeoInfo *geoInfo) const
+{
+    //! 1.0.0 has ordering (1. Desc, 2. GeoInfo, 3. choice)
+    writer.startElement("GeoInfo", getDefaultURI());
+    if (!geoInfo->name.empty())
+        writer.addAttribute("name", geoInfo->name);
+
+    common().writeParameters(writer, "Desc", geoInfo->desc);
+
+    for (size_t ii = 0; ii < geoInfo->geoInfos.size(); ++ii)
+    {
+        writeGeoInfo(writer, geoInfo->geoInfos[ii].get());
+    }
+
+    const size_t numLatLons = geoInfo->geometryLatLon.size();
+    if (numLatLons == 1)
+    {
+        common().writeLatLon(writer, "Point", geoInfo->geometryLatLon[0]);
+    }
+    else if (numLatLons >= 2)
+    {
+        writer.startElement(numLatLons == 2 ? "Line" : "Polygon",
+                            getDefaultURI());
+        writer.addAttribute("size", str::toString(numLatLons));
+
+        for (size_t ii = 0; ii < numLatLons; ++ii)
+        {
+            writer.addAttributeToNext("index", str::toString(ii + 1));
+            common().writeLatLon(writer,
+                                 numLatLons == 2 ? "Endpoint" : "Vertex",
+                                 geoInfo->geometryLatLon[ii]);
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 
 
@@ -22,6 +22,7 @@
 
 #include <six/Utilities.h>
 #include <six/SICommonXMLParser10x.h>
+#include <six/XMLStreamWriter.h>
 #include <six/sicd/ComplexXMLParser10x.h>
 
 namespace
@@ -360,6 +361,272 @@ XMLElem ComplexXMLParser10x::convertAntennaParamArrayToXML(
 }
 
 
+void ComplexXMLParser10x::writeWeightType(
+    XMLStreamWriter& writer,
+    const WeightType& obj) const
+{
+    writer.startElement("WgtType", getDefaultURI());
+    writeString(writer, "WindowName", obj.windowName);
+
+    common().writeParameters(writer, "Parameter", obj.parameters);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeRadarCollection(
+    XMLStreamWriter& writer,
+    const RadarCollection *radar) const
+{
+    writer.startElement("RadarCollection", getDefaultURI());
+
+    writeTxFrequency(writer, radar);
+
+    if (!Init::isUndefined(radar->refFrequencyIndex))
+    {
+        writeInt(writer, "RefFreqIndex", radar->refFrequencyIndex);
+    }
+
+    // SICD v1.0 removes PolarizationHVAnglePoly
+
+    writeWaveform(writer, radar);
+
+    //! required in 1.0
+    writeString(writer, "TxPolarization",
+                six::toString(radar->txPolarization));
+
+    writeTxSequence(writer, radar);
+    writeRcvChannels(writer, radar);
+    writeArea(writer, radar);
+
+    common().writeParameters(writer, "Parameter", radar->parameters);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeMatchInformation(
+    XMLStreamWriter& writer,
+    const MatchInformation* matchInfo) const
+{
+    writer.startElement("MatchInfo", getDefaultURI());
+
+    writeInt(writer, "NumMatchTypes",
+             static_cast<int>(matchInfo->types.size()));
+
+    for (size_t i = 0; i < matchInfo->types.size(); ++i)
+    {
+        const MatchType* mt = matchInfo->types[i].get();
+        writer.startElement("MatchType", getDefaultURI());
+        writer.addAttribute("index", str::toString(i + 1));
+
+        writeString(writer, "TypeID", mt->typeID);
+        writeInt(writer, "CurrentIndex", mt->currentIndex);
+        writeInt(writer, "NumMatchCollections",
+                 static_cast<int>(mt->matchCollects.size()));
+
+        for (size_t j = 0; j < mt->matchCollects.size(); ++j)
+        {
+            writer.startElement("MatchCollection", getDefaultURI());
+            writer.addAttribute("index", str::toString(j + 1));
+
+            writeString(writer, "CoreName", mt->matchCollects[j].coreName);
+            writeInt(writer, "MatchIndex", mt->matchCollects[j].matchIndex);
+            common().writeParameters(writer, "Parameter",
+                                     mt->matchCollects[j].parameters);
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeImageFormation(
+    XMLStreamWriter& writer,
+    const ImageFormation* imageFormation,
+    const RadarCollection& radarCollection) const
+{
+    writer.startElement("ImageFormation", getDefaultURI());
+
+    writeRcvChanProc(writer, "1.0",
+                     imageFormation->rcvChannelProcessed.get());
+
+    writeString(writer, "TxRcvPolarizationProc",
+                six::toString(imageFormation->txRcvPolarizationProc));
+
+    writeDouble(writer, "TStartProc", imageFormation->tStartProc);
+    writeDouble(writer, "TEndProc", imageFormation->tEndProc);
+
+    writer.startElement("TxFrequencyProc", getDefaultURI());
+    writeDouble(writer, "MinProc", imageFormation->txFrequencyProcMin);
+    writeDouble(writer, "MaxProc", imageFormation->txFrequencyProcMax);
+    writer.endElement();
+
+    if (radarCollection.area.get() != NULL &&
+        radarCollection.area->plane.get() != NULL &&
+        !radarCollection.area->plane->segmentList.empty() &&
+        imageFormation->segmentIdentifier.empty())
+    {
+        throw except::Exception(Ctxt(
+            "ImageFormation.SegmentIdentifier must be included when a "
+            "RadarCollection.Area.Plane.SegmentList is included."));
+    }
+
+    //! updated location in 1.0.0
+    if (!imageFormation->segmentIdentifier.empty())
+        writeString(writer, "SegmentIdentifier",
+                    imageFormation->segmentIdentifier);
+
+    writeString(writer, "ImageFormAlgo",
+                six::toString(imageFormation->imageFormationAlgorithm));
+
+    writeString(writer, "STBeamComp",
+                six::toString(imageFormation->slowTimeBeamCompensation));
+    writeString(writer, "ImageBeamComp",
+                six::toString(imageFormation->imageBeamCompensation));
+    writeString(writer, "AzAutofocus",
+                six::toString(imageFormation->azimuthAutofocus));
+    writeString(writer, "RgAutofocus",
+                six::toString(imageFormation->rangeAutofocus));
+
+    for (unsigned int i = 0; i < imageFormation->processing.size(); ++i)
+    {
+        const Processing* proc = &imageFormation->processing[i];
+
+        writer.startElement("Processing", getDefaultURI());
+
+        writeString(writer, "Type", proc->type);
+        require(writeBooleanType(writer, "Applied", proc->applied), "Applied");
+        common().writeParameters(writer, "Parameter", proc->parameters);
+        writer.endElement();
+    }
+
+    if (imageFormation->polarizationCalibration.get())
+    {
+        writer.startElement("PolarizationCalibration", getDefaultURI());
+
+        require(writeBooleanType(writer, "DistortCorrectionApplied",
+                                 imageFormation->polarizationCalibration->
+                                 distortionCorrectionApplied),
+                "DistortCorrectionApplied");
+
+        writeDistortion(writer, "1.0",
+            imageFormation->polarizationCalibration->distortion.get());
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeImageFormationAlgo(
+    XMLStreamWriter& writer,
+    const PFA* pfa, const RMA* rma,
+    const RgAzComp* rgAzComp) const
+{
+    if (pfa && !rma && !rgAzComp)
+    {
+        writePFA(writer, pfa);
+    }
+    else if (!pfa && rma && !rgAzComp)
+    {
+        writeRMA(writer, rma);
+    }
+    else if (!pfa && !rma && rgAzComp)
+    {
+        writeRgAzComp(writer, rgAzComp);
+    }
+    else if (pfa || rma || rgAzComp)
+    {
+        throw except::Exception(Ctxt(
+            "Only one PFA, RMA, or RgAzComp can be defined in SICD 1.0"));
+    }
+}
+
+void ComplexXMLParser10x::writeSCPCOA(
+    XMLStreamWriter& writer,
+    const SCPCOA* scpcoa) const
+{
+    writer.startElement("SCPCOA", getDefaultURI());
+    writeSCPCOAParameters(writer, scpcoa);
+
+    //! Added in 1.0.0
+    writeDouble(writer, "AzimAng", scpcoa->azimAngle);
+    writeDouble(writer, "LayoverAng", scpcoa->layoverAngle);
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeRMA(
+    XMLStreamWriter& writer,
+    const RMA* rma) const
+{
+    writer.startElement("RMA", getDefaultURI());
+
+    writeString(writer, "RMAlgoType",
+                six::toString<six::RMAlgoType>(rma->algoType));
+
+    if (rma->rmat.get() && !rma->rmcr.get() && !rma->inca.get())
+    {
+        writeRMAT(writer, rma->rmat.get());
+    }
+    else if (!rma->rmat.get() && rma->rmcr.get() && !rma->inca.get())
+    {
+        writeRMCR(writer, rma->rmcr.get());
+    }
+    else if (!rma->rmat.get() && !rma->rmcr.get() && rma->inca.get())
+    {
+        writeINCA(writer, rma->inca.get());
+    }
+    else
+    {
+        throw except::Exception(Ctxt(
+            "One of RMAT, RMCR or INCA must be defined in SICD 1.0."));
+    }
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeRMAT(
+    XMLStreamWriter& writer,
+    const RMAT* rmat) const
+{
+    writeString(writer, "ImageType", "RMAT");
+
+    writer.startElement("RMAT", getDefaultURI());
+
+    common().writeVector3D(writer, "PosRef", rmat->refPos);
+    common().writeVector3D(writer, "VelRef", rmat->refVel);
+    writeDouble(writer, "DopConeAngRef", rmat->dopConeAngleRef);
+
+    writer.endElement();
+}
+
+void ComplexXMLParser10x::writeHPBW(
+    XMLStreamWriter&,
+    const HalfPowerBeamwidths*) const
+{
+    //! this field was deprecated in 1.0.0
+}
+
+void ComplexXMLParser10x::writeAntennaParamArray(
+    XMLStreamWriter& writer,
+    const std::string& name,
+    const GainAndPhasePolys* array) const
+{
+    //! mandatory field in 1.0
+    if (array)
+    {
+        writer.startElement("Array", getDefaultURI());
+        common().writePoly2D(writer, "GainPoly", array->gainPoly);
+        common().writePoly2D(writer, "PhasePoly", array->phasePoly);
+        writer.endElement();
+    }
+    else
+    {
+        throw except::Exception(Ctxt(FmtX(
+            "[Array] is a mandatory field in AntennaParams of [%s] in 1.0",
+            name.c_str())));
+    }
+}
+
 void ComplexXMLParser10x::parseWeightTypeFromXML(
     const XMLElem gridRowColXML,
     mem::ScopedCopyablePtr<WeightType>& obj) const
@@ -544,6 +811,32 @@ XMLElem ComplexXMLParser10x::createRcvChannels(const RadarCollection* radar,
     return rcvChanXML;
 }
 
+void ComplexXMLParser10x::writeRcvChannels(XMLStreamWriter& writer,
+                                           const RadarCollection* radar) const
+{
+    const size_t numChannels = radar->rcvChannels.size();
+    writer.startElement("RcvChannels", getDefaultURI());
+    writer.addAttribute("size", str::toString(numChannels));
+    for (size_t ii = 0; ii < numChannels; ++ii)
+    {
+        const ChannelParameters* const cp = radar->rcvChannels[ii].get();
+        writer.startElement("ChanParameters", getDefaultURI());
+        writer.addAttribute("index", str::toString(ii + 1));
+
+        //! required in 1.0
+        writeString(writer, "TxRcvPolarization",
+                    six::toString<DualPolarizationType>(cp->txRcvPolarization));
+
+        if (!Init::isUndefined(cp->rcvAPCIndex))
+        {
+            writeInt(writer, "RcvAPCIndex", cp->rcvAPCIndex);
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 void ComplexXMLParser10x::parseRadarCollectionFromXML(
         const XMLElem radarCollectionXML,
         RadarCollection* radarCollection) const
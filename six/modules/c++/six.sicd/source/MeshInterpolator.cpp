@@ -0,0 +1,678 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SIX_SICD_MESH_SSE2
+#endif
+
+#include <except/Exception.h>
+#include <sys/OS.h>
+#include <sys/Runnable.h>
+#include <mt/ThreadPlanner.h>
+#include <tasks/TaskScheduler.h>
+#include <six/sicd/MeshInterpolator.h>
+
+namespace
+{
+// Below these, the cost of spinning up threads isn't worth it
+const size_t MIN_POINTS_PER_THREAD = 4096;
+const size_t MIN_SAMPLES_PER_THREAD = 16384;
+
+// A contiguous run of output columns that fall in the same mesh cell.  For
+// bilinear interpolation the column weight is affine across the run, so the
+// run can be filled without looking anything up per sample.
+struct ColumnRun
+{
+    size_t start;
+    size_t num;
+    size_t cell;
+    double t0;
+    double dt;
+};
+
+// out[k] = a + (t0 + k * dt) * b
+void fillRun(double a,
+             double b,
+             double t0,
+             double dt,
+             size_t num,
+             double* output)
+{
+    size_t kk = 0;
+#ifdef SIX_SICD_MESH_SSE2
+    const __m128d va = _mm_set1_pd(a);
+    const __m128d vb = _mm_set1_pd(b);
+    const __m128d vt0 = _mm_set1_pd(t0);
+    const __m128d vdt = _mm_set1_pd(dt);
+    const __m128d two = _mm_set1_pd(2.0);
+    __m128d vk = _mm_set_pd(1.0, 0.0);
+    for (; kk + 2 <= num; kk += 2)
+    {
+        const __m128d t = _mm_add_pd(vt0, _mm_mul_pd(vk, vdt));
+        _mm_storeu_pd(output + kk, _mm_add_pd(va, _mm_mul_pd(t, vb)));
+        vk = _mm_add_pd(vk, two);
+    }
+#endif
+    for (; kk < num; ++kk)
+    {
+        output[kk] = a + (t0 + kk * dt) * b;
+    }
+}
+
+// line[c] = sum of weight[ii] * field row index[ii], over the whole row
+void interpolateRows(const double* field,
+                     size_t numCols,
+                     const six::sicd::MeshInterpolator::Stencil& stencil,
+                     size_t width,
+                     double* line)
+{
+    const double* const row0 = field + stencil.index[0] * numCols;
+    const double w0 = stencil.weight[0];
+    for (size_t col = 0; col < numCols; ++col)
+    {
+        line[col] = w0 * row0[col];
+    }
+
+    for (size_t ii = 1; ii < width; ++ii)
+    {
+        const double* const row = field + stencil.index[ii] * numCols;
+        const double weight = stencil.weight[ii];
+        for (size_t col = 0; col < numCols; ++col)
+        {
+            line[col] += weight * row[col];
+        }
+    }
+}
+
+double evaluate(const double* field,
+                size_t numCols,
+                const six::sicd::MeshInterpolator::Stencil& rowStencil,
+                const six::sicd::MeshInterpolator::Stencil& colStencil,
+                size_t width)
+{
+    double value = 0.0;
+    for (size_t ii = 0; ii < width; ++ii)
+    {
+        const double* const row = field + rowStencil.index[ii] * numCols;
+        double rowValue = 0.0;
+        for (size_t jj = 0; jj < width; ++jj)
+        {
+            rowValue += colStencil.weight[jj] * row[colStencil.index[jj]];
+        }
+        value += rowStencil.weight[ii] * rowValue;
+    }
+    return value;
+}
+
+// Splits [0, numItems) across threads and runs a RunnableT on each piece.
+// RunnableT is constructed from (start, num, context).
+template <typename RunnableT, typename ContextT>
+void runInParallel(size_t numItems,
+                   size_t numThreads,
+                   size_t minItemsPerThread,
+                   const ContextT& context)
+{
+    numThreads = std::max<size_t>(
+            std::min(numThreads, numItems / minItemsPerThread), 1);
+
+    if (numThreads == 1)
+    {
+        RunnableT(0, numItems, context).run();
+        return;
+    }
+
+    tasks::TaskGroup threads;
+    const mt::ThreadPlanner planner(numItems, numThreads);
+
+    size_t threadNum(0);
+    size_t start(0);
+    size_t numThisThread(0);
+    while (planner.getThreadInfo(threadNum++, start, numThisThread))
+    {
+        std::auto_ptr<sys::Runnable> thread(
+                new RunnableT(start, numThisThread, context));
+        threads.createTask(thread);
+    }
+    threads.wait();
+}
+
+struct PlanContext
+{
+    const six::sicd::MeshInterpolator* interpolator;
+    const double* x;
+    const double* y;
+    six::sicd::MeshInterpolator::Stencil* rowStencils;
+    six::sicd::MeshInterpolator::Stencil* colStencils;
+};
+
+class PlanRunnable : public sys::Runnable
+{
+public:
+    PlanRunnable(size_t start, size_t num, const PlanContext& context) :
+        mStart(start),
+        mNum(num),
+        mContext(context)
+    {
+    }
+
+    virtual void run()
+    {
+        const six::sicd::MeshInterpolator& interpolator(
+                *mContext.interpolator);
+        const size_t end = mStart + mNum;
+        for (size_t ii = mStart; ii < end; ++ii)
+        {
+            interpolator.getStencils(mContext.x[ii],
+                                     mContext.y[ii],
+                                     mContext.rowStencils[ii],
+                                     mContext.colStencils[ii]);
+        }
+    }
+
+private:
+    const size_t mStart;
+    const size_t mNum;
+    const PlanContext mContext;
+};
+
+struct EvaluateContext
+{
+    const double* field;
+    size_t numCols;
+    size_t width;
+    const six::sicd::MeshInterpolator::Stencil* rowStencils;
+    const six::sicd::MeshInterpolator::Stencil* colStencils;
+    double* output;
+};
+
+class EvaluateRunnable : public sys::Runnable
+{
+public:
+    EvaluateRunnable(size_t start,
+                     size_t num,
+                     const EvaluateContext& context) :
+        mStart(start),
+        mNum(num),
+        mContext(context)
+    {
+    }
+
+    virtual void run()
+    {
+        const size_t end = mStart + mNum;
+        for (size_t ii = mStart; ii < end; ++ii)
+        {
+            mContext.output[ii] = evaluate(mContext.field,
+                                           mContext.numCols,
+                                           mContext.rowStencils[ii],
+                                           mContext.colStencils[ii],
+                                           mContext.width);
+        }
+    }
+
+private:
+    const size_t mStart;
+    const size_t mNum;
+    const EvaluateContext mContext;
+};
+
+struct FillContext
+{
+    const double* field;
+    size_t numMeshCols;
+    size_t width;
+    size_t numOutputCols;
+
+    // One per output row
+    const six::sicd::MeshInterpolator::Stencil* rowStencils;
+
+    // Bilinear uses the runs, bicubic the per-column stencils
+    const std::vector<ColumnRun>* runs;
+    const six::sicd::MeshInterpolator::Stencil* colStencils;
+
+    double* output;
+};
+
+class FillRunnable : public sys::Runnable
+{
+public:
+    FillRunnable(size_t startRow,
+                 size_t numRows,
+                 const FillContext& context) :
+        mStartRow(startRow),
+        mNumRows(numRows),
+        mContext(context)
+    {
+    }
+
+    virtual void run()
+    {
+        const FillContext& context(mContext);
+        std::vector<double> line(context.numMeshCols);
+
+        const size_t endRow = mStartRow + mNumRows;
+        for (size_t row = mStartRow; row < endRow; ++row)
+        {
+            interpolateRows(context.field,
+                            context.numMeshCols,
+                            context.rowStencils[row],
+                            context.width,
+                            &line[0]);
+
+            double* const output = context.output +
+                    row * context.numOutputCols;
+            if (context.runs)
+            {
+                const std::vector<ColumnRun>& runs(*context.runs);
+                for (size_t ii = 0; ii < runs.size(); ++ii)
+                {
+                    const ColumnRun& run(runs[ii]);
+                    const double a = line[run.cell];
+                    const double b = line[run.cell + 1] - a;
+                    fillRun(a, b, run.t0, run.dt, run.num,
+                            output + run.start);
+                }
+            }
+            else
+            {
+                for (size_t col = 0; col < context.numOutputCols; ++col)
+                {
+                    const six::sicd::MeshInterpolator::Stencil& stencil =
+                            context.colStencils[col];
+                    double value = 0.0;
+                    for (size_t jj = 0; jj < context.width; ++jj)
+                    {
+                        value += stencil.weight[jj] * line[stencil.index[jj]];
+                    }
+                    output[col] = value;
+                }
+            }
+        }
+    }
+
+private:
+    const size_t mStartRow;
+    const size_t mNumRows;
+    const FillContext mContext;
+};
+}
+
+namespace six
+{
+namespace sicd
+{
+RasterGrid::RasterGrid(const types::RowCol<double>& origin_,
+                       const types::RowCol<double>& spacing_,
+                       const types::RowCol<size_t>& dims_) :
+    origin(origin_),
+    spacing(spacing_),
+    dims(dims_)
+{
+}
+
+RasterGrid RasterGrid::fromPixels(const types::RowCol<size_t>& offset,
+                                  const types::RowCol<size_t>& dims,
+                                  const types::RowCol<double>& scpPixel,
+                                  const types::RowCol<double>& sampleSpacing)
+{
+    const types::RowCol<double> origin(
+            (static_cast<double>(offset.row) - scpPixel.row) *
+                    sampleSpacing.row,
+            (static_cast<double>(offset.col) - scpPixel.col) *
+                    sampleSpacing.col);
+    return RasterGrid(origin, sampleSpacing, dims);
+}
+
+void MeshInterpolator::Axis::initialize(const std::vector<double>& values)
+{
+    sign = (values[1] < values[0]) ? -1.0 : 1.0;
+    nodes.resize(values.size());
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        nodes[ii] = sign * values[ii];
+        if (ii > 0 && !(nodes[ii] > nodes[ii - 1]))
+        {
+            throw except::Exception(Ctxt(
+                    "Mesh coordinates must be strictly monotonic"));
+        }
+    }
+
+    // The cell guess from uniform spacing is always corrected afterwards,
+    // so this only needs to be close enough to usually be right
+    const double spacing = (nodes.back() - nodes.front()) / (nodes.size() - 1);
+    isUniform = true;
+    for (size_t ii = 1; ii < nodes.size(); ++ii)
+    {
+        if (std::abs(nodes[ii] - nodes[ii - 1] - spacing) > 1e-3 * spacing)
+        {
+            isUniform = false;
+            break;
+        }
+    }
+    invSpacing = 1.0 / spacing;
+}
+
+void MeshInterpolator::Axis::getStencil(double value,
+                                        Method method,
+                                        Stencil& stencil) const
+{
+    const double v = sign * value;
+    const size_t lastCell = nodes.size() - 2;
+
+    if (v != v)
+    {
+        std::fill_n(stencil.index, 4, 0);
+        std::fill_n(stencil.weight, 4,
+                    std::numeric_limits<double>::quiet_NaN());
+        return;
+    }
+
+    size_t cell;
+    if (isUniform)
+    {
+        const double guess = std::floor((v - nodes[0]) * invSpacing);
+        cell = (guess <= 0.0) ? 0 :
+                std::min(static_cast<size_t>(guess), lastCell);
+        while (cell > 0 && v < nodes[cell])
+        {
+            --cell;
+        }
+        while (cell < lastCell && v >= nodes[cell + 1])
+        {
+            ++cell;
+        }
+    }
+    else
+    {
+        const size_t upper = std::upper_bound(nodes.begin(), nodes.end(), v) -
+                nodes.begin();
+        cell = std::min(upper > 0 ? upper - 1 : 0, lastCell);
+    }
+
+    const double t = (v - nodes[cell]) / (nodes[cell + 1] - nodes[cell]);
+
+    if (method == BILINEAR)
+    {
+        stencil.index[0] = cell;
+        stencil.index[1] = cell + 1;
+        stencil.weight[0] = 1.0 - t;
+        stencil.weight[1] = t;
+        return;
+    }
+
+    stencil.index[0] = (cell > 0) ? cell - 1 : 0;
+    stencil.index[1] = cell;
+    stencil.index[2] = cell + 1;
+    stencil.index[3] = std::min(cell + 2, nodes.size() - 1);
+
+    if (t < 0.0 || t > 1.0)
+    {
+        // Extrapolating past the edge cell
+        stencil.weight[0] = 0.0;
+        stencil.weight[1] = 1.0 - t;
+        stencil.weight[2] = t;
+        stencil.weight[3] = 0.0;
+    }
+    else
+    {
+        // Catmull-Rom
+        const double t2 = t * t;
+        const double t3 = t2 * t;
+        stencil.weight[0] = -0.5 * t3 + t2 - 0.5 * t;
+        stencil.weight[1] = 1.5 * t3 - 2.5 * t2 + 1.0;
+        stencil.weight[2] = -1.5 * t3 + 2.0 * t2 + 0.5 * t;
+        stencil.weight[3] = 0.5 * t3 - 0.5 * t2;
+
+        // Past the ends, use linearly extrapolated ghost nodes rather than
+        // repeating the edge node so linear fields are reproduced exactly
+        if (cell == 0)
+        {
+            stencil.weight[1] += 2.0 * stencil.weight[0];
+            stencil.weight[2] -= stencil.weight[0];
+            stencil.weight[0] = 0.0;
+        }
+        if (cell == lastCell)
+        {
+            stencil.weight[1] -= stencil.weight[3];
+            stencil.weight[2] += 2.0 * stencil.weight[3];
+            stencil.weight[3] = 0.0;
+        }
+    }
+}
+
+MeshInterpolator::MeshInterpolator(const PlanarCoordinateMesh& mesh,
+                                   Method method,
+                                   size_t numThreads) :
+    mMethod(method),
+    mNumThreads(numThreads == 0 ? sys::OS().getNumCPUs() : numThreads),
+    mMeshDims(mesh.getMeshDims())
+{
+    const std::vector<double>& x = mesh.getX();
+    const std::vector<double>& y = mesh.getY();
+    const size_t numNodes = mMeshDims.row * mMeshDims.col;
+
+    if (mMeshDims.row < 2 || mMeshDims.col < 2)
+    {
+        throw except::Exception(Ctxt(
+                "Mesh must have at least two nodes in each dimension"));
+    }
+    if (x.size() != numNodes || y.size() != numNodes)
+    {
+        throw except::Exception(Ctxt(
+                "Mesh coordinates do not match the mesh dimensions"));
+    }
+
+    // x may only vary from row to row, and y from column to column
+    std::vector<double> rowNodes(mMeshDims.row);
+    for (size_t row = 0; row < mMeshDims.row; ++row)
+    {
+        rowNodes[row] = x[row * mMeshDims.col];
+    }
+    std::vector<double> colNodes(y.begin(), y.begin() + mMeshDims.col);
+
+    const double rowTolerance = 1e-6 *
+            std::abs(rowNodes.back() - rowNodes.front()) / mMeshDims.row;
+    const double colTolerance = 1e-6 *
+            std::abs(colNodes.back() - colNodes.front()) / mMeshDims.col;
+    for (size_t row = 0, idx = 0; row < mMeshDims.row; ++row)
+    {
+        for (size_t col = 0; col < mMeshDims.col; ++col, ++idx)
+        {
+            if (std::abs(x[idx] - rowNodes[row]) > rowTolerance ||
+                std::abs(y[idx] - colNodes[col]) > colTolerance)
+            {
+                std::ostringstream ostr;
+                ostr << "Mesh " << mesh.getName() << " is not rectilinear at "
+                     << "node (" << row << ", " << col << ")";
+                throw except::Exception(Ctxt(ostr.str()));
+            }
+        }
+    }
+
+    mRowAxis.initialize(rowNodes);
+    mColAxis.initialize(colNodes);
+}
+
+void MeshInterpolator::checkField(const std::vector<double>& field) const
+{
+    if (field.size() != mMeshDims.row * mMeshDims.col)
+    {
+        std::ostringstream ostr;
+        ostr << "Field has " << field.size() << " values but the mesh has "
+             << mMeshDims.row * mMeshDims.col << " nodes";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+}
+
+void MeshInterpolator::getStencils(double x,
+                                   double y,
+                                   Stencil& rowStencil,
+                                   Stencil& colStencil) const
+{
+    mRowAxis.getStencil(x, mMethod, rowStencil);
+    mColAxis.getStencil(y, mMethod, colStencil);
+}
+
+double MeshInterpolator::interpolate(const std::vector<double>& field,
+                                     double x,
+                                     double y) const
+{
+    checkField(field);
+
+    Stencil rowStencil;
+    Stencil colStencil;
+    getStencils(x, y, rowStencil, colStencil);
+    return evaluate(&field[0], mMeshDims.col, rowStencil, colStencil,
+                    getStencilWidth());
+}
+
+void MeshInterpolator::plan(const double* x,
+                            const double* y,
+                            size_t numPoints,
+                            QueryPlan& plan) const
+{
+    plan.mWidth = getStencilWidth();
+    plan.mRowStencils.resize(numPoints);
+    plan.mColStencils.resize(numPoints);
+    if (numPoints == 0)
+    {
+        return;
+    }
+
+    PlanContext context;
+    context.interpolator = this;
+    context.x = x;
+    context.y = y;
+    context.rowStencils = &plan.mRowStencils[0];
+    context.colStencils = &plan.mColStencils[0];
+    runInParallel<PlanRunnable>(numPoints, mNumThreads,
+                                MIN_POINTS_PER_THREAD, context);
+}
+
+void MeshInterpolator::interpolate(const QueryPlan& plan,
+                                   const std::vector<double>& field,
+                                   double* output) const
+{
+    checkField(field);
+    if (plan.mWidth != getStencilWidth())
+    {
+        throw except::Exception(Ctxt(
+                "Query plan was not made by this interpolator"));
+    }
+    if (plan.size() == 0)
+    {
+        return;
+    }
+
+    EvaluateContext context;
+    context.field = &field[0];
+    context.numCols = mMeshDims.col;
+    context.width = plan.mWidth;
+    context.rowStencils = &plan.mRowStencils[0];
+    context.colStencils = &plan.mColStencils[0];
+    context.output = output;
+    runInParallel<EvaluateRunnable>(plan.size(), mNumThreads,
+                                    MIN_POINTS_PER_THREAD, context);
+}
+
+void MeshInterpolator::interpolate(const std::vector<double>& field,
+                                   const double* x,
+                                   const double* y,
+                                   size_t numPoints,
+                                   double* output) const
+{
+    checkField(field);
+
+    QueryPlan queryPlan;
+    plan(x, y, numPoints, queryPlan);
+    interpolate(queryPlan, field, output);
+}
+
+void MeshInterpolator::fill(const std::vector<double>& field,
+                            const RasterGrid& grid,
+                            double* output) const
+{
+    checkField(field);
+    if (grid.dims.row == 0 || grid.dims.col == 0)
+    {
+        return;
+    }
+
+    std::vector<Stencil> rowStencils(grid.dims.row);
+    for (size_t row = 0; row < grid.dims.row; ++row)
+    {
+        mRowAxis.getStencil(grid.origin.row + row * grid.spacing.row,
+                            mMethod, rowStencils[row]);
+    }
+
+    std::vector<Stencil> colStencils(grid.dims.col);
+    for (size_t col = 0; col < grid.dims.col; ++col)
+    {
+        mColAxis.getStencil(grid.origin.col + col * grid.spacing.col,
+                            mMethod, colStencils[col]);
+    }
+
+    // Group columns that share a cell.  The weight is affine in the column
+    // within a cell, including the extrapolated edge cells.
+    std::vector<ColumnRun> runs;
+    if (mMethod == BILINEAR)
+    {
+        for (size_t col = 0; col < grid.dims.col; ++col)
+        {
+            const Stencil& stencil(colStencils[col]);
+            if (runs.empty() || runs.back().cell != stencil.index[0])
+            {
+                const size_t cell = stencil.index[0];
+                ColumnRun run;
+                run.start = col;
+                run.num = 0;
+                run.cell = cell;
+                run.t0 = stencil.weight[1];
+                run.dt = mColAxis.sign * grid.spacing.col /
+                        (mColAxis.nodes[cell + 1] - mColAxis.nodes[cell]);
+                runs.push_back(run);
+            }
+            ++runs.back().num;
+        }
+    }
+
+    FillContext context;
+    context.field = &field[0];
+    context.numMeshCols = mMeshDims.col;
+    context.width = getStencilWidth();
+    context.numOutputCols = grid.dims.col;
+    context.rowStencils = &rowStencils[0];
+    context.runs = runs.empty() ? NULL : &runs;
+    context.colStencils = &colStencils[0];
+    context.output = output;
+    runInParallel<FillRunnable>(grid.dims.row, mNumThreads,
+                                std::max<size_t>(MIN_SAMPLES_PER_THREAD /
+                                                 grid.dims.col, 1),
+                                context);
+}
+}
+}
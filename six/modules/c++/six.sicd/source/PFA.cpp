@@ -109,7 +109,7 @@ void PFA::fillDefaultFields(const GeoData& geoData,
     //for when the other functions get implemented
 }
 
-bool PFA::validate(const SCPCOA& scpcoa, logging::Logger& log)
+bool PFA::validate(const SCPCOA& scpcoa, logging::Logger& log) const
 {
     bool valid = true;
     std::ostringstream messageBuilder;
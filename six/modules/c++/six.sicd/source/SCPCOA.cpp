@@ -205,7 +205,7 @@ std::vector<Vector3> SCPCOA::derivedArpVectors(const Position& position) const
 bool SCPCOA::validate(const GeoData& geoData,
         const Grid& grid,
         const Position& position,
-        logging::Logger& log)
+        logging::Logger& log) const
 {
     std::ostringstream messageBuilder;
     bool valid = true;
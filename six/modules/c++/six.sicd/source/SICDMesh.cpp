@@ -67,12 +67,23 @@ std::vector<Mesh::Field> PlanarCoordinateMesh::getFields() const
 
 void PlanarCoordinateMesh::serialize(std::vector<sys::byte>& values) const
 {
+    // Virtual, so this makes room for everything a derived mesh appends too
+    reserveSerializeBuffer(values, getSerializedSize());
+
     six::serialize(mMeshDims.row, mSwapBytes, values);
     six::serialize(mMeshDims.col, mSwapBytes, values);
     six::serialize(mX, mSwapBytes, values);
     six::serialize(mY, mSwapBytes, values);
 }
 
+size_t PlanarCoordinateMesh::getSerializedSize() const
+{
+    return six::getSerializedSize(mMeshDims.row) +
+            six::getSerializedSize(mMeshDims.col) +
+            six::getSerializedSize(mX) +
+            six::getSerializedSize(mY);
+}
+
 void PlanarCoordinateMesh::deserialize(const sys::byte*& values)
 {
     six::deserialize(values, mSwapBytes, mMeshDims.row);
@@ -129,6 +140,14 @@ void NoiseMesh::serialize(std::vector<sys::byte>& values) const
     six::serialize(mCombinedNoise, mSwapBytes, values);
 }
 
+size_t NoiseMesh::getSerializedSize() const
+{
+    return PlanarCoordinateMesh::getSerializedSize() +
+            six::getSerializedSize(mMainBeamNoise) +
+            six::getSerializedSize(mAzimuthAmbiguityNoise) +
+            six::getSerializedSize(mCombinedNoise);
+}
+
 void NoiseMesh::deserialize(const sys::byte*& values)
 {
     PlanarCoordinateMesh::deserialize(values);
@@ -137,5 +156,25 @@ void NoiseMesh::deserialize(const sys::byte*& values)
     six::deserialize(values, mSwapBytes, mAzimuthAmbiguityNoise);
     six::deserialize(values, mSwapBytes, mCombinedNoise);
 }
+
+void PlanarCoordinateMeshView::deserialize(const sys::byte*& values)
+{
+    // Meshes are always serialized big endian
+    const bool swapBytes = !sys::isBigEndianSystem();
+    six::deserialize(values, swapBytes, meshDims.row);
+    six::deserialize(values, swapBytes, meshDims.col);
+    six::deserializeView(values, swapBytes, x);
+    six::deserializeView(values, swapBytes, y);
+}
+
+void NoiseMeshView::deserialize(const sys::byte*& values)
+{
+    PlanarCoordinateMeshView::deserialize(values);
+
+    const bool swapBytes = !sys::isBigEndianSystem();
+    six::deserializeView(values, swapBytes, mainBeamNoise);
+    six::deserializeView(values, swapBytes, azimuthAmbiguityNoise);
+    six::deserializeView(values, swapBytes, combinedNoise);
+}
 }
 }
@@ -338,6 +338,43 @@ Utilities::getPolynomialFitter(const ComplexData& complexData,
                 numPoints1D));
 }
 
+std::auto_ptr<scene::RPCFitter>
+Utilities::getRPCFitter(const ComplexData& complexData,
+                        double heightRange,
+                        size_t numPoints1D,
+                        size_t numHeights)
+{
+    const std::auto_ptr<scene::SceneGeometry> geometry(
+            getSceneGeometry(&complexData));
+    const std::auto_ptr<scene::ProjectionModel> projectionModel(
+            getProjectionModel(&complexData, geometry.get()));
+
+    const ImageData& imageData(*complexData.imageData);
+    const types::RowCol<double> sceneCenter(
+            static_cast<double>(imageData.scpPixel.row) -
+                    static_cast<double>(imageData.firstRow),
+            static_cast<double>(imageData.scpPixel.col) -
+                    static_cast<double>(imageData.firstCol));
+    const types::RowCol<double> sampleSpacing(
+            complexData.grid->row->sampleSpacing,
+            complexData.grid->col->sampleSpacing);
+    const types::RowCol<size_t> extent(complexData.getNumRows(),
+                                       complexData.getNumCols());
+
+    const double scpHeight = scene::Utilities::ecefToLatLon(
+            complexData.geoData->scp.ecf).getAlt();
+
+    return std::auto_ptr<scene::RPCFitter>(new scene::RPCFitter(
+            *projectionModel,
+            sceneCenter,
+            sampleSpacing,
+            extent,
+            scpHeight - heightRange / 2,
+            scpHeight + heightRange / 2,
+            numPoints1D,
+            numHeights));
+}
+
 void Utilities::getValidDataPolygon(
         const ComplexData& sicdData,
         const scene::ProjectionModel& projection,
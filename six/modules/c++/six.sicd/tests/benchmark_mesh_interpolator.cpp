@@ -0,0 +1,157 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times evaluating a noise mesh over an image: one point at a time, as a
+// batch of points, and as a dense raster fill.
+// Usage: benchmark_mesh_interpolator [image size] [mesh size] [threads]
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <import/six/sicd.h>
+
+namespace
+{
+void printResult(const std::string& name, size_t numSamples, double elapsedMS)
+{
+    std::cout << std::left << std::setw(36) << name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(10)
+              << numSamples / (elapsedMS * 1000) << " Msamples/s\n";
+}
+
+const char* getMethodName(six::sicd::MeshInterpolator::Method method)
+{
+    return (method == six::sicd::MeshInterpolator::BILINEAR) ? "bilinear" :
+                                                                "bicubic";
+}
+
+void benchmark(const six::sicd::NoiseMesh& mesh,
+               six::sicd::MeshInterpolator::Method method,
+               const six::sicd::RasterGrid& grid,
+               size_t numThreads)
+{
+    const six::sicd::MeshInterpolator interpolator(mesh, method, numThreads);
+    const std::vector<double>& field = mesh.getCombinedNoise();
+    const size_t numSamples = grid.dims.row * grid.dims.col;
+    const std::string methodName(getMethodName(method));
+
+    std::vector<double> x(numSamples);
+    std::vector<double> y(numSamples);
+    for (size_t row = 0, idx = 0; row < grid.dims.row; ++row)
+    {
+        for (size_t col = 0; col < grid.dims.col; ++col, ++idx)
+        {
+            x[idx] = grid.origin.row + row * grid.spacing.row;
+            y[idx] = grid.origin.col + col * grid.spacing.col;
+        }
+    }
+    std::vector<double> output(numSamples);
+
+    sys::RealTimeStopWatch pointWatch;
+    pointWatch.start();
+    for (size_t ii = 0; ii < numSamples; ++ii)
+    {
+        output[ii] = interpolator.interpolate(field, x[ii], y[ii]);
+    }
+    printResult(methodName + " one at a time", numSamples, pointWatch.stop());
+
+    sys::RealTimeStopWatch planWatch;
+    planWatch.start();
+    six::sicd::MeshInterpolator::QueryPlan plan;
+    interpolator.plan(&x[0], &y[0], numSamples, plan);
+    printResult(methodName + " plan", numSamples, planWatch.stop());
+
+    sys::RealTimeStopWatch evaluateWatch;
+    evaluateWatch.start();
+    interpolator.interpolate(plan, field, &output[0]);
+    printResult(methodName + " evaluate plan", numSamples,
+                evaluateWatch.stop());
+
+    sys::RealTimeStopWatch fillWatch;
+    fillWatch.start();
+    interpolator.fill(field, grid, &output[0]);
+    printResult(methodName + " fill", numSamples, fillWatch.stop());
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t imageSize = (argc > 1) ? ::atoi(argv[1]) : 1024;
+        const size_t meshSize = (argc > 2) ? ::atoi(argv[2]) : 20;
+        const size_t numThreads = (argc > 3) ? ::atoi(argv[3]) : 0;
+
+        // A mesh covering the image, with 1 meter pixels centered on the SCP
+        const double extent = static_cast<double>(imageSize);
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> noise;
+        for (size_t row = 0; row < meshSize; ++row)
+        {
+            for (size_t col = 0; col < meshSize; ++col)
+            {
+                x.push_back(extent * (row / (meshSize - 1.0) - 0.5));
+                y.push_back(extent * (col / (meshSize - 1.0) - 0.5));
+                noise.push_back(1e-3 * (1.0 + row * col));
+            }
+        }
+        const six::sicd::NoiseMesh mesh(
+                "Noise", types::RowCol<size_t>(meshSize, meshSize),
+                x, y, noise, noise, noise);
+
+        const six::sicd::RasterGrid grid = six::sicd::RasterGrid::fromPixels(
+                types::RowCol<size_t>(0, 0),
+                types::RowCol<size_t>(imageSize, imageSize),
+                types::RowCol<double>(extent / 2, extent / 2),
+                types::RowCol<double>(1.0, 1.0));
+
+        std::cout << imageSize << " x " << imageSize << " image, "
+                  << meshSize << " x " << meshSize << " mesh\n\n";
+
+        benchmark(mesh, six::sicd::MeshInterpolator::BILINEAR, grid, 1);
+        benchmark(mesh, six::sicd::MeshInterpolator::BICUBIC, grid, 1);
+        if (numThreads != 1)
+        {
+            std::cout << "\nMultithreaded\n";
+            benchmark(mesh, six::sicd::MeshInterpolator::BILINEAR, grid,
+                      numThreads);
+            benchmark(mesh, six::sicd::MeshInterpolator::BICUBIC, grid,
+                      numThreads);
+        }
+
+        return 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
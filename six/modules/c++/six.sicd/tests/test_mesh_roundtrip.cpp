@@ -274,6 +274,30 @@ bool roundTripNoiseMesh(const types::RowCol<size_t>& meshDims,
     const sys::byte* serializedValuesBuffer = &serializedValues[0];
     deserializedNoiseMesh.deserialize(serializedValuesBuffer);
 
+    if (serializedNoiseMesh.getSerializedSize() != serializedValues.size())
+    {
+        std::cerr << "Noise mesh serialized size is "
+                  << serializedValues.size() << " bytes, expected "
+                  << serializedNoiseMesh.getSerializedSize() << std::endl;
+        return false;
+    }
+
+    // View the serialized mesh without copying it
+    six::sicd::NoiseMeshView view;
+    serializedValuesBuffer = &serializedValues[0];
+    view.deserialize(serializedValuesBuffer);
+    if (view.meshDims.row != meshDims.row ||
+        view.meshDims.col != meshDims.col ||
+        view.x.toVector() != x ||
+        view.y.toVector() != y ||
+        view.mainBeamNoise.toVector() != mainBeamNoise ||
+        view.azimuthAmbiguityNoise.toVector() != azimuthAmbiguityNoise ||
+        view.combinedNoise.toVector() != combinedNoise)
+    {
+        std::cerr << "Noise mesh view does not match" << std::endl;
+        return false;
+    }
+
     // Compare meshes.
     return compareNoiseMesh(&serializedNoiseMesh,
                             &deserializedNoiseMesh,
@@ -0,0 +1,374 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Test program for ParallelNITFFileSink
+// Writes SICDs from several threads in arbitrary row-band order and checks
+// that the result matches a normal write via NITFWriteControl.  With
+// --benchmark, times NITFWriteControl::save() against the sink for 1..N
+// threads.
+
+#include <iostream>
+#include <iomanip>
+
+#include "TestUtilities.h"
+
+#include <cli/ArgumentParser.h>
+#include <mt/ThreadGroup.h>
+#include <mt/ThreadPlanner.h>
+#include <sys/StopWatch.h>
+#include <six/NITFWriteControl.h>
+#include <six/ParallelNITFFileSink.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sicd/SICDByteProvider.h>
+
+namespace
+{
+// Writes every 'numThreads'th band of 'numRowsPerBand' rows, starting with
+// band 'threadNum', from the bottom of the image up
+class WriteBandsRunnable : public sys::Runnable
+{
+public:
+    WriteBandsRunnable(six::ParallelNITFFileSink& sink,
+                       const std::complex<float>* image,
+                       const types::RowCol<size_t>& dims,
+                       size_t numRowsPerBand,
+                       size_t threadNum,
+                       size_t numThreads) :
+        mSink(sink),
+        mImage(image),
+        mDims(dims),
+        mNumRowsPerBand(numRowsPerBand),
+        mThreadNum(threadNum),
+        mNumThreads(numThreads)
+    {
+    }
+
+    virtual void run()
+    {
+        const size_t numBands =
+                (mDims.row + mNumRowsPerBand - 1) / mNumRowsPerBand;
+        for (size_t band = mThreadNum; band < numBands; band += mNumThreads)
+        {
+            const size_t startRow = (numBands - 1 - band) * mNumRowsPerBand;
+            const size_t numRows =
+                    std::min(mNumRowsPerBand, mDims.row - startRow);
+            mSink.writeNativeEndian(&mImage[startRow * mDims.col],
+                                    startRow,
+                                    numRows);
+        }
+    }
+
+private:
+    six::ParallelNITFFileSink& mSink;
+    const std::complex<float>* const mImage;
+    const types::RowCol<size_t> mDims;
+    const size_t mNumRowsPerBand;
+    const size_t mThreadNum;
+    const size_t mNumThreads;
+};
+
+void sinkWrite(const six::sicd::ComplexData& data,
+               const std::vector<std::complex<float> >& image,
+               size_t maxProductSize,
+               size_t numRowsPerBand,
+               size_t numThreads,
+               const std::string& pathname)
+{
+    const std::vector<std::string> schemaPaths;
+    const six::sicd::SICDByteProvider provider(data, schemaPaths,
+                                               maxProductSize);
+    six::ParallelNITFFileSink sink(provider, pathname);
+
+    const types::RowCol<size_t> dims(data.getNumRows(), data.getNumCols());
+    mt::ThreadGroup threads;
+    for (size_t ii = 0; ii < numThreads; ++ii)
+    {
+        std::auto_ptr<sys::Runnable> runnable(new WriteBandsRunnable(
+                sink, &image[0], dims, numRowsPerBand, ii, numThreads));
+        threads.createThread(runnable);
+    }
+    threads.joinAll();
+
+    sink.finalize();
+}
+
+void normalWrite(const six::sicd::ComplexData& data,
+                 std::vector<std::complex<float> >& image,
+                 size_t maxProductSize,
+                 const std::string& pathname)
+{
+    mem::SharedPtr<six::Container> container(
+            new six::Container(six::DataType::COMPLEX));
+    container->addData(data.clone());
+
+    six::XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator(six::DataType::COMPLEX,
+                           new six::XMLControlCreatorT<
+                                   six::sicd::ComplexXMLControl>());
+
+    six::Options options;
+    if (maxProductSize != 0)
+    {
+        options.setParameter(six::NITFHeaderCreator::OPT_MAX_PRODUCT_SIZE,
+                             maxProductSize);
+    }
+    six::NITFWriteControl writer(options, container, &xmlRegistry);
+
+    six::BufferList buffers;
+    buffers.push_back(reinterpret_cast<six::UByte*>(&image[0]));
+    writer.save(buffers, pathname, std::vector<std::string>());
+}
+
+std::vector<std::complex<float> >
+createImage(const types::RowCol<size_t>& dims)
+{
+    std::vector<std::complex<float> > image(dims.area());
+    for (size_t ii = 0; ii < image.size(); ++ii)
+    {
+        image[ii] = std::complex<float>(static_cast<float>(ii),
+                                        static_cast<float>(ii * 10));
+    }
+    return image;
+}
+
+bool runTests()
+{
+    const types::RowCol<size_t> dims(123, 456);
+    const std::auto_ptr<six::sicd::ComplexData> data(createData<float>(dims));
+    std::vector<std::complex<float> > image(createImage(dims));
+
+    bool success = true;
+    const size_t numRowsPerSeg[] = {0, 30, 7, 1};
+    const size_t numRowsPerBand[] = {123, 10, 3, 1};
+    for (size_t ii = 0; ii < sizeof(numRowsPerSeg) / sizeof(size_t); ++ii)
+    {
+        const size_t maxProductSize = (numRowsPerSeg[ii] == 0) ? 0 :
+                numRowsPerSeg[ii] * dims.col * sizeof(std::complex<float>) +
+                2 * 1024;
+
+        const std::string normalPathname("normal_write.nitf");
+        const EnsureFileCleanup normalCleanup(normalPathname);
+        normalWrite(*data, image, maxProductSize, normalPathname);
+        const CompareFiles compareFiles(normalPathname);
+
+        for (size_t jj = 0; jj < sizeof(numRowsPerBand) / sizeof(size_t); ++jj)
+        {
+            for (size_t numThreads = 1; numThreads <= 4; numThreads *= 2)
+            {
+                const std::string pathname("sink_write.nitf");
+                const EnsureFileCleanup cleanup(pathname);
+                sinkWrite(*data, image, maxProductSize, numRowsPerBand[jj],
+                          numThreads, pathname);
+
+                std::ostringstream prefix;
+                prefix << "Sink write (max product size " << maxProductSize
+                       << ", " << numRowsPerBand[jj] << " rows/band, "
+                       << numThreads << " threads)";
+                if (!compareFiles(prefix.str(), pathname))
+                {
+                    success = false;
+                }
+            }
+        }
+    }
+
+    // An incomplete file must not be renamed into place
+    {
+        const std::string pathname("sink_incomplete.nitf");
+        const EnsureFileCleanup cleanup(pathname);
+        const six::sicd::SICDByteProvider provider(
+                *data, std::vector<std::string>());
+        six::ParallelNITFFileSink sink(provider, pathname);
+        sink.writeNativeEndian(&image[0], 0, 10);
+
+        bool threw = false;
+        try
+        {
+            sink.finalize();
+        }
+        catch (const except::Exception& )
+        {
+            threw = true;
+        }
+
+        if (!threw || sys::OS().exists(pathname))
+        {
+            std::cerr << "Incomplete write was finalized\n";
+            success = false;
+        }
+    }
+
+    // Rewriting rows must fail rather than quietly count the bytes twice
+    {
+        const std::string pathname("sink_overlap.nitf");
+        const EnsureFileCleanup cleanup(pathname);
+        const six::sicd::SICDByteProvider provider(
+                *data, std::vector<std::string>());
+        six::ParallelNITFFileSink sink(provider, pathname);
+        sink.writeNativeEndian(&image[0], 0, 10);
+
+        const size_t startRows[] = {0, 5};
+        for (size_t ii = 0; ii < sizeof(startRows) / sizeof(size_t); ++ii)
+        {
+            bool threw = false;
+            try
+            {
+                sink.writeNativeEndian(&image[startRows[ii] * dims.col],
+                                       startRows[ii], 10);
+            }
+            catch (const except::Exception& )
+            {
+                threw = true;
+            }
+
+            if (!threw)
+            {
+                std::cerr << "Overlapping write at row " << startRows[ii]
+                          << " was allowed\n";
+                success = false;
+            }
+        }
+
+        // The rest of the image still goes in
+        sink.writeNativeEndian(&image[10 * dims.col], 10, dims.row - 10);
+        sink.finalize();
+        if (!sys::OS().exists(pathname))
+        {
+            std::cerr << "Write after a rejected overlap wasn't finalized\n";
+            success = false;
+        }
+    }
+
+    // Two sinks for the same pathname must not share a temporary file
+    {
+        const std::string pathname("sink_shared.nitf");
+        const EnsureFileCleanup cleanup(pathname);
+        const six::sicd::SICDByteProvider provider(
+                *data, std::vector<std::string>());
+        six::ParallelNITFFileSink sink1(provider, pathname);
+        six::ParallelNITFFileSink sink2(provider, pathname);
+        if (sink1.getTempPathname() == sink2.getTempPathname())
+        {
+            std::cerr << "Sinks share the temporary file "
+                      << sink1.getTempPathname() << "\n";
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+void runBenchmark(const types::RowCol<size_t>& dims,
+                  size_t maxThreads,
+                  size_t numRowsPerBand)
+{
+    const std::auto_ptr<six::sicd::ComplexData> data(createData<float>(dims));
+    std::vector<std::complex<float> > image(createImage(dims));
+    const double numMB = static_cast<double>(
+            dims.area() * sizeof(std::complex<float>)) / (1024 * 1024);
+
+    const std::string pathname("benchmark_write.nitf");
+    const EnsureFileCleanup cleanup(pathname);
+
+    sys::RealTimeStopWatch stopWatch;
+    stopWatch.start();
+    normalWrite(*data, image, 0, pathname);
+    const double normalMS = stopWatch.stop();
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "NITFWriteControl::save: " << normalMS << " ms ("
+              << numMB / (normalMS / 1000) << " MB/s)\n";
+
+    for (size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        sys::RealTimeStopWatch sinkWatch;
+        sinkWatch.start();
+        sinkWrite(*data, image, 0, numRowsPerBand, numThreads, pathname);
+        const double sinkMS = sinkWatch.stop();
+
+        std::cout << "ParallelNITFFileSink, " << numThreads << " thread(s): "
+                  << sinkMS << " ms (" << numMB / (sinkMS / 1000)
+                  << " MB/s)\n";
+    }
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        cli::ArgumentParser parser;
+        parser.setDescription(
+                "Test ParallelNITFFileSink, or benchmark it against "
+                "NITFWriteControl::save()");
+        parser.addArgument("--benchmark", "Run the benchmark", cli::STORE_TRUE,
+                           "benchmark");
+        parser.addArgument("--rows", "Rows in the benchmark image",
+                           cli::STORE, "rows", "NUM")->setDefault(8192);
+        parser.addArgument("--cols", "Cols in the benchmark image",
+                           cli::STORE, "cols", "NUM")->setDefault(8192);
+        parser.addArgument("--band", "Rows per band in the benchmark",
+                           cli::STORE, "band", "NUM")->setDefault(256);
+        parser.addArgument("-t --threads", "Max threads in the benchmark",
+                           cli::STORE, "threads", "NUM")->setDefault(
+                                   sys::OS().getNumCPUs());
+        const std::auto_ptr<cli::Results> options(parser.parse(argc, argv));
+
+        if (options->get<bool>("benchmark"))
+        {
+            runBenchmark(types::RowCol<size_t>(options->get<size_t>("rows"),
+                                               options->get<size_t>("cols")),
+                         options->get<size_t>("threads"),
+                         options->get<size_t>("band"));
+            return 0;
+        }
+
+        const bool success = runTests();
+        if (success)
+        {
+            std::cout << "All tests pass!\n";
+        }
+        else
+        {
+            std::cerr << "Some tests FAIL!\n";
+        }
+
+        return (success ? 0 : 1);
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Caught std::exception: " << ex.what() << std::endl;
+        return 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught except::Exception: " << ex.getMessage()
+                  << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
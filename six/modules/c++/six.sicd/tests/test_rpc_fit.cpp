@@ -0,0 +1,157 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Fits an RPC to a SICD, reports the fit residuals, and checks the RPC
+// against the rigorous model at points that weren't used in the fit
+// Usage: test_rpc_fit <SICD pathname> [--height-range <meters>]
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <sys/Path.h>
+#include <six/Utilities.h>
+#include <six/sicd/Utilities.h>
+#include <six/sicd/ComplexData.h>
+#include <import/cli.h>
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        // Set up command line arguments.
+        cli::ArgumentParser parser;
+        parser.addArgument("--height-range", "Range of heights to fit over",
+            cli::STORE, "heightRange", "meters")->setDefault(1000.0);
+        parser.addArgument("input", "SICD path", cli::STORE, "sicdPath",
+            "sicdPath")->setDefault("");
+
+        // Parse the command line.
+        std::auto_ptr<cli::Results> options(parser.parse(argc, argv));
+        const std::string sicdPath = options->get<std::string>("sicdPath");
+        const double heightRange = options->get<double>("heightRange");
+
+        const std::string progname(argv[0]);
+        if (sicdPath.empty())
+        {
+            std::cerr << "Usage: " << sys::Path::basename(progname)
+                      << " <SICD pathname> [--height-range <meters>]\n\n";
+            return 1;
+        }
+
+        std::vector<std::string> schemaPaths;
+        std::auto_ptr<six::sicd::ComplexData> complexData(
+            six::sicd::Utilities::getComplexData(sicdPath, schemaPaths));
+
+        const std::auto_ptr<scene::RPCFitter> fitter(
+            six::sicd::Utilities::getRPCFitter(*complexData, heightRange));
+        scene::RPCModel rpc;
+        types::RowCol<double> rmsResidualError;
+        types::RowCol<double> maxResidualError;
+        fitter->fit(rpc, &rmsResidualError, &maxResidualError);
+
+        std::cout << "RMS residual error (pixels): " << rmsResidualError.row
+                  << ", " << rmsResidualError.col << std::endl;
+        std::cout << "Max residual error (pixels): " << maxResidualError.row
+                  << ", " << maxResidualError.col << std::endl;
+
+        // Check halfway between the fit points, which is where the fit is
+        // worst, at a height that wasn't sampled either
+        const std::auto_ptr<scene::SceneGeometry> geometry(
+            six::sicd::Utilities::getSceneGeometry(complexData.get()));
+        const std::auto_ptr<scene::ProjectionModel> projModel(
+            six::sicd::Utilities::getProjectionModel(complexData.get(),
+                                                     geometry.get()));
+        const six::sicd::ImageData& imageData(*complexData->imageData);
+        const types::RowCol<double> sceneCenter(
+            static_cast<double>(imageData.scpPixel.row) - imageData.firstRow,
+            static_cast<double>(imageData.scpPixel.col) - imageData.firstCol);
+        const types::RowCol<double> sampleSpacing(
+            complexData->grid->row->sampleSpacing,
+            complexData->grid->col->sampleSpacing);
+        const double height = scene::Utilities::ecefToLatLon(
+            complexData->geoData->scp.ecf).getAlt() + heightRange / 3;
+
+        const size_t numPoints1D = scene::RPCFitter::DEFAULT_POINTS_1D;
+        const double rowSkip = static_cast<double>(
+            complexData->getNumRows() - 1) / (numPoints1D - 1);
+        const double colSkip = static_cast<double>(
+            complexData->getNumCols() - 1) / (numPoints1D - 1);
+
+        std::vector<scene::LatLonAlt> groundPts;
+        std::vector<types::RowCol<double> > expectedPts;
+        for (size_t row = 0; row < numPoints1D - 1; ++row)
+        {
+            for (size_t col = 0; col < numPoints1D - 1; ++col)
+            {
+                const types::RowCol<double> pixel((row + 0.5) * rowSkip,
+                                                  (col + 0.5) * colSkip);
+                const scene::Vector3 scenePt = projModel->imageToScene(
+                    (pixel - sceneCenter) * sampleSpacing, height);
+                groundPts.push_back(
+                    scene::Utilities::ecefToLatLon(scenePt));
+                expectedPts.push_back(pixel);
+            }
+        }
+
+        std::vector<types::RowCol<double> > imagePts(groundPts.size());
+        rpc.groundToImage(&groundPts[0], groundPts.size(), &imagePts[0]);
+
+        types::RowCol<double> maxCheckError(0.0, 0.0);
+        for (size_t ii = 0; ii < imagePts.size(); ++ii)
+        {
+            maxCheckError.row = std::max(maxCheckError.row,
+                std::abs(imagePts[ii].row - expectedPts[ii].row));
+            maxCheckError.col = std::max(maxCheckError.col,
+                std::abs(imagePts[ii].col - expectedPts[ii].col));
+        }
+        std::cout << "Max check error (pixels): " << maxCheckError.row
+                  << ", " << maxCheckError.col << std::endl;
+
+        // Make sure it survives the trip through the TRE
+        nitf::TRE tre = six::createRPC00B(rpc);
+        const scene::RPCModel parsedRPC = six::parseRPC00B(tre);
+        const types::RowCol<double> treDiff =
+            parsedRPC.groundToImage(groundPts[0]) - imagePts[0];
+        std::cout << "RPC00B round trip difference (pixels): " << treDiff.row
+                  << ", " << treDiff.col << std::endl;
+    }
+    catch (const except::Exception& e)
+    {
+        std::cerr << "Caught exception: " << e.getMessage() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught exception: " << "Unknown exception" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
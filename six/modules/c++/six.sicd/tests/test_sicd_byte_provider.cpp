@@ -87,6 +87,9 @@ public:
 
     void testOneWritePerRow();
 
+    // Same as testMultipleWrites() but lets the byte provider do the swap
+    void testNativeEndianWrites();
+
 private:
     void normalWrite();
 
@@ -323,6 +326,43 @@ void Tester<DataTypeT>::testOneWritePerRow()
     compare("One write per row");
 }
 
+template <typename DataTypeT>
+void Tester<DataTypeT>::testNativeEndianWrites()
+{
+    const EnsureFileCleanup ensureFileCleanup(mTestPathname);
+
+    six::sicd::SICDByteProvider sicdByteProvider(
+            *mData,
+            mSchemaPaths,
+            mSetMaxProductSize ? mMaxProductSize : 0);
+    sicdByteProvider.setNumThreads(2);
+
+    // Reuse the same staging buffer for every band, out of order
+    const size_t startRows[] = {40, 5, 0, 100, 25, 60};
+    const size_t numRows[] = {20, 20, 5, 23, 15, 40};
+
+    six::StagingBuffer staging;
+    io::FileOutputStream outStream(mTestPathname);
+    for (size_t ii = 0; ii < sizeof(startRows) / sizeof(startRows[0]); ++ii)
+    {
+        nitf::Off fileOffset;
+        nitf::NITFBufferList buffers;
+        sicdByteProvider.getBytes(&mImage[startRows[ii] * mDims.col],
+                                  startRows[ii],
+                                  numRows[ii],
+                                  fileOffset,
+                                  buffers,
+                                  staging);
+        const nitf::Off numBytes =
+                sicdByteProvider.getNumBytes(startRows[ii], numRows[ii]);
+        write(fileOffset, buffers, numBytes, outStream);
+    }
+
+    outStream.close();
+
+    compare("Native endian writes");
+}
+
 template <typename DataTypeT>
 bool doTests(const std::vector<std::string>& schemaPaths,
              bool setMaxProductSize,
@@ -342,6 +382,7 @@ bool doTests(const std::vector<std::string>& schemaPaths,
     tester.testSingleWrite();
     tester.testMultipleWrites();
     tester.testOneWritePerRow();
+    tester.testNativeEndianWrites();
 
     return tester.success();
 }
@@ -0,0 +1,198 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+
+#include <import/six/sicd.h>
+#include "TestCase.h"
+
+namespace
+{
+std::auto_ptr<six::sicd::ComplexData> createData()
+{
+    std::auto_ptr<six::sicd::ComplexData> data(new six::sicd::ComplexData());
+    data->setNumRows(100);
+    data->setNumCols(200);
+    data->grid->row.reset(new six::sicd::DirectionParameters());
+    data->grid->row->sampleSpacing = 0.5;
+    data->position->arpPoly = six::PolyXYZ(2);
+    data->errorStatistics.reset(new six::ErrorStatistics());
+
+    // Done writing through the blocks, so let clones share them
+    data->markShareable();
+    return data;
+}
+
+TEST_CASE(testCopyOnWritePtr)
+{
+    six::CopyOnWritePtr<six::sicd::Timeline> original(
+            new six::sicd::Timeline());
+    original->collectDuration = 10.0;
+    original.markShareable();
+    TEST_ASSERT(!original.isShared());
+
+    six::CopyOnWritePtr<six::sicd::Timeline> copy(original);
+    TEST_ASSERT(original.isShared());
+    TEST_ASSERT(copy.isShared());
+
+    // Reading through const references doesn't copy
+    const six::CopyOnWritePtr<six::sicd::Timeline>& constCopy(copy);
+    TEST_ASSERT_EQ(constCopy->collectDuration, 10.0);
+    TEST_ASSERT(constCopy.get() ==
+                static_cast<const six::CopyOnWritePtr<six::sicd::Timeline>&>(
+                        original).get());
+
+    // Writing does, and only the copy sees the write
+    copy->collectDuration = 20.0;
+    TEST_ASSERT(!original.isShared());
+    TEST_ASSERT(!copy.isShared());
+    TEST_ASSERT_EQ(original->collectDuration, 10.0);
+    TEST_ASSERT_EQ(copy->collectDuration, 20.0);
+    TEST_ASSERT(original != copy);
+
+    copy->collectDuration = 10.0;
+    TEST_ASSERT(original == copy);
+
+    // The write above handed out a non-const reference, so copies don't share
+    TEST_ASSERT(!copy.isShareable());
+    six::CopyOnWritePtr<six::sicd::Timeline> copyOfCopy(copy);
+    TEST_ASSERT(!copy.isShared());
+    TEST_ASSERT(copyOfCopy.isShareable());
+
+    copy.reset();
+    TEST_ASSERT(!copy);
+    TEST_ASSERT(copy.get() == NULL);
+    TEST_ASSERT(original != copy);
+}
+
+TEST_CASE(testCloneShares)
+{
+    const std::auto_ptr<six::sicd::ComplexData> data(createData());
+    std::auto_ptr<six::sicd::ComplexData> chip(
+            static_cast<six::sicd::ComplexData*>(data->clone()));
+
+    TEST_ASSERT(chip->grid.isShared());
+    TEST_ASSERT(chip->position.isShared());
+    TEST_ASSERT(chip->radarCollection.isShared());
+    TEST_ASSERT(*chip == *data);
+
+    // A chip only changes the image data and corners
+    chip->setNumRows(10);
+    chip->imageData->firstRow = 20;
+    chip->geoData->imageCorners.upperLeft.setLat(1.0);
+    TEST_ASSERT(chip->grid.isShared());
+    TEST_ASSERT(chip->position.isShared());
+    TEST_ASSERT_EQ(data->getNumRows(), static_cast<size_t>(100));
+    TEST_ASSERT_EQ(data->imageData->firstRow, 0);
+}
+
+TEST_CASE(testHeldPointerDoesNotLeakIntoCopies)
+{
+    six::CopyOnWritePtr<six::sicd::Timeline> original(
+            new six::sicd::Timeline());
+    six::sicd::Timeline* const timeline = original.get();
+    timeline->collectDuration = 10.0;
+
+    // Writing through the held pointer must only change the original, so
+    // the copy can't share it
+    six::CopyOnWritePtr<six::sicd::Timeline> copy(original);
+    six::CopyOnWritePtr<six::sicd::Timeline> assigned;
+    assigned = original;
+    TEST_ASSERT(!original.isShared());
+    timeline->collectDuration = 20.0;
+    TEST_ASSERT_EQ(original->collectDuration, 20.0);
+    TEST_ASSERT_EQ(copy->collectDuration, 10.0);
+    TEST_ASSERT_EQ(assigned->collectDuration, 10.0);
+
+    // Once it's marked shareable again, copies share it
+    original.markShareable();
+    six::CopyOnWritePtr<six::sicd::Timeline> sharedCopy(original);
+    TEST_ASSERT(original.isShared());
+    TEST_ASSERT(sharedCopy.isShared());
+
+    // Same through ComplexData, which a parser leaves shareable
+    std::auto_ptr<six::sicd::ComplexData> data(createData());
+    six::sicd::Grid& grid = *data->grid;
+    std::auto_ptr<six::sicd::ComplexData> chip(
+            static_cast<six::sicd::ComplexData*>(data->clone()));
+    TEST_ASSERT(!chip->grid.isShared());
+    TEST_ASSERT(chip->position.isShared());
+    grid.row->sampleSpacing = 0.25;
+    TEST_ASSERT_EQ(chip->grid->row->sampleSpacing, 0.5);
+}
+
+TEST_CASE(testReadThroughNonConstDetaches)
+{
+    // Even a read through a non-const ComplexData counts as access, which
+    // is what filling in the classification after a load does.  Marking it
+    // shareable through the base class, as NITFReadControl does, fixes that.
+    std::auto_ptr<six::sicd::ComplexData> data(createData());
+    TEST_ASSERT_EQ(data->grid->row->sampleSpacing, 0.5);
+    data->getClassification();
+    std::auto_ptr<six::sicd::ComplexData> chip(
+            static_cast<six::sicd::ComplexData*>(data->clone()));
+    TEST_ASSERT(!chip->grid.isShared());
+    TEST_ASSERT(!chip->collectionInformation.isShared());
+
+    static_cast<six::Data&>(*data).markShareable();
+    chip.reset(static_cast<six::sicd::ComplexData*>(data->clone()));
+    TEST_ASSERT(chip->grid.isShared());
+    TEST_ASSERT(chip->collectionInformation.isShared());
+}
+
+TEST_CASE(testWriteDetaches)
+{
+    const std::auto_ptr<six::sicd::ComplexData> data(createData());
+    std::auto_ptr<six::sicd::ComplexData> chip(
+            static_cast<six::sicd::ComplexData*>(data->clone()));
+
+    chip->grid->row->sampleSpacing = 0.25;
+    TEST_ASSERT(!chip->grid.isShared());
+    TEST_ASSERT(!data->grid.isShared());
+    TEST_ASSERT(chip->position.isShared());
+    TEST_ASSERT_EQ(data->grid->row->sampleSpacing, 0.5);
+    TEST_ASSERT_EQ(chip->grid->row->sampleSpacing, 0.25);
+
+    // The original can be modified too, and the chip is unaffected
+    data->position->arpPoly = six::PolyXYZ(3);
+    TEST_ASSERT_EQ(data->position->arpPoly.order(), static_cast<size_t>(3));
+    TEST_ASSERT_EQ(chip->position->arpPoly.order(), static_cast<size_t>(2));
+
+    // Destroying the original leaves the chip intact
+    six::sicd::ComplexData* const copy =
+            static_cast<six::sicd::ComplexData*>(chip->clone());
+    chip.reset();
+    TEST_ASSERT_EQ(copy->grid->row->sampleSpacing, 0.25);
+    TEST_ASSERT(!copy->grid.isShared());
+    delete copy;
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testCopyOnWritePtr);
+    TEST_CHECK(testCloneShares);
+    TEST_CHECK(testHeldPointerDoesNotLeakIntoCopies);
+    TEST_CHECK(testReadThroughNonConstDetaches);
+    TEST_CHECK(testWriteDetaches);
+    return 0;
+}
@@ -0,0 +1,327 @@
+/* =========================================================================
+ * This file is part of six.sicd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sicd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include <import/six/sicd.h>
+#include "TestCase.h"
+
+namespace
+{
+const six::sicd::MeshInterpolator::Method METHODS[] =
+{
+    six::sicd::MeshInterpolator::BILINEAR,
+    six::sicd::MeshInterpolator::BICUBIC
+};
+
+// Uneven row spacing, decreasing columns
+void getNodes(std::vector<double>& rowNodes, std::vector<double>& colNodes)
+{
+    const double rows[] = {-400.0, -250.0, -30.0, 0.0, 120.0, 500.0};
+    const double cols[] = {300.0, 200.0, 100.0, 0.0, -100.0, -200.0, -300.0};
+    rowNodes.assign(rows, rows + sizeof(rows) / sizeof(rows[0]));
+    colNodes.assign(cols, cols + sizeof(cols) / sizeof(cols[0]));
+}
+
+six::sicd::PlanarCoordinateMesh makeMesh(const std::vector<double>& rowNodes,
+                                         const std::vector<double>& colNodes)
+{
+    std::vector<double> x;
+    std::vector<double> y;
+    for (size_t row = 0; row < rowNodes.size(); ++row)
+    {
+        for (size_t col = 0; col < colNodes.size(); ++col)
+        {
+            x.push_back(rowNodes[row]);
+            y.push_back(colNodes[col]);
+        }
+    }
+    return six::sicd::PlanarCoordinateMesh(
+            "Mesh",
+            types::RowCol<size_t>(rowNodes.size(), colNodes.size()),
+            x, y);
+}
+
+double bilinearFunction(double x, double y)
+{
+    return 3.0 - 0.25 * x + 0.5 * y + 1e-3 * x * y;
+}
+
+std::vector<double> makeField(const six::sicd::PlanarCoordinateMesh& mesh)
+{
+    std::vector<double> field(mesh.getX().size());
+    for (size_t ii = 0; ii < field.size(); ++ii)
+    {
+        field[ii] = bilinearFunction(mesh.getX()[ii], mesh.getY()[ii]);
+    }
+    return field;
+}
+
+std::vector<double> makeRandomField(size_t numNodes, unsigned int seed)
+{
+    std::vector<double> field(numNodes);
+    for (size_t ii = 0; ii < numNodes; ++ii)
+    {
+        seed = seed * 1103515245 + 12345;
+        field[ii] = (seed >> 8) / 1000000.0;
+    }
+    return field;
+}
+}
+
+TEST_CASE(testExactAtNodes)
+{
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    getNodes(rowNodes, colNodes);
+    const six::sicd::PlanarCoordinateMesh mesh(makeMesh(rowNodes, colNodes));
+    const std::vector<double> field = makeRandomField(mesh.getX().size(), 7);
+
+    for (size_t mm = 0; mm < 2; ++mm)
+    {
+        const six::sicd::MeshInterpolator interpolator(mesh, METHODS[mm]);
+        for (size_t ii = 0; ii < field.size(); ++ii)
+        {
+            TEST_ASSERT_ALMOST_EQ_EPS(
+                    interpolator.interpolate(field, mesh.getX()[ii],
+                                             mesh.getY()[ii]),
+                    field[ii], 1e-12);
+        }
+
+        std::vector<double> output(field.size());
+        interpolator.interpolate(field, &mesh.getX()[0], &mesh.getY()[0],
+                                 field.size(), &output[0]);
+        for (size_t ii = 0; ii < field.size(); ++ii)
+        {
+            TEST_ASSERT_ALMOST_EQ_EPS(output[ii], field[ii], 1e-12);
+        }
+    }
+}
+
+TEST_CASE(testBilinearField)
+{
+    // Bilinear interpolation reproduces a bilinear function anywhere on any
+    // rectilinear mesh, including when extrapolating
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    getNodes(rowNodes, colNodes);
+    const six::sicd::PlanarCoordinateMesh mesh(makeMesh(rowNodes, colNodes));
+    const std::vector<double> field = makeField(mesh);
+    const six::sicd::MeshInterpolator interpolator(mesh);
+
+    for (double x = -600.0; x <= 700.0; x += 37.5)
+    {
+        for (double y = -450.0; y <= 450.0; y += 41.25)
+        {
+            TEST_ASSERT_ALMOST_EQ_EPS(interpolator.interpolate(field, x, y),
+                                      bilinearFunction(x, y), 1e-9);
+        }
+    }
+}
+
+TEST_CASE(testBicubicLinearField)
+{
+    // On a uniform mesh, bicubic reproduces linear functions, edges included
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    for (size_t ii = 0; ii < 5; ++ii)
+    {
+        rowNodes.push_back(-100.0 + 50.0 * ii);
+        colNodes.push_back(-80.0 + 40.0 * ii);
+    }
+    const six::sicd::PlanarCoordinateMesh mesh(makeMesh(rowNodes, colNodes));
+    std::vector<double> field(mesh.getX().size());
+    for (size_t ii = 0; ii < field.size(); ++ii)
+    {
+        field[ii] = 2.0 + 0.1 * mesh.getX()[ii] - 0.3 * mesh.getY()[ii];
+    }
+
+    const six::sicd::MeshInterpolator interpolator(
+            mesh, six::sicd::MeshInterpolator::BICUBIC);
+    for (double x = -130.0; x <= 130.0; x += 7.0)
+    {
+        for (double y = -100.0; y <= 100.0; y += 9.0)
+        {
+            TEST_ASSERT_ALMOST_EQ_EPS(interpolator.interpolate(field, x, y),
+                                      2.0 + 0.1 * x - 0.3 * y, 1e-9);
+        }
+    }
+}
+
+TEST_CASE(testFillMatchesPoints)
+{
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    getNodes(rowNodes, colNodes);
+    const six::sicd::PlanarCoordinateMesh mesh(makeMesh(rowNodes, colNodes));
+    const std::vector<double> field = makeRandomField(mesh.getX().size(), 11);
+
+    // Extends past the mesh on every side
+    const six::sicd::RasterGrid grid(types::RowCol<double>(-450.0, 320.0),
+                                     types::RowCol<double>(3.7, -2.9),
+                                     types::RowCol<size_t>(260, 231));
+
+    const size_t numThreads[] = {1, 4};
+    for (size_t mm = 0; mm < 2; ++mm)
+    {
+        for (size_t tt = 0; tt < 2; ++tt)
+        {
+            const six::sicd::MeshInterpolator interpolator(mesh, METHODS[mm],
+                                                           numThreads[tt]);
+            std::vector<double> output(grid.dims.row * grid.dims.col);
+            interpolator.fill(field, grid, &output[0]);
+
+            for (size_t row = 0, idx = 0; row < grid.dims.row; ++row)
+            {
+                const double x = grid.origin.row + row * grid.spacing.row;
+                for (size_t col = 0; col < grid.dims.col; ++col, ++idx)
+                {
+                    const double y = grid.origin.col + col * grid.spacing.col;
+                    TEST_ASSERT_ALMOST_EQ_EPS(
+                            output[idx],
+                            interpolator.interpolate(field, x, y),
+                            1e-9);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE(testPlanReuse)
+{
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    getNodes(rowNodes, colNodes);
+    const six::sicd::PlanarCoordinateMesh coords(
+            makeMesh(rowNodes, colNodes));
+    const size_t numNodes = coords.getX().size();
+    const six::sicd::NoiseMesh mesh("Noise",
+                                    coords.getMeshDims(),
+                                    coords.getX(),
+                                    coords.getY(),
+                                    makeRandomField(numNodes, 1),
+                                    makeRandomField(numNodes, 2),
+                                    makeRandomField(numNodes, 3));
+
+    // Enough points to be split across threads
+    std::vector<double> x(10000);
+    std::vector<double> y(x.size());
+    for (size_t ii = 0; ii < x.size(); ++ii)
+    {
+        x[ii] = -500.0 + 0.1 * ii;
+        y[ii] = 350.0 - 0.07 * ii;
+    }
+
+    for (size_t mm = 0; mm < 2; ++mm)
+    {
+        const six::sicd::MeshInterpolator interpolator(mesh, METHODS[mm], 3);
+        six::sicd::MeshInterpolator::QueryPlan plan;
+        interpolator.plan(&x[0], &y[0], x.size(), plan);
+        TEST_ASSERT_EQ(plan.size(), x.size());
+
+        const std::vector<double>* fields[] =
+        {
+            &mesh.getMainBeamNoise(),
+            &mesh.getAzimuthAmbiguityNoise(),
+            &mesh.getCombinedNoise()
+        };
+        for (size_t ff = 0; ff < 3; ++ff)
+        {
+            std::vector<double> output(x.size());
+            interpolator.interpolate(plan, *fields[ff], &output[0]);
+            for (size_t ii = 0; ii < x.size(); ii += 97)
+            {
+                TEST_ASSERT_ALMOST_EQ_EPS(
+                        output[ii],
+                        interpolator.interpolate(*fields[ff], x[ii], y[ii]),
+                        1e-12);
+            }
+        }
+    }
+}
+
+TEST_CASE(testFromPixels)
+{
+    const six::sicd::RasterGrid grid = six::sicd::RasterGrid::fromPixels(
+            types::RowCol<size_t>(100, 20),
+            types::RowCol<size_t>(8, 9),
+            types::RowCol<double>(150.0, 10.0),
+            types::RowCol<double>(0.5, 0.25));
+    TEST_ASSERT_ALMOST_EQ_EPS(grid.origin.row, -25.0, 1e-12);
+    TEST_ASSERT_ALMOST_EQ_EPS(grid.origin.col, 2.5, 1e-12);
+    TEST_ASSERT_ALMOST_EQ_EPS(grid.spacing.row, 0.5, 1e-12);
+    TEST_ASSERT_ALMOST_EQ_EPS(grid.spacing.col, 0.25, 1e-12);
+    TEST_ASSERT_EQ(grid.dims.row, static_cast<size_t>(8));
+    TEST_ASSERT_EQ(grid.dims.col, static_cast<size_t>(9));
+}
+
+TEST_CASE(testInvalid)
+{
+    std::vector<double> rowNodes;
+    std::vector<double> colNodes;
+    getNodes(rowNodes, colNodes);
+    six::sicd::PlanarCoordinateMesh mesh(makeMesh(rowNodes, colNodes));
+
+    // Wrong number of field values
+    const six::sicd::MeshInterpolator interpolator(mesh);
+    const std::vector<double> field(3);
+    TEST_EXCEPTION(interpolator.interpolate(field, 0.0, 0.0));
+
+    // Plans are tied to the method
+    const six::sicd::MeshInterpolator bicubic(
+            mesh, six::sicd::MeshInterpolator::BICUBIC);
+    const double x = 0.0;
+    const double y = 0.0;
+    six::sicd::MeshInterpolator::QueryPlan plan;
+    bicubic.plan(&x, &y, 1, plan);
+    double output;
+    TEST_EXCEPTION(interpolator.interpolate(plan, makeField(mesh), &output));
+
+    // Not rectilinear
+    std::vector<double> meshX(mesh.getX());
+    meshX[3] += 1.0;
+    TEST_EXCEPTION(six::sicd::MeshInterpolator(
+            six::sicd::PlanarCoordinateMesh(
+                    "Mesh", mesh.getMeshDims(), meshX, mesh.getY())));
+
+    // Not monotonic
+    std::swap(rowNodes[1], rowNodes[2]);
+    TEST_EXCEPTION(six::sicd::MeshInterpolator(
+            makeMesh(rowNodes, colNodes)));
+
+    // Too small
+    TEST_EXCEPTION(six::sicd::MeshInterpolator(
+            makeMesh(std::vector<double>(1, 0.0), colNodes)));
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testExactAtNodes);
+    TEST_CHECK(testBilinearField);
+    TEST_CHECK(testBicubicLinearField);
+    TEST_CHECK(testFillMatchesPoints);
+    TEST_CHECK(testPlanReuse);
+    TEST_CHECK(testFromPixels);
+    TEST_CHECK(testInvalid);
+    return 0;
+}
@@ -2445,6 +2445,19 @@ bool cmpRoundTripXMLs(std::string xmlText, std::string xmlPath = "",
         rtDoc->getRootElement()->print(oss);
         std::string postRTxml(oss.stream().str());
 
+        // writing without the DOM has to produce exactly the same bytes
+        six::XMLStreamWriter counter;
+        xmlControl->toXML(data, counter);
+        std::string streamedXML;
+        six::XMLStreamWriter writer(&streamedXML);
+        xmlControl->toXML(data, writer);
+        if (streamedXML != postRTxml ||
+            counter.getNumBytes() != postRTxml.size())
+        {
+            if (verbose) diffXMLs("Parsed   ", postRTxml,  "Streamed ", streamedXML,  debugLineCnt);
+            return false;
+        }
+
         // read document back into Complex Data structure to compare against
         six::sicd::ComplexData* rtData = (
             six::sicd::ComplexData*)xmlControl->fromXML(rtDoc.get(), std::vector<std::string>());
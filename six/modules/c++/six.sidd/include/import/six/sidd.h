@@ -29,6 +29,7 @@
 #include "six/sidd/DerivedData.h"
 #include "six/sidd/DerivedDataBuilder.h"
 #include "six/sidd/DerivedXMLControl.h"
+#include "six/sidd/DetectedProductPipeline.h"
 #include "six/sidd/Display.h"
 #include "six/sidd/DownstreamReprocessing.h"
 #include "six/sidd/ExploitationFeatures.h"
@@ -25,6 +25,7 @@
 #include <mem/ScopedCloneablePtr.h>
 #include <mem/ScopedCopyablePtr.h>
 
+#include "six/CopyOnWritePtr.h"
 #include "six/Data.h"
 #include "six/ErrorStatistics.h"
 #include "six/sidd/ProductCreation.h"
@@ -49,6 +50,11 @@ namespace sidd
  *  Sub-class of Data for handling Derived Products (SIDD)
  *  Contains the structs that are the model for SIDD products
  *
+ *  Copies (e.g. from clone()) share every block but the
+ *  GeographicAndTarget, Measurement, ErrorStatistics and Radiometric until
+ *  a block is modified through the copy.  A block that has been accessed
+ *  through a non-const DerivedData is deep copied instead, until
+ *  markShareable() is called.  See CopyOnWritePtr.
  */
 struct DerivedData: public Data
 {
@@ -57,13 +63,13 @@ struct DerivedData: public Data
      *  Information related to processor, classification,
      *  and product type
      */
-    mem::ScopedCloneablePtr<ProductCreation> productCreation;
+    CopyOnWritePtr<ProductCreation> productCreation;
 
     /*!
      *  Contains information on the parameters needed to display
      *  the product in an exploitation tool
      */
-    mem::ScopedCloneablePtr<Display> display;
+    CopyOnWritePtr<Display> display;
 
     /*!
      *  Contains generic and extensible targeting and geographic
@@ -80,19 +86,19 @@ struct DerivedData: public Data
     /*!
      *  Computed metadata for collections
      */
-    mem::ScopedCloneablePtr<ExploitationFeatures> exploitationFeatures;
+    CopyOnWritePtr<ExploitationFeatures> exploitationFeatures;
 
     /*!
      *  (Optional) Contains meta-data related to algorithms used
      *  during product generation
      */
-    mem::ScopedCloneablePtr<ProductProcessing> productProcessing;
+    CopyOnWritePtr<ProductProcessing> productProcessing;
 
     /*!
      *  (Optional) Contains meta-data related to downstream
      *  processing of the product
      */
-    mem::ScopedCopyablePtr<DownstreamReprocessing> downstreamReprocessing;
+    CopyOnWritePtr<DownstreamReprocessing> downstreamReprocessing;
 
     /*!
      *  (Optional) Contains error statistics structures
@@ -125,10 +131,23 @@ struct DerivedData: public Data
     }
 
     /*!
-     *  Make a deep copy of all of the objects here.
+     *  Make a deep copy of all of the objects here.  Blocks held in a
+     *  CopyOnWritePtr are shared with the copy rather than copied, unless
+     *  they've been accessed through a non-const DerivedData since this was
+     *  built, read, or last marked shareable.  That includes plain reads
+     *  through a non-const reference, so call markShareable() before
+     *  cloning if the data may have been touched that way.
      */
     virtual Data* clone() const;
 
+    /*!
+     *  Lets copies share the blocks that have been modified since this was
+     *  built or copied (see CopyOnWritePtr::markShareable()).  Only call
+     *  this once nothing holds on to a pointer or reference into one of
+     *  those blocks.
+     */
+    virtual void markShareable();
+
     /*!
      *  Maps to:
      *  /SIDD/Measurement/PixelFootprint/Row
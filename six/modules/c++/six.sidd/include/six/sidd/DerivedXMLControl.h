@@ -48,6 +48,10 @@ protected:
      *  Returns a new allocated DOM document, created from the DerivedData*
      */
     virtual xml::lite::Document* toXMLImpl(const Data* data);
+    /*!
+     *  Writes the DerivedData* straight to 'writer', without a DOM
+     */
+    virtual void toXMLImpl(const Data* data, XMLStreamWriter& writer);
     /*!
      *  Returns a new allocated DerivedData*, created from the DOM Document*
      *
@@ -42,6 +42,12 @@ public:
 
     xml::lite::Document* toXML(const DerivedData* data) const;
 
+    /*!
+     * Write 'data' straight to 'writer', without building a DOM.  The
+     * output is byte-for-byte what printing toXML(data) produces.
+     */
+    void toXML(const DerivedData* data, XMLStreamWriter& writer) const;
+
     DerivedData* fromXML(const xml::lite::Document* doc) const;
 
 protected:
@@ -111,6 +117,47 @@ private:
             const SFAGeographicCoordinateSystem* geographicCoordinateSystem,
             XMLElem parent) const;
 
+    void writeLUT(XMLStreamWriter& writer, const std::string& name,
+                  const LUT *l) const;
+    void writeFootprint(XMLStreamWriter& writer, const std::string& name,
+                        const std::string& cornerName,
+                        const LatLonCorners& corners) const;
+    void writeSFAPoint(XMLStreamWriter& writer, const std::string& localName,
+                       const SFAPoint* point) const;
+    void writeSFALine(XMLStreamWriter& writer, const std::string& localName,
+                      const SFALineString* lineStr) const;
+    void writeSFADatum(XMLStreamWriter& writer, const std::string& name,
+                       const six::sidd::SFADatum& datum) const;
+    void writeProductCreation(XMLStreamWriter& writer,
+                              const ProductCreation* productCreation) const;
+    void writeProcessorInformation(
+            XMLStreamWriter& writer,
+            const ProcessorInformation* processorInformation) const;
+    void writeDerivedClassification(
+            XMLStreamWriter& writer,
+            const DerivedClassification& classification) const;
+    void writeProductProcessing(XMLStreamWriter& writer,
+                                const ProductProcessing* productProcessing) const;
+    void writeProcessingModule(XMLStreamWriter& writer,
+                               const ProcessingModule* procMod) const;
+    void writeDownstreamReprocessing(XMLStreamWriter& writer,
+                                     const DownstreamReprocessing* d) const;
+    void writeDisplay(XMLStreamWriter& writer, const Display* display) const;
+    void writeGeographicTarget(XMLStreamWriter& writer,
+                               const GeographicAndTarget* g) const;
+    void writeGeographicCoverage(XMLStreamWriter& writer,
+                                 const std::string& localName,
+                                 const GeographicCoverage* g) const;
+    void writeMeasurement(XMLStreamWriter& writer,
+                          const Measurement* measurement) const;
+    void writeExploitationFeatures(XMLStreamWriter& writer,
+                                   const ExploitationFeatures* exFeatures) const;
+    void writeAnnotation(XMLStreamWriter& writer, const Annotation *a) const;
+    void writeSFAGeometry(XMLStreamWriter& writer, const SFAGeometry *g) const;
+    void writeGeographicCoordinateSystem(
+            XMLStreamWriter& writer,
+            const SFAGeographicCoordinateSystem* geographicCoordinateSystem) const;
+
 
     void parseProductCreationFromXML(const XMLElem productCreationXML,
                                      ProductCreation* productCreation) const;
@@ -171,6 +218,22 @@ private:
                           const std::string& uri = "",
                           bool setIfEmpty = false);
 
+    static
+    std::string joinAttributeList(const std::vector<std::string>& values);
+
+    static
+    void addAttributeList(XMLStreamWriter& writer,
+                          const std::string& attributeName,
+                          const std::vector<std::string>& values,
+                          const std::string& uri = "",
+                          bool setIfEmpty = false);
+
+    static
+    void addAttributeIfNonEmpty(XMLStreamWriter& writer,
+                                const std::string& name,
+                                const std::string& value,
+                                const std::string& uri = "");
+
     static
     void setAttributeIfNonEmpty(XMLElem element,
                                 const std::string& name,
@@ -0,0 +1,264 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_SIDD_DETECTED_PRODUCT_PIPELINE_H__
+#define __SIX_SIDD_DETECTED_PRODUCT_PIPELINE_H__
+
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <sys/Conf.h>
+#include <types/RowCol.h>
+#include <six/ReadControl.h>
+#include <six/sidd/DerivedData.h>
+
+namespace six
+{
+namespace sidd
+{
+/*!
+ * \class ComplexImageSource
+ * \brief Provides rows of complex pixels to a DetectedProductPipeline
+ */
+class ComplexImageSource
+{
+public:
+    virtual ~ComplexImageSource()
+    {
+    }
+
+    //! \return The dimensions of the complex image
+    virtual types::RowCol<size_t> getDims() const = 0;
+
+    /*!
+     * Read a band of full rows.  Only called from one thread at a time.
+     *
+     * \param startRow The first row to read
+     * \param numRows The number of rows to read
+     * \param[out] buffer Native endian pixels.  Must hold numRows x numCols
+     * pixels.
+     */
+    virtual void read(size_t startRow,
+                      size_t numRows,
+                      std::complex<float>* buffer) = 0;
+};
+
+/*!
+ * \class ReadControlComplexSource
+ * \brief Reads a complex image (i.e. a SICD) through a ReadControl.
+ * RE16I_IM16I pixels are converted to float.  AMP8I_PHS8I is not supported.
+ */
+class ReadControlComplexSource : public ComplexImageSource
+{
+public:
+    /*!
+     * \param reader ReadControl that has already loaded the file.  Must
+     * outlive this object.
+     * \param imageNumber The image to read
+     */
+    ReadControlComplexSource(ReadControl& reader, size_t imageNumber = 0);
+
+    virtual types::RowCol<size_t> getDims() const
+    {
+        return mDims;
+    }
+
+    virtual void read(size_t startRow,
+                      size_t numRows,
+                      std::complex<float>* buffer);
+
+private:
+    ReadControl& mReader;
+    const size_t mImageNumber;
+    types::RowCol<size_t> mDims;
+    PixelType mPixelType;
+    std::vector<sys::Int16_T> mScratch;
+};
+
+/*!
+ * \class DetectedProductPipeline
+ * \brief Generates a MONO8I detected SIDD product from complex imagery.
+ *
+ * The complex image is streamed in row bands and is never held in memory all
+ * at once.  The first pass (computeStatistics()) detects each band and builds
+ * a magnitude histogram on multiple threads.  The clip points come from that
+ * histogram and go into an 8-bit remap lookup table.  The second pass (write())
+ * detects and remaps each band on multiple threads and writes it straight to
+ * the output NITF through a SIDDByteProvider.
+ *
+ * The histogram is binned on the upper 16 bits of each magnitude's IEEE
+ * representation, so it covers any dynamic range in one pass, with bins
+ * about 0.8% wide relative to the magnitude.  The remap lookup table uses the
+ * same bins.
+ *
+ * \code
+    six::NITFReadControl reader;
+    reader.load(sicdPathname);
+    six::sidd::ReadControlComplexSource source(reader);
+
+    six::sidd::DetectedProductPipeline pipeline(source);
+    pipeline.computeStatistics();
+
+    std::auto_ptr<six::sidd::DerivedData> data = ...; // Geometry, etc.
+    pipeline.populateDerivedData(*data);
+    pipeline.write(*data, schemaPaths, "out.nitf");
+ * \endcode
+ */
+class DetectedProductPipeline
+{
+public:
+    //! How magnitudes between the clip points map to [0, 255]
+    enum RemapType
+    {
+        LINEAR,     //!< Linear in magnitude
+        LOGARITHMIC //!< Linear in dB
+    };
+
+    //! Per-thread statistics.  Only used internally.
+    struct Accumulator;
+
+    //! Magnitude statistics from the first pass
+    struct Statistics
+    {
+        Statistics();
+
+        size_t numPixels;
+        double minMagnitude;
+        double maxMagnitude;
+        double meanMagnitude;
+
+        //! Magnitudes at the lower and upper clip percentiles
+        double lowerClipMagnitude;
+        double upperClipMagnitude;
+    };
+
+    /*!
+     * \param source Source of complex pixels.  Must outlive this object.
+     * \param numThreads The number of threads to use.  If 0, uses the number
+     * of CPUs.
+     * \param numRowsPerBand The number of rows read, detected, and written
+     * at a time
+     */
+    DetectedProductPipeline(ComplexImageSource& source,
+                            size_t numThreads = 0,
+                            size_t numRowsPerBand = 256);
+
+    /*!
+     * Set how the remap is computed.  Must be called before
+     * computeStatistics().
+     *
+     * \param remapType How magnitudes between the clip points are mapped
+     * \param lowerClipPercentile Percentage of pixels that map to 0
+     * \param upperClipPercentile Percentage of pixels that map to less than
+     * 255
+     */
+    void setRemap(RemapType remapType,
+                  double lowerClipPercentile,
+                  double upperClipPercentile);
+
+    /*!
+     * Run the first pass over the source to compute the magnitude
+     * statistics and build the remap lookup table
+     *
+     * \return The statistics
+     */
+    const Statistics& computeStatistics();
+
+    //! \return The statistics.  computeStatistics() must have been called.
+    const Statistics& getStatistics() const;
+
+    /*!
+     * Fill in the parts of 'data' that describe the product this pipeline
+     * makes: the dimensions and MONO8I pixel type, the Display remap and
+     * histogram overrides, a ProductProcessing module describing the remap,
+     * and a DownstreamReprocessing processing event.  Geometry, exploitation
+     * features, etc. are left to the caller.
+     *
+     * \param[in,out] data Derived data to update
+     */
+    void populateDerivedData(DerivedData& data) const;
+
+    /*!
+     * Detect and remap a band of rows into 8-bit pixels.  Reads from the
+     * source.
+     *
+     * \param startRow The first row
+     * \param numRows The number of rows
+     * \param[out] output numRows x numCols remapped pixels
+     */
+    void remap(size_t startRow, size_t numRows, sys::ubyte* output);
+
+    /*!
+     * Run the second pass, writing a SIDD NITF.  Only one band of complex
+     * and remapped pixels is held in memory at a time.
+     *
+     * \param data Derived data for the product, typically updated via
+     * populateDerivedData()
+     * \param schemaPaths Directories or files of schema locations
+     * \param pathname The output pathname
+     * \param numRowsPerBlock The number of rows per block.  Defaults to no
+     * blocking.
+     * \param numColsPerBlock The number of columns per block.  Defaults to no
+     * blocking.
+     * \param maxProductSize The max number of bytes in an image segment.  By
+     * default this is set automatically based on NITF file rules.
+     */
+    void write(const DerivedData& data,
+               const std::vector<std::string>& schemaPaths,
+               const std::string& pathname,
+               size_t numRowsPerBlock = 0,
+               size_t numColsPerBlock = 0,
+               size_t maxProductSize = 0);
+
+    //! \return The 8-bit value a magnitude maps to
+    sys::ubyte remapMagnitude(float magnitude) const;
+
+private:
+    void checkStatistics() const;
+
+    void buildLUT();
+
+    void runBand(size_t numRows,
+                 const std::complex<float>* input,
+                 sys::ubyte* output,
+                 std::vector<Accumulator>* accumulators);
+
+private:
+    ComplexImageSource& mSource;
+    const types::RowCol<size_t> mDims;
+    const size_t mNumThreads;
+    const size_t mNumRowsPerBand;
+
+    RemapType mRemapType;
+    double mLowerClipPercentile;
+    double mUpperClipPercentile;
+
+    bool mHaveStatistics;
+    Statistics mStatistics;
+    std::vector<sys::ubyte> mLUT;
+    std::vector<std::complex<float> > mBand;
+};
+}
+}
+
+#endif
@@ -44,7 +44,11 @@ namespace sidd
  * file.  The bytes are intentionally provided back as a series of pointers
  * rather than one contiguous block of memory in order to not perform any
  * copies.  A single logical SIDD image which spans multiple NITF image segments
- * is supported; unrelated SIDD images in one NITF are not yet supported.
+ * is supported, as are several unrelated SIDD images (each with an optional
+ * legend) in one NITF.  In that case, each image is a separate image product,
+ * indexed in the order its DerivedData is in the container, and the
+ * getNumBytes() and getBytes() overloads taking a product index are used to
+ * provide its rows independently of the others.
  */
 class SIDDByteProvider : public six::ByteProvider
 {
@@ -67,6 +71,25 @@ public:
                      size_t numColsPerBlock = 0,
                      size_t maxProductSize = 0);
 
+    /*!
+     * Constructor for a NITF holding one or more SIDD images
+     *
+     * \param container Container holding only DerivedData, along with any
+     * legends
+     * \param schemPaths Directories or files of schema locations
+     * \param numRowsPerBlock The number of rows per block.  Defaults to no
+     * blocking.
+     * \param numColsPerBlock The number of columns per block.  Defaults to no
+     * blocking.
+     * \param maxProductSize The max number of bytes in an image segment.
+     * By default this is set automatically for you based on NITF file rules.
+     */
+    SIDDByteProvider(mem::SharedPtr<Container> container,
+                     const std::vector<std::string>& schemaPaths,
+                     size_t numRowsPerBlock = 0,
+                     size_t numColsPerBlock = 0,
+                     size_t maxProductSize = 0);
+
     /*!
      * Constructor
      * This option allows you to pass in an initialized writer,
@@ -70,6 +70,26 @@ public:
     static std::auto_ptr<scene::ProjectionModel>
     getProjectionModel(const DerivedData* data);
 
+    /*
+     * Build an RPCFitter from a DerivedData's measurable projection
+     *
+     * \param data DerivedData from which to construct fitter
+     * \param heightRange Range of heights in meters to sample, centered on
+     * the reference point height
+     * \param numPoints1D Number of points to use in each direction of grid
+     * \param numHeights Number of heights to sample at each point
+     *
+     * \return RPCFitter from DerivedData
+     *
+     * \throws except::Exception if the product is a geometric chip, since
+     * the fitter assumes the pixels map linearly to the full image
+     */
+    static std::auto_ptr<scene::RPCFitter>
+    getRPCFitter(const DerivedData* data,
+                 double heightRange = 1000.0,
+                 size_t numPoints1D = scene::RPCFitter::DEFAULT_POINTS_1D,
+                 size_t numHeights = scene::RPCFitter::DEFAULT_NUM_HEIGHTS);
+
     /*
     * Parses the XML in 'xmlStream' and converts it into a DerivedData object.
     * Throws if the underlying type is not derived.
@@ -40,6 +40,15 @@ Data* DerivedData::clone() const
     return new DerivedData(*this);
 }
 
+void DerivedData::markShareable()
+{
+    productCreation.markShareable();
+    display.markShareable();
+    exploitationFeatures.markShareable();
+    productProcessing.markShareable();
+    downstreamReprocessing.markShareable();
+}
+
 DateTime DerivedData::getCollectionStartDateTime() const
 {
     if (!exploitationFeatures.get() ||
@@ -49,6 +49,17 @@ xml::lite::Document* DerivedXMLControl::toXMLImpl(const Data* data)
     DerivedXMLParser parser(data->getVersion(), mLog, false);
     return parser.toXML(reinterpret_cast<const DerivedData*>(data));
 }
+
+void DerivedXMLControl::toXMLImpl(const Data* data, XMLStreamWriter& writer)
+{
+    if (data->getDataType() != DataType::DERIVED)
+    {
+        throw except::Exception(Ctxt("Data must be SIDD"));
+    }
+
+    DerivedXMLParser parser(data->getVersion(), mLog, false);
+    parser.toXML(reinterpret_cast<const DerivedData*>(data), writer);
+}
 }
 }
 
@@ -28,6 +28,7 @@
 #include <six/sidd/DerivedXMLParser.h>
 #include <six/sidd/DerivedDataBuilder.h>
 #include <six/SICommonXMLParser01x.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -149,6 +150,8 @@ DerivedData* DerivedXMLParser::fromXML(
         }
     }
 
+    // Nothing holds on to the blocks filled in above
+    data->markShareable();
     return data;
 }
 
@@ -207,6 +210,58 @@ xml::lite::Document* DerivedXMLParser::toXML(const DerivedData* derived) const
     return doc;
 }
 
+void DerivedXMLParser::toXML(const DerivedData* derived,
+                             XMLStreamWriter& writer) const
+{
+    writer.startElement("SIDD", getDefaultURI());
+
+    //set the XMLNS
+    writer.setNamespacePrefix("", getDefaultURI());
+    writer.setNamespacePrefix("si", SI_COMMON_URI);
+    writer.setNamespacePrefix("sfa", SFA_URI);
+    writer.setNamespacePrefix("ism", ISM_URI);
+
+    writeProductCreation(writer, derived->productCreation.get());
+    writeDisplay(writer, derived->display.get());
+    writeGeographicTarget(writer, derived->geographicAndTarget.get());
+    writeMeasurement(writer, derived->measurement.get());
+    writeExploitationFeatures(writer, derived->exploitationFeatures.get());
+
+    // optional
+    if (derived->productProcessing.get())
+    {
+        writeProductProcessing(writer, derived->productProcessing.get());
+    }
+    // optional
+    if (derived->downstreamReprocessing.get())
+    {
+        writeDownstreamReprocessing(writer,
+                                    derived->downstreamReprocessing.get());
+    }
+    // optional
+    if (derived->errorStatistics.get())
+    {
+        common().writeErrorStatistics(writer, derived->errorStatistics.get());
+    }
+    // optional
+    if (derived->radiometric.get())
+    {
+        common().writeRadiometry(writer, derived->radiometric.get());
+    }
+    // optional
+    if (!derived->annotations.empty())
+    {
+        writer.startElement("Annotations", getDefaultURI());
+        for (size_t i = 0, num = derived->annotations.size(); i < num; ++i)
+        {
+            writeAnnotation(writer, derived->annotations[i].get());
+        }
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 void DerivedXMLParser::getAttributeList(
         const xml::lite::Attributes& attributes,
         const std::string& attributeName,
@@ -267,6 +322,16 @@ void DerivedXMLParser::setAttributeList(
         const std::vector<std::string>& values,
         const std::string& uri,
         bool setIfEmpty)
+{
+    const std::string value(joinAttributeList(values));
+    if (!value.empty() || setIfEmpty)
+    {
+        setAttribute(element, attributeName, value, uri);
+    }
+}
+
+std::string DerivedXMLParser::joinAttributeList(
+        const std::vector<std::string>& values)
 {
     std::string value;
     for (size_t ii = 0; ii < values.size(); ++ii)
@@ -283,10 +348,31 @@ void DerivedXMLParser::setAttributeList(
             value += thisValue;
         }
     }
+    return value;
+}
 
+void DerivedXMLParser::addAttributeList(
+        XMLStreamWriter& writer,
+        const std::string& attributeName,
+        const std::vector<std::string>& values,
+        const std::string& uri,
+        bool setIfEmpty)
+{
+    const std::string value(joinAttributeList(values));
     if (!value.empty() || setIfEmpty)
     {
-        setAttribute(element, attributeName, value, uri);
+        writer.addAttribute(attributeName, value, uri);
+    }
+}
+
+void DerivedXMLParser::addAttributeIfNonEmpty(XMLStreamWriter& writer,
+                                              const std::string& name,
+                                              const std::string& value,
+                                              const std::string& uri)
+{
+    if (!value.empty())
+    {
+        writer.addAttribute(name, value, uri);
     }
 }
 
@@ -1849,141 +1935,908 @@ XMLElem DerivedXMLParser::convertDownstreamReprocessingToXML(
     return epXML;
 }
 
-void DerivedXMLParser::parseProcessingModuleFromXML(
-        const XMLElem procXML,
-        ProcessingModule* procMod) const
+void DerivedXMLParser::writeProcessorInformation(
+        XMLStreamWriter& writer,
+        const ProcessorInformation* processorInformation) const
 {
-    common().parseParameter(getFirstAndOnly(procXML, "ModuleName"),
-                            procMod->moduleName);
+    writer.startElement("ProcessorInformation", getDefaultURI());
 
-    common().parseParameters(procXML, "ModuleParameter", procMod->moduleParameters);
+    writeString(writer, "Application", processorInformation->application);
+    writeDateTime(writer, "ProcessingDateTime",
+                  processorInformation->processingDateTime);
+    writeString(writer, "Site", processorInformation->site);
 
-    std::vector<XMLElem> procModuleXML;
-    procXML->getElementsByTagName("ProcessingModule", procModuleXML);
-    procMod->processingModules.resize(procModuleXML.size());
-    for (size_t i = 0, size = procModuleXML.size(); i < size; ++i)
+    // optional
+    if (processorInformation->profile != Init::undefined<
+            std::string>())
     {
-        procMod->processingModules[i].reset(new ProcessingModule());
-        parseProcessingModuleFromXML(
-                procModuleXML[i], procMod->processingModules[i].get());
+        writeString(writer, "Profile", processorInformation->profile);
     }
+
+    writer.endElement();
 }
 
-void DerivedXMLParser::parseProductProcessingFromXML(
-        const XMLElem elem,
-        ProductProcessing* productProcessing) const
+void DerivedXMLParser::writeDerivedClassification(
+        XMLStreamWriter& writer,
+        const DerivedClassification& classification) const
 {
-    std::vector<XMLElem> procModuleXML;
-    elem->getElementsByTagName("ProcessingModule", procModuleXML);
-    productProcessing->processingModules.resize(procModuleXML.size());
-    for (size_t i = 0, size = procModuleXML.size(); i < size; ++i)
+    writer.startElement("Classification", getDefaultURI());
+
+    //! from ism:ISMRootNodeAttributeGroup
+    writer.addAttribute("DESVersion", toString(classification.desVersion),
+                        ISM_URI);
+
+    //! from ism:ResourceNodeAttributeGroup
+    writer.addAttribute("resourceElement", "true", ISM_URI);
+    writer.addAttribute("createDate",
+                        classification.createDate.format("%Y-%m-%d"), ISM_URI);
+    // optional
+    addAttributeList(writer, "compliesWith", classification.compliesWith,
+                     ISM_URI);
+
+    //! from ism:SecurityAttributesGroup
+    //  -- referenced in ism::ResourceNodeAttributeGroup
+    writer.addAttribute("classification", classification.classification,
+                        ISM_URI);
+    addAttributeList(writer, "ownerProducer", classification.ownerProducer,
+                     ISM_URI, true);
+    // optional
+    addAttributeList(writer, "SCIcontrols", classification.sciControls,
+                     ISM_URI);
+    // optional
+    addAttributeList(writer, "SARIdentifier", classification.sarIdentifier,
+                     ISM_URI);
+    // optional
+    addAttributeList(writer, "disseminationControls",
+                     classification.disseminationControls, ISM_URI);
+    // optional
+    addAttributeList(writer, "FGIsourceOpen", classification.fgiSourceOpen,
+                     ISM_URI);
+    // optional
+    addAttributeList(writer, "FGIsourceProtected",
+                     classification.fgiSourceProtected, ISM_URI);
+    // optional
+    addAttributeList(writer, "releasableTo", classification.releasableTo,
+                     ISM_URI);
+    // optional
+    addAttributeList(writer, "nonICmarkings", classification.nonICMarkings,
+                     ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "classifiedBy",
+                           classification.classifiedBy, ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "compilationReason",
+                           classification.compilationReason, ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "derivativelyClassifiedBy",
+                           classification.derivativelyClassifiedBy, ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "classificationReason",
+                           classification.classificationReason, ISM_URI);
+    // optional
+    addAttributeList(writer, "nonUSControls", classification.nonUSControls,
+                     ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "derivedFrom",
+                           classification.derivedFrom, ISM_URI);
+    // optional
+    if (classification.declassDate.get())
     {
-        productProcessing->processingModules[i].reset(new ProcessingModule());
-        parseProcessingModuleFromXML(
-                procModuleXML[i],
-                productProcessing->processingModules[i].get());
+        addAttributeIfNonEmpty(
+                writer, "declassDate",
+                classification.declassDate->format("%Y-%m-%d"), ISM_URI);
+    }
+    // optional
+    addAttributeIfNonEmpty(writer, "declassEvent",
+                           classification.declassEvent, ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "declassException",
+                           classification.declassException, ISM_URI);
+    // optional
+    addAttributeIfNonEmpty(writer, "typeOfExemptedSource",
+                           classification.exemptedSourceType, ISM_URI);
+    // optional
+    if (classification.exemptedSourceDate.get())
+    {
+        addAttributeIfNonEmpty(
+                writer, "dateOfExemptedSource",
+                classification.exemptedSourceDate->format("%Y-%m-%d"),
+                ISM_URI);
     }
+
+    common().writeParameters(writer, "SecurityExtension",
+                             classification.securityExtensions);
+
+    writer.endElement();
 }
 
-void DerivedXMLParser::parseDownstreamReprocessingFromXML(
-        const XMLElem elem,
-        DownstreamReprocessing* downstreamReproc) const
+void DerivedXMLParser::writeProductCreation(
+        XMLStreamWriter& writer,
+        const ProductCreation* productCreation) const
 {
-    XMLElem geometricChipXML = getOptional(elem, "GeometricChip");
-    if (geometricChipXML)
-    {
-        downstreamReproc->geometricChip.reset(new GeometricChip());
-        GeometricChip *chip = downstreamReproc->geometricChip.get();
+    writer.startElement("ProductCreation", getDefaultURI());
 
-        common().parseRowColInt(getFirstAndOnly(geometricChipXML, "ChipSize"),
-                                chip->chipSize);
-        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
-                                   "OriginalUpperLeftCoordinate"),
-                                   chip->originalUpperLeftCoordinate);
-        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
-                                   "OriginalUpperRightCoordinate"),
-                                   chip->originalUpperRightCoordinate);
-        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
-                                   "OriginalLowerLeftCoordinate"),
-                                   chip->originalLowerLeftCoordinate);
-        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
-                                   "OriginalLowerRightCoordinate"),
-                                   chip->originalLowerRightCoordinate);
-    }
+    writeProcessorInformation(writer,
+                              productCreation->processorInformation.get());
+    writeDerivedClassification(writer, productCreation->classification);
 
-    std::vector<XMLElem> procEventXML;
-    elem->getElementsByTagName("ProcessingEvent", procEventXML);
-    downstreamReproc->processingEvents.resize(procEventXML.size());
-    for (size_t i = 0, size = procEventXML.size(); i < size; ++i)
+    writeString(writer, "ProductName", productCreation->productName);
+    writeString(writer, "ProductClass", productCreation->productClass);
+
+    // optional
+    if (productCreation->productType != Init::undefined<std::string>())
     {
-        downstreamReproc->processingEvents[i].reset(new ProcessingEvent());
-        ProcessingEvent* procEvent
-                = downstreamReproc->processingEvents[i].get();
+        writeString(writer, "ProductType", productCreation->productType);
+    }
 
-        XMLElem peXML = procEventXML[i];
-        parseString(getFirstAndOnly(peXML, "ApplicationName"),
-                    procEvent->applicationName);
-        parseDateTime(getFirstAndOnly(peXML, "AppliedDateTime"),
-                      procEvent->appliedDateTime);
+    // optional to unbounded
+    common().writeParameters(writer, "ProductCreationExtension",
+                             productCreation->productCreationExtensions);
 
-        // optional
-        XMLElem tmpElem = getOptional(peXML, "InterpolationMethod");
-        if (tmpElem)
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeDisplay(XMLStreamWriter& writer,
+                                    const Display* display) const
+{
+    writer.startElement("Display", getDefaultURI());
+
+    writeString(writer, "PixelType", six::toString(display->pixelType));
+
+    // optional
+    if (display->remapInformation.get())
+    {
+        writer.startElement("RemapInformation", getDefaultURI());
+
+        if (display->remapInformation->displayType == DisplayType::COLOR)
         {
-            parseString(tmpElem, procEvent->interpolationMethod);
+            writer.startElement("ColorDisplayRemap", getDefaultURI());
+            if (display->remapInformation->remapLUT.get())
+                writeLUT(writer, "RemapLUT",
+                         display->remapInformation->remapLUT.get());
+            writer.endElement();
         }
-
-        // optional to unbounded
-        common().parseParameters(peXML, "Descriptor", procEvent->descriptor);
+        else if (display->remapInformation->displayType == DisplayType::MONO)
+        {
+            writer.startElement("MonochromeDisplayRemap", getDefaultURI());
+            // a little risky, but let's assume the displayType is correct
+            const MonochromeDisplayRemap* mdr =
+                    (const MonochromeDisplayRemap*)
+                            display->remapInformation.get();
+            writeString(writer, "RemapType", mdr->remapType);
+            if (mdr->remapLUT.get())
+                writeLUT(writer, "RemapLUT", mdr->remapLUT.get());
+            common().writeParameters(writer, "RemapParameter",
+                                     mdr->remapParameters);
+            writer.endElement();
+        }
+        writer.endElement();
     }
-}
 
-void DerivedXMLParser::parseGeographicCoordinateSystemFromXML(
-        const XMLElem coorSysElem,
-        SFAGeographicCoordinateSystem* coordSys) const
-{
-    parseString(getFirstAndOnly(coorSysElem, "Csname"), coordSys->csName);
-    parseDatum(getFirstAndOnly(coorSysElem, "Datum"), coordSys->datum);
+    // optional
+    if (display->magnificationMethod != MagnificationMethod::NOT_SET)
+    {
+        writeString(writer, "MagnificationMethod",
+                    six::toString(display->magnificationMethod));
+    }
 
-    XMLElem primeXML = getFirstAndOnly(coorSysElem, "PrimeMeridian");
-    parseString(getFirstAndOnly(primeXML, "Name"),
-            coordSys->primeMeridian.name);
-    parseDouble(getFirstAndOnly(primeXML, "Longitude"),
-            coordSys->primeMeridian.longitude);
+    // optional
+    if (display->decimationMethod != DecimationMethod::NOT_SET)
+    {
+        writeString(writer, "DecimationMethod",
+                    six::toString(display->decimationMethod));
+    }
 
-    parseString(getFirstAndOnly(coorSysElem, "AngularUnit"),
-                coordSys->angularUnit);
+    // optional
+    if (display->histogramOverrides.get())
+    {
+        writer.startElement("DRAHistogramOverrides", getDefaultURI());
+        writeInt(writer, "ClipMin", display->histogramOverrides->clipMin);
+        writeInt(writer, "ClipMax", display->histogramOverrides->clipMax);
+        writer.endElement();
+    }
 
     // optional
-    XMLElem luXML = getOptional(coorSysElem, "LinearUnit");
-    if (luXML)
-        parseString(luXML, coordSys->linearUnit);
+    if (display->monitorCompensationApplied.get())
+    {
+        writer.startElement("MonitorCompensationApplied", getDefaultURI());
+        writeDouble(writer, "Gamma",
+                    display->monitorCompensationApplied->gamma);
+        writeDouble(writer, "XMin", display->monitorCompensationApplied->xMin);
+        writer.endElement();
+    }
+
+    // optional to unbounded
+    common().writeParameters(writer, "DisplayExtension",
+                             display->displayExtensions);
+
+    writer.endElement();
 }
 
-void DerivedXMLParser::parseAnnotationFromXML(
-        const XMLElem elem,
-        Annotation *a) const
+void DerivedXMLParser::writeGeographicTarget(
+        XMLStreamWriter& writer,
+        const GeographicAndTarget* geographicAndTarget) const
 {
-    parseString(getFirstAndOnly(elem, "Identifier"), a->identifier);
+    writer.startElement("GeographicAndTarget", getDefaultURI());
+    writeGeographicCoverage(writer, "GeographicCoverage",
+                            &geographicAndTarget->geographicCoverage);
 
-    XMLElem spatialXML = getOptional(elem, "SpatialReferenceSystem");
-    if (spatialXML)
+    // optional to unbounded
+    for (std::vector<mem::ScopedCopyablePtr<TargetInformation> >::
+            const_iterator it = geographicAndTarget->targetInformation.begin();
+            it != geographicAndTarget->targetInformation.end(); ++it)
     {
-        a->spatialReferenceSystem.reset(new six::sidd::SFAReferenceSystem());
+        const TargetInformation* ti = (*it).get();
+        writer.startElement("TargetInformation", getDefaultURI());
 
-        // choice
-        XMLElem tmpXML = getOptional(spatialXML,
-                                     "ProjectedCoordinateSystem");
-        if (tmpXML)
+        // 1 to unbounded
+        common().writeParameters(writer, "Identifier", ti->identifiers);
+
+        // optional
+        if (ti->footprint.get())
         {
-            a->spatialReferenceSystem->coordinateSystem.reset(
-                    new SFAProjectedCoordinateSystem());
+            writeFootprint(writer, "Footprint", "Vertex", *ti->footprint);
+        }
 
-            SFAProjectedCoordinateSystem* coordSys =
-                    (SFAProjectedCoordinateSystem*)
-                            a->spatialReferenceSystem->coordinateSystem.get();
+        // optional to unbounded
+        common().writeParameters(writer, "TargetInformationExtension",
+                                 ti->targetInformationExtensions);
+        writer.endElement();
+    }
 
-            parseString(getFirstAndOnly(tmpXML, "Csname"), coordSys->csName);
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeGeographicCoverage(
+        XMLStreamWriter& writer,
+        const std::string& localName,
+        const GeographicCoverage* geoCoverage) const
+{
+    //GeographicAndTarget
+    writer.startElement(localName, getDefaultURI());
+
+    // optional to unbounded
+    common().writeParameters(writer, "GeoregionIdentifier",
+                             geoCoverage->georegionIdentifiers);
+    writeFootprint(writer, "Footprint", "Vertex", geoCoverage->footprint);
+
+    // GeographicInfo
+    if (geoCoverage->geographicInformation.get())
+    {
+        writer.startElement("GeographicInfo", getDefaultURI());
+
+        // optional to unbounded
+        size_t numCC = geoCoverage->geographicInformation->countryCodes.size();
+        for (size_t i = 0; i < numCC; ++i)
+        {
+            writeString(writer, "CountryCode",
+                        geoCoverage->geographicInformation->countryCodes[i]);
+        }
+
+        // optional
+        std::string secInfo
+                = geoCoverage->geographicInformation->securityInformation;
+        str::trim(secInfo);
+        if (!secInfo.empty())
+            writeString(writer, "SecurityInfo", secInfo);
+
+        // optional to unbounded
+        common().writeParameters(writer, "GeographicInfoExtension",
+                                 geoCoverage->geographicInformation->
+                                         geographicInformationExtensions);
+        writer.endElement();
+    }
+    else
+    {
+        //loop over SubRegions
+        for (std::vector<mem::ScopedCopyablePtr<GeographicCoverage> >::
+                const_iterator it = geoCoverage->subRegion.begin();
+                it != geoCoverage->subRegion.end(); ++it)
+        {
+            writeGeographicCoverage(writer, "SubRegion", (*it).get());
+        }
+    }
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeMeasurement(
+        XMLStreamWriter& writer,
+        const Measurement* measurement) const
+{
+    writer.startElement("Measurement", getDefaultURI());
+
+    std::string projectionName;
+    switch (measurement->projection->projectionType)
+    {
+    case ProjectionType::POLYNOMIAL:
+        projectionName = "PolynomialProjection";
+        break;
+    case ProjectionType::GEOGRAPHIC:
+        projectionName = "GeographicProjection";
+        break;
+    case ProjectionType::PLANE:
+        projectionName = "PlaneProjection";
+        break;
+    case ProjectionType::CYLINDRICAL:
+        projectionName = "CylindricalProjection";
+        break;
+    default:
+        throw except::Exception(Ctxt("Unknown projection type!"));
+    }
+    writer.startElement(projectionName, getDefaultURI());
+
+    // NOTE: ReferencePoint is present in all of the ProjectionTypes
+    //       so its added here for ease
+    writer.startElement("ReferencePoint", getDefaultURI());
+    if (measurement->projection->referencePoint.name
+            != Init::undefined<std::string>())
+    {
+        writer.addAttribute("name",
+                            measurement->projection->referencePoint.name);
+    }
+    common().writeVector3D(writer, "ECEF", common().getSICommonURI(),
+                           measurement->projection->referencePoint.ecef);
+    common().writeRowCol(writer, "Point", common().getSICommonURI(),
+                         measurement->projection->referencePoint.rowCol);
+    writer.endElement();
+
+    switch (measurement->projection->projectionType)
+    {
+    case ProjectionType::POLYNOMIAL:
+    {
+        const PolynomialProjection* polyProj
+                = (const PolynomialProjection*) measurement->projection.get();
+
+        common().writePoly2D(writer, "RowColToLat", polyProj->rowColToLat);
+        common().writePoly2D(writer, "RowColToLon", polyProj->rowColToLon);
+
+        // optional
+        if (polyProj->rowColToAlt != Init::undefined<Poly2D>())
+        {
+            common().writePoly2D(writer, "RowColToAlt", polyProj->rowColToAlt);
+        }
+
+        common().writePoly2D(writer, "LatLonToRow", polyProj->latLonToRow);
+        common().writePoly2D(writer, "LatLonToCol", polyProj->latLonToCol);
+    }
+        break;
+
+    case ProjectionType::GEOGRAPHIC:
+    {
+        const GeographicProjection* geographicProj
+                = (const GeographicProjection*) measurement->projection.get();
+
+        common().writeRowCol(writer, "SampleSpacing",
+                             geographicProj->sampleSpacing);
+        common().writePoly2D(writer, "TimeCOAPoly",
+                             geographicProj->timeCOAPoly);
+    }
+        break;
+
+    case ProjectionType::PLANE:
+    {
+        const PlaneProjection* planeProj
+                = (const PlaneProjection*) measurement->projection.get();
+
+        common().writeRowCol(writer, "SampleSpacing",
+                             planeProj->sampleSpacing);
+        common().writePoly2D(writer, "TimeCOAPoly", planeProj->timeCOAPoly);
+
+        writer.startElement("ProductPlane", getDefaultURI());
+        common().writeVector3D(writer, "RowUnitVector",
+                               planeProj->productPlane.rowUnitVector);
+        common().writeVector3D(writer, "ColUnitVector",
+                               planeProj->productPlane.colUnitVector);
+        writer.endElement();
+    }
+        break;
+
+    case ProjectionType::CYLINDRICAL:
+    {
+        const CylindricalProjection* cylindricalProj
+                = (const CylindricalProjection*) measurement->projection.get();
+
+        common().writeRowCol(writer, "SampleSpacing",
+                             cylindricalProj->sampleSpacing);
+        common().writePoly2D(writer, "TimeCOAPoly",
+                             cylindricalProj->timeCOAPoly);
+        common().writeVector3D(writer, "StripmapDirection",
+                               cylindricalProj->stripmapDirection);
+        // optional
+        if (cylindricalProj->curvatureRadius != Init::undefined<double>())
+        {
+            writeDouble(writer, "CurvatureRadius",
+                        cylindricalProj->curvatureRadius);
+        }
+    }
+        break;
+
+    default:
+        throw except::Exception(Ctxt("Unknown projection type!"));
+    }
+    writer.endElement();
+
+    common().writeRowCol(writer, "PixelFootprint",
+                         measurement->pixelFootprint);
+    common().writePolyXYZ(writer, "ARPPoly", measurement->arpPoly);
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeExploitationFeatures(
+        XMLStreamWriter& writer,
+        const ExploitationFeatures* exploitationFeatures) const
+{
+    writer.startElement("ExploitationFeatures", getDefaultURI());
+
+    if (exploitationFeatures->collections.size() < 1)
+    {
+        throw except::Exception(Ctxt(FmtX(
+                "ExploitationFeatures must have at least [1] Collection, " \
+                "only [%d] found", exploitationFeatures->collections.size())));
+    }
+
+    const std::string si = common().getSICommonURI();
+
+    // 1 to unbounded
+    for (size_t i = 0; i < exploitationFeatures->collections.size(); ++i)
+    {
+        const Collection* collection =
+                exploitationFeatures->collections[i].get();
+        writer.startElement("Collection", getDefaultURI());
+        writer.addAttribute("identifier", collection->identifier);
+
+        // create Information
+        writer.startElement("Information", getDefaultURI());
+
+        writeString(writer, "SensorName",
+                    collection->information->sensorName);
+        writer.startElement("RadarMode", getDefaultURI());
+        writeString(writer, "ModeType", si,
+                    six::toString(collection->information->radarMode));
+        // optional
+        if (collection->information->radarModeID
+                != Init::undefined<std::string>())
+            writeString(writer, "ModeID", si,
+                        collection->information->radarModeID);
+        writer.endElement();
+        writeDateTime(writer, "CollectionDateTime",
+                      collection->information->collectionDateTime);
+        // optional
+        if (collection->information->localDateTime != Init::undefined<
+                std::string>())
+        {
+            writeDateTime(writer, "LocalDateTime",
+                          collection->information->localDateTime);
+        }
+        writeDouble(writer, "CollectionDuration",
+                    collection->information->collectionDuration);
+        // optional
+        if (!Init::isUndefined(collection->information->resolution))
+        {
+            common().writeRangeAzimuth(writer, "Resolution",
+                                       collection->information->resolution);
+        }
+        // optional
+        if (collection->information->inputROI.get())
+        {
+            writer.startElement("InputROI", getDefaultURI());
+            common().writeRowCol(writer, "Size",
+                                 collection->information->inputROI->size);
+            common().writeRowCol(writer, "UpperLeft",
+                                 collection->information->inputROI->upperLeft);
+            writer.endElement();
+        }
+        // optional to unbounded
+        for (size_t n = 0, nElems =
+                collection->information->polarization.size(); n < nElems; ++n)
+        {
+            const TxRcvPolarization *p =
+                    collection->information->polarization[n].get();
+            writer.startElement("Polarization", getDefaultURI());
+
+            writeString(writer, "TxPolarization",
+                        six::toString(p->txPolarization));
+            writeString(writer, "RcvPolarization",
+                        six::toString(p->rcvPolarization));
+            // optional
+            if (!Init::isUndefined(p->rcvPolarizationOffset))
+            {
+                writeDouble(writer, "RcvPolarizationOffset",
+                            p->rcvPolarizationOffset);
+            }
+            // optional
+            if (!Init::isUndefined(p->processed))
+            {
+                writeString(writer, "Processed", six::toString(p->processed));
+            }
+            writer.endElement();
+        }
+        writer.endElement();
+
+        // create Geometry -- optional
+        const Geometry* geom = collection->geometry.get();
+        if (geom != NULL)
+        {
+            writer.startElement("Geometry", getDefaultURI());
+
+            // optional
+            if (geom->azimuth != Init::undefined<double>())
+                writeDouble(writer, "Azimuth", geom->azimuth);
+            // optional
+            if (geom->slope != Init::undefined<double>())
+                writeDouble(writer, "Slope", geom->slope);
+            // optional
+            if (geom->squint != Init::undefined<double>())
+                writeDouble(writer, "Squint", geom->squint);
+            // optional
+            if (geom->graze != Init::undefined<double>())
+                writeDouble(writer, "Graze", geom->graze);
+            // optional
+            if (geom->tilt != Init::undefined<double>())
+                writeDouble(writer, "Tilt", geom->tilt);
+            // optional to unbounded
+            common().writeParameters(writer, "Extension", geom->extensions);
+            writer.endElement();
+        }
+
+        // create Phenomenology -- optional
+        const Phenomenology* phenom = collection->phenomenology.get();
+        if (phenom != NULL)
+        {
+            writer.startElement("Phenomenology", getDefaultURI());
+
+            // optional
+            if (phenom->shadow != Init::undefined<AngleMagnitude>())
+            {
+                writer.startElement("Shadow", getDefaultURI());
+                writeDouble(writer, "Angle", si, phenom->shadow.angle);
+                writeDouble(writer, "Magnitude", si, phenom->shadow.magnitude);
+                writer.endElement();
+            }
+            // optional
+            if (phenom->layover != Init::undefined<AngleMagnitude>())
+            {
+                writer.startElement("Layover", getDefaultURI());
+                writeDouble(writer, "Angle", si, phenom->layover.angle);
+                writeDouble(writer, "Magnitude", si,
+                            phenom->layover.magnitude);
+                writer.endElement();
+            }
+            // optional
+            if (phenom->multiPath != Init::undefined<double>())
+                writeDouble(writer, "MultiPath", phenom->multiPath);
+            // optional
+            if (phenom->groundTrack != Init::undefined<double>())
+                writeDouble(writer, "GroundTrack", phenom->groundTrack);
+            // optional to unbounded
+            common().writeParameters(writer, "Extension", phenom->extensions);
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+
+    // create Product
+    writer.startElement("Product", getDefaultURI());
+
+    common().writeRowCol(writer, "Resolution",
+                         exploitationFeatures->product.resolution);
+    // optional
+    if (exploitationFeatures->product.north != Init::undefined<double>())
+        writeDouble(writer, "North", exploitationFeatures->product.north);
+    // optional to unbounded
+    common().writeParameters(writer, "Extension",
+                             exploitationFeatures->product.extensions);
+    writer.endElement();
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeLUT(XMLStreamWriter& writer,
+                                const std::string& name,
+                                const LUT *lut) const
+{
+    writer.startElement(name, getDefaultURI());
+    writer.addAttribute("size", str::toString(lut->numEntries));
+
+    std::ostringstream oss;
+    for (unsigned int i = 0; i < lut->numEntries; ++i)
+    {
+        if (lut->elementSize == 2)
+        {
+            const short* idx = (const short*) (*lut)[i];
+            oss << *idx;
+        }
+        else if (lut->elementSize == 3)
+        {
+            oss << (unsigned int) (*lut)[i][0] << ','
+                    << (unsigned int) (*lut)[i][1] << ','
+                    << (unsigned int) (*lut)[i][2];
+        }
+        else
+        {
+            throw except::Exception(Ctxt(FmtX("Invalid element size [%d]",
+                                              lut->elementSize)));
+        }
+        if ((lut->numEntries - 1) != i)
+            oss << ' ';
+    }
+    writer.addCharacters(oss.str());
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeFootprint(XMLStreamWriter& writer,
+                                      const std::string& name,
+                                      const std::string& cornerName,
+                                      const LatLonCorners& corners) const
+{
+    writer.startElement(name, getDefaultURI());
+    writer.addAttribute("size", str::toString(LatLonCorners::NUM_CORNERS));
+
+    // Write the corners out in CW order
+    // The index attribute is 1-based
+    for (size_t corner = 0; corner < LatLonCorners::NUM_CORNERS; ++corner)
+    {
+        writer.addAttributeToNext("index", str::toString(corner + 1));
+        common().writeLatLon(writer, cornerName, corners.getCorner(corner));
+    }
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeSFADatum(XMLStreamWriter& writer,
+                                     const std::string& name,
+                                     const six::sidd::SFADatum& datum) const
+{
+    writer.startElement(name, SFA_URI);
+
+    writer.startElement("Spheroid", SFA_URI);
+    writeString(writer, "SpheriodName", SFA_URI, datum.spheroid.name);
+    writeDouble(writer, "SemiMajorAxis", SFA_URI,
+                datum.spheroid.semiMajorAxis);
+    writeDouble(writer, "InverseFlattening", SFA_URI,
+                datum.spheroid.inverseFlattening);
+    writer.endElement();
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeProductProcessing(
+        XMLStreamWriter& writer,
+        const ProductProcessing* productProcessing) const
+{
+    writer.startElement("ProductProcessing", getDefaultURI());
+
+    // error checking
+    if (productProcessing->processingModules.size() < 1)
+    {
+        throw except::Exception(Ctxt(FmtX(
+                "There must be at least [1] ProcessingModule in "\
+                "ProductProcessing, [%d] found",
+                productProcessing->processingModules.size())));
+    }
+
+    // one to unbounded
+    for (std::vector<mem::ScopedCloneablePtr<ProcessingModule> >::
+            const_iterator it = productProcessing->processingModules.begin();
+            it != productProcessing->processingModules.end(); ++it)
+    {
+        writeProcessingModule(writer, (*it).get());
+    }
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeProcessingModule(
+        XMLStreamWriter& writer,
+        const ProcessingModule* procMod) const
+{
+    writer.startElement("ProcessingModule", getDefaultURI());
+
+    common().writeParameter(writer, "ModuleName", procMod->moduleName);
+
+    // optional choice
+    if (!procMod->processingModules.empty())
+    {
+        // one to unbounded
+        for (std::vector<mem::ScopedCloneablePtr<ProcessingModule> >::
+                const_iterator it = procMod->processingModules.begin();
+                it != procMod->processingModules.end(); ++it)
+        {
+            writeProcessingModule(writer, (*it).get());
+        }
+    }
+    else if (!procMod->moduleParameters.empty())
+    {
+        common().writeParameters(writer, "ModuleParameter",
+                                 procMod->moduleParameters);
+    }
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeDownstreamReprocessing(
+        XMLStreamWriter& writer,
+        const DownstreamReprocessing* downstreamReproc) const
+{
+    writer.startElement("DownstreamReprocessing", getDefaultURI());
+
+    // optional
+    const GeometricChip *geoChip = downstreamReproc->geometricChip.get();
+    if (geoChip)
+    {
+        writer.startElement("GeometricChip", getDefaultURI());
+        common().writeRowCol(writer, "ChipSize", geoChip->chipSize);
+        common().writeRowCol(writer, "OriginalUpperLeftCoordinate",
+                             geoChip->originalUpperLeftCoordinate);
+        common().writeRowCol(writer, "OriginalUpperRightCoordinate",
+                             geoChip->originalUpperRightCoordinate);
+        common().writeRowCol(writer, "OriginalLowerLeftCoordinate",
+                             geoChip->originalLowerLeftCoordinate);
+        common().writeRowCol(writer, "OriginalLowerRightCoordinate",
+                             geoChip->originalLowerRightCoordinate);
+        writer.endElement();
+    }
+    // optional to unbounded
+    for (std::vector<mem::ScopedCopyablePtr<ProcessingEvent> >::
+            const_iterator it = downstreamReproc->processingEvents.begin();
+            it != downstreamReproc->processingEvents.end(); ++it)
+    {
+        const ProcessingEvent *procEvent = (*it).get();
+        writer.startElement("ProcessingEvent", getDefaultURI());
+
+        writeString(writer, "ApplicationName", procEvent->applicationName);
+        writeDateTime(writer, "AppliedDateTime", procEvent->appliedDateTime);
+        // optional
+        if (!procEvent->interpolationMethod.empty())
+        {
+            writeString(writer, "InterpolationMethod",
+                        procEvent->interpolationMethod);
+        }
+        // optional to unbounded
+        common().writeParameters(writer, "Descriptor", procEvent->descriptor);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::parseProcessingModuleFromXML(
+        const XMLElem procXML,
+        ProcessingModule* procMod) const
+{
+    common().parseParameter(getFirstAndOnly(procXML, "ModuleName"),
+                            procMod->moduleName);
+
+    common().parseParameters(procXML, "ModuleParameter", procMod->moduleParameters);
+
+    std::vector<XMLElem> procModuleXML;
+    procXML->getElementsByTagName("ProcessingModule", procModuleXML);
+    procMod->processingModules.resize(procModuleXML.size());
+    for (size_t i = 0, size = procModuleXML.size(); i < size; ++i)
+    {
+        procMod->processingModules[i].reset(new ProcessingModule());
+        parseProcessingModuleFromXML(
+                procModuleXML[i], procMod->processingModules[i].get());
+    }
+}
+
+void DerivedXMLParser::parseProductProcessingFromXML(
+        const XMLElem elem,
+        ProductProcessing* productProcessing) const
+{
+    std::vector<XMLElem> procModuleXML;
+    elem->getElementsByTagName("ProcessingModule", procModuleXML);
+    productProcessing->processingModules.resize(procModuleXML.size());
+    for (size_t i = 0, size = procModuleXML.size(); i < size; ++i)
+    {
+        productProcessing->processingModules[i].reset(new ProcessingModule());
+        parseProcessingModuleFromXML(
+                procModuleXML[i],
+                productProcessing->processingModules[i].get());
+    }
+}
+
+void DerivedXMLParser::parseDownstreamReprocessingFromXML(
+        const XMLElem elem,
+        DownstreamReprocessing* downstreamReproc) const
+{
+    XMLElem geometricChipXML = getOptional(elem, "GeometricChip");
+    if (geometricChipXML)
+    {
+        downstreamReproc->geometricChip.reset(new GeometricChip());
+        GeometricChip *chip = downstreamReproc->geometricChip.get();
+
+        common().parseRowColInt(getFirstAndOnly(geometricChipXML, "ChipSize"),
+                                chip->chipSize);
+        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
+                                   "OriginalUpperLeftCoordinate"),
+                                   chip->originalUpperLeftCoordinate);
+        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
+                                   "OriginalUpperRightCoordinate"),
+                                   chip->originalUpperRightCoordinate);
+        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
+                                   "OriginalLowerLeftCoordinate"),
+                                   chip->originalLowerLeftCoordinate);
+        common().parseRowColDouble(getFirstAndOnly(geometricChipXML,
+                                   "OriginalLowerRightCoordinate"),
+                                   chip->originalLowerRightCoordinate);
+    }
+
+    std::vector<XMLElem> procEventXML;
+    elem->getElementsByTagName("ProcessingEvent", procEventXML);
+    downstreamReproc->processingEvents.resize(procEventXML.size());
+    for (size_t i = 0, size = procEventXML.size(); i < size; ++i)
+    {
+        downstreamReproc->processingEvents[i].reset(new ProcessingEvent());
+        ProcessingEvent* procEvent
+                = downstreamReproc->processingEvents[i].get();
+
+        XMLElem peXML = procEventXML[i];
+        parseString(getFirstAndOnly(peXML, "ApplicationName"),
+                    procEvent->applicationName);
+        parseDateTime(getFirstAndOnly(peXML, "AppliedDateTime"),
+                      procEvent->appliedDateTime);
+
+        // optional
+        XMLElem tmpElem = getOptional(peXML, "InterpolationMethod");
+        if (tmpElem)
+        {
+            parseString(tmpElem, procEvent->interpolationMethod);
+        }
+
+        // optional to unbounded
+        common().parseParameters(peXML, "Descriptor", procEvent->descriptor);
+    }
+}
+
+void DerivedXMLParser::parseGeographicCoordinateSystemFromXML(
+        const XMLElem coorSysElem,
+        SFAGeographicCoordinateSystem* coordSys) const
+{
+    parseString(getFirstAndOnly(coorSysElem, "Csname"), coordSys->csName);
+    parseDatum(getFirstAndOnly(coorSysElem, "Datum"), coordSys->datum);
+
+    XMLElem primeXML = getFirstAndOnly(coorSysElem, "PrimeMeridian");
+    parseString(getFirstAndOnly(primeXML, "Name"),
+            coordSys->primeMeridian.name);
+    parseDouble(getFirstAndOnly(primeXML, "Longitude"),
+            coordSys->primeMeridian.longitude);
+
+    parseString(getFirstAndOnly(coorSysElem, "AngularUnit"),
+                coordSys->angularUnit);
+
+    // optional
+    XMLElem luXML = getOptional(coorSysElem, "LinearUnit");
+    if (luXML)
+        parseString(luXML, coordSys->linearUnit);
+}
+
+void DerivedXMLParser::parseAnnotationFromXML(
+        const XMLElem elem,
+        Annotation *a) const
+{
+    parseString(getFirstAndOnly(elem, "Identifier"), a->identifier);
+
+    XMLElem spatialXML = getOptional(elem, "SpatialReferenceSystem");
+    if (spatialXML)
+    {
+        a->spatialReferenceSystem.reset(new six::sidd::SFAReferenceSystem());
+
+        // choice
+        XMLElem tmpXML = getOptional(spatialXML,
+                                     "ProjectedCoordinateSystem");
+        if (tmpXML)
+        {
+            a->spatialReferenceSystem->coordinateSystem.reset(
+                    new SFAProjectedCoordinateSystem());
+
+            SFAProjectedCoordinateSystem* coordSys =
+                    (SFAProjectedCoordinateSystem*)
+                            a->spatialReferenceSystem->coordinateSystem.get();
+
+            parseString(getFirstAndOnly(tmpXML, "Csname"), coordSys->csName);
 
             coordSys->geographicCoordinateSystem.reset(
                     new SFAGeographicCoordinateSystem());
@@ -2239,6 +3092,127 @@ XMLElem DerivedXMLParser::convertAnnotationToXML(
     return annXML;
 }
 
+void DerivedXMLParser::writeGeographicCoordinateSystem(
+        XMLStreamWriter& writer,
+        const SFAGeographicCoordinateSystem* geographicCoordinateSystem) const
+{
+    writer.startElement("GeographicCoordinateSystem", SFA_URI);
+
+    writeString(writer, "Csname", SFA_URI,
+                geographicCoordinateSystem->csName);
+    writeSFADatum(writer, "Datum", geographicCoordinateSystem->datum);
+
+    writer.startElement("PrimeMeridian", SFA_URI);
+    writeString(writer, "Name", SFA_URI,
+                geographicCoordinateSystem->primeMeridian.name);
+    writeDouble(writer, "Longitude", SFA_URI,
+                geographicCoordinateSystem->primeMeridian.longitude);
+    writer.endElement();
+
+    writeString(writer, "AngularUnit", SFA_URI,
+                geographicCoordinateSystem->angularUnit);
+    writeString(writer, "LinearUnit", SFA_URI,
+                geographicCoordinateSystem->linearUnit);
+
+    writer.endElement();
+}
+
+void DerivedXMLParser::writeAnnotation(XMLStreamWriter& writer,
+                                       const Annotation* a) const
+{
+    writer.startElement("Annotation", getDefaultURI());
+
+    writeString(writer, "Identifier", a->identifier);
+
+    // optional
+    if (a->spatialReferenceSystem.get())
+    {
+        writer.startElement("SpatialReferenceSystem", getDefaultURI());
+
+        if (a->spatialReferenceSystem->coordinateSystem->getType()
+                == six::sidd::SFAProjectedCoordinateSystem::TYPE_NAME)
+        {
+            writer.startElement("ProjectedCoordinateSystem", SFA_URI);
+
+            const SFAProjectedCoordinateSystem* coordSys
+                    = (const SFAProjectedCoordinateSystem*)a->
+                            spatialReferenceSystem->coordinateSystem.get();
+
+            writeString(writer, "Csname", SFA_URI, coordSys->csName);
+
+            writeGeographicCoordinateSystem(
+                    writer, coordSys->geographicCoordinateSystem.get());
+
+            writer.startElement("Projection", SFA_URI);
+            writeString(writer, "ProjectionName", SFA_URI,
+                        coordSys->projection.name);
+            writer.endElement();
+
+            // optional
+            if (!coordSys->parameter.name.empty())
+            {
+                writer.startElement("Parameter", SFA_URI);
+                writeString(writer, "ParameterName", SFA_URI,
+                            coordSys->parameter.name);
+                writeDouble(writer, "Value", SFA_URI,
+                            coordSys->parameter.value);
+                writer.endElement();
+            }
+
+            writeString(writer, "LinearUnit", SFA_URI, coordSys->linearUnit);
+            writer.endElement();
+        }
+        else if (a->spatialReferenceSystem->coordinateSystem->getType()
+                    == six::sidd::SFAGeographicCoordinateSystem::TYPE_NAME)
+        {
+            const SFAGeographicCoordinateSystem* coordSys
+                    = (const SFAGeographicCoordinateSystem*)a->
+                            spatialReferenceSystem->coordinateSystem.get();
+            writeGeographicCoordinateSystem(writer, coordSys);
+        }
+        else if (a->spatialReferenceSystem->coordinateSystem->getType()
+                    == six::sidd::SFAGeocentricCoordinateSystem::TYPE_NAME)
+        {
+            writer.startElement("GeocentricCoordinateSystem", SFA_URI);
+
+            const SFAGeocentricCoordinateSystem* coordSys
+                    = (const SFAGeocentricCoordinateSystem*)a->
+                            spatialReferenceSystem->coordinateSystem.get();
+
+            writeString(writer, "Csname", SFA_URI, coordSys->csName);
+            writeSFADatum(writer, "Datum", coordSys->datum);
+
+            writer.startElement("PrimeMeridian", SFA_URI);
+            writeString(writer, "Name", SFA_URI, coordSys->primeMeridian.name);
+            writeDouble(writer, "Longitude", SFA_URI,
+                        coordSys->primeMeridian.longitude);
+            writer.endElement();
+
+            writeString(writer, "LinearUnit", SFA_URI, coordSys->linearUnit);
+            writer.endElement();
+        }
+
+        // one to unbounded
+        for(size_t ii = 0; ii < a->spatialReferenceSystem->axisNames.size();
+                ++ii)
+        {
+            writeString(writer, "AxisName", SFA_URI,
+                        a->spatialReferenceSystem->axisNames[ii]);
+        }
+        writer.endElement();
+    }
+
+    // one to unbounded
+    for (size_t i = 0, num = a->objects.size(); i < num; ++i)
+    {
+        writer.startElement("Object", getDefaultURI());
+        writeSFAGeometry(writer, a->objects[i].get());
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 void DerivedXMLParser::parseSFAGeometryFromXML(const XMLElem elem, SFAGeometry *g) const
 {
     std::string geoType = g->getType();
@@ -2492,6 +3466,158 @@ XMLElem DerivedXMLParser::convertSFAGeometryToXML(
 
     return geoXML;
 }
+
+void DerivedXMLParser::writeSFAPoint(XMLStreamWriter& writer,
+                                     const std::string& localName,
+                                     const SFAPoint* p) const
+{
+    writer.startElement(localName,
+                        (localName == "Vertex") ? SFA_URI : getDefaultURI());
+
+    writeDouble(writer, "X", SFA_URI, p->x);
+    writeDouble(writer, "Y", SFA_URI, p->y);
+
+    // optional
+    if (!Init::isUndefined(p->z))
+        writeDouble(writer, "Z", SFA_URI, p->z);
+    // optional
+    if (!Init::isUndefined(p->m))
+        writeDouble(writer, "M", SFA_URI, p->m);
+
+    writer.endElement();
 }
+
+void DerivedXMLParser::writeSFALine(XMLStreamWriter& writer,
+                                    const std::string& localName,
+                                    const SFALineString* l) const
+{
+    // error check the vertices
+    if (l->vertices.size() < 2)
+        throw except::Exception(Ctxt(FmtX(
+                "Must be at least two Vertices in LineString. Only [%d] " \
+                "found", l->vertices.size())));
+
+    writer.startElement(localName,
+                        (localName == "Ring") ? SFA_URI : getDefaultURI());
+
+    // two to unbounded
+    for (size_t ii = 0; ii < l->vertices.size(); ++ii)
+    {
+        writeSFAPoint(writer, "Vertex", l->vertices[ii].get());
+    }
+
+    writer.endElement();
 }
 
+void DerivedXMLParser::writeSFAGeometry(XMLStreamWriter& writer,
+                                        const SFAGeometry* g) const
+{
+    std::string geoType = g->getType();
+    if (geoType == SFAPoint::TYPE_NAME)
+    {
+        writeSFAPoint(writer, "Point", (const SFAPoint*) g);
+    }
+    //  LineType, linearRingType, and LineStringType
+    //  all derive from LineStringType
+    else if (geoType == SFALine::TYPE_NAME
+                || geoType == SFALinearRing::TYPE_NAME
+                || geoType == SFALineString::TYPE_NAME)
+    {
+        writeSFALine(writer, geoType, (const SFALineString*) g);
+    }
+    else if (geoType == SFAPolygon::TYPE_NAME)
+    {
+        writer.startElement("Polygon", getDefaultURI());
+
+        const SFAPolygon* p = (const SFAPolygon*) g;
+
+        // one to unbounded
+        for (size_t ii = 0; ii < p->rings.size(); ++ii)
+        {
+            writeSFALine(writer, "Ring", p->rings[ii].get());
+        }
+        writer.endElement();
+    }
+    else if (geoType == SFAPolyhedralSurface::TYPE_NAME)
+    {
+        writer.startElement("PolyhedralSurface", getDefaultURI());
+
+        const SFAPolyhedralSurface* p = (const SFAPolyhedralSurface*) g;
+
+        for (size_t ii = 0; ii < p->patches.size(); ++ii)
+        {
+            writer.startElement("Patch", SFA_URI);
+            for (size_t jj = 0; jj < p->patches[ii]->rings.size(); ++jj)
+            {
+                writeSFALine(writer, "Ring", p->patches[ii]->rings[jj].get());
+            }
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+    else if (geoType == SFAMultiPolygon::TYPE_NAME)
+    {
+        writer.startElement("MultiPolygon", getDefaultURI());
+
+        const SFAMultiPolygon* p = (const SFAMultiPolygon*) g;
+
+        // optional to unbounded
+        for (size_t ii = 0; ii < p->elements.size(); ++ii)
+        {
+            writer.startElement("Element", SFA_URI);
+            for (size_t jj = 0; jj < p->elements[ii]->rings.size(); ++jj)
+            {
+                writeSFALine(writer, "Ring",
+                             p->elements[ii]->rings[jj].get());
+            }
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+    else if (geoType == SFAMultiLineString::TYPE_NAME)
+    {
+        writer.startElement("MultiLineString", getDefaultURI());
+
+        const SFAMultiLineString* p = (const SFAMultiLineString*) g;
+
+        // optional to unbounded
+        for (size_t ii = 0; ii < p->elements.size(); ++ii)
+        {
+            writer.startElement("Element", SFA_URI);
+            for (size_t jj = 0; jj < p->elements[ii]->vertices.size(); ++jj)
+            {
+                writeSFAPoint(writer, "Vertex",
+                              p->elements[ii]->vertices[jj].get());
+            }
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+    else if (geoType == SFAMultiPoint::TYPE_NAME)
+    {
+        const SFAMultiPoint* p = (const SFAMultiPoint*) g;
+
+        // error check the vertices
+        if (p->vertices.size() < 2)
+            throw except::Exception(Ctxt(FmtX(
+                    "Must be at least two Vertices in LineString. Only [%d] " \
+                    "found", p->vertices.size())));
+
+        writer.startElement("MultiPoint", getDefaultURI());
+
+        // two to unbounded
+        for (size_t ii = 0; ii < p->vertices.size(); ++ii)
+        {
+            writeSFAPoint(writer, "Vertex", p->vertices[ii].get());
+        }
+        writer.endElement();
+    }
+    else
+    {
+        throw except::InvalidArgumentException(Ctxt(FmtX(
+                "Invalid geo type: [%s]",
+                geoType.c_str())));
+    }
+}
+}
+}
@@ -0,0 +1,668 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SIX_SIDD_DETECT_SSE2
+#endif
+
+#include <except/Exception.h>
+#include <sys/OS.h>
+#include <mt/ThreadPlanner.h>
+#include <tasks/TaskScheduler.h>
+#include <six/ParallelNITFFileSink.h>
+#include <six/Region.h>
+#include <six/sidd/SIDDByteProvider.h>
+#include <six/sidd/DetectedProductPipeline.h>
+
+namespace
+{
+// Histogram and lookup table bins are the upper 16 bits of a non-negative
+// float, which are monotonic in its value.  Everything above the infinity bin
+// is NaN.
+const size_t NUM_BINS = 0x8000;
+const size_t INFINITY_BIN = 0x7F80;
+
+// Pixels are detected in chunks this size so the magnitudes stay in cache
+const size_t NUM_PIXELS_PER_CHUNK = 4096;
+
+// Below this many pixels per thread, it's faster to stay on one thread
+const size_t MIN_PIXELS_PER_THREAD = 64 * 1024;
+
+inline
+size_t getBin(float value)
+{
+    sys::Uint32_T bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+
+    // Masking off the sign puts -0 in with 0
+    return (bits >> 16) & 0x7FFF;
+}
+
+inline
+double getBinCenter(size_t bin)
+{
+    const sys::Uint32_T bits =
+            (static_cast<sys::Uint32_T>(bin) << 16) | 0x8000;
+    float value;
+    ::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// With SSE2, four pixels at a time: square both halves, shuffle the real and
+// imaginary parts apart, add, and take the square root.  This gives exactly
+// the same results as the scalar loop.
+void detect(const std::complex<float>* input,
+            size_t numPixels,
+            float* output)
+{
+    const float* const in = reinterpret_cast<const float*>(input);
+    size_t ii = 0;
+
+#ifdef SIX_SIDD_DETECT_SSE2
+    for (; ii + 4 <= numPixels; ii += 4)
+    {
+        const __m128 lo = _mm_loadu_ps(in + 2 * ii);
+        const __m128 hi = _mm_loadu_ps(in + 2 * ii + 4);
+        const __m128 loSquared = _mm_mul_ps(lo, lo);
+        const __m128 hiSquared = _mm_mul_ps(hi, hi);
+        const __m128 real = _mm_shuffle_ps(loSquared, hiSquared,
+                                           _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 imag = _mm_shuffle_ps(loSquared, hiSquared,
+                                           _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(output + ii, _mm_sqrt_ps(_mm_add_ps(real, imag)));
+    }
+#endif
+
+    for (; ii < numPixels; ++ii)
+    {
+        const float real = in[2 * ii];
+        const float imag = in[2 * ii + 1];
+        output[ii] = ::sqrtf(real * real + imag * imag);
+    }
+}
+
+template <typename T>
+six::Parameter makeParameter(const std::string& name, const T& value)
+{
+    six::Parameter parameter(value);
+    parameter.setName(name);
+    return parameter;
+}
+
+std::string getRemapTypeName(
+        six::sidd::DetectedProductPipeline::RemapType remapType)
+{
+    return (remapType == six::sidd::DetectedProductPipeline::LINEAR) ?
+            "LINEAR" : "LOGARITHMIC";
+}
+}
+
+namespace six
+{
+namespace sidd
+{
+// Per-thread statistics from the first pass
+struct DetectedProductPipeline::Accumulator
+{
+    Accumulator() :
+        histogram(NUM_BINS),
+        sum(0),
+        min(std::numeric_limits<float>::max()),
+        max(0)
+    {
+    }
+
+    std::vector<sys::Uint64_T> histogram;
+    double sum;
+    float min;
+    float max;
+};
+
+namespace
+{
+class DetectRunnable : public sys::Runnable
+{
+public:
+    DetectRunnable(const std::complex<float>* input,
+                   size_t numPixels,
+                   const std::vector<sys::ubyte>& lut,
+                   sys::ubyte* output,
+                   DetectedProductPipeline::Accumulator* accumulator) :
+        mInput(input),
+        mNumPixels(numPixels),
+        mLUT(lut),
+        mOutput(output),
+        mAccumulator(accumulator)
+    {
+    }
+
+    virtual void run()
+    {
+        float magnitudes[NUM_PIXELS_PER_CHUNK];
+        for (size_t start = 0; start < mNumPixels;
+             start += NUM_PIXELS_PER_CHUNK)
+        {
+            const size_t numPixels =
+                    std::min(NUM_PIXELS_PER_CHUNK, mNumPixels - start);
+            detect(mInput + start, numPixels, magnitudes);
+
+            if (mAccumulator)
+            {
+                accumulate(magnitudes, numPixels);
+            }
+
+            if (mOutput)
+            {
+                sys::ubyte* const output = mOutput + start;
+                for (size_t ii = 0; ii < numPixels; ++ii)
+                {
+                    output[ii] = mLUT[getBin(magnitudes[ii])];
+                }
+            }
+        }
+    }
+
+private:
+    void accumulate(const float* magnitudes, size_t numPixels)
+    {
+        DetectedProductPipeline::Accumulator& accumulator(*mAccumulator);
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            const float magnitude = magnitudes[ii];
+            const size_t bin = getBin(magnitude);
+            ++accumulator.histogram[bin];
+
+            if (bin < INFINITY_BIN)
+            {
+                accumulator.sum += magnitude;
+                accumulator.min = std::min(accumulator.min, magnitude);
+                accumulator.max = std::max(accumulator.max, magnitude);
+            }
+        }
+    }
+
+private:
+    const std::complex<float>* const mInput;
+    const size_t mNumPixels;
+    const std::vector<sys::ubyte>& mLUT;
+    sys::ubyte* const mOutput;
+    DetectedProductPipeline::Accumulator* const mAccumulator;
+};
+}
+
+ReadControlComplexSource::ReadControlComplexSource(ReadControl& reader,
+                                                   size_t imageNumber) :
+    mReader(reader),
+    mImageNumber(imageNumber)
+{
+    const Data* const data = mReader.getContainer()->getData(mImageNumber);
+    if (data->getDataType() != DataType::COMPLEX)
+    {
+        throw except::Exception(Ctxt("Image must be complex"));
+    }
+
+    mDims.row = data->getNumRows();
+    mDims.col = data->getNumCols();
+    mPixelType = data->getPixelType();
+
+    if (mPixelType != PixelType::RE32F_IM32F &&
+        mPixelType != PixelType::RE16I_IM16I)
+    {
+        throw except::Exception(Ctxt(
+                "Unsupported complex pixel type " + mPixelType.toString()));
+    }
+}
+
+void ReadControlComplexSource::read(size_t startRow,
+                                    size_t numRows,
+                                    std::complex<float>* buffer)
+{
+    Region region;
+    region.setStartRow(startRow);
+    region.setNumRows(numRows);
+    region.setStartCol(0);
+    region.setNumCols(mDims.col);
+
+    if (mPixelType == PixelType::RE32F_IM32F)
+    {
+        region.setBuffer(reinterpret_cast<UByte*>(buffer));
+        mReader.interleaved(region, mImageNumber);
+    }
+    else
+    {
+        const size_t numPixels = numRows * mDims.col;
+        mScratch.resize(numPixels * 2);
+        region.setBuffer(reinterpret_cast<UByte*>(&mScratch[0]));
+        mReader.interleaved(region, mImageNumber);
+
+        for (size_t ii = 0; ii < numPixels; ++ii)
+        {
+            buffer[ii] = std::complex<float>(mScratch[2 * ii],
+                                             mScratch[2 * ii + 1]);
+        }
+    }
+}
+
+DetectedProductPipeline::Statistics::Statistics() :
+    numPixels(0),
+    minMagnitude(0),
+    maxMagnitude(0),
+    meanMagnitude(0),
+    lowerClipMagnitude(0),
+    upperClipMagnitude(0)
+{
+}
+
+DetectedProductPipeline::DetectedProductPipeline(ComplexImageSource& source,
+                                                 size_t numThreads,
+                                                 size_t numRowsPerBand) :
+    mSource(source),
+    mDims(source.getDims()),
+    mNumThreads(numThreads == 0 ? sys::OS().getNumCPUs() : numThreads),
+    mNumRowsPerBand(std::max<size_t>(numRowsPerBand, 1)),
+    mRemapType(LINEAR),
+    mLowerClipPercentile(2.0),
+    mUpperClipPercentile(99.0),
+    mHaveStatistics(false)
+{
+    if (mDims.row == 0 || mDims.col == 0)
+    {
+        throw except::Exception(Ctxt("Complex image is empty"));
+    }
+}
+
+void DetectedProductPipeline::setRemap(RemapType remapType,
+                                       double lowerClipPercentile,
+                                       double upperClipPercentile)
+{
+    if (lowerClipPercentile < 0 || upperClipPercentile > 100 ||
+        lowerClipPercentile >= upperClipPercentile)
+    {
+        std::ostringstream ostr;
+        ostr << "Invalid clip percentiles [" << lowerClipPercentile << ", "
+             << upperClipPercentile << "]";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    mRemapType = remapType;
+    mLowerClipPercentile = lowerClipPercentile;
+    mUpperClipPercentile = upperClipPercentile;
+    mHaveStatistics = false;
+}
+
+void DetectedProductPipeline::runBand(
+        size_t numRows,
+        const std::complex<float>* input,
+        sys::ubyte* output,
+        std::vector<Accumulator>* accumulators)
+{
+    const size_t numPixels = numRows * mDims.col;
+    const size_t numThreads = std::max<size_t>(
+            std::min(mNumThreads, numPixels / MIN_PIXELS_PER_THREAD), 1);
+
+    if (numThreads == 1)
+    {
+        DetectRunnable(input, numPixels, mLUT, output,
+                       accumulators ? &(*accumulators)[0] : NULL).run();
+        return;
+    }
+
+    tasks::TaskGroup threads;
+    const mt::ThreadPlanner planner(numPixels, numThreads);
+
+    size_t threadNum(0);
+    size_t startPixel(0);
+    size_t numPixelsThisThread(0);
+    while (planner.getThreadInfo(threadNum, startPixel, numPixelsThisThread))
+    {
+        std::auto_ptr<sys::Runnable> thread(new DetectRunnable(
+                input + startPixel,
+                numPixelsThisThread,
+                mLUT,
+                output ? output + startPixel : NULL,
+                accumulators ? &(*accumulators)[threadNum] : NULL));
+        threads.createTask(thread);
+        ++threadNum;
+    }
+    threads.wait();
+}
+
+const DetectedProductPipeline::Statistics&
+DetectedProductPipeline::computeStatistics()
+{
+    std::vector<Accumulator> accumulators(mNumThreads);
+    for (size_t startRow = 0; startRow < mDims.row;
+         startRow += mNumRowsPerBand)
+    {
+        const size_t numRows = std::min(mNumRowsPerBand,
+                                        mDims.row - startRow);
+        mBand.resize(numRows * mDims.col);
+        mSource.read(startRow, numRows, &mBand[0]);
+        runBand(numRows, &mBand[0], NULL, &accumulators);
+    }
+    mBand.clear();
+
+    // Merge the threads' results
+    Accumulator total;
+    for (size_t ii = 0; ii < accumulators.size(); ++ii)
+    {
+        const Accumulator& accumulator(accumulators[ii]);
+        for (size_t bin = 0; bin < NUM_BINS; ++bin)
+        {
+            total.histogram[bin] += accumulator.histogram[bin];
+        }
+        total.sum += accumulator.sum;
+        total.min = std::min(total.min, accumulator.min);
+        total.max = std::max(total.max, accumulator.max);
+    }
+
+    sys::Uint64_T numPixels(0);
+    for (size_t bin = 0; bin < INFINITY_BIN; ++bin)
+    {
+        numPixels += total.histogram[bin];
+    }
+
+    mStatistics = Statistics();
+    mStatistics.numPixels = static_cast<size_t>(numPixels);
+    if (numPixels > 0)
+    {
+        mStatistics.minMagnitude = total.min;
+        mStatistics.maxMagnitude = total.max;
+        mStatistics.meanMagnitude = total.sum / numPixels;
+
+        // Clip points are the first bins that reach each percentile
+        const double lowerCount = mLowerClipPercentile / 100.0 * numPixels;
+        const double upperCount = mUpperClipPercentile / 100.0 * numPixels;
+        bool haveLower(false);
+        sys::Uint64_T count(0);
+        for (size_t bin = 0; bin < INFINITY_BIN; ++bin)
+        {
+            count += total.histogram[bin];
+            if (!haveLower && count > 0 && count >= lowerCount)
+            {
+                mStatistics.lowerClipMagnitude = getBinCenter(bin);
+                haveLower = true;
+            }
+            if (count > 0 && count >= upperCount)
+            {
+                mStatistics.upperClipMagnitude = getBinCenter(bin);
+                break;
+            }
+        }
+
+        // Bin centers can fall just outside the actual data
+        mStatistics.lowerClipMagnitude = std::min(std::max(
+                mStatistics.lowerClipMagnitude, mStatistics.minMagnitude),
+                mStatistics.maxMagnitude);
+        mStatistics.upperClipMagnitude = std::min(std::max(
+                mStatistics.upperClipMagnitude, mStatistics.minMagnitude),
+                mStatistics.maxMagnitude);
+    }
+
+    buildLUT();
+    mHaveStatistics = true;
+    return mStatistics;
+}
+
+void DetectedProductPipeline::buildLUT()
+{
+    double lower = mStatistics.lowerClipMagnitude;
+    double upper = mStatistics.upperClipMagnitude;
+    if (mRemapType == LOGARITHMIC)
+    {
+        // Anything at or below zero is clipped to the smallest positive
+        // magnitude we could represent
+        const double minPositive = std::numeric_limits<float>::min();
+        lower = 20 * ::log10(std::max(lower, minPositive));
+        upper = 20 * ::log10(std::max(upper, minPositive));
+    }
+    const double range = upper - lower;
+
+    mLUT.resize(NUM_BINS);
+    for (size_t bin = 0; bin < NUM_BINS; ++bin)
+    {
+        if (bin >= INFINITY_BIN)
+        {
+            mLUT[bin] = (bin == INFINITY_BIN) ? 255 : 0;
+            continue;
+        }
+
+        double value = getBinCenter(bin);
+        if (mRemapType == LOGARITHMIC)
+        {
+            value = (value > 0) ? 20 * ::log10(value) :
+                                  -std::numeric_limits<double>::max();
+        }
+
+        double scaled;
+        if (range > 0)
+        {
+            scaled = (value - lower) / range;
+        }
+        else
+        {
+            scaled = (value >= upper) ? 1 : 0;
+        }
+        scaled = std::min(std::max(scaled, 0.0), 1.0);
+        mLUT[bin] = static_cast<sys::ubyte>(scaled * 255 + 0.5);
+    }
+}
+
+void DetectedProductPipeline::checkStatistics() const
+{
+    if (!mHaveStatistics)
+    {
+        throw except::Exception(Ctxt(
+                "computeStatistics() must be called first"));
+    }
+}
+
+const DetectedProductPipeline::Statistics&
+DetectedProductPipeline::getStatistics() const
+{
+    checkStatistics();
+    return mStatistics;
+}
+
+sys::ubyte DetectedProductPipeline::remapMagnitude(float magnitude) const
+{
+    checkStatistics();
+    return mLUT[getBin(magnitude)];
+}
+
+void DetectedProductPipeline::populateDerivedData(DerivedData& data) const
+{
+    checkStatistics();
+
+    if (data.measurement.get() == NULL)
+    {
+        throw except::Exception(Ctxt(
+                "Derived data must have a Measurement"));
+    }
+    data.setNumRows(mDims.row);
+    data.setNumCols(mDims.col);
+
+    if (data.display.get() == NULL)
+    {
+        data.display.reset(new Display());
+    }
+    data.setPixelType(PixelType::MONO8I);
+
+    std::auto_ptr<MonochromeDisplayRemap> remap(
+            new MonochromeDisplayRemap(getRemapTypeName(mRemapType)));
+    remap->remapParameters.push_back(makeParameter(
+            "LowerClipMagnitude", mStatistics.lowerClipMagnitude));
+    remap->remapParameters.push_back(makeParameter(
+            "UpperClipMagnitude", mStatistics.upperClipMagnitude));
+    data.display->remapInformation.reset(remap.release());
+
+    data.display->histogramOverrides.reset(new DRAHistogramOverrides());
+    data.display->histogramOverrides->clipMin =
+            static_cast<int>(mLowerClipPercentile + 0.5);
+    data.display->histogramOverrides->clipMax =
+            static_cast<int>(mUpperClipPercentile + 0.5);
+
+    // Record how the pixels were made
+    std::auto_ptr<ProcessingModule> module(new ProcessingModule());
+    module->moduleName = makeParameter<std::string>("Name", "DetectedRemap");
+    module->moduleParameters.push_back(makeParameter<std::string>(
+            "RemapType", getRemapTypeName(mRemapType)));
+    module->moduleParameters.push_back(makeParameter(
+            "LowerClipPercentile", mLowerClipPercentile));
+    module->moduleParameters.push_back(makeParameter(
+            "UpperClipPercentile", mUpperClipPercentile));
+    module->moduleParameters.push_back(makeParameter(
+            "LowerClipMagnitude", mStatistics.lowerClipMagnitude));
+    module->moduleParameters.push_back(makeParameter(
+            "UpperClipMagnitude", mStatistics.upperClipMagnitude));
+    module->moduleParameters.push_back(makeParameter(
+            "MinMagnitude", mStatistics.minMagnitude));
+    module->moduleParameters.push_back(makeParameter(
+            "MaxMagnitude", mStatistics.maxMagnitude));
+    module->moduleParameters.push_back(makeParameter(
+            "MeanMagnitude", mStatistics.meanMagnitude));
+
+    if (data.productProcessing.get() == NULL)
+    {
+        data.productProcessing.reset(new ProductProcessing());
+    }
+    data.productProcessing->processingModules.push_back(
+            mem::ScopedCloneablePtr<ProcessingModule>(module.release()));
+
+    std::auto_ptr<ProcessingEvent> event(new ProcessingEvent());
+    event->applicationName = "six.sidd DetectedProductPipeline";
+    event->appliedDateTime = DateTime();
+    event->descriptor.push_back(makeParameter<std::string>(
+            "Processing",
+            "Detection and " + getRemapTypeName(mRemapType) +
+                    " remap to 8 bits"));
+
+    if (data.downstreamReprocessing.get() == NULL)
+    {
+        data.downstreamReprocessing.reset(new DownstreamReprocessing());
+    }
+    data.downstreamReprocessing->processingEvents.push_back(
+            mem::ScopedCopyablePtr<ProcessingEvent>(event.release()));
+}
+
+void DetectedProductPipeline::remap(size_t startRow,
+                                    size_t numRows,
+                                    sys::ubyte* output)
+{
+    checkStatistics();
+    if (startRow + numRows > mDims.row)
+    {
+        std::ostringstream ostr;
+        ostr << "Rows [" << startRow << ", " << startRow + numRows
+             << ") are outside the " << mDims.row << " row image";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    mBand.resize(numRows * mDims.col);
+    mSource.read(startRow, numRows, &mBand[0]);
+    runBand(numRows, &mBand[0], output, NULL);
+}
+
+void DetectedProductPipeline::write(const DerivedData& data,
+                                    const std::vector<std::string>& schemaPaths,
+                                    const std::string& pathname,
+                                    size_t numRowsPerBlock,
+                                    size_t numColsPerBlock,
+                                    size_t maxProductSize)
+{
+    checkStatistics();
+    if (data.getNumRows() != mDims.row || data.getNumCols() != mDims.col ||
+        data.getPixelType() != PixelType::MONO8I)
+    {
+        throw except::Exception(Ctxt(
+                "Derived data must be MONO8I and match the complex image "
+                "dimensions"));
+    }
+
+    const SIDDByteProvider provider(data, schemaPaths, numRowsPerBlock,
+                                    numColsPerBlock, maxProductSize);
+    ParallelNITFFileSink sink(provider, pathname);
+
+    // 8-bit pixels don't need to be byte swapped
+    std::vector<sys::ubyte> remapped;
+    if (numRowsPerBlock == 0 && numColsPerBlock == 0)
+    {
+        for (size_t startRow = 0; startRow < mDims.row;
+             startRow += mNumRowsPerBand)
+        {
+            const size_t numRows = std::min(mNumRowsPerBand,
+                                            mDims.row - startRow);
+            remapped.resize(numRows * mDims.col);
+            remap(startRow, numRows, &remapped[0]);
+            sink.write(&remapped[0], startRow, numRows);
+        }
+    }
+    else
+    {
+        // Bands need to be whole rows of blocks within a segment
+        const std::auto_ptr<const nitf::ImageBlocker> blocker =
+                provider.getImageBlocker();
+        std::vector<sys::ubyte> blocked;
+        size_t segStartRow(0);
+        for (size_t seg = 0; seg < blocker->getNumSegments(); ++seg)
+        {
+            const size_t numRowsPerSegBlock =
+                    blocker->getNumRowsPerBlock()[seg];
+            const size_t segEndRow = segStartRow +
+                    blocker->getNumRowsOfBlocks(seg) * numRowsPerSegBlock -
+                    blocker->getNumPadRowsInFinalBlock(seg);
+            const size_t numRowsPerBand = std::max<size_t>(
+                    mNumRowsPerBand / numRowsPerSegBlock, 1) *
+                    numRowsPerSegBlock;
+
+            for (size_t startRow = segStartRow; startRow < segEndRow;
+                 startRow += numRowsPerBand)
+            {
+                const size_t numRows = std::min(numRowsPerBand,
+                                                segEndRow - startRow);
+                remapped.resize(numRows * mDims.col);
+                remap(startRow, numRows, &remapped[0]);
+
+                blocked.resize(blocker->getNumBytesRequired(startRow,
+                                                            numRows,
+                                                            1));
+                blocker->block(&remapped[0], startRow, numRows, 1,
+                               &blocked[0]);
+                sink.write(&blocked[0], startRow, numRows);
+            }
+
+            segStartRow = segEndRow;
+        }
+    }
+    mBand.clear();
+
+    sink.finalize();
+}
+}
+}
@@ -49,6 +49,21 @@ SIDDByteProvider::SIDDByteProvider(
                maxProductSize, numRowsPerBlock, numColsPerBlock);
 }
 
+SIDDByteProvider::SIDDByteProvider(
+        mem::SharedPtr<Container> container,
+        const std::vector<std::string>& schemaPaths,
+        size_t numRowsPerBlock,
+        size_t numColsPerBlock,
+        size_t maxProductSize)
+{
+    XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator(six::DataType::DERIVED,
+                           new six::XMLControlCreatorT<DerivedXMLControl>());
+
+    initialize(container, xmlRegistry, schemaPaths,
+               maxProductSize, numRowsPerBlock, numColsPerBlock);
+}
+
 SIDDByteProvider::SIDDByteProvider(const NITFWriteControl& writer,
                                    const std::vector<std::string>& schemaPaths)
 {
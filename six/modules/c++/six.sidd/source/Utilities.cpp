@@ -495,6 +495,42 @@ Utilities::getProjectionModel(const DerivedData* data)
     return projModel;
 }
 
+std::auto_ptr<scene::RPCFitter>
+Utilities::getRPCFitter(const DerivedData* data,
+                        double heightRange,
+                        size_t numPoints1D,
+                        size_t numHeights)
+{
+    if (data->downstreamReprocessing.get() &&
+        data->downstreamReprocessing->geometricChip.get())
+    {
+        throw except::Exception(Ctxt(
+                "RPC fitting is not supported for geometric chips"));
+    }
+
+    const std::auto_ptr<scene::ProjectionModel> projModel(
+            getProjectionModel(data));
+
+    const six::sidd::MeasurableProjection* const projection =
+            reinterpret_cast<six::sidd::MeasurableProjection*>(
+                    data->measurement->projection.get());
+
+    const types::RowCol<size_t> extent(data->getNumRows(),
+                                       data->getNumCols());
+    const double refHeight = scene::Utilities::ecefToLatLon(
+            projection->referencePoint.ecef).getAlt();
+
+    return std::auto_ptr<scene::RPCFitter>(new scene::RPCFitter(
+            *projModel,
+            projection->referencePoint.rowCol,
+            projection->sampleSpacing,
+            extent,
+            refHeight - heightRange / 2,
+            refHeight + heightRange / 2,
+            numPoints1D,
+            numHeights));
+}
+
 
 std::auto_ptr<DerivedData> Utilities::parseData(
     ::io::InputStream& xmlStream,
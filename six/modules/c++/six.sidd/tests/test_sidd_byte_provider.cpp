@@ -31,6 +31,7 @@
 #include <io/ReadUtils.h>
 #include <math/Round.h>
 #include <six/NITFWriteControl.h>
+#include <six/StagingBufferPool.h>
 #include <six/XMLControlFactory.h>
 #include <six/sidd/Utilities.h>
 #include <six/sidd/DerivedXMLControl.h>
@@ -709,6 +710,236 @@ bool doTests(const std::vector<std::string>& schemaPaths,
     return tester.success();
 }
 
+// Several unrelated SIDD images in one NITF, some with legends, each
+// provided by its own product index with the products and their row bands
+// interleaved in reverse order
+class MultipleProductTester
+{
+public:
+    MultipleProductTester(const std::vector<std::string>& schemaPaths,
+                          size_t numRowsPerBlock,
+                          size_t numColsPerBlock,
+                          size_t maxProductSize) :
+        mSchemaPaths(schemaPaths),
+        mNumRowsPerBlock(numRowsPerBlock),
+        mNumColsPerBlock(numColsPerBlock),
+        mMaxProductSize(maxProductSize),
+        mContainer(new six::Container(six::DataType::DERIVED))
+    {
+        addProduct<sys::Uint8_T>(types::RowCol<size_t>(123, 456), true);
+        addProduct<sys::Uint16_T>(types::RowCol<size_t>(77, 300), false);
+        addProduct<sys::Uint8_T>(types::RowCol<size_t>(50, 456), true);
+    }
+
+    bool run()
+    {
+        const std::string normalPathname("normal_write.nitf");
+        const EnsureFileCleanup normalCleanup(normalPathname);
+        normalWrite(normalPathname);
+        const CompareFiles compareFiles(normalPathname);
+
+        const std::string pathname("streaming_write.nitf");
+        const EnsureFileCleanup cleanup(pathname);
+        bool success = streamingWrite(pathname);
+
+        std::ostringstream prefix;
+        prefix << "Multiple products (max product size " << mMaxProductSize
+               << ", rows/block=" << mNumRowsPerBlock
+               << ", cols/block=" << mNumColsPerBlock << ")";
+        if (!compareFiles(prefix.str(), pathname))
+        {
+            success = false;
+        }
+
+        return success;
+    }
+
+private:
+    template <typename DataTypeT>
+    void addProduct(const types::RowCol<size_t>& dims, bool addLegend)
+    {
+        std::auto_ptr<six::Data> data(createData<DataTypeT>(dims).release());
+
+        std::vector<sys::ubyte> image(dims.area() * sizeof(DataTypeT));
+        for (size_t ii = 0; ii < image.size(); ++ii)
+        {
+            image[ii] = static_cast<sys::ubyte>(rand());
+        }
+        mImages.push_back(image);
+        mNumBytesPerPixel.push_back(sizeof(DataTypeT));
+
+        if (addLegend)
+        {
+            std::auto_ptr<six::Legend> legend(new six::Legend());
+            legend->mType = six::PixelType::MONO8I;
+            legend->mLocation = types::RowCol<size_t>(5, 10);
+            legend->setDims(types::RowCol<size_t>(20, 30));
+            for (size_t ii = 0; ii < legend->mImage.size(); ++ii)
+            {
+                legend->mImage[ii] = static_cast<sys::ubyte>(ii);
+            }
+            mContainer->addData(data, legend);
+        }
+        else
+        {
+            mContainer->addData(data);
+        }
+    }
+
+    void normalWrite(const std::string& pathname)
+    {
+        six::XMLControlRegistry xmlRegistry;
+        xmlRegistry.addCreator(six::DataType::DERIVED,
+                               new six::XMLControlCreatorT<
+                                       six::sidd::DerivedXMLControl>());
+
+        six::Options options;
+        six::ByteProvider::populateOptions(mContainer,
+                                           mMaxProductSize,
+                                           mNumRowsPerBlock,
+                                           mNumColsPerBlock,
+                                           options);
+        six::NITFWriteControl writer(options, mContainer, &xmlRegistry);
+
+        six::BufferList buffers;
+        for (size_t ii = 0; ii < mImages.size(); ++ii)
+        {
+            buffers.push_back(&mImages[ii][0]);
+        }
+        writer.save(buffers, pathname, mSchemaPaths);
+    }
+
+    bool streamingWrite(const std::string& pathname)
+    {
+        const six::sidd::SIDDByteProvider provider(mContainer,
+                                                   mSchemaPaths,
+                                                   mNumRowsPerBlock,
+                                                   mNumColsPerBlock,
+                                                   mMaxProductSize);
+        bool success = true;
+        if (provider.getNumImageProducts() != mImages.size())
+        {
+            std::cerr << "Expected " << mImages.size() << " products but got "
+                      << provider.getNumImageProducts() << std::endl;
+            return false;
+        }
+
+        io::FileOutputStream outStream(pathname);
+        nitf::Off totalNumBytes(0);
+        for (size_t product = mImages.size(); product > 0; --product)
+        {
+            const size_t productIdx = product - 1;
+            const size_t numRows = provider.getNumRows(productIdx);
+            const size_t numCols = provider.getNumCols(productIdx);
+            const size_t numBytesPerRow =
+                    numCols * mNumBytesPerPixel[productIdx];
+            const sys::ubyte* const image = &mImages[productIdx][0];
+
+            if (mNumRowsPerBlock != 0 || mNumColsPerBlock != 0)
+            {
+                // Block the whole product and provide it in one shot
+                std::vector<sys::ubyte> bigEndian(mImages[productIdx]);
+                if (!sys::isBigEndianSystem())
+                {
+                    sys::byteSwap(&bigEndian[0],
+                                  static_cast<unsigned short>(
+                                          mNumBytesPerPixel[productIdx]),
+                                  bigEndian.size() /
+                                          mNumBytesPerPixel[productIdx]);
+                }
+
+                std::auto_ptr<const nitf::ImageBlocker> imageBlocker =
+                        provider.getImageBlocker(productIdx);
+                std::vector<sys::ubyte> blocked(
+                        imageBlocker->getNumBytesRequired(
+                                0, numRows, mNumBytesPerPixel[productIdx]));
+                imageBlocker->block(&bigEndian[0], 0, numRows,
+                                    mNumBytesPerPixel[productIdx],
+                                    &blocked[0]);
+
+                nitf::Off fileOffset;
+                nitf::NITFBufferList buffers;
+                provider.getBytes(productIdx, &blocked[0], 0, numRows,
+                                  fileOffset, buffers);
+                const nitf::Off numBytes =
+                        provider.getNumBytes(productIdx, 0, numRows);
+                success &= write(fileOffset, buffers, numBytes, outStream);
+                totalNumBytes += numBytes;
+            }
+            else
+            {
+                // Bands of native endian rows from the bottom up
+                const size_t numRowsPerBand = 10;
+                six::StagingBuffer staging;
+                for (size_t endRow = numRows; endRow > 0; )
+                {
+                    const size_t startRow = (endRow > numRowsPerBand) ?
+                            endRow - numRowsPerBand : 0;
+
+                    nitf::Off fileOffset;
+                    nitf::NITFBufferList buffers;
+                    provider.getBytes(productIdx,
+                                      image + startRow * numBytesPerRow,
+                                      startRow,
+                                      endRow - startRow,
+                                      fileOffset,
+                                      buffers,
+                                      staging);
+                    const nitf::Off numBytes = provider.getNumBytes(
+                            productIdx, startRow, endRow - startRow);
+                    success &= write(fileOffset, buffers, numBytes, outStream);
+                    totalNumBytes += numBytes;
+
+                    endRow = startRow;
+                }
+            }
+        }
+        outStream.close();
+
+        if (totalNumBytes != provider.getFileNumBytes())
+        {
+            std::cerr << "Wrote " << totalNumBytes << " bytes but the file has "
+                      << provider.getFileNumBytes() << std::endl;
+            success = false;
+        }
+
+        return success;
+    }
+
+    static bool write(nitf::Off fileOffset,
+                      const nitf::NITFBufferList& buffers,
+                      nitf::Off computedNumBytes,
+                      io::FileOutputStream& outStream)
+    {
+        outStream.seek(fileOffset, io::Seekable::START);
+        for (size_t ii = 0; ii < buffers.mBuffers.size(); ++ii)
+        {
+            outStream.write(
+                    static_cast<const sys::byte*>(buffers.mBuffers[ii].mData),
+                    buffers.mBuffers[ii].mNumBytes);
+        }
+
+        if (buffers.getTotalNumBytes() !=
+                static_cast<size_t>(computedNumBytes))
+        {
+            std::cerr << "Computed " << computedNumBytes
+                      << " bytes but actually had "
+                      << buffers.getTotalNumBytes() << " bytes" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+private:
+    const std::vector<std::string> mSchemaPaths;
+    const size_t mNumRowsPerBlock;
+    const size_t mNumColsPerBlock;
+    const size_t mMaxProductSize;
+    mem::SharedPtr<six::Container> mContainer;
+    std::vector<std::vector<sys::ubyte> > mImages;
+    std::vector<size_t> mNumBytesPerPixel;
+};
+
 bool doTestsBothDataTypes(const std::vector<std::string>& schemaPaths,
                           bool setMaxProductSize,
                           size_t numRowsPerSeg = 0)
@@ -772,6 +1003,20 @@ int main(int /*argc*/, char** /*argv*/)
             }
         }
 
+        // Several products in one NITF, both unsegmented and segmented, and
+        // blocked
+        const size_t maxProductSizes[] = {0, 30 * 456 + 2 * 1024};
+        for (size_t ii = 0; ii < 2; ++ii)
+        {
+            if (!MultipleProductTester(schemaPaths, 0, 0,
+                                       maxProductSizes[ii]).run() ||
+                !MultipleProductTester(schemaPaths, 7, 9,
+                                       maxProductSizes[ii]).run())
+            {
+                success = false;
+            }
+        }
+
         // With any luck we passed
         if (success)
         {
@@ -0,0 +1,411 @@
+/* =========================================================================
+* This file is part of six.sidd-c++
+* =========================================================================
+*
+* (C) Copyright 2004 - 2018, MDA Information Systems LLC
+*
+* six-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <math.h>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+#include "TestCase.h"
+
+#include <sys/OS.h>
+#include <six/NITFReadControl.h>
+#include <six/XMLControlFactory.h>
+#include <six/sidd/DerivedXMLControl.h>
+#include <six/sidd/DetectedProductPipeline.h>
+#include <six/sidd/Utilities.h>
+
+namespace
+{
+// In-memory complex image.  Pixels are multiples of (3, 4) so the
+// magnitudes are exact.
+class MemoryComplexSource : public six::sidd::ComplexImageSource
+{
+public:
+    MemoryComplexSource(const types::RowCol<size_t>& dims) :
+        mDims(dims),
+        mImage(dims.area()),
+        mNumReads(0)
+    {
+        for (size_t ii = 0; ii < mImage.size(); ++ii)
+        {
+            const float scale = static_cast<float>((ii * 37) % 1001);
+            mImage[ii] = std::complex<float>(3 * scale, -4 * scale);
+        }
+    }
+
+    virtual types::RowCol<size_t> getDims() const
+    {
+        return mDims;
+    }
+
+    virtual void read(size_t startRow,
+                      size_t numRows,
+                      std::complex<float>* buffer)
+    {
+        std::copy(mImage.begin() + startRow * mDims.col,
+                  mImage.begin() + (startRow + numRows) * mDims.col,
+                  buffer);
+        ++mNumReads;
+    }
+
+    float getMagnitude(size_t ii) const
+    {
+        const float real = mImage[ii].real();
+        const float imag = mImage[ii].imag();
+        return ::sqrtf(real * real + imag * imag);
+    }
+
+    const types::RowCol<size_t> mDims;
+    std::vector<std::complex<float> > mImage;
+    size_t mNumReads;
+};
+
+class EnsureFileCleanup
+{
+public:
+    EnsureFileCleanup(const std::string& pathname) :
+        mPathname(pathname)
+    {
+    }
+
+    ~EnsureFileCleanup()
+    {
+        try
+        {
+            sys::OS os;
+            if (os.exists(mPathname))
+            {
+                os.remove(mPathname);
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+
+private:
+    const std::string mPathname;
+};
+
+std::vector<sys::ubyte> remapAll(six::sidd::DetectedProductPipeline& pipeline,
+                                 const types::RowCol<size_t>& dims)
+{
+    std::vector<sys::ubyte> remapped(dims.area());
+    pipeline.remap(0, dims.row, &remapped[0]);
+    return remapped;
+}
+
+void readBack(const std::string& pathname,
+              std::auto_ptr<six::sidd::DerivedData>& data,
+              std::vector<sys::ubyte>& image)
+{
+    six::XMLControlRegistry xmlRegistry;
+    xmlRegistry.addCreator(six::DataType::DERIVED,
+                           new six::XMLControlCreatorT<
+                                   six::sidd::DerivedXMLControl>());
+
+    six::NITFReadControl reader;
+    reader.setXMLControlRegistry(&xmlRegistry);
+    reader.load(pathname);
+
+    data.reset(static_cast<six::sidd::DerivedData*>(
+            reader.getContainer()->getData(0)->clone()));
+
+    image.resize(data->getNumRows() * data->getNumCols());
+    six::Region region;
+    region.setBuffer(&image[0]);
+    reader.interleaved(region, 0);
+}
+
+TEST_CASE(testStatistics)
+{
+    const types::RowCol<size_t> dims(123, 457);
+    MemoryComplexSource source(dims);
+    six::sidd::DetectedProductPipeline pipeline(source, 1, 10);
+
+    TEST_EXCEPTION(pipeline.getStatistics());
+
+    const six::sidd::DetectedProductPipeline::Statistics& stats =
+            pipeline.computeStatistics();
+
+    // Bands of 10 rows
+    TEST_ASSERT_EQ(source.mNumReads, 13);
+
+    std::vector<float> magnitudes(dims.area());
+    double sum(0);
+    for (size_t ii = 0; ii < magnitudes.size(); ++ii)
+    {
+        magnitudes[ii] = source.getMagnitude(ii);
+        sum += magnitudes[ii];
+    }
+    std::sort(magnitudes.begin(), magnitudes.end());
+
+    TEST_ASSERT_EQ(stats.numPixels, dims.area());
+    TEST_ASSERT_EQ(stats.minMagnitude, magnitudes.front());
+    TEST_ASSERT_EQ(stats.maxMagnitude, magnitudes.back());
+    TEST_ASSERT_ALMOST_EQ_EPS(stats.meanMagnitude, sum / dims.area(), 1e-6);
+
+    // The clip points are within a histogram bin of the actual percentiles
+    const double lower = magnitudes[dims.area() * 2 / 100];
+    const double upper = magnitudes[dims.area() * 99 / 100];
+    TEST_ASSERT_ALMOST_EQ_EPS(stats.lowerClipMagnitude, lower, lower * 0.01);
+    TEST_ASSERT_ALMOST_EQ_EPS(stats.upperClipMagnitude, upper, upper * 0.01);
+
+    // Threads and band sizes don't change anything
+    MemoryComplexSource otherSource(dims);
+    six::sidd::DetectedProductPipeline otherPipeline(otherSource, 4, 1000);
+    const six::sidd::DetectedProductPipeline::Statistics& otherStats =
+            otherPipeline.computeStatistics();
+    TEST_ASSERT_EQ(otherSource.mNumReads, 1);
+    TEST_ASSERT_EQ(otherStats.numPixels, stats.numPixels);
+    TEST_ASSERT_EQ(otherStats.minMagnitude, stats.minMagnitude);
+    TEST_ASSERT_EQ(otherStats.maxMagnitude, stats.maxMagnitude);
+    TEST_ASSERT_EQ(otherStats.lowerClipMagnitude, stats.lowerClipMagnitude);
+    TEST_ASSERT_EQ(otherStats.upperClipMagnitude, stats.upperClipMagnitude);
+}
+
+TEST_CASE(testLinearRemap)
+{
+    // Big enough to use multiple threads
+    const types::RowCol<size_t> dims(300, 1000);
+    MemoryComplexSource source(dims);
+    six::sidd::DetectedProductPipeline pipeline(source, 4);
+    pipeline.setRemap(six::sidd::DetectedProductPipeline::LINEAR, 5, 95);
+    const six::sidd::DetectedProductPipeline::Statistics& stats =
+            pipeline.computeStatistics();
+
+    const std::vector<sys::ubyte> remapped(remapAll(pipeline, dims));
+    const double range = stats.upperClipMagnitude - stats.lowerClipMagnitude;
+    for (size_t ii = 0; ii < remapped.size(); ++ii)
+    {
+        const float magnitude = source.getMagnitude(ii);
+        TEST_ASSERT_EQ(remapped[ii], pipeline.remapMagnitude(magnitude));
+
+        if (magnitude <= stats.lowerClipMagnitude * 0.99)
+        {
+            TEST_ASSERT_EQ(remapped[ii], 0);
+        }
+        else if (magnitude >= stats.upperClipMagnitude * 1.01)
+        {
+            TEST_ASSERT_EQ(remapped[ii], 255);
+        }
+        else
+        {
+            const double expected = std::min(std::max(
+                    (magnitude - stats.lowerClipMagnitude) / range, 0.0),
+                    1.0) * 255;
+            TEST_ASSERT_ALMOST_EQ_EPS(remapped[ii], expected, 2.5);
+        }
+    }
+
+    // Same answer on one thread
+    MemoryComplexSource otherSource(dims);
+    six::sidd::DetectedProductPipeline otherPipeline(otherSource, 1);
+    otherPipeline.setRemap(six::sidd::DetectedProductPipeline::LINEAR, 5, 95);
+    otherPipeline.computeStatistics();
+    TEST_ASSERT(remapAll(otherPipeline, dims) == remapped);
+}
+
+TEST_CASE(testLogRemap)
+{
+    const types::RowCol<size_t> dims(50, 60);
+    MemoryComplexSource source(dims);
+    six::sidd::DetectedProductPipeline pipeline(source, 2);
+    pipeline.setRemap(six::sidd::DetectedProductPipeline::LOGARITHMIC, 10, 90);
+    const six::sidd::DetectedProductPipeline::Statistics& stats =
+            pipeline.computeStatistics();
+
+    TEST_ASSERT_EQ(pipeline.remapMagnitude(0), 0);
+    TEST_ASSERT_EQ(pipeline.remapMagnitude(
+            static_cast<float>(stats.maxMagnitude)), 255);
+
+    // The geometric mean of the clip points is halfway in dB
+    const float middle = static_cast<float>(::sqrt(
+            stats.lowerClipMagnitude * stats.upperClipMagnitude));
+    TEST_ASSERT_ALMOST_EQ_EPS(pipeline.remapMagnitude(middle), 127.5, 2);
+
+    // Monotonic
+    for (size_t ii = 1; ii < 1000; ++ii)
+    {
+        TEST_ASSERT_LESSER_EQ(pipeline.remapMagnitude(ii - 1),
+                              pipeline.remapMagnitude(ii));
+    }
+}
+
+TEST_CASE(testNonFinite)
+{
+    const types::RowCol<size_t> dims(10, 10);
+    MemoryComplexSource source(dims);
+    source.mImage[5] = std::complex<float>(
+            std::numeric_limits<float>::quiet_NaN(), 0);
+    source.mImage[6] = std::complex<float>(
+            0, std::numeric_limits<float>::infinity());
+
+    six::sidd::DetectedProductPipeline pipeline(source, 1);
+    const six::sidd::DetectedProductPipeline::Statistics& stats =
+            pipeline.computeStatistics();
+
+    // Neither counts toward the statistics
+    TEST_ASSERT_EQ(stats.numPixels, dims.area() - 2);
+    TEST_ASSERT(stats.maxMagnitude < std::numeric_limits<float>::max());
+
+    const std::vector<sys::ubyte> remapped(remapAll(pipeline, dims));
+    TEST_ASSERT_EQ(remapped[5], 0);
+    TEST_ASSERT_EQ(remapped[6], 255);
+}
+
+TEST_CASE(testInvalidSettings)
+{
+    MemoryComplexSource source(types::RowCol<size_t>(10, 10));
+    six::sidd::DetectedProductPipeline pipeline(source);
+    TEST_EXCEPTION(pipeline.setRemap(
+            six::sidd::DetectedProductPipeline::LINEAR, 50, 50));
+    TEST_EXCEPTION(pipeline.setRemap(
+            six::sidd::DetectedProductPipeline::LINEAR, -1, 50));
+    TEST_EXCEPTION(pipeline.setRemap(
+            six::sidd::DetectedProductPipeline::LINEAR, 0, 101));
+
+    std::vector<sys::ubyte> remapped(100);
+    TEST_EXCEPTION(pipeline.remap(0, 10, &remapped[0]));
+
+    pipeline.computeStatistics();
+    TEST_EXCEPTION(pipeline.remap(5, 6, &remapped[0]));
+
+    MemoryComplexSource emptySource(types::RowCol<size_t>(0, 10));
+    TEST_EXCEPTION(six::sidd::DetectedProductPipeline(emptySource));
+}
+
+TEST_CASE(testPopulateDerivedData)
+{
+    const types::RowCol<size_t> dims(40, 50);
+    MemoryComplexSource source(dims);
+    six::sidd::DetectedProductPipeline pipeline(source);
+    pipeline.setRemap(six::sidd::DetectedProductPipeline::LOGARITHMIC, 1, 98);
+
+    std::auto_ptr<six::sidd::DerivedData> data =
+            six::sidd::Utilities::createFakeDerivedData();
+    TEST_EXCEPTION(pipeline.populateDerivedData(*data));
+
+    pipeline.computeStatistics();
+    pipeline.populateDerivedData(*data);
+
+    TEST_ASSERT_EQ(data->getNumRows(), dims.row);
+    TEST_ASSERT_EQ(data->getNumCols(), dims.col);
+    TEST_ASSERT_EQ(data->getPixelType(), six::PixelType::MONO8I);
+
+    const six::sidd::MonochromeDisplayRemap* const remap =
+            dynamic_cast<const six::sidd::MonochromeDisplayRemap*>(
+                    data->display->remapInformation.get());
+    TEST_ASSERT(remap != NULL);
+    TEST_ASSERT_EQ(remap->remapType, "LOGARITHMIC");
+    TEST_ASSERT_EQ(data->display->histogramOverrides->clipMin, 1);
+    TEST_ASSERT_EQ(data->display->histogramOverrides->clipMax, 98);
+
+    TEST_ASSERT(data->productProcessing.get() != NULL);
+    const six::sidd::ProcessingModule& module =
+            *data->productProcessing->processingModules.back();
+    TEST_ASSERT_EQ(module.moduleName.str(), "DetectedRemap");
+    TEST_ASSERT_EQ(module.moduleParameters.findParameter("RemapType").str(),
+                   "LOGARITHMIC");
+
+    TEST_ASSERT(data->downstreamReprocessing.get() != NULL);
+    TEST_ASSERT_EQ(data->downstreamReprocessing->processingEvents.size(), 1);
+
+    data->measurement.reset();
+    TEST_EXCEPTION(pipeline.populateDerivedData(*data));
+}
+
+TEST_CASE(testWrite)
+{
+    const types::RowCol<size_t> dims(123, 456);
+    MemoryComplexSource source(dims);
+
+    // Small bands to exercise blocking within and across segments
+    six::sidd::DetectedProductPipeline pipeline(source, 2, 20);
+    pipeline.computeStatistics();
+    const std::vector<sys::ubyte> expected(remapAll(pipeline, dims));
+
+    std::auto_ptr<six::sidd::DerivedData> data =
+            six::sidd::Utilities::createFakeDerivedData();
+    pipeline.populateDerivedData(*data);
+
+    const size_t blocking[][2] = {{0, 0}, {7, 9}, {16, 456}};
+    const size_t maxProductSize[] = {0, 30 * 456 + 2048};
+    for (size_t ii = 0; ii < sizeof(blocking) / sizeof(blocking[0]); ++ii)
+    {
+        for (size_t jj = 0; jj < sizeof(maxProductSize) / sizeof(size_t); ++jj)
+        {
+            const std::string pathname("test_detected_product_pipeline.nitf");
+            const EnsureFileCleanup cleanup(pathname);
+            pipeline.write(*data, std::vector<std::string>(), pathname,
+                           blocking[ii][0], blocking[ii][1],
+                           maxProductSize[jj]);
+
+            std::auto_ptr<six::sidd::DerivedData> readData;
+            std::vector<sys::ubyte> image;
+            readBack(pathname, readData, image);
+
+            TEST_ASSERT_EQ(readData->getNumRows(), dims.row);
+            TEST_ASSERT_EQ(readData->getNumCols(), dims.col);
+            TEST_ASSERT_EQ(readData->getPixelType(), six::PixelType::MONO8I);
+            TEST_ASSERT(image == expected);
+        }
+    }
+
+    // Dimensions have to match
+    data->setNumRows(dims.row - 1);
+    TEST_EXCEPTION(pipeline.write(*data, std::vector<std::string>(),
+                                  "test_detected_product_pipeline.nitf"));
+}
+}
+
+int main(int, char**)
+{
+    try
+    {
+        TEST_CHECK(testStatistics);
+        TEST_CHECK(testLinearRemap);
+        TEST_CHECK(testLogRemap);
+        TEST_CHECK(testNonFinite);
+        TEST_CHECK(testInvalidSettings);
+        TEST_CHECK(testPopulateDerivedData);
+        TEST_CHECK(testWrite);
+
+        return 0;
+    }
+    catch (const except::Exception& e)
+    {
+        std::cerr << "Caught exception: " << e.getMessage() << std::endl;
+        return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Caught exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Unknown exception\n";
+        return 1;
+    }
+}
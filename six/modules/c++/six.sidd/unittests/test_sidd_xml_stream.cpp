@@ -0,0 +1,341 @@
+/* =========================================================================
+ * This file is part of six.sidd-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six.sidd-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <io/StringStream.h>
+#include <six/XMLStreamWriter.h>
+#include <six/sidd/DerivedXMLControl.h>
+#include <six/sidd/Utilities.h>
+
+#include "TestCase.h"
+
+namespace
+{
+// What toValidXMLString used to return: the DOM, printed
+std::string printDOM(const six::sidd::DerivedData& data)
+{
+    six::sidd::DerivedXMLControl control;
+    const std::auto_ptr<xml::lite::Document> doc(
+            control.toXML(&data, std::vector<std::string>()));
+    io::StringStream ss;
+    doc->getRootElement()->print(ss);
+    return ss.stream().str();
+}
+
+std::string stream(const six::sidd::DerivedData& data)
+{
+    six::sidd::DerivedXMLControl control;
+    std::string xml;
+    six::XMLStreamWriter writer(&xml);
+    control.toXML(&data, writer);
+    return xml;
+}
+
+size_t count(const six::sidd::DerivedData& data)
+{
+    six::sidd::DerivedXMLControl control;
+    six::XMLStreamWriter counter;
+    control.toXML(&data, counter);
+    return counter.getNumBytes();
+}
+
+std::auto_ptr<six::sidd::DerivedData> createData()
+{
+    std::auto_ptr<six::sidd::DerivedData> data(
+            six::sidd::Utilities::createFakeDerivedData());
+    data->display->pixelType = six::PixelType::MONO8I;
+    return data;
+}
+
+six::Parameter makeParameter(const std::string& name, double value)
+{
+    six::Parameter parameter(value);
+    parameter.setName(name);
+    return parameter;
+}
+
+six::sidd::SFALinearRing* makeRing(double offset)
+{
+    six::sidd::SFALinearRing* const ring = new six::sidd::SFALinearRing();
+    ring->vertices.resize(3);
+    ring->vertices[0].reset(new six::sidd::SFAPoint(offset, 0));
+    ring->vertices[1].reset(new six::sidd::SFAPoint(offset + 1, 0));
+    ring->vertices[2].reset(new six::sidd::SFAPoint(offset, 1, 2, 3));
+    return ring;
+}
+
+void fillOptionalSections(six::sidd::DerivedData& data)
+{
+    six::sidd::ProductCreation& creation = *data.productCreation;
+    creation.processorInformation->application = "application";
+    creation.processorInformation->site = "site";
+    creation.processorInformation->profile = "profile";
+    creation.productName = "name";
+    creation.productClass = "class";
+    creation.productType = "type";
+    creation.productCreationExtensions.push_back(
+            makeParameter("extension", 1.5));
+
+    six::sidd::DerivedClassification& classification =
+            creation.classification;
+    classification.compliesWith.push_back("USGov");
+    classification.compliesWith.push_back("USIC");
+    classification.ownerProducer.push_back("USA");
+    classification.releasableTo.push_back("USA");
+    classification.releasableTo.push_back("GBR");
+    classification.classifiedBy = "someone";
+    classification.derivedFrom = "source";
+    classification.declassDate.reset(new six::DateTime(2030, 1, 1));
+    classification.securityExtensions.push_back(
+            makeParameter("security", 2.0));
+
+    six::sidd::Display& display = *data.display;
+    display.pixelType = six::PixelType::MONO8LU;
+    display.remapInformation.reset(new six::sidd::MonochromeDisplayRemap(
+            "remap", new six::LUT(4, 2)));
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        reinterpret_cast<short*>(
+                display.remapInformation->remapLUT->getTable())[ii] =
+                static_cast<short>(ii * 100);
+    }
+    display.magnificationMethod = six::MagnificationMethod::NEAREST_NEIGHBOR;
+    display.decimationMethod = six::DecimationMethod::BRIGHTEST_PIXEL;
+    display.histogramOverrides.reset(new six::sidd::DRAHistogramOverrides());
+    display.histogramOverrides->clipMin = 1;
+    display.histogramOverrides->clipMax = 200;
+    display.monitorCompensationApplied.reset(
+            new six::sidd::MonitorCompensationApplied());
+    display.monitorCompensationApplied->gamma = 2.2;
+    display.monitorCompensationApplied->xMin = 0.25;
+    display.displayExtensions.push_back(makeParameter("display", 3.0));
+
+    // Sub-regions instead of GeographicInfo, plus a target
+    six::sidd::GeographicCoverage& coverage =
+            data.geographicAndTarget->geographicCoverage;
+    coverage.georegionIdentifiers.push_back(makeParameter("region", 4.0));
+    mem::ScopedCopyablePtr<six::sidd::GeographicCoverage> subRegion(
+            new six::sidd::GeographicCoverage(six::RegionType::GEOGRAPHIC_INFO));
+    subRegion->footprint = coverage.footprint;
+    subRegion->geographicInformation.reset(
+            new six::sidd::GeographicInformation());
+    subRegion->geographicInformation->countryCodes.push_back("US");
+    subRegion->geographicInformation->securityInformation = "  info  ";
+    coverage.subRegion.push_back(subRegion);
+    coverage.geographicInformation.reset();
+
+    mem::ScopedCopyablePtr<six::sidd::TargetInformation> target(
+            new six::sidd::TargetInformation());
+    target->identifiers.push_back(makeParameter("target", 5.0));
+    target->footprint.reset(new six::LatLonCorners(coverage.footprint));
+    data.geographicAndTarget->targetInformation.push_back(target);
+
+    six::sidd::Collection& collection =
+            *data.exploitationFeatures->collections[0];
+    collection.identifier = "collection";
+    collection.information->sensorName = "sensor";
+    collection.information->radarModeID = "mode";
+    collection.information->inputROI.reset(
+            new six::sidd::InputROI(10, 20, 1, 2));
+    collection.information->polarization.push_back(
+            mem::ScopedCloneablePtr<six::sidd::TxRcvPolarization>(
+                    new six::sidd::TxRcvPolarization(
+                            six::PolarizationType::V,
+                            six::PolarizationType::H, 0.5)));
+    collection.information->polarization[0]->processed =
+            six::BooleanType::IS_TRUE;
+    collection.geometry.reset(new six::sidd::Geometry());
+    collection.geometry->azimuth = 10.0;
+    collection.geometry->graze = 30.0;
+    collection.geometry->extensions.push_back(makeParameter("geometry", 6.0));
+    collection.phenomenology.reset(new six::sidd::Phenomenology());
+    collection.phenomenology->shadow = six::AngleMagnitude(45.0, 1.5);
+    collection.phenomenology->groundTrack = 12.0;
+    data.exploitationFeatures->product.north = 90.0;
+
+    data.productProcessing.reset(new six::sidd::ProductProcessing());
+    mem::ScopedCloneablePtr<six::sidd::ProcessingModule> outer(
+            new six::sidd::ProcessingModule());
+    outer->moduleName = makeParameter("outer", 7.0);
+    mem::ScopedCloneablePtr<six::sidd::ProcessingModule> inner(
+            new six::sidd::ProcessingModule());
+    inner->moduleName = makeParameter("inner", 8.0);
+    inner->moduleParameters.push_back(makeParameter("parameter", 9.0));
+    outer->processingModules.push_back(inner);
+    data.productProcessing->processingModules.push_back(outer);
+
+    data.downstreamReprocessing.reset(new six::sidd::DownstreamReprocessing());
+    data.downstreamReprocessing->geometricChip.reset(
+            new six::sidd::GeometricChip());
+    data.downstreamReprocessing->geometricChip->chipSize =
+            six::RowColInt(100, 200);
+    mem::ScopedCopyablePtr<six::sidd::ProcessingEvent> event(
+            new six::sidd::ProcessingEvent());
+    event->applicationName = "event";
+    event->interpolationMethod = "linear";
+    event->descriptor.push_back(makeParameter("descriptor", 10.0));
+    data.downstreamReprocessing->processingEvents.push_back(event);
+
+    mem::ScopedCopyablePtr<six::sidd::Annotation> annotation(
+            new six::sidd::Annotation());
+    annotation->identifier = "annotation";
+    annotation->spatialReferenceSystem.reset(
+            new six::sidd::SFAReferenceSystem());
+    six::sidd::SFAGeographicCoordinateSystem* const coordinateSystem =
+            new six::sidd::SFAGeographicCoordinateSystem();
+    coordinateSystem->csName = "WGS 84";
+    coordinateSystem->datum.spheroid.name = "WGS 84";
+    coordinateSystem->datum.spheroid.semiMajorAxis = 6378137.0;
+    coordinateSystem->datum.spheroid.inverseFlattening = 298.257223563;
+    coordinateSystem->primeMeridian.name = "Greenwich";
+    coordinateSystem->primeMeridian.longitude = 0.0;
+    coordinateSystem->angularUnit = "degree";
+    coordinateSystem->linearUnit = "meter";
+    annotation->spatialReferenceSystem->coordinateSystem.reset(
+            coordinateSystem);
+    annotation->spatialReferenceSystem->axisNames.push_back("Lat");
+    annotation->spatialReferenceSystem->axisNames.push_back("Lon");
+
+    annotation->objects.push_back(
+            mem::ScopedCloneablePtr<six::sidd::SFAGeometry>(
+                    new six::sidd::SFAPoint(1.0, 2.0)));
+    six::sidd::SFALine* const line = new six::sidd::SFALine();
+    line->vertices.push_back(mem::ScopedCopyablePtr<six::sidd::SFAPoint>(
+            new six::sidd::SFAPoint(1.0, 2.0)));
+    line->vertices.push_back(mem::ScopedCopyablePtr<six::sidd::SFAPoint>(
+            new six::sidd::SFAPoint(3.0, 4.0, 5.0, 6.0)));
+    annotation->objects.push_back(
+            mem::ScopedCloneablePtr<six::sidd::SFAGeometry>(line));
+    six::sidd::SFAPolygon* const polygon = new six::sidd::SFAPolygon();
+    polygon->rings.push_back(
+            mem::ScopedCopyablePtr<six::sidd::SFALinearRing>(makeRing(0)));
+    polygon->rings.push_back(
+            mem::ScopedCopyablePtr<six::sidd::SFALinearRing>(makeRing(5)));
+    annotation->objects.push_back(
+            mem::ScopedCloneablePtr<six::sidd::SFAGeometry>(polygon));
+    six::sidd::SFAMultiPoint* const multiPoint =
+            new six::sidd::SFAMultiPoint();
+    multiPoint->vertices.push_back(
+            mem::ScopedCopyablePtr<six::sidd::SFAPoint>(
+                    new six::sidd::SFAPoint(7.0, 8.0)));
+    multiPoint->vertices.push_back(
+            mem::ScopedCopyablePtr<six::sidd::SFAPoint>(
+                    new six::sidd::SFAPoint(9.0, 10.0)));
+    annotation->objects.push_back(
+            mem::ScopedCloneablePtr<six::sidd::SFAGeometry>(multiPoint));
+    data.annotations.push_back(annotation);
+}
+
+TEST_CASE(testFakeData)
+{
+    const std::auto_ptr<six::sidd::DerivedData> data(createData());
+    const std::string expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+}
+
+TEST_CASE(testOptionalSections)
+{
+    const std::auto_ptr<six::sidd::DerivedData> data(createData());
+    fillOptionalSections(*data);
+    const std::string expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+}
+
+TEST_CASE(testColorRemap)
+{
+    const std::auto_ptr<six::sidd::DerivedData> data(createData());
+    data->display->pixelType = six::PixelType::RGB8LU;
+    data->display->remapInformation.reset(
+            new six::sidd::ColorDisplayRemap(new six::LUT(2, 3)));
+    unsigned char* const table =
+            data->display->remapInformation->remapLUT->getTable();
+    for (size_t ii = 0; ii < 6; ++ii)
+    {
+        table[ii] = static_cast<unsigned char>(ii * 40);
+    }
+    const std::string expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+}
+
+TEST_CASE(testProjections)
+{
+    const std::auto_ptr<six::sidd::DerivedData> data(createData());
+
+    data->measurement.reset(
+            new six::sidd::Measurement(six::ProjectionType::GEOGRAPHIC));
+    data->measurement->projection->referencePoint.name = "reference";
+    six::sidd::GeographicProjection* const geographic =
+            static_cast<six::sidd::GeographicProjection*>(
+                    data->measurement->projection.get());
+    geographic->sampleSpacing = six::RowColDouble(0.5, 0.25);
+    geographic->timeCOAPoly = six::Poly2D(1, 1);
+    data->measurement->arpPoly = six::PolyXYZ(1);
+    std::string expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+
+    data->measurement.reset(
+            new six::sidd::Measurement(six::ProjectionType::CYLINDRICAL));
+    six::sidd::CylindricalProjection* const cylindrical =
+            static_cast<six::sidd::CylindricalProjection*>(
+                    data->measurement->projection.get());
+    cylindrical->sampleSpacing = six::RowColDouble(1.0, 2.0);
+    cylindrical->timeCOAPoly = six::Poly2D(0, 0);
+    cylindrical->stripmapDirection[0] = 1.0;
+    cylindrical->stripmapDirection[1] = 0.0;
+    cylindrical->stripmapDirection[2] = 0.0;
+    cylindrical->curvatureRadius = 1000.0;
+    data->measurement->arpPoly = six::PolyXYZ(0);
+    expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+
+    data->measurement.reset(
+            new six::sidd::Measurement(six::ProjectionType::POLYNOMIAL));
+    six::sidd::PolynomialProjection* const polynomial =
+            static_cast<six::sidd::PolynomialProjection*>(
+                    data->measurement->projection.get());
+    polynomial->rowColToLat = six::Poly2D(1, 1);
+    polynomial->rowColToLon = six::Poly2D(1, 1);
+    polynomial->latLonToRow = six::Poly2D(1, 1);
+    polynomial->latLonToCol = six::Poly2D(1, 1);
+    data->measurement->arpPoly = six::PolyXYZ(0);
+    expected = printDOM(*data);
+    TEST_ASSERT_EQ(stream(*data), expected);
+    TEST_ASSERT_EQ(count(*data), expected.size());
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testFakeData);
+    TEST_CHECK(testOptionalSections);
+    TEST_CHECK(testColorRemap);
+    TEST_CHECK(testProjections);
+    return 0;
+}
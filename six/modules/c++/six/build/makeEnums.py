@@ -22,27 +22,326 @@
 # see <http://www.gnu.org/licenses/>.
 #
 
+# Generates include/six/Enums.h and source/Enums.cpp from enums.txt.
+#
+# The enums.txt format is the same one coda-oss' makeEnums.py reads.  The
+# difference is in the string conversions: rather than a chain of string
+# compares, each enum gets a perfect hash table of every spelling it accepts,
+# and toCString() returns a name straight from a table; toString() copies
+# that into a std::string for callers that need one.  The tables are all plain
+# constant arrays at namespace scope, so they're initialized before any code
+# runs and are safe to use from any thread.  The hash seeds and table sizes
+# are all worked out here, so the C++ does one hash, one table lookup and one
+# compare per conversion.
+
+import datetime
 import os
-import subprocess
+import re
+import sys
+
+try:
+    from configparser import ConfigParser
+except ImportError:
+    from ConfigParser import ConfigParser
+
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+MAX_SEED_TRIES = 100000
+SEED_STEP = 0x9e3779b9
+
+
+class Bunch(object):
+    def __init__(self, **kw):
+        self.__dict__.update(kw)
+
+
+def fnv1a(name, seed):
+    h = seed
+    for c in bytearray(name.encode('ascii')):
+        h ^= c
+        h = (h * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def getSlot(name, seed, tableSize):
+    # The low bits of FNV-1a only depend on the low bits of the seed and the
+    # input, so fold the high half in before masking
+    h = fnv1a(name, seed)
+    return (h ^ (h >> 16)) & (tableSize - 1)
+
+
+def findPerfectHash(names):
+    """Returns (seed, tableSize) such that every name lands in its own slot
+    of a power of two sized table"""
+    tableSize = 1
+    while tableSize < len(names):
+        tableSize *= 2
+
+    while True:
+        for ii in range(MAX_SEED_TRIES):
+            seed = (FNV_OFFSET_BASIS + ii * SEED_STEP) & 0xffffffff
+            slots = set(getSlot(n, seed, tableSize) for n in names)
+            if len(slots) == len(names):
+                return seed, tableSize
+        tableSize *= 2
+
+
+def toConstantName(name):
+    return re.sub(r'([a-z0-9])([A-Z])', r'\1_\2', name).upper()
+
+
+def readEnums(filename):
+    c = ConfigParser()
+    c.optionxform = str
+    c.read(filename)
+
+    enums = []
+    for enum in sorted(c.sections()):
+        values = Bunch(name=enum, default=0, prefix='', items=[],
+                       supportNoPrefixForStrings=False,
+                       toStringNoPrefix=False,
+                       constShortcuts=False,
+                       cleanPrefix='')
+        for (name, value) in c.items(enum):
+            name, value = name.strip(), value.strip()
+            if name == '__default__':
+                values.default = value
+                try:
+                    values.default = int(values.default)
+                except ValueError:
+                    pass
+            elif name == '__enum_prefix__':
+                values.prefix = value
+                values.cleanPrefix = re.sub(r'[^\w_]', '_', value)
+            elif name == '__string_noprefix__':
+                values.supportNoPrefixForStrings = value.lower() == 'true'
+            elif name == '__tostring_noprefix__':
+                values.toStringNoPrefix = value.lower() == 'true'
+            elif name == '__const_shortcuts__':
+                values.constShortcuts = value.lower() == 'true'
+            else:
+                valParts = value.split(',')
+                value = valParts[0]
+                try:
+                    value = int(value)
+                except ValueError:
+                    pass
+                names = name.split(',')
+                toStringVal = len(valParts) > 1 and valParts[1] or names[0]
+                values.items.append(Bunch(names=names, value=value,
+                                          toString=toStringVal))
+
+        # Numeric values in order, then symbolic ones (e.g. NOT_SET)
+        def sortKey(item):
+            if isinstance(item.value, int):
+                return (0, item.value, '')
+            return (1, 0, item.value)
+        values.items.sort(key=sortKey)
+
+        for item in values.items:
+            item.identifier = values.cleanPrefix + \
+                item.names[0].replace(' ', '_')
+
+        if values.default is not None:
+            for item in values.items:
+                if values.default == item.value:
+                    values.default = item.identifier
+                    break
+        if not isinstance(values.default, str):
+            values.default = str(values.items[0].value)
+
+        # Values without an explicit one follow on from the previous item
+        idx = 0
+        for item in values.items:
+            if item.value != '':
+                idx = item.value
+            item.caseValue = idx
+            if isinstance(idx, int):
+                idx += 1
+
+        values.spellings = []
+        for item in values.items:
+            for n in item.names:
+                names = ['%s%s' % (values.cleanPrefix, n)]
+                if values.supportNoPrefixForStrings:
+                    names.append(n)
+                if values.prefix != values.cleanPrefix:
+                    names.append('%s%s' % (values.prefix, n))
+                for name in names:
+                    values.spellings.append((name, item))
+
+        enums.append(values)
+    return enums
+
+
+def writeHeaderEnum(s, values):
+    enum = values.name
+    s.append("""
+/*!
+ *  \\struct %s
+ *
+ *  Enumeration used to represent %ss
+ */\n""" % (enum, enum))
+    s.append('struct %s\n{\n' % enum)
+    s.append('    //! The enumerations allowed\n')
+    s.append('    enum\n    {\n')
+    for (i, item) in enumerate(values.items):
+        if item.value != '':
+            s.append('        %s = %s' % (item.identifier, item.value))
+        else:
+            s.append('        %s' % item.identifier)
+        if i < len(values.items) - 1:
+            s.append(',')
+        s.append('\n')
+    s.append('    };\n\n')
+
+    s.append('    //! Default constructor\n')
+    s.append('    %s(){ value = %s; }\n\n' %
+             (enum, values.default.replace(' ', '_')))
+
+    s.append('    //! string constructor\n')
+    s.append('    %s(const std::string& s) { value = parse(s.data(), s.size()); }\n\n' % enum)
+
+    s.append('    //! Constructs from characters that needn\'t be NUL terminated\n')
+    s.append('    %s(const char* s, size_t length) { value = parse(s, length); }\n\n' % enum)
+
+    s.append('    //! int constructor\n')
+    s.append('    %s(int i)\n    {\n        switch(i)\n        {\n' % enum)
+    for item in values.items:
+        s.append('        case %s:\n            value = %s;\n            break;\n'
+                 % (item.caseValue, item.identifier))
+    s.append('        default:\n            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", i)));\n')
+    s.append('        }\n    }\n\n')
+
+    s.append('    //! destructor\n')
+    s.append('    ~%s(){}\n\n' % enum)
+
+    s.append('    //! Returns string representation of the value\n')
+    s.append('    std::string toString() const;\n\n')
+
+    s.append('    /*!\n')
+    s.append('     * Returns the characters of toString() without building a string.\n')
+    s.append('     * They\'re static and NUL terminated.  If length isn\'t NULL it\'s\n')
+    s.append('     * set to the number of characters.\n')
+    s.append('     */\n')
+    s.append('    const char* toCString(size_t* length = NULL) const;\n\n')
+
+    s.append('    //! assignment operator\n')
+    s.append('    %s& operator=(const %s& o)\n    {\n' % (enum, enum))
+    s.append('        if (&o != this)\n        {\n            value = o.value;\n        }\n')
+    s.append('        return *this;\n    }\n\n')
+
+    s.append('    bool operator==(const %s& o) const { return value == o.value; }\n' % enum)
+    s.append('    bool operator!=(const %s& o) const { return value != o.value; }\n' % enum)
+    s.append('    bool operator==(const int& o) const { return value == o; }\n')
+    s.append('    bool operator!=(const int& o) const { return value != o; }\n')
+    s.append('    %s& operator=(const int& o) { value = o; return *this; }\n' % enum)
+    s.append('    bool operator<(const %s& o) const { return value < o.value; }\n' % enum)
+    s.append('    bool operator>(const %s& o) const { return value > o.value; }\n' % enum)
+    s.append('    bool operator<=(const %s& o) const { return value <= o.value; }\n' % enum)
+    s.append('    bool operator>=(const %s& o) const { return value >= o.value; }\n' % enum)
+    s.append('    operator int() const { return value; }\n')
+    s.append('    operator std::string() const { return toString(); }\n\n')
+    s.append('    static size_t size() { return %d; }\n\n' % len(values.items))
+    s.append('    int value;\n\n')
+    s.append('private:\n')
+    s.append('    static int parse(const char* s, size_t length);\n')
+    s.append('};\n\n')
+
+    if values.constShortcuts:
+        for item in values.items:
+            s.append('const %s %s(%s::%s);\n' % (enum, item.identifier,
+                                                 enum, item.identifier))
+        s.append('\n')
+
+
+def writeSourceEnum(s, values):
+    enum = values.name
+    tableName = toConstantName(enum) + '_TABLE'
+    namesName = toConstantName(enum) + '_NAMES'
+    names = [name for (name, item) in values.spellings]
+    seed, tableSize = findPerfectHash(names)
+
+    slots = [None] * tableSize
+    for (name, item) in values.spellings:
+        slots[getSlot(name, seed, tableSize)] = (name, item)
+
+    s.append('\n// %s\n' % enum)
+    s.append('namespace\n{\n')
+    s.append('const EnumEntry %s[%d] =\n{\n' % (tableName, tableSize))
+    for (i, slot) in enumerate(slots):
+        if slot is None:
+            s.append('    {NULL, 0, 0}')
+        else:
+            (name, item) = slot
+            s.append('    {"%s", %d, %s::%s}' % (name, len(name), enum,
+                                                 item.identifier))
+        if i < len(slots) - 1:
+            s.append(',')
+        s.append('\n')
+    s.append('};\n\n')
+
+    strings = []
+    for item in values.items:
+        if values.toStringNoPrefix:
+            strings.append(item.toString)
+        else:
+            strings.append(values.prefix + item.toString)
+    s.append('const EnumName %s[] =\n{\n' % namesName)
+    s.append(',\n'.join('    {"%s", %d}' % (n, len(n)) for n in strings))
+    s.append('\n};\n}\n\n')
+
+    s.append('int %s::parse(const char* s, size_t length)\n{\n' % enum)
+    s.append('    return lookup(%s, %d, 0x%08xu, s, length);\n}\n\n' %
+             (tableName, tableSize, seed))
+
+    s.append('const char* %s::toCString(size_t* length) const\n{\n' % enum)
+    s.append('    switch (value)\n    {\n')
+    for (i, item) in enumerate(values.items):
+        s.append('    case %s:\n        return getName(%s[%d], length);\n' %
+                 (item.caseValue, namesName, i))
+    s.append('    default:\n        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));\n')
+    s.append('    }\n}\n\n')
+
+    s.append('std::string %s::toString() const\n{\n' % enum)
+    s.append('    size_t length;\n')
+    s.append('    const char* const name = toCString(&length);\n')
+    s.append('    return std::string(name, length);\n}\n')
+
+
+def fillTemplate(templateFile, code):
+    f = open(templateFile)
+    template = f.read()
+    f.close()
+    code += '\n// code auto-generated %s' % datetime.datetime.now()
+    return template.replace('${CODE}', code)
+
+
+def writeFile(pathname, contents):
+    f = open(pathname, 'w')
+    f.write(contents)
+    f.close()
 
-script = os.path.join(os.getcwd(), 'externals', 'coda-oss',
-                      'build', 'scripts', 'makeEnums.py')
 
-inputFile = os.path.join(os.path.split(__file__)[0], 'enums.txt')
-template = os.path.join(os.path.split(__file__)[0], 'Enums.h.template')
-outDir = os.path.join(os.path.split(__file__)[0], os.pardir, 'include', 'six')
+def main():
+    buildDir = os.path.dirname(os.path.abspath(__file__))
+    moduleDir = os.path.join(buildDir, os.pardir)
+    enums = readEnums(os.path.join(buildDir, 'enums.txt'))
 
-assert os.path.exists(script)
-assert os.path.exists(inputFile)
-assert os.path.exists(outDir)
-assert os.path.exists(template)
+    header = []
+    source = []
+    for values in enums:
+        writeHeaderEnum(header, values)
+        writeSourceEnum(source, values)
 
-target = os.path.join(outDir, 'Enums.h')
-if os.path.exists(target):
-    os.remove(target)
+    writeFile(os.path.join(moduleDir, 'include', 'six', 'Enums.h'),
+              fillTemplate(os.path.join(buildDir, 'Enums.h.template'),
+                           ''.join(header)))
+    writeFile(os.path.join(moduleDir, 'source', 'Enums.cpp'),
+              fillTemplate(os.path.join(buildDir, 'Enums.cpp.template'),
+                           ''.join(source)))
+    return 0
 
-with open(target, 'w') as f:
-    subprocess.call(['python', script, inputFile, '-t', template],
-                    stdout=f, shell=True)
-    
 
+if __name__ == '__main__':
+    sys.exit(main())
@@ -24,6 +24,7 @@
 
 #include "six/Adapters.h"
 #include "six/Container.h"
+#include "six/CopyOnWritePtr.h"
 #include "six/Data.h"
 #include "six/Enums.h"
 #include "six/ErrorStatistics.h"
@@ -46,6 +47,7 @@
 #include "six/WriteControl.h"
 #include "six/XMLControl.h"
 #include "six/XMLControlFactory.h"
+#include "six/XMLStreamWriter.h"
 
 #endif
 
@@ -29,6 +29,7 @@
 #include <six/NITFWriteControl.h>
 #include <six/NITFHeaderCreator.h>
 #include <six/NITFSegmentInfo.h>
+#include <six/StagingBufferPool.h>
 #include <six/XMLControlFactory.h>
 
 namespace six
@@ -66,12 +67,12 @@ public:
 
     /*!
      * Populates the writer Options from given parameters
-     * \param container Container holding Data object
+     * \param container Container holding one or more Data objects
      * \param maxProductSize Maximum size of image segment in bytes
      * \param numRowsPerBlock Rows per block. Will be truncated if greater than
-     *        num rows in image
+     *        num rows in the largest image
      * \param numColsPerBlock Cols per block. Will be truncated if greater than
-     *        num cols in image
+     *        num cols in the largest image
      * \param[out] options Options to populate
      */
     static void populateOptions(
@@ -127,6 +128,24 @@ public:
             size_t& numRowsPerBlock,
             size_t& numColsPerBlock);
 
+    /*!
+     * Compute how the image segments of a populated NITF header creator are
+     * grouped into image products.  Each image gets its own product (a SICD
+     * or a single SIDD just has one), and any legend for that image trails
+     * its product.
+     * \static
+     * \param headerCreator Populated NITF header creator object
+     * \param[out] numSegmentsPerProduct Number of image segments in each
+     *  product
+     * \param[out] trailingImageData For each product, pointers to the pixels
+     *  of the image segments that follow it.  These point into the
+     *  container's legends.
+     */
+    static void populateImageProducts(
+            const NITFHeaderCreator& headerCreator,
+            std::vector<size_t>& numSegmentsPerProduct,
+            std::vector<std::vector<PtrAndLength> >& trailingImageData);
+
     /*!
      * Initialize the ByteProvider
      * \param headerCreator Class for populating and managing NITF
@@ -139,6 +158,89 @@ public:
     void initialize(std::auto_ptr<six::NITFHeaderCreator> headerCreator,
                     const std::vector<std::string>& schemaPaths,
                     const std::vector<PtrAndLength>& desBuffers);
+
+    using nitf::ByteProvider::getBytes;
+
+    /*!
+     * Same as nitf::ByteProvider::getBytes() except that 'imageData' is in
+     * the native byte order of this system rather than big endian.  On a
+     * little endian system, the pixels are byte swapped into 'staging' and
+     * the image data entries in 'buffers' point there rather than at
+     * 'imageData'.  The memory comes from a pool owned by this object and is
+     * handed back when 'staging' goes out of scope, so writers that loop over
+     * row bands with the same 'staging' object allocate at most once.  On a
+     * big endian system no swap or copy occurs.
+     *
+     * \param imageData The image data pixels to write, in native byte
+     * order.  Must be blocked if the NITF is.
+     * \param startRow The global start row in pixels
+     * \param numRows The number of rows in the provided 'imageData'
+     * \param[out] fileOffset The offset in bytes in the NITF where these
+     * buffers should be written
+     * \param[out] buffers One or more pointers to raw bytes of data.  Only
+     * valid for the lifetime of this object, 'imageData', and 'staging'.
+     * \param[out] staging Holds the byte swapped pixels
+     */
+    void getBytes(const void* imageData,
+                  size_t startRow,
+                  size_t numRows,
+                  nitf::Off& fileOffset,
+                  nitf::NITFBufferList& buffers,
+                  StagingBuffer& staging) const;
+
+    /*!
+     * Same as above but for one image product of a NITF holding several
+     * unrelated images (see nitf::ByteProvider::getBytes()).
+     *
+     * \param product The image product index
+     * \param imageData The image data pixels to write, in native byte
+     * order.  Must be blocked if the product is.
+     * \param startRow The start row in pixels relative to the first row of
+     * the product
+     * \param numRows The number of rows in the provided 'imageData'
+     * \param[out] fileOffset The offset in bytes in the NITF where these
+     * buffers should be written
+     * \param[out] buffers One or more pointers to raw bytes of data.  Only
+     * valid for the lifetime of this object, 'imageData', and 'staging'.
+     * \param[out] staging Holds the byte swapped pixels
+     */
+    void getBytes(size_t product,
+                  const void* imageData,
+                  size_t startRow,
+                  size_t numRows,
+                  nitf::Off& fileOffset,
+                  nitf::NITFBufferList& buffers,
+                  StagingBuffer& staging) const;
+
+    /*!
+     * \param numThreads The number of threads to use when byte swapping in
+     * getBytes().  If 0, uses the number of CPUs.  Defaults to 1.
+     */
+    void setNumThreads(size_t numThreads);
+
+    //! \return The number of threads to use when byte swapping
+    size_t getNumThreads() const
+    {
+        return mNumThreads;
+    }
+
+    /*!
+     * \return The size in bytes of each element of the first image product
+     * that is byte swapped (i.e. the size of one band of one pixel)
+     */
+    size_t getNumBytesPerElement() const
+    {
+        return mNumBytesPerElement.empty() ? 0 : mNumBytesPerElement[0];
+    }
+
+    /*!
+     * \param product The image product index
+     *
+     * \return The size in bytes of each element of this image product that
+     * is byte swapped
+     */
+    size_t getNumBytesPerElement(size_t product) const;
+
 protected:
     /*!
      * Default constructor. Client code must call initialize() to
@@ -181,6 +283,28 @@ protected:
     void initialize(const NITFWriteControl& writer,
                     const std::vector<std::string>& schemaPaths,
                     const std::vector<PtrAndLength>& desBuffers);
+
+    /*!
+     * \return The number of bytes of pixel data (including any pad rows
+     * needed to complete blocks) the caller provides for the given rows of
+     * an image product
+     */
+    size_t getNumImageDataBytes(size_t product,
+                                size_t startRow,
+                                size_t numRows) const;
+
+private:
+    void initializeImpl(const NITFHeaderCreator& headerCreator,
+                        nitf::Record& record,
+                        const std::vector<std::string>& schemaPaths,
+                        const std::vector<PtrAndLength>& desBuffers);
+
+    void initializeSwapInfo(nitf::Record& record);
+
+private:
+    size_t mNumThreads;
+    std::vector<size_t> mNumBytesPerElement; // Per product
+    mem::SharedPtr<StagingBufferPool> mStagingPool;
 };
 }
 
@@ -0,0 +1,49 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_BYTE_SWAP_H__
+#define __SIX_BYTE_SWAP_H__
+
+#include <stddef.h>
+
+namespace six
+{
+/*!
+ * Threaded, out-of-place byte swapping.  Each thread runs the SIMD kernels
+ * from sys/ByteSwap.h.
+ *
+ * \param input Buffer to swap.  Will not be modified.
+ * \param elemSize Size of each element in 'input'.  Complex pixels must be
+ * treated as two elements.
+ * \param numElements Number of elements in 'input'
+ * \param numThreads Number of threads to use for byte-swapping
+ * \param[out] output Swapped elements.  Must not overlap 'input' and must be
+ * at least elemSize * numElements bytes.
+ */
+void byteSwap(const void* input,
+              size_t elemSize,
+              size_t numElements,
+              size_t numThreads,
+              void* output);
+}
+
+#endif
@@ -0,0 +1,201 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_COPY_ON_WRITE_PTR_H__
+#define __SIX_COPY_ON_WRITE_PTR_H__
+
+#include <memory>
+
+#include <sys/Conf.h>
+#include <mem/SharedPtr.h>
+
+namespace six
+{
+/*!
+ *  \class CopyOnWritePtr
+ *  \brief Stands in for mem::ScopedCopyablePtr, but copies of it share the
+ *  pointee until one of them changes it
+ *
+ *  Copying the pointer just bumps an (atomic) reference count.  The
+ *  non-const get(), operator* and operator-> copy the pointee first if
+ *  anything else is sharing it; the const ones never copy.  This makes
+ *  copying metadata where most of the sections go unchanged (e.g. chipping
+ *  a SICD) cheap, as long as the unchanged sections are only read through
+ *  const references.
+ *
+ *  Since the caller may hold on to what a non-const accessor hands out and
+ *  write through it later, doing so marks the pointer unshareable: copies
+ *  made from it after that get a deep copy of their own, as
+ *  ScopedCopyablePtr would have given them.  reset() makes the pointer
+ *  shareable again, as does markShareable(), which should be called once
+ *  nothing holds a pointer or reference from a non-const accessor any more
+ *  (e.g. when a parser is done filling the pointee in).
+ */
+template <typename T>
+class CopyOnWritePtr
+{
+public:
+    explicit CopyOnWritePtr(T* ptr = NULL) :
+        mPtr(ptr),
+        mShareable(true)
+    {
+    }
+
+    explicit CopyOnWritePtr(std::auto_ptr<T> ptr) :
+        mPtr(ptr.release()),
+        mShareable(true)
+    {
+    }
+
+    CopyOnWritePtr(const CopyOnWritePtr& rhs) :
+        mPtr(rhs.share()),
+        mShareable(true)
+    {
+    }
+
+    CopyOnWritePtr& operator=(const CopyOnWritePtr& rhs)
+    {
+        if (this != &rhs)
+        {
+            mPtr = rhs.share();
+            mShareable = true;
+        }
+        return *this;
+    }
+
+    bool operator==(const CopyOnWritePtr<T>& rhs) const
+    {
+        if (get() == rhs.get())
+        {
+            return true;
+        }
+        if (get() == NULL || rhs.get() == NULL)
+        {
+            return false;
+        }
+        return (*get() == *rhs.get());
+    }
+
+    bool operator!=(const CopyOnWritePtr<T>& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    // explicit operators not supported until C++11
+#ifdef __CODA_CPP11
+    explicit
+#endif
+    operator bool() const
+    {
+        return get() == NULL ? false : true;
+    }
+
+    const T* get() const
+    {
+        return mPtr.get();
+    }
+
+    T* get()
+    {
+        detach();
+        mShareable = false;
+        return mPtr.get();
+    }
+
+    const T& operator*() const
+    {
+        return *get();
+    }
+
+    T& operator*()
+    {
+        return *get();
+    }
+
+    const T* operator->() const
+    {
+        return get();
+    }
+
+    T* operator->()
+    {
+        return get();
+    }
+
+    void reset(T* ptr = NULL)
+    {
+        mPtr.reset(ptr);
+        mShareable = true;
+    }
+
+    void reset(std::auto_ptr<T> ptr)
+    {
+        mPtr.reset(ptr.release());
+        mShareable = true;
+    }
+
+    //! \return True if another CopyOnWritePtr shares the pointee
+    bool isShared() const
+    {
+        return mPtr.get() != NULL && mPtr.getCount() > 1;
+    }
+
+    /*!
+     * \return False if a non-const accessor has been called since the
+     * pointer was last made shareable, in which case copies of it don't
+     * share the pointee
+     */
+    bool isShareable() const
+    {
+        return mShareable;
+    }
+
+    //! Lets copies share the pointee again.  See the class description.
+    void markShareable()
+    {
+        mShareable = true;
+    }
+
+private:
+    mem::SharedPtr<T> share() const
+    {
+        if (mShareable || mPtr.get() == NULL)
+        {
+            return mPtr;
+        }
+        return mem::SharedPtr<T>(new T(*mPtr));
+    }
+
+    void detach()
+    {
+        if (isShared())
+        {
+            mPtr.reset(new T(*mPtr));
+        }
+    }
+
+    mem::SharedPtr<T> mPtr;
+    bool mShareable;
+};
+}
+
+#endif
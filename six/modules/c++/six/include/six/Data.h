@@ -55,6 +55,16 @@ struct Data
      */
     virtual Data* clone() const = 0;
 
+    /*!
+     *  Subclasses whose copies share blocks until one is modified (see
+     *  CopyOnWritePtr) let those blocks be shared again.  Only call this
+     *  once nothing holds on to a pointer or reference into the data.
+     *  Does nothing by default.
+     */
+    virtual void markShareable()
+    {
+    }
+
     friend bool operator==(const Data& lhs, const Data& rhs)
     {
         return lhs.equalTo(rhs);
@@ -53,21 +53,13 @@ struct AppliedType
     };
 
     //! Default constructor
-
     AppliedType(){ value = NOT_SET; }
 
     //! string constructor
-    AppliedType(std::string s)
-    {
-        if (s == "IS_FALSE")
-            value = IS_FALSE;
-        else if (s == "IS_TRUE")
-            value = IS_TRUE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    AppliedType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    AppliedType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     AppliedType(int i)
@@ -92,20 +84,14 @@ struct AppliedType
     ~AppliedType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("IS_FALSE");
-        case 1:
-            return std::string("IS_TRUE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     AppliedType& operator=(const AppliedType& o)
@@ -133,6 +119,8 @@ struct AppliedType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -156,19 +144,10 @@ struct AutofocusType
     AutofocusType(){ value = NOT_SET; }
 
     //! string constructor
-    AutofocusType(std::string s)
-    {
-        if (s == "NO")
-            value = NO;
-        else if (s == "GLOBAL")
-            value = GLOBAL;
-        else if (s == "SV")
-            value = SV;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    AutofocusType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    AutofocusType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     AutofocusType(int i)
@@ -196,22 +175,14 @@ struct AutofocusType
     ~AutofocusType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("NO");
-        case 1:
-            return std::string("GLOBAL");
-        case 2:
-            return std::string("SV");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     AutofocusType& operator=(const AutofocusType& o)
@@ -239,6 +210,8 @@ struct AutofocusType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -261,17 +234,10 @@ struct BooleanType
     BooleanType(){ value = NOT_SET; }
 
     //! string constructor
-    BooleanType(std::string s)
-    {
-        if (s == "IS_FALSE")
-            value = IS_FALSE;
-        else if (s == "IS_TRUE")
-            value = IS_TRUE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    BooleanType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    BooleanType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     BooleanType(int i)
@@ -296,20 +262,14 @@ struct BooleanType
     ~BooleanType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("IS_FALSE");
-        case 1:
-            return std::string("IS_TRUE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     BooleanType& operator=(const BooleanType& o)
@@ -337,6 +297,8 @@ struct BooleanType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -360,19 +322,10 @@ struct ByteSwapping
     ByteSwapping(){ value = NOT_SET; }
 
     //! string constructor
-    ByteSwapping(std::string s)
-    {
-        if (s == "SWAP_OFF")
-            value = SWAP_OFF;
-        else if (s == "SWAP_ON")
-            value = SWAP_ON;
-        else if (s == "SWAP_AUTO")
-            value = SWAP_AUTO;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ByteSwapping(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ByteSwapping(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ByteSwapping(int i)
@@ -400,22 +353,14 @@ struct ByteSwapping
     ~ByteSwapping(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("SWAP_OFF");
-        case 1:
-            return std::string("SWAP_ON");
-        case 2:
-            return std::string("SWAP_AUTO");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ByteSwapping& operator=(const ByteSwapping& o)
@@ -443,6 +388,8 @@ struct ByteSwapping
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -465,17 +412,10 @@ struct CollectType
     CollectType(){ value = NOT_SET; }
 
     //! string constructor
-    CollectType(std::string s)
-    {
-        if (s == "MONOSTATIC")
-            value = MONOSTATIC;
-        else if (s == "BISTATIC")
-            value = BISTATIC;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    CollectType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    CollectType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     CollectType(int i)
@@ -500,20 +440,14 @@ struct CollectType
     ~CollectType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("MONOSTATIC");
-        case 2:
-            return std::string("BISTATIC");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     CollectType& operator=(const CollectType& o)
@@ -541,6 +475,8 @@ struct CollectType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -566,23 +502,10 @@ struct ComplexImageGridType
     ComplexImageGridType(){ value = NOT_SET; }
 
     //! string constructor
-    ComplexImageGridType(std::string s)
-    {
-        if (s == "RGAZIM")
-            value = RGAZIM;
-        else if (s == "RGZERO")
-            value = RGZERO;
-        else if (s == "XRGYCR")
-            value = XRGYCR;
-        else if (s == "XCTYAT")
-            value = XCTYAT;
-        else if (s == "PLANE")
-            value = PLANE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ComplexImageGridType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ComplexImageGridType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ComplexImageGridType(int i)
@@ -616,26 +539,14 @@ struct ComplexImageGridType
     ~ComplexImageGridType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("RGAZIM");
-        case 1:
-            return std::string("RGZERO");
-        case 2:
-            return std::string("XRGYCR");
-        case 3:
-            return std::string("XCTYAT");
-        case 4:
-            return std::string("PLANE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ComplexImageGridType& operator=(const ComplexImageGridType& o)
@@ -663,6 +574,8 @@ struct ComplexImageGridType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -686,19 +599,10 @@ struct ComplexImagePlaneType
     ComplexImagePlaneType(){ value = NOT_SET; }
 
     //! string constructor
-    ComplexImagePlaneType(std::string s)
-    {
-        if (s == "OTHER")
-            value = OTHER;
-        else if (s == "SLANT")
-            value = SLANT;
-        else if (s == "GROUND")
-            value = GROUND;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ComplexImagePlaneType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ComplexImagePlaneType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ComplexImagePlaneType(int i)
@@ -726,22 +630,14 @@ struct ComplexImagePlaneType
     ~ComplexImagePlaneType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("OTHER");
-        case 1:
-            return std::string("SLANT");
-        case 2:
-            return std::string("GROUND");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ComplexImagePlaneType& operator=(const ComplexImagePlaneType& o)
@@ -769,6 +665,8 @@ struct ComplexImagePlaneType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -791,17 +689,10 @@ struct DataType
     DataType(){ value = NOT_SET; }
 
     //! string constructor
-    DataType(std::string s)
-    {
-        if (s == "COMPLEX")
-            value = COMPLEX;
-        else if (s == "DERIVED")
-            value = DERIVED;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    DataType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    DataType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     DataType(int i)
@@ -826,20 +717,14 @@ struct DataType
     ~DataType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("COMPLEX");
-        case 2:
-            return std::string("DERIVED");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     DataType& operator=(const DataType& o)
@@ -867,6 +752,8 @@ struct DataType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -891,21 +778,10 @@ struct DecimationMethod
     DecimationMethod(){ value = NOT_SET; }
 
     //! string constructor
-    DecimationMethod(std::string s)
-    {
-        if (s == "NEAREST_NEIGHBOR")
-            value = NEAREST_NEIGHBOR;
-        else if (s == "BILINEAR")
-            value = BILINEAR;
-        else if (s == "BRIGHTEST_PIXEL")
-            value = BRIGHTEST_PIXEL;
-        else if (s == "LAGRANGE")
-            value = LAGRANGE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    DecimationMethod(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    DecimationMethod(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     DecimationMethod(int i)
@@ -936,24 +812,14 @@ struct DecimationMethod
     ~DecimationMethod(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("NEAREST_NEIGHBOR");
-        case 2:
-            return std::string("BILINEAR");
-        case 3:
-            return std::string("BRIGHTEST_PIXEL");
-        case 4:
-            return std::string("LAGRANGE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     DecimationMethod& operator=(const DecimationMethod& o)
@@ -981,6 +847,8 @@ struct DecimationMethod
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1003,17 +871,10 @@ struct DemodType
     DemodType(){ value = NOT_SET; }
 
     //! string constructor
-    DemodType(std::string s)
-    {
-        if (s == "STRETCH")
-            value = STRETCH;
-        else if (s == "CHIRP")
-            value = CHIRP;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    DemodType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    DemodType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     DemodType(int i)
@@ -1038,20 +899,14 @@ struct DemodType
     ~DemodType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("STRETCH");
-        case 2:
-            return std::string("CHIRP");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     DemodType& operator=(const DemodType& o)
@@ -1079,6 +934,8 @@ struct DemodType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1101,17 +958,10 @@ struct DisplayType
     DisplayType(){ value = NOT_SET; }
 
     //! string constructor
-    DisplayType(std::string s)
-    {
-        if (s == "COLOR")
-            value = COLOR;
-        else if (s == "MONO")
-            value = MONO;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    DisplayType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    DisplayType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     DisplayType(int i)
@@ -1136,20 +986,14 @@ struct DisplayType
     ~DisplayType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("COLOR");
-        case 2:
-            return std::string("MONO");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     DisplayType& operator=(const DisplayType& o)
@@ -1177,6 +1021,8 @@ struct DisplayType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1207,33 +1053,10 @@ struct DualPolarizationType
     DualPolarizationType(){ value = NOT_SET; }
 
     //! string constructor
-    DualPolarizationType(std::string s)
-    {
-        if (s == "OTHER")
-            value = OTHER;
-        else if (s == "V_V")
-            value = V_V;
-        else if (s == "V_H")
-            value = V_H;
-        else if (s == "H_V")
-            value = H_V;
-        else if (s == "H_H")
-            value = H_H;
-        else if (s == "RHC_RHC")
-            value = RHC_RHC;
-        else if (s == "RHC_LHC")
-            value = RHC_LHC;
-        else if (s == "LHC_RHC")
-            value = LHC_RHC;
-        else if (s == "LHC_LHC")
-            value = LHC_LHC;
-        else if (s == "UNKNOWN")
-            value = UNKNOWN;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    DualPolarizationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    DualPolarizationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     DualPolarizationType(int i)
@@ -1282,36 +1105,14 @@ struct DualPolarizationType
     ~DualPolarizationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("OTHER");
-        case 2:
-            return std::string("V_V");
-        case 3:
-            return std::string("V_H");
-        case 4:
-            return std::string("H_V");
-        case 5:
-            return std::string("H_H");
-        case 6:
-            return std::string("RHC_RHC");
-        case 7:
-            return std::string("RHC_LHC");
-        case 8:
-            return std::string("LHC_RHC");
-        case 9:
-            return std::string("LHC_LHC");
-        case 10:
-            return std::string("UNKNOWN");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     DualPolarizationType& operator=(const DualPolarizationType& o)
@@ -1339,6 +1140,8 @@ struct DualPolarizationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1360,15 +1163,10 @@ struct EarthModelType
     EarthModelType(){ value = NOT_SET; }
 
     //! string constructor
-    EarthModelType(std::string s)
-    {
-        if (s == "WGS84")
-            value = WGS84;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    EarthModelType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    EarthModelType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     EarthModelType(int i)
@@ -1390,18 +1188,14 @@ struct EarthModelType
     ~EarthModelType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("WGS84");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     EarthModelType& operator=(const EarthModelType& o)
@@ -1429,6 +1223,8 @@ struct EarthModelType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1451,17 +1247,10 @@ struct FFTSign
     FFTSign(){ value = NOT_SET; }
 
     //! string constructor
-    FFTSign(std::string s)
-    {
-        if (s == "NEG")
-            value = NEG;
-        else if (s == "POS")
-            value = POS;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    FFTSign(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    FFTSign(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     FFTSign(int i)
@@ -1486,20 +1275,14 @@ struct FFTSign
     ~FFTSign(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case -1:
-            return std::string("NEG");
-        case 1:
-            return std::string("POS");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     FFTSign& operator=(const FFTSign& o)
@@ -1527,6 +1310,8 @@ struct FFTSign
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1549,17 +1334,10 @@ struct ImageBeamCompensationType
     ImageBeamCompensationType(){ value = NOT_SET; }
 
     //! string constructor
-    ImageBeamCompensationType(std::string s)
-    {
-        if (s == "NO")
-            value = NO;
-        else if (s == "SV")
-            value = SV;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ImageBeamCompensationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ImageBeamCompensationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ImageBeamCompensationType(int i)
@@ -1584,20 +1362,14 @@ struct ImageBeamCompensationType
     ~ImageBeamCompensationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("NO");
-        case 1:
-            return std::string("SV");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ImageBeamCompensationType& operator=(const ImageBeamCompensationType& o)
@@ -1625,6 +1397,8 @@ struct ImageBeamCompensationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1649,21 +1423,10 @@ struct ImageFormationType
     ImageFormationType(){ value = NOT_SET; }
 
     //! string constructor
-    ImageFormationType(std::string s)
-    {
-        if (s == "OTHER")
-            value = OTHER;
-        else if (s == "PFA")
-            value = PFA;
-        else if (s == "RMA")
-            value = RMA;
-        else if (s == "RGAZCOMP")
-            value = RGAZCOMP;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ImageFormationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ImageFormationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ImageFormationType(int i)
@@ -1694,24 +1457,14 @@ struct ImageFormationType
     ~ImageFormationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("OTHER");
-        case 1:
-            return std::string("PFA");
-        case 2:
-            return std::string("RMA");
-        case 3:
-            return std::string("RGAZCOMP");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ImageFormationType& operator=(const ImageFormationType& o)
@@ -1739,6 +1492,8 @@ struct ImageFormationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1762,19 +1517,10 @@ struct MagnificationMethod
     MagnificationMethod(){ value = NOT_SET; }
 
     //! string constructor
-    MagnificationMethod(std::string s)
-    {
-        if (s == "NEAREST_NEIGHBOR")
-            value = NEAREST_NEIGHBOR;
-        else if (s == "BILINEAR")
-            value = BILINEAR;
-        else if (s == "LAGRANGE")
-            value = LAGRANGE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    MagnificationMethod(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    MagnificationMethod(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     MagnificationMethod(int i)
@@ -1802,22 +1548,14 @@ struct MagnificationMethod
     ~MagnificationMethod(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("NEAREST_NEIGHBOR");
-        case 2:
-            return std::string("BILINEAR");
-        case 3:
-            return std::string("LAGRANGE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     MagnificationMethod& operator=(const MagnificationMethod& o)
@@ -1845,6 +1583,8 @@ struct MagnificationMethod
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1870,23 +1610,10 @@ struct OrientationType
     OrientationType(){ value = NOT_SET; }
 
     //! string constructor
-    OrientationType(std::string s)
-    {
-        if (s == "UP")
-            value = UP;
-        else if (s == "DOWN")
-            value = DOWN;
-        else if (s == "LEFT")
-            value = LEFT;
-        else if (s == "RIGHT")
-            value = RIGHT;
-        else if (s == "ARBITRARY")
-            value = ARBITRARY;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    OrientationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    OrientationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     OrientationType(int i)
@@ -1920,26 +1647,14 @@ struct OrientationType
     ~OrientationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("UP");
-        case 2:
-            return std::string("DOWN");
-        case 3:
-            return std::string("LEFT");
-        case 4:
-            return std::string("RIGHT");
-        case 5:
-            return std::string("ARBITRARY");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     OrientationType& operator=(const OrientationType& o)
@@ -1967,6 +1682,8 @@ struct OrientationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -1995,29 +1712,10 @@ struct PixelType
     PixelType(){ value = NOT_SET; }
 
     //! string constructor
-    PixelType(std::string s)
-    {
-        if (s == "RE32F_IM32F")
-            value = RE32F_IM32F;
-        else if (s == "RE16I_IM16I")
-            value = RE16I_IM16I;
-        else if (s == "AMP8I_PHS8I")
-            value = AMP8I_PHS8I;
-        else if (s == "MONO8I")
-            value = MONO8I;
-        else if (s == "MONO8LU")
-            value = MONO8LU;
-        else if (s == "MONO16I")
-            value = MONO16I;
-        else if (s == "RGB8LU")
-            value = RGB8LU;
-        else if (s == "RGB24I")
-            value = RGB24I;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    PixelType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    PixelType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     PixelType(int i)
@@ -2060,32 +1758,14 @@ struct PixelType
     ~PixelType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("RE32F_IM32F");
-        case 2:
-            return std::string("RE16I_IM16I");
-        case 3:
-            return std::string("AMP8I_PHS8I");
-        case 4:
-            return std::string("MONO8I");
-        case 5:
-            return std::string("MONO8LU");
-        case 6:
-            return std::string("MONO16I");
-        case 7:
-            return std::string("RGB8LU");
-        case 8:
-            return std::string("RGB24I");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     PixelType& operator=(const PixelType& o)
@@ -2113,6 +1793,8 @@ struct PixelType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2140,27 +1822,10 @@ struct PolarizationSequenceType
     PolarizationSequenceType(){ value = NOT_SET; }
 
     //! string constructor
-    PolarizationSequenceType(std::string s)
-    {
-        if (s == "OTHER")
-            value = OTHER;
-        else if (s == "V")
-            value = V;
-        else if (s == "H")
-            value = H;
-        else if (s == "RHC")
-            value = RHC;
-        else if (s == "LHC")
-            value = LHC;
-        else if (s == "UNKNOWN")
-            value = UNKNOWN;
-        else if (s == "SEQUENCE")
-            value = SEQUENCE;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    PolarizationSequenceType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    PolarizationSequenceType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     PolarizationSequenceType(int i)
@@ -2200,30 +1865,14 @@ struct PolarizationSequenceType
     ~PolarizationSequenceType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("OTHER");
-        case 2:
-            return std::string("V");
-        case 3:
-            return std::string("H");
-        case 4:
-            return std::string("RHC");
-        case 5:
-            return std::string("LHC");
-        case 6:
-            return std::string("UNKNOWN");
-        case 7:
-            return std::string("SEQUENCE");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     PolarizationSequenceType& operator=(const PolarizationSequenceType& o)
@@ -2251,6 +1900,8 @@ struct PolarizationSequenceType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2276,23 +1927,10 @@ struct PolarizationType
     PolarizationType(){ value = NOT_SET; }
 
     //! string constructor
-    PolarizationType(std::string s)
-    {
-        if (s == "OTHER")
-            value = OTHER;
-        else if (s == "V")
-            value = V;
-        else if (s == "H")
-            value = H;
-        else if (s == "RHC")
-            value = RHC;
-        else if (s == "LHC")
-            value = LHC;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    PolarizationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    PolarizationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     PolarizationType(int i)
@@ -2326,26 +1964,14 @@ struct PolarizationType
     ~PolarizationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("OTHER");
-        case 2:
-            return std::string("V");
-        case 3:
-            return std::string("H");
-        case 4:
-            return std::string("RHC");
-        case 5:
-            return std::string("LHC");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     PolarizationType& operator=(const PolarizationType& o)
@@ -2373,6 +1999,8 @@ struct PolarizationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2397,21 +2025,10 @@ struct ProjectionType
     ProjectionType(){ value = NOT_SET; }
 
     //! string constructor
-    ProjectionType(std::string s)
-    {
-        if (s == "PLANE")
-            value = PLANE;
-        else if (s == "GEOGRAPHIC")
-            value = GEOGRAPHIC;
-        else if (s == "CYLINDRICAL")
-            value = CYLINDRICAL;
-        else if (s == "POLYNOMIAL")
-            value = POLYNOMIAL;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    ProjectionType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    ProjectionType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     ProjectionType(int i)
@@ -2442,24 +2059,14 @@ struct ProjectionType
     ~ProjectionType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("PLANE");
-        case 2:
-            return std::string("GEOGRAPHIC");
-        case 3:
-            return std::string("CYLINDRICAL");
-        case 4:
-            return std::string("POLYNOMIAL");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     ProjectionType& operator=(const ProjectionType& o)
@@ -2487,6 +2094,8 @@ struct ProjectionType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2510,19 +2119,10 @@ struct RMAlgoType
     RMAlgoType(){ value = NOT_SET; }
 
     //! string constructor
-    RMAlgoType(std::string s)
-    {
-        if (s == "OMEGA_K")
-            value = OMEGA_K;
-        else if (s == "CSA")
-            value = CSA;
-        else if (s == "RG_DOP")
-            value = RG_DOP;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    RMAlgoType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    RMAlgoType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     RMAlgoType(int i)
@@ -2550,22 +2150,14 @@ struct RMAlgoType
     ~RMAlgoType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("OMEGA_K");
-        case 2:
-            return std::string("CSA");
-        case 3:
-            return std::string("RG_DOP");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     RMAlgoType& operator=(const RMAlgoType& o)
@@ -2593,6 +2185,8 @@ struct RMAlgoType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2617,21 +2211,10 @@ struct RadarModeType
     RadarModeType(){ value = NOT_SET; }
 
     //! string constructor
-    RadarModeType(std::string s)
-    {
-        if (s == "SPOTLIGHT")
-            value = SPOTLIGHT;
-        else if (s == "STRIPMAP")
-            value = STRIPMAP;
-        else if (s == "DYNAMIC_STRIPMAP")
-            value = DYNAMIC_STRIPMAP;
-        else if (s == "SCANSAR")
-            value = SCANSAR;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    RadarModeType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    RadarModeType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     RadarModeType(int i)
@@ -2662,24 +2245,14 @@ struct RadarModeType
     ~RadarModeType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("SPOTLIGHT");
-        case 2:
-            return std::string("STRIPMAP");
-        case 3:
-            return std::string("DYNAMIC_STRIPMAP");
-        case 4:
-            return std::string("SCANSAR");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     RadarModeType& operator=(const RadarModeType& o)
@@ -2707,6 +2280,8 @@ struct RadarModeType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2729,17 +2304,10 @@ struct RegionType
     RegionType(){ value = NOT_SET; }
 
     //! string constructor
-    RegionType(std::string s)
-    {
-        if (s == "SUB_REGION")
-            value = SUB_REGION;
-        else if (s == "GEOGRAPHIC_INFO")
-            value = GEOGRAPHIC_INFO;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    RegionType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    RegionType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     RegionType(int i)
@@ -2764,20 +2332,14 @@ struct RegionType
     ~RegionType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 1:
-            return std::string("SUB_REGION");
-        case 2:
-            return std::string("GEOGRAPHIC_INFO");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     RegionType& operator=(const RegionType& o)
@@ -2805,6 +2367,8 @@ struct RegionType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2827,17 +2391,10 @@ struct RowColEnum
     RowColEnum(){ value = NOT_SET; }
 
     //! string constructor
-    RowColEnum(std::string s)
-    {
-        if (s == "ROW")
-            value = ROW;
-        else if (s == "COL")
-            value = COL;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    RowColEnum(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    RowColEnum(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     RowColEnum(int i)
@@ -2862,20 +2419,14 @@ struct RowColEnum
     ~RowColEnum(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("ROW");
-        case 1:
-            return std::string("COL");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     RowColEnum& operator=(const RowColEnum& o)
@@ -2903,6 +2454,8 @@ struct RowColEnum
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -2925,17 +2478,10 @@ struct SCPType
     SCPType(){ value = NOT_SET; }
 
     //! string constructor
-    SCPType(std::string s)
-    {
-        if (s == "SCP_ROW_COL")
-            value = SCP_ROW_COL;
-        else if (s == "SCP_RG_AZ")
-            value = SCP_RG_AZ;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    SCPType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    SCPType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     SCPType(int i)
@@ -2960,20 +2506,14 @@ struct SCPType
     ~SCPType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("SCP_ROW_COL");
-        case 1:
-            return std::string("SCP_RG_AZ");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     SCPType& operator=(const SCPType& o)
@@ -3001,6 +2541,8 @@ struct SCPType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -3023,17 +2565,10 @@ struct SideOfTrackType
     SideOfTrackType(){ value = NOT_SET; }
 
     //! string constructor
-    SideOfTrackType(std::string s)
-    {
-        if (s == "LEFT")
-            value = LEFT;
-        else if (s == "RIGHT")
-            value = RIGHT;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    SideOfTrackType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    SideOfTrackType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     SideOfTrackType(int i)
@@ -3058,20 +2593,14 @@ struct SideOfTrackType
     ~SideOfTrackType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case scene::TRACK_LEFT:
-            return std::string("LEFT");
-        case scene::TRACK_RIGHT:
-            return std::string("RIGHT");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     SideOfTrackType& operator=(const SideOfTrackType& o)
@@ -3099,6 +2628,8 @@ struct SideOfTrackType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -3122,19 +2653,10 @@ struct SlowTimeBeamCompensationType
     SlowTimeBeamCompensationType(){ value = NOT_SET; }
 
     //! string constructor
-    SlowTimeBeamCompensationType(std::string s)
-    {
-        if (s == "NO")
-            value = NO;
-        else if (s == "GLOBAL")
-            value = GLOBAL;
-        else if (s == "SV")
-            value = SV;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    SlowTimeBeamCompensationType(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    SlowTimeBeamCompensationType(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     SlowTimeBeamCompensationType(int i)
@@ -3162,22 +2684,14 @@ struct SlowTimeBeamCompensationType
     ~SlowTimeBeamCompensationType(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("NO");
-        case 1:
-            return std::string("GLOBAL");
-        case 2:
-            return std::string("SV");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     SlowTimeBeamCompensationType& operator=(const SlowTimeBeamCompensationType& o)
@@ -3205,6 +2719,8 @@ struct SlowTimeBeamCompensationType
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
 
@@ -3228,19 +2744,10 @@ struct XYZEnum
     XYZEnum(){ value = NOT_SET; }
 
     //! string constructor
-    XYZEnum(std::string s)
-    {
-        if (s == "X")
-            value = X;
-        else if (s == "Y")
-            value = Y;
-        else if (s == "Z")
-            value = Z;
-        else if (s == "NOT_SET")
-            value = NOT_SET;
-        else
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %s", s.c_str())));
-    }
+    XYZEnum(const std::string& s) { value = parse(s.data(), s.size()); }
+
+    //! Constructs from characters that needn't be NUL terminated
+    XYZEnum(const char* s, size_t length) { value = parse(s, length); }
 
     //! int constructor
     XYZEnum(int i)
@@ -3268,22 +2775,14 @@ struct XYZEnum
     ~XYZEnum(){}
 
     //! Returns string representation of the value
-    std::string toString() const
-    {
-        switch(value)
-        {
-        case 0:
-            return std::string("X");
-        case 1:
-            return std::string("Y");
-        case 2:
-            return std::string("Z");
-        case six::NOT_SET_VALUE:
-            return std::string("NOT_SET");
-        default:
-            throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
-        }
-    }
+    std::string toString() const;
+
+    /*!
+     * Returns the characters of toString() without building a string.
+     * They're static and NUL terminated.  If length isn't NULL it's
+     * set to the number of characters.
+     */
+    const char* toCString(size_t* length = NULL) const;
 
     //! assignment operator
     XYZEnum& operator=(const XYZEnum& o)
@@ -3311,9 +2810,13 @@ struct XYZEnum
 
     int value;
 
+private:
+    static int parse(const char* s, size_t length);
 };
 
-// code auto-generated 2016-04-04 16:12:32.876144
+
+// code auto-generated 2026-10-19 09:09:04.719121
+
 }
 
 #endif
@@ -0,0 +1,251 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_INSTRUMENTATION_H__
+#define __SIX_INSTRUMENTATION_H__
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <six/six_config.h>
+#include <sys/Conf.h>
+#include <sys/Mutex.h>
+#include <logging/Logger.h>
+
+/*!
+ * The read/write paths in six and cphd time their stages (I/O, byte
+ * swapping, conversion, XML) with ScopedStageTimer and report them to
+ * whatever InstrumentationSink is installed.  With no sink installed, a
+ * timer costs one atomic pointer load.  Configuring with
+ * --disable-six-instrumentation defines SIX_DISABLE_INSTRUMENTATION in the
+ * installed six/six_config.h, which compiles the timers out entirely.
+ *
+ * Stage names are dotted paths starting with the module, like
+ * "cphd.Wideband.read.io".
+ */
+namespace six
+{
+/*!
+ * \struct StageMeasurement
+ * \brief One run of one stage
+ */
+struct StageMeasurement
+{
+    StageMeasurement();
+
+    //! Name of the stage.  This points to a string literal.
+    const char* stage;
+
+    //! When the stage started, in microseconds on a monotonic clock
+    double startUS;
+
+    //! How long the stage took in microseconds
+    double elapsedUS;
+
+    //! Thread the stage ran on
+    long threadID;
+
+    //! Bytes the stage moved, if it counts them
+    sys::Uint64_T numBytes;
+
+    //! Rows (or vectors) the stage processed, if it counts them
+    sys::Uint64_T numRows;
+};
+
+/*!
+ * \class InstrumentationSink
+ * \brief Receives stage measurements
+ *
+ * record() is called from whichever thread ran the stage, so
+ * implementations must be thread-safe.
+ */
+class InstrumentationSink
+{
+public:
+    virtual ~InstrumentationSink();
+
+    virtual void record(const StageMeasurement& measurement) = 0;
+
+    //! Writes out anything buffered.  Does nothing by default.
+    virtual void flush();
+};
+
+/*!
+ * \struct StageStatistics
+ * \brief Running totals for one stage
+ */
+struct StageStatistics
+{
+    StageStatistics();
+
+    void add(const StageMeasurement& measurement);
+
+    //! \return Bytes per second over all runs, or 0 if nothing was timed
+    double getBytesPerSecond() const;
+
+    size_t count;
+    double totalMS;
+    double minMS;
+    double maxMS;
+    sys::Uint64_T numBytes;
+    sys::Uint64_T numRows;
+};
+
+/*!
+ * \class StatisticsSink
+ * \brief Keeps running totals per stage in memory for monitoring to poll
+ */
+class StatisticsSink : public InstrumentationSink
+{
+public:
+    typedef std::map<std::string, StageStatistics> Snapshot;
+
+    virtual void record(const StageMeasurement& measurement);
+
+    //! \return A copy of the totals so far, keyed by stage name
+    Snapshot getSnapshot() const;
+
+    //! Resets all totals
+    void clear();
+
+private:
+    mutable sys::Mutex mMutex;
+    Snapshot mStatistics;
+};
+
+/*!
+ * \class ChromeTraceSink
+ * \brief Buffers measurements and writes them as a Chrome trace JSON file
+ * (load it in chrome://tracing or Perfetto)
+ */
+class ChromeTraceSink : public InstrumentationSink
+{
+public:
+    /*!
+     * \param pathname File to write.  It's written by flush() and the
+     * destructor, overwriting anything already there.
+     */
+    explicit ChromeTraceSink(const std::string& pathname);
+
+    //! Flushes, discarding any errors
+    virtual ~ChromeTraceSink();
+
+    virtual void record(const StageMeasurement& measurement);
+
+    //! Writes every measurement recorded so far
+    virtual void flush();
+
+private:
+    const std::string mPathname;
+    sys::Mutex mMutex;
+    std::vector<StageMeasurement> mMeasurements;
+};
+
+/*!
+ * \class LoggerSink
+ * \brief Logs one line per measurement
+ */
+class LoggerSink : public InstrumentationSink
+{
+public:
+    /*!
+     * \param log Logger to write to.  Must outlive the sink.
+     * \param level Level to log at
+     */
+    LoggerSink(logging::Logger& log,
+               logging::LogLevel level = logging::LogLevel::LOG_DEBUG);
+
+    virtual void record(const StageMeasurement& measurement);
+
+private:
+    logging::Logger& mLog;
+    const logging::LogLevel mLevel;
+    sys::Mutex mMutex;
+};
+
+/*!
+ * Installs the sink that all stage timers report to.  Install it before
+ * starting the work to be measured and remove it after that work finishes.
+ * This may be called while other threads are running stage timers, but
+ * timers that were already running keep reporting to the old sink.  A
+ * timer holds a plain pointer to the sink it started with, so a sink must
+ * not be deleted until every timer that could have seen it has finished.
+ * In practice, only delete a sink after the threads doing the measured work
+ * have been joined.
+ *
+ * \param sink Sink to use, or NULL to stop recording.  Not owned.
+ */
+void setInstrumentationSink(InstrumentationSink* sink);
+
+//! \return The installed sink, or NULL
+InstrumentationSink* getInstrumentationSink();
+
+/*!
+ * \class ScopedStageTimer
+ * \brief Times from construction to destruction and reports it to the
+ * installed sink, along with any bytes and rows counted along the way
+ */
+class ScopedStageTimer
+{
+public:
+#ifndef SIX_DISABLE_INSTRUMENTATION
+    //! \param stage Name of the stage.  Must be a string literal.
+    explicit ScopedStageTimer(const char* stage);
+
+    ~ScopedStageTimer();
+
+    void addBytes(sys::Uint64_T numBytes)
+    {
+        mMeasurement.numBytes += numBytes;
+    }
+
+    void addRows(sys::Uint64_T numRows)
+    {
+        mMeasurement.numRows += numRows;
+    }
+
+private:
+    InstrumentationSink* const mSink;
+    StageMeasurement mMeasurement;
+#else
+    explicit ScopedStageTimer(const char* )
+    {
+    }
+
+    void addBytes(sys::Uint64_T )
+    {
+    }
+
+    void addRows(sys::Uint64_T )
+    {
+    }
+#endif
+
+private:
+    // Noncopyable
+    ScopedStageTimer(const ScopedStageTimer& );
+    const ScopedStageTimer& operator=(const ScopedStageTimer& );
+};
+}
+
+#endif
@@ -79,6 +79,14 @@ public:
      */
     virtual void serialize(std::vector<sys::byte>& values) const = 0;
 
+    /*!
+     * \return The number of bytes serialize() will append.  Used to size
+     *  the output buffer up front.  The default implementation serializes
+     *  to a scratch buffer, so implementations should override it with
+     *  something cheaper.
+     */
+    virtual size_t getSerializedSize() const;
+
     /*!
      * Deserializes an array of byte data to populate a Mesh. This is
      * the reverse operation of serialize(), and any implementation
@@ -143,6 +143,16 @@ public:
      */
     void addAdditionalDES(mem::SharedPtr<nitf::SegmentWriter> writer);
 
+    /*!
+     * Attach an RPC00B TRE to each image segment of a product.  The RPC's
+     * lines are relative to the full image and are shifted to be relative
+     * to each segment.  Must be called after initialize().
+     *
+     * \param rpc The RPC, typically fit via RPCFitter
+     * \param productNum Index of the product (i.e. Data) in the container
+     */
+    void addRPC00B(const scene::RPCModel& rpc, size_t productNum = 0);
+
     /*!
      * Convert classification level to NITF classification
      * \static
@@ -274,6 +274,15 @@ public:
      */
     void addAdditionalDES(mem::SharedPtr<nitf::SegmentWriter> writer);
 
+    /*!
+     *  Attach an RPC00B TRE to each image segment of a product.  Must be
+     *  called after initialize() and before save().
+     *
+     * \param rpc The RPC, typically fit via RPCFitter
+     * \param productNum Index of the product (i.e. Data) in the container
+     */
+    void addRPC00B(const scene::RPCModel& rpc, size_t productNum = 0);
+
     /*!
      *  Takes in a string representing the classification level
      *  and returns the value expected by the NITF
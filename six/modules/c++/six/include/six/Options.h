@@ -47,6 +47,14 @@ public:
     typedef std::map<std::string, Parameter> ParameterMap;
     typedef std::map<std::string, Parameter>::const_iterator ParameterIter;
 
+    /*!
+     * Number of worker threads in tasks::SharedTaskScheduler, which the
+     * readers and writers run their parallel work on.  0 means one per CPU.
+     * Readers and writers don't apply this themselves; see
+     * configureTaskScheduler().
+     */
+    static const char OPT_NUM_THREADS[];
+
     virtual ~Options();
 
     /*!
@@ -88,6 +96,17 @@ public:
 private:
     std::map<std::string, Parameter> mParameters;
 };
+
+/*!
+ *  If options has Options::OPT_NUM_THREADS, resizes the process-wide
+ *  tasks::SharedTaskScheduler to match.  This is a no-op if the size doesn't
+ *  change.  Otherwise, it waits for any tasks already running on the
+ *  scheduler to finish first.
+ *
+ *  The pool is shared by everything in the process, so this is meant to be
+ *  called once by the application at startup, not by each reader or writer.
+ */
+void configureTaskScheduler(const Options& options);
 }
 
 #endif
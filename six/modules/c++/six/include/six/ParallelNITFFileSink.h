@@ -0,0 +1,204 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_PARALLEL_NITF_FILE_SINK_H__
+#define __SIX_PARALLEL_NITF_FILE_SINK_H__
+
+#include <map>
+#include <string>
+
+#include <sys/Conf.h>
+#include <sys/Mutex.h>
+#include <nitf/NITFBufferList.hpp>
+#include <six/ByteProvider.h>
+
+namespace six
+{
+/*!
+ * \class ParallelNITFFileSink
+ * \brief Writes the bytes a ByteProvider produces for row bands straight
+ * into a file on disk.  The file is sized up front, and each band is written
+ * at its own offset with a single positional (vectored where available)
+ * write, so any number of threads may call write() at the same time, in any
+ * row order, without sharing a seek position.  Each byte of the file may be
+ * written only once; a write that overlaps an earlier one throws.
+ *
+ * The bytes go to a uniquely named temporary file next to the output
+ * pathname.  finalize() checks that every byte of the file has been written,
+ * flushes it to disk, and renames it into place, so a crash never leaves a
+ * partial file at the output pathname.  If the sink is destroyed without
+ * finalize() succeeding, the temporary file is removed.
+ *
+ * \code
+    six::sicd::SICDByteProvider provider(data, schemaPaths);
+    six::ParallelNITFFileSink sink(provider, "out.nitf");
+
+    // From any number of threads
+    sink.writeNativeEndian(&image[startRow * numCols], startRow, numRows);
+
+    sink.finalize();
+ * \endcode
+ */
+class ParallelNITFFileSink
+{
+public:
+    /*!
+     * Create the temporary file and size it to hold the whole NITF
+     *
+     * \param byteProvider Initialized byte provider.  Must outlive this
+     * object.
+     * \param pathname Final output pathname
+     */
+    ParallelNITFFileSink(const six::ByteProvider& byteProvider,
+                         const std::string& pathname);
+
+    //! Removes the temporary file if finalize() never succeeded
+    ~ParallelNITFFileSink();
+
+    /*!
+     * Write the buffers for one region of the file.  Thread-safe.  Throws if
+     * the region overlaps one that has already been written.
+     *
+     * \param fileOffset Offset in the file of the first buffer
+     * \param buffers Buffers to write contiguously starting at 'fileOffset'
+     */
+    void write(nitf::Off fileOffset, const nitf::NITFBufferList& buffers);
+
+    /*!
+     * Write a band of rows, including any NITF headers that belong with it.
+     * Thread-safe.
+     *
+     * \param imageData Big endian pixel data (blocked if the NITF is)
+     * \param startRow Global start row of 'imageData'
+     * \param numRows Number of rows in 'imageData'
+     */
+    void write(const void* imageData, size_t startRow, size_t numRows);
+
+    /*!
+     * Same as write() but 'imageData' is in the native byte order.  Swapping
+     * goes through the byte provider's staging buffer pool.  Thread-safe.
+     *
+     * \param imageData Native endian pixel data (blocked if the NITF is)
+     * \param startRow Global start row of 'imageData'
+     * \param numRows Number of rows in 'imageData'
+     */
+    void writeNativeEndian(const void* imageData,
+                           size_t startRow,
+                           size_t numRows);
+
+    /*!
+     * Same as write() above but for one image product of a NITF holding
+     * several unrelated images.  Thread-safe.
+     *
+     * \param product The image product index
+     * \param imageData Big endian pixel data (blocked if the product is)
+     * \param startRow Start row of 'imageData' within the product
+     * \param numRows Number of rows in 'imageData'
+     */
+    void write(size_t product,
+               const void* imageData,
+               size_t startRow,
+               size_t numRows);
+
+    /*!
+     * Same as writeNativeEndian() above but for one image product of a NITF
+     * holding several unrelated images.  Thread-safe.
+     *
+     * \param product The image product index
+     * \param imageData Native endian pixel data (blocked if the product is)
+     * \param startRow Start row of 'imageData' within the product
+     * \param numRows Number of rows in 'imageData'
+     */
+    void writeNativeEndian(size_t product,
+                           const void* imageData,
+                           size_t startRow,
+                           size_t numRows);
+
+    //! \return The number of bytes written so far
+    nitf::Off getNumBytesWritten() const;
+
+    /*!
+     * Flush the file to disk and rename it to the output pathname.  Throws
+     * if any part of the NITF hasn't been written.  Once this succeeds, no
+     * more writes are allowed.  If it throws while flushing or renaming, it
+     * may be called again.
+     */
+    void finalize();
+
+    //! \return The output pathname
+    const std::string& getPathname() const
+    {
+        return mPathname;
+    }
+
+    //! \return The pathname being written to until finalize() is called
+    const std::string& getTempPathname() const
+    {
+        return mTempPathname;
+    }
+
+private:
+    // Noncopyable
+    ParallelNITFFileSink(const ParallelNITFFileSink& );
+    const ParallelNITFFileSink& operator=(const ParallelNITFFileSink& );
+
+    void checkOpen() const;
+
+    void open();
+
+    // Claims [start, end) for one write, throwing if any of it is taken
+    void reserve(nitf::Off start, nitf::Off end);
+
+    void release(nitf::Off start);
+
+    void writeAt(nitf::Off fileOffset,
+                 const nitf::NITFBufferList& buffers);
+
+    void writeBuffers(nitf::Off fileOffset,
+                      const nitf::NITFBufferList& buffers);
+
+    void close();
+
+private:
+    const six::ByteProvider& mByteProvider;
+    const std::string mPathname;
+    std::string mTempPathname;
+    const nitf::Off mFileNumBytes;
+
+#ifdef WIN32
+    // No positional writes here, so writes are serialized on the handle
+    HANDLE mHandle;
+    sys::Mutex mHandleMutex;
+#else
+    int mHandle;
+#endif
+
+    mutable sys::Mutex mMutex;
+
+    // Start offset -> end offset of each region written (or being written)
+    std::map<nitf::Off, nitf::Off> mRegions;
+    nitf::Off mNumBytesWritten;
+    bool mFinalized;
+};
+}
+
+#endif
@@ -101,6 +101,64 @@ public:
     void addDecorrType(const std::string& name, const std::string& uri,
             DecorrType dt, XMLElem p) const;
 
+    // the same elements as the create/add methods above, written straight
+    // to 'writer' instead of into a DOM
+    void writeComplex(XMLStreamWriter& writer, const std::string& name,
+            std::complex<double> c) const;
+    void writeVector3D(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const Vector3& p) const;
+    void writeVector3D(XMLStreamWriter& writer, const std::string& name,
+            const Vector3& p) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& rowName,
+            const std::string& colName, const RowColInt& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& rowName, const std::string& colName,
+            const RowColInt& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& rowName,
+            const std::string& colName, const RowColDouble& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& rowName, const std::string& colName,
+            const RowColDouble& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const RowColInt& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const RowColInt& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const RowColDouble& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const RowColDouble& value) const;
+    void writeRowCol(XMLStreamWriter& writer, const std::string& name,
+            const RowColLatLon& value) const;
+    void writeRangeAzimuth(XMLStreamWriter& writer, const std::string& name,
+            const types::RgAz<double>& value) const;
+    void writeLatLon(XMLStreamWriter& writer, const std::string& name,
+            const LatLon& value) const;
+    void writeLatLonAlt(XMLStreamWriter& writer, const std::string& name,
+            const LatLonAlt& value) const;
+
+    void writePoly1D(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const Poly1D& poly1D) const;
+    void writePoly2D(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const Poly2D& poly2D) const;
+    void writePoly1D(XMLStreamWriter& writer, const std::string& name,
+            const Poly1D& poly1D) const;
+    void writePoly2D(XMLStreamWriter& writer, const std::string& name,
+            const Poly2D& poly2D) const;
+    void writePolyXYZ(XMLStreamWriter& writer, const std::string& name,
+            const PolyXYZ& polyXYZ) const;
+    void writeParameter(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const Parameter& value) const;
+    void writeParameters(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const ParameterCollection& props) const;
+    void writeParameter(XMLStreamWriter& writer, const std::string& name,
+            const Parameter& value) const;
+    void writeParameters(XMLStreamWriter& writer, const std::string& name,
+            const ParameterCollection& props) const;
+    void writeDecorrType(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, DecorrType dt) const;
+
     void parsePoly1D(XMLElem polyXML, Poly1D& poly1D) const;
     void parsePoly2D(XMLElem polyXML, Poly2D& poly2D) const;
     void parsePolyXYZ(XMLElem polyXML, PolyXYZ& polyXYZ) const;
@@ -152,6 +210,14 @@ public:
         const XMLElem radiometricXML, 
         Radiometric *obj) const = 0;
 
+    void writeErrorStatistics(
+        XMLStreamWriter& writer,
+        const ErrorStatistics* errorStatistics) const;
+
+    virtual void writeRadiometry(
+        XMLStreamWriter& writer,
+        const Radiometric *obj) const = 0;
+
 
 protected:
 
@@ -163,6 +229,10 @@ protected:
         const XMLElem errorStatsXML,
         ErrorStatistics* errorStatistics) const = 0;
 
+    virtual void writeCompositeSCP(
+        XMLStreamWriter& writer,
+        const ErrorStatistics* errorStatistics) const = 0;
+
 private:
     // TODO: Can we combine this with parsePoly1D()?
     void parsePoly(XMLElem polyXML, size_t xyzIdx, PolyXYZ& polyXYZ) const;
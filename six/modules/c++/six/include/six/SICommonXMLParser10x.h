@@ -45,6 +45,10 @@ public:
         const XMLElem radiometricXML, 
         Radiometric *obj) const;
 
+    virtual void writeRadiometry(
+        XMLStreamWriter& writer,
+        const Radiometric *obj) const;
+
 protected:
 
     virtual XMLElem convertCompositeSCPToXML(
@@ -55,6 +59,10 @@ protected:
         const XMLElem errorStatsXML,
         ErrorStatistics* errorStatistics) const;
 
+    virtual void writeCompositeSCP(
+        XMLStreamWriter& writer,
+        const ErrorStatistics* errorStatistics) const;
+
 };
 
 }
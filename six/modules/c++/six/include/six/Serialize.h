@@ -22,6 +22,7 @@
 #ifndef __SIX_SERIALIZE_H__
 #define __SIX_SERIALIZE_H__
 
+#include <string.h>
 #include <vector>
 #include <algorithm>
 #include <iterator>
@@ -30,6 +31,58 @@
 
 namespace six
 {
+/*!
+ * \struct IsBulkSerializable
+ * \tparam T Scalar type
+ * \brief Whether a vector of T can be serialized with one copy (and one
+ *  byte swap of sizeof(T) byte elements) rather than element by element.
+ *  True for the built-in arithmetic types.
+ */
+template<typename T>
+struct IsBulkSerializable
+{
+    static const bool value = false;
+};
+
+#define SIX_BULK_SERIALIZABLE(TYPE) \
+template<> \
+struct IsBulkSerializable<TYPE> \
+{ \
+    static const bool value = true; \
+};
+
+SIX_BULK_SERIALIZABLE(char)
+SIX_BULK_SERIALIZABLE(signed char)
+SIX_BULK_SERIALIZABLE(unsigned char)
+SIX_BULK_SERIALIZABLE(short)
+SIX_BULK_SERIALIZABLE(unsigned short)
+SIX_BULK_SERIALIZABLE(int)
+SIX_BULK_SERIALIZABLE(unsigned int)
+SIX_BULK_SERIALIZABLE(long)
+SIX_BULK_SERIALIZABLE(unsigned long)
+SIX_BULK_SERIALIZABLE(long long)
+SIX_BULK_SERIALIZABLE(unsigned long long)
+SIX_BULK_SERIALIZABLE(float)
+SIX_BULK_SERIALIZABLE(double)
+
+#undef SIX_BULK_SERIALIZABLE
+
+/*!
+ * Make room to append numBytes to a serialization buffer.  Grows the
+ * capacity geometrically so that many small appends stay linear.
+ * \param buffer Buffer that will be serialized into
+ * \param numBytes Number of bytes that will be appended
+ */
+inline
+void reserveSerializeBuffer(std::vector<sys::byte>& buffer, size_t numBytes)
+{
+    const size_t required = buffer.size() + numBytes;
+    if (buffer.capacity() < required)
+    {
+        buffer.reserve(std::max(required, 2 * buffer.capacity()));
+    }
+}
+
 /*!
  * \struct Serializer
  * \tparam T Scalar type
@@ -86,6 +139,15 @@ struct Serializer
 
         buffer += length;
     }
+
+    /*!
+     * \param val The value that would be serialized
+     * \return The number of bytes serializeImpl() would append
+     */
+    static size_t getSerializedSize(const T& /*val*/)
+    {
+        return sizeof(T);
+    }
 };
 
 /*!
@@ -109,11 +171,10 @@ struct Serializer<std::vector<T> >
     {
         const size_t length = val.size();
 
+        reserveSerializeBuffer(buffer, getSerializedSize(val));
         Serializer<size_t>::serializeImpl(length, swapBytes, buffer);
-        for (size_t ii = 0; ii < length; ++ii)
-        {
-            Serializer<T>::serializeImpl(val[ii], swapBytes, buffer);
-        }
+        serializeElements(val, swapBytes, buffer,
+                          BulkTag<IsBulkSerializable<T>::value>());
     }
 
     /*!
@@ -133,12 +194,221 @@ struct Serializer<std::vector<T> >
         Serializer<size_t>::deserializeImpl(buffer, swapBytes, length);
         val.resize(currentVectorLength + length);
 
+        deserializeElements(buffer, swapBytes, length, currentVectorLength,
+                            val, BulkTag<IsBulkSerializable<T>::value>());
+    }
+
+    /*!
+     * \param val The vector that would be serialized
+     * \return The number of bytes serializeImpl() would append
+     */
+    static size_t getSerializedSize(const std::vector<T>& val)
+    {
+        size_t numBytes = Serializer<size_t>::getSerializedSize(val.size());
+        if (IsBulkSerializable<T>::value)
+        {
+            numBytes += val.size() * sizeof(T);
+        }
+        else
+        {
+            for (size_t ii = 0; ii < val.size(); ++ii)
+            {
+                numBytes += Serializer<T>::getSerializedSize(val[ii]);
+            }
+        }
+        return numBytes;
+    }
+
+private:
+    template <bool IsBulk>
+    struct BulkTag
+    {
+    };
+
+    // One copy (or one vectorized swap) for the whole vector
+    static void serializeElements(const std::vector<T>& val,
+                                  bool swapBytes,
+                                  std::vector<sys::byte>& buffer,
+                                  BulkTag<true>)
+    {
+        if (val.empty())
+        {
+            return;
+        }
+
+        const size_t prevLength = buffer.size();
+        buffer.resize(prevLength + val.size() * sizeof(T));
+        if (swapBytes && sizeof(T) > 1)
+        {
+            sys::byteSwap(&val[0],
+                          static_cast<unsigned short>(sizeof(T)),
+                          val.size(),
+                          &buffer[prevLength]);
+        }
+        else
+        {
+            ::memcpy(&buffer[prevLength], &val[0], val.size() * sizeof(T));
+        }
+    }
+
+    static void serializeElements(const std::vector<T>& val,
+                                  bool swapBytes,
+                                  std::vector<sys::byte>& buffer,
+                                  BulkTag<false>)
+    {
+        for (size_t ii = 0; ii < val.size(); ++ii)
+        {
+            Serializer<T>::serializeImpl(val[ii], swapBytes, buffer);
+        }
+    }
+
+    static void deserializeElements(const sys::byte*& buffer,
+                                    bool swapBytes,
+                                    size_t length,
+                                    size_t startIndex,
+                                    std::vector<T>& val,
+                                    BulkTag<true>)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+
+        if (swapBytes && sizeof(T) > 1)
+        {
+            sys::byteSwap(buffer,
+                          static_cast<unsigned short>(sizeof(T)),
+                          length,
+                          &val[startIndex]);
+        }
+        else
+        {
+            ::memcpy(&val[startIndex], buffer, length * sizeof(T));
+        }
+        buffer += length * sizeof(T);
+    }
+
+    static void deserializeElements(const sys::byte*& buffer,
+                                    bool swapBytes,
+                                    size_t length,
+                                    size_t startIndex,
+                                    std::vector<T>& val,
+                                    BulkTag<false>)
+    {
         for (size_t ii = 0; ii < length; ++ii)
         {
             Serializer<T>::deserializeImpl(buffer, swapBytes,
-                val[currentVectorLength + ii]);
+                val[startIndex + ii]);
+        }
+    }
+};
+
+/*!
+ * \class SerializedVectorView
+ * \tparam T Scalar type
+ * \brief Read-only view of a vector serialized with Serializer, without
+ *  copying it out of the serialized buffer.  This lets large vectors be
+ *  read straight out of memory that's already holding the serialized data
+ *  (i.e. a memory mapped DES).
+ *
+ * The serialized buffer must outlive the view.  If the bytes need swapping
+ * or the elements aren't aligned in the buffer, each access swaps or copies
+ * the element; use copyTo() to pull out ranges in bulk.
+ */
+template<typename T>
+class SerializedVectorView
+{
+public:
+    SerializedVectorView() :
+        mData(NULL),
+        mSize(0),
+        mSwapBytes(false)
+    {
+    }
+
+    /*!
+     * \param data Start of the serialized elements (after the length)
+     * \param size Number of elements
+     * \param swapBytes Whether the elements need byte-swapping
+     */
+    SerializedVectorView(const sys::byte* data, size_t size, bool swapBytes) :
+        mData(data),
+        mSize(size),
+        mSwapBytes(swapBytes && sizeof(T) > 1)
+    {
+    }
+
+    //! \return The number of elements
+    size_t size() const
+    {
+        return mSize;
+    }
+
+    //! \return True if there are no elements
+    bool empty() const
+    {
+        return mSize == 0;
+    }
+
+    /*!
+     * \return The elements in place, or NULL if they need byte-swapping or
+     *  aren't suitably aligned
+     */
+    const T* data() const
+    {
+        if (mSwapBytes ||
+            reinterpret_cast<size_t>(mData) % sizeof(T) != 0)
+        {
+            return NULL;
+        }
+        return reinterpret_cast<const T*>(mData);
+    }
+
+    //! \return The element at 'index', byte-swapped if needed
+    T operator[](size_t index) const
+    {
+        T val;
+        copyTo(index, 1, &val);
+        return val;
+    }
+
+    /*!
+     * Copy a range of elements out, byte-swapping if needed
+     * \param startIndex First element to copy
+     * \param numElements Number of elements to copy
+     * \param[out] output Where to copy them to
+     */
+    void copyTo(size_t startIndex, size_t numElements, T* output) const
+    {
+        const sys::byte* const input = mData + startIndex * sizeof(T);
+        if (mSwapBytes)
+        {
+            sys::byteSwap(input,
+                          static_cast<unsigned short>(sizeof(T)),
+                          numElements,
+                          output);
+        }
+        else
+        {
+            ::memcpy(output, input, numElements * sizeof(T));
+        }
+    }
+
+    //! \return A copy of all the elements
+    std::vector<T> toVector() const
+    {
+        std::vector<T> values(mSize);
+        if (mSize > 0)
+        {
+            copyTo(0, mSize, &values[0]);
         }
+        return values;
     }
+
+private:
+    const sys::byte* mData;
+    size_t mSize;
+    bool mSwapBytes;
 };
 
 /*!
@@ -170,5 +440,41 @@ void deserialize(const sys::byte*& buffer, bool swapBytes, T& val)
 {
     Serializer<T>::deserializeImpl(buffer, swapBytes, val);
 }
+
+/*!
+ * Function interface to compute the serialized size
+ * \tparam T Data type to serialize
+ * \param val Value(s) that would be serialized
+ * \return The number of bytes serialize() would append
+ */
+template<typename T>
+size_t getSerializedSize(const T& val)
+{
+    return Serializer<T>::getSerializedSize(val);
+}
+
+/*!
+ * Deserialize a vector without copying its elements.  See
+ *  SerializedVectorView.
+ * \tparam T Element type.  Must be bulk serializable.
+ * \param buffer Address from which to begin deserialization. Pointer
+ *  is incremented past the vector after calling this function.
+ * \param swapBytes Should bytes be swapped?
+ * \param[out] view View of the serialized elements
+ */
+template<typename T>
+void deserializeView(const sys::byte*& buffer,
+                     bool swapBytes,
+                     SerializedVectorView<T>& view)
+{
+    // Compile time check that the elements are laid out contiguously
+    typedef char BulkSerializableCheck[IsBulkSerializable<T>::value ? 1 : -1];
+    (void)sizeof(BulkSerializableCheck);
+
+    size_t length;
+    Serializer<size_t>::deserializeImpl(buffer, swapBytes, length);
+    view = SerializedVectorView<T>(buffer, length, swapBytes);
+    buffer += length * sizeof(T);
+}
 }
 #endif
@@ -0,0 +1,133 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_STAGING_BUFFER_POOL_H__
+#define __SIX_STAGING_BUFFER_POOL_H__
+
+#include <vector>
+
+#include <sys/Conf.h>
+#include <sys/Mutex.h>
+#include <mem/SharedPtr.h>
+
+namespace six
+{
+/*!
+ * \class StagingBufferPool
+ * \brief Thread-safe pool of byte buffers.  Buffers handed back via
+ * release() are kept (up to a limit) and handed out again on the next
+ * acquire(), so repeated writes of similarly sized row bands don't keep
+ * allocating and freeing large blocks of memory.
+ */
+class StagingBufferPool
+{
+public:
+    /*!
+     * \param maxFreeBuffers The maximum number of released buffers to keep
+     * around for reuse.  Buffers released beyond this are freed.
+     */
+    explicit StagingBufferPool(size_t maxFreeBuffers = 8);
+
+    ~StagingBufferPool();
+
+    /*!
+     * \param numBytes Minimum size of the buffer
+     *
+     * \return A buffer with at least 'numBytes' bytes.  The caller owns it
+     * until it is passed back to release().
+     */
+    std::vector<sys::ubyte>* acquire(size_t numBytes);
+
+    /*!
+     * Return a buffer obtained from acquire() to the pool
+     *
+     * \param buffer Buffer to return.  May be NULL.
+     */
+    void release(std::vector<sys::ubyte>* buffer);
+
+    //! \return The number of buffers currently available for reuse
+    size_t getNumFreeBuffers() const;
+
+private:
+    // Noncopyable
+    StagingBufferPool(const StagingBufferPool& );
+    const StagingBufferPool& operator=(const StagingBufferPool& );
+
+private:
+    const size_t mMaxFreeBuffers;
+    mutable sys::Mutex mMutex;
+    std::vector<std::vector<sys::ubyte>*> mFreeBuffers;
+};
+
+/*!
+ * \class StagingBuffer
+ * \brief Scoped lease of a buffer from a StagingBufferPool.  The buffer goes
+ * back to the pool when this object is destroyed or reset.  Reusing the same
+ * StagingBuffer across calls keeps its memory if it's already large enough.
+ */
+class StagingBuffer
+{
+public:
+    StagingBuffer();
+
+    ~StagingBuffer();
+
+    /*!
+     * Make sure this object holds at least 'numBytes' bytes, leasing a buffer
+     * from 'pool' if needed.  Any buffer currently held from a different pool
+     * is returned to that pool first.
+     *
+     * \param pool Pool to lease from
+     * \param numBytes Minimum number of bytes needed
+     *
+     * \return Pointer to the start of the buffer
+     */
+    sys::ubyte* reserve(mem::SharedPtr<StagingBufferPool> pool,
+                        size_t numBytes);
+
+    //! Return the buffer (if any) to its pool
+    void reset();
+
+    //! \return Pointer to the start of the buffer, or NULL if nothing is held
+    sys::ubyte* get()
+    {
+        return (mBuffer && !mBuffer->empty()) ? &(*mBuffer)[0] : NULL;
+    }
+
+    //! \return Number of bytes held
+    size_t size() const
+    {
+        return mBuffer ? mBuffer->size() : 0;
+    }
+
+private:
+    // Noncopyable
+    StagingBuffer(const StagingBuffer& );
+    const StagingBuffer& operator=(const StagingBuffer& );
+
+private:
+    mem::SharedPtr<StagingBufferPool> mPool;
+    std::vector<sys::ubyte>* mBuffer;
+};
+}
+
+#endif
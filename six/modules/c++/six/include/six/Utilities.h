@@ -33,9 +33,12 @@
 #include "six/ErrorStatistics.h"
 #include "six/Init.h"
 #include <scene/Utilities.h>
+#include <scene/RPCModel.h>
+#include <nitf/TRE.hpp>
 #include <import/io.h>
 #include <import/xml/lite.h>
 #include <import/str.h>
+#include <cctype>
 #include <vector>
 #include <memory>
 
@@ -82,6 +85,37 @@ template<typename T> T toType(const std::string& s)
     return str::toType<T>(s);
 }
 
+/*!
+ * Parses one of the enums in six/Enums.h, ignoring whitespace at either end
+ * of s.  The characters are handed to the enum's (const char*, size_t)
+ * constructor, so s isn't copied.  The toType() specializations for enums
+ * use this.  NOT_SET is rejected as it never appears in a valid document.
+ *
+ * \throw except::InvalidFormatException if s isn't one of T's names
+ */
+template<typename T> T parseEnum(const std::string& s)
+{
+    const char* const begin = s.data();
+    const char* end = begin + s.size();
+    const char* first = begin;
+    while (first != end && std::isspace(static_cast<unsigned char>(*first)))
+    {
+        ++first;
+    }
+    while (end != first &&
+           std::isspace(static_cast<unsigned char>(*(end - 1))))
+    {
+        --end;
+    }
+    const T value(first, end - first);
+    if (value == T::NOT_SET)
+    {
+        throw except::InvalidFormatException(Ctxt(
+                "Invalid enum value: " + s));
+    }
+    return value;
+}
+
 template<> std::string toString(const float& value);
 template<> std::string toString(const double& value);
 template<> std::string toString(const six::Vector3 & v);
@@ -178,6 +212,44 @@ void loadPluginDir(const std::string& pluginDir);
  */
 void loadXmlDataContentHandler();
 
+/*
+ * Used to ensure the PluginRegistry singleton has loaded the RPC00B handler.
+ * This is used internally by NITFReadControl and createRPC00B() and should
+ * not need to be called directly.
+ */
+void loadRPC00BHandler();
+
+/*
+ * Creates an RPC00B TRE holding an RPC.  The coefficients are rounded to
+ * the 7 significant digits the TRE holds.  Unknown (negative) errors are
+ * written as 0000.00, since ERR_BIAS and ERR_RAND only allow 0000.00 to
+ * 9999.99.
+ *
+ * \param rpc The RPC
+ * \param firstRow Row of the full image that the TRE's image segment
+ * starts at.  The TRE's lines are relative to its image segment, so for
+ * multi-segment images, this shifts the RPC so it applies to that segment.
+ *
+ * \return The TRE
+ *
+ * \throws except::Exception if a value doesn't fit in its field
+ */
+nitf::TRE createRPC00B(const scene::RPCModel& rpc, size_t firstRow = 0);
+
+/*
+ * Parses an RPC out of an RPC00B TRE
+ *
+ * \param tre The TRE
+ * \param firstRow Row of the full image that the TRE's image segment
+ * starts at.  The returned RPC's lines are relative to the full image.
+ *
+ * \return The RPC
+ *
+ * \throws except::Exception if the TRE isn't an RPC00B or its SUCCESS
+ * field is 0
+ */
+scene::RPCModel parseRPC00B(nitf::TRE tre, size_t firstRow = 0);
+
 /*
  * Parses the XML in 'xmlStream' and converts it into a Data object
  *
@@ -29,6 +29,7 @@
 
 namespace six
 {
+class XMLStreamWriter;
 
 /*!
  *  \class XMLControl
@@ -73,6 +74,25 @@ public:
     xml::lite::Document* toXML(const Data* data,
                                const std::vector<std::string>& schemaPaths);
 
+    /*!
+     *  Write the Data model straight to 'writer' as XML, without building
+     *  a DOM.  The output is identical to printing the root element of
+     *  the DOM from toXML().  Nothing is validated.
+     *  \param data    Data structure
+     *  \param writer  Where the XML goes
+     */
+    void toXML(const Data* data, XMLStreamWriter& writer);
+
+    /*!
+     *  Validate the XML for the Data model against the schemas.  The DOM
+     *  is only built when there is a schema to validate against.
+     *  \param data         Data structure
+     *  \param schemaPaths  Directories or files of schema locations.  If
+     *                      empty, SIX_SCHEMA_PATH is used if it is set.
+     */
+    void validate(const Data* data,
+                  const std::vector<std::string>& schemaPaths);
+
     /*!
      *  Convert a document from a DOM into a Data model
      *  \param doc          XML Document
@@ -116,6 +136,13 @@ protected:
      */
     virtual xml::lite::Document* toXMLImpl(const Data* data) = 0;
 
+    /*!
+     *  Write the Data model straight to 'writer' as XML
+     *  \param data the Data model
+     *  \param writer Where the XML goes
+     */
+    virtual void toXMLImpl(const Data* data, XMLStreamWriter& writer) = 0;
+
     static
     std::string getDefaultURI(const Data& data);
 
@@ -30,6 +30,8 @@
 
 namespace six
 {
+class XMLStreamWriter;
+
 class XMLParser
 {
 public:
@@ -112,6 +114,49 @@ protected:
     XMLElem createDate(const std::string& name, const DateTime& p,
             XMLElem parent = NULL) const;
 
+    // the same elements as the create methods above, written straight to
+    // 'writer' instead of into a DOM, w/URI
+    void writeString(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& p) const;
+
+    void writeInt(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, int p) const;
+
+    void writeInt(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& p) const;
+
+    void writeDouble(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, double p) const;
+
+    //! \return false (and nothing is written) if 'b' is NOT_SET
+    bool writeBooleanType(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, BooleanType b) const;
+
+    void writeDateTime(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const DateTime& p) const;
+
+    void writeDateTime(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& s) const;
+
+    void writeDate(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const DateTime& p) const;
+
+    // the same, using default URI
+    void writeString(XMLStreamWriter& writer, const std::string& name,
+            const std::string& p) const;
+    void writeInt(XMLStreamWriter& writer, const std::string& name,
+            int p) const;
+    void writeDouble(XMLStreamWriter& writer, const std::string& name,
+            double p) const;
+    bool writeBooleanType(XMLStreamWriter& writer, const std::string& name,
+            BooleanType b) const;
+    void writeDateTime(XMLStreamWriter& writer, const std::string& name,
+            const DateTime& p) const;
+    void writeDateTime(XMLStreamWriter& writer, const std::string& name,
+            const std::string& s) const;
+    void writeDate(XMLStreamWriter& writer, const std::string& name,
+            const DateTime& p) const;
+
     template <typename T>
     void parseInt(XMLElem element, T& value) const
     {
@@ -152,7 +197,17 @@ protected:
      */
     static XMLElem require(XMLElem element, const std::string& name);
 
+    /*!
+     * Require an element to have been written
+     * @throw throws an Exception if 'written' is false
+     */
+    static void require(bool written, const std::string& name);
+
 private:
+    void writeElement(XMLStreamWriter& writer, const std::string& name,
+            const std::string& uri, const std::string& classType,
+            const std::string& characterData) const;
+
     const std::string mDefaultURI;
     const bool mAddClassAttributes;
 
@@ -0,0 +1,165 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __SIX_XML_STREAM_WRITER_H__
+#define __SIX_XML_STREAM_WRITER_H__
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <xml/lite/Element.h>
+
+namespace six
+{
+/*!
+ * \class XMLStreamWriter
+ * \brief Writes XML straight to a string, without building a DOM
+ *
+ * The output is byte for byte what xml::lite::Element::print() gives for the
+ * same tree: no whitespace between elements, elements with neither text nor
+ * children closed as <Name/>, and text and attribute values written as is
+ * (callers are responsible for anything that needs escaping, as with
+ * xml::lite).  The XMLParser and SICommonXMLParser write*() methods build on
+ * it the same way their create*() methods build on xml::lite::Element.
+ *
+ * Constructed without an output string, the writer only counts bytes.
+ * Running the same emitter once to count and once to write gives an exact
+ * size to reserve up front:
+ *
+ * \code
+    XMLStreamWriter counter;
+    emit(counter);
+
+    std::string xml;
+    xml.reserve(counter.getNumBytes());
+    XMLStreamWriter writer(&xml);
+    emit(writer);
+ * \endcode
+ *
+ * Elements are written in order, so an element's attributes must be added
+ * before its text, and its text before its children.  Namespace prefixes
+ * are declared up front with setNamespacePrefix(), where a DOM builder would
+ * call xml::lite::Element::setNamespacePrefix() on the finished tree.
+ */
+class XMLStreamWriter
+{
+public:
+    /*!
+     * \param output String to append to.  If NULL, bytes are only counted.
+     * Must outlive this object.
+     */
+    explicit XMLStreamWriter(std::string* output = NULL);
+
+    //! \return The number of bytes written (or counted) so far
+    size_t getNumBytes() const
+    {
+        return mNumBytes;
+    }
+
+    //! \return The number of elements that have been started but not ended
+    size_t getDepth() const
+    {
+        return mOpenElements.size();
+    }
+
+    //! Write 'text' as is (e.g. an XML declaration)
+    void writeRaw(const std::string& text);
+
+    /*!
+     * Start an element.  If 'uri' has been given a prefix with
+     * setNamespacePrefix(), the name gets that prefix.
+     */
+    void startElement(const std::string& name, const std::string& uri = "");
+
+    /*!
+     * Add an attribute to the element just started.  If 'uri' has been given
+     * a prefix with setNamespacePrefix(), the name gets that prefix.
+     */
+    void addAttribute(const std::string& name,
+                      const std::string& value,
+                      const std::string& uri = "");
+
+    /*!
+     * Add an attribute to the next element started, after any attributes
+     * added to it with addAttribute().  This is how an attribute is set on an
+     * element written by a helper, as a DOM builder sets one on the element
+     * a create*() method returns.
+     */
+    void addAttributeToNext(const std::string& name,
+                            const std::string& value,
+                            const std::string& uri = "");
+
+    /*!
+     * Declare 'prefix' for 'uri' on the element just started, and use it for
+     * every element and attribute in 'uri' written from now on.  An empty
+     * prefix declares the default namespace.
+     */
+    void setNamespacePrefix(const std::string& prefix, const std::string& uri);
+
+    //! Add text to the current element.  Empty text is ignored.
+    void addCharacters(const std::string& text);
+
+    void endElement();
+
+    //! \return The name of the innermost element not yet ended, if any
+    std::string getCurrentElement() const;
+
+    //! An element holding 'text'
+    void writeString(const std::string& name,
+                     const std::string& text,
+                     const std::string& uri = "");
+
+    //! Write an existing DOM subtree
+    void writeElement(const xml::lite::Element& element);
+
+private:
+    void write(const char* data, size_t numBytes);
+
+    void write(const std::string& text)
+    {
+        write(text.data(), text.size());
+    }
+
+    // Finish the current start tag since the element has content
+    void closeStartTag();
+
+    void writeAttribute(const std::string& qname, const std::string& value);
+
+    // Attributes from addAttributeToNext() for the element just started
+    void writePendingAttributes();
+
+    std::string qualify(const std::string& name, const std::string& uri) const;
+
+    typedef std::vector<std::pair<std::string, std::string> > AttributesT;
+
+    std::string* const mOutput;
+    size_t mNumBytes;
+    std::vector<std::string> mOpenElements;
+    bool mStartTagOpen;
+    AttributesT mNextAttributes;
+    AttributesT mPendingAttributes;
+    std::map<std::string, std::string> mPrefixes;
+};
+}
+
+#endif
@@ -20,20 +20,37 @@
  *
  */
 
+#include <algorithm>
+
 #include <str/Convert.h>
+#include <sys/OS.h>
 #include <logging/NullLogger.h>
 #include <six/ByteProvider.h>
+#include <six/ByteSwap.h>
+
+namespace
+{
+// Below this many bytes per thread, it's faster to swap on the calling
+// thread than to spin up more
+const size_t MIN_SWAP_BYTES_PER_THREAD = 1024 * 1024;
+}
 
 namespace six
 {
 
-ByteProvider::ByteProvider()
+ByteProvider::ByteProvider() :
+    mNumThreads(1),
+    mNumBytesPerElement(0),
+    mStagingPool(new StagingBufferPool())
 {
 }
 
 ByteProvider::ByteProvider(std::auto_ptr<six::NITFHeaderCreator> headerCreator,
                            const std::vector<std::string>& schemaPaths,
-                           const std::vector<PtrAndLength>& desBuffers)
+                           const std::vector<PtrAndLength>& desBuffers) :
+    mNumThreads(1),
+    mNumBytesPerElement(0),
+    mStagingPool(new StagingBufferPool())
 {
     initialize(headerCreator, schemaPaths, desBuffers);
 }
@@ -45,15 +62,22 @@ void ByteProvider::populateOptions(
         size_t numColsPerBlock,
         Options& options)
 {
-    if (container->getNumData() != 1)
+    if (container->getNumData() == 0)
     {
         throw except::Exception(Ctxt(
-                "Expected data of size 1 in container but got " +
-                str::toString(container->getNumData())));
+                "Expected at least one data in container"));
     }
 
-    const six::Data* const data = container->getData(0);
-
+    // Blocking is capped per image when the NITF is created, so here we
+    // just need to cap it at the largest one
+    size_t maxNumRows(0);
+    size_t maxNumCols(0);
+    for (size_t ii = 0; ii < container->getNumData(); ++ii)
+    {
+        const six::Data* const data = container->getData(ii);
+        maxNumRows = std::max(maxNumRows, data->getNumRows());
+        maxNumCols = std::max(maxNumCols, data->getNumCols());
+    }
 
     if (maxProductSize != 0)
     {
@@ -64,7 +88,7 @@ void ByteProvider::populateOptions(
 
     if (numRowsPerBlock != 0)
     {
-        numRowsPerBlock = std::min(numRowsPerBlock, data->getNumRows());
+        numRowsPerBlock = std::min(numRowsPerBlock, maxNumRows);
         options.setParameter(
                 six::NITFHeaderCreator::OPT_NUM_ROWS_PER_BLOCK,
                 numRowsPerBlock);
@@ -72,7 +96,7 @@ void ByteProvider::populateOptions(
 
     if (numColsPerBlock != 0)
     {
-        numColsPerBlock = std::min(numColsPerBlock, data->getNumCols());
+        numColsPerBlock = std::min(numColsPerBlock, maxNumCols);
         options.setParameter(
                 six::NITFHeaderCreator::OPT_NUM_COLS_PER_BLOCK,
                 numColsPerBlock);
@@ -121,28 +145,6 @@ void ByteProvider::populateInitArgs(
                 "Write control must be initialized first"));
     }
 
-    // We currently do not support the case where there are 2+ unrelated SIDDs
-    // in a file (but one logical SIDD which spans multiple image segments
-    // and/or contains SICD XML is ok).  This is a limitation in how
-    // nitf::ByteProvider computes row offsets.  So, ensure this constraint is
-    // met.
-    bool haveDerived(false);
-    for (size_t ii = 0; ii < container->getNumData(); ++ii)
-    {
-        if (container->getData(ii)->getDataType() == DataType::DERIVED)
-        {
-            if (!haveDerived)
-            {
-                haveDerived = true;
-            }
-            else
-            {
-                throw except::Exception(Ctxt(
-                        "Don't currently support more than one SIDD image"));
-            }
-        }
-    }
-
     // Create XML strings
     // This memory must stay around until the call to the
     // base class's initialize() method
@@ -173,6 +175,35 @@ void ByteProvider::populateInitArgs(
                                  zero));
 }
 
+void ByteProvider::populateImageProducts(
+        const NITFHeaderCreator& headerCreator,
+        std::vector<size_t>& numSegmentsPerProduct,
+        std::vector<std::vector<PtrAndLength> >& trailingImageData)
+{
+    // This mirrors the image segment layout in
+    // NITFHeaderCreator::initialize()
+    mem::SharedPtr<const Container> container = headerCreator.getContainer();
+    const std::vector<mem::SharedPtr<NITFImageInfo> > infos =
+            headerCreator.getInfos();
+
+    numSegmentsPerProduct.resize(infos.size());
+    trailingImageData.resize(infos.size());
+    for (size_t ii = 0; ii < infos.size(); ++ii)
+    {
+        numSegmentsPerProduct[ii] = infos[ii]->getImageSegments().size();
+
+        trailingImageData[ii].clear();
+        const Legend* const legend = container->getLegend(ii);
+        if (legend)
+        {
+            const void* const legendData = legend->mImage.empty() ?
+                    NULL : &legend->mImage[0];
+            trailingImageData[ii].push_back(
+                    PtrAndLength(legendData, legend->mImage.size()));
+        }
+    }
+}
+
 void ByteProvider::initialize(mem::SharedPtr<Container> container,
                               const XMLControlRegistry& xmlRegistry,
                               const std::vector<std::string>& schemaPaths,
@@ -198,35 +229,28 @@ void ByteProvider::initialize(const NITFWriteControl& writer,
                               const std::vector<std::string>& schemaPaths,
                               const std::vector<PtrAndLength>& desBuffers)
 {
-    // We don't explicitly use it, but each element in desData has a pointer
-    // into this vector, so we need it to stick around
-    std::vector<std::string> xmlStrings;
-    std::vector<PtrAndLength> desData;
-    size_t numRowsPerBlock;
-    size_t numColsPerBlock;
-    populateInitArgs(writer,
-                     schemaPaths,
-                     xmlStrings,
-                     desData,
-                     numRowsPerBlock,
-                     numColsPerBlock);
-
-    for (size_t ii = 0; ii < desBuffers.size(); ++ii)
+    const NITFHeaderCreator* headerCreator = writer.getNITFHeaderCreator();
+    if (!headerCreator)
     {
-        desData.push_back(desBuffers[ii]);
+        throw except::Exception(Ctxt("NITF writer is not populated"));
     }
 
-    // Do the full initialization
     nitf::Record record = writer.getRecord();
-    nitf::ByteProvider::initialize(record,
-                                   desData,
-                                   numRowsPerBlock,
-                                   numColsPerBlock);
+    initializeImpl(*headerCreator, record, schemaPaths, desBuffers);
 }
 
 void ByteProvider::initialize(std::auto_ptr<six::NITFHeaderCreator> headerCreator,
                               const std::vector<std::string>& schemaPaths,
                               const std::vector<PtrAndLength>& desBuffers)
+{
+    initializeImpl(*headerCreator, headerCreator->getRecord(), schemaPaths,
+                   desBuffers);
+}
+
+void ByteProvider::initializeImpl(const NITFHeaderCreator& headerCreator,
+                                  nitf::Record& record,
+                                  const std::vector<std::string>& schemaPaths,
+                                  const std::vector<PtrAndLength>& desBuffers)
 {
     // We don't explicitly use it, but each element in desData has a pointer
     // into this vector, so we need it to stick around
@@ -234,7 +258,7 @@ void ByteProvider::initialize(std::auto_ptr<six::NITFHeaderCreator> headerCreato
     std::vector<PtrAndLength> desData;
     size_t numRowsPerBlock;
     size_t numColsPerBlock;
-    populateInitArgs(*headerCreator.get(),
+    populateInitArgs(headerCreator,
                      schemaPaths,
                      xmlStrings,
                      desData,
@@ -246,12 +270,116 @@ void ByteProvider::initialize(std::auto_ptr<six::NITFHeaderCreator> headerCreato
         desData.push_back(desBuffers[ii]);
     }
 
+    std::vector<size_t> numSegmentsPerProduct;
+    std::vector<std::vector<PtrAndLength> > trailingImageData;
+    populateImageProducts(headerCreator,
+                          numSegmentsPerProduct,
+                          trailingImageData);
+
     // Do the full initialization
-    nitf::Record& record = headerCreator->getRecord();
     nitf::ByteProvider::initialize(record,
+                                   numSegmentsPerProduct,
+                                   trailingImageData,
                                    desData,
                                    numRowsPerBlock,
                                    numColsPerBlock);
+    initializeSwapInfo(record);
+}
+
+void ByteProvider::initializeSwapInfo(nitf::Record& record)
+{
+    // nitf::ByteProvider already verified every image segment within a
+    // product has the same pixel size, so the first one is representative
+    mNumBytesPerElement.resize(mImageProducts.size());
+    for (size_t ii = 0; ii < mImageProducts.size(); ++ii)
+    {
+        nitf::ImageSegment imageSegment =
+                record.getImages()[mImageProducts[ii].firstSegment];
+        nitf::ImageSubheader subheader = imageSegment.getSubheader();
+        mNumBytesPerElement[ii] =
+                NITF_NBPP_TO_BYTES(subheader.getActualBitsPerPixel());
+    }
+}
+
+size_t ByteProvider::getNumBytesPerElement(size_t product) const
+{
+    // Throws if 'product' is out of range
+    getProductInfo(product);
+    return mNumBytesPerElement[product];
+}
+
+void ByteProvider::setNumThreads(size_t numThreads)
+{
+    mNumThreads = (numThreads == 0) ? sys::OS().getNumCPUs() : numThreads;
+}
+
+size_t ByteProvider::getNumImageDataBytes(size_t product,
+                                          size_t startRow,
+                                          size_t numRows) const
+{
+    const ProductInfo& productInfo(getProductInfo(product));
+    const size_t imageDataEndRow = startRow + numRows;
+    size_t numRowsWithPad(0);
+
+    for (size_t seg = productInfo.firstSegment;
+         seg < productInfo.endSegment();
+         ++seg)
+    {
+        size_t startGlobalRowToWrite;
+        size_t numRowsToWrite;
+        if (mImageSegmentInfo[seg].isInRange(startRow, numRows,
+                                             startGlobalRowToWrite,
+                                             numRowsToWrite))
+        {
+            numRowsWithPad += numRowsToWrite +
+                    countPadRows(seg, numRowsToWrite, imageDataEndRow);
+        }
+    }
+
+    return numRowsWithPad * productInfo.numBytesPerRow;
+}
+
+void ByteProvider::getBytes(const void* imageData,
+                            size_t startRow,
+                            size_t numRows,
+                            nitf::Off& fileOffset,
+                            nitf::NITFBufferList& buffers,
+                            StagingBuffer& staging) const
+{
+    if (mImageProducts.empty())
+    {
+        getBytes(imageData, startRow, numRows, fileOffset, buffers);
+        return;
+    }
+
+    getBytes(0, imageData, startRow, numRows, fileOffset, buffers, staging);
+}
+
+void ByteProvider::getBytes(size_t product,
+                            const void* imageData,
+                            size_t startRow,
+                            size_t numRows,
+                            nitf::Off& fileOffset,
+                            nitf::NITFBufferList& buffers,
+                            StagingBuffer& staging) const
+{
+    const size_t numBytesPerElement = getNumBytesPerElement(product);
+    if (sys::isBigEndianSystem() || numBytesPerElement <= 1)
+    {
+        getBytes(product, imageData, startRow, numRows, fileOffset, buffers);
+        return;
+    }
+
+    const size_t numBytes = getNumImageDataBytes(product, startRow, numRows);
+    const size_t numElements = numBytes / numBytesPerElement;
+    const size_t numThreads = std::max<size_t>(
+            std::min(mNumThreads, numBytes / MIN_SWAP_BYTES_PER_THREAD), 1);
+
+    sys::ubyte* const swapped = staging.reserve(mStagingPool, numBytes);
+    six::byteSwap(imageData, numBytesPerElement, numElements, numThreads,
+                  swapped);
+
+    getBytes(product, swapped, startRow, numRows, fileOffset, buffers);
 }
 
 }
@@ -0,0 +1,104 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <sys/Conf.h>
+#include <sys/ByteSwap.h>
+#include <mt/ThreadPlanner.h>
+#include <tasks/TaskScheduler.h>
+#include <six/ByteSwap.h>
+
+namespace
+{
+class ByteSwapRunnable : public sys::Runnable
+{
+public:
+    ByteSwapRunnable(const void* input,
+                     size_t elemSize,
+                     size_t startElement,
+                     size_t numElements,
+                     void* output) :
+        mInput(static_cast<const sys::ubyte*>(input) +
+                       startElement * elemSize),
+        mElemSize(elemSize),
+        mNumElements(numElements),
+        mOutput(static_cast<sys::ubyte*>(output) + startElement * elemSize)
+    {
+    }
+
+    virtual void run()
+    {
+        sys::byteSwapElements(mInput,
+                              static_cast<unsigned short>(mElemSize),
+                              mNumElements,
+                              mOutput);
+    }
+
+private:
+    const sys::ubyte* const mInput;
+    const size_t mElemSize;
+    const size_t mNumElements;
+    sys::ubyte* const mOutput;
+};
+}
+
+namespace six
+{
+void byteSwap(const void* input,
+              size_t elemSize,
+              size_t numElements,
+              size_t numThreads,
+              void* output)
+{
+    if (numElements == 0)
+    {
+        return;
+    }
+
+    if (numThreads <= 1)
+    {
+        ByteSwapRunnable(input, elemSize, 0, numElements, output).run();
+    }
+    else
+    {
+        tasks::TaskGroup threads;
+        const mt::ThreadPlanner planner(numElements, numThreads);
+
+        size_t threadNum(0);
+        size_t startElement(0);
+        size_t numElementsThisThread(0);
+        while (planner.getThreadInfo(threadNum++,
+                                     startElement,
+                                     numElementsThisThread))
+        {
+            std::auto_ptr<sys::Runnable> thread(new ByteSwapRunnable(
+                    input,
+                    elemSize,
+                    startElement,
+                    numElementsThisThread,
+                    output));
+
+            threads.createTask(thread);
+        }
+        threads.wait();
+    }
+}
+}
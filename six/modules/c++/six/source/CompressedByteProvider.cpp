@@ -94,6 +94,25 @@ void CompressedByteProvider::initialize(
             numRowsPerBlock,
             numColsPerBlock);
 
+    // Unlike six::ByteProvider, nitf::CompressedByteProvider lays all the
+    // image segments out as one logical image, so there can only be one SIDD
+    // (though it may span multiple image segments and/or come with SICD XML)
+    mem::SharedPtr<const Container> container =
+            writer.getNITFHeaderCreator()->getContainer();
+    size_t numDerived(0);
+    for (size_t ii = 0; ii < container->getNumData(); ++ii)
+    {
+        if (container->getData(ii)->getDataType() == DataType::DERIVED)
+        {
+            ++numDerived;
+        }
+    }
+    if (numDerived > 1)
+    {
+        throw except::Exception(Ctxt(
+                "Don't currently support more than one compressed SIDD image"));
+    }
+
     // Do the full initialization
     nitf::Record record = writer.getRecord();
     nitf::CompressedByteProvider::initialize(
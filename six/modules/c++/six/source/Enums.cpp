@@ -0,0 +1,1654 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstring>
+
+#include <six/Enums.h>
+
+// -----------------------------------------------------------------------------
+// This file is auto-generated by build/makeEnums.py - please do NOT edit
+// directly
+// -----------------------------------------------------------------------------
+
+namespace
+{
+// One slot of a perfect hash table: every string an enum accepts hashes to
+// its own slot, so a lookup is one hash and one compare
+struct EnumEntry
+{
+    const char* name;
+    size_t length;
+    int value;
+};
+
+// A name toCString() returns, with its length so it needn't be measured
+struct EnumName
+{
+    const char* name;
+    size_t length;
+};
+
+inline const char* getName(const EnumName& entry, size_t* length)
+{
+    if (length)
+    {
+        *length = entry.length;
+    }
+    return entry.name;
+}
+
+// 32-bit FNV-1a, seeded with whatever makeEnums.py found to be collision
+// free for the table
+inline sys::Uint32_T hashName(const char* s, size_t length, sys::Uint32_T seed)
+{
+    sys::Uint32_T hash = seed;
+    for (size_t ii = 0; ii < length; ++ii)
+    {
+        hash ^= static_cast<unsigned char>(s[ii]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int lookup(const EnumEntry* table,
+           size_t tableSize,
+           sys::Uint32_T seed,
+           const char* s,
+           size_t length)
+{
+    const sys::Uint32_T hash = hashName(s, length, seed);
+    const EnumEntry& entry = table[(hash ^ (hash >> 16)) & (tableSize - 1)];
+    if (entry.name == NULL || entry.length != length ||
+        std::memcmp(entry.name, s, length) != 0)
+    {
+        throw except::InvalidFormatException(Ctxt(FmtX(
+                "Invalid enum value: %s", std::string(s, length).c_str())));
+    }
+    return entry.value;
+}
+}
+
+namespace six
+{
+
+// AppliedType
+namespace
+{
+const EnumEntry APPLIED_TYPE_TABLE[4] =
+{
+    {"IS_FALSE", 8, AppliedType::IS_FALSE},
+    {NULL, 0, 0},
+    {"IS_TRUE", 7, AppliedType::IS_TRUE},
+    {"NOT_SET", 7, AppliedType::NOT_SET}
+};
+
+const EnumName APPLIED_TYPE_NAMES[] =
+{
+    {"IS_FALSE", 8},
+    {"IS_TRUE", 7},
+    {"NOT_SET", 7}
+};
+}
+
+int AppliedType::parse(const char* s, size_t length)
+{
+    return lookup(APPLIED_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* AppliedType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(APPLIED_TYPE_NAMES[0], length);
+    case 1:
+        return getName(APPLIED_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(APPLIED_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string AppliedType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// AutofocusType
+namespace
+{
+const EnumEntry AUTOFOCUS_TYPE_TABLE[4] =
+{
+    {"NOT_SET", 7, AutofocusType::NOT_SET},
+    {"SV", 2, AutofocusType::SV},
+    {"GLOBAL", 6, AutofocusType::GLOBAL},
+    {"NO", 2, AutofocusType::NO}
+};
+
+const EnumName AUTOFOCUS_TYPE_NAMES[] =
+{
+    {"NO", 2},
+    {"GLOBAL", 6},
+    {"SV", 2},
+    {"NOT_SET", 7}
+};
+}
+
+int AutofocusType::parse(const char* s, size_t length)
+{
+    return lookup(AUTOFOCUS_TYPE_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* AutofocusType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(AUTOFOCUS_TYPE_NAMES[0], length);
+    case 1:
+        return getName(AUTOFOCUS_TYPE_NAMES[1], length);
+    case 2:
+        return getName(AUTOFOCUS_TYPE_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(AUTOFOCUS_TYPE_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string AutofocusType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// BooleanType
+namespace
+{
+const EnumEntry BOOLEAN_TYPE_TABLE[4] =
+{
+    {"IS_FALSE", 8, BooleanType::IS_FALSE},
+    {NULL, 0, 0},
+    {"IS_TRUE", 7, BooleanType::IS_TRUE},
+    {"NOT_SET", 7, BooleanType::NOT_SET}
+};
+
+const EnumName BOOLEAN_TYPE_NAMES[] =
+{
+    {"IS_FALSE", 8},
+    {"IS_TRUE", 7},
+    {"NOT_SET", 7}
+};
+}
+
+int BooleanType::parse(const char* s, size_t length)
+{
+    return lookup(BOOLEAN_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* BooleanType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(BOOLEAN_TYPE_NAMES[0], length);
+    case 1:
+        return getName(BOOLEAN_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(BOOLEAN_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string BooleanType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ByteSwapping
+namespace
+{
+const EnumEntry BYTE_SWAPPING_TABLE[4] =
+{
+    {"NOT_SET", 7, ByteSwapping::NOT_SET},
+    {"SWAP_AUTO", 9, ByteSwapping::SWAP_AUTO},
+    {"SWAP_ON", 7, ByteSwapping::SWAP_ON},
+    {"SWAP_OFF", 8, ByteSwapping::SWAP_OFF}
+};
+
+const EnumName BYTE_SWAPPING_NAMES[] =
+{
+    {"SWAP_OFF", 8},
+    {"SWAP_ON", 7},
+    {"SWAP_AUTO", 9},
+    {"NOT_SET", 7}
+};
+}
+
+int ByteSwapping::parse(const char* s, size_t length)
+{
+    return lookup(BYTE_SWAPPING_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* ByteSwapping::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(BYTE_SWAPPING_NAMES[0], length);
+    case 1:
+        return getName(BYTE_SWAPPING_NAMES[1], length);
+    case 2:
+        return getName(BYTE_SWAPPING_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(BYTE_SWAPPING_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ByteSwapping::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// CollectType
+namespace
+{
+const EnumEntry COLLECT_TYPE_TABLE[4] =
+{
+    {"BISTATIC", 8, CollectType::BISTATIC},
+    {NULL, 0, 0},
+    {"MONOSTATIC", 10, CollectType::MONOSTATIC},
+    {"NOT_SET", 7, CollectType::NOT_SET}
+};
+
+const EnumName COLLECT_TYPE_NAMES[] =
+{
+    {"MONOSTATIC", 10},
+    {"BISTATIC", 8},
+    {"NOT_SET", 7}
+};
+}
+
+int CollectType::parse(const char* s, size_t length)
+{
+    return lookup(COLLECT_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* CollectType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(COLLECT_TYPE_NAMES[0], length);
+    case 2:
+        return getName(COLLECT_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(COLLECT_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string CollectType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ComplexImageGridType
+namespace
+{
+const EnumEntry COMPLEX_IMAGE_GRID_TYPE_TABLE[8] =
+{
+    {"XRGYCR", 6, ComplexImageGridType::XRGYCR},
+    {"PLANE", 5, ComplexImageGridType::PLANE},
+    {"NOT_SET", 7, ComplexImageGridType::NOT_SET},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"RGZERO", 6, ComplexImageGridType::RGZERO},
+    {"XCTYAT", 6, ComplexImageGridType::XCTYAT},
+    {"RGAZIM", 6, ComplexImageGridType::RGAZIM}
+};
+
+const EnumName COMPLEX_IMAGE_GRID_TYPE_NAMES[] =
+{
+    {"RGAZIM", 6},
+    {"RGZERO", 6},
+    {"XRGYCR", 6},
+    {"XCTYAT", 6},
+    {"PLANE", 5},
+    {"NOT_SET", 7}
+};
+}
+
+int ComplexImageGridType::parse(const char* s, size_t length)
+{
+    return lookup(COMPLEX_IMAGE_GRID_TYPE_TABLE, 8, 0xf48780d6u, s, length);
+}
+
+const char* ComplexImageGridType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[0], length);
+    case 1:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[1], length);
+    case 2:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[2], length);
+    case 3:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[3], length);
+    case 4:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[4], length);
+    case six::NOT_SET_VALUE:
+        return getName(COMPLEX_IMAGE_GRID_TYPE_NAMES[5], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ComplexImageGridType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ComplexImagePlaneType
+namespace
+{
+const EnumEntry COMPLEX_IMAGE_PLANE_TYPE_TABLE[4] =
+{
+    {"GROUND", 6, ComplexImagePlaneType::GROUND},
+    {"OTHER", 5, ComplexImagePlaneType::OTHER},
+    {"SLANT", 5, ComplexImagePlaneType::SLANT},
+    {"NOT_SET", 7, ComplexImagePlaneType::NOT_SET}
+};
+
+const EnumName COMPLEX_IMAGE_PLANE_TYPE_NAMES[] =
+{
+    {"OTHER", 5},
+    {"SLANT", 5},
+    {"GROUND", 6},
+    {"NOT_SET", 7}
+};
+}
+
+int ComplexImagePlaneType::parse(const char* s, size_t length)
+{
+    return lookup(COMPLEX_IMAGE_PLANE_TYPE_TABLE, 4, 0x3669781bu, s, length);
+}
+
+const char* ComplexImagePlaneType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(COMPLEX_IMAGE_PLANE_TYPE_NAMES[0], length);
+    case 1:
+        return getName(COMPLEX_IMAGE_PLANE_TYPE_NAMES[1], length);
+    case 2:
+        return getName(COMPLEX_IMAGE_PLANE_TYPE_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(COMPLEX_IMAGE_PLANE_TYPE_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ComplexImagePlaneType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// DataType
+namespace
+{
+const EnumEntry DATA_TYPE_TABLE[4] =
+{
+    {NULL, 0, 0},
+    {"COMPLEX", 7, DataType::COMPLEX},
+    {"DERIVED", 7, DataType::DERIVED},
+    {"NOT_SET", 7, DataType::NOT_SET}
+};
+
+const EnumName DATA_TYPE_NAMES[] =
+{
+    {"COMPLEX", 7},
+    {"DERIVED", 7},
+    {"NOT_SET", 7}
+};
+}
+
+int DataType::parse(const char* s, size_t length)
+{
+    return lookup(DATA_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* DataType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(DATA_TYPE_NAMES[0], length);
+    case 2:
+        return getName(DATA_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(DATA_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string DataType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// DecimationMethod
+namespace
+{
+const EnumEntry DECIMATION_METHOD_TABLE[8] =
+{
+    {"LAGRANGE", 8, DecimationMethod::LAGRANGE},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"NOT_SET", 7, DecimationMethod::NOT_SET},
+    {"BRIGHTEST_PIXEL", 15, DecimationMethod::BRIGHTEST_PIXEL},
+    {NULL, 0, 0},
+    {"NEAREST_NEIGHBOR", 16, DecimationMethod::NEAREST_NEIGHBOR},
+    {"BILINEAR", 8, DecimationMethod::BILINEAR}
+};
+
+const EnumName DECIMATION_METHOD_NAMES[] =
+{
+    {"NEAREST_NEIGHBOR", 16},
+    {"BILINEAR", 8},
+    {"BRIGHTEST_PIXEL", 15},
+    {"LAGRANGE", 8},
+    {"NOT_SET", 7}
+};
+}
+
+int DecimationMethod::parse(const char* s, size_t length)
+{
+    return lookup(DECIMATION_METHOD_TABLE, 8, 0xbd8b9137u, s, length);
+}
+
+const char* DecimationMethod::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(DECIMATION_METHOD_NAMES[0], length);
+    case 2:
+        return getName(DECIMATION_METHOD_NAMES[1], length);
+    case 3:
+        return getName(DECIMATION_METHOD_NAMES[2], length);
+    case 4:
+        return getName(DECIMATION_METHOD_NAMES[3], length);
+    case six::NOT_SET_VALUE:
+        return getName(DECIMATION_METHOD_NAMES[4], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string DecimationMethod::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// DemodType
+namespace
+{
+const EnumEntry DEMOD_TYPE_TABLE[4] =
+{
+    {"NOT_SET", 7, DemodType::NOT_SET},
+    {"STRETCH", 7, DemodType::STRETCH},
+    {NULL, 0, 0},
+    {"CHIRP", 5, DemodType::CHIRP}
+};
+
+const EnumName DEMOD_TYPE_NAMES[] =
+{
+    {"STRETCH", 7},
+    {"CHIRP", 5},
+    {"NOT_SET", 7}
+};
+}
+
+int DemodType::parse(const char* s, size_t length)
+{
+    return lookup(DEMOD_TYPE_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* DemodType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(DEMOD_TYPE_NAMES[0], length);
+    case 2:
+        return getName(DEMOD_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(DEMOD_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string DemodType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// DisplayType
+namespace
+{
+const EnumEntry DISPLAY_TYPE_TABLE[4] =
+{
+    {NULL, 0, 0},
+    {"COLOR", 5, DisplayType::COLOR},
+    {"NOT_SET", 7, DisplayType::NOT_SET},
+    {"MONO", 4, DisplayType::MONO}
+};
+
+const EnumName DISPLAY_TYPE_NAMES[] =
+{
+    {"COLOR", 5},
+    {"MONO", 4},
+    {"NOT_SET", 7}
+};
+}
+
+int DisplayType::parse(const char* s, size_t length)
+{
+    return lookup(DISPLAY_TYPE_TABLE, 4, 0x72d86b8du, s, length);
+}
+
+const char* DisplayType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(DISPLAY_TYPE_NAMES[0], length);
+    case 2:
+        return getName(DISPLAY_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(DISPLAY_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string DisplayType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// DualPolarizationType
+namespace
+{
+const EnumEntry DUAL_POLARIZATION_TYPE_TABLE[16] =
+{
+    {"RHC_LHC", 7, DualPolarizationType::RHC_LHC},
+    {"UNKNOWN", 7, DualPolarizationType::UNKNOWN},
+    {"OTHER", 5, DualPolarizationType::OTHER},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"H_H", 3, DualPolarizationType::H_H},
+    {NULL, 0, 0},
+    {"LHC_RHC", 7, DualPolarizationType::LHC_RHC},
+    {"V_V", 3, DualPolarizationType::V_V},
+    {"RHC_RHC", 7, DualPolarizationType::RHC_RHC},
+    {"V_H", 3, DualPolarizationType::V_H},
+    {"NOT_SET", 7, DualPolarizationType::NOT_SET},
+    {NULL, 0, 0},
+    {"LHC_LHC", 7, DualPolarizationType::LHC_LHC},
+    {NULL, 0, 0},
+    {"H_V", 3, DualPolarizationType::H_V}
+};
+
+const EnumName DUAL_POLARIZATION_TYPE_NAMES[] =
+{
+    {"OTHER", 5},
+    {"V_V", 3},
+    {"V_H", 3},
+    {"H_V", 3},
+    {"H_H", 3},
+    {"RHC_RHC", 7},
+    {"RHC_LHC", 7},
+    {"LHC_RHC", 7},
+    {"LHC_LHC", 7},
+    {"UNKNOWN", 7},
+    {"NOT_SET", 7}
+};
+}
+
+int DualPolarizationType::parse(const char* s, size_t length)
+{
+    return lookup(DUAL_POLARIZATION_TYPE_TABLE, 16, 0x811c9dc5u, s, length);
+}
+
+const char* DualPolarizationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[0], length);
+    case 2:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[1], length);
+    case 3:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[2], length);
+    case 4:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[3], length);
+    case 5:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[4], length);
+    case 6:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[5], length);
+    case 7:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[6], length);
+    case 8:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[7], length);
+    case 9:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[8], length);
+    case 10:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[9], length);
+    case six::NOT_SET_VALUE:
+        return getName(DUAL_POLARIZATION_TYPE_NAMES[10], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string DualPolarizationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// EarthModelType
+namespace
+{
+const EnumEntry EARTH_MODEL_TYPE_TABLE[2] =
+{
+    {"NOT_SET", 7, EarthModelType::NOT_SET},
+    {"WGS84", 5, EarthModelType::WGS84}
+};
+
+const EnumName EARTH_MODEL_TYPE_NAMES[] =
+{
+    {"WGS84", 5},
+    {"NOT_SET", 7}
+};
+}
+
+int EarthModelType::parse(const char* s, size_t length)
+{
+    return lookup(EARTH_MODEL_TYPE_TABLE, 2, 0x1f54177eu, s, length);
+}
+
+const char* EarthModelType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(EARTH_MODEL_TYPE_NAMES[0], length);
+    case six::NOT_SET_VALUE:
+        return getName(EARTH_MODEL_TYPE_NAMES[1], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string EarthModelType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// FFTSign
+namespace
+{
+const EnumEntry FFTSIGN_TABLE[4] =
+{
+    {"NOT_SET", 7, FFTSign::NOT_SET},
+    {"POS", 3, FFTSign::POS},
+    {NULL, 0, 0},
+    {"NEG", 3, FFTSign::NEG}
+};
+
+const EnumName FFTSIGN_NAMES[] =
+{
+    {"NEG", 3},
+    {"POS", 3},
+    {"NOT_SET", 7}
+};
+}
+
+int FFTSign::parse(const char* s, size_t length)
+{
+    return lookup(FFTSIGN_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* FFTSign::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case -1:
+        return getName(FFTSIGN_NAMES[0], length);
+    case 1:
+        return getName(FFTSIGN_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(FFTSIGN_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string FFTSign::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ImageBeamCompensationType
+namespace
+{
+const EnumEntry IMAGE_BEAM_COMPENSATION_TYPE_TABLE[4] =
+{
+    {"NO", 2, ImageBeamCompensationType::NO},
+    {NULL, 0, 0},
+    {"SV", 2, ImageBeamCompensationType::SV},
+    {"NOT_SET", 7, ImageBeamCompensationType::NOT_SET}
+};
+
+const EnumName IMAGE_BEAM_COMPENSATION_TYPE_NAMES[] =
+{
+    {"NO", 2},
+    {"SV", 2},
+    {"NOT_SET", 7}
+};
+}
+
+int ImageBeamCompensationType::parse(const char* s, size_t length)
+{
+    return lookup(IMAGE_BEAM_COMPENSATION_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* ImageBeamCompensationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(IMAGE_BEAM_COMPENSATION_TYPE_NAMES[0], length);
+    case 1:
+        return getName(IMAGE_BEAM_COMPENSATION_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(IMAGE_BEAM_COMPENSATION_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ImageBeamCompensationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ImageFormationType
+namespace
+{
+const EnumEntry IMAGE_FORMATION_TYPE_TABLE[8] =
+{
+    {"PFA", 3, ImageFormationType::PFA},
+    {"RMA", 3, ImageFormationType::RMA},
+    {"OTHER", 5, ImageFormationType::OTHER},
+    {"NOT_SET", 7, ImageFormationType::NOT_SET},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"RGAZCOMP", 8, ImageFormationType::RGAZCOMP}
+};
+
+const EnumName IMAGE_FORMATION_TYPE_NAMES[] =
+{
+    {"OTHER", 5},
+    {"PFA", 3},
+    {"RMA", 3},
+    {"RGAZCOMP", 8},
+    {"NOT_SET", 7}
+};
+}
+
+int ImageFormationType::parse(const char* s, size_t length)
+{
+    return lookup(IMAGE_FORMATION_TYPE_TABLE, 8, 0x811c9dc5u, s, length);
+}
+
+const char* ImageFormationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(IMAGE_FORMATION_TYPE_NAMES[0], length);
+    case 1:
+        return getName(IMAGE_FORMATION_TYPE_NAMES[1], length);
+    case 2:
+        return getName(IMAGE_FORMATION_TYPE_NAMES[2], length);
+    case 3:
+        return getName(IMAGE_FORMATION_TYPE_NAMES[3], length);
+    case six::NOT_SET_VALUE:
+        return getName(IMAGE_FORMATION_TYPE_NAMES[4], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ImageFormationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// MagnificationMethod
+namespace
+{
+const EnumEntry MAGNIFICATION_METHOD_TABLE[4] =
+{
+    {"BILINEAR", 8, MagnificationMethod::BILINEAR},
+    {"NOT_SET", 7, MagnificationMethod::NOT_SET},
+    {"LAGRANGE", 8, MagnificationMethod::LAGRANGE},
+    {"NEAREST_NEIGHBOR", 16, MagnificationMethod::NEAREST_NEIGHBOR}
+};
+
+const EnumName MAGNIFICATION_METHOD_NAMES[] =
+{
+    {"NEAREST_NEIGHBOR", 16},
+    {"BILINEAR", 8},
+    {"LAGRANGE", 8},
+    {"NOT_SET", 7}
+};
+}
+
+int MagnificationMethod::parse(const char* s, size_t length)
+{
+    return lookup(MAGNIFICATION_METHOD_TABLE, 4, 0x64943955u, s, length);
+}
+
+const char* MagnificationMethod::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(MAGNIFICATION_METHOD_NAMES[0], length);
+    case 2:
+        return getName(MAGNIFICATION_METHOD_NAMES[1], length);
+    case 3:
+        return getName(MAGNIFICATION_METHOD_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(MAGNIFICATION_METHOD_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string MagnificationMethod::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// OrientationType
+namespace
+{
+const EnumEntry ORIENTATION_TYPE_TABLE[8] =
+{
+    {"UP", 2, OrientationType::UP},
+    {"LEFT", 4, OrientationType::LEFT},
+    {NULL, 0, 0},
+    {"ARBITRARY", 9, OrientationType::ARBITRARY},
+    {"RIGHT", 5, OrientationType::RIGHT},
+    {"NOT_SET", 7, OrientationType::NOT_SET},
+    {NULL, 0, 0},
+    {"DOWN", 4, OrientationType::DOWN}
+};
+
+const EnumName ORIENTATION_TYPE_NAMES[] =
+{
+    {"UP", 2},
+    {"DOWN", 4},
+    {"LEFT", 4},
+    {"RIGHT", 5},
+    {"ARBITRARY", 9},
+    {"NOT_SET", 7}
+};
+}
+
+int OrientationType::parse(const char* s, size_t length)
+{
+    return lookup(ORIENTATION_TYPE_TABLE, 8, 0x282545e3u, s, length);
+}
+
+const char* OrientationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(ORIENTATION_TYPE_NAMES[0], length);
+    case 2:
+        return getName(ORIENTATION_TYPE_NAMES[1], length);
+    case 3:
+        return getName(ORIENTATION_TYPE_NAMES[2], length);
+    case 4:
+        return getName(ORIENTATION_TYPE_NAMES[3], length);
+    case 5:
+        return getName(ORIENTATION_TYPE_NAMES[4], length);
+    case six::NOT_SET_VALUE:
+        return getName(ORIENTATION_TYPE_NAMES[5], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string OrientationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// PixelType
+namespace
+{
+const EnumEntry PIXEL_TYPE_TABLE[16] =
+{
+    {"MONO16I", 7, PixelType::MONO16I},
+    {NULL, 0, 0},
+    {"NOT_SET", 7, PixelType::NOT_SET},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"AMP8I_PHS8I", 11, PixelType::AMP8I_PHS8I},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"RGB8LU", 6, PixelType::RGB8LU},
+    {"RE16I_IM16I", 11, PixelType::RE16I_IM16I},
+    {"MONO8I", 6, PixelType::MONO8I},
+    {"RE32F_IM32F", 11, PixelType::RE32F_IM32F},
+    {"MONO8LU", 7, PixelType::MONO8LU},
+    {NULL, 0, 0},
+    {"RGB24I", 6, PixelType::RGB24I},
+    {NULL, 0, 0}
+};
+
+const EnumName PIXEL_TYPE_NAMES[] =
+{
+    {"RE32F_IM32F", 11},
+    {"RE16I_IM16I", 11},
+    {"AMP8I_PHS8I", 11},
+    {"MONO8I", 6},
+    {"MONO8LU", 7},
+    {"MONO16I", 7},
+    {"RGB8LU", 6},
+    {"RGB24I", 6},
+    {"NOT_SET", 7}
+};
+}
+
+int PixelType::parse(const char* s, size_t length)
+{
+    return lookup(PIXEL_TYPE_TABLE, 16, 0xc65cbf9cu, s, length);
+}
+
+const char* PixelType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(PIXEL_TYPE_NAMES[0], length);
+    case 2:
+        return getName(PIXEL_TYPE_NAMES[1], length);
+    case 3:
+        return getName(PIXEL_TYPE_NAMES[2], length);
+    case 4:
+        return getName(PIXEL_TYPE_NAMES[3], length);
+    case 5:
+        return getName(PIXEL_TYPE_NAMES[4], length);
+    case 6:
+        return getName(PIXEL_TYPE_NAMES[5], length);
+    case 7:
+        return getName(PIXEL_TYPE_NAMES[6], length);
+    case 8:
+        return getName(PIXEL_TYPE_NAMES[7], length);
+    case six::NOT_SET_VALUE:
+        return getName(PIXEL_TYPE_NAMES[8], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string PixelType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// PolarizationSequenceType
+namespace
+{
+const EnumEntry POLARIZATION_SEQUENCE_TYPE_TABLE[8] =
+{
+    {"H", 1, PolarizationSequenceType::H},
+    {"UNKNOWN", 7, PolarizationSequenceType::UNKNOWN},
+    {"V", 1, PolarizationSequenceType::V},
+    {"OTHER", 5, PolarizationSequenceType::OTHER},
+    {"NOT_SET", 7, PolarizationSequenceType::NOT_SET},
+    {"SEQUENCE", 8, PolarizationSequenceType::SEQUENCE},
+    {"RHC", 3, PolarizationSequenceType::RHC},
+    {"LHC", 3, PolarizationSequenceType::LHC}
+};
+
+const EnumName POLARIZATION_SEQUENCE_TYPE_NAMES[] =
+{
+    {"OTHER", 5},
+    {"V", 1},
+    {"H", 1},
+    {"RHC", 3},
+    {"LHC", 3},
+    {"UNKNOWN", 7},
+    {"SEQUENCE", 8},
+    {"NOT_SET", 7}
+};
+}
+
+int PolarizationSequenceType::parse(const char* s, size_t length)
+{
+    return lookup(POLARIZATION_SEQUENCE_TYPE_TABLE, 8, 0x0629dda0u, s, length);
+}
+
+const char* PolarizationSequenceType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[0], length);
+    case 2:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[1], length);
+    case 3:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[2], length);
+    case 4:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[3], length);
+    case 5:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[4], length);
+    case 6:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[5], length);
+    case 7:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[6], length);
+    case six::NOT_SET_VALUE:
+        return getName(POLARIZATION_SEQUENCE_TYPE_NAMES[7], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string PolarizationSequenceType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// PolarizationType
+namespace
+{
+const EnumEntry POLARIZATION_TYPE_TABLE[8] =
+{
+    {"OTHER", 5, PolarizationType::OTHER},
+    {"NOT_SET", 7, PolarizationType::NOT_SET},
+    {"RHC", 3, PolarizationType::RHC},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"H", 1, PolarizationType::H},
+    {"LHC", 3, PolarizationType::LHC},
+    {"V", 1, PolarizationType::V}
+};
+
+const EnumName POLARIZATION_TYPE_NAMES[] =
+{
+    {"OTHER", 5},
+    {"V", 1},
+    {"H", 1},
+    {"RHC", 3},
+    {"LHC", 3},
+    {"NOT_SET", 7}
+};
+}
+
+int PolarizationType::parse(const char* s, size_t length)
+{
+    return lookup(POLARIZATION_TYPE_TABLE, 8, 0x9831fe62u, s, length);
+}
+
+const char* PolarizationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(POLARIZATION_TYPE_NAMES[0], length);
+    case 2:
+        return getName(POLARIZATION_TYPE_NAMES[1], length);
+    case 3:
+        return getName(POLARIZATION_TYPE_NAMES[2], length);
+    case 4:
+        return getName(POLARIZATION_TYPE_NAMES[3], length);
+    case 5:
+        return getName(POLARIZATION_TYPE_NAMES[4], length);
+    case six::NOT_SET_VALUE:
+        return getName(POLARIZATION_TYPE_NAMES[5], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string PolarizationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// ProjectionType
+namespace
+{
+const EnumEntry PROJECTION_TYPE_TABLE[8] =
+{
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"CYLINDRICAL", 11, ProjectionType::CYLINDRICAL},
+    {"PLANE", 5, ProjectionType::PLANE},
+    {"POLYNOMIAL", 10, ProjectionType::POLYNOMIAL},
+    {"GEOGRAPHIC", 10, ProjectionType::GEOGRAPHIC},
+    {"NOT_SET", 7, ProjectionType::NOT_SET}
+};
+
+const EnumName PROJECTION_TYPE_NAMES[] =
+{
+    {"PLANE", 5},
+    {"GEOGRAPHIC", 10},
+    {"CYLINDRICAL", 11},
+    {"POLYNOMIAL", 10},
+    {"NOT_SET", 7}
+};
+}
+
+int ProjectionType::parse(const char* s, size_t length)
+{
+    return lookup(PROJECTION_TYPE_TABLE, 8, 0x5bc30af0u, s, length);
+}
+
+const char* ProjectionType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(PROJECTION_TYPE_NAMES[0], length);
+    case 2:
+        return getName(PROJECTION_TYPE_NAMES[1], length);
+    case 3:
+        return getName(PROJECTION_TYPE_NAMES[2], length);
+    case 4:
+        return getName(PROJECTION_TYPE_NAMES[3], length);
+    case six::NOT_SET_VALUE:
+        return getName(PROJECTION_TYPE_NAMES[4], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string ProjectionType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// RMAlgoType
+namespace
+{
+const EnumEntry RMALGO_TYPE_TABLE[4] =
+{
+    {"OMEGA_K", 7, RMAlgoType::OMEGA_K},
+    {"RG_DOP", 6, RMAlgoType::RG_DOP},
+    {"CSA", 3, RMAlgoType::CSA},
+    {"NOT_SET", 7, RMAlgoType::NOT_SET}
+};
+
+const EnumName RMALGO_TYPE_NAMES[] =
+{
+    {"OMEGA_K", 7},
+    {"CSA", 3},
+    {"RG_DOP", 6},
+    {"NOT_SET", 7}
+};
+}
+
+int RMAlgoType::parse(const char* s, size_t length)
+{
+    return lookup(RMALGO_TYPE_TABLE, 4, 0xc0e9bbc9u, s, length);
+}
+
+const char* RMAlgoType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(RMALGO_TYPE_NAMES[0], length);
+    case 2:
+        return getName(RMALGO_TYPE_NAMES[1], length);
+    case 3:
+        return getName(RMALGO_TYPE_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(RMALGO_TYPE_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string RMAlgoType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// RadarModeType
+namespace
+{
+const EnumEntry RADAR_MODE_TYPE_TABLE[8] =
+{
+    {NULL, 0, 0},
+    {NULL, 0, 0},
+    {"SPOTLIGHT", 9, RadarModeType::SPOTLIGHT},
+    {NULL, 0, 0},
+    {"DYNAMIC_STRIPMAP", 16, RadarModeType::DYNAMIC_STRIPMAP},
+    {"STRIPMAP", 8, RadarModeType::STRIPMAP},
+    {"SCANSAR", 7, RadarModeType::SCANSAR},
+    {"NOT_SET", 7, RadarModeType::NOT_SET}
+};
+
+const EnumName RADAR_MODE_TYPE_NAMES[] =
+{
+    {"SPOTLIGHT", 9},
+    {"STRIPMAP", 8},
+    {"DYNAMIC_STRIPMAP", 16},
+    {"SCANSAR", 7},
+    {"NOT_SET", 7}
+};
+}
+
+int RadarModeType::parse(const char* s, size_t length)
+{
+    return lookup(RADAR_MODE_TYPE_TABLE, 8, 0x3669781bu, s, length);
+}
+
+const char* RadarModeType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(RADAR_MODE_TYPE_NAMES[0], length);
+    case 2:
+        return getName(RADAR_MODE_TYPE_NAMES[1], length);
+    case 3:
+        return getName(RADAR_MODE_TYPE_NAMES[2], length);
+    case 4:
+        return getName(RADAR_MODE_TYPE_NAMES[3], length);
+    case six::NOT_SET_VALUE:
+        return getName(RADAR_MODE_TYPE_NAMES[4], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string RadarModeType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// RegionType
+namespace
+{
+const EnumEntry REGION_TYPE_TABLE[4] =
+{
+    {"GEOGRAPHIC_INFO", 15, RegionType::GEOGRAPHIC_INFO},
+    {"SUB_REGION", 10, RegionType::SUB_REGION},
+    {NULL, 0, 0},
+    {"NOT_SET", 7, RegionType::NOT_SET}
+};
+
+const EnumName REGION_TYPE_NAMES[] =
+{
+    {"SUB_REGION", 10},
+    {"GEOGRAPHIC_INFO", 15},
+    {"NOT_SET", 7}
+};
+}
+
+int RegionType::parse(const char* s, size_t length)
+{
+    return lookup(REGION_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* RegionType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 1:
+        return getName(REGION_TYPE_NAMES[0], length);
+    case 2:
+        return getName(REGION_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(REGION_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string RegionType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// RowColEnum
+namespace
+{
+const EnumEntry ROW_COL_ENUM_TABLE[4] =
+{
+    {"NOT_SET", 7, RowColEnum::NOT_SET},
+    {"COL", 3, RowColEnum::COL},
+    {"ROW", 3, RowColEnum::ROW},
+    {NULL, 0, 0}
+};
+
+const EnumName ROW_COL_ENUM_NAMES[] =
+{
+    {"ROW", 3},
+    {"COL", 3},
+    {"NOT_SET", 7}
+};
+}
+
+int RowColEnum::parse(const char* s, size_t length)
+{
+    return lookup(ROW_COL_ENUM_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* RowColEnum::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(ROW_COL_ENUM_NAMES[0], length);
+    case 1:
+        return getName(ROW_COL_ENUM_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(ROW_COL_ENUM_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string RowColEnum::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// SCPType
+namespace
+{
+const EnumEntry SCPTYPE_TABLE[4] =
+{
+    {NULL, 0, 0},
+    {"SCP_RG_AZ", 9, SCPType::SCP_RG_AZ},
+    {"SCP_ROW_COL", 11, SCPType::SCP_ROW_COL},
+    {"NOT_SET", 7, SCPType::NOT_SET}
+};
+
+const EnumName SCPTYPE_NAMES[] =
+{
+    {"SCP_ROW_COL", 11},
+    {"SCP_RG_AZ", 9},
+    {"NOT_SET", 7}
+};
+}
+
+int SCPType::parse(const char* s, size_t length)
+{
+    return lookup(SCPTYPE_TABLE, 4, 0xbd8b9137u, s, length);
+}
+
+const char* SCPType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(SCPTYPE_NAMES[0], length);
+    case 1:
+        return getName(SCPTYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(SCPTYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string SCPType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// SideOfTrackType
+namespace
+{
+const EnumEntry SIDE_OF_TRACK_TYPE_TABLE[4] =
+{
+    {"LEFT", 4, SideOfTrackType::LEFT},
+    {NULL, 0, 0},
+    {"RIGHT", 5, SideOfTrackType::RIGHT},
+    {"NOT_SET", 7, SideOfTrackType::NOT_SET}
+};
+
+const EnumName SIDE_OF_TRACK_TYPE_NAMES[] =
+{
+    {"LEFT", 4},
+    {"RIGHT", 5},
+    {"NOT_SET", 7}
+};
+}
+
+int SideOfTrackType::parse(const char* s, size_t length)
+{
+    return lookup(SIDE_OF_TRACK_TYPE_TABLE, 4, 0x811c9dc5u, s, length);
+}
+
+const char* SideOfTrackType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case scene::TRACK_LEFT:
+        return getName(SIDE_OF_TRACK_TYPE_NAMES[0], length);
+    case scene::TRACK_RIGHT:
+        return getName(SIDE_OF_TRACK_TYPE_NAMES[1], length);
+    case six::NOT_SET_VALUE:
+        return getName(SIDE_OF_TRACK_TYPE_NAMES[2], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string SideOfTrackType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// SlowTimeBeamCompensationType
+namespace
+{
+const EnumEntry SLOW_TIME_BEAM_COMPENSATION_TYPE_TABLE[4] =
+{
+    {"NOT_SET", 7, SlowTimeBeamCompensationType::NOT_SET},
+    {"SV", 2, SlowTimeBeamCompensationType::SV},
+    {"GLOBAL", 6, SlowTimeBeamCompensationType::GLOBAL},
+    {"NO", 2, SlowTimeBeamCompensationType::NO}
+};
+
+const EnumName SLOW_TIME_BEAM_COMPENSATION_TYPE_NAMES[] =
+{
+    {"NO", 2},
+    {"GLOBAL", 6},
+    {"SV", 2},
+    {"NOT_SET", 7}
+};
+}
+
+int SlowTimeBeamCompensationType::parse(const char* s, size_t length)
+{
+    return lookup(SLOW_TIME_BEAM_COMPENSATION_TYPE_TABLE, 4, 0x1f54177eu, s, length);
+}
+
+const char* SlowTimeBeamCompensationType::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(SLOW_TIME_BEAM_COMPENSATION_TYPE_NAMES[0], length);
+    case 1:
+        return getName(SLOW_TIME_BEAM_COMPENSATION_TYPE_NAMES[1], length);
+    case 2:
+        return getName(SLOW_TIME_BEAM_COMPENSATION_TYPE_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(SLOW_TIME_BEAM_COMPENSATION_TYPE_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string SlowTimeBeamCompensationType::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// XYZEnum
+namespace
+{
+const EnumEntry XYZENUM_TABLE[4] =
+{
+    {"X", 1, XYZEnum::X},
+    {"NOT_SET", 7, XYZEnum::NOT_SET},
+    {"Z", 1, XYZEnum::Z},
+    {"Y", 1, XYZEnum::Y}
+};
+
+const EnumName XYZENUM_NAMES[] =
+{
+    {"X", 1},
+    {"Y", 1},
+    {"Z", 1},
+    {"NOT_SET", 7}
+};
+}
+
+int XYZEnum::parse(const char* s, size_t length)
+{
+    return lookup(XYZENUM_TABLE, 4, 0xebb65271u, s, length);
+}
+
+const char* XYZEnum::toCString(size_t* length) const
+{
+    switch (value)
+    {
+    case 0:
+        return getName(XYZENUM_NAMES[0], length);
+    case 1:
+        return getName(XYZENUM_NAMES[1], length);
+    case 2:
+        return getName(XYZENUM_NAMES[2], length);
+    case six::NOT_SET_VALUE:
+        return getName(XYZENUM_NAMES[3], length);
+    default:
+        throw except::InvalidFormatException(Ctxt(FmtX("Invalid enum value: %d", value)));
+    }
+}
+
+std::string XYZEnum::toString() const
+{
+    size_t length;
+    const char* const name = toCString(&length);
+    return std::string(name, length);
+}
+
+// code auto-generated 2026-10-19 09:09:04.720552
+
+}
@@ -0,0 +1,328 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include <io/FileOutputStream.h>
+#include <mt/CriticalSection.h>
+#include <sys/Thread.h>
+#include <six/Instrumentation.h>
+
+#ifdef __CODA_CPP11
+#include <atomic>
+#endif
+
+namespace
+{
+// Every stage timer reads this, so it's only locked where there's no
+// atomic pointer access
+#if defined(__CODA_CPP11)
+std::atomic<six::InstrumentationSink*> sink(NULL);
+
+void storeSink(six::InstrumentationSink* sink_)
+{
+    sink.store(sink_, std::memory_order_release);
+}
+
+six::InstrumentationSink* loadSink()
+{
+    return sink.load(std::memory_order_acquire);
+}
+#elif defined(__clang__) || \
+        (defined(__GNUC__) && \
+         (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)))
+six::InstrumentationSink* sink = NULL;
+
+void storeSink(six::InstrumentationSink* sink_)
+{
+    __atomic_store_n(&sink, sink_, __ATOMIC_RELEASE);
+}
+
+six::InstrumentationSink* loadSink()
+{
+    return __atomic_load_n(&sink, __ATOMIC_ACQUIRE);
+}
+#elif defined(WIN32)
+six::InstrumentationSink* volatile sink = NULL;
+
+void storeSink(six::InstrumentationSink* sink_)
+{
+    InterlockedExchangePointer(
+            reinterpret_cast<PVOID volatile*>(&sink), sink_);
+}
+
+six::InstrumentationSink* loadSink()
+{
+    // Aligned pointer reads are atomic, and volatile reads have acquire
+    // semantics with MSVC
+    return sink;
+}
+#else
+six::InstrumentationSink* sink = NULL;
+sys::Mutex sinkMutex;
+
+void storeSink(six::InstrumentationSink* sink_)
+{
+    mt::CriticalSection<sys::Mutex> lock(&sinkMutex);
+    sink = sink_;
+}
+
+six::InstrumentationSink* loadSink()
+{
+    mt::CriticalSection<sys::Mutex> lock(&sinkMutex);
+    return sink;
+}
+#endif
+
+// sys::RealTimeStopWatch only has millisecond resolution, which is too
+// coarse for a single row band
+double getMonotonicMicroseconds()
+{
+#ifdef WIN32
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER count;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&count);
+    return static_cast<double>(count.QuadPart) * 1.0e6 / frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1.0e6 + now.tv_nsec * 1.0e-3;
+#endif
+}
+
+// Stage names are ours, so this only needs to handle what could plausibly
+// show up in one
+std::string escapeJSON(const char* str)
+{
+    std::string escaped;
+    for (; *str; ++str)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += *str;
+    }
+    return escaped;
+}
+}
+
+namespace six
+{
+StageMeasurement::StageMeasurement() :
+    stage(""),
+    startUS(0.0),
+    elapsedUS(0.0),
+    threadID(0),
+    numBytes(0),
+    numRows(0)
+{
+}
+
+InstrumentationSink::~InstrumentationSink()
+{
+}
+
+void InstrumentationSink::flush()
+{
+}
+
+StageStatistics::StageStatistics() :
+    count(0),
+    totalMS(0.0),
+    minMS(0.0),
+    maxMS(0.0),
+    numBytes(0),
+    numRows(0)
+{
+}
+
+void StageStatistics::add(const StageMeasurement& measurement)
+{
+    const double elapsedMS = measurement.elapsedUS / 1000.0;
+    if (count == 0)
+    {
+        minMS = maxMS = elapsedMS;
+    }
+    else
+    {
+        minMS = std::min(minMS, elapsedMS);
+        maxMS = std::max(maxMS, elapsedMS);
+    }
+
+    ++count;
+    totalMS += elapsedMS;
+    numBytes += measurement.numBytes;
+    numRows += measurement.numRows;
+}
+
+double StageStatistics::getBytesPerSecond() const
+{
+    return (totalMS > 0.0) ? numBytes / (totalMS / 1000.0) : 0.0;
+}
+
+void StatisticsSink::record(const StageMeasurement& measurement)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mStatistics[measurement.stage].add(measurement);
+}
+
+StatisticsSink::Snapshot StatisticsSink::getSnapshot() const
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    return mStatistics;
+}
+
+void StatisticsSink::clear()
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mStatistics.clear();
+}
+
+ChromeTraceSink::ChromeTraceSink(const std::string& pathname) :
+    mPathname(pathname)
+{
+}
+
+ChromeTraceSink::~ChromeTraceSink()
+{
+    try
+    {
+        flush();
+    }
+    catch (...)
+    {
+    }
+}
+
+void ChromeTraceSink::record(const StageMeasurement& measurement)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mMeasurements.push_back(measurement);
+}
+
+void ChromeTraceSink::flush()
+{
+    std::ostringstream ostr;
+    ostr << std::fixed << std::setprecision(3);
+    ostr << "{\"traceEvents\":[";
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        for (size_t ii = 0; ii < mMeasurements.size(); ++ii)
+        {
+            const StageMeasurement& measurement(mMeasurements[ii]);
+            ostr << (ii == 0 ? "\n" : ",\n")
+                 << "{\"name\":\"" << escapeJSON(measurement.stage)
+                 << "\",\"cat\":\"six\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                 << measurement.threadID
+                 << ",\"ts\":" << measurement.startUS
+                 << ",\"dur\":" << measurement.elapsedUS
+                 << ",\"args\":{\"bytes\":" << measurement.numBytes
+                 << ",\"rows\":" << measurement.numRows << "}}";
+        }
+    }
+    ostr << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    const std::string trace = ostr.str();
+    io::FileOutputStream outStream(mPathname);
+    outStream.write(trace);
+    outStream.close();
+}
+
+LoggerSink::LoggerSink(logging::Logger& log, logging::LogLevel level) :
+    mLog(log),
+    mLevel(level)
+{
+}
+
+void LoggerSink::record(const StageMeasurement& measurement)
+{
+    std::ostringstream ostr;
+    ostr << measurement.stage << ": " << measurement.elapsedUS / 1000.0
+         << " ms";
+    if (measurement.numBytes > 0)
+    {
+        ostr << ", " << measurement.numBytes << " bytes";
+        if (measurement.elapsedUS > 0.0)
+        {
+            ostr << " (" << measurement.numBytes / measurement.elapsedUS
+                 << " MB/s)";
+        }
+    }
+    if (measurement.numRows > 0)
+    {
+        ostr << ", " << measurement.numRows << " rows";
+    }
+
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mLog.log(mLevel, ostr.str());
+}
+
+void setInstrumentationSink(InstrumentationSink* sink_)
+{
+    storeSink(sink_);
+}
+
+InstrumentationSink* getInstrumentationSink()
+{
+    return loadSink();
+}
+
+#ifndef SIX_DISABLE_INSTRUMENTATION
+ScopedStageTimer::ScopedStageTimer(const char* stage) :
+    mSink(loadSink())
+{
+    if (mSink)
+    {
+        mMeasurement.stage = stage;
+        mMeasurement.startUS = getMonotonicMicroseconds();
+    }
+}
+
+ScopedStageTimer::~ScopedStageTimer()
+{
+    if (mSink)
+    {
+        mMeasurement.elapsedUS =
+                getMonotonicMicroseconds() - mMeasurement.startUS;
+        mMeasurement.threadID = sys::getThreadID();
+        try
+        {
+            mSink->record(mMeasurement);
+        }
+        catch (...)
+        {
+            // Don't throw out of the destructor
+        }
+    }
+}
+#endif
+}
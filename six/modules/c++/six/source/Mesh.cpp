@@ -60,4 +60,11 @@ std::vector<six::Parameter> Mesh::fieldsToParameters() const
 
     return parameters;
 }
+
+size_t Mesh::getSerializedSize() const
+{
+    std::vector<sys::byte> values;
+    serialize(values);
+    return values.size();
+}
 }
@@ -129,6 +129,37 @@ NITFHeaderCreator::NITFHeaderCreator(const six::Options& options,
     initialize(options, container);
 }
 
+void NITFHeaderCreator::addRPC00B(const scene::RPCModel& rpc,
+                                  size_t productNum)
+{
+    if (productNum >= mInfos.size())
+    {
+        throw except::Exception(Ctxt(
+                "Product " + str::toString(productNum) + " does not exist"));
+    }
+
+    // Each product's image segments are followed by its legend, if any
+    size_t segmentIdx = 0;
+    for (size_t ii = 0; ii < productNum; ++ii)
+    {
+        segmentIdx += mInfos[ii]->getImageSegments().size();
+        if (mContainer->getLegend(ii))
+        {
+            ++segmentIdx;
+        }
+    }
+
+    const std::vector<NITFSegmentInfo> imageSegments =
+            mInfos[productNum]->getImageSegments();
+    for (size_t ii = 0; ii < imageSegments.size(); ++ii, ++segmentIdx)
+    {
+        nitf::ImageSegment imageSegment =
+                mRecord.getImages()[static_cast<int>(segmentIdx)];
+        nitf::TRE tre = createRPC00B(rpc, imageSegments[ii].firstRow);
+        imageSegment.getSubheader().getExtendedSection().appendTRE(tre);
+    }
+}
+
 std::string NITFHeaderCreator::getComplexIID(size_t segmentNum,
                                              size_t numImageSegments)
 {
@@ -22,6 +22,7 @@
 
 #include <sstream>
 
+#include <six/Instrumentation.h>
 #include <six/NITFReadControl.h>
 #include <six/XMLControlFactory.h>
 #include <six/Utilities.h>
@@ -83,9 +84,10 @@ namespace six
 {
 NITFReadControl::NITFReadControl()
 {
-    // Make sure that if we use XML_DATA_CONTENT that we've loaded it into the
-    // singleton PluginRegistry
+    // Make sure that if we use XML_DATA_CONTENT or RPC00B that we've loaded
+    // them into the singleton PluginRegistry
     loadXmlDataContentHandler();
+    loadRPC00BHandler();
 }
 
 DataType NITFReadControl::getDataType(nitf::Record& record)
@@ -259,6 +261,7 @@ void NITFReadControl::load(mem::SharedPtr<nitf::IOInterface> ioInterface)
 void NITFReadControl::load(mem::SharedPtr<nitf::IOInterface> ioInterface,
                            const std::vector<std::string>& schemaPaths)
 {
+    ScopedStageTimer timer("six.NITFReadControl.load");
     reset();
     mInterface = ioInterface;
 
@@ -431,6 +434,13 @@ void NITFReadControl::load(mem::SharedPtr<nitf::IOInterface> ioInterface,
 
         currentInfo->addSegment(si);
     }
+
+    // Filling in the classification above went through the non-const
+    // accessors, which keeps clones from sharing those blocks
+    for (size_t ii = 0; ii < mContainer->getNumData(); ++ii)
+    {
+        mContainer->getData(ii)->markShareable();
+    }
 }
 
 void NITFReadControl::addImageClassOptions(nitf::ImageSubheader& subheader,
@@ -592,6 +602,7 @@ NITFReadControl::getIndices(nitf::ImageSubheader& subheader) const
 
 UByte* NITFReadControl::interleaved(Region& region, size_t imageNumber)
 {
+    ScopedStageTimer timer("six.NITFReadControl.interleaved");
     NITFImageInfo* thisImage = mInfos[imageNumber];
 
     size_t numRowsTotal = thisImage->getData()->getNumRows();
@@ -691,14 +702,22 @@ UByte* NITFReadControl::interleaved(Region& region, size_t imageNumber)
                 mCompressionOptions);
 
         nitf::Uint8* bufferPtr = buffer + totalRead;
+        const size_t numBytesSeg = numColsReq * nbpp * numRowsReqSeg;
 
-        int padded;
-        imageReader.read(sw, &bufferPtr, &padded);
-        totalRead += numColsReq * nbpp * numRowsReqSeg;
+        {
+            ScopedStageTimer ioTimer("six.NITFReadControl.interleaved.io");
+            int padded;
+            imageReader.read(sw, &bufferPtr, &padded);
+            ioTimer.addBytes(numBytesSeg);
+            ioTimer.addRows(numRowsReqSeg);
+        }
+        totalRead += numBytesSeg;
         sw.setStartRow(0);
         numRowsLeft -= numRowsReqSeg;
     }
 
+    timer.addBytes(totalRead);
+    timer.addRows(numRowsReq);
     return buffer;
 }
 
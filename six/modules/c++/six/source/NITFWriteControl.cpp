@@ -27,6 +27,7 @@
 #include <mem/ScopedArray.h>
 #include <io/ByteStream.h>
 #include <nitf/IOStreamWriter.hpp>
+#include <six/Instrumentation.h>
 #include <six/NITFWriteControl.h>
 #include <six/XMLControlFactory.h>
 
@@ -176,6 +177,7 @@ void NITFWriteControl::save(
         nitf::IOInterface& outputFile,
         const std::vector<std::string>& schemaPaths)
 {
+    ScopedStageTimer timer("six.NITFWriteControl.save");
     nitf::Record& record = getRecord();
     mWriter.prepareIO(outputFile, record);
     const bool doByteSwap = shouldByteSwap();
@@ -219,6 +221,7 @@ void NITFWriteControl::save(
     }
 
     addDataAndWrite(schemaPaths);
+    timer.addBytes(outputFile.tell());
 }
 
 void NITFWriteControl::save(const BufferList& imageData,
@@ -239,6 +242,7 @@ void NITFWriteControl::save(
         nitf::IOInterface& outputFile,
         const std::vector<std::string>& schemaPaths)
 {
+    ScopedStageTimer timer("six.NITFWriteControl.save");
     nitf::Record& record = getRecord();
     mWriter.prepareIO(outputFile, record);
     const bool doByteSwap = shouldByteSwap();
@@ -368,6 +372,7 @@ void NITFWriteControl::save(
     }
 
     addDataAndWrite(schemaPaths);
+    timer.addBytes(outputFile.tell());
 }
 
 void NITFWriteControl::addDataAndWrite(
@@ -440,4 +445,9 @@ void NITFWriteControl::addAdditionalDES(mem::SharedPtr<nitf::SegmentWriter> segm
 {
     mNITFHeaderCreator->addAdditionalDES(segmentWriter);
 }
+
+void NITFWriteControl::addRPC00B(const scene::RPCModel& rpc, size_t productNum)
+{
+    mNITFHeaderCreator->addRPC00B(rpc, productNum);
+}
 }
@@ -19,10 +19,14 @@
  * see <http://www.gnu.org/licenses/>.
  *
  */
+#include <tasks/TaskScheduler.h>
+
 #include "six/Options.h"
 
 namespace six
 {
+const char Options::OPT_NUM_THREADS[] = "NumThreads";
+
 Options::~Options()
 {
 }
@@ -62,4 +66,14 @@ bool Options::operator==(const Options& rhs) const
 {
     return mParameters == rhs.mParameters;
 }
+
+void configureTaskScheduler(const Options& options)
+{
+    if (options.hasParameter(Options::OPT_NUM_THREADS))
+    {
+        const size_t numThreads = static_cast<size_t>(
+                options.getParameter(Options::OPT_NUM_THREADS));
+        tasks::SharedTaskScheduler::getInstance().setNumThreads(numThreads);
+    }
+}
 }
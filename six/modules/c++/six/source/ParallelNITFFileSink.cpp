@@ -0,0 +1,477 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <sstream>
+
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <limits.h>
+#endif
+
+#include <except/Exception.h>
+#include <sys/AtomicCounter.h>
+#include <sys/OS.h>
+#include <sys/Path.h>
+#include <sys/SystemException.h>
+#include <mt/CriticalSection.h>
+#include <six/ParallelNITFFileSink.h>
+
+namespace
+{
+// Distinguishes sinks in the same process writing to the same pathname
+sys::AtomicCounter tempCounter;
+
+std::string getTempPathname(const std::string& pathname)
+{
+    std::ostringstream ostr;
+    ostr << pathname << "." << sys::OS().getProcessId() << "."
+         << tempCounter.getThenIncrement() << ".tmp";
+    return ostr.str();
+}
+
+#ifndef WIN32
+#if defined(IOV_MAX)
+const size_t MAX_IOVECS = IOV_MAX;
+#else
+const size_t MAX_IOVECS = 16;
+#endif
+
+// Writes all of 'iov' starting at 'offset', resuming after partial writes
+void positionalWrite(int handle,
+                     nitf::Off offset,
+                     std::vector<struct iovec>& iov)
+{
+    size_t first = 0;
+    while (first < iov.size())
+    {
+        const size_t numIovecs = std::min(iov.size() - first, MAX_IOVECS);
+#if defined(__linux__)
+        const ssize_t numWritten =
+                ::pwritev(handle, &iov[first], static_cast<int>(numIovecs),
+                          offset);
+#else
+        const ssize_t numWritten =
+                ::pwrite(handle, iov[first].iov_base, iov[first].iov_len,
+                         offset);
+#endif
+        if (numWritten < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw sys::SystemException(Ctxt("Positional write failed"));
+        }
+
+        offset += numWritten;
+
+        // Skip past what was written
+        size_t remaining = static_cast<size_t>(numWritten);
+        while (first < iov.size() && remaining >= iov[first].iov_len)
+        {
+            remaining -= iov[first].iov_len;
+            ++first;
+        }
+        if (remaining > 0)
+        {
+            iov[first].iov_base =
+                    static_cast<sys::byte*>(iov[first].iov_base) + remaining;
+            iov[first].iov_len -= remaining;
+        }
+    }
+}
+#endif
+}
+
+namespace six
+{
+ParallelNITFFileSink::ParallelNITFFileSink(
+        const six::ByteProvider& byteProvider,
+        const std::string& pathname) :
+    mByteProvider(byteProvider),
+    mPathname(pathname),
+    mFileNumBytes(byteProvider.getFileNumBytes()),
+    mNumBytesWritten(0),
+    mFinalized(false)
+{
+    open();
+}
+
+void ParallelNITFFileSink::open()
+{
+    // Never reuse a temporary file someone else may be writing
+#ifdef WIN32
+    do
+    {
+        mTempPathname = ::getTempPathname(mPathname);
+        mHandle = ::CreateFile(mTempPathname.c_str(),
+                               GENERIC_WRITE,
+                               0,
+                               NULL,
+                               CREATE_NEW,
+                               FILE_ATTRIBUTE_NORMAL,
+                               NULL);
+    }
+    while (mHandle == INVALID_HANDLE_VALUE &&
+           ::GetLastError() == ERROR_FILE_EXISTS);
+    if (mHandle == INVALID_HANDLE_VALUE)
+    {
+        throw sys::SystemException(Ctxt("Error creating " + mTempPathname));
+    }
+
+    LARGE_INTEGER size;
+    size.QuadPart = mFileNumBytes;
+    if (!::SetFilePointerEx(mHandle, size, NULL, FILE_BEGIN) ||
+        !::SetEndOfFile(mHandle))
+    {
+        close();
+        sys::OS().remove(mTempPathname);
+        throw sys::SystemException(Ctxt("Error sizing " + mTempPathname));
+    }
+#else
+    do
+    {
+        mTempPathname = ::getTempPathname(mPathname);
+        mHandle = ::open(mTempPathname.c_str(),
+                         O_WRONLY | O_CREAT | O_EXCL, 0644);
+    }
+    while (mHandle < 0 && errno == EEXIST);
+    if (mHandle < 0)
+    {
+        throw sys::SystemException(Ctxt("Error creating " + mTempPathname));
+    }
+
+    // Sizing the file up front means concurrent writes never extend it
+    if (::ftruncate(mHandle, mFileNumBytes) != 0)
+    {
+        close();
+        ::unlink(mTempPathname.c_str());
+        throw sys::SystemException(Ctxt("Error sizing " + mTempPathname));
+    }
+#endif
+}
+
+ParallelNITFFileSink::~ParallelNITFFileSink()
+{
+    // After a successful finalize() the temporary file is already gone
+    try
+    {
+        close();
+        sys::OS os;
+        if (os.exists(mTempPathname))
+        {
+            os.remove(mTempPathname);
+        }
+    }
+    catch (...)
+    {
+        // Don't throw out of the destructor
+    }
+}
+
+void ParallelNITFFileSink::close()
+{
+#ifdef WIN32
+    if (mHandle != INVALID_HANDLE_VALUE)
+    {
+        ::CloseHandle(mHandle);
+        mHandle = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (mHandle >= 0)
+    {
+        ::close(mHandle);
+        mHandle = -1;
+    }
+#endif
+}
+
+void ParallelNITFFileSink::checkOpen() const
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    if (mFinalized)
+    {
+        throw except::Exception(Ctxt(
+                "Cannot write to " + mPathname + " after it's finalized"));
+    }
+}
+
+void ParallelNITFFileSink::reserve(nitf::Off start, nitf::Off end)
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+
+    // The first region starting at or after 'start' must start at or after
+    // 'end', and the one before it must end at or before 'start'
+    std::map<nitf::Off, nitf::Off>::iterator next =
+            mRegions.lower_bound(start);
+    bool overlaps = (next != mRegions.end() && next->first < end);
+    if (!overlaps && next != mRegions.begin())
+    {
+        std::map<nitf::Off, nitf::Off>::iterator prev = next;
+        --prev;
+        overlaps = (prev->second > start);
+    }
+
+    if (overlaps)
+    {
+        std::ostringstream ostr;
+        ostr << "Bytes [" << start << ", " << end << ") of " << mPathname
+             << " overlap a region that has already been written";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    mRegions.insert(next, std::make_pair(start, end));
+}
+
+void ParallelNITFFileSink::release(nitf::Off start)
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    mRegions.erase(start);
+}
+
+void ParallelNITFFileSink::writeAt(nitf::Off fileOffset,
+                                   const nitf::NITFBufferList& buffers)
+{
+    const nitf::Off numBytes = buffers.getTotalNumBytes();
+    if (fileOffset < 0 || fileOffset + numBytes > mFileNumBytes)
+    {
+        std::ostringstream ostr;
+        ostr << "Writing " << numBytes << " bytes at offset " << fileOffset
+             << " would go past the end of the " << mFileNumBytes
+             << " byte file";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    if (numBytes == 0)
+    {
+        return;
+    }
+
+    // Claim the region first so two threads can't write the same bytes
+    reserve(fileOffset, fileOffset + numBytes);
+    try
+    {
+        writeBuffers(fileOffset, buffers);
+    }
+    catch (...)
+    {
+        release(fileOffset);
+        throw;
+    }
+
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    mNumBytesWritten += numBytes;
+}
+
+void ParallelNITFFileSink::writeBuffers(nitf::Off fileOffset,
+                                        const nitf::NITFBufferList& buffers)
+{
+#ifdef WIN32
+    mt::CriticalSection<sys::Mutex> obtainLock(&mHandleMutex);
+
+    LARGE_INTEGER offset;
+    offset.QuadPart = fileOffset;
+    if (!::SetFilePointerEx(mHandle, offset, NULL, FILE_BEGIN))
+    {
+        throw sys::SystemException(Ctxt("Error seeking in " + mTempPathname));
+    }
+
+    for (size_t ii = 0; ii < buffers.mBuffers.size(); ++ii)
+    {
+        const sys::byte* ptr =
+                static_cast<const sys::byte*>(buffers.mBuffers[ii].mData);
+        size_t remaining = buffers.mBuffers[ii].mNumBytes;
+        while (remaining > 0)
+        {
+            DWORD numWritten(0);
+            const DWORD toWrite = static_cast<DWORD>(
+                    std::min<size_t>(remaining, 1 << 30));
+            if (!::WriteFile(mHandle, ptr, toWrite, &numWritten, NULL))
+            {
+                throw sys::SystemException(Ctxt(
+                        "Error writing to " + mTempPathname));
+            }
+            ptr += numWritten;
+            remaining -= numWritten;
+        }
+    }
+#else
+    std::vector<struct iovec> iov;
+    iov.reserve(buffers.mBuffers.size());
+    for (size_t ii = 0; ii < buffers.mBuffers.size(); ++ii)
+    {
+        if (buffers.mBuffers[ii].mNumBytes > 0)
+        {
+            struct iovec vec;
+            vec.iov_base = const_cast<void*>(buffers.mBuffers[ii].mData);
+            vec.iov_len = buffers.mBuffers[ii].mNumBytes;
+            iov.push_back(vec);
+        }
+    }
+
+    positionalWrite(mHandle, fileOffset, iov);
+#endif
+}
+
+void ParallelNITFFileSink::write(nitf::Off fileOffset,
+                                 const nitf::NITFBufferList& buffers)
+{
+    checkOpen();
+    writeAt(fileOffset, buffers);
+}
+
+void ParallelNITFFileSink::write(const void* imageData,
+                                 size_t startRow,
+                                 size_t numRows)
+{
+    checkOpen();
+
+    nitf::Off fileOffset;
+    nitf::NITFBufferList buffers;
+    mByteProvider.getBytes(imageData, startRow, numRows, fileOffset, buffers);
+    writeAt(fileOffset, buffers);
+}
+
+void ParallelNITFFileSink::writeNativeEndian(const void* imageData,
+                                             size_t startRow,
+                                             size_t numRows)
+{
+    checkOpen();
+
+    nitf::Off fileOffset;
+    nitf::NITFBufferList buffers;
+    StagingBuffer staging;
+    mByteProvider.getBytes(imageData, startRow, numRows, fileOffset, buffers,
+                           staging);
+    writeAt(fileOffset, buffers);
+}
+
+void ParallelNITFFileSink::write(size_t product,
+                                 const void* imageData,
+                                 size_t startRow,
+                                 size_t numRows)
+{
+    checkOpen();
+
+    nitf::Off fileOffset;
+    nitf::NITFBufferList buffers;
+    mByteProvider.getBytes(product, imageData, startRow, numRows, fileOffset,
+                           buffers);
+    writeAt(fileOffset, buffers);
+}
+
+void ParallelNITFFileSink::writeNativeEndian(size_t product,
+                                             const void* imageData,
+                                             size_t startRow,
+                                             size_t numRows)
+{
+    checkOpen();
+
+    nitf::Off fileOffset;
+    nitf::NITFBufferList buffers;
+    StagingBuffer staging;
+    mByteProvider.getBytes(product, imageData, startRow, numRows, fileOffset,
+                           buffers, staging);
+    writeAt(fileOffset, buffers);
+}
+
+nitf::Off ParallelNITFFileSink::getNumBytesWritten() const
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    return mNumBytesWritten;
+}
+
+void ParallelNITFFileSink::finalize()
+{
+    {
+        mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+        if (mFinalized)
+        {
+            return;
+        }
+
+        // Regions never overlap, so this means every byte has been written
+        if (mNumBytesWritten != mFileNumBytes)
+        {
+            std::ostringstream ostr;
+            ostr << "Only wrote " << mNumBytesWritten << " of "
+                 << mFileNumBytes << " bytes to " << mPathname;
+            throw except::Exception(Ctxt(ostr.str()));
+        }
+    }
+
+#ifdef WIN32
+    if (mHandle != INVALID_HANDLE_VALUE)
+    {
+        if (!::FlushFileBuffers(mHandle))
+        {
+            throw sys::SystemException(Ctxt(
+                    "Error flushing " + mTempPathname));
+        }
+        close();
+    }
+
+    if (!::MoveFileEx(mTempPathname.c_str(), mPathname.c_str(),
+                      MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        throw sys::SystemException(Ctxt(
+                "Error renaming " + mTempPathname + " to " + mPathname));
+    }
+#else
+    if (mHandle >= 0)
+    {
+        if (::fsync(mHandle) != 0)
+        {
+            throw sys::SystemException(Ctxt(
+                    "Error syncing " + mTempPathname));
+        }
+        close();
+    }
+
+    if (::rename(mTempPathname.c_str(), mPathname.c_str()) != 0)
+    {
+        throw sys::SystemException(Ctxt(
+                "Error renaming " + mTempPathname + " to " + mPathname));
+    }
+
+    // Sync the directory too so the rename itself survives a crash
+    std::string dirname = sys::Path::splitPath(mPathname).first;
+    if (dirname.empty())
+    {
+        dirname = ".";
+    }
+    const int dirHandle = ::open(dirname.c_str(), O_RDONLY);
+    if (dirHandle >= 0)
+    {
+        ::fsync(dirHandle);
+        ::close(dirHandle);
+    }
+#endif
+
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    mFinalized = true;
+}
+}
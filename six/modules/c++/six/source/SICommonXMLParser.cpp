@@ -25,6 +25,7 @@
 #include <six/Utilities.h>
 #include <six/SICommonXMLParser.h>
 #include <six/ParameterCollection.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -422,6 +423,248 @@ void SICommonXMLParser::addDecorrType(const std::string& name,
     }
 }
 
+void SICommonXMLParser::writeComplex(XMLStreamWriter& writer,
+        const std::string& name, std::complex<double> c) const
+{
+    writer.startElement(name, getDefaultURI());
+    writeDouble(writer, "Real", getSICommonURI(), c.real());
+    writeDouble(writer, "Imag", getSICommonURI(), c.imag());
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeVector3D(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const Vector3& p) const
+{
+    writer.startElement(name, (uri.empty()) ? getDefaultURI() : uri);
+    writeDouble(writer, "X", getSICommonURI(), p[0]);
+    writeDouble(writer, "Y", getSICommonURI(), p[1]);
+    writeDouble(writer, "Z", getSICommonURI(), p[2]);
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeVector3D(XMLStreamWriter& writer,
+        const std::string& name, const Vector3& p) const
+{
+    writeVector3D(writer, name, "", p);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const std::string& rowName, const std::string& colName,
+        const RowColInt& value) const
+{
+    writer.startElement(name, (uri.empty()) ? getDefaultURI() : uri);
+    writeInt(writer, rowName, getSICommonURI(), static_cast<int>(value.row));
+    writeInt(writer, colName, getSICommonURI(), static_cast<int>(value.col));
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& rowName,
+        const std::string& colName, const RowColInt& value) const
+{
+    writeRowCol(writer, name, "", rowName, colName, value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const std::string& rowName, const std::string& colName,
+        const RowColDouble& value) const
+{
+    writer.startElement(name, (uri.empty()) ? getDefaultURI() : uri);
+    writeDouble(writer, rowName, getSICommonURI(), value.row);
+    writeDouble(writer, colName, getSICommonURI(), value.col);
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& rowName,
+        const std::string& colName, const RowColDouble& value) const
+{
+    writeRowCol(writer, name, "", rowName, colName, value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const RowColInt& value) const
+{
+    writeRowCol(writer, name, uri, "Row", "Col", value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const RowColInt& value) const
+{
+    writeRowCol(writer, name, "", value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const RowColDouble& value) const
+{
+    writeRowCol(writer, name, uri, "Row", "Col", value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const RowColDouble& value) const
+{
+    writeRowCol(writer, name, "", value);
+}
+
+void SICommonXMLParser::writeRowCol(XMLStreamWriter& writer,
+        const std::string& name, const RowColLatLon& value) const
+{
+    writer.startElement(name, getDefaultURI());
+    writeLatLon(writer, "Row", value.row);
+    writeLatLon(writer, "Col", value.col);
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeRangeAzimuth(XMLStreamWriter& writer,
+        const std::string& name, const types::RgAz<double>& value) const
+{
+    writer.startElement(name, getDefaultURI());
+    writeDouble(writer, "Range", getSICommonURI(), value.rg);
+    writeDouble(writer, "Azimuth", getSICommonURI(), value.az);
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeLatLon(XMLStreamWriter& writer,
+        const std::string& name, const LatLon& value) const
+{
+    writer.startElement(name, getDefaultURI());
+    writeDouble(writer, "Lat", getSICommonURI(), value.getLat());
+    writeDouble(writer, "Lon", getSICommonURI(), value.getLon());
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeLatLonAlt(XMLStreamWriter& writer,
+        const std::string& name, const LatLonAlt& value) const
+{
+    writer.startElement(name, getDefaultURI());
+    writeDouble(writer, "Lat", getSICommonURI(), value.getLat());
+    writeDouble(writer, "Lon", getSICommonURI(), value.getLon());
+    writeDouble(writer, "HAE", getSICommonURI(), value.getAlt());
+    writer.endElement();
+}
+
+void SICommonXMLParser::writePoly1D(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const Poly1D& poly1D) const
+{
+    const size_t order = poly1D.order();
+    writer.startElement(name, uri);
+    writer.addAttribute("order1", six::toString(order));
+
+    for (size_t i = 0; i <= order; ++i)
+    {
+        writer.addAttributeToNext("exponent1", six::toString(i));
+        writeDouble(writer, "Coef", getSICommonURI(), poly1D[i]);
+    }
+    writer.endElement();
+}
+
+void SICommonXMLParser::writePoly1D(XMLStreamWriter& writer,
+        const std::string& name, const Poly1D& poly1D) const
+{
+    writePoly1D(writer, name, getDefaultURI(), poly1D);
+}
+
+void SICommonXMLParser::writePoly2D(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const Poly2D& poly2D) const
+{
+    writer.startElement(name, uri);
+    writer.addAttribute("order1", six::toString(poly2D.orderX()));
+    writer.addAttribute("order2", six::toString(poly2D.orderY()));
+
+    for (size_t i = 0; i <= poly2D.orderX(); i++)
+    {
+        for (size_t j = 0; j <= poly2D.orderY(); j++)
+        {
+            writer.addAttributeToNext("exponent1", six::toString(i));
+            writer.addAttributeToNext("exponent2", six::toString(j));
+            writeDouble(writer, "Coef", getSICommonURI(), poly2D[i][j]);
+        }
+    }
+    writer.endElement();
+}
+
+void SICommonXMLParser::writePoly2D(XMLStreamWriter& writer,
+        const std::string& name, const Poly2D& poly2D) const
+{
+    writePoly2D(writer, name, getDefaultURI(), poly2D);
+}
+
+void SICommonXMLParser::writePolyXYZ(XMLStreamWriter& writer,
+        const std::string& name, const PolyXYZ& polyXYZ) const
+{
+    const size_t order = polyXYZ.order();
+    writer.startElement(name, getDefaultURI());
+
+    // The DOM fills in X, Y and Z side by side, but they print one after
+    // the other
+    const char* const coordNames[] = {"X", "Y", "Z"};
+    for (size_t xyz = 0; xyz < 3; ++xyz)
+    {
+        writer.startElement(coordNames[xyz], getSICommonURI());
+        writer.addAttribute("order1", six::toString(order));
+        for (size_t i = 0; i <= order; ++i)
+        {
+            writer.addAttributeToNext("exponent1", six::toString(i));
+            writeDouble(writer, "Coef", getSICommonURI(), polyXYZ[i][xyz]);
+        }
+        writer.endElement();
+    }
+    writer.endElement();
+}
+
+void SICommonXMLParser::writeParameter(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const Parameter& value) const
+{
+    writer.addAttributeToNext("name", value.getName());
+    writeString(writer, name, uri, value.str());
+}
+
+void SICommonXMLParser::writeParameter(XMLStreamWriter& writer,
+        const std::string& name, const Parameter& value) const
+{
+    writeParameter(writer, name, getDefaultURI(), value);
+}
+
+void SICommonXMLParser::writeParameters(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const ParameterCollection& props) const
+{
+    for (six::ParameterCollection::ConstParameterCollectionIteratorT it = props.begin(); it
+            != props.end(); ++it)
+    {
+        writeParameter(writer, name, uri, *it);
+    }
+}
+
+void SICommonXMLParser::writeParameters(XMLStreamWriter& writer,
+        const std::string& name, const ParameterCollection& props) const
+{
+    writeParameters(writer, name, getDefaultURI(), props);
+}
+
+void SICommonXMLParser::writeDecorrType(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        DecorrType decorrType) const
+{
+    //only adds it if it needs to
+    if (!Init::isUndefined<double>(decorrType.corrCoefZero)
+            && !Init::isUndefined<double>(decorrType.decorrRate))
+    {
+        writer.startElement(name, uri);
+        writeDouble(writer, "CorrCoefZero", uri, decorrType.corrCoefZero);
+        writeDouble(writer, "DecorrRate", uri, decorrType.decorrRate);
+        writer.endElement();
+    }
+}
+
 void SICommonXMLParser::parseDecorrType(XMLElem decorrXML, 
                                         DecorrType& decorrType) const
 {
@@ -747,6 +990,142 @@ XMLElem SICommonXMLParser::convertErrorStatisticsToXML(
     return errorStatsXML;
 }
 
+void SICommonXMLParser::writeErrorStatistics(
+    XMLStreamWriter& writer,
+    const ErrorStatistics* errorStatistics) const
+{
+    writer.startElement("ErrorStatistics", getDefaultURI());
+
+    //! version specific implementation
+    writeCompositeSCP(writer, errorStatistics);
+
+    const Components* const components = errorStatistics->components.get();
+    if (components)
+    {
+        writer.startElement("Components", getSICommonURI());
+
+        const PosVelError* const posVelError = components->posVelError.get();
+        const RadarSensor* const radarSensor = components->radarSensor.get();
+        const TropoError* const tropoError = components->tropoError.get();
+        const IonoError* const ionoError = components->ionoError.get();
+
+        if (posVelError)
+        {
+            writer.startElement("PosVelErr", getSICommonURI());
+
+            writeString(writer, "Frame", getSICommonURI(),
+                        six::toString(posVelError->frame));
+            writeDouble(writer, "P1", getSICommonURI(), posVelError->p1);
+            writeDouble(writer, "P2", getSICommonURI(), posVelError->p2);
+            writeDouble(writer, "P3", getSICommonURI(), posVelError->p3);
+            writeDouble(writer, "V1", getSICommonURI(), posVelError->v1);
+            writeDouble(writer, "V2", getSICommonURI(), posVelError->v2);
+            writeDouble(writer, "V3", getSICommonURI(), posVelError->v3);
+
+            const CorrCoefs* const coefs = posVelError->corrCoefs.get();
+            if (coefs)
+            {
+                writer.startElement("CorrCoefs", getSICommonURI());
+
+                writeDouble(writer, "P1P2", getSICommonURI(), coefs->p1p2);
+                writeDouble(writer, "P1P3", getSICommonURI(), coefs->p1p3);
+                writeDouble(writer, "P1V1", getSICommonURI(), coefs->p1v1);
+                writeDouble(writer, "P1V2", getSICommonURI(), coefs->p1v2);
+                writeDouble(writer, "P1V3", getSICommonURI(), coefs->p1v3);
+                writeDouble(writer, "P2P3", getSICommonURI(), coefs->p2p3);
+                writeDouble(writer, "P2V1", getSICommonURI(), coefs->p2v1);
+                writeDouble(writer, "P2V2", getSICommonURI(), coefs->p2v2);
+                writeDouble(writer, "P2V3", getSICommonURI(), coefs->p2v3);
+                writeDouble(writer, "P3V1", getSICommonURI(), coefs->p3v1);
+                writeDouble(writer, "P3V2", getSICommonURI(), coefs->p3v2);
+                writeDouble(writer, "P3V3", getSICommonURI(), coefs->p3v3);
+                writeDouble(writer, "V1V2", getSICommonURI(), coefs->v1v2);
+                writeDouble(writer, "V1V3", getSICommonURI(), coefs->v1v3);
+                writeDouble(writer, "V2V3", getSICommonURI(), coefs->v2v3);
+
+                writer.endElement();
+            }
+
+            writeDecorrType(writer, "PositionDecorr", getSICommonURI(),
+                            posVelError->positionDecorr);
+            writer.endElement();
+        }
+        if (radarSensor)
+        {
+            writer.startElement("RadarSensor", getSICommonURI());
+
+            writeDouble(writer, "RangeBias", getSICommonURI(),
+                        radarSensor->rangeBias);
+
+            if (!Init::isUndefined<double>(radarSensor->clockFreqSF))
+            {
+                writeDouble(writer, "ClockFreqSF", getSICommonURI(),
+                            radarSensor->clockFreqSF);
+            }
+            if (!Init::isUndefined<double>(radarSensor->transmitFreqSF))
+            {
+                writeDouble(writer, "TransmitFreqSF", getSICommonURI(),
+                            radarSensor->transmitFreqSF);
+            }
+            writeDecorrType(writer, "RangeBiasDecorr", getSICommonURI(),
+                            radarSensor->rangeBiasDecorr);
+            writer.endElement();
+        }
+        if (tropoError)
+        {
+            writer.startElement("TropoError", getSICommonURI());
+
+            if (!Init::isUndefined<double>(tropoError->tropoRangeVertical))
+            {
+                writeDouble(writer, "TropoRangeVertical", getSICommonURI(),
+                            tropoError->tropoRangeVertical);
+            }
+            if (!Init::isUndefined<double>(tropoError->tropoRangeSlant))
+            {
+                writeDouble(writer, "TropoRangeSlant", getSICommonURI(),
+                            tropoError->tropoRangeSlant);
+            }
+
+            writeDecorrType(writer, "TropoRangeDecorr", getSICommonURI(),
+                            tropoError->tropoRangeDecorr);
+            writer.endElement();
+        }
+        if (ionoError)
+        {
+            writer.startElement("IonoError", getSICommonURI());
+
+            if (!Init::isUndefined<double>(ionoError->ionoRangeVertical))
+            {
+                writeDouble(writer, "IonoRangeVertical", getSICommonURI(),
+                            ionoError->ionoRangeVertical);
+            }
+            if (!Init::isUndefined<double>(ionoError->ionoRangeRateVertical))
+            {
+                writeDouble(writer, "IonoRangeRateVertical", getSICommonURI(),
+                            ionoError->ionoRangeRateVertical);
+            }
+
+            writeDouble(writer, "IonoRgRgRateCC", getSICommonURI(),
+                        ionoError->ionoRgRgRateCC);
+
+            writeDecorrType(writer, "IonoRangeVertDecorr", getSICommonURI(),
+                            ionoError->ionoRangeVertDecorr);
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+
+    if (!errorStatistics->additionalParameters.empty())
+    {
+        writer.startElement("AdditionalParms", getSICommonURI());
+        writeParameters(writer, "Parameter", getSICommonURI(),
+                        errorStatistics->additionalParameters);
+        writer.endElement();
+    }
+
+    writer.endElement();
+}
+
 void SICommonXMLParser::parseErrorStatisticsFromXML(
         const XMLElem errorStatsXML,
         ErrorStatistics* errorStatistics) const
@@ -23,6 +23,7 @@
 
 #include <six/Utilities.h>
 #include <six/SICommonXMLParser01x.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -77,6 +78,42 @@ XMLElem SICommonXMLParser01x::convertCompositeSCPToXML(
     return NULL;
 }
 
+void SICommonXMLParser01x::writeCompositeSCP(
+    XMLStreamWriter& writer,
+    const ErrorStatistics* errorStatistics) const
+{
+    std::string defaultURI = getSICommonURI();
+
+    if (errorStatistics->compositeSCP.get())
+    {
+        writer.startElement("CompositeSCP", defaultURI);
+
+        if (errorStatistics->compositeSCP->scpType == CompositeSCP::RG_AZ)
+        {
+            writer.startElement("RgAzErr", defaultURI);
+            writeDouble(writer, "Rg", defaultURI,
+                        errorStatistics->compositeSCP->xErr);
+            writeDouble(writer, "Az", defaultURI,
+                        errorStatistics->compositeSCP->yErr);
+            writeDouble(writer, "RgAz", defaultURI,
+                        errorStatistics->compositeSCP->xyErr);
+            writer.endElement();
+        }
+        else
+        {
+            writer.startElement("RowColErr", defaultURI);
+            writeDouble(writer, "Row", defaultURI,
+                        errorStatistics->compositeSCP->xErr);
+            writeDouble(writer, "Col", defaultURI,
+                        errorStatistics->compositeSCP->yErr);
+            writeDouble(writer, "RowCol", defaultURI,
+                        errorStatistics->compositeSCP->xyErr);
+            writer.endElement();
+        }
+        writer.endElement();
+    }
+}
+
 void SICommonXMLParser01x::parseCompositeSCPFromXML(
     const XMLElem errorStatsXML,
     ErrorStatistics* errorStatistics) const
@@ -171,6 +208,59 @@ XMLElem SICommonXMLParser01x::convertRadiometryToXML(
     return rXML;
 }
 
+void SICommonXMLParser01x::writeRadiometry(
+    XMLStreamWriter& writer, const Radiometric *r) const
+{
+    std::string defaultURI = getSICommonURI();
+    writer.startElement("Radiometric", getDefaultURI());
+
+    if (!r->noiseLevel.noisePoly.empty())
+    {
+        writePoly2D(writer, "NoisePoly", defaultURI, r->noiseLevel.noisePoly);
+    }
+
+    if (!r->rcsSFPoly.empty())
+    {
+        writePoly2D(writer, "RCSSFPoly", defaultURI, r->rcsSFPoly);
+    }
+
+    if (!r->betaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "BetaZeroSFPoly", defaultURI, r->betaZeroSFPoly);
+    }
+
+    if (!r->sigmaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "SigmaZeroSFPoly", defaultURI,
+                    r->sigmaZeroSFPoly);
+    }
+
+    if (r->sigmaZeroSFIncidenceMap != AppliedType::NOT_SET)
+    {
+        writeString(
+            writer,
+            "SigmaZeroSFIncidenceMap",
+            defaultURI,
+            six::toString<six::AppliedType>(r->sigmaZeroSFIncidenceMap));
+    }
+
+    if (!r->gammaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "GammaZeroSFPoly", defaultURI,
+                    r->gammaZeroSFPoly);
+    }
+
+    if (r->gammaZeroSFIncidenceMap != AppliedType::NOT_SET)
+    {
+        writeString(
+            writer,
+            "GammaZeroSFIncidenceMap",
+            defaultURI,
+            six::toString<six::AppliedType>(r->gammaZeroSFIncidenceMap));
+    }
+    writer.endElement();
+}
+
 void SICommonXMLParser01x::parseRadiometryFromXML(
     const XMLElem radiometricXML, 
     Radiometric* radiometric) const
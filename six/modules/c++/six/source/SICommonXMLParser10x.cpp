@@ -22,6 +22,7 @@
 #include <set>
 
 #include <six/SICommonXMLParser10x.h>
+#include <six/XMLStreamWriter.h>
 
 namespace
 {
@@ -63,6 +64,25 @@ XMLElem SICommonXMLParser10x::convertCompositeSCPToXML(
     return NULL;
 }
 
+void SICommonXMLParser10x::writeCompositeSCP(
+    XMLStreamWriter& writer,
+    const ErrorStatistics* errorStatistics) const
+{
+    //! optional field
+    std::string defaultURI = getSICommonURI();
+    if (errorStatistics->compositeSCP.get())
+    {
+        writer.startElement("CompositeSCP", defaultURI);
+        writeDouble(writer, "Rg", defaultURI,
+                    errorStatistics->compositeSCP->xErr);
+        writeDouble(writer, "Az", defaultURI,
+                    errorStatistics->compositeSCP->yErr);
+        writeDouble(writer, "RgAz", defaultURI,
+                    errorStatistics->compositeSCP->xyErr);
+        writer.endElement();
+    }
+}
+
 void SICommonXMLParser10x::parseCompositeSCPFromXML(
     const XMLElem errorStatsXML,
     ErrorStatistics* errorStatistics) const
@@ -123,6 +143,46 @@ XMLElem SICommonXMLParser10x::convertRadiometryToXML(
     return rXML;
 }
 
+void SICommonXMLParser10x::writeRadiometry(
+    XMLStreamWriter& writer, const Radiometric *r) const
+{
+    std::string defaultURI = getSICommonURI();
+    writer.startElement("Radiometric", getDefaultURI());
+
+    if (!r->noiseLevel.noiseType.empty() && !r->noiseLevel.noisePoly.empty())
+    {
+        writer.startElement("NoiseLevel", defaultURI);
+        writeString(writer, "NoiseLevelType", defaultURI,
+                    r->noiseLevel.noiseType);
+        writePoly2D(writer, "NoisePoly", defaultURI, r->noiseLevel.noisePoly);
+        writer.endElement();
+    }
+
+    if (!r->rcsSFPoly.empty())
+    {
+        writePoly2D(writer, "RCSSFPoly", defaultURI, r->rcsSFPoly);
+    }
+
+    if (!r->sigmaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "SigmaZeroSFPoly", defaultURI,
+                    r->sigmaZeroSFPoly);
+    }
+
+    if (!r->betaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "BetaZeroSFPoly", defaultURI, r->betaZeroSFPoly);
+    }
+
+    if (!r->gammaZeroSFPoly.empty())
+    {
+        writePoly2D(writer, "GammaZeroSFPoly", defaultURI,
+                    r->gammaZeroSFPoly);
+    }
+
+    writer.endElement();
+}
+
 void SICommonXMLParser10x::parseRadiometryFromXML(
     const XMLElem radiometricXML, 
     Radiometric* radiometric) const
@@ -0,0 +1,163 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <mt/CriticalSection.h>
+#include <six/StagingBufferPool.h>
+
+namespace six
+{
+StagingBufferPool::StagingBufferPool(size_t maxFreeBuffers) :
+    mMaxFreeBuffers(maxFreeBuffers)
+{
+}
+
+StagingBufferPool::~StagingBufferPool()
+{
+    for (size_t ii = 0; ii < mFreeBuffers.size(); ++ii)
+    {
+        delete mFreeBuffers[ii];
+    }
+}
+
+std::vector<sys::ubyte>* StagingBufferPool::acquire(size_t numBytes)
+{
+    std::vector<sys::ubyte>* buffer = NULL;
+    {
+        mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+
+        // Prefer the smallest free buffer that's already big enough,
+        // otherwise grow the largest one
+        size_t bestIdx = mFreeBuffers.size();
+        for (size_t ii = 0; ii < mFreeBuffers.size(); ++ii)
+        {
+            const size_t capacity = mFreeBuffers[ii]->capacity();
+            if (bestIdx == mFreeBuffers.size())
+            {
+                bestIdx = ii;
+            }
+            else
+            {
+                const size_t bestCapacity = mFreeBuffers[bestIdx]->capacity();
+                const bool fits = (capacity >= numBytes);
+                const bool bestFits = (bestCapacity >= numBytes);
+                if ((fits && (!bestFits || capacity < bestCapacity)) ||
+                    (!fits && !bestFits && capacity > bestCapacity))
+                {
+                    bestIdx = ii;
+                }
+            }
+        }
+
+        if (bestIdx < mFreeBuffers.size())
+        {
+            buffer = mFreeBuffers[bestIdx];
+            mFreeBuffers[bestIdx] = mFreeBuffers.back();
+            mFreeBuffers.pop_back();
+        }
+    }
+
+    if (!buffer)
+    {
+        buffer = new std::vector<sys::ubyte>();
+    }
+
+    try
+    {
+        buffer->resize(numBytes);
+    }
+    catch (...)
+    {
+        delete buffer;
+        throw;
+    }
+    return buffer;
+}
+
+void StagingBufferPool::release(std::vector<sys::ubyte>* buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+
+    {
+        mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+        if (mFreeBuffers.size() < mMaxFreeBuffers)
+        {
+            mFreeBuffers.push_back(buffer);
+            return;
+        }
+    }
+
+    delete buffer;
+}
+
+size_t StagingBufferPool::getNumFreeBuffers() const
+{
+    mt::CriticalSection<sys::Mutex> obtainLock(&mMutex);
+    return mFreeBuffers.size();
+}
+
+StagingBuffer::StagingBuffer() :
+    mBuffer(NULL)
+{
+}
+
+StagingBuffer::~StagingBuffer()
+{
+    try
+    {
+        reset();
+    }
+    catch (...)
+    {
+        // Don't throw out of the destructor
+    }
+}
+
+sys::ubyte* StagingBuffer::reserve(mem::SharedPtr<StagingBufferPool> pool,
+                                   size_t numBytes)
+{
+    if (mBuffer && mPool.get() == pool.get())
+    {
+        mBuffer->resize(numBytes);
+    }
+    else
+    {
+        reset();
+        mBuffer = pool->acquire(numBytes);
+        mPool = pool;
+    }
+
+    return get();
+}
+
+void StagingBuffer::reset()
+{
+    if (mBuffer)
+    {
+        mPool->release(mBuffer);
+        mBuffer = NULL;
+        mPool.reset();
+    }
+}
+}
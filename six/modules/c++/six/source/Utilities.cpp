@@ -20,18 +20,24 @@
  *
  */
 
+#include <stdio.h>
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <iomanip>
 
 #include <nitf/PluginRegistry.hpp>
 #include <logging/NullLogger.h>
 #include <math/Utilities.h>
+#include <math/Round.h>
+#include "six/Instrumentation.h"
 #include "six/Utilities.h"
 #include "six/XMLControl.h"
 
 namespace
 {
 NITF_TRE_STATIC_HANDLER_REF(XML_DATA_CONTENT);
+NITF_TRE_STATIC_HANDLER_REF(RPC00B);
 
 void assign(math::linear::MatrixMxN<7, 7>& sensorCovar,
             size_t row,
@@ -79,6 +85,84 @@ void getSensorCovariance(const six::PosVelError& error,
         assign(sensorCovar, 2, 5, error.p3 * error.v3 * corrCoefs.p3v3);
     }
 }
+
+// Formats an RPC00B offset or scale, which are fixed point with a given
+// number of integer and fractional digits and optionally a leading sign
+std::string formatRPCValue(double value,
+                           size_t intDigits,
+                           size_t fracDigits,
+                           bool isSigned)
+{
+    const double rounded = math::round(value, fracDigits);
+    const double limit = std::pow(10.0, static_cast<double>(intDigits));
+    if (std::abs(rounded) >= limit || (!isSigned && rounded < 0.0))
+    {
+        throw except::Exception(Ctxt(
+                "RPC00B value " + str::toString(value) + " is out of range"));
+    }
+
+    std::ostringstream ostr;
+    ostr << std::fixed << std::setprecision(fracDigits) << std::setfill('0')
+         << std::internal;
+    if (isSigned)
+    {
+        ostr << std::showpos;
+    }
+    ostr << std::setw(intDigits + (fracDigits > 0 ? fracDigits + 1 : 0) +
+                      (isSigned ? 1 : 0))
+         << rounded;
+    return ostr.str();
+}
+
+// Formats an RPC00B coefficient as +d.ddddddE+d.  The exponent only gets
+// one digit, so anything too small to represent is written as 0.
+std::string formatRPCCoeff(double value)
+{
+    char buffer[32];
+    ::snprintf(buffer, sizeof(buffer), "%+.6E", value);
+    const std::string str(buffer);
+    const std::string::size_type expPos = str.find('E');
+    const int exponent = str::toType<int>(str.substr(expPos + 1));
+    if (value == 0.0 || exponent < -9)
+    {
+        return "+0.000000E+0";
+    }
+    if (exponent > 9)
+    {
+        throw except::Exception(Ctxt(
+                "RPC00B coefficient " + str::toString(value) +
+                " is too large"));
+    }
+
+    std::ostringstream ostr;
+    ostr << str.substr(0, expPos) << 'E' << (exponent < 0 ? '-' : '+')
+         << std::abs(exponent);
+    return ostr.str();
+}
+
+// Formats an RPC00B error in meters.  Negative values mean the error is
+// unknown, which the TRE has no value for, so they're written as zero.
+std::string formatRPCError(double value)
+{
+    // Anything that rounds to 10000.00 won't fit
+    if (value >= 9999.995)
+    {
+        throw except::Exception(Ctxt(
+                "RPC00B error " + str::toString(value) + " is out of range"));
+    }
+
+    std::ostringstream ostr;
+    ostr << std::fixed << std::setprecision(2) << std::setfill('0')
+         << std::setw(7) << std::max(value, 0.0);
+    return ostr.str();
+}
+
+double getRPCField(nitf::TRE& tre, const std::string& key)
+{
+    std::string value = tre.getField(key).toString();
+    str::trim(value);
+    return str::toType<double>(value);
+}
 }
 
 using namespace six;
@@ -274,13 +358,7 @@ template<> std::string six::toString(const DataType& type)
 
 template<> PixelType six::toType<PixelType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    PixelType p(type);
-    if (p == PixelType::NOT_SET)
-        throw except::Exception(Ctxt(FmtX("Type not understood [%s]",
-                                          type.c_str())));
-    return p;
+    return parseEnum<PixelType>(s);
 }
 
 template<> std::string six::toString(const PixelType& type)
@@ -292,18 +370,17 @@ template<> std::string six::toString(const PixelType& type)
     return type.toString();
 }
 
-template<> MagnificationMethod six::toType<MagnificationMethod>(
-                                                                const std::string& s)
+template<> MagnificationMethod
+six::toType<MagnificationMethod>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "NEAREST_NEIGHBOR")
-        return MagnificationMethod::NEAREST_NEIGHBOR;
-    if (type == "BILINEAR")
-        return MagnificationMethod::BILINEAR;
-    if (type == "LAGRANGE")
-        return MagnificationMethod::LAGRANGE;
-    return MagnificationMethod::NOT_SET;
+    try
+    {
+        return parseEnum<MagnificationMethod>(s);
+    }
+    catch (const except::InvalidFormatException&)
+    {
+        return MagnificationMethod::NOT_SET;
+    }
 }
 
 template<> std::string six::toString(const MagnificationMethod& method)
@@ -323,17 +400,14 @@ template<> std::string six::toString(const MagnificationMethod& method)
 
 template<> DecimationMethod six::toType<DecimationMethod>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "NEAREST_NEIGHBOR")
-        return DecimationMethod::NEAREST_NEIGHBOR;
-    if (type == "BILINEAR")
-        return DecimationMethod::BILINEAR;
-    if (type == "BRIGHTEST_PIXEL")
-        return DecimationMethod::BRIGHTEST_PIXEL;
-    if (type == "LAGRANGE")
-        return DecimationMethod::LAGRANGE;
-    return DecimationMethod::NOT_SET;
+    try
+    {
+        return parseEnum<DecimationMethod>(s);
+    }
+    catch (const except::InvalidFormatException&)
+    {
+        return DecimationMethod::NOT_SET;
+    }
 }
 
 template<> std::string six::toString(const DecimationMethod& method)
@@ -375,21 +449,7 @@ template<> std::string six::toString(const EarthModelType& t)
 
 template<> OrientationType six::toType<OrientationType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-
-    if (type == "UP")
-        return OrientationType::UP;
-    else if (type == "DOWN")
-        return OrientationType::DOWN;
-    else if (type == "LEFT")
-        return OrientationType::LEFT;
-    else if (type == "RIGHT")
-        return OrientationType::RIGHT;
-    else if (type == "ARBITRARY")
-        return OrientationType::ARBITRARY;
-    else
-        throw except::Exception(Ctxt("Unsupported orientation type '" + s + "'"));
+    return parseEnum<OrientationType>(s);
 }
 
 template<> std::string six::toString(const OrientationType& t)
@@ -411,43 +471,10 @@ template<> std::string six::toString(const OrientationType& t)
     }
 }
 
-template<> PolarizationSequenceType six::toType<PolarizationSequenceType>(const std::string& s)
+template<> PolarizationSequenceType
+six::toType<PolarizationSequenceType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "OTHER")
-    {
-        return PolarizationSequenceType::OTHER;
-    }
-    else if (type == "V")
-    {
-        return PolarizationSequenceType::V;
-    }
-    else if (type == "H")
-    {
-        return PolarizationSequenceType::H;
-    }
-    else if (type == "RHC")
-    {
-        return PolarizationSequenceType::RHC;
-    }
-    else if (type == "LHC")
-    {
-        return PolarizationSequenceType::LHC;
-    }
-    else if (type == "UNKNOWN")
-    {
-        return PolarizationSequenceType::UNKNOWN;
-    }
-    else if (type == "SEQUENCE")
-    {
-        return PolarizationSequenceType::SEQUENCE;
-    }
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported polarization type '" + s + "'"));
-    }
+    return parseEnum<PolarizationSequenceType>(s);
 }
 
 template<> std::string six::toString(const PolarizationSequenceType& t)
@@ -476,33 +503,7 @@ template<> std::string six::toString(const PolarizationSequenceType& t)
 
 template<> PolarizationType six::toType<PolarizationType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "OTHER")
-    {
-        return PolarizationType::OTHER;
-    }
-    else if (type == "V")
-    {
-        return PolarizationType::V;
-    }
-    else if (type == "H")
-    {
-        return PolarizationType::H;
-    }
-    else if (type == "RHC")
-    {
-        return PolarizationType::RHC;
-    }
-    else if (type == "LHC")
-    {
-        return PolarizationType::LHC;
-    }
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported polarization type '" + s + "'"));
-    }
+    return parseEnum<PolarizationType>(s);
 }
 
 template<> std::string six::toString(const PolarizationType& t)
@@ -590,14 +591,7 @@ template<> std::string six::toString(const DualPolarizationType& t)
 
 template<> DemodType six::toType<DemodType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "STRETCH")
-        return DemodType::STRETCH;
-    else if (type == "CHIRP")
-        return DemodType::CHIRP;
-    else
-        throw except::Exception(Ctxt("Unsupported demod type '" + s + "'"));
+    return parseEnum<DemodType>(s);
 }
 
 template<> std::string six::toString(const DemodType& t)
@@ -613,24 +607,10 @@ template<> std::string six::toString(const DemodType& t)
     }
 }
 
-template<> ImageFormationType six::toType<ImageFormationType>(
-                                                              const std::string& s)
+template<> ImageFormationType
+six::toType<ImageFormationType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "OTHER")
-        return ImageFormationType::OTHER;
-    else if (type == "PFA")
-        return ImageFormationType::PFA;
-    else if (type == "RMA")
-        return ImageFormationType::RMA;
-    else if (type == "RGAZCOMP")
-        return ImageFormationType::RGAZCOMP;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported image formation type + '" + s + "'"));
-    }
+    return parseEnum<ImageFormationType>(s);
 }
 
 template<> std::string six::toString(const ImageFormationType& t)
@@ -650,22 +630,10 @@ template<> std::string six::toString(const ImageFormationType& t)
     }
 }
 
-template<> SlowTimeBeamCompensationType six::toType<
-        SlowTimeBeamCompensationType>(const std::string& s)
+template<> SlowTimeBeamCompensationType
+six::toType<SlowTimeBeamCompensationType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "NO")
-        return SlowTimeBeamCompensationType::NO;
-    else if (type == "GLOBAL")
-        return SlowTimeBeamCompensationType::GLOBAL;
-    else if (type == "SV")
-        return SlowTimeBeamCompensationType::SV;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported slow time beam compensation type + '" + s + "'"));
-    }
+    return parseEnum<SlowTimeBeamCompensationType>(s);
 }
 
 template<> std::string six::toString(const SlowTimeBeamCompensationType& t)
@@ -685,20 +653,10 @@ template<> std::string six::toString(const SlowTimeBeamCompensationType& t)
     }
 }
 
-template<> ImageBeamCompensationType six::toType<ImageBeamCompensationType>(
-                                                                            const std::string& s)
+template<> ImageBeamCompensationType
+six::toType<ImageBeamCompensationType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "NO")
-        return ImageBeamCompensationType::NO;
-    else if (type == "SV")
-        return ImageBeamCompensationType::SV;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported image beam compensation type + '" + s + "'"));
-    }
+    return parseEnum<ImageBeamCompensationType>(s);
 }
 
 template<> std::string six::toString(const ImageBeamCompensationType& t)
@@ -717,19 +675,7 @@ template<> std::string six::toString(const ImageBeamCompensationType& t)
 
 template<> AutofocusType six::toType<AutofocusType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "NO")
-        return AutofocusType::NO;
-    else if (type == "GLOBAL")
-        return AutofocusType::GLOBAL;
-    else if (type == "SV")
-        return AutofocusType::SV;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported autofocus type + '" + s + "'"));
-    }
+    return parseEnum<AutofocusType>(s);
 }
 
 template<> std::string six::toString(const AutofocusType& t)
@@ -749,19 +695,7 @@ template<> std::string six::toString(const AutofocusType& t)
 
 template<> RMAlgoType six::toType<RMAlgoType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "OMEGA_K")
-        return RMAlgoType::OMEGA_K;
-    else if (type == "CSA")
-        return RMAlgoType::CSA;
-    else if (type == "RG_DOP")
-        return RMAlgoType::RG_DOP;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported RM algorithm type '" + s + "'"));
-    }
+    return parseEnum<RMAlgoType>(s);
 }
 
 template<> std::string six::toString(const RMAlgoType& t)
@@ -804,22 +738,10 @@ template<> std::string six::toString(const SideOfTrackType& t)
     }
 }
 
-template<> ComplexImagePlaneType six::toType<ComplexImagePlaneType>(
-                                                                    const std::string& s)
+template<> ComplexImagePlaneType
+six::toType<ComplexImagePlaneType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "OTHER")
-        return ComplexImagePlaneType::OTHER;
-    else if (type == "SLANT")
-        return ComplexImagePlaneType::SLANT;
-    else if (type == "GROUND")
-        return ComplexImagePlaneType::GROUND;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported complex image plane '" + s + "'"));
-    }
+    return parseEnum<ComplexImagePlaneType>(s);
 }
 
 template<> std::string six::toString(const ComplexImagePlaneType& t)
@@ -837,26 +759,10 @@ template<> std::string six::toString(const ComplexImagePlaneType& t)
     }
 }
 
-template<> ComplexImageGridType six::toType<ComplexImageGridType>(
-                                                                  const std::string& s)
+template<> ComplexImageGridType
+six::toType<ComplexImageGridType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "RGAZIM")
-        return ComplexImageGridType::RGAZIM;
-    else if (type == "RGZERO")
-        return ComplexImageGridType::RGZERO;
-    else if (type == "XRGYCR")
-        return ComplexImageGridType::XRGYCR;
-    else if (type == "XCTYAT")
-        return ComplexImageGridType::XCTYAT;
-    else if (type == "PLANE")
-        return ComplexImageGridType::PLANE;
-    else
-    {
-        throw except::Exception(Ctxt(
-                "Unsupported complex image grid '" + s + "'"));
-    }
+    return parseEnum<ComplexImageGridType>(s);
 }
 
 template<> std::string six::toString(const ComplexImageGridType& t)
@@ -951,14 +857,7 @@ template<> std::string six::toString(const AppliedType& value)
 
 template<> CollectType six::toType<CollectType>(const std::string& s)
 {
-    std::string type(s);
-    str::trim(type);
-    if (type == "MONOSTATIC")
-        return CollectType::MONOSTATIC;
-    else if (type == "BISTATIC")
-        return CollectType::BISTATIC;
-    else
-        throw except::Exception(Ctxt("Unsupported collect type '" + s + "'"));
+    return parseEnum<CollectType>(s);
 }
 
 template<> std::string six::toString(const CollectType& value)
@@ -1050,6 +949,113 @@ void six::loadXmlDataContentHandler()
     }
 }
 
+void six::loadRPC00BHandler()
+{
+    if (!nitf::PluginRegistry::treHandlerExists("RPC00B"))
+    {
+        nitf::PluginRegistry::registerTREHandler(RPC00B_init,
+                                                 RPC00B_handler);
+    }
+}
+
+nitf::TRE six::createRPC00B(const scene::RPCModel& rpc, size_t firstRow)
+{
+    loadRPC00BHandler();
+
+    // LINE_OFF can't be negative, so for segments that start past the
+    // offset, move the offset to 0 and fold the difference into the line
+    // numerator (adding c to num / den is adding c * den to num)
+    double lineOffset = rpc.lineOffset - static_cast<double>(firstRow);
+    double lineNumCoeffs[scene::RPCModel::NUM_COEFFS];
+    std::copy(rpc.lineNumCoeffs,
+              rpc.lineNumCoeffs + scene::RPCModel::NUM_COEFFS,
+              lineNumCoeffs);
+    if (lineOffset < 0.0)
+    {
+        const double shift = lineOffset / rpc.lineScale;
+        for (size_t ii = 0; ii < scene::RPCModel::NUM_COEFFS; ++ii)
+        {
+            lineNumCoeffs[ii] += shift * rpc.lineDenCoeffs[ii];
+        }
+        lineOffset = 0.0;
+    }
+
+    nitf::TRE tre("RPC00B", "RPC00B");
+    tre.setField("SUCCESS", "1");
+    tre.setField("ERR_BIAS", formatRPCError(rpc.errorBias));
+    tre.setField("ERR_RAND", formatRPCError(rpc.errorRandom));
+    tre.setField("LINE_OFF", formatRPCValue(lineOffset, 6, 0, false));
+    tre.setField("SAMP_OFF",
+                formatRPCValue(rpc.sampleOffset, 5, 0, false));
+    tre.setField("LAT_OFF", formatRPCValue(rpc.latOffset, 2, 4, true));
+    tre.setField("LONG_OFF", formatRPCValue(rpc.lonOffset, 3, 4, true));
+    tre.setField("HEIGHT_OFF",
+                formatRPCValue(rpc.heightOffset, 4, 0, true));
+    tre.setField("LINE_SCALE",
+                formatRPCValue(rpc.lineScale, 6, 0, false));
+    tre.setField("SAMP_SCALE",
+                formatRPCValue(rpc.sampleScale, 5, 0, false));
+    tre.setField("LAT_SCALE", formatRPCValue(rpc.latScale, 2, 4, true));
+    tre.setField("LONG_SCALE",
+                formatRPCValue(rpc.lonScale, 3, 4, true));
+    tre.setField("HEIGHT_SCALE",
+                formatRPCValue(rpc.heightScale, 4, 0, true));
+
+    for (size_t ii = 0; ii < scene::RPCModel::NUM_COEFFS; ++ii)
+    {
+        const std::string index = "[" + str::toString(ii) + "]";
+        tre.setField("LINE_NUM_COEFF" + index,
+                    formatRPCCoeff(lineNumCoeffs[ii]));
+        tre.setField("LINE_DEN_COEFF" + index,
+                    formatRPCCoeff(rpc.lineDenCoeffs[ii]));
+        tre.setField("SAMP_NUM_COEFF" + index,
+                    formatRPCCoeff(rpc.sampleNumCoeffs[ii]));
+        tre.setField("SAMP_DEN_COEFF" + index,
+                    formatRPCCoeff(rpc.sampleDenCoeffs[ii]));
+    }
+
+    return tre;
+}
+
+scene::RPCModel six::parseRPC00B(nitf::TRE tre, size_t firstRow)
+{
+    if (tre.getTag() != "RPC00B")
+    {
+        throw except::Exception(Ctxt(
+                "Expected an RPC00B TRE but got " + tre.getTag()));
+    }
+    if (getRPCField(tre, "SUCCESS") == 0.0)
+    {
+        throw except::Exception(Ctxt("RPC00B TRE is marked unsuccessful"));
+    }
+
+    scene::RPCModel rpc;
+    rpc.errorBias = getRPCField(tre, "ERR_BIAS");
+    rpc.errorRandom = getRPCField(tre, "ERR_RAND");
+    rpc.lineOffset = getRPCField(tre, "LINE_OFF") +
+            static_cast<double>(firstRow);
+    rpc.sampleOffset = getRPCField(tre, "SAMP_OFF");
+    rpc.latOffset = getRPCField(tre, "LAT_OFF");
+    rpc.lonOffset = getRPCField(tre, "LONG_OFF");
+    rpc.heightOffset = getRPCField(tre, "HEIGHT_OFF");
+    rpc.lineScale = getRPCField(tre, "LINE_SCALE");
+    rpc.sampleScale = getRPCField(tre, "SAMP_SCALE");
+    rpc.latScale = getRPCField(tre, "LAT_SCALE");
+    rpc.lonScale = getRPCField(tre, "LONG_SCALE");
+    rpc.heightScale = getRPCField(tre, "HEIGHT_SCALE");
+
+    for (size_t ii = 0; ii < scene::RPCModel::NUM_COEFFS; ++ii)
+    {
+        const std::string index = "[" + str::toString(ii) + "]";
+        rpc.lineNumCoeffs[ii] = getRPCField(tre, "LINE_NUM_COEFF" + index);
+        rpc.lineDenCoeffs[ii] = getRPCField(tre, "LINE_DEN_COEFF" + index);
+        rpc.sampleNumCoeffs[ii] = getRPCField(tre, "SAMP_NUM_COEFF" + index);
+        rpc.sampleDenCoeffs[ii] = getRPCField(tre, "SAMP_DEN_COEFF" + index);
+    }
+
+    return rpc;
+}
+
 std::auto_ptr<Data> six::parseData(const XMLControlRegistry& xmlReg,
                                    ::io::InputStream& xmlStream,
                                    DataType dataType,
@@ -1060,6 +1066,7 @@ std::auto_ptr<Data> six::parseData(const XMLControlRegistry& xmlReg,
     xmlParser.preserveCharacterData(true);
     try
     {
+        ScopedStageTimer timer("six.parseData.parseXML");
         xmlParser.parse(xmlStream);
     }
     catch(const except::Throwable& ex)
@@ -1088,6 +1095,7 @@ std::auto_ptr<Data> six::parseData(const XMLControlRegistry& xmlReg,
     const std::auto_ptr<XMLControl>
         xmlControl(xmlReg.newXMLControl(xmlDataType, &log));
 
+    ScopedStageTimer timer("six.parseData.fromXML");
     return std::auto_ptr<Data>(xmlControl->fromXML(doc, schemaPaths));
 }
 
@@ -20,17 +20,16 @@
  *
  */
 
+#include <memory>
+
 #include <logging/NullLogger.h>
 #include <six/XMLControl.h>
 
 namespace
 {
-//! Validate the xml and log any errors
-//  NOTE: Errors are treated as detriments to valid processing
-//        and fail accordingly
-void validate(const xml::lite::Document* doc,
-              const std::vector<std::string>& schemaPaths,
-              logging::Logger* log)
+//! \return the schema paths to validate against, which may be empty
+std::vector<std::string>
+getSchemaPaths(const std::vector<std::string>& schemaPaths)
 {
     // attempt to get the schema location from the
     // environment if nothing is specified
@@ -58,6 +57,18 @@ void validate(const xml::lite::Document* doc,
         }
     }
 
+    return paths;
+}
+
+//! Validate the xml and log any errors
+//  NOTE: Errors are treated as detriments to valid processing
+//        and fail accordingly
+void validateDocument(const xml::lite::Document* doc,
+                      const std::vector<std::string>& schemaPaths,
+                      logging::Logger* log)
+{
+    const std::vector<std::string> paths(getSchemaPaths(schemaPaths));
+
     // validate against any specified schemas
     if (!paths.empty())
     {
@@ -183,14 +194,30 @@ xml::lite::Document* XMLControl::toXML(
         const std::vector<std::string>& schemaPaths)
 {
     xml::lite::Document* doc = toXMLImpl(data);
-    validate(doc, schemaPaths, mLog);
+    validateDocument(doc, schemaPaths, mLog);
     return doc;
 }
 
+void XMLControl::toXML(const Data* data, XMLStreamWriter& writer)
+{
+    toXMLImpl(data, writer);
+}
+
+void XMLControl::validate(const Data* data,
+                          const std::vector<std::string>& schemaPaths)
+{
+    const std::vector<std::string> paths(getSchemaPaths(schemaPaths));
+    if (!paths.empty())
+    {
+        const std::auto_ptr<xml::lite::Document> doc(toXMLImpl(data));
+        validateDocument(doc.get(), paths, mLog);
+    }
+}
+
 Data* XMLControl::fromXML(const xml::lite::Document* doc,
                           const std::vector<std::string>& schemaPaths)
 {
-    validate(doc, schemaPaths, mLog);
+    validateDocument(doc, schemaPaths, mLog);
     Data* const data = fromXMLImpl(doc);
     data->setVersion(getVersionFromURI(doc));
     return data;
@@ -21,6 +21,8 @@
  */
 
 #include "six/XMLControlFactory.h"
+#include "six/Instrumentation.h"
+#include "six/XMLStreamWriter.h"
 #include <str/Convert.h>
 #include <logging/NullLogger.h>
 
@@ -91,13 +93,25 @@ std::string six::toValidXMLString(const Data* data,
     const std::auto_ptr<XMLControl>
         xmlControl(xmlRegistry->newXMLControl(data->getDataType(), log));
 
-    // this will validate if SIX_SCHEMA_PATH EnvVar is set
-    const std::auto_ptr<xml::lite::Document> doc(
-        xmlControl->toXML(data, schemaPaths));
+    {
+        // this will validate if SIX_SCHEMA_PATH EnvVar is set.  Only then
+        // is a DOM built.
+        ScopedStageTimer timer("six.toValidXMLString.toXML");
+        xmlControl->validate(data, schemaPaths);
+    }
+
+    // Count the bytes first so the string is allocated exactly once, then
+    // write straight into it
+    ScopedStageTimer timer("six.toValidXMLString.print");
+    XMLStreamWriter counter;
+    xmlControl->toXML(data, counter);
 
-    io::StringStream oss;
-    doc->getRootElement()->print(oss);
+    std::string xml;
+    xml.reserve(counter.getNumBytes());
+    XMLStreamWriter writer(&xml);
+    xmlControl->toXML(data, writer);
 
-    return oss.stream().str();
+    timer.addBytes(xml.length());
+    return xml;
 }
 
@@ -25,6 +25,7 @@
 #include <str/Convert.h>
 #include <logging/NullLogger.h>
 #include <six/XMLParser.h>
+#include <six/XMLStreamWriter.h>
 #include <six/Utilities.h>
 
 namespace
@@ -282,6 +283,140 @@ XMLElem XMLParser::createDate(const std::string& name, const DateTime& p,
     return createDate(name, mDefaultURI, p, parent);
 }
 
+void XMLParser::writeElement(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const std::string& classType, const std::string& characterData) const
+{
+    writer.startElement(name, uri);
+    if (mAddClassAttributes)
+    {
+        writer.addAttribute("class", classType, getDefaultURI());
+    }
+    writer.addCharacters(characterData);
+    writer.endElement();
+}
+
+void XMLParser::writeString(XMLStreamWriter& writer, const std::string& name,
+        const std::string& uri, const std::string& p) const
+{
+    writeElement(writer, name, uri, "xs:string", p);
+}
+
+void XMLParser::writeString(XMLStreamWriter& writer, const std::string& name,
+        const std::string& p) const
+{
+    writeString(writer, name, mDefaultURI, p);
+}
+
+void XMLParser::writeInt(XMLStreamWriter& writer, const std::string& name,
+        const std::string& uri, int p) const
+{
+    std::string elementValue;
+    try
+    {
+        elementValue = six::toString<int>(p);
+    }
+    catch (const except::Exception& ex)
+    {
+        std::string message("Unable to create " + name + " in element "
+                + writer.getCurrentElement() + ": " + ex.getMessage());
+        throw except::Exception(Ctxt(message));
+    }
+    writeElement(writer, name, uri, "xs:int", elementValue);
+}
+
+void XMLParser::writeInt(XMLStreamWriter& writer, const std::string& name,
+        const std::string& uri, const std::string& p) const
+{
+    writeElement(writer, name, uri, "xs:int", p);
+}
+
+void XMLParser::writeInt(XMLStreamWriter& writer, const std::string& name,
+        int p) const
+{
+    writeInt(writer, name, mDefaultURI, p);
+}
+
+void XMLParser::writeDouble(XMLStreamWriter& writer, const std::string& name,
+        const std::string& uri, double p) const
+{
+    std::string elementValue;
+    try
+    {
+        elementValue = six::toString<double>(p);
+    }
+    catch (const except::Exception& ex)
+    {
+        std::string message("Unable to create " + name + " in element "
+                + writer.getCurrentElement() + ": " + ex.getMessage());
+        throw except::Exception(Ctxt(message));
+    }
+    writeElement(writer, name, uri, "xs:double", elementValue);
+}
+
+void XMLParser::writeDouble(XMLStreamWriter& writer, const std::string& name,
+        double p) const
+{
+    writeDouble(writer, name, mDefaultURI, p);
+}
+
+bool XMLParser::writeBooleanType(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri, BooleanType p) const
+{
+    if (p == six::BooleanType::NOT_SET)
+    {
+        return false;
+    }
+
+    writeElement(writer, name, uri, "xs:boolean",
+                 six::toString<BooleanType>(p));
+    return true;
+}
+
+bool XMLParser::writeBooleanType(XMLStreamWriter& writer,
+        const std::string& name, BooleanType p) const
+{
+    return writeBooleanType(writer, name, mDefaultURI, p);
+}
+
+void XMLParser::writeDateTime(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const std::string& s) const
+{
+    writeElement(writer, name, uri, "xs:dateTime", s);
+}
+
+void XMLParser::writeDateTime(XMLStreamWriter& writer,
+        const std::string& name, const std::string& s) const
+{
+    writeDateTime(writer, name, mDefaultURI, s);
+}
+
+void XMLParser::writeDateTime(XMLStreamWriter& writer,
+        const std::string& name, const std::string& uri,
+        const DateTime& p) const
+{
+    writeDateTime(writer, name, uri, six::toString<DateTime>(p));
+}
+
+void XMLParser::writeDateTime(XMLStreamWriter& writer,
+        const std::string& name, const DateTime& p) const
+{
+    writeDateTime(writer, name, mDefaultURI, p);
+}
+
+void XMLParser::writeDate(XMLStreamWriter& writer, const std::string& name,
+        const std::string& uri, const DateTime& p) const
+{
+    writeElement(writer, name, uri, "xs:date", p.format("%Y-%m-%d"));
+}
+
+void XMLParser::writeDate(XMLStreamWriter& writer, const std::string& name,
+        const DateTime& p) const
+{
+    writeDate(writer, name, mDefaultURI, p);
+}
+
 XMLElem XMLParser::getFirstAndOnly(XMLElem parent, const std::string& tag)
 {
     std::vector < XMLElem > children;
@@ -313,6 +448,15 @@ XMLElem XMLParser::require(XMLElem element, const std::string& name)
     return element;
 }
 
+void XMLParser::require(bool written, const std::string& name)
+{
+    if (!written)
+    {
+        throw except::Exception(Ctxt(
+            "Required field [" + name + "] is undefined or null"));
+    }
+}
+
 
 
 void XMLParser::setAttribute(XMLElem e, const std::string& name,
@@ -0,0 +1,211 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <except/Exception.h>
+#include <six/XMLStreamWriter.h>
+
+namespace six
+{
+XMLStreamWriter::XMLStreamWriter(std::string* output) :
+    mOutput(output),
+    mNumBytes(0),
+    mStartTagOpen(false)
+{
+}
+
+void XMLStreamWriter::write(const char* data, size_t numBytes)
+{
+    if (mOutput)
+    {
+        mOutput->append(data, numBytes);
+    }
+    mNumBytes += numBytes;
+}
+
+void XMLStreamWriter::closeStartTag()
+{
+    if (mStartTagOpen)
+    {
+        writePendingAttributes();
+        write(">", 1);
+        mStartTagOpen = false;
+    }
+}
+
+void XMLStreamWriter::writeAttribute(const std::string& qname,
+                                     const std::string& value)
+{
+    write(" ", 1);
+    write(qname);
+    write("=\"", 2);
+    write(value);
+    write("\"", 1);
+}
+
+void XMLStreamWriter::writePendingAttributes()
+{
+    for (size_t ii = 0; ii < mPendingAttributes.size(); ++ii)
+    {
+        writeAttribute(mPendingAttributes[ii].first,
+                       mPendingAttributes[ii].second);
+    }
+    mPendingAttributes.clear();
+}
+
+std::string XMLStreamWriter::qualify(const std::string& name,
+                                     const std::string& uri) const
+{
+    if (!uri.empty())
+    {
+        const std::map<std::string, std::string>::const_iterator prefix =
+                mPrefixes.find(uri);
+        if (prefix != mPrefixes.end() && !prefix->second.empty())
+        {
+            return prefix->second + ":" + name;
+        }
+    }
+    return name;
+}
+
+void XMLStreamWriter::writeRaw(const std::string& text)
+{
+    closeStartTag();
+    write(text);
+}
+
+void XMLStreamWriter::startElement(const std::string& name,
+                                   const std::string& uri)
+{
+    closeStartTag();
+    mOpenElements.push_back(qualify(name, uri));
+    write("<", 1);
+    write(mOpenElements.back());
+    mStartTagOpen = true;
+
+    // Written when the start tag is finished, after any added directly
+    mPendingAttributes.swap(mNextAttributes);
+    mNextAttributes.clear();
+}
+
+void XMLStreamWriter::addAttribute(const std::string& name,
+                                   const std::string& value,
+                                   const std::string& uri)
+{
+    if (!mStartTagOpen)
+    {
+        throw except::Exception(Ctxt(
+                "Attribute " + name + " must be added before the element's "
+                "content"));
+    }
+    writeAttribute(qualify(name, uri), value);
+}
+
+void XMLStreamWriter::addAttributeToNext(const std::string& name,
+                                         const std::string& value,
+                                         const std::string& uri)
+{
+    mNextAttributes.push_back(std::make_pair(qualify(name, uri), value));
+}
+
+void XMLStreamWriter::setNamespacePrefix(const std::string& prefix,
+                                         const std::string& uri)
+{
+    addAttribute(prefix.empty() ? "xmlns" : "xmlns:" + prefix, uri);
+    mPrefixes[uri] = prefix;
+}
+
+void XMLStreamWriter::addCharacters(const std::string& text)
+{
+    if (mOpenElements.empty())
+    {
+        throw except::Exception(Ctxt("No element to add characters to"));
+    }
+    if (!text.empty())
+    {
+        closeStartTag();
+        write(text);
+    }
+}
+
+void XMLStreamWriter::endElement()
+{
+    if (mOpenElements.empty())
+    {
+        throw except::Exception(Ctxt("No element to end"));
+    }
+    if (!mNextAttributes.empty())
+    {
+        throw except::Exception(Ctxt(
+                "Attribute " + mNextAttributes.front().first +
+                " was added for an element that was never started"));
+    }
+
+    if (mStartTagOpen)
+    {
+        writePendingAttributes();
+        write("/>", 2);
+        mStartTagOpen = false;
+    }
+    else
+    {
+        const std::string& name(mOpenElements.back());
+        write("</", 2);
+        write(name);
+        write(">", 1);
+    }
+    mOpenElements.pop_back();
+}
+
+std::string XMLStreamWriter::getCurrentElement() const
+{
+    return mOpenElements.empty() ? "" : mOpenElements.back();
+}
+
+void XMLStreamWriter::writeString(const std::string& name,
+                                  const std::string& text,
+                                  const std::string& uri)
+{
+    startElement(name, uri);
+    addCharacters(text);
+    endElement();
+}
+
+void XMLStreamWriter::writeElement(const xml::lite::Element& element)
+{
+    startElement(element.getQName());
+
+    const xml::lite::Attributes& attributes(element.getAttributes());
+    for (int ii = 0; ii < attributes.getLength(); ++ii)
+    {
+        addAttribute(attributes.getQName(ii), attributes.getValue(ii));
+    }
+
+    addCharacters(element.getCharacterData());
+
+    const std::vector<xml::lite::Element*>& children(element.getChildren());
+    for (size_t ii = 0; ii < children.size(); ++ii)
+    {
+        writeElement(*children[ii]);
+    }
+
+    endElement();
+}
+}
@@ -0,0 +1,180 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times converting PixelTypes and DualPolarizationTypes to and from strings.
+// The string compare chain is what makeEnums.py used to generate, kept here
+// as a baseline.
+// Usage: benchmark_enums [iterations]
+
+#include <stdlib.h>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <sys/StopWatch.h>
+#include <six/Enums.h>
+
+namespace
+{
+int parseChain(const std::string& s)
+{
+    if (s == "RE32F_IM32F")
+        return six::PixelType::RE32F_IM32F;
+    else if (s == "RE16I_IM16I")
+        return six::PixelType::RE16I_IM16I;
+    else if (s == "AMP8I_PHS8I")
+        return six::PixelType::AMP8I_PHS8I;
+    else if (s == "MONO8I")
+        return six::PixelType::MONO8I;
+    else if (s == "MONO8LU")
+        return six::PixelType::MONO8LU;
+    else if (s == "MONO16I")
+        return six::PixelType::MONO16I;
+    else if (s == "RGB8LU")
+        return six::PixelType::RGB8LU;
+    else if (s == "RGB24I")
+        return six::PixelType::RGB24I;
+    else if (s == "NOT_SET")
+        return six::PixelType::NOT_SET;
+    else
+        throw except::InvalidFormatException(Ctxt(FmtX(
+                "Invalid enum value: %s", s.c_str())));
+}
+
+void printResult(const std::string& name, size_t numOps, double elapsedMS)
+{
+    std::cout << "  " << std::left << std::setw(34) << name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(10)
+              << elapsedMS << " ms" << std::setw(10)
+              << elapsedMS * 1.0e6 / numOps << " ns/op\n";
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        const size_t numIterations = (argc > 1) ? ::atoi(argv[1]) : 1000000;
+
+        std::vector<std::string> names;
+        for (int ii = six::PixelType::RE32F_IM32F;
+             ii <= six::PixelType::RGB24I;
+             ++ii)
+        {
+            names.push_back(six::PixelType(ii).toString());
+        }
+        const size_t numOps = numIterations * names.size();
+
+        // Accumulate something so the loops can't be optimized away
+        size_t checksum = 0;
+
+        std::cout << "PixelType, " << numOps << " conversions\n";
+
+        sys::RealTimeStopWatch chainWatch;
+        chainWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            for (size_t jj = 0; jj < names.size(); ++jj)
+            {
+                checksum += parseChain(names[jj]);
+            }
+        }
+        printResult("parse, compare chain", numOps, chainWatch.stop());
+
+        sys::RealTimeStopWatch hashWatch;
+        hashWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            for (size_t jj = 0; jj < names.size(); ++jj)
+            {
+                checksum += six::PixelType(names[jj]);
+            }
+        }
+        printResult("parse, perfect hash", numOps, hashWatch.stop());
+
+        sys::RealTimeStopWatch formatWatch;
+        formatWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            for (int jj = six::PixelType::RE32F_IM32F;
+                 jj <= six::PixelType::RGB24I;
+                 ++jj)
+            {
+                checksum += six::PixelType(jj).toString().length();
+            }
+        }
+        printResult("format, toString()", numOps, formatWatch.stop());
+
+        sys::RealTimeStopWatch cStringWatch;
+        cStringWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            for (int jj = six::PixelType::RE32F_IM32F;
+                 jj <= six::PixelType::RGB24I;
+                 ++jj)
+            {
+                size_t length;
+                six::PixelType(jj).toCString(&length);
+                checksum += length;
+            }
+        }
+        printResult("format, toCString()", numOps, cStringWatch.stop());
+
+        std::vector<std::string> polarizations;
+        for (int ii = six::DualPolarizationType::OTHER;
+             ii <= six::DualPolarizationType::UNKNOWN;
+             ++ii)
+        {
+            polarizations.push_back(six::DualPolarizationType(ii).toString());
+        }
+        const size_t numPolarizationOps = numIterations * polarizations.size();
+
+        std::cout << "\nDualPolarizationType, " << numPolarizationOps
+                  << " conversions\n";
+
+        sys::RealTimeStopWatch polarizationWatch;
+        polarizationWatch.start();
+        for (size_t ii = 0; ii < numIterations; ++ii)
+        {
+            for (size_t jj = 0; jj < polarizations.size(); ++jj)
+            {
+                checksum += six::DualPolarizationType(
+                        polarizations[jj].data(), polarizations[jj].size());
+            }
+        }
+        printResult("parse, perfect hash", numPolarizationOps,
+                    polarizationWatch.stop());
+
+        std::cout << "\n(checksum " << checksum << ")\n";
+        return 0;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
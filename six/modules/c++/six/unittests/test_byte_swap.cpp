@@ -0,0 +1,95 @@
+/* =========================================================================
+* This file is part of six-c++
+* =========================================================================
+*
+* (C) Copyright 2004 - 2018, MDA Information Systems LLC
+*
+* six-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+#include <stdlib.h>
+#include <vector>
+
+#include "TestCase.h"
+#include <six/ByteSwap.h>
+#include <six/StagingBufferPool.h>
+
+namespace
+{
+bool testSwap(size_t elemSize, size_t numElements, size_t numThreads)
+{
+    std::vector<sys::ubyte> input(elemSize * numElements);
+    for (size_t ii = 0; ii < input.size(); ++ii)
+    {
+        input[ii] = static_cast<sys::ubyte>(rand());
+    }
+
+    std::vector<sys::ubyte> expected(input);
+    sys::byteSwap(&expected[0], static_cast<unsigned short>(elemSize),
+                  numElements);
+
+    std::vector<sys::ubyte> output(input.size());
+    six::byteSwap(&input[0], elemSize, numElements, numThreads, &output[0]);
+    return output == expected;
+}
+}
+
+TEST_CASE(ByteSwap)
+{
+    const size_t elemSizes[] = {1, 2, 3, 4, 8, 16};
+    for (size_t ii = 0; ii < sizeof(elemSizes) / sizeof(elemSizes[0]); ++ii)
+    {
+        TEST_ASSERT_TRUE(testSwap(elemSizes[ii], 1, 1));
+        TEST_ASSERT_TRUE(testSwap(elemSizes[ii], 1001, 1));
+        TEST_ASSERT_TRUE(testSwap(elemSizes[ii], 1001, 3));
+        TEST_ASSERT_TRUE(testSwap(elemSizes[ii], 2, 5));
+    }
+}
+
+TEST_CASE(StagingBufferReuse)
+{
+    mem::SharedPtr<six::StagingBufferPool> pool(
+            new six::StagingBufferPool(1));
+
+    sys::ubyte* first(NULL);
+    {
+        six::StagingBuffer staging;
+        first = staging.reserve(pool, 100);
+        TEST_ASSERT_EQ(staging.size(), static_cast<size_t>(100));
+
+        // Shrinking keeps the same memory
+        TEST_ASSERT_EQ(staging.reserve(pool, 50), first);
+    }
+    TEST_ASSERT_EQ(pool->getNumFreeBuffers(), static_cast<size_t>(1));
+
+    // Released memory is handed out again
+    six::StagingBuffer staging;
+    TEST_ASSERT_EQ(staging.reserve(pool, 80), first);
+    TEST_ASSERT_EQ(pool->getNumFreeBuffers(), static_cast<size_t>(0));
+
+    // Only one free buffer is kept around
+    six::StagingBuffer other;
+    other.reserve(pool, 10);
+    staging.reset();
+    other.reset();
+    TEST_ASSERT_EQ(pool->getNumFreeBuffers(), static_cast<size_t>(1));
+    TEST_ASSERT_NULL(staging.get());
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(ByteSwap);
+    TEST_CHECK(StagingBufferReuse);
+}
@@ -0,0 +1,165 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <cstring>
+
+#include <six/Enums.h>
+#include <six/Utilities.h>
+
+#include "TestCase.h"
+
+namespace
+{
+// Converts every value to a string and back
+template <typename EnumT>
+bool roundTrips(const int* values, size_t numValues)
+{
+    for (size_t ii = 0; ii < numValues; ++ii)
+    {
+        const EnumT value(values[ii]);
+        const std::string str(value.toString());
+        if (EnumT(str) != value ||
+            EnumT(str.c_str(), str.length()) != value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE(testRoundTrip)
+{
+    const int pixelTypes[] =
+    {
+        six::PixelType::RE32F_IM32F, six::PixelType::RE16I_IM16I,
+        six::PixelType::AMP8I_PHS8I, six::PixelType::MONO8I,
+        six::PixelType::MONO8LU, six::PixelType::MONO16I,
+        six::PixelType::RGB8LU, six::PixelType::RGB24I,
+        six::PixelType::NOT_SET
+    };
+    TEST_ASSERT(roundTrips<six::PixelType>(
+            pixelTypes, sizeof(pixelTypes) / sizeof(pixelTypes[0])));
+
+    const int polarizations[] =
+    {
+        six::DualPolarizationType::OTHER, six::DualPolarizationType::V_V,
+        six::DualPolarizationType::V_H, six::DualPolarizationType::H_V,
+        six::DualPolarizationType::H_H, six::DualPolarizationType::RHC_RHC,
+        six::DualPolarizationType::RHC_LHC,
+        six::DualPolarizationType::LHC_RHC,
+        six::DualPolarizationType::LHC_LHC,
+        six::DualPolarizationType::UNKNOWN,
+        six::DualPolarizationType::NOT_SET
+    };
+    TEST_ASSERT(roundTrips<six::DualPolarizationType>(
+            polarizations, sizeof(polarizations) / sizeof(polarizations[0])));
+
+    const int sides[] =
+    {
+        six::SideOfTrackType::LEFT, six::SideOfTrackType::RIGHT,
+        six::SideOfTrackType::NOT_SET
+    };
+    TEST_ASSERT(roundTrips<six::SideOfTrackType>(
+            sides, sizeof(sides) / sizeof(sides[0])));
+
+    const int earthModels[] = {six::EarthModelType::WGS84,
+                               six::EarthModelType::NOT_SET};
+    TEST_ASSERT(roundTrips<six::EarthModelType>(
+            earthModels, sizeof(earthModels) / sizeof(earthModels[0])));
+}
+
+TEST_CASE(testParse)
+{
+    TEST_ASSERT_EQ(six::PixelType("AMP8I_PHS8I"),
+                   six::PixelType(six::PixelType::AMP8I_PHS8I));
+    TEST_ASSERT_EQ(six::SideOfTrackType(std::string("RIGHT")),
+                   six::SideOfTrackType(six::SideOfTrackType::RIGHT));
+
+    // Characters out of the middle of a larger buffer
+    const char buffer[] = "<PixelType>MONO16I</PixelType>";
+    TEST_ASSERT_EQ(six::PixelType(buffer + 11, 7),
+                   six::PixelType(six::PixelType::MONO16I));
+}
+
+TEST_CASE(testInvalidStrings)
+{
+    TEST_EXCEPTION(six::PixelType(""));
+    TEST_EXCEPTION(six::PixelType("MONO"));
+    TEST_EXCEPTION(six::PixelType("MONO8I "));
+    TEST_EXCEPTION(six::PixelType("mono8i"));
+    TEST_EXCEPTION(six::PixelType("MONO8X"));
+    TEST_EXCEPTION(six::SideOfTrackType("LEFX"));
+    TEST_EXCEPTION(six::SideOfTrackType("LEFTRIGHT"));
+
+    const char buffer[] = "MONO16I";
+    TEST_EXCEPTION(six::PixelType(buffer, 5));
+    TEST_EXCEPTION(six::PixelType(buffer, 0));
+}
+
+TEST_CASE(testToString)
+{
+    const six::PixelType pixelType(six::PixelType::RGB8LU);
+    TEST_ASSERT_EQ(pixelType.toString(), "RGB8LU");
+    TEST_ASSERT_EQ(static_cast<std::string>(pixelType), "RGB8LU");
+
+    size_t length = 0;
+    const char* const name = pixelType.toCString(&length);
+    TEST_ASSERT_EQ(length, static_cast<size_t>(6));
+    TEST_ASSERT_EQ(std::strcmp(name, "RGB8LU"), 0);
+
+    // The same static characters every time
+    TEST_ASSERT(pixelType.toCString() == name);
+
+    six::PixelType invalid;
+    invalid.value = 42;
+    TEST_EXCEPTION(invalid.toString());
+    TEST_EXCEPTION(invalid.toCString());
+}
+
+TEST_CASE(testToType)
+{
+    TEST_ASSERT_EQ(six::toType<six::PixelType>(" \n\tMONO8LU \n"),
+                   six::PixelType(six::PixelType::MONO8LU));
+    TEST_ASSERT_EQ(six::toType<six::ImageFormationType>("PFA"),
+                   six::ImageFormationType(six::ImageFormationType::PFA));
+    TEST_EXCEPTION(six::toType<six::ImageFormationType>("NOT_SET"));
+    TEST_EXCEPTION(six::toType<six::ImageFormationType>(" "));
+    TEST_EXCEPTION(six::toType<six::ImageFormationType>("PF A"));
+
+    // These two have always fallen back to NOT_SET rather than throwing
+    TEST_ASSERT_EQ(six::toType<six::DecimationMethod>("LAGRANGE "),
+                   six::DecimationMethod(six::DecimationMethod::LAGRANGE));
+    TEST_ASSERT_EQ(six::toType<six::MagnificationMethod>("CUBIC"),
+                   six::MagnificationMethod(
+                           six::MagnificationMethod::NOT_SET));
+}
+}
+
+int main(int , char** )
+{
+    TEST_CHECK(testRoundTrip);
+    TEST_CHECK(testParse);
+    TEST_CHECK(testInvalidStrings);
+    TEST_CHECK(testToString);
+    TEST_CHECK(testToType);
+    return 0;
+}
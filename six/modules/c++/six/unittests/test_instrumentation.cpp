@@ -0,0 +1,130 @@
+/* =========================================================================
+* This file is part of six-c++
+* =========================================================================
+*
+* (C) Copyright 2004 - 2018, MDA Information Systems LLC
+*
+* six-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+#include <string>
+
+#include "TestCase.h"
+#include <io/FileInputStream.h>
+#include <io/StringStream.h>
+#include <logging/Logger.h>
+#include <logging/StreamHandler.h>
+#include <sys/OS.h>
+#include <six/Instrumentation.h>
+
+namespace
+{
+// Stand-in for an instrumented stage
+void runStage(const char* stage, size_t numBytes, size_t numRows)
+{
+    six::ScopedStageTimer timer(stage);
+    timer.addBytes(numBytes);
+    timer.addRows(numRows);
+}
+
+TEST_CASE(testStatistics)
+{
+    six::StatisticsSink sink;
+
+    // Nothing is recorded without a sink installed
+    runStage("test.ignored", 1, 1);
+
+    six::setInstrumentationSink(&sink);
+    runStage("test.read", 100, 2);
+    runStage("test.read", 300, 6);
+    runStage("test.swap", 50, 0);
+    six::setInstrumentationSink(NULL);
+    runStage("test.read", 1000, 1000);
+
+    const six::StatisticsSink::Snapshot snapshot = sink.getSnapshot();
+#ifndef SIX_DISABLE_INSTRUMENTATION
+    TEST_ASSERT_EQ(snapshot.size(), static_cast<size_t>(2));
+    const six::StageStatistics& read(snapshot.find("test.read")->second);
+    TEST_ASSERT_EQ(read.count, static_cast<size_t>(2));
+    TEST_ASSERT_EQ(read.numBytes, static_cast<sys::Uint64_T>(400));
+    TEST_ASSERT_EQ(read.numRows, static_cast<sys::Uint64_T>(8));
+    TEST_ASSERT(read.minMS <= read.maxMS);
+    TEST_ASSERT(read.totalMS >= read.maxMS);
+
+    const six::StageStatistics& swap(snapshot.find("test.swap")->second);
+    TEST_ASSERT_EQ(swap.count, static_cast<size_t>(1));
+    TEST_ASSERT_EQ(swap.numBytes, static_cast<sys::Uint64_T>(50));
+#else
+    TEST_ASSERT(snapshot.empty());
+#endif
+
+    sink.clear();
+    TEST_ASSERT(sink.getSnapshot().empty());
+}
+
+TEST_CASE(testChromeTrace)
+{
+    const std::string pathname("test_instrumentation_trace.json");
+    {
+        six::ChromeTraceSink sink(pathname);
+        six::setInstrumentationSink(&sink);
+        runStage("test.read", 100, 2);
+        runStage("test.convert", 200, 2);
+        six::setInstrumentationSink(NULL);
+    }
+
+    io::FileInputStream inStream(pathname);
+    io::StringStream trace;
+    inStream.streamTo(trace);
+    inStream.close();
+    sys::OS().remove(pathname);
+
+    const std::string json = trace.stream().str();
+    TEST_ASSERT_EQ(json.find("{\"traceEvents\":["), static_cast<size_t>(0));
+#ifndef SIX_DISABLE_INSTRUMENTATION
+    TEST_ASSERT(json.find("\"name\":\"test.read\"") != std::string::npos);
+    TEST_ASSERT(json.find("\"name\":\"test.convert\"") != std::string::npos);
+    TEST_ASSERT(json.find("\"bytes\":200") != std::string::npos);
+    TEST_ASSERT(json.find("\"ph\":\"X\"") != std::string::npos);
+#endif
+}
+
+TEST_CASE(testLogger)
+{
+    io::StringStream* const output = new io::StringStream();
+    logging::Logger log;
+    log.addHandler(new logging::StreamHandler(output), true);
+
+    six::LoggerSink sink(log, logging::LogLevel::LOG_INFO);
+    six::setInstrumentationSink(&sink);
+    runStage("test.write", 4096, 16);
+    six::setInstrumentationSink(NULL);
+
+#ifndef SIX_DISABLE_INSTRUMENTATION
+    const std::string logged = output->stream().str();
+    TEST_ASSERT(logged.find("test.write: ") != std::string::npos);
+    TEST_ASSERT(logged.find("4096 bytes") != std::string::npos);
+    TEST_ASSERT(logged.find("16 rows") != std::string::npos);
+#endif
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testStatistics);
+    TEST_CHECK(testChromeTrace);
+    TEST_CHECK(testLogger);
+    return 0;
+}
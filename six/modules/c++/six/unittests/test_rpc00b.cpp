@@ -0,0 +1,161 @@
+/* =========================================================================
+* This file is part of six-c++
+* =========================================================================
+*
+* (C) Copyright 2004 - 2018, MDA Information Systems LLC
+*
+* six-c++ is free software; you can redistribute it and/or modify
+* it under the terms of the GNU Lesser General Public License as published by
+* the Free Software Foundation; either version 3 of the License, or
+* (at your option) any later version.
+*
+* This program is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU Lesser General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public
+* License along with this program; If not,
+* see <http://www.gnu.org/licenses/>.
+*
+*/
+#include <cmath>
+#include <string>
+
+#include "TestCase.h"
+#include <scene/RPCModel.h>
+#include <six/Utilities.h>
+
+namespace
+{
+scene::RPCModel createRPC()
+{
+    scene::RPCModel rpc;
+    rpc.errorBias = 12.34;
+    rpc.lineOffset = 1200.0;
+    rpc.sampleOffset = 900.0;
+    rpc.latOffset = 34.5678;
+    rpc.lonOffset = -117.1234;
+    rpc.heightOffset = 300.0;
+    rpc.lineScale = 1300.0;
+    rpc.sampleScale = 1000.0;
+    rpc.latScale = 0.0512;
+    rpc.lonScale = 0.0634;
+    rpc.heightScale = 500.0;
+
+    for (size_t ii = 0; ii < scene::RPCModel::NUM_COEFFS; ++ii)
+    {
+        const double sign = (ii % 2 == 0) ? 1.0 : -1.0;
+        rpc.lineNumCoeffs[ii] = sign * 1.234567 * std::pow(10.0, -1.0 * ii);
+        rpc.sampleNumCoeffs[ii] = -sign * 7.654321 * std::pow(10.0, -0.5 * ii);
+        if (ii > 0)
+        {
+            rpc.lineDenCoeffs[ii] = sign * 2.5e-4 / ii;
+            rpc.sampleDenCoeffs[ii] = -sign * 1.5e-4 / ii;
+        }
+    }
+    return rpc;
+}
+
+bool almostEqual(double lhs, double rhs)
+{
+    return std::abs(lhs - rhs) <= 5e-7 * std::max(1.0, std::abs(rhs));
+}
+
+TEST_CASE(RoundTrip)
+{
+    const scene::RPCModel rpc(createRPC());
+    nitf::TRE tre = six::createRPC00B(rpc);
+
+    std::string value = tre.getField("LAT_OFF").toString();
+    TEST_ASSERT_EQ(value, std::string("+34.5678"));
+    value = tre.getField("LONG_OFF").toString();
+    TEST_ASSERT_EQ(value, std::string("-117.1234"));
+    value = tre.getField("ERR_BIAS").toString();
+    TEST_ASSERT_EQ(value, std::string("0012.34"));
+    value = tre.getField("ERR_RAND").toString();
+    TEST_ASSERT_EQ(value, std::string("0000.00"));
+    value = tre.getField("LINE_NUM_COEFF[0]").toString();
+    TEST_ASSERT_EQ(value, std::string("+1.234567E+0"));
+
+    // Too small for a single digit exponent
+    value = tre.getField("LINE_NUM_COEFF[19]").toString();
+    TEST_ASSERT_EQ(value, std::string("+0.000000E+0"));
+
+    const scene::RPCModel parsed = six::parseRPC00B(tre);
+    TEST_ASSERT_EQ(parsed.errorBias, rpc.errorBias);
+    TEST_ASSERT_EQ(parsed.errorRandom, 0.0);
+    TEST_ASSERT_EQ(parsed.lineOffset, rpc.lineOffset);
+    TEST_ASSERT_EQ(parsed.sampleOffset, rpc.sampleOffset);
+    TEST_ASSERT_EQ(parsed.latOffset, rpc.latOffset);
+    TEST_ASSERT_EQ(parsed.lonOffset, rpc.lonOffset);
+    TEST_ASSERT_EQ(parsed.heightOffset, rpc.heightOffset);
+    TEST_ASSERT_EQ(parsed.latScale, rpc.latScale);
+    TEST_ASSERT_EQ(parsed.lonScale, rpc.lonScale);
+
+    for (size_t ii = 0; ii < 10; ++ii)
+    {
+        TEST_ASSERT(almostEqual(parsed.lineNumCoeffs[ii],
+                                rpc.lineNumCoeffs[ii]));
+        TEST_ASSERT(almostEqual(parsed.sampleNumCoeffs[ii],
+                                rpc.sampleNumCoeffs[ii]));
+        TEST_ASSERT(almostEqual(parsed.lineDenCoeffs[ii],
+                                rpc.lineDenCoeffs[ii]));
+        TEST_ASSERT(almostEqual(parsed.sampleDenCoeffs[ii],
+                                rpc.sampleDenCoeffs[ii]));
+    }
+}
+
+TEST_CASE(SegmentShift)
+{
+    const scene::RPCModel rpc(createRPC());
+    const scene::LatLonAlt groundPt(34.55, -117.1, 250.0);
+
+    // The first segment keeps the offset, the second moves it to 0 since it
+    // starts past it.  Either way, the same ground point should land on the
+    // same full image row once we add the segment's first row back.
+    const size_t firstRows[] = {0, 1000, 2000};
+    const types::RowCol<double> expected = six::parseRPC00B(
+            six::createRPC00B(rpc)).groundToImage(groundPt);
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        nitf::TRE tre = six::createRPC00B(rpc, firstRows[ii]);
+        const double lineOffset = str::toType<double>(
+                tre.getField("LINE_OFF").toString());
+        TEST_ASSERT_EQ(lineOffset, std::max(1200.0 - firstRows[ii], 0.0));
+
+        const scene::RPCModel parsed = six::parseRPC00B(tre, firstRows[ii]);
+        const types::RowCol<double> imagePt = parsed.groundToImage(groundPt);
+        TEST_ASSERT_ALMOST_EQ_EPS(imagePt.row, expected.row, 1e-3);
+        TEST_ASSERT_ALMOST_EQ_EPS(imagePt.col, expected.col, 1e-6);
+    }
+}
+
+TEST_CASE(OutOfRange)
+{
+    scene::RPCModel rpc(createRPC());
+    rpc.latOffset = 123.4;
+    TEST_EXCEPTION(six::createRPC00B(rpc));
+
+    rpc = createRPC();
+    rpc.lineNumCoeffs[1] = 1.0e10;
+    TEST_EXCEPTION(six::createRPC00B(rpc));
+
+    // Would round up to 10000.00
+    rpc = createRPC();
+    rpc.errorBias = 9999.996;
+    TEST_EXCEPTION(six::createRPC00B(rpc));
+
+    rpc.errorBias = 9999.99;
+    nitf::TRE tre = six::createRPC00B(rpc);
+    TEST_ASSERT_EQ(tre.getField("ERR_BIAS").toString(),
+                   std::string("9999.99"));
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(RoundTrip);
+    TEST_CHECK(SegmentShift);
+    TEST_CHECK(OutOfRange);
+}
@@ -117,9 +117,108 @@ TEST_CASE(VectorSerialize)
     TEST_ASSERT_TRUE(testVector<double>(length, true));
 }
 
+TEST_CASE(BulkMatchesElementwise)
+{
+    // The bulk path must produce exactly what serializing each element
+    // after the length would
+    const std::vector<double> val = getRandomVector<double>(99);
+    for (int swap = 0; swap < 2; ++swap)
+    {
+        std::vector<sys::byte> expected;
+        six::serialize(val.size(), swap != 0, expected);
+        for (size_t ii = 0; ii < val.size(); ++ii)
+        {
+            six::serialize(val[ii], swap != 0, expected);
+        }
+
+        std::vector<sys::byte> serializedData;
+        six::serialize(val, swap != 0, serializedData);
+        TEST_ASSERT(serializedData == expected);
+        TEST_ASSERT_EQ(six::getSerializedSize(val), expected.size());
+    }
+
+    // Appending to a vector that already has data
+    std::vector<float> existing(3, 1.5f);
+    const std::vector<float> more = getRandomVector<float>(10);
+    std::vector<sys::byte> serializedData;
+    six::serialize(more, true, serializedData);
+    const sys::byte* buffer = &serializedData[0];
+    six::deserialize(buffer, true, existing);
+    TEST_ASSERT_EQ(existing.size(), 13);
+    TEST_ASSERT_EQ(existing[2], 1.5f);
+    TEST_ASSERT(std::equal(more.begin(), more.end(), existing.begin() + 3));
+    TEST_ASSERT(buffer == &serializedData[0] + serializedData.size());
+}
+
+TEST_CASE(NestedVectorSerialize)
+{
+    std::vector<std::vector<int> > val(4);
+    for (size_t ii = 0; ii < val.size(); ++ii)
+    {
+        val[ii] = getRandomVector<int>(ii * 5);
+    }
+
+    std::vector<sys::byte> serializedData;
+    six::serialize(val, true, serializedData);
+    TEST_ASSERT_EQ(six::getSerializedSize(val), serializedData.size());
+
+    const sys::byte* buffer = &serializedData[0];
+    std::vector<std::vector<int> > valCopy;
+    six::deserialize(buffer, true, valCopy);
+    TEST_ASSERT(val == valCopy);
+}
+
+TEST_CASE(VectorView)
+{
+    const std::vector<double> val = getRandomVector<double>(57);
+    for (int swap = 0; swap < 2; ++swap)
+    {
+        // Offset by a byte so the elements are misaligned as well
+        for (size_t offset = 0; offset < 2; ++offset)
+        {
+            std::vector<sys::byte> serializedData(offset);
+            six::serialize(val, swap != 0, serializedData);
+            six::serialize(42, swap != 0, serializedData);
+
+            const sys::byte* buffer = &serializedData[offset];
+            six::SerializedVectorView<double> view;
+            six::deserializeView(buffer, swap != 0, view);
+
+            TEST_ASSERT_EQ(view.size(), val.size());
+            TEST_ASSERT(view.toVector() == val);
+            TEST_ASSERT_EQ(view[10], val[10]);
+
+            std::vector<double> range(5);
+            view.copyTo(20, 5, &range[0]);
+            TEST_ASSERT(std::equal(range.begin(), range.end(),
+                                   val.begin() + 20));
+
+            // Only points into the buffer when nothing needs swapping
+            const bool isAligned = reinterpret_cast<size_t>(buffer) %
+                    sizeof(double) == 0;
+            if (swap == 0 && offset == 0 && isAligned)
+            {
+                TEST_ASSERT(view.data() != NULL);
+            }
+            if (swap != 0)
+            {
+                TEST_ASSERT_NULL(view.data());
+            }
+
+            // The pointer moves past the vector
+            int next;
+            six::deserialize(buffer, swap != 0, next);
+            TEST_ASSERT_EQ(next, 42);
+        }
+    }
+}
+
 int main(int, char**)
 {
     srand(time(NULL));
     TEST_CHECK(ScalarSerialize);
     TEST_CHECK(VectorSerialize);
+    TEST_CHECK(BulkMatchesElementwise);
+    TEST_CHECK(NestedVectorSerialize);
+    TEST_CHECK(VectorView);
 }
@@ -0,0 +1,188 @@
+/* =========================================================================
+ * This file is part of six-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * six-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include <io/StringStream.h>
+#include <xml/lite/Element.h>
+#include <six/SICommonXMLParser01x.h>
+#include <six/SICommonXMLParser10x.h>
+#include <six/XMLStreamWriter.h>
+
+#include "TestCase.h"
+
+namespace
+{
+std::string print(const xml::lite::Element& element)
+{
+    io::StringStream ss;
+    element.print(ss);
+    return ss.stream().str();
+}
+
+std::string write(const xml::lite::Element& element)
+{
+    std::string xml;
+    six::XMLStreamWriter writer(&xml);
+    writer.writeElement(element);
+    return xml;
+}
+
+TEST_CASE(testElement)
+{
+    xml::lite::Element root("Root", "urn:test");
+    root.setNamespacePrefix("", "urn:test");
+    root.attribute("version") = "1";
+
+    xml::lite::Element* const text =
+            new xml::lite::Element("Text", "urn:test", "some text");
+    text->attribute("a") = "x";
+    text->attribute("b") = "y";
+    root.addChild(text);
+    root.addChild(new xml::lite::Element("Empty", "urn:test"));
+
+    xml::lite::Element* const mixed =
+            new xml::lite::Element("Mixed", "urn:test", "before");
+    mixed->addChild(new xml::lite::Element("Child", "urn:test", "1"));
+    mixed->addChild(new xml::lite::Element("Child", "urn:test"));
+    root.addChild(mixed);
+
+    const std::string expected = print(root);
+    TEST_ASSERT_EQ(write(root), expected);
+
+    six::XMLStreamWriter counter;
+    counter.writeElement(root);
+    TEST_ASSERT_EQ(counter.getNumBytes(), expected.size());
+}
+
+TEST_CASE(testStreaming)
+{
+    std::string xml;
+    six::XMLStreamWriter writer(&xml);
+    writer.startElement("A");
+    writer.addAttribute("x", "1");
+    writer.writeString("B", "");
+    writer.writeString("C", "text");
+    writer.startElement("D");
+    writer.addCharacters("");
+    writer.endElement();
+    TEST_ASSERT_EQ(writer.getDepth(), static_cast<size_t>(1));
+    writer.endElement();
+    TEST_ASSERT_EQ(writer.getDepth(), static_cast<size_t>(0));
+    TEST_ASSERT_EQ(xml, "<A x=\"1\"><B/><C>text</C><D/></A>");
+
+    // Attributes have to come first
+    writer.startElement("E");
+    writer.addCharacters("text");
+    TEST_EXCEPTION(writer.addAttribute("y", "2"));
+    writer.endElement();
+    TEST_EXCEPTION(writer.endElement());
+}
+
+void checkCommonTypes(const std::string& testName,
+                      const six::SICommonXMLParser& parser,
+                      const std::string& uri,
+                      const std::string& siURI)
+{
+
+    six::Vector3 vector;
+    vector[0] = 6378137.0;
+    vector[1] = -1.5e-12;
+    vector[2] = 0.0;
+
+    six::Poly1D poly1D(3);
+    six::Poly2D poly2D(2, 1);
+    six::PolyXYZ polyXYZ(2);
+    for (size_t ii = 0; ii <= 3; ++ii)
+    {
+        poly1D[ii] = -1.0 / (ii + 3);
+    }
+    for (size_t ii = 0; ii <= 2; ++ii)
+    {
+        poly2D[ii][0] = 1e20 * ii;
+        poly2D[ii][1] = -3.0;
+        polyXYZ[ii] = vector * static_cast<double>(ii);
+    }
+
+    six::LatLonAlt lla(12.5, -45.25, 101.0);
+
+    six::ParameterCollection parameters;
+    six::Parameter parameter(3.5);
+    parameter.setName("name");
+    parameters.push_back(parameter);
+    parameters.push_back(parameter);
+
+    six::RowColInt rowCol(3, -4);
+
+    // What the SICommonXMLParser methods build prints the same
+    xml::lite::Element root("Root", uri);
+    parser.createVector3D("Vector", vector, &root);
+    parser.createPoly1D("Poly1D", poly1D, &root);
+    parser.createPoly2D("Poly2D", poly2D, &root);
+    parser.createPolyXYZ("PolyXYZ", polyXYZ, &root);
+    parser.createLatLonAlt("LLA", lla, &root);
+    parser.createRowCol("RowCol", siURI, rowCol, &root);
+    parser.addParameters("Parameter", parameters, &root);
+    root.setNamespacePrefix("", uri);
+    root.setNamespacePrefix("si", siURI);
+
+    const std::string expected = print(root);
+    TEST_ASSERT_EQ(write(root), expected);
+
+    // ... and so does writing the same things without the DOM
+    std::string xml;
+    six::XMLStreamWriter writer(&xml);
+    writer.startElement("Root", uri);
+    writer.setNamespacePrefix("", uri);
+    writer.setNamespacePrefix("si", siURI);
+    parser.writeVector3D(writer, "Vector", vector);
+    parser.writePoly1D(writer, "Poly1D", poly1D);
+    parser.writePoly2D(writer, "Poly2D", poly2D);
+    parser.writePolyXYZ(writer, "PolyXYZ", polyXYZ);
+    parser.writeLatLonAlt(writer, "LLA", lla);
+    parser.writeRowCol(writer, "RowCol", siURI, rowCol);
+    parser.writeParameters(writer, "Parameter", parameters);
+    writer.endElement();
+    TEST_ASSERT_EQ(xml, expected);
+}
+
+TEST_CASE(testCommonTypes)
+{
+    const std::string uri("urn:test");
+    const std::string siURI("urn:si");
+    checkCommonTypes(testName, six::SICommonXMLParser10x(uri, false, siURI),
+                     uri, siURI);
+
+    // SICD 0.4 adds class attributes
+    checkCommonTypes(testName, six::SICommonXMLParser01x(uri, true, siURI),
+                     uri, siURI);
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testElement);
+    TEST_CHECK(testStreaming);
+    TEST_CHECK(testCommonTypes);
+    return 0;
+}
@@ -0,0 +1,465 @@
+/* =========================================================================
+ * This file is part of tasks-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * tasks-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef __TASKS_TASK_SCHEDULER_H__
+#define __TASKS_TASK_SCHEDULER_H__
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <except/Exception.h>
+#include <mem/SharedPtr.h>
+#include <mt/Runnable1D.h>
+#include <mt/Singleton.h>
+#include <mt/ThreadGroup.h>
+#include <mt/ThreadPlanner.h>
+#include <sys/ConditionVar.h>
+#include <sys/Mutex.h>
+#include <sys/Runnable.h>
+
+namespace tasks
+{
+/*!
+ * \class TaskObserver
+ * \brief Timing hook for the tasks a TaskScheduler runs
+ *
+ * taskFinished() is called from whichever thread ran the task, so
+ * implementations must be thread-safe.
+ */
+class TaskObserver
+{
+public:
+    virtual ~TaskObserver()
+    {
+    }
+
+    /*!
+     * Called right after a task finishes (whether or not it threw)
+     *
+     * \param name Name the task was submitted with
+     * \param workerNum Index of the worker thread that ran the task, or
+     * TaskScheduler::NOT_A_WORKER if a thread waiting on its TaskGroup ran it
+     * \param elapsedMS Wall clock time the task took in milliseconds
+     */
+    virtual void taskFinished(const std::string& name,
+                              size_t workerNum,
+                              double elapsedMS) = 0;
+};
+
+class TaskGroup;
+
+/*!
+ * \class TaskScheduler
+ * \brief Work-stealing thread pool
+ *
+ * Each worker thread has its own deque of tasks.  Tasks submitted from a
+ * worker go on the back of its own deque and it pops from the back, so
+ * nested work stays on the thread (and in the cache) that created it.  An
+ * idle worker steals from the front of the other workers' deques.  Tasks
+ * submitted from outside the pool are handed out round robin.
+ *
+ * Tasks are always submitted through a TaskGroup.  A thread waiting on a
+ * TaskGroup runs queued tasks itself until the group is done rather than
+ * blocking, so it's safe for a task to create and wait on its own TaskGroup
+ * (or call parallelFor()) without tying up a worker.
+ *
+ * Most code should use the process-wide instance via SharedTaskScheduler
+ * rather than creating its own pool.
+ */
+class TaskScheduler
+{
+public:
+    //! Worker number reported for threads that aren't in the pool
+    static const size_t NOT_A_WORKER;
+
+    /*!
+     * Starts the worker threads
+     *
+     * \param numThreads Number of worker threads.  If 0, uses one per CPU.
+     */
+    explicit TaskScheduler(size_t numThreads = 0);
+
+    //! Finishes any queued tasks and joins the worker threads
+    ~TaskScheduler();
+
+    //! \return The number of worker threads
+    size_t getNumThreads() const;
+
+    /*!
+     * Changes the number of worker threads.  This blocks until all tasks
+     * that have already been submitted finish, and holds off new submissions
+     * until the new workers have started.  It may not be called from a task.
+     *
+     * \param numThreads Number of worker threads.  If 0, uses one per CPU.
+     */
+    void setNumThreads(size_t numThreads);
+
+    /*!
+     * Installs a timing hook that gets called after each task finishes.
+     * Set this before submitting tasks that should be timed.
+     *
+     * \param observer Observer to call, or NULL to turn timing off.  The
+     * scheduler does not take ownership.  Tasks that have already started
+     * keep the observer that was installed when they started, so it must
+     * outlive them.
+     */
+    void setObserver(TaskObserver* observer);
+
+    //! \return The worker number of the calling thread or NOT_A_WORKER
+    size_t getWorkerNum() const;
+
+    /*!
+     * Calls op(ii) for every ii in [0, numElements), split into contiguous
+     * chunks that run as separate tasks.  Returns when all chunks have
+     * finished, rethrowing the first exception any of them threw.
+     *
+     * \param numElements Number of elements
+     * \param numThreads Number of chunks to split the elements into, which
+     * bounds how many threads work on this call at once.  If 0, uses one
+     * chunk per worker.  If 1, op is called on the calling thread.
+     * \param op Functor to call.  It's shared across chunks so operator()
+     * must be const and thread-safe.
+     * \param name Name passed to the TaskObserver
+     */
+    template <typename OpT>
+    void parallelFor(size_t numElements,
+                     size_t numThreads,
+                     const OpT& op,
+                     const std::string& name = "");
+
+private:
+    friend class TaskGroup;
+
+    struct Job
+    {
+        Job() :
+            task(NULL),
+            group(NULL),
+            observer(NULL)
+        {
+        }
+
+        Job(sys::Runnable* task_,
+            TaskGroup* group_,
+            const std::string& name_) :
+            task(task_),
+            group(group_),
+            name(name_),
+            observer(NULL)
+        {
+        }
+
+        sys::Runnable* task;
+        TaskGroup* group;
+        std::string name;
+
+        // Set by findJob() when the job is taken off the queue
+        TaskObserver* observer;
+    };
+
+    struct Worker
+    {
+        std::deque<Job> jobs;
+        sys::Mutex mutex;
+    };
+
+    class WorkerRunnable;
+
+    // Noncopyable
+    TaskScheduler(const TaskScheduler& );
+    const TaskScheduler& operator=(const TaskScheduler& );
+
+    void start(size_t numThreads);
+
+    void stop();
+
+    // Called by threads outside the pool around any access to mWorkers
+    void enter();
+
+    void leave();
+
+    void registerWorker(size_t workerNum);
+
+    void submit(const Job& job);
+
+    bool findJob(size_t workerNum, Job& job);
+
+    void execute(const Job& job, size_t workerNum);
+
+    void runWorker(size_t workerNum);
+
+    void wait(TaskGroup& group);
+
+    std::vector<mem::SharedPtr<Worker> > mWorkers;
+    std::auto_ptr<mt::ThreadGroup> mThreads;
+
+    // Guards mWorkerNums
+    mutable sys::Mutex mWorkerNumsMutex;
+    std::map<long, size_t> mWorkerNums;
+
+    // Guards everything below along with TaskGroup::mNumRemaining.  This is
+    // never held at the same time as a Worker's mutex.
+    mutable sys::Mutex mMutex;
+    TaskObserver* mObserver;
+    size_t mNumThreads;
+    sys::ConditionVar mStateChanged;
+    sys::ConditionVar mConfigChanged;
+    long mNumQueued;
+    size_t mNextWorker;
+    size_t mNumClients;
+    bool mReconfiguring;
+    bool mShutdown;
+
+    // Serializes setNumThreads()
+    sys::Mutex mConfigMutex;
+};
+
+/*!
+ * \class TaskGroup
+ * \brief Set of tasks submitted to a TaskScheduler that can be waited on
+ * together
+ *
+ * This is the TaskScheduler equivalent of mt::ThreadGroup.  Tasks start
+ * running as soon as they're created.  Tasks may create more tasks in the
+ * same group while it's being waited on.
+ */
+class TaskGroup
+{
+public:
+    /*!
+     * \param name Default name passed to the TaskObserver for tasks in this
+     * group
+     */
+    explicit TaskGroup(const std::string& name = "");
+
+    /*!
+     * \param scheduler Scheduler to run tasks on
+     * \param name Default name passed to the TaskObserver for tasks in this
+     * group
+     */
+    explicit TaskGroup(TaskScheduler& scheduler,
+                       const std::string& name = "");
+
+    //! Waits for all tasks to finish, discarding any exceptions
+    ~TaskGroup();
+
+    /*!
+     * Submits a task
+     *
+     * \param task Task to run.  The group takes ownership.
+     */
+    void createTask(sys::Runnable* task);
+
+    /*!
+     * Submits a task
+     *
+     * \param task Task to run
+     */
+    void createTask(std::auto_ptr<sys::Runnable> task);
+
+    /*!
+     * Submits a task
+     *
+     * \param task Task to run
+     * \param name Name passed to the TaskObserver for this task
+     */
+    void createTask(std::auto_ptr<sys::Runnable> task,
+                    const std::string& name);
+
+    /*!
+     * Waits for all tasks to finish, running queued tasks on this thread in
+     * the meantime.  If any tasks threw, rethrows the first exception.
+     */
+    void wait();
+
+    //! \return The scheduler this group runs on
+    TaskScheduler& getScheduler() const
+    {
+        return mScheduler;
+    }
+
+private:
+    friend class TaskScheduler;
+
+    // Noncopyable
+    TaskGroup(const TaskGroup& );
+    const TaskGroup& operator=(const TaskGroup& );
+
+    void addException(const except::Exception& ex);
+
+    TaskScheduler& mScheduler;
+    const std::string mName;
+
+    // Guards mTasks and mExceptions
+    sys::Mutex mMutex;
+    std::vector<mem::SharedPtr<sys::Runnable> > mTasks;
+    std::vector<except::Exception> mExceptions;
+
+    // Guarded by the scheduler's mutex
+    size_t mNumRemaining;
+};
+
+/*!
+ * \class TaskGraph
+ * \brief Set of tasks with dependencies between them
+ *
+ * A task is submitted once all of its prerequisites have finished.  If a
+ * task throws, the tasks that depend on it (directly or indirectly) are
+ * skipped and run() rethrows once everything else is done.
+ */
+class TaskGraph
+{
+public:
+    /*!
+     * \param name Default name passed to the TaskObserver for tasks in this
+     * graph
+     */
+    explicit TaskGraph(const std::string& name = "");
+
+    /*!
+     * Adds a task
+     *
+     * \param task Task to run.  The graph takes ownership.
+     * \param name Name passed to the TaskObserver.  If empty, the graph's
+     * name is used.
+     *
+     * \return Index of the task for use with addDependency()
+     */
+    size_t addTask(sys::Runnable* task, const std::string& name = "");
+
+    /*!
+     * Adds a task
+     *
+     * \param task Task to run
+     * \param name Name passed to the TaskObserver.  If empty, the graph's
+     * name is used.
+     *
+     * \return Index of the task for use with addDependency()
+     */
+    size_t addTask(std::auto_ptr<sys::Runnable> task,
+                   const std::string& name = "");
+
+    /*!
+     * Makes one task wait for another
+     *
+     * \param prerequisite Index of the task that must finish first
+     * \param dependent Index of the task that must wait for it
+     */
+    void addDependency(size_t prerequisite, size_t dependent);
+
+    //! \return The number of tasks in the graph
+    size_t getNumTasks() const
+    {
+        return mNodes.size();
+    }
+
+    /*!
+     * Runs the graph on the shared scheduler.  Throws if the dependencies
+     * have a cycle.  The graph may be run more than once.
+     */
+    void run() const;
+
+    /*!
+     * Runs the graph.  Throws if the dependencies have a cycle.  The graph
+     * may be run more than once.
+     *
+     * \param scheduler Scheduler to run on
+     */
+    void run(TaskScheduler& scheduler) const;
+
+private:
+    struct Node
+    {
+        Node() :
+            numPrerequisites(0)
+        {
+        }
+
+        mem::SharedPtr<sys::Runnable> task;
+        std::string name;
+        std::vector<size_t> dependents;
+        size_t numPrerequisites;
+    };
+
+    class NodeRunnable;
+
+    void checkForCycles() const;
+
+    const std::string mName;
+    std::vector<Node> mNodes;
+};
+
+//! Process-wide scheduler that all of six's modules share
+typedef mt::Singleton<TaskScheduler, true> SharedTaskScheduler;
+
+template <typename OpT>
+void TaskScheduler::parallelFor(size_t numElements,
+                                size_t numThreads,
+                                const OpT& op,
+                                const std::string& name)
+{
+    if (numThreads == 0)
+    {
+        numThreads = getNumThreads();
+    }
+
+    if (numThreads <= 1 || numElements <= 1)
+    {
+        mt::Runnable1D<OpT>(0, numElements, op).run();
+        return;
+    }
+
+    TaskGroup tasks(*this, name);
+    const mt::ThreadPlanner planner(numElements, numThreads);
+
+    size_t threadNum(0);
+    size_t startElement(0);
+    size_t numElementsThisThread(0);
+    while (planner.getThreadInfo(threadNum++,
+                                 startElement,
+                                 numElementsThisThread))
+    {
+        tasks.createTask(new mt::Runnable1D<OpT>(
+                startElement, numElementsThisThread, op));
+    }
+    tasks.wait();
+}
+
+/*!
+ * Same as TaskScheduler::parallelFor() on the shared scheduler.  This is a
+ * drop-in replacement for mt::run1D() that reuses the pool's threads
+ * instead of creating new ones on every call.
+ */
+template <typename OpT>
+void parallelFor(size_t numElements,
+                 size_t numThreads,
+                 const OpT& op,
+                 const std::string& name = "")
+{
+    SharedTaskScheduler::getInstance().parallelFor(
+            numElements, numThreads, op, name);
+}
+}
+
+#endif
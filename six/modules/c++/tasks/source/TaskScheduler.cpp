@@ -0,0 +1,667 @@
+/* =========================================================================
+ * This file is part of tasks-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * tasks-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include <exception>
+#include <limits>
+#include <sstream>
+
+#include <mt/CriticalSection.h>
+#include <sys/Conf.h>
+#include <sys/OS.h>
+#include <sys/StopWatch.h>
+#include <sys/Thread.h>
+#include <tasks/TaskScheduler.h>
+
+namespace tasks
+{
+const size_t TaskScheduler::NOT_A_WORKER =
+        std::numeric_limits<size_t>::max();
+
+class TaskScheduler::WorkerRunnable : public sys::Runnable
+{
+public:
+    WorkerRunnable(TaskScheduler& scheduler, size_t workerNum) :
+        mScheduler(scheduler),
+        mWorkerNum(workerNum)
+    {
+    }
+
+    virtual void run()
+    {
+        mScheduler.runWorker(mWorkerNum);
+    }
+
+private:
+    TaskScheduler& mScheduler;
+    const size_t mWorkerNum;
+};
+
+TaskScheduler::TaskScheduler(size_t numThreads) :
+    mObserver(NULL),
+    mNumThreads(0),
+    mStateChanged(&mMutex),
+    mConfigChanged(&mMutex),
+    mNumQueued(0),
+    mNextWorker(0),
+    mNumClients(0),
+    mReconfiguring(false),
+    mShutdown(false)
+{
+    start(numThreads);
+}
+
+TaskScheduler::~TaskScheduler()
+{
+    try
+    {
+        stop();
+    }
+    catch (...)
+    {
+    }
+}
+
+size_t TaskScheduler::getNumThreads() const
+{
+    // mWorkers itself is resized by setNumThreads()
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    return mNumThreads;
+}
+
+void TaskScheduler::setNumThreads(size_t numThreads)
+{
+    if (getWorkerNum() != NOT_A_WORKER)
+    {
+        throw except::Exception(Ctxt(
+                "Can't change the number of threads from a task"));
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = sys::OS().getNumCPUs();
+    }
+
+    mt::CriticalSection<sys::Mutex> configLock(&mConfigMutex);
+    if (numThreads == mWorkers.size())
+    {
+        return;
+    }
+
+    // Wait for any thread that's submitting or waiting on tasks to get out
+    // of the way.  stop() lets the workers finish whatever's still queued.
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mReconfiguring = true;
+        while (mNumClients > 0)
+        {
+            mConfigChanged.wait();
+        }
+    }
+
+    try
+    {
+        stop();
+        start(numThreads);
+    }
+    catch (...)
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mReconfiguring = false;
+        mConfigChanged.broadcast();
+        throw;
+    }
+
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mReconfiguring = false;
+    mConfigChanged.broadcast();
+}
+
+void TaskScheduler::setObserver(TaskObserver* observer)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mObserver = observer;
+}
+
+size_t TaskScheduler::getWorkerNum() const
+{
+    mt::CriticalSection<sys::Mutex> lock(&mWorkerNumsMutex);
+    const std::map<long, size_t>::const_iterator iter =
+            mWorkerNums.find(sys::getThreadID());
+    return (iter == mWorkerNums.end()) ? NOT_A_WORKER : iter->second;
+}
+
+void TaskScheduler::start(size_t numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = sys::OS().getNumCPUs();
+    }
+
+    mShutdown = false;
+    mNumQueued = 0;
+    mNextWorker = 0;
+    mWorkers.resize(numThreads);
+    for (size_t ii = 0; ii < numThreads; ++ii)
+    {
+        mWorkers[ii].reset(new Worker());
+    }
+
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mNumThreads = numThreads;
+    }
+
+    mThreads.reset(new mt::ThreadGroup());
+    for (size_t ii = 0; ii < numThreads; ++ii)
+    {
+        mThreads->createThread(new WorkerRunnable(*this, ii));
+    }
+}
+
+void TaskScheduler::stop()
+{
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mShutdown = true;
+        mStateChanged.broadcast();
+    }
+
+    if (mThreads.get())
+    {
+        mThreads->joinAll();
+        mThreads.reset();
+    }
+
+    mt::CriticalSection<sys::Mutex> lock(&mWorkerNumsMutex);
+    mWorkerNums.clear();
+}
+
+void TaskScheduler::enter()
+{
+    // Only hold off new clients once everyone's out.  A thread that's
+    // already waiting on a group can end up back here by running a task
+    // that creates more tasks, and that has to be let through.
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    while (mReconfiguring && mNumClients == 0)
+    {
+        mConfigChanged.wait();
+    }
+    ++mNumClients;
+}
+
+void TaskScheduler::leave()
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    if (--mNumClients == 0 && mReconfiguring)
+    {
+        mConfigChanged.broadcast();
+    }
+}
+
+void TaskScheduler::registerWorker(size_t workerNum)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mWorkerNumsMutex);
+    mWorkerNums[sys::getThreadID()] = workerNum;
+}
+
+void TaskScheduler::submit(const Job& job)
+{
+    // Workers keep what they create.  Everyone else spreads their tasks out
+    // so the workers don't all have to steal from the same deque.
+    size_t workerNum = getWorkerNum();
+    if (workerNum == NOT_A_WORKER)
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        workerNum = mNextWorker;
+        mNextWorker = (mNextWorker + 1) % mWorkers.size();
+    }
+
+    Worker& worker(*mWorkers[workerNum]);
+    {
+        mt::CriticalSection<sys::Mutex> lock(&worker.mutex);
+        worker.jobs.push_back(job);
+    }
+
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    ++mNumQueued;
+    mStateChanged.signal();
+}
+
+bool TaskScheduler::findJob(size_t workerNum, Job& job)
+{
+    bool found = false;
+    const size_t numWorkers = mWorkers.size();
+    if (workerNum != NOT_A_WORKER)
+    {
+        Worker& worker(*mWorkers[workerNum]);
+        mt::CriticalSection<sys::Mutex> lock(&worker.mutex);
+        if (!worker.jobs.empty())
+        {
+            job = worker.jobs.back();
+            worker.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    const size_t firstVictim =
+            (workerNum == NOT_A_WORKER) ? 0 : workerNum + 1;
+    for (size_t ii = 0; ii < numWorkers && !found; ++ii)
+    {
+        const size_t victimNum = (firstVictim + ii) % numWorkers;
+        if (victimNum == workerNum)
+        {
+            continue;
+        }
+
+        Worker& victim(*mWorkers[victimNum]);
+        mt::CriticalSection<sys::Mutex> lock(&victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        --mNumQueued;
+        job.observer = mObserver;
+    }
+    return found;
+}
+
+void TaskScheduler::execute(const Job& job, size_t workerNum)
+{
+    TaskObserver* const observer = job.observer;
+    sys::RealTimeStopWatch stopWatch;
+    if (observer)
+    {
+        stopWatch.start();
+    }
+
+    try
+    {
+        job.task->run();
+    }
+    catch (const except::Exception& ex)
+    {
+        job.group->addException(ex);
+    }
+    catch (const std::exception& ex)
+    {
+        job.group->addException(except::Exception(Ctxt(ex.what())));
+    }
+    catch (...)
+    {
+        job.group->addException(except::Exception(Ctxt(
+                "Unknown exception running task")));
+    }
+
+    if (observer)
+    {
+        try
+        {
+            observer->taskFinished(job.name, workerNum, stopWatch.stop());
+        }
+        catch (const except::Exception& ex)
+        {
+            job.group->addException(ex);
+        }
+        catch (...)
+        {
+            job.group->addException(except::Exception(Ctxt(
+                    "Unknown exception in task observer")));
+        }
+    }
+
+    // The group may be destroyed as soon as its count hits 0, so this has
+    // to be the last thing we touch it for
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    if (--job.group->mNumRemaining == 0)
+    {
+        mStateChanged.broadcast();
+    }
+}
+
+void TaskScheduler::runWorker(size_t workerNum)
+{
+    registerWorker(workerNum);
+
+    while (true)
+    {
+        Job job;
+        if (findJob(workerNum, job))
+        {
+            execute(job, workerNum);
+            continue;
+        }
+
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        while (mNumQueued <= 0 && !mShutdown)
+        {
+            mStateChanged.wait();
+        }
+
+        if (mNumQueued <= 0 && mShutdown)
+        {
+            return;
+        }
+    }
+}
+
+void TaskScheduler::wait(TaskGroup& group)
+{
+    // Rather than blocking, help out until the group is done.  This is what
+    // makes nested parallelism safe: a task waiting on its own children
+    // keeps its worker busy instead of tying it up.
+    const size_t workerNum = getWorkerNum();
+    while (true)
+    {
+        {
+            mt::CriticalSection<sys::Mutex> lock(&mMutex);
+            if (group.mNumRemaining == 0)
+            {
+                return;
+            }
+        }
+
+        Job job;
+        if (findJob(workerNum, job))
+        {
+            execute(job, workerNum);
+            continue;
+        }
+
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        while (group.mNumRemaining > 0 && mNumQueued <= 0)
+        {
+            mStateChanged.wait();
+        }
+    }
+}
+
+TaskGroup::TaskGroup(const std::string& name) :
+    mScheduler(SharedTaskScheduler::getInstance()),
+    mName(name),
+    mNumRemaining(0)
+{
+}
+
+TaskGroup::TaskGroup(TaskScheduler& scheduler, const std::string& name) :
+    mScheduler(scheduler),
+    mName(name),
+    mNumRemaining(0)
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        wait();
+    }
+    catch (...)
+    {
+    }
+}
+
+void TaskGroup::createTask(sys::Runnable* task)
+{
+    createTask(std::auto_ptr<sys::Runnable>(task), mName);
+}
+
+void TaskGroup::createTask(std::auto_ptr<sys::Runnable> task)
+{
+    createTask(task, mName);
+}
+
+void TaskGroup::createTask(std::auto_ptr<sys::Runnable> task,
+                           const std::string& name)
+{
+    sys::Runnable* const runnable = task.get();
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mTasks.push_back(mem::SharedPtr<sys::Runnable>(task));
+    }
+
+    const bool isWorker =
+            (mScheduler.getWorkerNum() != TaskScheduler::NOT_A_WORKER);
+    if (!isWorker)
+    {
+        mScheduler.enter();
+    }
+
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mScheduler.mMutex);
+        ++mNumRemaining;
+    }
+    mScheduler.submit(TaskScheduler::Job(runnable, this, name));
+
+    if (!isWorker)
+    {
+        mScheduler.leave();
+    }
+}
+
+void TaskGroup::wait()
+{
+    const bool isWorker =
+            (mScheduler.getWorkerNum() != TaskScheduler::NOT_A_WORKER);
+    if (!isWorker)
+    {
+        mScheduler.enter();
+    }
+
+    try
+    {
+        mScheduler.wait(*this);
+    }
+    catch (...)
+    {
+        if (!isWorker)
+        {
+            mScheduler.leave();
+        }
+        throw;
+    }
+
+    if (!isWorker)
+    {
+        mScheduler.leave();
+    }
+
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mTasks.clear();
+    if (!mExceptions.empty())
+    {
+        const except::Exception ex(mExceptions.front());
+        mExceptions.clear();
+        throw ex;
+    }
+}
+
+void TaskGroup::addException(const except::Exception& ex)
+{
+    mt::CriticalSection<sys::Mutex> lock(&mMutex);
+    mExceptions.push_back(ex);
+}
+
+class TaskGraph::NodeRunnable : public sys::Runnable
+{
+public:
+    NodeRunnable(const TaskGraph& graph,
+                 size_t nodeNum,
+                 std::vector<size_t>& numPrerequisitesLeft,
+                 sys::Mutex& mutex,
+                 TaskGroup& group) :
+        mGraph(graph),
+        mNodeNum(nodeNum),
+        mNumPrerequisitesLeft(numPrerequisitesLeft),
+        mMutex(mutex),
+        mGroup(group)
+    {
+    }
+
+    virtual void run()
+    {
+        const Node& node(mGraph.mNodes[mNodeNum]);
+        node.task->run();
+
+        // Only reached if the task didn't throw, so dependents of a failed
+        // task never get submitted
+        for (size_t ii = 0; ii < node.dependents.size(); ++ii)
+        {
+            const size_t dependent = node.dependents[ii];
+            bool isReady;
+            {
+                mt::CriticalSection<sys::Mutex> lock(&mMutex);
+                isReady = (--mNumPrerequisitesLeft[dependent] == 0);
+            }
+
+            if (isReady)
+            {
+                submit(mGraph, dependent, mNumPrerequisitesLeft, mMutex,
+                       mGroup);
+            }
+        }
+    }
+
+    static void submit(const TaskGraph& graph,
+                       size_t nodeNum,
+                       std::vector<size_t>& numPrerequisitesLeft,
+                       sys::Mutex& mutex,
+                       TaskGroup& group)
+    {
+        const Node& node(graph.mNodes[nodeNum]);
+        std::auto_ptr<sys::Runnable> runnable(new NodeRunnable(
+                graph, nodeNum, numPrerequisitesLeft, mutex, group));
+        group.createTask(runnable,
+                         node.name.empty() ? graph.mName : node.name);
+    }
+
+private:
+    const TaskGraph& mGraph;
+    const size_t mNodeNum;
+    std::vector<size_t>& mNumPrerequisitesLeft;
+    sys::Mutex& mMutex;
+    TaskGroup& mGroup;
+};
+
+TaskGraph::TaskGraph(const std::string& name) :
+    mName(name)
+{
+}
+
+size_t TaskGraph::addTask(sys::Runnable* task, const std::string& name)
+{
+    return addTask(std::auto_ptr<sys::Runnable>(task), name);
+}
+
+size_t TaskGraph::addTask(std::auto_ptr<sys::Runnable> task,
+                          const std::string& name)
+{
+    mNodes.push_back(Node());
+    mNodes.back().task.reset(task.release());
+    mNodes.back().name = name;
+    return mNodes.size() - 1;
+}
+
+void TaskGraph::addDependency(size_t prerequisite, size_t dependent)
+{
+    if (prerequisite >= mNodes.size() || dependent >= mNodes.size())
+    {
+        std::ostringstream ostr;
+        ostr << "Invalid dependency " << prerequisite << " --> " << dependent
+             << " in a graph with " << mNodes.size() << " tasks";
+        throw except::Exception(Ctxt(ostr.str()));
+    }
+
+    mNodes[prerequisite].dependents.push_back(dependent);
+    ++mNodes[dependent].numPrerequisites;
+}
+
+void TaskGraph::checkForCycles() const
+{
+    // Kahn's algorithm: if we can't peel off every node in topological
+    // order, whatever's left is part of a cycle
+    std::vector<size_t> numPrerequisitesLeft(mNodes.size());
+    std::vector<size_t> ready;
+    for (size_t ii = 0; ii < mNodes.size(); ++ii)
+    {
+        numPrerequisitesLeft[ii] = mNodes[ii].numPrerequisites;
+        if (numPrerequisitesLeft[ii] == 0)
+        {
+            ready.push_back(ii);
+        }
+    }
+
+    size_t numVisited = 0;
+    while (!ready.empty())
+    {
+        const Node& node(mNodes[ready.back()]);
+        ready.pop_back();
+        ++numVisited;
+
+        for (size_t ii = 0; ii < node.dependents.size(); ++ii)
+        {
+            if (--numPrerequisitesLeft[node.dependents[ii]] == 0)
+            {
+                ready.push_back(node.dependents[ii]);
+            }
+        }
+    }
+
+    if (numVisited != mNodes.size())
+    {
+        throw except::Exception(Ctxt("Task graph has a cycle"));
+    }
+}
+
+void TaskGraph::run() const
+{
+    run(SharedTaskScheduler::getInstance());
+}
+
+void TaskGraph::run(TaskScheduler& scheduler) const
+{
+    checkForCycles();
+
+    std::vector<size_t> numPrerequisitesLeft(mNodes.size());
+    for (size_t ii = 0; ii < mNodes.size(); ++ii)
+    {
+        numPrerequisitesLeft[ii] = mNodes[ii].numPrerequisites;
+    }
+
+    sys::Mutex mutex;
+    TaskGroup group(scheduler, mName);
+    for (size_t ii = 0; ii < mNodes.size(); ++ii)
+    {
+        if (mNodes[ii].numPrerequisites == 0)
+        {
+            NodeRunnable::submit(*this, ii, numPrerequisitesLeft, mutex,
+                                 group);
+        }
+    }
+    group.wait();
+}
+}
@@ -0,0 +1,278 @@
+/* =========================================================================
+ * This file is part of tasks-c++
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * tasks-c++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; If not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mt/CriticalSection.h>
+#include <sys/Conf.h>
+#include <sys/Mutex.h>
+#include <tasks/TaskScheduler.h>
+#include "TestCase.h"
+
+namespace
+{
+class SquareOp
+{
+public:
+    SquareOp(std::vector<size_t>& output) :
+        mOutput(output)
+    {
+    }
+
+    void operator()(size_t ii) const
+    {
+        mOutput[ii] = ii * ii;
+    }
+
+private:
+    std::vector<size_t>& mOutput;
+};
+
+// Each element kicks off its own parallelFor, so every worker ends up
+// waiting on tasks while its own tasks are still queued
+class NestedOp
+{
+public:
+    NestedOp(tasks::TaskScheduler& scheduler,
+             std::vector<std::vector<size_t> >& output) :
+        mScheduler(scheduler),
+        mOutput(output)
+    {
+    }
+
+    void operator()(size_t ii) const
+    {
+        mScheduler.parallelFor(mOutput[ii].size(), 4, SquareOp(mOutput[ii]));
+    }
+
+private:
+    tasks::TaskScheduler& mScheduler;
+    std::vector<std::vector<size_t> >& mOutput;
+};
+
+class ThrowingOp
+{
+public:
+    void operator()(size_t ii) const
+    {
+        if (ii == 37)
+        {
+            throw except::Exception(Ctxt("Element 37"));
+        }
+    }
+};
+
+class AppendRunnable : public sys::Runnable
+{
+public:
+    AppendRunnable(size_t value,
+                   std::vector<size_t>& order,
+                   sys::Mutex& mutex) :
+        mValue(value),
+        mOrder(order),
+        mMutex(mutex)
+    {
+    }
+
+    virtual void run()
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        mOrder.push_back(mValue);
+    }
+
+private:
+    const size_t mValue;
+    std::vector<size_t>& mOrder;
+    sys::Mutex& mMutex;
+};
+
+class CountingObserver : public tasks::TaskObserver
+{
+public:
+    CountingObserver() :
+        mNumTasks(0)
+    {
+    }
+
+    virtual void taskFinished(const std::string& name,
+                              size_t ,
+                              double elapsedMS)
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        if (name == "squares" && elapsedMS >= 0.0)
+        {
+            ++mNumTasks;
+        }
+    }
+
+    size_t getNumTasks()
+    {
+        mt::CriticalSection<sys::Mutex> lock(&mMutex);
+        return mNumTasks;
+    }
+
+private:
+    sys::Mutex mMutex;
+    size_t mNumTasks;
+};
+
+size_t findIndex(const std::vector<size_t>& values, size_t value)
+{
+    for (size_t ii = 0; ii < values.size(); ++ii)
+    {
+        if (values[ii] == value)
+        {
+            return ii;
+        }
+    }
+    return values.size();
+}
+
+TEST_CASE(testParallelFor)
+{
+    tasks::TaskScheduler scheduler(4);
+    TEST_ASSERT_EQ(scheduler.getNumThreads(), static_cast<size_t>(4));
+
+    const size_t numThreads[] = {1, 3, 0, 16};
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        std::vector<size_t> output(1001, 0);
+        scheduler.parallelFor(output.size(), numThreads[ii],
+                              SquareOp(output));
+        for (size_t jj = 0; jj < output.size(); ++jj)
+        {
+            TEST_ASSERT_EQ(output[jj], jj * jj);
+        }
+    }
+}
+
+TEST_CASE(testNestedParallelFor)
+{
+    // With only 2 workers and 8 outer chunks, this would deadlock if
+    // waiting on the inner loops blocked the workers
+    tasks::TaskScheduler scheduler(2);
+    std::vector<std::vector<size_t> > output(64, std::vector<size_t>(100));
+    scheduler.parallelFor(output.size(), 8, NestedOp(scheduler, output));
+
+    for (size_t ii = 0; ii < output.size(); ++ii)
+    {
+        for (size_t jj = 0; jj < output[ii].size(); ++jj)
+        {
+            TEST_ASSERT_EQ(output[ii][jj], jj * jj);
+        }
+    }
+}
+
+TEST_CASE(testExceptions)
+{
+    tasks::TaskScheduler scheduler(3);
+    TEST_EXCEPTION(scheduler.parallelFor(100, 8, ThrowingOp()));
+
+    // The pool should still be usable afterwards
+    std::vector<size_t> output(50);
+    scheduler.parallelFor(output.size(), 8, SquareOp(output));
+    TEST_ASSERT_EQ(output[49], static_cast<size_t>(49 * 49));
+}
+
+TEST_CASE(testTaskGraph)
+{
+    tasks::TaskScheduler scheduler(4);
+    std::vector<size_t> order;
+    sys::Mutex mutex;
+
+    // Diamond: 0 --> {1, 2} --> 3
+    tasks::TaskGraph graph("diamond");
+    for (size_t ii = 0; ii < 4; ++ii)
+    {
+        graph.addTask(new AppendRunnable(ii, order, mutex));
+    }
+    graph.addDependency(0, 1);
+    graph.addDependency(0, 2);
+    graph.addDependency(1, 3);
+    graph.addDependency(2, 3);
+    TEST_ASSERT_EQ(graph.getNumTasks(), static_cast<size_t>(4));
+
+    for (size_t run = 0; run < 10; ++run)
+    {
+        order.clear();
+        graph.run(scheduler);
+        TEST_ASSERT_EQ(order.size(), static_cast<size_t>(4));
+        TEST_ASSERT_EQ(order.front(), static_cast<size_t>(0));
+        TEST_ASSERT_EQ(order.back(), static_cast<size_t>(3));
+        TEST_ASSERT_LESSER(findIndex(order, 1), static_cast<size_t>(3));
+        TEST_ASSERT_LESSER(findIndex(order, 2), static_cast<size_t>(3));
+    }
+
+    TEST_EXCEPTION(graph.addDependency(0, 4));
+    graph.addDependency(3, 0);
+    TEST_EXCEPTION(graph.run(scheduler));
+}
+
+TEST_CASE(testObserver)
+{
+    tasks::TaskScheduler scheduler(2);
+    CountingObserver observer;
+    scheduler.setObserver(&observer);
+
+    std::vector<size_t> output(100);
+    scheduler.parallelFor(output.size(), 5, SquareOp(output), "squares");
+    TEST_ASSERT_EQ(observer.getNumTasks(), static_cast<size_t>(5));
+
+    scheduler.setObserver(NULL);
+    scheduler.parallelFor(output.size(), 5, SquareOp(output), "squares");
+    TEST_ASSERT_EQ(observer.getNumTasks(), static_cast<size_t>(5));
+}
+
+TEST_CASE(testSetNumThreads)
+{
+    tasks::TaskScheduler scheduler(2);
+    scheduler.setNumThreads(5);
+    TEST_ASSERT_EQ(scheduler.getNumThreads(), static_cast<size_t>(5));
+
+    std::vector<size_t> output(200);
+    scheduler.parallelFor(output.size(), 0, SquareOp(output));
+    TEST_ASSERT_EQ(output[199], static_cast<size_t>(199 * 199));
+
+    scheduler.setNumThreads(1);
+    TEST_ASSERT_EQ(scheduler.getNumThreads(), static_cast<size_t>(1));
+    scheduler.parallelFor(output.size(), 4, SquareOp(output));
+    TEST_ASSERT_EQ(output[100], static_cast<size_t>(100 * 100));
+
+    // The shared instance is what everything else uses
+    std::vector<size_t> sharedOutput(10);
+    tasks::parallelFor(sharedOutput.size(), 3, SquareOp(sharedOutput));
+    TEST_ASSERT_EQ(sharedOutput[9], static_cast<size_t>(81));
+}
+}
+
+int main(int, char**)
+{
+    TEST_CHECK(testParallelFor);
+    TEST_CHECK(testNestedParallelFor);
+    TEST_CHECK(testExceptions);
+    TEST_CHECK(testTaskGraph);
+    TEST_CHECK(testObserver);
+    TEST_CHECK(testSetNumThreads);
+    return 0;
+}
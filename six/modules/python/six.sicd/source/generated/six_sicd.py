@@ -1937,8 +1937,10 @@ class ProjectionPolynomialFitter(_object):
 
     def __init__(self, *args):
         """
+        __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, size_t numPoints1D, size_t numThreads=0) -> ProjectionPolynomialFitter
         __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, size_t numPoints1D) -> ProjectionPolynomialFitter
         __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent) -> ProjectionPolynomialFitter
+        __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColSizeT fullExtent, RowColDouble outPixelStart, RowColSizeT outExtent, VectorRowColDouble polygon, size_t numPoints1D, size_t numThreads=0) -> ProjectionPolynomialFitter
         __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColSizeT fullExtent, RowColDouble outPixelStart, RowColSizeT outExtent, VectorRowColDouble polygon, size_t numPoints1D) -> ProjectionPolynomialFitter
         __init__(scene::ProjectionPolynomialFitter self, ProjectionModel projModel, GridECEFTransform gridTransform, RowColSizeT fullExtent, RowColDouble outPixelStart, RowColSizeT outExtent, VectorRowColDouble polygon) -> ProjectionPolynomialFitter
         """
@@ -1948,6 +1950,25 @@ class ProjectionPolynomialFitter(_object):
         except __builtin__.Exception:
             self.this = this
 
+    def createAdaptive(*args):
+        """
+        createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D, size_t numThreads=0, double * achievedResidualError=None) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+        createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D, size_t numThreads=0) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+        createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+        createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+        createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+        """
+        return _six_sicd.ProjectionPolynomialFitter_createAdaptive(*args)
+
+    createAdaptive = staticmethod(createAdaptive)
+    __swig_destroy__ = _six_sicd.delete_ProjectionPolynomialFitter
+    __del__ = lambda self: None
+
+    def getNumPoints1D(self):
+        """getNumPoints1D(ProjectionPolynomialFitter self) -> size_t"""
+        return _six_sicd.ProjectionPolynomialFitter_getNumPoints1D(self)
+
+
     def getOutputPlaneRows(self):
         """getOutputPlaneRows(ProjectionPolynomialFitter self) -> MatrixDouble"""
         return _six_sicd.ProjectionPolynomialFitter_getOutputPlaneRows(self)
@@ -2024,12 +2045,20 @@ class ProjectionPolynomialFitter(_object):
             polyOrderX, polyOrderY, toSlantRow, toSlantCol)
         return (toSlantRow, toSlantCol)
 
-
-    __swig_destroy__ = _six_sicd.delete_ProjectionPolynomialFitter
-    __del__ = lambda self: None
 ProjectionPolynomialFitter_swigregister = _six_sicd.ProjectionPolynomialFitter_swigregister
 ProjectionPolynomialFitter_swigregister(ProjectionPolynomialFitter)
 ProjectionPolynomialFitter.DEFAULTS_POINTS_1D = _six_sicd.cvar.ProjectionPolynomialFitter_DEFAULTS_POINTS_1D
+ProjectionPolynomialFitter.DEFAULT_MAX_POINTS_1D = _six_sicd.cvar.ProjectionPolynomialFitter_DEFAULT_MAX_POINTS_1D
+
+def ProjectionPolynomialFitter_createAdaptive(*args):
+    """
+    createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D, size_t numThreads=0, double * achievedResidualError=None) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+    createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D, size_t numThreads=0) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+    createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D, size_t maxNumPoints1D) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+    createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError, size_t numPoints1D) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+    ProjectionPolynomialFitter_createAdaptive(ProjectionModel projModel, GridECEFTransform gridTransform, RowColDouble outPixelStart, RowColSizeT outExtent, RowColDouble slantSampleSpacing, size_t polyOrderX, size_t polyOrderY, double maxResidualError) -> std::auto_ptr< scene::ProjectionPolynomialFitter >
+    """
+    return _six_sicd.ProjectionPolynomialFitter_createAdaptive(*args)
 
 class ComplexClassification(pysix.six_base.Classification):
     """Proxy of C++ six::sicd::ComplexClassification class."""
@@ -4764,6 +4793,11 @@ class ComplexData(pysix.six_base.Data):
         return _six_sicd.ComplexData_clone(self)
 
 
+    def markShareable(self):
+        """markShareable(ComplexData self)"""
+        return _six_sicd.ComplexData_markShareable(self)
+
+
     def getPixelType(self):
         """getPixelType(ComplexData self) -> PixelType"""
         return _six_sicd.ComplexData_getPixelType(self)
@@ -4976,6 +5010,17 @@ class SixSicdUtilities(_object):
 
     getPolynomialFitter = staticmethod(getPolynomialFitter)
 
+    def getRPCFitter(*args):
+        """
+        getRPCFitter(ComplexData complexData, double heightRange=1000.0, size_t numPoints1D, size_t numHeights) -> std::auto_ptr< scene::RPCFitter >
+        getRPCFitter(ComplexData complexData, double heightRange=1000.0, size_t numPoints1D) -> std::auto_ptr< scene::RPCFitter >
+        getRPCFitter(ComplexData complexData, double heightRange=1000.0) -> std::auto_ptr< scene::RPCFitter >
+        getRPCFitter(ComplexData complexData) -> std::auto_ptr< scene::RPCFitter >
+        """
+        return _six_sicd.SixSicdUtilities_getRPCFitter(*args)
+
+    getRPCFitter = staticmethod(getRPCFitter)
+
     def getValidDataPolygon(sicdData, projection, validData):
         """getValidDataPolygon(ComplexData sicdData, ProjectionModel projection, VectorRowColDouble validData)"""
         return _six_sicd.SixSicdUtilities_getValidDataPolygon(sicdData, projection, validData)
@@ -5148,6 +5193,15 @@ def SixSicdUtilities_getPolynomialFitter(*args):
     """
     return _six_sicd.SixSicdUtilities_getPolynomialFitter(*args)
 
+def SixSicdUtilities_getRPCFitter(*args):
+    """
+    getRPCFitter(ComplexData complexData, double heightRange=1000.0, size_t numPoints1D, size_t numHeights) -> std::auto_ptr< scene::RPCFitter >
+    getRPCFitter(ComplexData complexData, double heightRange=1000.0, size_t numPoints1D) -> std::auto_ptr< scene::RPCFitter >
+    getRPCFitter(ComplexData complexData, double heightRange=1000.0) -> std::auto_ptr< scene::RPCFitter >
+    SixSicdUtilities_getRPCFitter(ComplexData complexData) -> std::auto_ptr< scene::RPCFitter >
+    """
+    return _six_sicd.SixSicdUtilities_getRPCFitter(*args)
+
 def SixSicdUtilities_getValidDataPolygon(sicdData, projection, validData):
     """SixSicdUtilities_getValidDataPolygon(ComplexData sicdData, ProjectionModel projection, VectorRowColDouble validData)"""
     return _six_sicd.SixSicdUtilities_getValidDataPolygon(sicdData, projection, validData)
@@ -5366,108 +5420,129 @@ class StdAutoCollectionInformation(_object):
 StdAutoCollectionInformation_swigregister = _six_sicd.StdAutoCollectionInformation_swigregister
 StdAutoCollectionInformation_swigregister(StdAutoCollectionInformation)
 
-class ScopedCloneableCollectionInformation(_object):
-    """Proxy of C++ mem::ScopedCloneablePtr<(six::sicd::CollectionInformation)> class."""
+class CopyOnWriteCollectionInformation(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::CollectionInformation)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCloneableCollectionInformation, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteCollectionInformation, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCloneableCollectionInformation, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteCollectionInformation, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCloneablePtr<(six::sicd::CollectionInformation)> self, CollectionInformation ptr=None) -> ScopedCloneableCollectionInformation
-        __init__(mem::ScopedCloneablePtr<(six::sicd::CollectionInformation)> self) -> ScopedCloneableCollectionInformation
-        __init__(mem::ScopedCloneablePtr<(six::sicd::CollectionInformation)> self, ScopedCloneableCollectionInformation rhs) -> ScopedCloneableCollectionInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::CollectionInformation)> self, CollectionInformation ptr=None) -> CopyOnWriteCollectionInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::CollectionInformation)> self) -> CopyOnWriteCollectionInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::CollectionInformation)> self, CopyOnWriteCollectionInformation rhs) -> CopyOnWriteCollectionInformation
         """
-        this = _six_sicd.new_ScopedCloneableCollectionInformation(*args)
+        this = _six_sicd.new_CopyOnWriteCollectionInformation(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
+    def __nonzero__(self):
+        return _six_sicd.CopyOnWriteCollectionInformation___nonzero__(self)
+    __bool__ = __nonzero__
+
+
+
     def get(self):
-        """get(ScopedCloneableCollectionInformation self) -> CollectionInformation"""
-        return _six_sicd.ScopedCloneableCollectionInformation_get(self)
+        """get(CopyOnWriteCollectionInformation self) -> CollectionInformation"""
+        return _six_sicd.CopyOnWriteCollectionInformation_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCloneableCollectionInformation self) -> CollectionInformation"""
-        return _six_sicd.ScopedCloneableCollectionInformation___ref__(self)
+        """__ref__(CopyOnWriteCollectionInformation self) -> CollectionInformation"""
+        return _six_sicd.CopyOnWriteCollectionInformation___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCloneableCollectionInformation self) -> CollectionInformation"""
-        return _six_sicd.ScopedCloneableCollectionInformation___deref__(self)
+        """__deref__(CopyOnWriteCollectionInformation self) -> CollectionInformation"""
+        return _six_sicd.CopyOnWriteCollectionInformation___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCloneableCollectionInformation self, CollectionInformation ptr=None)
-        reset(ScopedCloneableCollectionInformation self)
+        reset(CopyOnWriteCollectionInformation self, CollectionInformation ptr=None)
+        reset(CopyOnWriteCollectionInformation self)
         """
-        return _six_sicd.ScopedCloneableCollectionInformation_reset(self, ptr)
+        return _six_sicd.CopyOnWriteCollectionInformation_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteCollectionInformation self) -> bool"""
+        return _six_sicd.CopyOnWriteCollectionInformation_isShared(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCloneableCollectionInformation
+    def isShareable(self):
+        """isShareable(CopyOnWriteCollectionInformation self) -> bool"""
+        return _six_sicd.CopyOnWriteCollectionInformation_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteCollectionInformation self)"""
+        return _six_sicd.CopyOnWriteCollectionInformation_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteCollectionInformation
     __del__ = lambda self: None
-    __swig_setmethods__["collectorName"] = _six_sicd.ScopedCloneableCollectionInformation_collectorName_set
-    __swig_getmethods__["collectorName"] = _six_sicd.ScopedCloneableCollectionInformation_collectorName_get
+    __swig_setmethods__["collectorName"] = _six_sicd.CopyOnWriteCollectionInformation_collectorName_set
+    __swig_getmethods__["collectorName"] = _six_sicd.CopyOnWriteCollectionInformation_collectorName_get
     if _newclass:
-        collectorName = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_collectorName_get, _six_sicd.ScopedCloneableCollectionInformation_collectorName_set)
-    __swig_setmethods__["illuminatorName"] = _six_sicd.ScopedCloneableCollectionInformation_illuminatorName_set
-    __swig_getmethods__["illuminatorName"] = _six_sicd.ScopedCloneableCollectionInformation_illuminatorName_get
+        collectorName = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_collectorName_get, _six_sicd.CopyOnWriteCollectionInformation_collectorName_set)
+    __swig_setmethods__["illuminatorName"] = _six_sicd.CopyOnWriteCollectionInformation_illuminatorName_set
+    __swig_getmethods__["illuminatorName"] = _six_sicd.CopyOnWriteCollectionInformation_illuminatorName_get
     if _newclass:
-        illuminatorName = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_illuminatorName_get, _six_sicd.ScopedCloneableCollectionInformation_illuminatorName_set)
-    __swig_setmethods__["coreName"] = _six_sicd.ScopedCloneableCollectionInformation_coreName_set
-    __swig_getmethods__["coreName"] = _six_sicd.ScopedCloneableCollectionInformation_coreName_get
+        illuminatorName = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_illuminatorName_get, _six_sicd.CopyOnWriteCollectionInformation_illuminatorName_set)
+    __swig_setmethods__["coreName"] = _six_sicd.CopyOnWriteCollectionInformation_coreName_set
+    __swig_getmethods__["coreName"] = _six_sicd.CopyOnWriteCollectionInformation_coreName_get
     if _newclass:
-        coreName = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_coreName_get, _six_sicd.ScopedCloneableCollectionInformation_coreName_set)
-    __swig_setmethods__["collectType"] = _six_sicd.ScopedCloneableCollectionInformation_collectType_set
-    __swig_getmethods__["collectType"] = _six_sicd.ScopedCloneableCollectionInformation_collectType_get
+        coreName = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_coreName_get, _six_sicd.CopyOnWriteCollectionInformation_coreName_set)
+    __swig_setmethods__["collectType"] = _six_sicd.CopyOnWriteCollectionInformation_collectType_set
+    __swig_getmethods__["collectType"] = _six_sicd.CopyOnWriteCollectionInformation_collectType_get
     if _newclass:
-        collectType = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_collectType_get, _six_sicd.ScopedCloneableCollectionInformation_collectType_set)
-    __swig_setmethods__["radarMode"] = _six_sicd.ScopedCloneableCollectionInformation_radarMode_set
-    __swig_getmethods__["radarMode"] = _six_sicd.ScopedCloneableCollectionInformation_radarMode_get
+        collectType = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_collectType_get, _six_sicd.CopyOnWriteCollectionInformation_collectType_set)
+    __swig_setmethods__["radarMode"] = _six_sicd.CopyOnWriteCollectionInformation_radarMode_set
+    __swig_getmethods__["radarMode"] = _six_sicd.CopyOnWriteCollectionInformation_radarMode_get
     if _newclass:
-        radarMode = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_radarMode_get, _six_sicd.ScopedCloneableCollectionInformation_radarMode_set)
-    __swig_setmethods__["radarModeID"] = _six_sicd.ScopedCloneableCollectionInformation_radarModeID_set
-    __swig_getmethods__["radarModeID"] = _six_sicd.ScopedCloneableCollectionInformation_radarModeID_get
+        radarMode = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_radarMode_get, _six_sicd.CopyOnWriteCollectionInformation_radarMode_set)
+    __swig_setmethods__["radarModeID"] = _six_sicd.CopyOnWriteCollectionInformation_radarModeID_set
+    __swig_getmethods__["radarModeID"] = _six_sicd.CopyOnWriteCollectionInformation_radarModeID_get
     if _newclass:
-        radarModeID = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_radarModeID_get, _six_sicd.ScopedCloneableCollectionInformation_radarModeID_set)
-    __swig_setmethods__["classification"] = _six_sicd.ScopedCloneableCollectionInformation_classification_set
-    __swig_getmethods__["classification"] = _six_sicd.ScopedCloneableCollectionInformation_classification_get
+        radarModeID = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_radarModeID_get, _six_sicd.CopyOnWriteCollectionInformation_radarModeID_set)
+    __swig_setmethods__["classification"] = _six_sicd.CopyOnWriteCollectionInformation_classification_set
+    __swig_getmethods__["classification"] = _six_sicd.CopyOnWriteCollectionInformation_classification_get
     if _newclass:
-        classification = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_classification_get, _six_sicd.ScopedCloneableCollectionInformation_classification_set)
-    __swig_setmethods__["countryCodes"] = _six_sicd.ScopedCloneableCollectionInformation_countryCodes_set
-    __swig_getmethods__["countryCodes"] = _six_sicd.ScopedCloneableCollectionInformation_countryCodes_get
+        classification = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_classification_get, _six_sicd.CopyOnWriteCollectionInformation_classification_set)
+    __swig_setmethods__["countryCodes"] = _six_sicd.CopyOnWriteCollectionInformation_countryCodes_set
+    __swig_getmethods__["countryCodes"] = _six_sicd.CopyOnWriteCollectionInformation_countryCodes_get
     if _newclass:
-        countryCodes = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_countryCodes_get, _six_sicd.ScopedCloneableCollectionInformation_countryCodes_set)
-    __swig_setmethods__["parameters"] = _six_sicd.ScopedCloneableCollectionInformation_parameters_set
-    __swig_getmethods__["parameters"] = _six_sicd.ScopedCloneableCollectionInformation_parameters_get
+        countryCodes = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_countryCodes_get, _six_sicd.CopyOnWriteCollectionInformation_countryCodes_set)
+    __swig_setmethods__["parameters"] = _six_sicd.CopyOnWriteCollectionInformation_parameters_set
+    __swig_getmethods__["parameters"] = _six_sicd.CopyOnWriteCollectionInformation_parameters_get
     if _newclass:
-        parameters = _swig_property(_six_sicd.ScopedCloneableCollectionInformation_parameters_get, _six_sicd.ScopedCloneableCollectionInformation_parameters_set)
+        parameters = _swig_property(_six_sicd.CopyOnWriteCollectionInformation_parameters_get, _six_sicd.CopyOnWriteCollectionInformation_parameters_set)
 
     def clone(self):
-        """clone(ScopedCloneableCollectionInformation self) -> CollectionInformation"""
-        return _six_sicd.ScopedCloneableCollectionInformation_clone(self)
+        """clone(CopyOnWriteCollectionInformation self) -> CollectionInformation"""
+        return _six_sicd.CopyOnWriteCollectionInformation_clone(self)
 
 
     def __eq__(self, other):
-        """__eq__(ScopedCloneableCollectionInformation self, CollectionInformation other) -> bool"""
-        return _six_sicd.ScopedCloneableCollectionInformation___eq__(self, other)
+        """__eq__(CopyOnWriteCollectionInformation self, CollectionInformation other) -> bool"""
+        return _six_sicd.CopyOnWriteCollectionInformation___eq__(self, other)
 
 
     def __ne__(self, other):
-        """__ne__(ScopedCloneableCollectionInformation self, CollectionInformation other) -> bool"""
-        return _six_sicd.ScopedCloneableCollectionInformation___ne__(self, other)
+        """__ne__(CopyOnWriteCollectionInformation self, CollectionInformation other) -> bool"""
+        return _six_sicd.CopyOnWriteCollectionInformation___ne__(self, other)
 
-ScopedCloneableCollectionInformation_swigregister = _six_sicd.ScopedCloneableCollectionInformation_swigregister
-ScopedCloneableCollectionInformation_swigregister(ScopedCloneableCollectionInformation)
+CopyOnWriteCollectionInformation_swigregister = _six_sicd.CopyOnWriteCollectionInformation_swigregister
+CopyOnWriteCollectionInformation_swigregister(CopyOnWriteCollectionInformation)
 
 
 def makeScopedCloneableCollectionInformation():
-    """makeScopedCloneableCollectionInformation() -> ScopedCloneableCollectionInformation"""
+    """makeScopedCloneableCollectionInformation() -> CopyOnWriteCollectionInformation"""
     return _six_sicd.makeScopedCloneableCollectionInformation()
 class StdAutoImageCreation(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::ImageCreation)> class."""
@@ -5490,88 +5565,109 @@ class StdAutoImageCreation(_object):
 StdAutoImageCreation_swigregister = _six_sicd.StdAutoImageCreation_swigregister
 StdAutoImageCreation_swigregister(StdAutoImageCreation)
 
-class ScopedCloneableImageCreation(_object):
-    """Proxy of C++ mem::ScopedCloneablePtr<(six::sicd::ImageCreation)> class."""
+class CopyOnWriteImageCreation(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::ImageCreation)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCloneableImageCreation, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteImageCreation, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCloneableImageCreation, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteImageCreation, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCloneablePtr<(six::sicd::ImageCreation)> self, ImageCreation ptr=None) -> ScopedCloneableImageCreation
-        __init__(mem::ScopedCloneablePtr<(six::sicd::ImageCreation)> self) -> ScopedCloneableImageCreation
-        __init__(mem::ScopedCloneablePtr<(six::sicd::ImageCreation)> self, ScopedCloneableImageCreation rhs) -> ScopedCloneableImageCreation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageCreation)> self, ImageCreation ptr=None) -> CopyOnWriteImageCreation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageCreation)> self) -> CopyOnWriteImageCreation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageCreation)> self, CopyOnWriteImageCreation rhs) -> CopyOnWriteImageCreation
         """
-        this = _six_sicd.new_ScopedCloneableImageCreation(*args)
+        this = _six_sicd.new_CopyOnWriteImageCreation(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
+    def __nonzero__(self):
+        return _six_sicd.CopyOnWriteImageCreation___nonzero__(self)
+    __bool__ = __nonzero__
+
+
+
     def get(self):
-        """get(ScopedCloneableImageCreation self) -> ImageCreation"""
-        return _six_sicd.ScopedCloneableImageCreation_get(self)
+        """get(CopyOnWriteImageCreation self) -> ImageCreation"""
+        return _six_sicd.CopyOnWriteImageCreation_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCloneableImageCreation self) -> ImageCreation"""
-        return _six_sicd.ScopedCloneableImageCreation___ref__(self)
+        """__ref__(CopyOnWriteImageCreation self) -> ImageCreation"""
+        return _six_sicd.CopyOnWriteImageCreation___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCloneableImageCreation self) -> ImageCreation"""
-        return _six_sicd.ScopedCloneableImageCreation___deref__(self)
+        """__deref__(CopyOnWriteImageCreation self) -> ImageCreation"""
+        return _six_sicd.CopyOnWriteImageCreation___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCloneableImageCreation self, ImageCreation ptr=None)
-        reset(ScopedCloneableImageCreation self)
+        reset(CopyOnWriteImageCreation self, ImageCreation ptr=None)
+        reset(CopyOnWriteImageCreation self)
         """
-        return _six_sicd.ScopedCloneableImageCreation_reset(self, ptr)
+        return _six_sicd.CopyOnWriteImageCreation_reset(self, ptr)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCloneableImageCreation
+
+    def isShared(self):
+        """isShared(CopyOnWriteImageCreation self) -> bool"""
+        return _six_sicd.CopyOnWriteImageCreation_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteImageCreation self) -> bool"""
+        return _six_sicd.CopyOnWriteImageCreation_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteImageCreation self)"""
+        return _six_sicd.CopyOnWriteImageCreation_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteImageCreation
     __del__ = lambda self: None
-    __swig_setmethods__["application"] = _six_sicd.ScopedCloneableImageCreation_application_set
-    __swig_getmethods__["application"] = _six_sicd.ScopedCloneableImageCreation_application_get
+    __swig_setmethods__["application"] = _six_sicd.CopyOnWriteImageCreation_application_set
+    __swig_getmethods__["application"] = _six_sicd.CopyOnWriteImageCreation_application_get
     if _newclass:
-        application = _swig_property(_six_sicd.ScopedCloneableImageCreation_application_get, _six_sicd.ScopedCloneableImageCreation_application_set)
-    __swig_setmethods__["dateTime"] = _six_sicd.ScopedCloneableImageCreation_dateTime_set
-    __swig_getmethods__["dateTime"] = _six_sicd.ScopedCloneableImageCreation_dateTime_get
+        application = _swig_property(_six_sicd.CopyOnWriteImageCreation_application_get, _six_sicd.CopyOnWriteImageCreation_application_set)
+    __swig_setmethods__["dateTime"] = _six_sicd.CopyOnWriteImageCreation_dateTime_set
+    __swig_getmethods__["dateTime"] = _six_sicd.CopyOnWriteImageCreation_dateTime_get
     if _newclass:
-        dateTime = _swig_property(_six_sicd.ScopedCloneableImageCreation_dateTime_get, _six_sicd.ScopedCloneableImageCreation_dateTime_set)
-    __swig_setmethods__["site"] = _six_sicd.ScopedCloneableImageCreation_site_set
-    __swig_getmethods__["site"] = _six_sicd.ScopedCloneableImageCreation_site_get
+        dateTime = _swig_property(_six_sicd.CopyOnWriteImageCreation_dateTime_get, _six_sicd.CopyOnWriteImageCreation_dateTime_set)
+    __swig_setmethods__["site"] = _six_sicd.CopyOnWriteImageCreation_site_set
+    __swig_getmethods__["site"] = _six_sicd.CopyOnWriteImageCreation_site_get
     if _newclass:
-        site = _swig_property(_six_sicd.ScopedCloneableImageCreation_site_get, _six_sicd.ScopedCloneableImageCreation_site_set)
-    __swig_setmethods__["profile"] = _six_sicd.ScopedCloneableImageCreation_profile_set
-    __swig_getmethods__["profile"] = _six_sicd.ScopedCloneableImageCreation_profile_get
+        site = _swig_property(_six_sicd.CopyOnWriteImageCreation_site_get, _six_sicd.CopyOnWriteImageCreation_site_set)
+    __swig_setmethods__["profile"] = _six_sicd.CopyOnWriteImageCreation_profile_set
+    __swig_getmethods__["profile"] = _six_sicd.CopyOnWriteImageCreation_profile_get
     if _newclass:
-        profile = _swig_property(_six_sicd.ScopedCloneableImageCreation_profile_get, _six_sicd.ScopedCloneableImageCreation_profile_set)
+        profile = _swig_property(_six_sicd.CopyOnWriteImageCreation_profile_get, _six_sicd.CopyOnWriteImageCreation_profile_set)
 
     def clone(self):
-        """clone(ScopedCloneableImageCreation self) -> ImageCreation"""
-        return _six_sicd.ScopedCloneableImageCreation_clone(self)
+        """clone(CopyOnWriteImageCreation self) -> ImageCreation"""
+        return _six_sicd.CopyOnWriteImageCreation_clone(self)
 
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCloneableImageCreation self, ImageCreation rhs) -> bool"""
-        return _six_sicd.ScopedCloneableImageCreation___eq__(self, rhs)
+        """__eq__(CopyOnWriteImageCreation self, ImageCreation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteImageCreation___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCloneableImageCreation self, ImageCreation rhs) -> bool"""
-        return _six_sicd.ScopedCloneableImageCreation___ne__(self, rhs)
+        """__ne__(CopyOnWriteImageCreation self, ImageCreation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteImageCreation___ne__(self, rhs)
 
-ScopedCloneableImageCreation_swigregister = _six_sicd.ScopedCloneableImageCreation_swigregister
-ScopedCloneableImageCreation_swigregister(ScopedCloneableImageCreation)
+CopyOnWriteImageCreation_swigregister = _six_sicd.CopyOnWriteImageCreation_swigregister
+CopyOnWriteImageCreation_swigregister(CopyOnWriteImageCreation)
 
 
 def makeScopedCloneableImageCreation():
-    """makeScopedCloneableImageCreation() -> ScopedCloneableImageCreation"""
+    """makeScopedCloneableImageCreation() -> CopyOnWriteImageCreation"""
     return _six_sicd.makeScopedCloneableImageCreation()
 class StdAutoImageData(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::ImageData)> class."""
@@ -5842,119 +5938,140 @@ class StdAutoGrid(_object):
 StdAutoGrid_swigregister = _six_sicd.StdAutoGrid_swigregister
 StdAutoGrid_swigregister(StdAutoGrid)
 
-class ScopedCloneableGrid(_object):
-    """Proxy of C++ mem::ScopedCloneablePtr<(six::sicd::Grid)> class."""
+class CopyOnWriteGrid(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::Grid)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCloneableGrid, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteGrid, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCloneableGrid, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteGrid, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCloneablePtr<(six::sicd::Grid)> self, Grid ptr=None) -> ScopedCloneableGrid
-        __init__(mem::ScopedCloneablePtr<(six::sicd::Grid)> self) -> ScopedCloneableGrid
-        __init__(mem::ScopedCloneablePtr<(six::sicd::Grid)> self, ScopedCloneableGrid rhs) -> ScopedCloneableGrid
+        __init__(six::CopyOnWritePtr<(six::sicd::Grid)> self, Grid ptr=None) -> CopyOnWriteGrid
+        __init__(six::CopyOnWritePtr<(six::sicd::Grid)> self) -> CopyOnWriteGrid
+        __init__(six::CopyOnWritePtr<(six::sicd::Grid)> self, CopyOnWriteGrid rhs) -> CopyOnWriteGrid
         """
-        this = _six_sicd.new_ScopedCloneableGrid(*args)
+        this = _six_sicd.new_CopyOnWriteGrid(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
+    def __nonzero__(self):
+        return _six_sicd.CopyOnWriteGrid___nonzero__(self)
+    __bool__ = __nonzero__
+
+
+
     def get(self):
-        """get(ScopedCloneableGrid self) -> Grid"""
-        return _six_sicd.ScopedCloneableGrid_get(self)
+        """get(CopyOnWriteGrid self) -> Grid"""
+        return _six_sicd.CopyOnWriteGrid_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCloneableGrid self) -> Grid"""
-        return _six_sicd.ScopedCloneableGrid___ref__(self)
+        """__ref__(CopyOnWriteGrid self) -> Grid"""
+        return _six_sicd.CopyOnWriteGrid___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCloneableGrid self) -> Grid"""
-        return _six_sicd.ScopedCloneableGrid___deref__(self)
+        """__deref__(CopyOnWriteGrid self) -> Grid"""
+        return _six_sicd.CopyOnWriteGrid___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCloneableGrid self, Grid ptr=None)
-        reset(ScopedCloneableGrid self)
+        reset(CopyOnWriteGrid self, Grid ptr=None)
+        reset(CopyOnWriteGrid self)
         """
-        return _six_sicd.ScopedCloneableGrid_reset(self, ptr)
+        return _six_sicd.CopyOnWriteGrid_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteGrid self) -> bool"""
+        return _six_sicd.CopyOnWriteGrid_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteGrid self) -> bool"""
+        return _six_sicd.CopyOnWriteGrid_isShareable(self)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCloneableGrid
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteGrid self)"""
+        return _six_sicd.CopyOnWriteGrid_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteGrid
     __del__ = lambda self: None
 
     def clone(self):
-        """clone(ScopedCloneableGrid self) -> Grid"""
-        return _six_sicd.ScopedCloneableGrid_clone(self)
+        """clone(CopyOnWriteGrid self) -> Grid"""
+        return _six_sicd.CopyOnWriteGrid_clone(self)
 
-    __swig_setmethods__["imagePlane"] = _six_sicd.ScopedCloneableGrid_imagePlane_set
-    __swig_getmethods__["imagePlane"] = _six_sicd.ScopedCloneableGrid_imagePlane_get
+    __swig_setmethods__["imagePlane"] = _six_sicd.CopyOnWriteGrid_imagePlane_set
+    __swig_getmethods__["imagePlane"] = _six_sicd.CopyOnWriteGrid_imagePlane_get
     if _newclass:
-        imagePlane = _swig_property(_six_sicd.ScopedCloneableGrid_imagePlane_get, _six_sicd.ScopedCloneableGrid_imagePlane_set)
-    __swig_setmethods__["type"] = _six_sicd.ScopedCloneableGrid_type_set
-    __swig_getmethods__["type"] = _six_sicd.ScopedCloneableGrid_type_get
+        imagePlane = _swig_property(_six_sicd.CopyOnWriteGrid_imagePlane_get, _six_sicd.CopyOnWriteGrid_imagePlane_set)
+    __swig_setmethods__["type"] = _six_sicd.CopyOnWriteGrid_type_set
+    __swig_getmethods__["type"] = _six_sicd.CopyOnWriteGrid_type_get
     if _newclass:
-        type = _swig_property(_six_sicd.ScopedCloneableGrid_type_get, _six_sicd.ScopedCloneableGrid_type_set)
-    __swig_setmethods__["timeCOAPoly"] = _six_sicd.ScopedCloneableGrid_timeCOAPoly_set
-    __swig_getmethods__["timeCOAPoly"] = _six_sicd.ScopedCloneableGrid_timeCOAPoly_get
+        type = _swig_property(_six_sicd.CopyOnWriteGrid_type_get, _six_sicd.CopyOnWriteGrid_type_set)
+    __swig_setmethods__["timeCOAPoly"] = _six_sicd.CopyOnWriteGrid_timeCOAPoly_set
+    __swig_getmethods__["timeCOAPoly"] = _six_sicd.CopyOnWriteGrid_timeCOAPoly_get
     if _newclass:
-        timeCOAPoly = _swig_property(_six_sicd.ScopedCloneableGrid_timeCOAPoly_get, _six_sicd.ScopedCloneableGrid_timeCOAPoly_set)
-    __swig_setmethods__["row"] = _six_sicd.ScopedCloneableGrid_row_set
-    __swig_getmethods__["row"] = _six_sicd.ScopedCloneableGrid_row_get
+        timeCOAPoly = _swig_property(_six_sicd.CopyOnWriteGrid_timeCOAPoly_get, _six_sicd.CopyOnWriteGrid_timeCOAPoly_set)
+    __swig_setmethods__["row"] = _six_sicd.CopyOnWriteGrid_row_set
+    __swig_getmethods__["row"] = _six_sicd.CopyOnWriteGrid_row_get
     if _newclass:
-        row = _swig_property(_six_sicd.ScopedCloneableGrid_row_get, _six_sicd.ScopedCloneableGrid_row_set)
-    __swig_setmethods__["col"] = _six_sicd.ScopedCloneableGrid_col_set
-    __swig_getmethods__["col"] = _six_sicd.ScopedCloneableGrid_col_get
+        row = _swig_property(_six_sicd.CopyOnWriteGrid_row_get, _six_sicd.CopyOnWriteGrid_row_set)
+    __swig_setmethods__["col"] = _six_sicd.CopyOnWriteGrid_col_set
+    __swig_getmethods__["col"] = _six_sicd.CopyOnWriteGrid_col_get
     if _newclass:
-        col = _swig_property(_six_sicd.ScopedCloneableGrid_col_get, _six_sicd.ScopedCloneableGrid_col_set)
+        col = _swig_property(_six_sicd.CopyOnWriteGrid_col_get, _six_sicd.CopyOnWriteGrid_col_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCloneableGrid self, Grid rhs) -> bool"""
-        return _six_sicd.ScopedCloneableGrid___eq__(self, rhs)
+        """__eq__(CopyOnWriteGrid self, Grid rhs) -> bool"""
+        return _six_sicd.CopyOnWriteGrid___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCloneableGrid self, Grid rhs) -> bool"""
-        return _six_sicd.ScopedCloneableGrid___ne__(self, rhs)
+        """__ne__(CopyOnWriteGrid self, Grid rhs) -> bool"""
+        return _six_sicd.CopyOnWriteGrid___ne__(self, rhs)
 
 
     def validate(self, *args):
         """
-        validate(ScopedCloneableGrid self, CollectionInformation collectionInformation, ImageData imageData, logging::Logger & log) -> bool
-        validate(ScopedCloneableGrid self, RMA const & rma, Vector3 scp, PolyVector3 arpPoly, double fc, logging::Logger & log) -> bool
-        validate(ScopedCloneableGrid self, PFA pfa, RadarCollection const & radarCollection, double fc, logging::Logger & log) -> bool
-        validate(ScopedCloneableGrid self, RgAzComp rgAzComp, GeoData geoData, SCPCOA scpcoa, double fc, logging::Logger & log) -> bool
+        validate(CopyOnWriteGrid self, CollectionInformation collectionInformation, ImageData imageData, logging::Logger & log) -> bool
+        validate(CopyOnWriteGrid self, RMA const & rma, Vector3 scp, PolyVector3 arpPoly, double fc, logging::Logger & log) -> bool
+        validate(CopyOnWriteGrid self, PFA pfa, RadarCollection const & radarCollection, double fc, logging::Logger & log) -> bool
+        validate(CopyOnWriteGrid self, RgAzComp rgAzComp, GeoData geoData, SCPCOA scpcoa, double fc, logging::Logger & log) -> bool
         """
-        return _six_sicd.ScopedCloneableGrid_validate(self, *args)
+        return _six_sicd.CopyOnWriteGrid_validate(self, *args)
 
 
     def fillDerivedFields(self, *args):
         """
-        fillDerivedFields(ScopedCloneableGrid self, CollectionInformation collectionInformation, ImageData imageData, SCPCOA scpcoa)
-        fillDerivedFields(ScopedCloneableGrid self, RMA const & rma, Vector3 scp, PolyVector3 arpPoly)
-        fillDerivedFields(ScopedCloneableGrid self, RgAzComp rgAzComp, GeoData geoData, SCPCOA scpcoa, double fc)
+        fillDerivedFields(CopyOnWriteGrid self, CollectionInformation collectionInformation, ImageData imageData, SCPCOA scpcoa)
+        fillDerivedFields(CopyOnWriteGrid self, RMA const & rma, Vector3 scp, PolyVector3 arpPoly)
+        fillDerivedFields(CopyOnWriteGrid self, RgAzComp rgAzComp, GeoData geoData, SCPCOA scpcoa, double fc)
         """
-        return _six_sicd.ScopedCloneableGrid_fillDerivedFields(self, *args)
+        return _six_sicd.CopyOnWriteGrid_fillDerivedFields(self, *args)
 
 
     def fillDefaultFields(self, *args):
         """
-        fillDefaultFields(ScopedCloneableGrid self, RMA const & rma, double fc)
-        fillDefaultFields(ScopedCloneableGrid self, PFA pfa, double fc)
+        fillDefaultFields(CopyOnWriteGrid self, RMA const & rma, double fc)
+        fillDefaultFields(CopyOnWriteGrid self, PFA pfa, double fc)
         """
-        return _six_sicd.ScopedCloneableGrid_fillDefaultFields(self, *args)
+        return _six_sicd.CopyOnWriteGrid_fillDefaultFields(self, *args)
 
-ScopedCloneableGrid_swigregister = _six_sicd.ScopedCloneableGrid_swigregister
-ScopedCloneableGrid_swigregister(ScopedCloneableGrid)
+CopyOnWriteGrid_swigregister = _six_sicd.CopyOnWriteGrid_swigregister
+CopyOnWriteGrid_swigregister(CopyOnWriteGrid)
 
 
 def makeScopedCloneableGrid():
-    """makeScopedCloneableGrid() -> ScopedCloneableGrid"""
+    """makeScopedCloneableGrid() -> CopyOnWriteGrid"""
     return _six_sicd.makeScopedCloneableGrid()
 class StdAutoTimeline(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::Timeline)> class."""
@@ -5977,85 +6094,100 @@ class StdAutoTimeline(_object):
 StdAutoTimeline_swigregister = _six_sicd.StdAutoTimeline_swigregister
 StdAutoTimeline_swigregister(StdAutoTimeline)
 
-class ScopedCopyableTimeline(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::Timeline)> class."""
+class CopyOnWriteTimeline(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::Timeline)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableTimeline, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteTimeline, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableTimeline, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteTimeline, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Timeline)> self, Timeline ptr=None) -> ScopedCopyableTimeline
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Timeline)> self) -> ScopedCopyableTimeline
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Timeline)> self, ScopedCopyableTimeline rhs) -> ScopedCopyableTimeline
+        __init__(six::CopyOnWritePtr<(six::sicd::Timeline)> self, Timeline ptr=None) -> CopyOnWriteTimeline
+        __init__(six::CopyOnWritePtr<(six::sicd::Timeline)> self) -> CopyOnWriteTimeline
+        __init__(six::CopyOnWritePtr<(six::sicd::Timeline)> self, CopyOnWriteTimeline rhs) -> CopyOnWriteTimeline
         """
-        this = _six_sicd.new_ScopedCopyableTimeline(*args)
+        this = _six_sicd.new_CopyOnWriteTimeline(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableTimeline___nonzero__(self)
+        return _six_sicd.CopyOnWriteTimeline___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableTimeline self) -> Timeline"""
-        return _six_sicd.ScopedCopyableTimeline_get(self)
+        """get(CopyOnWriteTimeline self) -> Timeline"""
+        return _six_sicd.CopyOnWriteTimeline_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableTimeline self) -> Timeline"""
-        return _six_sicd.ScopedCopyableTimeline___ref__(self)
+        """__ref__(CopyOnWriteTimeline self) -> Timeline"""
+        return _six_sicd.CopyOnWriteTimeline___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableTimeline self) -> Timeline"""
-        return _six_sicd.ScopedCopyableTimeline___deref__(self)
+        """__deref__(CopyOnWriteTimeline self) -> Timeline"""
+        return _six_sicd.CopyOnWriteTimeline___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableTimeline self, Timeline ptr=None)
-        reset(ScopedCopyableTimeline self)
+        reset(CopyOnWriteTimeline self, Timeline ptr=None)
+        reset(CopyOnWriteTimeline self)
         """
-        return _six_sicd.ScopedCopyableTimeline_reset(self, ptr)
+        return _six_sicd.CopyOnWriteTimeline_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteTimeline self) -> bool"""
+        return _six_sicd.CopyOnWriteTimeline_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteTimeline self) -> bool"""
+        return _six_sicd.CopyOnWriteTimeline_isShareable(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableTimeline
+    def markShareable(self):
+        """markShareable(CopyOnWriteTimeline self)"""
+        return _six_sicd.CopyOnWriteTimeline_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteTimeline
     __del__ = lambda self: None
-    __swig_setmethods__["collectStart"] = _six_sicd.ScopedCopyableTimeline_collectStart_set
-    __swig_getmethods__["collectStart"] = _six_sicd.ScopedCopyableTimeline_collectStart_get
+    __swig_setmethods__["collectStart"] = _six_sicd.CopyOnWriteTimeline_collectStart_set
+    __swig_getmethods__["collectStart"] = _six_sicd.CopyOnWriteTimeline_collectStart_get
     if _newclass:
-        collectStart = _swig_property(_six_sicd.ScopedCopyableTimeline_collectStart_get, _six_sicd.ScopedCopyableTimeline_collectStart_set)
-    __swig_setmethods__["collectDuration"] = _six_sicd.ScopedCopyableTimeline_collectDuration_set
-    __swig_getmethods__["collectDuration"] = _six_sicd.ScopedCopyableTimeline_collectDuration_get
+        collectStart = _swig_property(_six_sicd.CopyOnWriteTimeline_collectStart_get, _six_sicd.CopyOnWriteTimeline_collectStart_set)
+    __swig_setmethods__["collectDuration"] = _six_sicd.CopyOnWriteTimeline_collectDuration_set
+    __swig_getmethods__["collectDuration"] = _six_sicd.CopyOnWriteTimeline_collectDuration_get
     if _newclass:
-        collectDuration = _swig_property(_six_sicd.ScopedCopyableTimeline_collectDuration_get, _six_sicd.ScopedCopyableTimeline_collectDuration_set)
-    __swig_setmethods__["interPulsePeriod"] = _six_sicd.ScopedCopyableTimeline_interPulsePeriod_set
-    __swig_getmethods__["interPulsePeriod"] = _six_sicd.ScopedCopyableTimeline_interPulsePeriod_get
+        collectDuration = _swig_property(_six_sicd.CopyOnWriteTimeline_collectDuration_get, _six_sicd.CopyOnWriteTimeline_collectDuration_set)
+    __swig_setmethods__["interPulsePeriod"] = _six_sicd.CopyOnWriteTimeline_interPulsePeriod_set
+    __swig_getmethods__["interPulsePeriod"] = _six_sicd.CopyOnWriteTimeline_interPulsePeriod_get
     if _newclass:
-        interPulsePeriod = _swig_property(_six_sicd.ScopedCopyableTimeline_interPulsePeriod_get, _six_sicd.ScopedCopyableTimeline_interPulsePeriod_set)
+        interPulsePeriod = _swig_property(_six_sicd.CopyOnWriteTimeline_interPulsePeriod_get, _six_sicd.CopyOnWriteTimeline_interPulsePeriod_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableTimeline self, Timeline rhs) -> bool"""
-        return _six_sicd.ScopedCopyableTimeline___eq__(self, rhs)
+        """__eq__(CopyOnWriteTimeline self, Timeline rhs) -> bool"""
+        return _six_sicd.CopyOnWriteTimeline___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableTimeline self, Timeline rhs) -> bool"""
-        return _six_sicd.ScopedCopyableTimeline___ne__(self, rhs)
+        """__ne__(CopyOnWriteTimeline self, Timeline rhs) -> bool"""
+        return _six_sicd.CopyOnWriteTimeline___ne__(self, rhs)
 
-ScopedCopyableTimeline_swigregister = _six_sicd.ScopedCopyableTimeline_swigregister
-ScopedCopyableTimeline_swigregister(ScopedCopyableTimeline)
+CopyOnWriteTimeline_swigregister = _six_sicd.CopyOnWriteTimeline_swigregister
+CopyOnWriteTimeline_swigregister(CopyOnWriteTimeline)
 
 
 def makeScopedCopyableTimeline():
-    """makeScopedCopyableTimeline() -> ScopedCopyableTimeline"""
+    """makeScopedCopyableTimeline() -> CopyOnWriteTimeline"""
     return _six_sicd.makeScopedCopyableTimeline()
 class StdAutoPosition(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::Position)> class."""
@@ -6078,99 +6210,114 @@ class StdAutoPosition(_object):
 StdAutoPosition_swigregister = _six_sicd.StdAutoPosition_swigregister
 StdAutoPosition_swigregister(StdAutoPosition)
 
-class ScopedCopyablePosition(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::Position)> class."""
+class CopyOnWritePosition(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::Position)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyablePosition, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWritePosition, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyablePosition, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWritePosition, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Position)> self, Position ptr=None) -> ScopedCopyablePosition
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Position)> self) -> ScopedCopyablePosition
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Position)> self, ScopedCopyablePosition rhs) -> ScopedCopyablePosition
+        __init__(six::CopyOnWritePtr<(six::sicd::Position)> self, Position ptr=None) -> CopyOnWritePosition
+        __init__(six::CopyOnWritePtr<(six::sicd::Position)> self) -> CopyOnWritePosition
+        __init__(six::CopyOnWritePtr<(six::sicd::Position)> self, CopyOnWritePosition rhs) -> CopyOnWritePosition
         """
-        this = _six_sicd.new_ScopedCopyablePosition(*args)
+        this = _six_sicd.new_CopyOnWritePosition(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyablePosition___nonzero__(self)
+        return _six_sicd.CopyOnWritePosition___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyablePosition self) -> Position"""
-        return _six_sicd.ScopedCopyablePosition_get(self)
+        """get(CopyOnWritePosition self) -> Position"""
+        return _six_sicd.CopyOnWritePosition_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyablePosition self) -> Position"""
-        return _six_sicd.ScopedCopyablePosition___ref__(self)
+        """__ref__(CopyOnWritePosition self) -> Position"""
+        return _six_sicd.CopyOnWritePosition___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyablePosition self) -> Position"""
-        return _six_sicd.ScopedCopyablePosition___deref__(self)
+        """__deref__(CopyOnWritePosition self) -> Position"""
+        return _six_sicd.CopyOnWritePosition___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyablePosition self, Position ptr=None)
-        reset(ScopedCopyablePosition self)
+        reset(CopyOnWritePosition self, Position ptr=None)
+        reset(CopyOnWritePosition self)
         """
-        return _six_sicd.ScopedCopyablePosition_reset(self, ptr)
+        return _six_sicd.CopyOnWritePosition_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWritePosition self) -> bool"""
+        return _six_sicd.CopyOnWritePosition_isShared(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyablePosition
+    def isShareable(self):
+        """isShareable(CopyOnWritePosition self) -> bool"""
+        return _six_sicd.CopyOnWritePosition_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWritePosition self)"""
+        return _six_sicd.CopyOnWritePosition_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWritePosition
     __del__ = lambda self: None
-    __swig_setmethods__["arpPoly"] = _six_sicd.ScopedCopyablePosition_arpPoly_set
-    __swig_getmethods__["arpPoly"] = _six_sicd.ScopedCopyablePosition_arpPoly_get
+    __swig_setmethods__["arpPoly"] = _six_sicd.CopyOnWritePosition_arpPoly_set
+    __swig_getmethods__["arpPoly"] = _six_sicd.CopyOnWritePosition_arpPoly_get
     if _newclass:
-        arpPoly = _swig_property(_six_sicd.ScopedCopyablePosition_arpPoly_get, _six_sicd.ScopedCopyablePosition_arpPoly_set)
-    __swig_setmethods__["grpPoly"] = _six_sicd.ScopedCopyablePosition_grpPoly_set
-    __swig_getmethods__["grpPoly"] = _six_sicd.ScopedCopyablePosition_grpPoly_get
+        arpPoly = _swig_property(_six_sicd.CopyOnWritePosition_arpPoly_get, _six_sicd.CopyOnWritePosition_arpPoly_set)
+    __swig_setmethods__["grpPoly"] = _six_sicd.CopyOnWritePosition_grpPoly_set
+    __swig_getmethods__["grpPoly"] = _six_sicd.CopyOnWritePosition_grpPoly_get
     if _newclass:
-        grpPoly = _swig_property(_six_sicd.ScopedCopyablePosition_grpPoly_get, _six_sicd.ScopedCopyablePosition_grpPoly_set)
-    __swig_setmethods__["txAPCPoly"] = _six_sicd.ScopedCopyablePosition_txAPCPoly_set
-    __swig_getmethods__["txAPCPoly"] = _six_sicd.ScopedCopyablePosition_txAPCPoly_get
+        grpPoly = _swig_property(_six_sicd.CopyOnWritePosition_grpPoly_get, _six_sicd.CopyOnWritePosition_grpPoly_set)
+    __swig_setmethods__["txAPCPoly"] = _six_sicd.CopyOnWritePosition_txAPCPoly_set
+    __swig_getmethods__["txAPCPoly"] = _six_sicd.CopyOnWritePosition_txAPCPoly_get
     if _newclass:
-        txAPCPoly = _swig_property(_six_sicd.ScopedCopyablePosition_txAPCPoly_get, _six_sicd.ScopedCopyablePosition_txAPCPoly_set)
-    __swig_setmethods__["rcvAPC"] = _six_sicd.ScopedCopyablePosition_rcvAPC_set
-    __swig_getmethods__["rcvAPC"] = _six_sicd.ScopedCopyablePosition_rcvAPC_get
+        txAPCPoly = _swig_property(_six_sicd.CopyOnWritePosition_txAPCPoly_get, _six_sicd.CopyOnWritePosition_txAPCPoly_set)
+    __swig_setmethods__["rcvAPC"] = _six_sicd.CopyOnWritePosition_rcvAPC_set
+    __swig_getmethods__["rcvAPC"] = _six_sicd.CopyOnWritePosition_rcvAPC_get
     if _newclass:
-        rcvAPC = _swig_property(_six_sicd.ScopedCopyablePosition_rcvAPC_get, _six_sicd.ScopedCopyablePosition_rcvAPC_set)
+        rcvAPC = _swig_property(_six_sicd.CopyOnWritePosition_rcvAPC_get, _six_sicd.CopyOnWritePosition_rcvAPC_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyablePosition self, Position rhs) -> bool"""
-        return _six_sicd.ScopedCopyablePosition___eq__(self, rhs)
+        """__eq__(CopyOnWritePosition self, Position rhs) -> bool"""
+        return _six_sicd.CopyOnWritePosition___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyablePosition self, Position rhs) -> bool"""
-        return _six_sicd.ScopedCopyablePosition___ne__(self, rhs)
+        """__ne__(CopyOnWritePosition self, Position rhs) -> bool"""
+        return _six_sicd.CopyOnWritePosition___ne__(self, rhs)
 
 
     def fillDerivedFields(self, scpcoa):
-        """fillDerivedFields(ScopedCopyablePosition self, SCPCOA scpcoa)"""
-        return _six_sicd.ScopedCopyablePosition_fillDerivedFields(self, scpcoa)
+        """fillDerivedFields(CopyOnWritePosition self, SCPCOA scpcoa)"""
+        return _six_sicd.CopyOnWritePosition_fillDerivedFields(self, scpcoa)
 
 
     def validate(self, log):
-        """validate(ScopedCopyablePosition self, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCopyablePosition_validate(self, log)
+        """validate(CopyOnWritePosition self, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWritePosition_validate(self, log)
 
-ScopedCopyablePosition_swigregister = _six_sicd.ScopedCopyablePosition_swigregister
-ScopedCopyablePosition_swigregister(ScopedCopyablePosition)
+CopyOnWritePosition_swigregister = _six_sicd.CopyOnWritePosition_swigregister
+CopyOnWritePosition_swigregister(CopyOnWritePosition)
 
 
 def makeScopedCopyablePosition():
-    """makeScopedCopyablePosition() -> ScopedCopyablePosition"""
+    """makeScopedCopyablePosition() -> CopyOnWritePosition"""
     return _six_sicd.makeScopedCopyablePosition()
 class StdAutoRcvAPC(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::RcvAPC)> class."""
@@ -6286,122 +6433,143 @@ class StdAutoRadarCollection(_object):
 StdAutoRadarCollection_swigregister = _six_sicd.StdAutoRadarCollection_swigregister
 StdAutoRadarCollection_swigregister(StdAutoRadarCollection)
 
-class ScopedCloneableRadarCollection(_object):
-    """Proxy of C++ mem::ScopedCloneablePtr<(six::sicd::RadarCollection)> class."""
+class CopyOnWriteRadarCollection(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::RadarCollection)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCloneableRadarCollection, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteRadarCollection, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCloneableRadarCollection, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteRadarCollection, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCloneablePtr<(six::sicd::RadarCollection)> self, RadarCollection ptr=None) -> ScopedCloneableRadarCollection
-        __init__(mem::ScopedCloneablePtr<(six::sicd::RadarCollection)> self) -> ScopedCloneableRadarCollection
-        __init__(mem::ScopedCloneablePtr<(six::sicd::RadarCollection)> self, ScopedCloneableRadarCollection rhs) -> ScopedCloneableRadarCollection
+        __init__(six::CopyOnWritePtr<(six::sicd::RadarCollection)> self, RadarCollection ptr=None) -> CopyOnWriteRadarCollection
+        __init__(six::CopyOnWritePtr<(six::sicd::RadarCollection)> self) -> CopyOnWriteRadarCollection
+        __init__(six::CopyOnWritePtr<(six::sicd::RadarCollection)> self, CopyOnWriteRadarCollection rhs) -> CopyOnWriteRadarCollection
         """
-        this = _six_sicd.new_ScopedCloneableRadarCollection(*args)
+        this = _six_sicd.new_CopyOnWriteRadarCollection(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
+    def __nonzero__(self):
+        return _six_sicd.CopyOnWriteRadarCollection___nonzero__(self)
+    __bool__ = __nonzero__
+
+
+
     def get(self):
-        """get(ScopedCloneableRadarCollection self) -> RadarCollection"""
-        return _six_sicd.ScopedCloneableRadarCollection_get(self)
+        """get(CopyOnWriteRadarCollection self) -> RadarCollection"""
+        return _six_sicd.CopyOnWriteRadarCollection_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCloneableRadarCollection self) -> RadarCollection"""
-        return _six_sicd.ScopedCloneableRadarCollection___ref__(self)
+        """__ref__(CopyOnWriteRadarCollection self) -> RadarCollection"""
+        return _six_sicd.CopyOnWriteRadarCollection___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCloneableRadarCollection self) -> RadarCollection"""
-        return _six_sicd.ScopedCloneableRadarCollection___deref__(self)
+        """__deref__(CopyOnWriteRadarCollection self) -> RadarCollection"""
+        return _six_sicd.CopyOnWriteRadarCollection___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCloneableRadarCollection self, RadarCollection ptr=None)
-        reset(ScopedCloneableRadarCollection self)
+        reset(CopyOnWriteRadarCollection self, RadarCollection ptr=None)
+        reset(CopyOnWriteRadarCollection self)
         """
-        return _six_sicd.ScopedCloneableRadarCollection_reset(self, ptr)
+        return _six_sicd.CopyOnWriteRadarCollection_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteRadarCollection self) -> bool"""
+        return _six_sicd.CopyOnWriteRadarCollection_isShared(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCloneableRadarCollection
+    def isShareable(self):
+        """isShareable(CopyOnWriteRadarCollection self) -> bool"""
+        return _six_sicd.CopyOnWriteRadarCollection_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteRadarCollection self)"""
+        return _six_sicd.CopyOnWriteRadarCollection_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteRadarCollection
     __del__ = lambda self: None
 
     def clone(self):
-        """clone(ScopedCloneableRadarCollection self) -> RadarCollection"""
-        return _six_sicd.ScopedCloneableRadarCollection_clone(self)
+        """clone(CopyOnWriteRadarCollection self) -> RadarCollection"""
+        return _six_sicd.CopyOnWriteRadarCollection_clone(self)
 
-    __swig_setmethods__["refFrequencyIndex"] = _six_sicd.ScopedCloneableRadarCollection_refFrequencyIndex_set
-    __swig_getmethods__["refFrequencyIndex"] = _six_sicd.ScopedCloneableRadarCollection_refFrequencyIndex_get
+    __swig_setmethods__["refFrequencyIndex"] = _six_sicd.CopyOnWriteRadarCollection_refFrequencyIndex_set
+    __swig_getmethods__["refFrequencyIndex"] = _six_sicd.CopyOnWriteRadarCollection_refFrequencyIndex_get
     if _newclass:
-        refFrequencyIndex = _swig_property(_six_sicd.ScopedCloneableRadarCollection_refFrequencyIndex_get, _six_sicd.ScopedCloneableRadarCollection_refFrequencyIndex_set)
-    __swig_setmethods__["txFrequencyMin"] = _six_sicd.ScopedCloneableRadarCollection_txFrequencyMin_set
-    __swig_getmethods__["txFrequencyMin"] = _six_sicd.ScopedCloneableRadarCollection_txFrequencyMin_get
+        refFrequencyIndex = _swig_property(_six_sicd.CopyOnWriteRadarCollection_refFrequencyIndex_get, _six_sicd.CopyOnWriteRadarCollection_refFrequencyIndex_set)
+    __swig_setmethods__["txFrequencyMin"] = _six_sicd.CopyOnWriteRadarCollection_txFrequencyMin_set
+    __swig_getmethods__["txFrequencyMin"] = _six_sicd.CopyOnWriteRadarCollection_txFrequencyMin_get
     if _newclass:
-        txFrequencyMin = _swig_property(_six_sicd.ScopedCloneableRadarCollection_txFrequencyMin_get, _six_sicd.ScopedCloneableRadarCollection_txFrequencyMin_set)
-    __swig_setmethods__["txFrequencyMax"] = _six_sicd.ScopedCloneableRadarCollection_txFrequencyMax_set
-    __swig_getmethods__["txFrequencyMax"] = _six_sicd.ScopedCloneableRadarCollection_txFrequencyMax_get
+        txFrequencyMin = _swig_property(_six_sicd.CopyOnWriteRadarCollection_txFrequencyMin_get, _six_sicd.CopyOnWriteRadarCollection_txFrequencyMin_set)
+    __swig_setmethods__["txFrequencyMax"] = _six_sicd.CopyOnWriteRadarCollection_txFrequencyMax_set
+    __swig_getmethods__["txFrequencyMax"] = _six_sicd.CopyOnWriteRadarCollection_txFrequencyMax_get
     if _newclass:
-        txFrequencyMax = _swig_property(_six_sicd.ScopedCloneableRadarCollection_txFrequencyMax_get, _six_sicd.ScopedCloneableRadarCollection_txFrequencyMax_set)
-    __swig_setmethods__["txPolarization"] = _six_sicd.ScopedCloneableRadarCollection_txPolarization_set
-    __swig_getmethods__["txPolarization"] = _six_sicd.ScopedCloneableRadarCollection_txPolarization_get
+        txFrequencyMax = _swig_property(_six_sicd.CopyOnWriteRadarCollection_txFrequencyMax_get, _six_sicd.CopyOnWriteRadarCollection_txFrequencyMax_set)
+    __swig_setmethods__["txPolarization"] = _six_sicd.CopyOnWriteRadarCollection_txPolarization_set
+    __swig_getmethods__["txPolarization"] = _six_sicd.CopyOnWriteRadarCollection_txPolarization_get
     if _newclass:
-        txPolarization = _swig_property(_six_sicd.ScopedCloneableRadarCollection_txPolarization_get, _six_sicd.ScopedCloneableRadarCollection_txPolarization_set)
-    __swig_setmethods__["polarizationHVAnglePoly"] = _six_sicd.ScopedCloneableRadarCollection_polarizationHVAnglePoly_set
-    __swig_getmethods__["polarizationHVAnglePoly"] = _six_sicd.ScopedCloneableRadarCollection_polarizationHVAnglePoly_get
+        txPolarization = _swig_property(_six_sicd.CopyOnWriteRadarCollection_txPolarization_get, _six_sicd.CopyOnWriteRadarCollection_txPolarization_set)
+    __swig_setmethods__["polarizationHVAnglePoly"] = _six_sicd.CopyOnWriteRadarCollection_polarizationHVAnglePoly_set
+    __swig_getmethods__["polarizationHVAnglePoly"] = _six_sicd.CopyOnWriteRadarCollection_polarizationHVAnglePoly_get
     if _newclass:
-        polarizationHVAnglePoly = _swig_property(_six_sicd.ScopedCloneableRadarCollection_polarizationHVAnglePoly_get, _six_sicd.ScopedCloneableRadarCollection_polarizationHVAnglePoly_set)
-    __swig_setmethods__["txSequence"] = _six_sicd.ScopedCloneableRadarCollection_txSequence_set
-    __swig_getmethods__["txSequence"] = _six_sicd.ScopedCloneableRadarCollection_txSequence_get
+        polarizationHVAnglePoly = _swig_property(_six_sicd.CopyOnWriteRadarCollection_polarizationHVAnglePoly_get, _six_sicd.CopyOnWriteRadarCollection_polarizationHVAnglePoly_set)
+    __swig_setmethods__["txSequence"] = _six_sicd.CopyOnWriteRadarCollection_txSequence_set
+    __swig_getmethods__["txSequence"] = _six_sicd.CopyOnWriteRadarCollection_txSequence_get
     if _newclass:
-        txSequence = _swig_property(_six_sicd.ScopedCloneableRadarCollection_txSequence_get, _six_sicd.ScopedCloneableRadarCollection_txSequence_set)
-    __swig_setmethods__["waveform"] = _six_sicd.ScopedCloneableRadarCollection_waveform_set
-    __swig_getmethods__["waveform"] = _six_sicd.ScopedCloneableRadarCollection_waveform_get
+        txSequence = _swig_property(_six_sicd.CopyOnWriteRadarCollection_txSequence_get, _six_sicd.CopyOnWriteRadarCollection_txSequence_set)
+    __swig_setmethods__["waveform"] = _six_sicd.CopyOnWriteRadarCollection_waveform_set
+    __swig_getmethods__["waveform"] = _six_sicd.CopyOnWriteRadarCollection_waveform_get
     if _newclass:
-        waveform = _swig_property(_six_sicd.ScopedCloneableRadarCollection_waveform_get, _six_sicd.ScopedCloneableRadarCollection_waveform_set)
-    __swig_setmethods__["rcvChannels"] = _six_sicd.ScopedCloneableRadarCollection_rcvChannels_set
-    __swig_getmethods__["rcvChannels"] = _six_sicd.ScopedCloneableRadarCollection_rcvChannels_get
+        waveform = _swig_property(_six_sicd.CopyOnWriteRadarCollection_waveform_get, _six_sicd.CopyOnWriteRadarCollection_waveform_set)
+    __swig_setmethods__["rcvChannels"] = _six_sicd.CopyOnWriteRadarCollection_rcvChannels_set
+    __swig_getmethods__["rcvChannels"] = _six_sicd.CopyOnWriteRadarCollection_rcvChannels_get
     if _newclass:
-        rcvChannels = _swig_property(_six_sicd.ScopedCloneableRadarCollection_rcvChannels_get, _six_sicd.ScopedCloneableRadarCollection_rcvChannels_set)
-    __swig_setmethods__["area"] = _six_sicd.ScopedCloneableRadarCollection_area_set
-    __swig_getmethods__["area"] = _six_sicd.ScopedCloneableRadarCollection_area_get
+        rcvChannels = _swig_property(_six_sicd.CopyOnWriteRadarCollection_rcvChannels_get, _six_sicd.CopyOnWriteRadarCollection_rcvChannels_set)
+    __swig_setmethods__["area"] = _six_sicd.CopyOnWriteRadarCollection_area_set
+    __swig_getmethods__["area"] = _six_sicd.CopyOnWriteRadarCollection_area_get
     if _newclass:
-        area = _swig_property(_six_sicd.ScopedCloneableRadarCollection_area_get, _six_sicd.ScopedCloneableRadarCollection_area_set)
-    __swig_setmethods__["parameters"] = _six_sicd.ScopedCloneableRadarCollection_parameters_set
-    __swig_getmethods__["parameters"] = _six_sicd.ScopedCloneableRadarCollection_parameters_get
+        area = _swig_property(_six_sicd.CopyOnWriteRadarCollection_area_get, _six_sicd.CopyOnWriteRadarCollection_area_set)
+    __swig_setmethods__["parameters"] = _six_sicd.CopyOnWriteRadarCollection_parameters_set
+    __swig_getmethods__["parameters"] = _six_sicd.CopyOnWriteRadarCollection_parameters_get
     if _newclass:
-        parameters = _swig_property(_six_sicd.ScopedCloneableRadarCollection_parameters_get, _six_sicd.ScopedCloneableRadarCollection_parameters_set)
+        parameters = _swig_property(_six_sicd.CopyOnWriteRadarCollection_parameters_get, _six_sicd.CopyOnWriteRadarCollection_parameters_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCloneableRadarCollection self, RadarCollection rhs) -> bool"""
-        return _six_sicd.ScopedCloneableRadarCollection___eq__(self, rhs)
+        """__eq__(CopyOnWriteRadarCollection self, RadarCollection rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRadarCollection___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCloneableRadarCollection self, RadarCollection rhs) -> bool"""
-        return _six_sicd.ScopedCloneableRadarCollection___ne__(self, rhs)
+        """__ne__(CopyOnWriteRadarCollection self, RadarCollection rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRadarCollection___ne__(self, rhs)
 
 
     def fillDerivedFields(self):
-        """fillDerivedFields(ScopedCloneableRadarCollection self)"""
-        return _six_sicd.ScopedCloneableRadarCollection_fillDerivedFields(self)
+        """fillDerivedFields(CopyOnWriteRadarCollection self)"""
+        return _six_sicd.CopyOnWriteRadarCollection_fillDerivedFields(self)
 
 
     def validate(self, log):
-        """validate(ScopedCloneableRadarCollection self, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCloneableRadarCollection_validate(self, log)
+        """validate(CopyOnWriteRadarCollection self, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWriteRadarCollection_validate(self, log)
 
-ScopedCloneableRadarCollection_swigregister = _six_sicd.ScopedCloneableRadarCollection_swigregister
-ScopedCloneableRadarCollection_swigregister(ScopedCloneableRadarCollection)
+CopyOnWriteRadarCollection_swigregister = _six_sicd.CopyOnWriteRadarCollection_swigregister
+CopyOnWriteRadarCollection_swigregister(CopyOnWriteRadarCollection)
 
 
 def makeScopedCloneableRadarCollection():
-    """makeScopedCloneableRadarCollection() -> ScopedCloneableRadarCollection"""
+    """makeScopedCloneableRadarCollection() -> CopyOnWriteRadarCollection"""
     return _six_sicd.makeScopedCloneableRadarCollection()
 class StdAutoImageFormation(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::ImageFormation)> class."""
@@ -6424,134 +6592,149 @@ class StdAutoImageFormation(_object):
 StdAutoImageFormation_swigregister = _six_sicd.StdAutoImageFormation_swigregister
 StdAutoImageFormation_swigregister(StdAutoImageFormation)
 
-class ScopedCopyableImageFormation(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::ImageFormation)> class."""
+class CopyOnWriteImageFormation(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::ImageFormation)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableImageFormation, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteImageFormation, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableImageFormation, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteImageFormation, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::ImageFormation)> self, ImageFormation ptr=None) -> ScopedCopyableImageFormation
-        __init__(mem::ScopedCopyablePtr<(six::sicd::ImageFormation)> self) -> ScopedCopyableImageFormation
-        __init__(mem::ScopedCopyablePtr<(six::sicd::ImageFormation)> self, ScopedCopyableImageFormation rhs) -> ScopedCopyableImageFormation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageFormation)> self, ImageFormation ptr=None) -> CopyOnWriteImageFormation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageFormation)> self) -> CopyOnWriteImageFormation
+        __init__(six::CopyOnWritePtr<(six::sicd::ImageFormation)> self, CopyOnWriteImageFormation rhs) -> CopyOnWriteImageFormation
         """
-        this = _six_sicd.new_ScopedCopyableImageFormation(*args)
+        this = _six_sicd.new_CopyOnWriteImageFormation(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableImageFormation___nonzero__(self)
+        return _six_sicd.CopyOnWriteImageFormation___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableImageFormation self) -> ImageFormation"""
-        return _six_sicd.ScopedCopyableImageFormation_get(self)
+        """get(CopyOnWriteImageFormation self) -> ImageFormation"""
+        return _six_sicd.CopyOnWriteImageFormation_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableImageFormation self) -> ImageFormation"""
-        return _six_sicd.ScopedCopyableImageFormation___ref__(self)
+        """__ref__(CopyOnWriteImageFormation self) -> ImageFormation"""
+        return _six_sicd.CopyOnWriteImageFormation___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableImageFormation self) -> ImageFormation"""
-        return _six_sicd.ScopedCopyableImageFormation___deref__(self)
+        """__deref__(CopyOnWriteImageFormation self) -> ImageFormation"""
+        return _six_sicd.CopyOnWriteImageFormation___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableImageFormation self, ImageFormation ptr=None)
-        reset(ScopedCopyableImageFormation self)
+        reset(CopyOnWriteImageFormation self, ImageFormation ptr=None)
+        reset(CopyOnWriteImageFormation self)
         """
-        return _six_sicd.ScopedCopyableImageFormation_reset(self, ptr)
+        return _six_sicd.CopyOnWriteImageFormation_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteImageFormation self) -> bool"""
+        return _six_sicd.CopyOnWriteImageFormation_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteImageFormation self) -> bool"""
+        return _six_sicd.CopyOnWriteImageFormation_isShareable(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableImageFormation
+    def markShareable(self):
+        """markShareable(CopyOnWriteImageFormation self)"""
+        return _six_sicd.CopyOnWriteImageFormation_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteImageFormation
     __del__ = lambda self: None
-    __swig_setmethods__["segmentIdentifier"] = _six_sicd.ScopedCopyableImageFormation_segmentIdentifier_set
-    __swig_getmethods__["segmentIdentifier"] = _six_sicd.ScopedCopyableImageFormation_segmentIdentifier_get
+    __swig_setmethods__["segmentIdentifier"] = _six_sicd.CopyOnWriteImageFormation_segmentIdentifier_set
+    __swig_getmethods__["segmentIdentifier"] = _six_sicd.CopyOnWriteImageFormation_segmentIdentifier_get
     if _newclass:
-        segmentIdentifier = _swig_property(_six_sicd.ScopedCopyableImageFormation_segmentIdentifier_get, _six_sicd.ScopedCopyableImageFormation_segmentIdentifier_set)
-    __swig_setmethods__["rcvChannelProcessed"] = _six_sicd.ScopedCopyableImageFormation_rcvChannelProcessed_set
-    __swig_getmethods__["rcvChannelProcessed"] = _six_sicd.ScopedCopyableImageFormation_rcvChannelProcessed_get
+        segmentIdentifier = _swig_property(_six_sicd.CopyOnWriteImageFormation_segmentIdentifier_get, _six_sicd.CopyOnWriteImageFormation_segmentIdentifier_set)
+    __swig_setmethods__["rcvChannelProcessed"] = _six_sicd.CopyOnWriteImageFormation_rcvChannelProcessed_set
+    __swig_getmethods__["rcvChannelProcessed"] = _six_sicd.CopyOnWriteImageFormation_rcvChannelProcessed_get
     if _newclass:
-        rcvChannelProcessed = _swig_property(_six_sicd.ScopedCopyableImageFormation_rcvChannelProcessed_get, _six_sicd.ScopedCopyableImageFormation_rcvChannelProcessed_set)
-    __swig_setmethods__["txRcvPolarizationProc"] = _six_sicd.ScopedCopyableImageFormation_txRcvPolarizationProc_set
-    __swig_getmethods__["txRcvPolarizationProc"] = _six_sicd.ScopedCopyableImageFormation_txRcvPolarizationProc_get
+        rcvChannelProcessed = _swig_property(_six_sicd.CopyOnWriteImageFormation_rcvChannelProcessed_get, _six_sicd.CopyOnWriteImageFormation_rcvChannelProcessed_set)
+    __swig_setmethods__["txRcvPolarizationProc"] = _six_sicd.CopyOnWriteImageFormation_txRcvPolarizationProc_set
+    __swig_getmethods__["txRcvPolarizationProc"] = _six_sicd.CopyOnWriteImageFormation_txRcvPolarizationProc_get
     if _newclass:
-        txRcvPolarizationProc = _swig_property(_six_sicd.ScopedCopyableImageFormation_txRcvPolarizationProc_get, _six_sicd.ScopedCopyableImageFormation_txRcvPolarizationProc_set)
-    __swig_setmethods__["imageFormationAlgorithm"] = _six_sicd.ScopedCopyableImageFormation_imageFormationAlgorithm_set
-    __swig_getmethods__["imageFormationAlgorithm"] = _six_sicd.ScopedCopyableImageFormation_imageFormationAlgorithm_get
+        txRcvPolarizationProc = _swig_property(_six_sicd.CopyOnWriteImageFormation_txRcvPolarizationProc_get, _six_sicd.CopyOnWriteImageFormation_txRcvPolarizationProc_set)
+    __swig_setmethods__["imageFormationAlgorithm"] = _six_sicd.CopyOnWriteImageFormation_imageFormationAlgorithm_set
+    __swig_getmethods__["imageFormationAlgorithm"] = _six_sicd.CopyOnWriteImageFormation_imageFormationAlgorithm_get
     if _newclass:
-        imageFormationAlgorithm = _swig_property(_six_sicd.ScopedCopyableImageFormation_imageFormationAlgorithm_get, _six_sicd.ScopedCopyableImageFormation_imageFormationAlgorithm_set)
-    __swig_setmethods__["tStartProc"] = _six_sicd.ScopedCopyableImageFormation_tStartProc_set
-    __swig_getmethods__["tStartProc"] = _six_sicd.ScopedCopyableImageFormation_tStartProc_get
+        imageFormationAlgorithm = _swig_property(_six_sicd.CopyOnWriteImageFormation_imageFormationAlgorithm_get, _six_sicd.CopyOnWriteImageFormation_imageFormationAlgorithm_set)
+    __swig_setmethods__["tStartProc"] = _six_sicd.CopyOnWriteImageFormation_tStartProc_set
+    __swig_getmethods__["tStartProc"] = _six_sicd.CopyOnWriteImageFormation_tStartProc_get
     if _newclass:
-        tStartProc = _swig_property(_six_sicd.ScopedCopyableImageFormation_tStartProc_get, _six_sicd.ScopedCopyableImageFormation_tStartProc_set)
-    __swig_setmethods__["tEndProc"] = _six_sicd.ScopedCopyableImageFormation_tEndProc_set
-    __swig_getmethods__["tEndProc"] = _six_sicd.ScopedCopyableImageFormation_tEndProc_get
+        tStartProc = _swig_property(_six_sicd.CopyOnWriteImageFormation_tStartProc_get, _six_sicd.CopyOnWriteImageFormation_tStartProc_set)
+    __swig_setmethods__["tEndProc"] = _six_sicd.CopyOnWriteImageFormation_tEndProc_set
+    __swig_getmethods__["tEndProc"] = _six_sicd.CopyOnWriteImageFormation_tEndProc_get
     if _newclass:
-        tEndProc = _swig_property(_six_sicd.ScopedCopyableImageFormation_tEndProc_get, _six_sicd.ScopedCopyableImageFormation_tEndProc_set)
-    __swig_setmethods__["txFrequencyProcMin"] = _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMin_set
-    __swig_getmethods__["txFrequencyProcMin"] = _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMin_get
+        tEndProc = _swig_property(_six_sicd.CopyOnWriteImageFormation_tEndProc_get, _six_sicd.CopyOnWriteImageFormation_tEndProc_set)
+    __swig_setmethods__["txFrequencyProcMin"] = _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMin_set
+    __swig_getmethods__["txFrequencyProcMin"] = _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMin_get
     if _newclass:
-        txFrequencyProcMin = _swig_property(_six_sicd.ScopedCopyableImageFormation_txFrequencyProcMin_get, _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMin_set)
-    __swig_setmethods__["txFrequencyProcMax"] = _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMax_set
-    __swig_getmethods__["txFrequencyProcMax"] = _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMax_get
+        txFrequencyProcMin = _swig_property(_six_sicd.CopyOnWriteImageFormation_txFrequencyProcMin_get, _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMin_set)
+    __swig_setmethods__["txFrequencyProcMax"] = _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMax_set
+    __swig_getmethods__["txFrequencyProcMax"] = _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMax_get
     if _newclass:
-        txFrequencyProcMax = _swig_property(_six_sicd.ScopedCopyableImageFormation_txFrequencyProcMax_get, _six_sicd.ScopedCopyableImageFormation_txFrequencyProcMax_set)
-    __swig_setmethods__["slowTimeBeamCompensation"] = _six_sicd.ScopedCopyableImageFormation_slowTimeBeamCompensation_set
-    __swig_getmethods__["slowTimeBeamCompensation"] = _six_sicd.ScopedCopyableImageFormation_slowTimeBeamCompensation_get
+        txFrequencyProcMax = _swig_property(_six_sicd.CopyOnWriteImageFormation_txFrequencyProcMax_get, _six_sicd.CopyOnWriteImageFormation_txFrequencyProcMax_set)
+    __swig_setmethods__["slowTimeBeamCompensation"] = _six_sicd.CopyOnWriteImageFormation_slowTimeBeamCompensation_set
+    __swig_getmethods__["slowTimeBeamCompensation"] = _six_sicd.CopyOnWriteImageFormation_slowTimeBeamCompensation_get
     if _newclass:
-        slowTimeBeamCompensation = _swig_property(_six_sicd.ScopedCopyableImageFormation_slowTimeBeamCompensation_get, _six_sicd.ScopedCopyableImageFormation_slowTimeBeamCompensation_set)
-    __swig_setmethods__["imageBeamCompensation"] = _six_sicd.ScopedCopyableImageFormation_imageBeamCompensation_set
-    __swig_getmethods__["imageBeamCompensation"] = _six_sicd.ScopedCopyableImageFormation_imageBeamCompensation_get
+        slowTimeBeamCompensation = _swig_property(_six_sicd.CopyOnWriteImageFormation_slowTimeBeamCompensation_get, _six_sicd.CopyOnWriteImageFormation_slowTimeBeamCompensation_set)
+    __swig_setmethods__["imageBeamCompensation"] = _six_sicd.CopyOnWriteImageFormation_imageBeamCompensation_set
+    __swig_getmethods__["imageBeamCompensation"] = _six_sicd.CopyOnWriteImageFormation_imageBeamCompensation_get
     if _newclass:
-        imageBeamCompensation = _swig_property(_six_sicd.ScopedCopyableImageFormation_imageBeamCompensation_get, _six_sicd.ScopedCopyableImageFormation_imageBeamCompensation_set)
-    __swig_setmethods__["azimuthAutofocus"] = _six_sicd.ScopedCopyableImageFormation_azimuthAutofocus_set
-    __swig_getmethods__["azimuthAutofocus"] = _six_sicd.ScopedCopyableImageFormation_azimuthAutofocus_get
+        imageBeamCompensation = _swig_property(_six_sicd.CopyOnWriteImageFormation_imageBeamCompensation_get, _six_sicd.CopyOnWriteImageFormation_imageBeamCompensation_set)
+    __swig_setmethods__["azimuthAutofocus"] = _six_sicd.CopyOnWriteImageFormation_azimuthAutofocus_set
+    __swig_getmethods__["azimuthAutofocus"] = _six_sicd.CopyOnWriteImageFormation_azimuthAutofocus_get
     if _newclass:
-        azimuthAutofocus = _swig_property(_six_sicd.ScopedCopyableImageFormation_azimuthAutofocus_get, _six_sicd.ScopedCopyableImageFormation_azimuthAutofocus_set)
-    __swig_setmethods__["rangeAutofocus"] = _six_sicd.ScopedCopyableImageFormation_rangeAutofocus_set
-    __swig_getmethods__["rangeAutofocus"] = _six_sicd.ScopedCopyableImageFormation_rangeAutofocus_get
+        azimuthAutofocus = _swig_property(_six_sicd.CopyOnWriteImageFormation_azimuthAutofocus_get, _six_sicd.CopyOnWriteImageFormation_azimuthAutofocus_set)
+    __swig_setmethods__["rangeAutofocus"] = _six_sicd.CopyOnWriteImageFormation_rangeAutofocus_set
+    __swig_getmethods__["rangeAutofocus"] = _six_sicd.CopyOnWriteImageFormation_rangeAutofocus_get
     if _newclass:
-        rangeAutofocus = _swig_property(_six_sicd.ScopedCopyableImageFormation_rangeAutofocus_get, _six_sicd.ScopedCopyableImageFormation_rangeAutofocus_set)
-    __swig_setmethods__["processing"] = _six_sicd.ScopedCopyableImageFormation_processing_set
-    __swig_getmethods__["processing"] = _six_sicd.ScopedCopyableImageFormation_processing_get
+        rangeAutofocus = _swig_property(_six_sicd.CopyOnWriteImageFormation_rangeAutofocus_get, _six_sicd.CopyOnWriteImageFormation_rangeAutofocus_set)
+    __swig_setmethods__["processing"] = _six_sicd.CopyOnWriteImageFormation_processing_set
+    __swig_getmethods__["processing"] = _six_sicd.CopyOnWriteImageFormation_processing_get
     if _newclass:
-        processing = _swig_property(_six_sicd.ScopedCopyableImageFormation_processing_get, _six_sicd.ScopedCopyableImageFormation_processing_set)
-    __swig_setmethods__["polarizationCalibration"] = _six_sicd.ScopedCopyableImageFormation_polarizationCalibration_set
-    __swig_getmethods__["polarizationCalibration"] = _six_sicd.ScopedCopyableImageFormation_polarizationCalibration_get
+        processing = _swig_property(_six_sicd.CopyOnWriteImageFormation_processing_get, _six_sicd.CopyOnWriteImageFormation_processing_set)
+    __swig_setmethods__["polarizationCalibration"] = _six_sicd.CopyOnWriteImageFormation_polarizationCalibration_set
+    __swig_getmethods__["polarizationCalibration"] = _six_sicd.CopyOnWriteImageFormation_polarizationCalibration_get
     if _newclass:
-        polarizationCalibration = _swig_property(_six_sicd.ScopedCopyableImageFormation_polarizationCalibration_get, _six_sicd.ScopedCopyableImageFormation_polarizationCalibration_set)
+        polarizationCalibration = _swig_property(_six_sicd.CopyOnWriteImageFormation_polarizationCalibration_get, _six_sicd.CopyOnWriteImageFormation_polarizationCalibration_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableImageFormation self, ImageFormation rhs) -> bool"""
-        return _six_sicd.ScopedCopyableImageFormation___eq__(self, rhs)
+        """__eq__(CopyOnWriteImageFormation self, ImageFormation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteImageFormation___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableImageFormation self, ImageFormation rhs) -> bool"""
-        return _six_sicd.ScopedCopyableImageFormation___ne__(self, rhs)
+        """__ne__(CopyOnWriteImageFormation self, ImageFormation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteImageFormation___ne__(self, rhs)
 
 
     def fillDefaultFields(self, radarCollection):
-        """fillDefaultFields(ScopedCopyableImageFormation self, RadarCollection radarCollection)"""
-        return _six_sicd.ScopedCopyableImageFormation_fillDefaultFields(self, radarCollection)
+        """fillDefaultFields(CopyOnWriteImageFormation self, RadarCollection radarCollection)"""
+        return _six_sicd.CopyOnWriteImageFormation_fillDefaultFields(self, radarCollection)
 
-ScopedCopyableImageFormation_swigregister = _six_sicd.ScopedCopyableImageFormation_swigregister
-ScopedCopyableImageFormation_swigregister(ScopedCopyableImageFormation)
+CopyOnWriteImageFormation_swigregister = _six_sicd.CopyOnWriteImageFormation_swigregister
+CopyOnWriteImageFormation_swigregister(CopyOnWriteImageFormation)
 
 
 def makeScopedCopyableImageFormation():
-    """makeScopedCopyableImageFormation() -> ScopedCopyableImageFormation"""
+    """makeScopedCopyableImageFormation() -> CopyOnWriteImageFormation"""
     return _six_sicd.makeScopedCopyableImageFormation()
 class StdAutoSCPCOA(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::SCPCOA)> class."""
@@ -6574,159 +6757,174 @@ class StdAutoSCPCOA(_object):
 StdAutoSCPCOA_swigregister = _six_sicd.StdAutoSCPCOA_swigregister
 StdAutoSCPCOA_swigregister(StdAutoSCPCOA)
 
-class ScopedCopyableSCPCOA(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::SCPCOA)> class."""
+class CopyOnWriteSCPCOA(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::SCPCOA)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableSCPCOA, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteSCPCOA, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableSCPCOA, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteSCPCOA, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::SCPCOA)> self, SCPCOA ptr=None) -> ScopedCopyableSCPCOA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::SCPCOA)> self) -> ScopedCopyableSCPCOA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::SCPCOA)> self, ScopedCopyableSCPCOA rhs) -> ScopedCopyableSCPCOA
+        __init__(six::CopyOnWritePtr<(six::sicd::SCPCOA)> self, SCPCOA ptr=None) -> CopyOnWriteSCPCOA
+        __init__(six::CopyOnWritePtr<(six::sicd::SCPCOA)> self) -> CopyOnWriteSCPCOA
+        __init__(six::CopyOnWritePtr<(six::sicd::SCPCOA)> self, CopyOnWriteSCPCOA rhs) -> CopyOnWriteSCPCOA
         """
-        this = _six_sicd.new_ScopedCopyableSCPCOA(*args)
+        this = _six_sicd.new_CopyOnWriteSCPCOA(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableSCPCOA___nonzero__(self)
+        return _six_sicd.CopyOnWriteSCPCOA___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableSCPCOA self) -> SCPCOA"""
-        return _six_sicd.ScopedCopyableSCPCOA_get(self)
+        """get(CopyOnWriteSCPCOA self) -> SCPCOA"""
+        return _six_sicd.CopyOnWriteSCPCOA_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableSCPCOA self) -> SCPCOA"""
-        return _six_sicd.ScopedCopyableSCPCOA___ref__(self)
+        """__ref__(CopyOnWriteSCPCOA self) -> SCPCOA"""
+        return _six_sicd.CopyOnWriteSCPCOA___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableSCPCOA self) -> SCPCOA"""
-        return _six_sicd.ScopedCopyableSCPCOA___deref__(self)
+        """__deref__(CopyOnWriteSCPCOA self) -> SCPCOA"""
+        return _six_sicd.CopyOnWriteSCPCOA___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableSCPCOA self, SCPCOA ptr=None)
-        reset(ScopedCopyableSCPCOA self)
+        reset(CopyOnWriteSCPCOA self, SCPCOA ptr=None)
+        reset(CopyOnWriteSCPCOA self)
         """
-        return _six_sicd.ScopedCopyableSCPCOA_reset(self, ptr)
+        return _six_sicd.CopyOnWriteSCPCOA_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteSCPCOA self) -> bool"""
+        return _six_sicd.CopyOnWriteSCPCOA_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteSCPCOA self) -> bool"""
+        return _six_sicd.CopyOnWriteSCPCOA_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteSCPCOA self)"""
+        return _six_sicd.CopyOnWriteSCPCOA_markShareable(self)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableSCPCOA
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteSCPCOA
     __del__ = lambda self: None
-    __swig_setmethods__["scpTime"] = _six_sicd.ScopedCopyableSCPCOA_scpTime_set
-    __swig_getmethods__["scpTime"] = _six_sicd.ScopedCopyableSCPCOA_scpTime_get
+    __swig_setmethods__["scpTime"] = _six_sicd.CopyOnWriteSCPCOA_scpTime_set
+    __swig_getmethods__["scpTime"] = _six_sicd.CopyOnWriteSCPCOA_scpTime_get
     if _newclass:
-        scpTime = _swig_property(_six_sicd.ScopedCopyableSCPCOA_scpTime_get, _six_sicd.ScopedCopyableSCPCOA_scpTime_set)
-    __swig_setmethods__["arpPos"] = _six_sicd.ScopedCopyableSCPCOA_arpPos_set
-    __swig_getmethods__["arpPos"] = _six_sicd.ScopedCopyableSCPCOA_arpPos_get
+        scpTime = _swig_property(_six_sicd.CopyOnWriteSCPCOA_scpTime_get, _six_sicd.CopyOnWriteSCPCOA_scpTime_set)
+    __swig_setmethods__["arpPos"] = _six_sicd.CopyOnWriteSCPCOA_arpPos_set
+    __swig_getmethods__["arpPos"] = _six_sicd.CopyOnWriteSCPCOA_arpPos_get
     if _newclass:
-        arpPos = _swig_property(_six_sicd.ScopedCopyableSCPCOA_arpPos_get, _six_sicd.ScopedCopyableSCPCOA_arpPos_set)
-    __swig_setmethods__["arpVel"] = _six_sicd.ScopedCopyableSCPCOA_arpVel_set
-    __swig_getmethods__["arpVel"] = _six_sicd.ScopedCopyableSCPCOA_arpVel_get
+        arpPos = _swig_property(_six_sicd.CopyOnWriteSCPCOA_arpPos_get, _six_sicd.CopyOnWriteSCPCOA_arpPos_set)
+    __swig_setmethods__["arpVel"] = _six_sicd.CopyOnWriteSCPCOA_arpVel_set
+    __swig_getmethods__["arpVel"] = _six_sicd.CopyOnWriteSCPCOA_arpVel_get
     if _newclass:
-        arpVel = _swig_property(_six_sicd.ScopedCopyableSCPCOA_arpVel_get, _six_sicd.ScopedCopyableSCPCOA_arpVel_set)
-    __swig_setmethods__["arpAcc"] = _six_sicd.ScopedCopyableSCPCOA_arpAcc_set
-    __swig_getmethods__["arpAcc"] = _six_sicd.ScopedCopyableSCPCOA_arpAcc_get
+        arpVel = _swig_property(_six_sicd.CopyOnWriteSCPCOA_arpVel_get, _six_sicd.CopyOnWriteSCPCOA_arpVel_set)
+    __swig_setmethods__["arpAcc"] = _six_sicd.CopyOnWriteSCPCOA_arpAcc_set
+    __swig_getmethods__["arpAcc"] = _six_sicd.CopyOnWriteSCPCOA_arpAcc_get
     if _newclass:
-        arpAcc = _swig_property(_six_sicd.ScopedCopyableSCPCOA_arpAcc_get, _six_sicd.ScopedCopyableSCPCOA_arpAcc_set)
-    __swig_setmethods__["sideOfTrack"] = _six_sicd.ScopedCopyableSCPCOA_sideOfTrack_set
-    __swig_getmethods__["sideOfTrack"] = _six_sicd.ScopedCopyableSCPCOA_sideOfTrack_get
+        arpAcc = _swig_property(_six_sicd.CopyOnWriteSCPCOA_arpAcc_get, _six_sicd.CopyOnWriteSCPCOA_arpAcc_set)
+    __swig_setmethods__["sideOfTrack"] = _six_sicd.CopyOnWriteSCPCOA_sideOfTrack_set
+    __swig_getmethods__["sideOfTrack"] = _six_sicd.CopyOnWriteSCPCOA_sideOfTrack_get
     if _newclass:
-        sideOfTrack = _swig_property(_six_sicd.ScopedCopyableSCPCOA_sideOfTrack_get, _six_sicd.ScopedCopyableSCPCOA_sideOfTrack_set)
-    __swig_setmethods__["slantRange"] = _six_sicd.ScopedCopyableSCPCOA_slantRange_set
-    __swig_getmethods__["slantRange"] = _six_sicd.ScopedCopyableSCPCOA_slantRange_get
+        sideOfTrack = _swig_property(_six_sicd.CopyOnWriteSCPCOA_sideOfTrack_get, _six_sicd.CopyOnWriteSCPCOA_sideOfTrack_set)
+    __swig_setmethods__["slantRange"] = _six_sicd.CopyOnWriteSCPCOA_slantRange_set
+    __swig_getmethods__["slantRange"] = _six_sicd.CopyOnWriteSCPCOA_slantRange_get
     if _newclass:
-        slantRange = _swig_property(_six_sicd.ScopedCopyableSCPCOA_slantRange_get, _six_sicd.ScopedCopyableSCPCOA_slantRange_set)
-    __swig_setmethods__["groundRange"] = _six_sicd.ScopedCopyableSCPCOA_groundRange_set
-    __swig_getmethods__["groundRange"] = _six_sicd.ScopedCopyableSCPCOA_groundRange_get
+        slantRange = _swig_property(_six_sicd.CopyOnWriteSCPCOA_slantRange_get, _six_sicd.CopyOnWriteSCPCOA_slantRange_set)
+    __swig_setmethods__["groundRange"] = _six_sicd.CopyOnWriteSCPCOA_groundRange_set
+    __swig_getmethods__["groundRange"] = _six_sicd.CopyOnWriteSCPCOA_groundRange_get
     if _newclass:
-        groundRange = _swig_property(_six_sicd.ScopedCopyableSCPCOA_groundRange_get, _six_sicd.ScopedCopyableSCPCOA_groundRange_set)
-    __swig_setmethods__["dopplerConeAngle"] = _six_sicd.ScopedCopyableSCPCOA_dopplerConeAngle_set
-    __swig_getmethods__["dopplerConeAngle"] = _six_sicd.ScopedCopyableSCPCOA_dopplerConeAngle_get
+        groundRange = _swig_property(_six_sicd.CopyOnWriteSCPCOA_groundRange_get, _six_sicd.CopyOnWriteSCPCOA_groundRange_set)
+    __swig_setmethods__["dopplerConeAngle"] = _six_sicd.CopyOnWriteSCPCOA_dopplerConeAngle_set
+    __swig_getmethods__["dopplerConeAngle"] = _six_sicd.CopyOnWriteSCPCOA_dopplerConeAngle_get
     if _newclass:
-        dopplerConeAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_dopplerConeAngle_get, _six_sicd.ScopedCopyableSCPCOA_dopplerConeAngle_set)
-    __swig_setmethods__["grazeAngle"] = _six_sicd.ScopedCopyableSCPCOA_grazeAngle_set
-    __swig_getmethods__["grazeAngle"] = _six_sicd.ScopedCopyableSCPCOA_grazeAngle_get
+        dopplerConeAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_dopplerConeAngle_get, _six_sicd.CopyOnWriteSCPCOA_dopplerConeAngle_set)
+    __swig_setmethods__["grazeAngle"] = _six_sicd.CopyOnWriteSCPCOA_grazeAngle_set
+    __swig_getmethods__["grazeAngle"] = _six_sicd.CopyOnWriteSCPCOA_grazeAngle_get
     if _newclass:
-        grazeAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_grazeAngle_get, _six_sicd.ScopedCopyableSCPCOA_grazeAngle_set)
-    __swig_setmethods__["incidenceAngle"] = _six_sicd.ScopedCopyableSCPCOA_incidenceAngle_set
-    __swig_getmethods__["incidenceAngle"] = _six_sicd.ScopedCopyableSCPCOA_incidenceAngle_get
+        grazeAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_grazeAngle_get, _six_sicd.CopyOnWriteSCPCOA_grazeAngle_set)
+    __swig_setmethods__["incidenceAngle"] = _six_sicd.CopyOnWriteSCPCOA_incidenceAngle_set
+    __swig_getmethods__["incidenceAngle"] = _six_sicd.CopyOnWriteSCPCOA_incidenceAngle_get
     if _newclass:
-        incidenceAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_incidenceAngle_get, _six_sicd.ScopedCopyableSCPCOA_incidenceAngle_set)
-    __swig_setmethods__["twistAngle"] = _six_sicd.ScopedCopyableSCPCOA_twistAngle_set
-    __swig_getmethods__["twistAngle"] = _six_sicd.ScopedCopyableSCPCOA_twistAngle_get
+        incidenceAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_incidenceAngle_get, _six_sicd.CopyOnWriteSCPCOA_incidenceAngle_set)
+    __swig_setmethods__["twistAngle"] = _six_sicd.CopyOnWriteSCPCOA_twistAngle_set
+    __swig_getmethods__["twistAngle"] = _six_sicd.CopyOnWriteSCPCOA_twistAngle_get
     if _newclass:
-        twistAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_twistAngle_get, _six_sicd.ScopedCopyableSCPCOA_twistAngle_set)
-    __swig_setmethods__["slopeAngle"] = _six_sicd.ScopedCopyableSCPCOA_slopeAngle_set
-    __swig_getmethods__["slopeAngle"] = _six_sicd.ScopedCopyableSCPCOA_slopeAngle_get
+        twistAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_twistAngle_get, _six_sicd.CopyOnWriteSCPCOA_twistAngle_set)
+    __swig_setmethods__["slopeAngle"] = _six_sicd.CopyOnWriteSCPCOA_slopeAngle_set
+    __swig_getmethods__["slopeAngle"] = _six_sicd.CopyOnWriteSCPCOA_slopeAngle_get
     if _newclass:
-        slopeAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_slopeAngle_get, _six_sicd.ScopedCopyableSCPCOA_slopeAngle_set)
-    __swig_setmethods__["azimAngle"] = _six_sicd.ScopedCopyableSCPCOA_azimAngle_set
-    __swig_getmethods__["azimAngle"] = _six_sicd.ScopedCopyableSCPCOA_azimAngle_get
+        slopeAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_slopeAngle_get, _six_sicd.CopyOnWriteSCPCOA_slopeAngle_set)
+    __swig_setmethods__["azimAngle"] = _six_sicd.CopyOnWriteSCPCOA_azimAngle_set
+    __swig_getmethods__["azimAngle"] = _six_sicd.CopyOnWriteSCPCOA_azimAngle_get
     if _newclass:
-        azimAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_azimAngle_get, _six_sicd.ScopedCopyableSCPCOA_azimAngle_set)
-    __swig_setmethods__["layoverAngle"] = _six_sicd.ScopedCopyableSCPCOA_layoverAngle_set
-    __swig_getmethods__["layoverAngle"] = _six_sicd.ScopedCopyableSCPCOA_layoverAngle_get
+        azimAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_azimAngle_get, _six_sicd.CopyOnWriteSCPCOA_azimAngle_set)
+    __swig_setmethods__["layoverAngle"] = _six_sicd.CopyOnWriteSCPCOA_layoverAngle_set
+    __swig_getmethods__["layoverAngle"] = _six_sicd.CopyOnWriteSCPCOA_layoverAngle_get
     if _newclass:
-        layoverAngle = _swig_property(_six_sicd.ScopedCopyableSCPCOA_layoverAngle_get, _six_sicd.ScopedCopyableSCPCOA_layoverAngle_set)
+        layoverAngle = _swig_property(_six_sicd.CopyOnWriteSCPCOA_layoverAngle_get, _six_sicd.CopyOnWriteSCPCOA_layoverAngle_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableSCPCOA self, SCPCOA rhs) -> bool"""
-        return _six_sicd.ScopedCopyableSCPCOA___eq__(self, rhs)
+        """__eq__(CopyOnWriteSCPCOA self, SCPCOA rhs) -> bool"""
+        return _six_sicd.CopyOnWriteSCPCOA___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableSCPCOA self, SCPCOA rhs) -> bool"""
-        return _six_sicd.ScopedCopyableSCPCOA___ne__(self, rhs)
+        """__ne__(CopyOnWriteSCPCOA self, SCPCOA rhs) -> bool"""
+        return _six_sicd.CopyOnWriteSCPCOA___ne__(self, rhs)
 
 
     def fillDerivedFields(self, geoData, grid, position):
-        """fillDerivedFields(ScopedCopyableSCPCOA self, GeoData geoData, Grid grid, Position position)"""
-        return _six_sicd.ScopedCopyableSCPCOA_fillDerivedFields(self, geoData, grid, position)
+        """fillDerivedFields(CopyOnWriteSCPCOA self, GeoData geoData, Grid grid, Position position)"""
+        return _six_sicd.CopyOnWriteSCPCOA_fillDerivedFields(self, geoData, grid, position)
 
 
     def validate(self, geoData, grid, position, log):
-        """validate(ScopedCopyableSCPCOA self, GeoData geoData, Grid grid, Position position, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCopyableSCPCOA_validate(self, geoData, grid, position, log)
+        """validate(CopyOnWriteSCPCOA self, GeoData geoData, Grid grid, Position position, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWriteSCPCOA_validate(self, geoData, grid, position, log)
 
 
     def uLOS(self, scp):
-        """uLOS(ScopedCopyableSCPCOA self, Vector3 scp) -> Vector3"""
-        return _six_sicd.ScopedCopyableSCPCOA_uLOS(self, scp)
+        """uLOS(CopyOnWriteSCPCOA self, Vector3 scp) -> Vector3"""
+        return _six_sicd.CopyOnWriteSCPCOA_uLOS(self, scp)
 
 
     def look(self, scp):
-        """look(ScopedCopyableSCPCOA self, Vector3 scp) -> int"""
-        return _six_sicd.ScopedCopyableSCPCOA_look(self, scp)
+        """look(CopyOnWriteSCPCOA self, Vector3 scp) -> int"""
+        return _six_sicd.CopyOnWriteSCPCOA_look(self, scp)
 
 
     def left(self):
-        """left(ScopedCopyableSCPCOA self) -> Vector3"""
-        return _six_sicd.ScopedCopyableSCPCOA_left(self)
+        """left(CopyOnWriteSCPCOA self) -> Vector3"""
+        return _six_sicd.CopyOnWriteSCPCOA_left(self)
 
 
     def slantPlaneNormal(self, scp):
-        """slantPlaneNormal(ScopedCopyableSCPCOA self, Vector3 scp) -> Vector3"""
-        return _six_sicd.ScopedCopyableSCPCOA_slantPlaneNormal(self, scp)
+        """slantPlaneNormal(CopyOnWriteSCPCOA self, Vector3 scp) -> Vector3"""
+        return _six_sicd.CopyOnWriteSCPCOA_slantPlaneNormal(self, scp)
 
-ScopedCopyableSCPCOA_swigregister = _six_sicd.ScopedCopyableSCPCOA_swigregister
-ScopedCopyableSCPCOA_swigregister(ScopedCopyableSCPCOA)
+CopyOnWriteSCPCOA_swigregister = _six_sicd.CopyOnWriteSCPCOA_swigregister
+CopyOnWriteSCPCOA_swigregister(CopyOnWriteSCPCOA)
 
 
 def makeScopedCopyableSCPCOA():
-    """makeScopedCopyableSCPCOA() -> ScopedCopyableSCPCOA"""
+    """makeScopedCopyableSCPCOA() -> CopyOnWriteSCPCOA"""
     return _six_sicd.makeScopedCopyableSCPCOA()
 class StdAutoAntenna(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::Antenna)> class."""
@@ -6749,85 +6947,100 @@ class StdAutoAntenna(_object):
 StdAutoAntenna_swigregister = _six_sicd.StdAutoAntenna_swigregister
 StdAutoAntenna_swigregister(StdAutoAntenna)
 
-class ScopedCopyableAntenna(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::Antenna)> class."""
+class CopyOnWriteAntenna(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::Antenna)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableAntenna, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteAntenna, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableAntenna, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteAntenna, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Antenna)> self, Antenna ptr=None) -> ScopedCopyableAntenna
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Antenna)> self) -> ScopedCopyableAntenna
-        __init__(mem::ScopedCopyablePtr<(six::sicd::Antenna)> self, ScopedCopyableAntenna rhs) -> ScopedCopyableAntenna
+        __init__(six::CopyOnWritePtr<(six::sicd::Antenna)> self, Antenna ptr=None) -> CopyOnWriteAntenna
+        __init__(six::CopyOnWritePtr<(six::sicd::Antenna)> self) -> CopyOnWriteAntenna
+        __init__(six::CopyOnWritePtr<(six::sicd::Antenna)> self, CopyOnWriteAntenna rhs) -> CopyOnWriteAntenna
         """
-        this = _six_sicd.new_ScopedCopyableAntenna(*args)
+        this = _six_sicd.new_CopyOnWriteAntenna(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableAntenna___nonzero__(self)
+        return _six_sicd.CopyOnWriteAntenna___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableAntenna self) -> Antenna"""
-        return _six_sicd.ScopedCopyableAntenna_get(self)
+        """get(CopyOnWriteAntenna self) -> Antenna"""
+        return _six_sicd.CopyOnWriteAntenna_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableAntenna self) -> Antenna"""
-        return _six_sicd.ScopedCopyableAntenna___ref__(self)
+        """__ref__(CopyOnWriteAntenna self) -> Antenna"""
+        return _six_sicd.CopyOnWriteAntenna___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableAntenna self) -> Antenna"""
-        return _six_sicd.ScopedCopyableAntenna___deref__(self)
+        """__deref__(CopyOnWriteAntenna self) -> Antenna"""
+        return _six_sicd.CopyOnWriteAntenna___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableAntenna self, Antenna ptr=None)
-        reset(ScopedCopyableAntenna self)
+        reset(CopyOnWriteAntenna self, Antenna ptr=None)
+        reset(CopyOnWriteAntenna self)
         """
-        return _six_sicd.ScopedCopyableAntenna_reset(self, ptr)
+        return _six_sicd.CopyOnWriteAntenna_reset(self, ptr)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableAntenna
+
+    def isShared(self):
+        """isShared(CopyOnWriteAntenna self) -> bool"""
+        return _six_sicd.CopyOnWriteAntenna_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteAntenna self) -> bool"""
+        return _six_sicd.CopyOnWriteAntenna_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteAntenna self)"""
+        return _six_sicd.CopyOnWriteAntenna_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteAntenna
     __del__ = lambda self: None
-    __swig_setmethods__["tx"] = _six_sicd.ScopedCopyableAntenna_tx_set
-    __swig_getmethods__["tx"] = _six_sicd.ScopedCopyableAntenna_tx_get
+    __swig_setmethods__["tx"] = _six_sicd.CopyOnWriteAntenna_tx_set
+    __swig_getmethods__["tx"] = _six_sicd.CopyOnWriteAntenna_tx_get
     if _newclass:
-        tx = _swig_property(_six_sicd.ScopedCopyableAntenna_tx_get, _six_sicd.ScopedCopyableAntenna_tx_set)
-    __swig_setmethods__["rcv"] = _six_sicd.ScopedCopyableAntenna_rcv_set
-    __swig_getmethods__["rcv"] = _six_sicd.ScopedCopyableAntenna_rcv_get
+        tx = _swig_property(_six_sicd.CopyOnWriteAntenna_tx_get, _six_sicd.CopyOnWriteAntenna_tx_set)
+    __swig_setmethods__["rcv"] = _six_sicd.CopyOnWriteAntenna_rcv_set
+    __swig_getmethods__["rcv"] = _six_sicd.CopyOnWriteAntenna_rcv_get
     if _newclass:
-        rcv = _swig_property(_six_sicd.ScopedCopyableAntenna_rcv_get, _six_sicd.ScopedCopyableAntenna_rcv_set)
-    __swig_setmethods__["twoWay"] = _six_sicd.ScopedCopyableAntenna_twoWay_set
-    __swig_getmethods__["twoWay"] = _six_sicd.ScopedCopyableAntenna_twoWay_get
+        rcv = _swig_property(_six_sicd.CopyOnWriteAntenna_rcv_get, _six_sicd.CopyOnWriteAntenna_rcv_set)
+    __swig_setmethods__["twoWay"] = _six_sicd.CopyOnWriteAntenna_twoWay_set
+    __swig_getmethods__["twoWay"] = _six_sicd.CopyOnWriteAntenna_twoWay_get
     if _newclass:
-        twoWay = _swig_property(_six_sicd.ScopedCopyableAntenna_twoWay_get, _six_sicd.ScopedCopyableAntenna_twoWay_set)
+        twoWay = _swig_property(_six_sicd.CopyOnWriteAntenna_twoWay_get, _six_sicd.CopyOnWriteAntenna_twoWay_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableAntenna self, Antenna rhs) -> bool"""
-        return _six_sicd.ScopedCopyableAntenna___eq__(self, rhs)
+        """__eq__(CopyOnWriteAntenna self, Antenna rhs) -> bool"""
+        return _six_sicd.CopyOnWriteAntenna___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableAntenna self, Antenna rhs) -> bool"""
-        return _six_sicd.ScopedCopyableAntenna___ne__(self, rhs)
+        """__ne__(CopyOnWriteAntenna self, Antenna rhs) -> bool"""
+        return _six_sicd.CopyOnWriteAntenna___ne__(self, rhs)
 
-ScopedCopyableAntenna_swigregister = _six_sicd.ScopedCopyableAntenna_swigregister
-ScopedCopyableAntenna_swigregister(ScopedCopyableAntenna)
+CopyOnWriteAntenna_swigregister = _six_sicd.CopyOnWriteAntenna_swigregister
+CopyOnWriteAntenna_swigregister(CopyOnWriteAntenna)
 
 
 def makeScopedCopyableAntenna():
-    """makeScopedCopyableAntenna() -> ScopedCopyableAntenna"""
+    """makeScopedCopyableAntenna() -> CopyOnWriteAntenna"""
     return _six_sicd.makeScopedCopyableAntenna()
 class StdAutoMatchInformation(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::MatchInformation)> class."""
@@ -6850,77 +7063,92 @@ class StdAutoMatchInformation(_object):
 StdAutoMatchInformation_swigregister = _six_sicd.StdAutoMatchInformation_swigregister
 StdAutoMatchInformation_swigregister(StdAutoMatchInformation)
 
-class ScopedCopyableMatchInformation(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::MatchInformation)> class."""
+class CopyOnWriteMatchInformation(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::MatchInformation)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableMatchInformation, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteMatchInformation, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableMatchInformation, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteMatchInformation, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::MatchInformation)> self, MatchInformation ptr=None) -> ScopedCopyableMatchInformation
-        __init__(mem::ScopedCopyablePtr<(six::sicd::MatchInformation)> self) -> ScopedCopyableMatchInformation
-        __init__(mem::ScopedCopyablePtr<(six::sicd::MatchInformation)> self, ScopedCopyableMatchInformation rhs) -> ScopedCopyableMatchInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::MatchInformation)> self, MatchInformation ptr=None) -> CopyOnWriteMatchInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::MatchInformation)> self) -> CopyOnWriteMatchInformation
+        __init__(six::CopyOnWritePtr<(six::sicd::MatchInformation)> self, CopyOnWriteMatchInformation rhs) -> CopyOnWriteMatchInformation
         """
-        this = _six_sicd.new_ScopedCopyableMatchInformation(*args)
+        this = _six_sicd.new_CopyOnWriteMatchInformation(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableMatchInformation___nonzero__(self)
+        return _six_sicd.CopyOnWriteMatchInformation___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableMatchInformation self) -> MatchInformation"""
-        return _six_sicd.ScopedCopyableMatchInformation_get(self)
+        """get(CopyOnWriteMatchInformation self) -> MatchInformation"""
+        return _six_sicd.CopyOnWriteMatchInformation_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableMatchInformation self) -> MatchInformation"""
-        return _six_sicd.ScopedCopyableMatchInformation___ref__(self)
+        """__ref__(CopyOnWriteMatchInformation self) -> MatchInformation"""
+        return _six_sicd.CopyOnWriteMatchInformation___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableMatchInformation self) -> MatchInformation"""
-        return _six_sicd.ScopedCopyableMatchInformation___deref__(self)
+        """__deref__(CopyOnWriteMatchInformation self) -> MatchInformation"""
+        return _six_sicd.CopyOnWriteMatchInformation___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableMatchInformation self, MatchInformation ptr=None)
-        reset(ScopedCopyableMatchInformation self)
+        reset(CopyOnWriteMatchInformation self, MatchInformation ptr=None)
+        reset(CopyOnWriteMatchInformation self)
         """
-        return _six_sicd.ScopedCopyableMatchInformation_reset(self, ptr)
+        return _six_sicd.CopyOnWriteMatchInformation_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteMatchInformation self) -> bool"""
+        return _six_sicd.CopyOnWriteMatchInformation_isShared(self)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableMatchInformation
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteMatchInformation self) -> bool"""
+        return _six_sicd.CopyOnWriteMatchInformation_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteMatchInformation self)"""
+        return _six_sicd.CopyOnWriteMatchInformation_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteMatchInformation
     __del__ = lambda self: None
-    __swig_setmethods__["types"] = _six_sicd.ScopedCopyableMatchInformation_types_set
-    __swig_getmethods__["types"] = _six_sicd.ScopedCopyableMatchInformation_types_get
+    __swig_setmethods__["types"] = _six_sicd.CopyOnWriteMatchInformation_types_set
+    __swig_getmethods__["types"] = _six_sicd.CopyOnWriteMatchInformation_types_get
     if _newclass:
-        types = _swig_property(_six_sicd.ScopedCopyableMatchInformation_types_get, _six_sicd.ScopedCopyableMatchInformation_types_set)
+        types = _swig_property(_six_sicd.CopyOnWriteMatchInformation_types_get, _six_sicd.CopyOnWriteMatchInformation_types_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableMatchInformation self, MatchInformation rhs) -> bool"""
-        return _six_sicd.ScopedCopyableMatchInformation___eq__(self, rhs)
+        """__eq__(CopyOnWriteMatchInformation self, MatchInformation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteMatchInformation___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableMatchInformation self, MatchInformation rhs) -> bool"""
-        return _six_sicd.ScopedCopyableMatchInformation___ne__(self, rhs)
+        """__ne__(CopyOnWriteMatchInformation self, MatchInformation rhs) -> bool"""
+        return _six_sicd.CopyOnWriteMatchInformation___ne__(self, rhs)
 
-ScopedCopyableMatchInformation_swigregister = _six_sicd.ScopedCopyableMatchInformation_swigregister
-ScopedCopyableMatchInformation_swigregister(ScopedCopyableMatchInformation)
+CopyOnWriteMatchInformation_swigregister = _six_sicd.CopyOnWriteMatchInformation_swigregister
+CopyOnWriteMatchInformation_swigregister(CopyOnWriteMatchInformation)
 
 
 def makeScopedCopyableMatchInformation():
-    """makeScopedCopyableMatchInformation() -> ScopedCopyableMatchInformation"""
+    """makeScopedCopyableMatchInformation() -> CopyOnWriteMatchInformation"""
     return _six_sicd.makeScopedCopyableMatchInformation()
 class StdAutoSlowTimeDeskew(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::SlowTimeDeskew)> class."""
@@ -7040,128 +7268,143 @@ class StdAutoPFA(_object):
 StdAutoPFA_swigregister = _six_sicd.StdAutoPFA_swigregister
 StdAutoPFA_swigregister(StdAutoPFA)
 
-class ScopedCopyablePFA(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::PFA)> class."""
+class CopyOnWritePFA(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::PFA)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyablePFA, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWritePFA, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyablePFA, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWritePFA, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::PFA)> self, PFA ptr=None) -> ScopedCopyablePFA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::PFA)> self) -> ScopedCopyablePFA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::PFA)> self, ScopedCopyablePFA rhs) -> ScopedCopyablePFA
+        __init__(six::CopyOnWritePtr<(six::sicd::PFA)> self, PFA ptr=None) -> CopyOnWritePFA
+        __init__(six::CopyOnWritePtr<(six::sicd::PFA)> self) -> CopyOnWritePFA
+        __init__(six::CopyOnWritePtr<(six::sicd::PFA)> self, CopyOnWritePFA rhs) -> CopyOnWritePFA
         """
-        this = _six_sicd.new_ScopedCopyablePFA(*args)
+        this = _six_sicd.new_CopyOnWritePFA(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyablePFA___nonzero__(self)
+        return _six_sicd.CopyOnWritePFA___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyablePFA self) -> PFA"""
-        return _six_sicd.ScopedCopyablePFA_get(self)
+        """get(CopyOnWritePFA self) -> PFA"""
+        return _six_sicd.CopyOnWritePFA_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyablePFA self) -> PFA"""
-        return _six_sicd.ScopedCopyablePFA___ref__(self)
+        """__ref__(CopyOnWritePFA self) -> PFA"""
+        return _six_sicd.CopyOnWritePFA___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyablePFA self) -> PFA"""
-        return _six_sicd.ScopedCopyablePFA___deref__(self)
+        """__deref__(CopyOnWritePFA self) -> PFA"""
+        return _six_sicd.CopyOnWritePFA___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyablePFA self, PFA ptr=None)
-        reset(ScopedCopyablePFA self)
+        reset(CopyOnWritePFA self, PFA ptr=None)
+        reset(CopyOnWritePFA self)
         """
-        return _six_sicd.ScopedCopyablePFA_reset(self, ptr)
+        return _six_sicd.CopyOnWritePFA_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWritePFA self) -> bool"""
+        return _six_sicd.CopyOnWritePFA_isShared(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyablePFA
+    def isShareable(self):
+        """isShareable(CopyOnWritePFA self) -> bool"""
+        return _six_sicd.CopyOnWritePFA_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWritePFA self)"""
+        return _six_sicd.CopyOnWritePFA_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWritePFA
     __del__ = lambda self: None
-    __swig_setmethods__["focusPlaneNormal"] = _six_sicd.ScopedCopyablePFA_focusPlaneNormal_set
-    __swig_getmethods__["focusPlaneNormal"] = _six_sicd.ScopedCopyablePFA_focusPlaneNormal_get
+    __swig_setmethods__["focusPlaneNormal"] = _six_sicd.CopyOnWritePFA_focusPlaneNormal_set
+    __swig_getmethods__["focusPlaneNormal"] = _six_sicd.CopyOnWritePFA_focusPlaneNormal_get
     if _newclass:
-        focusPlaneNormal = _swig_property(_six_sicd.ScopedCopyablePFA_focusPlaneNormal_get, _six_sicd.ScopedCopyablePFA_focusPlaneNormal_set)
-    __swig_setmethods__["imagePlaneNormal"] = _six_sicd.ScopedCopyablePFA_imagePlaneNormal_set
-    __swig_getmethods__["imagePlaneNormal"] = _six_sicd.ScopedCopyablePFA_imagePlaneNormal_get
+        focusPlaneNormal = _swig_property(_six_sicd.CopyOnWritePFA_focusPlaneNormal_get, _six_sicd.CopyOnWritePFA_focusPlaneNormal_set)
+    __swig_setmethods__["imagePlaneNormal"] = _six_sicd.CopyOnWritePFA_imagePlaneNormal_set
+    __swig_getmethods__["imagePlaneNormal"] = _six_sicd.CopyOnWritePFA_imagePlaneNormal_get
     if _newclass:
-        imagePlaneNormal = _swig_property(_six_sicd.ScopedCopyablePFA_imagePlaneNormal_get, _six_sicd.ScopedCopyablePFA_imagePlaneNormal_set)
-    __swig_setmethods__["polarAngleRefTime"] = _six_sicd.ScopedCopyablePFA_polarAngleRefTime_set
-    __swig_getmethods__["polarAngleRefTime"] = _six_sicd.ScopedCopyablePFA_polarAngleRefTime_get
+        imagePlaneNormal = _swig_property(_six_sicd.CopyOnWritePFA_imagePlaneNormal_get, _six_sicd.CopyOnWritePFA_imagePlaneNormal_set)
+    __swig_setmethods__["polarAngleRefTime"] = _six_sicd.CopyOnWritePFA_polarAngleRefTime_set
+    __swig_getmethods__["polarAngleRefTime"] = _six_sicd.CopyOnWritePFA_polarAngleRefTime_get
     if _newclass:
-        polarAngleRefTime = _swig_property(_six_sicd.ScopedCopyablePFA_polarAngleRefTime_get, _six_sicd.ScopedCopyablePFA_polarAngleRefTime_set)
-    __swig_setmethods__["polarAnglePoly"] = _six_sicd.ScopedCopyablePFA_polarAnglePoly_set
-    __swig_getmethods__["polarAnglePoly"] = _six_sicd.ScopedCopyablePFA_polarAnglePoly_get
+        polarAngleRefTime = _swig_property(_six_sicd.CopyOnWritePFA_polarAngleRefTime_get, _six_sicd.CopyOnWritePFA_polarAngleRefTime_set)
+    __swig_setmethods__["polarAnglePoly"] = _six_sicd.CopyOnWritePFA_polarAnglePoly_set
+    __swig_getmethods__["polarAnglePoly"] = _six_sicd.CopyOnWritePFA_polarAnglePoly_get
     if _newclass:
-        polarAnglePoly = _swig_property(_six_sicd.ScopedCopyablePFA_polarAnglePoly_get, _six_sicd.ScopedCopyablePFA_polarAnglePoly_set)
-    __swig_setmethods__["spatialFrequencyScaleFactorPoly"] = _six_sicd.ScopedCopyablePFA_spatialFrequencyScaleFactorPoly_set
-    __swig_getmethods__["spatialFrequencyScaleFactorPoly"] = _six_sicd.ScopedCopyablePFA_spatialFrequencyScaleFactorPoly_get
+        polarAnglePoly = _swig_property(_six_sicd.CopyOnWritePFA_polarAnglePoly_get, _six_sicd.CopyOnWritePFA_polarAnglePoly_set)
+    __swig_setmethods__["spatialFrequencyScaleFactorPoly"] = _six_sicd.CopyOnWritePFA_spatialFrequencyScaleFactorPoly_set
+    __swig_getmethods__["spatialFrequencyScaleFactorPoly"] = _six_sicd.CopyOnWritePFA_spatialFrequencyScaleFactorPoly_get
     if _newclass:
-        spatialFrequencyScaleFactorPoly = _swig_property(_six_sicd.ScopedCopyablePFA_spatialFrequencyScaleFactorPoly_get, _six_sicd.ScopedCopyablePFA_spatialFrequencyScaleFactorPoly_set)
-    __swig_setmethods__["krg1"] = _six_sicd.ScopedCopyablePFA_krg1_set
-    __swig_getmethods__["krg1"] = _six_sicd.ScopedCopyablePFA_krg1_get
+        spatialFrequencyScaleFactorPoly = _swig_property(_six_sicd.CopyOnWritePFA_spatialFrequencyScaleFactorPoly_get, _six_sicd.CopyOnWritePFA_spatialFrequencyScaleFactorPoly_set)
+    __swig_setmethods__["krg1"] = _six_sicd.CopyOnWritePFA_krg1_set
+    __swig_getmethods__["krg1"] = _six_sicd.CopyOnWritePFA_krg1_get
     if _newclass:
-        krg1 = _swig_property(_six_sicd.ScopedCopyablePFA_krg1_get, _six_sicd.ScopedCopyablePFA_krg1_set)
-    __swig_setmethods__["krg2"] = _six_sicd.ScopedCopyablePFA_krg2_set
-    __swig_getmethods__["krg2"] = _six_sicd.ScopedCopyablePFA_krg2_get
+        krg1 = _swig_property(_six_sicd.CopyOnWritePFA_krg1_get, _six_sicd.CopyOnWritePFA_krg1_set)
+    __swig_setmethods__["krg2"] = _six_sicd.CopyOnWritePFA_krg2_set
+    __swig_getmethods__["krg2"] = _six_sicd.CopyOnWritePFA_krg2_get
     if _newclass:
-        krg2 = _swig_property(_six_sicd.ScopedCopyablePFA_krg2_get, _six_sicd.ScopedCopyablePFA_krg2_set)
-    __swig_setmethods__["kaz1"] = _six_sicd.ScopedCopyablePFA_kaz1_set
-    __swig_getmethods__["kaz1"] = _six_sicd.ScopedCopyablePFA_kaz1_get
+        krg2 = _swig_property(_six_sicd.CopyOnWritePFA_krg2_get, _six_sicd.CopyOnWritePFA_krg2_set)
+    __swig_setmethods__["kaz1"] = _six_sicd.CopyOnWritePFA_kaz1_set
+    __swig_getmethods__["kaz1"] = _six_sicd.CopyOnWritePFA_kaz1_get
     if _newclass:
-        kaz1 = _swig_property(_six_sicd.ScopedCopyablePFA_kaz1_get, _six_sicd.ScopedCopyablePFA_kaz1_set)
-    __swig_setmethods__["kaz2"] = _six_sicd.ScopedCopyablePFA_kaz2_set
-    __swig_getmethods__["kaz2"] = _six_sicd.ScopedCopyablePFA_kaz2_get
+        kaz1 = _swig_property(_six_sicd.CopyOnWritePFA_kaz1_get, _six_sicd.CopyOnWritePFA_kaz1_set)
+    __swig_setmethods__["kaz2"] = _six_sicd.CopyOnWritePFA_kaz2_set
+    __swig_getmethods__["kaz2"] = _six_sicd.CopyOnWritePFA_kaz2_get
     if _newclass:
-        kaz2 = _swig_property(_six_sicd.ScopedCopyablePFA_kaz2_get, _six_sicd.ScopedCopyablePFA_kaz2_set)
-    __swig_setmethods__["slowTimeDeskew"] = _six_sicd.ScopedCopyablePFA_slowTimeDeskew_set
-    __swig_getmethods__["slowTimeDeskew"] = _six_sicd.ScopedCopyablePFA_slowTimeDeskew_get
+        kaz2 = _swig_property(_six_sicd.CopyOnWritePFA_kaz2_get, _six_sicd.CopyOnWritePFA_kaz2_set)
+    __swig_setmethods__["slowTimeDeskew"] = _six_sicd.CopyOnWritePFA_slowTimeDeskew_set
+    __swig_getmethods__["slowTimeDeskew"] = _six_sicd.CopyOnWritePFA_slowTimeDeskew_get
     if _newclass:
-        slowTimeDeskew = _swig_property(_six_sicd.ScopedCopyablePFA_slowTimeDeskew_get, _six_sicd.ScopedCopyablePFA_slowTimeDeskew_set)
+        slowTimeDeskew = _swig_property(_six_sicd.CopyOnWritePFA_slowTimeDeskew_get, _six_sicd.CopyOnWritePFA_slowTimeDeskew_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyablePFA self, PFA rhs) -> bool"""
-        return _six_sicd.ScopedCopyablePFA___eq__(self, rhs)
+        """__eq__(CopyOnWritePFA self, PFA rhs) -> bool"""
+        return _six_sicd.CopyOnWritePFA___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyablePFA self, PFA rhs) -> bool"""
-        return _six_sicd.ScopedCopyablePFA___ne__(self, rhs)
+        """__ne__(CopyOnWritePFA self, PFA rhs) -> bool"""
+        return _six_sicd.CopyOnWritePFA___ne__(self, rhs)
 
 
     def fillDerivedFields(self, position):
-        """fillDerivedFields(ScopedCopyablePFA self, Position position)"""
-        return _six_sicd.ScopedCopyablePFA_fillDerivedFields(self, position)
+        """fillDerivedFields(CopyOnWritePFA self, Position position)"""
+        return _six_sicd.CopyOnWritePFA_fillDerivedFields(self, position)
 
 
     def fillDefaultFields(self, geoData, arg3, scpcoa):
-        """fillDefaultFields(ScopedCopyablePFA self, GeoData geoData, Grid arg3, SCPCOA scpcoa)"""
-        return _six_sicd.ScopedCopyablePFA_fillDefaultFields(self, geoData, arg3, scpcoa)
+        """fillDefaultFields(CopyOnWritePFA self, GeoData geoData, Grid arg3, SCPCOA scpcoa)"""
+        return _six_sicd.CopyOnWritePFA_fillDefaultFields(self, geoData, arg3, scpcoa)
 
 
     def validate(self, scpcoa, log):
-        """validate(ScopedCopyablePFA self, SCPCOA scpcoa, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCopyablePFA_validate(self, scpcoa, log)
+        """validate(CopyOnWritePFA self, SCPCOA scpcoa, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWritePFA_validate(self, scpcoa, log)
 
-ScopedCopyablePFA_swigregister = _six_sicd.ScopedCopyablePFA_swigregister
-ScopedCopyablePFA_swigregister(ScopedCopyablePFA)
+CopyOnWritePFA_swigregister = _six_sicd.CopyOnWritePFA_swigregister
+CopyOnWritePFA_swigregister(CopyOnWritePFA)
 
 
 def makeScopedCopyablePFA():
-    """makeScopedCopyablePFA() -> ScopedCopyablePFA"""
+    """makeScopedCopyablePFA() -> CopyOnWritePFA"""
     return _six_sicd.makeScopedCopyablePFA()
 class StdAutoRMA(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::RMA)> class."""
@@ -7184,104 +7427,119 @@ class StdAutoRMA(_object):
 StdAutoRMA_swigregister = _six_sicd.StdAutoRMA_swigregister
 StdAutoRMA_swigregister(StdAutoRMA)
 
-class ScopedCopyableRMA(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::RMA)> class."""
+class CopyOnWriteRMA(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::RMA)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableRMA, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteRMA, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableRMA, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteRMA, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RMA)> self, RMA ptr=None) -> ScopedCopyableRMA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RMA)> self) -> ScopedCopyableRMA
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RMA)> self, ScopedCopyableRMA rhs) -> ScopedCopyableRMA
+        __init__(six::CopyOnWritePtr<(six::sicd::RMA)> self, RMA ptr=None) -> CopyOnWriteRMA
+        __init__(six::CopyOnWritePtr<(six::sicd::RMA)> self) -> CopyOnWriteRMA
+        __init__(six::CopyOnWritePtr<(six::sicd::RMA)> self, CopyOnWriteRMA rhs) -> CopyOnWriteRMA
         """
-        this = _six_sicd.new_ScopedCopyableRMA(*args)
+        this = _six_sicd.new_CopyOnWriteRMA(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableRMA___nonzero__(self)
+        return _six_sicd.CopyOnWriteRMA___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableRMA self) -> RMA"""
-        return _six_sicd.ScopedCopyableRMA_get(self)
+        """get(CopyOnWriteRMA self) -> RMA"""
+        return _six_sicd.CopyOnWriteRMA_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableRMA self) -> RMA"""
-        return _six_sicd.ScopedCopyableRMA___ref__(self)
+        """__ref__(CopyOnWriteRMA self) -> RMA"""
+        return _six_sicd.CopyOnWriteRMA___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableRMA self) -> RMA"""
-        return _six_sicd.ScopedCopyableRMA___deref__(self)
+        """__deref__(CopyOnWriteRMA self) -> RMA"""
+        return _six_sicd.CopyOnWriteRMA___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableRMA self, RMA ptr=None)
-        reset(ScopedCopyableRMA self)
+        reset(CopyOnWriteRMA self, RMA ptr=None)
+        reset(CopyOnWriteRMA self)
         """
-        return _six_sicd.ScopedCopyableRMA_reset(self, ptr)
+        return _six_sicd.CopyOnWriteRMA_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteRMA self) -> bool"""
+        return _six_sicd.CopyOnWriteRMA_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteRMA self) -> bool"""
+        return _six_sicd.CopyOnWriteRMA_isShareable(self)
+
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableRMA
+    def markShareable(self):
+        """markShareable(CopyOnWriteRMA self)"""
+        return _six_sicd.CopyOnWriteRMA_markShareable(self)
+
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteRMA
     __del__ = lambda self: None
-    __swig_setmethods__["algoType"] = _six_sicd.ScopedCopyableRMA_algoType_set
-    __swig_getmethods__["algoType"] = _six_sicd.ScopedCopyableRMA_algoType_get
+    __swig_setmethods__["algoType"] = _six_sicd.CopyOnWriteRMA_algoType_set
+    __swig_getmethods__["algoType"] = _six_sicd.CopyOnWriteRMA_algoType_get
     if _newclass:
-        algoType = _swig_property(_six_sicd.ScopedCopyableRMA_algoType_get, _six_sicd.ScopedCopyableRMA_algoType_set)
-    __swig_setmethods__["rmat"] = _six_sicd.ScopedCopyableRMA_rmat_set
-    __swig_getmethods__["rmat"] = _six_sicd.ScopedCopyableRMA_rmat_get
+        algoType = _swig_property(_six_sicd.CopyOnWriteRMA_algoType_get, _six_sicd.CopyOnWriteRMA_algoType_set)
+    __swig_setmethods__["rmat"] = _six_sicd.CopyOnWriteRMA_rmat_set
+    __swig_getmethods__["rmat"] = _six_sicd.CopyOnWriteRMA_rmat_get
     if _newclass:
-        rmat = _swig_property(_six_sicd.ScopedCopyableRMA_rmat_get, _six_sicd.ScopedCopyableRMA_rmat_set)
-    __swig_setmethods__["rmcr"] = _six_sicd.ScopedCopyableRMA_rmcr_set
-    __swig_getmethods__["rmcr"] = _six_sicd.ScopedCopyableRMA_rmcr_get
+        rmat = _swig_property(_six_sicd.CopyOnWriteRMA_rmat_get, _six_sicd.CopyOnWriteRMA_rmat_set)
+    __swig_setmethods__["rmcr"] = _six_sicd.CopyOnWriteRMA_rmcr_set
+    __swig_getmethods__["rmcr"] = _six_sicd.CopyOnWriteRMA_rmcr_get
     if _newclass:
-        rmcr = _swig_property(_six_sicd.ScopedCopyableRMA_rmcr_get, _six_sicd.ScopedCopyableRMA_rmcr_set)
-    __swig_setmethods__["inca"] = _six_sicd.ScopedCopyableRMA_inca_set
-    __swig_getmethods__["inca"] = _six_sicd.ScopedCopyableRMA_inca_get
+        rmcr = _swig_property(_six_sicd.CopyOnWriteRMA_rmcr_get, _six_sicd.CopyOnWriteRMA_rmcr_set)
+    __swig_setmethods__["inca"] = _six_sicd.CopyOnWriteRMA_inca_set
+    __swig_getmethods__["inca"] = _six_sicd.CopyOnWriteRMA_inca_get
     if _newclass:
-        inca = _swig_property(_six_sicd.ScopedCopyableRMA_inca_get, _six_sicd.ScopedCopyableRMA_inca_set)
+        inca = _swig_property(_six_sicd.CopyOnWriteRMA_inca_get, _six_sicd.CopyOnWriteRMA_inca_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableRMA self, RMA rhs) -> bool"""
-        return _six_sicd.ScopedCopyableRMA___eq__(self, rhs)
+        """__eq__(CopyOnWriteRMA self, RMA rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRMA___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableRMA self, RMA rhs) -> bool"""
-        return _six_sicd.ScopedCopyableRMA___ne__(self, rhs)
+        """__ne__(CopyOnWriteRMA self, RMA rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRMA___ne__(self, rhs)
 
 
     def fillDerivedFields(self, geoData, position):
-        """fillDerivedFields(ScopedCopyableRMA self, GeoData geoData, Position position)"""
-        return _six_sicd.ScopedCopyableRMA_fillDerivedFields(self, geoData, position)
+        """fillDerivedFields(CopyOnWriteRMA self, GeoData geoData, Position position)"""
+        return _six_sicd.CopyOnWriteRMA_fillDerivedFields(self, geoData, position)
 
 
     def fillDefaultFields(self, scpcoa, fc):
-        """fillDefaultFields(ScopedCopyableRMA self, SCPCOA scpcoa, double fc)"""
-        return _six_sicd.ScopedCopyableRMA_fillDefaultFields(self, scpcoa, fc)
+        """fillDefaultFields(CopyOnWriteRMA self, SCPCOA scpcoa, double fc)"""
+        return _six_sicd.CopyOnWriteRMA_fillDefaultFields(self, scpcoa, fc)
 
 
     def validate(self, collectionInformation, scp, arpPoly, fc, log):
-        """validate(ScopedCopyableRMA self, CollectionInformation collectionInformation, Vector3 scp, PolyVector3 arpPoly, double fc, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCopyableRMA_validate(self, collectionInformation, scp, arpPoly, fc, log)
+        """validate(CopyOnWriteRMA self, CollectionInformation collectionInformation, Vector3 scp, PolyVector3 arpPoly, double fc, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWriteRMA_validate(self, collectionInformation, scp, arpPoly, fc, log)
 
-ScopedCopyableRMA_swigregister = _six_sicd.ScopedCopyableRMA_swigregister
-ScopedCopyableRMA_swigregister(ScopedCopyableRMA)
+CopyOnWriteRMA_swigregister = _six_sicd.CopyOnWriteRMA_swigregister
+CopyOnWriteRMA_swigregister(CopyOnWriteRMA)
 
 
 def makeScopedCopyableRMA():
-    """makeScopedCopyableRMA() -> ScopedCopyableRMA"""
+    """makeScopedCopyableRMA() -> CopyOnWriteRMA"""
     return _six_sicd.makeScopedCopyableRMA()
 class StdAutoRgAzComp(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::RgAzComp)> class."""
@@ -7304,91 +7562,106 @@ class StdAutoRgAzComp(_object):
 StdAutoRgAzComp_swigregister = _six_sicd.StdAutoRgAzComp_swigregister
 StdAutoRgAzComp_swigregister(StdAutoRgAzComp)
 
-class ScopedCopyableRgAzComp(_object):
-    """Proxy of C++ mem::ScopedCopyablePtr<(six::sicd::RgAzComp)> class."""
+class CopyOnWriteRgAzComp(_object):
+    """Proxy of C++ six::CopyOnWritePtr<(six::sicd::RgAzComp)> class."""
 
     __swig_setmethods__ = {}
-    __setattr__ = lambda self, name, value: _swig_setattr(self, ScopedCopyableRgAzComp, name, value)
+    __setattr__ = lambda self, name, value: _swig_setattr(self, CopyOnWriteRgAzComp, name, value)
     __swig_getmethods__ = {}
-    __getattr__ = lambda self, name: _swig_getattr(self, ScopedCopyableRgAzComp, name)
+    __getattr__ = lambda self, name: _swig_getattr(self, CopyOnWriteRgAzComp, name)
     __repr__ = _swig_repr
 
     def __init__(self, *args):
         """
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RgAzComp)> self, RgAzComp ptr=None) -> ScopedCopyableRgAzComp
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RgAzComp)> self) -> ScopedCopyableRgAzComp
-        __init__(mem::ScopedCopyablePtr<(six::sicd::RgAzComp)> self, ScopedCopyableRgAzComp rhs) -> ScopedCopyableRgAzComp
+        __init__(six::CopyOnWritePtr<(six::sicd::RgAzComp)> self, RgAzComp ptr=None) -> CopyOnWriteRgAzComp
+        __init__(six::CopyOnWritePtr<(six::sicd::RgAzComp)> self) -> CopyOnWriteRgAzComp
+        __init__(six::CopyOnWritePtr<(six::sicd::RgAzComp)> self, CopyOnWriteRgAzComp rhs) -> CopyOnWriteRgAzComp
         """
-        this = _six_sicd.new_ScopedCopyableRgAzComp(*args)
+        this = _six_sicd.new_CopyOnWriteRgAzComp(*args)
         try:
             self.this.append(this)
         except __builtin__.Exception:
             self.this = this
 
     def __nonzero__(self):
-        return _six_sicd.ScopedCopyableRgAzComp___nonzero__(self)
+        return _six_sicd.CopyOnWriteRgAzComp___nonzero__(self)
     __bool__ = __nonzero__
 
 
 
     def get(self):
-        """get(ScopedCopyableRgAzComp self) -> RgAzComp"""
-        return _six_sicd.ScopedCopyableRgAzComp_get(self)
+        """get(CopyOnWriteRgAzComp self) -> RgAzComp"""
+        return _six_sicd.CopyOnWriteRgAzComp_get(self)
 
 
     def __ref__(self):
-        """__ref__(ScopedCopyableRgAzComp self) -> RgAzComp"""
-        return _six_sicd.ScopedCopyableRgAzComp___ref__(self)
+        """__ref__(CopyOnWriteRgAzComp self) -> RgAzComp"""
+        return _six_sicd.CopyOnWriteRgAzComp___ref__(self)
 
 
     def __deref__(self):
-        """__deref__(ScopedCopyableRgAzComp self) -> RgAzComp"""
-        return _six_sicd.ScopedCopyableRgAzComp___deref__(self)
+        """__deref__(CopyOnWriteRgAzComp self) -> RgAzComp"""
+        return _six_sicd.CopyOnWriteRgAzComp___deref__(self)
 
 
     def reset(self, ptr=None):
         """
-        reset(ScopedCopyableRgAzComp self, RgAzComp ptr=None)
-        reset(ScopedCopyableRgAzComp self)
+        reset(CopyOnWriteRgAzComp self, RgAzComp ptr=None)
+        reset(CopyOnWriteRgAzComp self)
         """
-        return _six_sicd.ScopedCopyableRgAzComp_reset(self, ptr)
+        return _six_sicd.CopyOnWriteRgAzComp_reset(self, ptr)
+
+
+    def isShared(self):
+        """isShared(CopyOnWriteRgAzComp self) -> bool"""
+        return _six_sicd.CopyOnWriteRgAzComp_isShared(self)
+
+
+    def isShareable(self):
+        """isShareable(CopyOnWriteRgAzComp self) -> bool"""
+        return _six_sicd.CopyOnWriteRgAzComp_isShareable(self)
+
+
+    def markShareable(self):
+        """markShareable(CopyOnWriteRgAzComp self)"""
+        return _six_sicd.CopyOnWriteRgAzComp_markShareable(self)
 
-    __swig_destroy__ = _six_sicd.delete_ScopedCopyableRgAzComp
+    __swig_destroy__ = _six_sicd.delete_CopyOnWriteRgAzComp
     __del__ = lambda self: None
-    __swig_setmethods__["azSF"] = _six_sicd.ScopedCopyableRgAzComp_azSF_set
-    __swig_getmethods__["azSF"] = _six_sicd.ScopedCopyableRgAzComp_azSF_get
+    __swig_setmethods__["azSF"] = _six_sicd.CopyOnWriteRgAzComp_azSF_set
+    __swig_getmethods__["azSF"] = _six_sicd.CopyOnWriteRgAzComp_azSF_get
     if _newclass:
-        azSF = _swig_property(_six_sicd.ScopedCopyableRgAzComp_azSF_get, _six_sicd.ScopedCopyableRgAzComp_azSF_set)
-    __swig_setmethods__["kazPoly"] = _six_sicd.ScopedCopyableRgAzComp_kazPoly_set
-    __swig_getmethods__["kazPoly"] = _six_sicd.ScopedCopyableRgAzComp_kazPoly_get
+        azSF = _swig_property(_six_sicd.CopyOnWriteRgAzComp_azSF_get, _six_sicd.CopyOnWriteRgAzComp_azSF_set)
+    __swig_setmethods__["kazPoly"] = _six_sicd.CopyOnWriteRgAzComp_kazPoly_set
+    __swig_getmethods__["kazPoly"] = _six_sicd.CopyOnWriteRgAzComp_kazPoly_get
     if _newclass:
-        kazPoly = _swig_property(_six_sicd.ScopedCopyableRgAzComp_kazPoly_get, _six_sicd.ScopedCopyableRgAzComp_kazPoly_set)
+        kazPoly = _swig_property(_six_sicd.CopyOnWriteRgAzComp_kazPoly_get, _six_sicd.CopyOnWriteRgAzComp_kazPoly_set)
 
     def __eq__(self, rhs):
-        """__eq__(ScopedCopyableRgAzComp self, RgAzComp rhs) -> bool"""
-        return _six_sicd.ScopedCopyableRgAzComp___eq__(self, rhs)
+        """__eq__(CopyOnWriteRgAzComp self, RgAzComp rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRgAzComp___eq__(self, rhs)
 
 
     def __ne__(self, rhs):
-        """__ne__(ScopedCopyableRgAzComp self, RgAzComp rhs) -> bool"""
-        return _six_sicd.ScopedCopyableRgAzComp___ne__(self, rhs)
+        """__ne__(CopyOnWriteRgAzComp self, RgAzComp rhs) -> bool"""
+        return _six_sicd.CopyOnWriteRgAzComp___ne__(self, rhs)
 
 
     def fillDerivedFields(self, geoData, grid, scpcoa, timeline):
-        """fillDerivedFields(ScopedCopyableRgAzComp self, GeoData geoData, Grid grid, SCPCOA scpcoa, Timeline timeline)"""
-        return _six_sicd.ScopedCopyableRgAzComp_fillDerivedFields(self, geoData, grid, scpcoa, timeline)
+        """fillDerivedFields(CopyOnWriteRgAzComp self, GeoData geoData, Grid grid, SCPCOA scpcoa, Timeline timeline)"""
+        return _six_sicd.CopyOnWriteRgAzComp_fillDerivedFields(self, geoData, grid, scpcoa, timeline)
 
 
     def validate(self, geoData, grid, scpcoa, timeline, log):
-        """validate(ScopedCopyableRgAzComp self, GeoData geoData, Grid grid, SCPCOA scpcoa, Timeline timeline, logging::Logger & log) -> bool"""
-        return _six_sicd.ScopedCopyableRgAzComp_validate(self, geoData, grid, scpcoa, timeline, log)
+        """validate(CopyOnWriteRgAzComp self, GeoData geoData, Grid grid, SCPCOA scpcoa, Timeline timeline, logging::Logger & log) -> bool"""
+        return _six_sicd.CopyOnWriteRgAzComp_validate(self, geoData, grid, scpcoa, timeline, log)
 
-ScopedCopyableRgAzComp_swigregister = _six_sicd.ScopedCopyableRgAzComp_swigregister
-ScopedCopyableRgAzComp_swigregister(ScopedCopyableRgAzComp)
+CopyOnWriteRgAzComp_swigregister = _six_sicd.CopyOnWriteRgAzComp_swigregister
+CopyOnWriteRgAzComp_swigregister(CopyOnWriteRgAzComp)
 
 
 def makeScopedCopyableRgAzComp():
-    """makeScopedCopyableRgAzComp() -> ScopedCopyableRgAzComp"""
+    """makeScopedCopyableRgAzComp() -> CopyOnWriteRgAzComp"""
     return _six_sicd.makeScopedCopyableRgAzComp()
 class StdAutoGeoInfo(_object):
     """Proxy of C++ std::auto_ptr<(six::sicd::GeoInfo)> class."""
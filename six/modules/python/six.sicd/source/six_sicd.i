@@ -138,6 +138,14 @@ nitf::Record _readRecord(const std::string& pathname)
 %ignore mem::ScopedCloneablePtr::operator==;
 %ignore mem::ScopedCopyablePtr::operator!=;
 %ignore mem::ScopedCopyablePtr::operator==;
+%ignore six::CopyOnWritePtr::operator!=;
+%ignore six::CopyOnWritePtr::operator==;
+
+// Python can't tell const from non-const, so only the accessors that copy
+// a shared pointee before handing it out are wrapped
+%ignore six::CopyOnWritePtr::get() const;
+%ignore six::CopyOnWritePtr::operator*() const;
+%ignore six::CopyOnWritePtr::operator->() const;
 
 %rename(_fitOutputToSlantImpl) scene::ProjectionPolynomialFitter::fitOutputToSlantPolynomials;
 %rename(_fitSlantToOutputImpl) scene::ProjectionPolynomialFitter::fitSlantToOutputPolynomials;
@@ -224,6 +232,7 @@ def schema_path():
 
 %import "scene/GridECEFTransform.h"
 %include "scene/ProjectionPolynomialFitter.h"
+%include "six/CopyOnWritePtr.h"
 %include "six/sicd/ComplexClassification.h"
 %include "six/sicd/CollectionInformation.h"
 %include "six/sicd/ImageCreation.h"
@@ -246,26 +255,46 @@ def schema_path():
 %include "six/sicd/AreaPlaneUtility.h"
 %include "six/sicd/GeoLocator.h"
 
+/*
+ * Like SCOPED_COPYABLE and SCOPED_CLONEABLE, but for the six::CopyOnWritePtr
+ * members of ComplexData.  The factory keeps the name it had when the member
+ * was a ScopedCopyablePtr or ScopedCloneablePtr.
+ */
+%define COPY_ON_WRITE(namespace, type, factory)
+%ignore six::CopyOnWritePtr< namespace##::##type >::CopyOnWritePtr(std::auto_ptr< namespace##::##type >);
+%ignore six::CopyOnWritePtr< namespace##::##type >::reset(std::auto_ptr< namespace##::##type >);
+%template(StdAuto##type) std::auto_ptr< namespace##::##type >;
+%template(CopyOnWrite##type) six::CopyOnWritePtr<namespace##::##type>;
+%{
+six::CopyOnWritePtr< namespace##::##type > factory##type()
+{
+    return six::CopyOnWritePtr< namespace##::##type >(new namespace##::##type ());
+}
+%}
+
+six::CopyOnWritePtr< namespace##::##type > factory##type();
+%enddef
+
 /* We need this because SWIG cannot do it itself, for some reason */
 /* TODO: write script to generate all of these instantiations for us? */
 
-SCOPED_CLONEABLE(six::sicd, CollectionInformation)
-SCOPED_CLONEABLE(six::sicd, ImageCreation)
+COPY_ON_WRITE(six::sicd, CollectionInformation, makeScopedCloneable)
+COPY_ON_WRITE(six::sicd, ImageCreation, makeScopedCloneable)
 SCOPED_COPYABLE(six::sicd, ImageData)
 SCOPED_CLONEABLE(six::sicd, GeoData)
-SCOPED_CLONEABLE(six::sicd, Grid)
-SCOPED_COPYABLE(six::sicd, Timeline)
-SCOPED_COPYABLE(six::sicd, Position)
+COPY_ON_WRITE(six::sicd, Grid, makeScopedCloneable)
+COPY_ON_WRITE(six::sicd, Timeline, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, Position, makeScopedCopyable)
 SCOPED_COPYABLE(six::sicd, RcvAPC)
-SCOPED_CLONEABLE(six::sicd, RadarCollection)
-SCOPED_COPYABLE(six::sicd, ImageFormation)
-SCOPED_COPYABLE(six::sicd, SCPCOA)
-SCOPED_COPYABLE(six::sicd, Antenna)
-SCOPED_COPYABLE(six::sicd, MatchInformation)
+COPY_ON_WRITE(six::sicd, RadarCollection, makeScopedCloneable)
+COPY_ON_WRITE(six::sicd, ImageFormation, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, SCPCOA, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, Antenna, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, MatchInformation, makeScopedCopyable)
 SCOPED_COPYABLE(six::sicd, SlowTimeDeskew)
-SCOPED_COPYABLE(six::sicd, PFA)
-SCOPED_COPYABLE(six::sicd, RMA)
-SCOPED_COPYABLE(six::sicd, RgAzComp)
+COPY_ON_WRITE(six::sicd, PFA, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, RMA, makeScopedCopyable)
+COPY_ON_WRITE(six::sicd, RgAzComp, makeScopedCopyable)
 
 SCOPED_CLONEABLE(six::sicd, GeoInfo)
 %template(VectorScopedCloneableGeoInfo) std::vector<mem::ScopedCloneablePtr<six::sicd::GeoInfo> >;
@@ -4023,6 +4023,11 @@ class Data(_object):
         return _six_base.Data_clone(self)
 
 
+    def markShareable(self):
+        """markShareable(Data self)"""
+        return _six_base.Data_markShareable(self)
+
+
     def getDataType(self):
         """getDataType(Data self) -> DataType"""
         return _six_base.Data_getDataType(self)
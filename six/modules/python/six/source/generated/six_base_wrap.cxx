@@ -56520,6 +56520,57 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_Data_markShareable(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  six::Data *arg1 = (six::Data *) 0 ;
+  void *argp1 = 0 ;
+  int res1 = 0 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:Data_markShareable",&obj0)) SWIG_fail;
+  res1 = SWIG_ConvertPtr(obj0, &argp1,SWIGTYPE_p_six__Data, 0 |  0 );
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "Data_markShareable" "', argument " "1"" of type '" "six::Data *""'"); 
+  }
+  arg1 = reinterpret_cast< six::Data * >(argp1);
+  {
+    try
+    {
+      (arg1)->markShareable();
+    } 
+    catch (const std::exception& e)
+    {
+      if (!PyErr_Occurred())
+      {
+        PyErr_SetString(PyExc_RuntimeError, e.what());
+      }
+    }
+    catch (const except::Exception& e)
+    {
+      if (!PyErr_Occurred())
+      {
+        PyErr_SetString(PyExc_RuntimeError, e.getMessage().c_str());
+      }
+    }
+    catch (...)
+    {
+      if (!PyErr_Occurred())
+      {
+        PyErr_SetString(PyExc_RuntimeError, "Unknown error");
+      }
+    }
+    if (PyErr_Occurred())
+    {
+      SWIG_fail;
+    }
+  }
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_Data_getDataType(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   six::Data *arg1 = (six::Data *) 0 ;
@@ -79782,6 +79833,7 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"Radiometric_swigregister", Radiometric_swigregister, METH_VARARGS, NULL},
 	 { (char *)"delete_Data", _wrap_delete_Data, METH_VARARGS, (char *)"delete_Data(Data self)"},
 	 { (char *)"Data_clone", _wrap_Data_clone, METH_VARARGS, (char *)"Data_clone(Data self) -> Data"},
+	 { (char *)"Data_markShareable", _wrap_Data_markShareable, METH_VARARGS, (char *)"Data_markShareable(Data self)"},
 	 { (char *)"Data_getDataType", _wrap_Data_getDataType, METH_VARARGS, (char *)"Data_getDataType(Data self) -> DataType"},
 	 { (char *)"Data_getPixelType", _wrap_Data_getPixelType, METH_VARARGS, (char *)"Data_getPixelType(Data self) -> PixelType"},
 	 { (char *)"Data_setPixelType", _wrap_Data_setPixelType, METH_VARARGS, (char *)"Data_setPixelType(Data self, PixelType pixelType)"},
@@ -67,6 +67,10 @@ using namespace six;
 /* will probably want it eventually, but it looks like six.sicd doesn't use it */
 %ignore "LUT";
 
+/* XMLStreamWriter isn't wrapped */
+%ignore six::XMLControl::toXML(const Data* data, XMLStreamWriter& writer);
+%ignore six::XMLControl::validate;
+
 /* ignore some useless (in Python) functions in ParameterCollection */
 %ignore six::ParameterCollection::begin;
 %ignore six::ParameterCollection::end;
@@ -0,0 +1,123 @@
+/* =========================================================================
+ * This file is part of the CSM SICD Plugin
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * The CSM SICD Plugin is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef __SIX_CSM_COMPACT_MODEL_STATE_H__
+#define __SIX_CSM_COMPACT_MODEL_STATE_H__
+
+#include <memory>
+#include <string>
+
+#include <sys/Conf.h>
+#include <six/sicd/ComplexData.h>
+#include <six/sidd/DerivedData.h>
+
+namespace six
+{
+namespace CSM
+{
+/**
+ * @class CompactModelState
+ *
+ * @brief Binary encoding of the metadata the sensor models project with
+ *
+ * The XML sensor model state carries the entire SICD or SIDD, and parsing
+ * it back dominates the time it takes to restore a model.  This encoding
+ * carries only what the sensor models use (identifiers, image extents, the
+ * SCP or reference point, the grid, polynomials, and error statistics), so
+ * restoring from it skips XML parsing entirely.
+ *
+ * The encoding is MAGIC, a 32-bit version, a 32-bit DataType, then the
+ * fields in a fixed order.  Everything is stored big-endian.  Decoding
+ * produces a skeletal ComplexData or DerivedData with just those fields
+ * populated; it's only suitable for building projection models, not for
+ * writing back out as a SICD or SIDD.
+ */
+class CompactModelState
+{
+public:
+    //! Leads every encoded state so it can be told apart from XML
+    static const char MAGIC[];
+
+    //! Version written by encode()
+    static const sys::Uint32_T VERSION;
+
+    /**
+     * \param state Sensor model state with the model name already stripped
+     *     off
+     *
+     * \return True if the state was produced by encode()
+     */
+    static bool isCompact(const std::string& state);
+
+    /**
+     * Encode the geometry-relevant parts of a SICD
+     *
+     * \param data The SICD metadata
+     *
+     * \return The encoded state
+     */
+    static std::string encode(const six::sicd::ComplexData& data);
+
+    /**
+     * Encode the geometry-relevant parts of a SIDD.  Only plane and
+     * geographic projections are supported, matching what
+     * six::sidd::Utilities::getProjectionModel() can build.
+     *
+     * \param data The SIDD metadata
+     *
+     * \return The encoded state
+     */
+    static std::string encode(const six::sidd::DerivedData& data);
+
+    /**
+     * Decode a state produced by encode(const six::sicd::ComplexData&)
+     *
+     * \param state The encoded state
+     *
+     * \return Skeletal SICD metadata
+     *
+     * \throws except::Exception if the state is truncated, from a newer
+     *     version, or doesn't hold a SICD
+     */
+    static std::auto_ptr<six::sicd::ComplexData>
+    decodeComplexData(const std::string& state);
+
+    /**
+     * Decode a state produced by encode(const six::sidd::DerivedData&)
+     *
+     * \param state The encoded state
+     *
+     * \return Skeletal SIDD metadata
+     *
+     * \throws except::Exception if the state is truncated, from a newer
+     *     version, or doesn't hold a SIDD
+     */
+    static std::auto_ptr<six::sidd::DerivedData>
+    decodeDerivedData(const std::string& state);
+
+private:
+    CompactModelState();
+};
+}
+}
+
+#endif
@@ -143,6 +143,14 @@ public: // Model methods
      */
     virtual std::string getSensorMode() const;
 
+    /**
+     * Returns a binary state holding only what the model needs to project.
+     * See CompactModelState.
+     *
+     * \return Compact state of the sensor model
+     */
+    virtual std::string getCompactModelState() const;
+
 public: // RasterGM methods
     /**
      * Returns the number of lines and samples in full image space pixels for
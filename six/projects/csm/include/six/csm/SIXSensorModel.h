@@ -32,6 +32,7 @@
 #include <scene/SceneGeometry.h>
 #include <scene/ProjectionModel.h>
 #include <scene/ECEFToLLATransform.h>
+#include <sys/Mutex.h>
 #include <six/Enums.h>
 #include <six/Types.h>
 
@@ -64,17 +65,31 @@ public: // Model methods
     /**
      * Returns a string representing the state of the sensor model.  The state
      * string is made up of the sensor model name, followed by a space, then
-     * the SICD XML as a string.
+     * the SICD XML as a string.  If setUseCompactModelState() has been
+     * turned on, or the model was restored from a compact state, this is
+     * the compact state instead.
      *
      * \return State of the sensor model
      */
     virtual std::string getModelState() const;
 
+    /**
+     * Returns a binary state holding only what the model needs to project.
+     * The state string is made up of the sensor model name, followed by a
+     * space, then the CompactModelState encoding.  Restoring a model from
+     * this skips XML parsing, so it's much faster than restoring from
+     * getModelState().
+     *
+     * \return Compact state of the sensor model
+     */
+    virtual std::string getCompactModelState() const = 0;
+
     /**
      * Initialize the current model with argState
      *
-     * \param[in] argState The sensor model state to update to.  If the string
-     *     is empty, the model is unchanged.
+     * \param[in] argState The sensor model state to update to.  Either the
+     *     XML or the compact state is accepted.  If the string is empty, the
+     *     model is unchanged.
      */
     virtual void replaceModelState(const std::string& argState);
 
@@ -600,6 +615,103 @@ public: // RasterGM methods
     double getCorrelationCoefficient(size_t cpGroupIndex,
                                      double deltaTime) const;
 
+    /*
+     * Selects how the sensor partials, and the ground partials used to
+     * propagate covariance, are computed.  By default they are computed in
+     * closed form, falling back to finite differences if that fails.  Finite differences are much slower, but are kept to validate
+     * the closed form partials against.
+     *
+     * \param useAnalyticPartials If false, always use finite differences
+     */
+    void setUseAnalyticPartials(bool useAnalyticPartials)
+    {
+        mUseAnalyticPartials = useAnalyticPartials;
+        clearPartialsMemo();
+    }
+
+    bool getUseAnalyticPartials() const
+    {
+        return mUseAnalyticPartials;
+    }
+
+    /*
+     * Selects which state getModelState() returns.  By default it's the XML
+     * state so the full SICD or SIDD metadata goes along with it.
+     *
+     * \param useCompactModelState If true, return getCompactModelState()
+     */
+    void setUseCompactModelState(bool useCompactModelState)
+    {
+        mUseCompactModelState = useCompactModelState;
+    }
+
+    bool getUseCompactModelState() const
+    {
+        return mUseCompactModelState;
+    }
+
+public: // Bulk methods (not part of the CSM API)
+    // These project arrays of points at once, spreading them across
+    // numThreads workers of tasks::SharedTaskScheduler (0 means all of
+    // them).  Each matches calling the
+    // corresponding CSM method on every point with the default desired
+    // precision, except that a point that fails to project doesn't throw.
+    // Instead its output coordinates (and covariance) are set to NaN and, if
+    // 'valid' is non-NULL, its entry there is set to false.  All arrays hold
+    // numPoints elements.  Each returns the number of points that failed.
+
+    /*
+     * \param groundPts Ground coordinates in ECEF meters
+     * \param[out] imagePts Image coordinates in pixels
+     */
+    size_t bulkGroundToImage(const csm::EcefCoord* groundPts,
+                             size_t numPoints,
+                             csm::ImageCoord* imagePts,
+                             bool* valid = NULL,
+                             size_t numThreads = 0) const;
+
+    /*
+     * \param groundPts Ground coordinates in ECEF meters and covariances
+     *     in ECEF meters squared
+     * \param[out] imagePts Image coordinates in pixels and covariances in
+     *     pixels squared
+     */
+    size_t bulkGroundToImage(const csm::EcefCoordCovar* groundPts,
+                             size_t numPoints,
+                             csm::ImageCoordCovar* imagePts,
+                             bool* valid = NULL,
+                             size_t numThreads = 0) const;
+
+    /*
+     * \param imagePts Image coordinates in pixels
+     * \param heights Height of each point in meters above the WGS-84
+     *     ellipsoid
+     * \param[out] groundPts Ground coordinates in ECEF meters
+     */
+    size_t bulkImageToGround(const csm::ImageCoord* imagePts,
+                             const double* heights,
+                             size_t numPoints,
+                             csm::EcefCoord* groundPts,
+                             bool* valid = NULL,
+                             size_t numThreads = 0) const;
+
+    /*
+     * \param imagePts Image coordinates in pixels and covariances in pixels
+     *     squared
+     * \param heights Height of each point in meters above the WGS-84
+     *     ellipsoid
+     * \param heightVariances Variance of each height in meters squared
+     * \param[out] groundPts Ground coordinates in ECEF meters and
+     *     covariances in ECEF meters squared
+     */
+    size_t bulkImageToGround(const csm::ImageCoordCovar* imagePts,
+                             const double* heights,
+                             const double* heightVariances,
+                             size_t numPoints,
+                             csm::EcefCoordCovar* groundPts,
+                             bool* valid = NULL,
+                             size_t numThreads = 0) const;
+
 public:
     // All remaining public methods throw csm::Error's that they're not
     // implemented
@@ -652,6 +764,25 @@ protected:
                                       double desiredPrecision,
                                       double* achievedPrecision) const;
 
+    // These do the work for the CSM methods of the same name, throwing
+    // except::Exception's rather than csm::Error's
+    csm::ImageCoordCovar groundToImageCovarImpl(
+            const csm::EcefCoordCovar& groundPt,
+            double desiredPrecision,
+            double* achievedPrecision) const;
+
+    csm::EcefCoord imageToGroundImpl(const csm::ImageCoord& imagePt,
+                                     double height,
+                                     double desiredPrecision,
+                                     double* achievedPrecision) const;
+
+    csm::EcefCoordCovar imageToGroundCovarImpl(
+            const csm::ImageCoordCovar& imagePt,
+            double height,
+            double heightVariance,
+            double desiredPrecision,
+            double* achievedPrecision) const;
+
     static
     scene::Vector3 toVector3(const csm::EcefCoord& pt)
     {
@@ -683,6 +814,76 @@ protected:
     static
     DataType getDataType(const csm::Des& des);
 
+    /*
+     * Computes the partials of the image grid point (in meters) w.r.t. the
+     * adjustable parameters.  Bundle adjustment typically asks for the
+     * partials for one parameter at a time at the same ground point, so the
+     * last result is remembered and reused until the ground point, image
+     * point, or any adjustable parameter changes.
+     */
+    math::linear::MatrixMxN<2, 7>
+    getSensorPartials(const scene::Vector3& groundPt,
+                      const types::RowCol<double>& imageGridPt) const;
+
+    /*
+     * Computes the partials of the image grid point (in meters) w.r.t. the
+     * ground point, in closed form unless analytic partials are turned off
+     * or the geometry is degenerate.
+     */
+    math::linear::MatrixMxN<2, 3>
+    getGroundPartials(const scene::Vector3& groundPt,
+                      const types::RowCol<double>& imageGridPt) const;
+
+    void clearPartialsMemo() const;
+
+private:
+    // The arrays passed to one of the bulk methods.  Exactly one of the
+    // inputs and the matching output are set.
+    struct BulkPoints
+    {
+        BulkPoints();
+
+        const csm::EcefCoord* groundPts;
+        const csm::EcefCoordCovar* groundCovarPts;
+        const csm::ImageCoord* imagePts;
+        const csm::ImageCoordCovar* imageCovarPts;
+        const double* heights;
+        const double* heightVariances;
+        csm::ImageCoord* imageOutput;
+        csm::ImageCoordCovar* imageCovarOutput;
+        csm::EcefCoord* groundOutput;
+        csm::EcefCoordCovar* groundCovarOutput;
+        bool* valid;
+    };
+
+    class BulkProjector;
+
+    size_t runBulk(const BulkPoints& points,
+                   size_t numPoints,
+                   size_t numThreads) const;
+
+    // Projects one point, setting its outputs to NaN if it fails
+    bool projectPoint(const BulkPoints& points, size_t index) const;
+
+    struct SensorPartialsMemo
+    {
+        SensorPartialsMemo() :
+            isValid(false)
+        {
+        }
+
+        bool isValid;
+        scene::Vector3 groundPt;
+        types::RowCol<double> imageGridPt;
+        scene::AdjustableParams params;
+        math::linear::MatrixMxN<2, 7> partials;
+    };
+
+    bool mUseAnalyticPartials;
+    bool mUseCompactModelState;
+    mutable sys::Mutex mPartialsMutex;
+    mutable SensorPartialsMemo mPartialsMemo;
+
 protected:
     const scene::ECEFToLLATransform mECEFToLLA;
     const csm::NoCorrelationModel mCorrelationModel;
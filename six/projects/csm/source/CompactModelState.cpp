@@ -0,0 +1,775 @@
+/* =========================================================================
+ * This file is part of the CSM SICD Plugin
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * The CSM SICD Plugin is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+
+#include <vector>
+
+#include <except/Exception.h>
+#include <str/Convert.h>
+#include <six/Serialize.h>
+#include <six/csm/CompactModelState.h>
+
+namespace
+{
+const size_t MAGIC_LENGTH = 6;
+
+class StateWriter
+{
+public:
+    StateWriter() :
+        mSwapBytes(!sys::isBigEndianSystem())
+    {
+        mBuffer.reserve(4096);
+    }
+
+    template <typename T>
+    void write(const T& val)
+    {
+        six::serialize(val, mSwapBytes, mBuffer);
+    }
+
+    void write(const std::string& val)
+    {
+        write(static_cast<sys::Uint32_T>(val.length()));
+        mBuffer.insert(mBuffer.end(), val.begin(), val.end());
+    }
+
+    void write(const six::Vector3& val)
+    {
+        write(val[0]);
+        write(val[1]);
+        write(val[2]);
+    }
+
+    void write(const six::DateTime& val)
+    {
+        write(val.getTimeInMillis());
+    }
+
+    void write(const six::Poly1D& val)
+    {
+        write(static_cast<sys::Uint32_T>(val.order()));
+        for (size_t ii = 0; ii <= val.order(); ++ii)
+        {
+            write(val[ii]);
+        }
+    }
+
+    void write(const six::Poly2D& val)
+    {
+        write(static_cast<sys::Uint32_T>(val.orderX()));
+        write(static_cast<sys::Uint32_T>(val.orderY()));
+        for (size_t ii = 0; ii <= val.orderX(); ++ii)
+        {
+            for (size_t jj = 0; jj <= val.orderY(); ++jj)
+            {
+                write(val[ii][jj]);
+            }
+        }
+    }
+
+    void write(const six::PolyXYZ& val)
+    {
+        write(static_cast<sys::Uint32_T>(val.order()));
+        for (size_t ii = 0; ii <= val.order(); ++ii)
+        {
+            write(val[ii]);
+        }
+    }
+
+    void write(const six::DecorrType& val)
+    {
+        write(val.corrCoefZero);
+        write(val.decorrRate);
+    }
+
+    void writeFlag(bool flag)
+    {
+        write(static_cast<sys::Uint8_T>(flag ? 1 : 0));
+    }
+
+    std::string toString() const
+    {
+        return mBuffer.empty() ? std::string() :
+                                 std::string(&mBuffer[0], mBuffer.size());
+    }
+
+private:
+    const bool mSwapBytes;
+    std::vector<sys::byte> mBuffer;
+};
+
+class StateReader
+{
+public:
+    StateReader(const std::string& state) :
+        mSwapBytes(!sys::isBigEndianSystem()),
+        mPtr(state.data()),
+        mEnd(state.data() + state.length())
+    {
+    }
+
+    template <typename T>
+    void read(T& val)
+    {
+        require(sizeof(T));
+        six::deserialize(mPtr, mSwapBytes, val);
+    }
+
+    template <typename T>
+    T read()
+    {
+        T val;
+        read(val);
+        return val;
+    }
+
+    void read(std::string& val)
+    {
+        const size_t length = read<sys::Uint32_T>();
+        require(length);
+        val.assign(mPtr, length);
+        mPtr += length;
+    }
+
+    void read(six::Vector3& val)
+    {
+        read(val[0]);
+        read(val[1]);
+        read(val[2]);
+    }
+
+    void read(six::DateTime& val)
+    {
+        val = six::DateTime(read<double>());
+    }
+
+    void read(six::Poly1D& val)
+    {
+        const size_t order = read<sys::Uint32_T>();
+        requireCoefficients(order, sizeof(double));
+        val = six::Poly1D(order);
+        for (size_t ii = 0; ii <= order; ++ii)
+        {
+            read(val[ii]);
+        }
+    }
+
+    void read(six::Poly2D& val)
+    {
+        const size_t orderX = read<sys::Uint32_T>();
+        const size_t orderY = read<sys::Uint32_T>();
+        requireCoefficients(orderY, sizeof(double));
+        requireCoefficients(orderX, (orderY + 1) * sizeof(double));
+        val = six::Poly2D(orderX, orderY);
+        for (size_t ii = 0; ii <= orderX; ++ii)
+        {
+            for (size_t jj = 0; jj <= orderY; ++jj)
+            {
+                read(val[ii][jj]);
+            }
+        }
+    }
+
+    void read(six::PolyXYZ& val)
+    {
+        const size_t order = read<sys::Uint32_T>();
+        requireCoefficients(order, 3 * sizeof(double));
+        val = six::PolyXYZ(order);
+        for (size_t ii = 0; ii <= order; ++ii)
+        {
+            read(val[ii]);
+        }
+    }
+
+    void read(six::DecorrType& val)
+    {
+        read(val.corrCoefZero);
+        read(val.decorrRate);
+    }
+
+    bool readFlag()
+    {
+        return read<sys::Uint8_T>() != 0;
+    }
+
+    void skip(size_t numBytes)
+    {
+        require(numBytes);
+        mPtr += numBytes;
+    }
+
+    void checkEnd() const
+    {
+        if (mPtr != mEnd)
+        {
+            throw except::Exception(Ctxt(
+                    "Compact model state has " +
+                    str::toString(mEnd - mPtr) + " trailing bytes"));
+        }
+    }
+
+private:
+    void require(size_t numBytes) const
+    {
+        if (static_cast<size_t>(mEnd - mPtr) < numBytes)
+        {
+            throw except::Exception(Ctxt("Compact model state is truncated"));
+        }
+    }
+
+    // Requires order + 1 coefficients of coefSize bytes each.  The order
+    // comes from the blob, so compare by division rather than multiplying
+    // it out, which could wrap.
+    void requireCoefficients(size_t order, size_t coefSize) const
+    {
+        if (order >= static_cast<size_t>(mEnd - mPtr) / coefSize)
+        {
+            throw except::Exception(Ctxt("Compact model state is truncated"));
+        }
+    }
+
+private:
+    const bool mSwapBytes;
+    const sys::byte* mPtr;
+    const sys::byte* const mEnd;
+};
+
+void writeHeader(six::DataType dataType, StateWriter& writer)
+{
+    for (size_t ii = 0; ii < MAGIC_LENGTH; ++ii)
+    {
+        writer.write(six::CSM::CompactModelState::MAGIC[ii]);
+    }
+    writer.write(six::CSM::CompactModelState::VERSION);
+    writer.write(static_cast<sys::Int32_T>(dataType.value));
+}
+
+void readHeader(six::DataType dataType, StateReader& reader)
+{
+    // The caller has already checked the magic via isCompact()
+    reader.skip(MAGIC_LENGTH);
+
+    const sys::Uint32_T version = reader.read<sys::Uint32_T>();
+    if (version == 0 || version > six::CSM::CompactModelState::VERSION)
+    {
+        throw except::Exception(Ctxt(
+                "Unsupported compact model state version " +
+                str::toString(version)));
+    }
+
+    const six::DataType stateType(reader.read<sys::Int32_T>());
+    if (stateType != dataType)
+    {
+        throw except::Exception(Ctxt(
+                "Compact model state holds " + stateType.toString() +
+                " data, not " + dataType.toString()));
+    }
+}
+
+// Everything six::getErrors() reads.  The additional parameters are dropped.
+void writeErrorStatistics(const six::ErrorStatistics* errorStats,
+                          StateWriter& writer)
+{
+    writer.writeFlag(errorStats != NULL);
+    if (!errorStats)
+    {
+        return;
+    }
+
+    const six::CompositeSCP* const compositeSCP =
+            errorStats->compositeSCP.get();
+    writer.writeFlag(compositeSCP != NULL);
+    if (compositeSCP)
+    {
+        writer.write(static_cast<sys::Int32_T>(compositeSCP->scpType));
+        writer.write(compositeSCP->xErr);
+        writer.write(compositeSCP->yErr);
+        writer.write(compositeSCP->xyErr);
+    }
+
+    const six::Components* const components = errorStats->components.get();
+    writer.writeFlag(components != NULL);
+    if (!components)
+    {
+        return;
+    }
+
+    const six::PosVelError* const posVelError =
+            components->posVelError.get();
+    writer.writeFlag(posVelError != NULL);
+    if (posVelError)
+    {
+        writer.write(static_cast<sys::Int32_T>(posVelError->frame.mValue));
+        writer.write(posVelError->p1);
+        writer.write(posVelError->p2);
+        writer.write(posVelError->p3);
+        writer.write(posVelError->v1);
+        writer.write(posVelError->v2);
+        writer.write(posVelError->v3);
+
+        const six::CorrCoefs* const corrCoefs = posVelError->corrCoefs.get();
+        writer.writeFlag(corrCoefs != NULL);
+        if (corrCoefs)
+        {
+            writer.write(corrCoefs->p1p2);
+            writer.write(corrCoefs->p1p3);
+            writer.write(corrCoefs->p1v1);
+            writer.write(corrCoefs->p1v2);
+            writer.write(corrCoefs->p1v3);
+            writer.write(corrCoefs->p2p3);
+            writer.write(corrCoefs->p2v1);
+            writer.write(corrCoefs->p2v2);
+            writer.write(corrCoefs->p2v3);
+            writer.write(corrCoefs->p3v1);
+            writer.write(corrCoefs->p3v2);
+            writer.write(corrCoefs->p3v3);
+            writer.write(corrCoefs->v1v2);
+            writer.write(corrCoefs->v1v3);
+            writer.write(corrCoefs->v2v3);
+        }
+        writer.write(posVelError->positionDecorr);
+    }
+
+    const six::RadarSensor* const radarSensor =
+            components->radarSensor.get();
+    writer.writeFlag(radarSensor != NULL);
+    if (radarSensor)
+    {
+        writer.write(radarSensor->rangeBias);
+        writer.write(radarSensor->clockFreqSF);
+        writer.write(radarSensor->transmitFreqSF);
+        writer.write(radarSensor->rangeBiasDecorr);
+    }
+
+    const six::TropoError* const tropoError = components->tropoError.get();
+    writer.writeFlag(tropoError != NULL);
+    if (tropoError)
+    {
+        writer.write(tropoError->tropoRangeVertical);
+        writer.write(tropoError->tropoRangeSlant);
+        writer.write(tropoError->tropoRangeDecorr);
+    }
+
+    const six::IonoError* const ionoError = components->ionoError.get();
+    writer.writeFlag(ionoError != NULL);
+    if (ionoError)
+    {
+        writer.write(ionoError->ionoRangeVertical);
+        writer.write(ionoError->ionoRangeRateVertical);
+        writer.write(ionoError->ionoRgRgRateCC);
+        writer.write(ionoError->ionoRangeVertDecorr);
+    }
+}
+
+void readErrorStatistics(StateReader& reader,
+                         mem::ScopedCopyablePtr<six::ErrorStatistics>& out)
+{
+    if (!reader.readFlag())
+    {
+        out.reset();
+        return;
+    }
+
+    out.reset(new six::ErrorStatistics());
+    six::ErrorStatistics& errorStats(*out);
+
+    if (reader.readFlag())
+    {
+        errorStats.compositeSCP.reset(new six::CompositeSCP(
+                static_cast<six::CompositeSCP::SCPType>(
+                        reader.read<sys::Int32_T>())));
+        reader.read(errorStats.compositeSCP->xErr);
+        reader.read(errorStats.compositeSCP->yErr);
+        reader.read(errorStats.compositeSCP->xyErr);
+    }
+
+    if (!reader.readFlag())
+    {
+        return;
+    }
+    errorStats.components.reset(new six::Components());
+    six::Components& components(*errorStats.components);
+
+    if (reader.readFlag())
+    {
+        components.posVelError.reset(new six::PosVelError());
+        six::PosVelError& posVelError(*components.posVelError);
+        posVelError.frame = six::FrameType(
+                static_cast<six::FrameType::FrameTypesEnum>(
+                        reader.read<sys::Int32_T>()));
+        reader.read(posVelError.p1);
+        reader.read(posVelError.p2);
+        reader.read(posVelError.p3);
+        reader.read(posVelError.v1);
+        reader.read(posVelError.v2);
+        reader.read(posVelError.v3);
+
+        if (reader.readFlag())
+        {
+            posVelError.corrCoefs.reset(new six::CorrCoefs());
+            six::CorrCoefs& corrCoefs(*posVelError.corrCoefs);
+            reader.read(corrCoefs.p1p2);
+            reader.read(corrCoefs.p1p3);
+            reader.read(corrCoefs.p1v1);
+            reader.read(corrCoefs.p1v2);
+            reader.read(corrCoefs.p1v3);
+            reader.read(corrCoefs.p2p3);
+            reader.read(corrCoefs.p2v1);
+            reader.read(corrCoefs.p2v2);
+            reader.read(corrCoefs.p2v3);
+            reader.read(corrCoefs.p3v1);
+            reader.read(corrCoefs.p3v2);
+            reader.read(corrCoefs.p3v3);
+            reader.read(corrCoefs.v1v2);
+            reader.read(corrCoefs.v1v3);
+            reader.read(corrCoefs.v2v3);
+        }
+        reader.read(posVelError.positionDecorr);
+    }
+
+    if (reader.readFlag())
+    {
+        components.radarSensor.reset(new six::RadarSensor());
+        six::RadarSensor& radarSensor(*components.radarSensor);
+        reader.read(radarSensor.rangeBias);
+        reader.read(radarSensor.clockFreqSF);
+        reader.read(radarSensor.transmitFreqSF);
+        reader.read(radarSensor.rangeBiasDecorr);
+    }
+
+    if (reader.readFlag())
+    {
+        components.tropoError.reset(new six::TropoError());
+        six::TropoError& tropoError(*components.tropoError);
+        reader.read(tropoError.tropoRangeVertical);
+        reader.read(tropoError.tropoRangeSlant);
+        reader.read(tropoError.tropoRangeDecorr);
+    }
+
+    if (reader.readFlag())
+    {
+        components.ionoError.reset(new six::IonoError());
+        six::IonoError& ionoError(*components.ionoError);
+        reader.read(ionoError.ionoRangeVertical);
+        reader.read(ionoError.ionoRangeRateVertical);
+        reader.read(ionoError.ionoRgRgRateCC);
+        reader.read(ionoError.ionoRangeVertDecorr);
+    }
+}
+
+void writeRowCol(const six::RowColInt& val, StateWriter& writer)
+{
+    writer.write(static_cast<sys::Int64_T>(val.row));
+    writer.write(static_cast<sys::Int64_T>(val.col));
+}
+
+void readRowCol(StateReader& reader, six::RowColInt& val)
+{
+    val.row = static_cast<sys::SSize_T>(reader.read<sys::Int64_T>());
+    val.col = static_cast<sys::SSize_T>(reader.read<sys::Int64_T>());
+}
+
+void writeRowCol(const six::RowColDouble& val, StateWriter& writer)
+{
+    writer.write(val.row);
+    writer.write(val.col);
+}
+
+void readRowCol(StateReader& reader, six::RowColDouble& val)
+{
+    reader.read(val.row);
+    reader.read(val.col);
+}
+}
+
+namespace six
+{
+namespace CSM
+{
+const char CompactModelState::MAGIC[] = "SIXCMS";
+const sys::Uint32_T CompactModelState::VERSION = 1;
+
+bool CompactModelState::isCompact(const std::string& state)
+{
+    return state.length() >= MAGIC_LENGTH &&
+           ::memcmp(state.data(), MAGIC, MAGIC_LENGTH) == 0;
+}
+
+std::string CompactModelState::encode(const six::sicd::ComplexData& data)
+{
+    StateWriter writer;
+    writeHeader(six::DataType::COMPLEX, writer);
+
+    writer.write(data.collectionInformation->coreName);
+    writer.write(data.collectionInformation->collectorName);
+    writer.write(static_cast<sys::Int32_T>(
+            data.collectionInformation->radarMode.value));
+    writer.write(data.timeline->collectStart);
+
+    const six::sicd::ImageData& imageData(*data.imageData);
+    writer.write(static_cast<sys::Uint64_T>(imageData.numRows));
+    writer.write(static_cast<sys::Uint64_T>(imageData.numCols));
+    writer.write(static_cast<sys::Uint64_T>(imageData.firstRow));
+    writer.write(static_cast<sys::Uint64_T>(imageData.firstCol));
+    writeRowCol(imageData.scpPixel, writer);
+
+    writer.write(data.geoData->scp.ecf);
+    writer.write(data.geoData->scp.llh.getLat());
+    writer.write(data.geoData->scp.llh.getLon());
+    writer.write(data.geoData->scp.llh.getAlt());
+
+    const six::sicd::Grid& grid(*data.grid);
+    writer.write(static_cast<sys::Int32_T>(grid.type.value));
+    writer.write(grid.timeCOAPoly);
+    writer.write(grid.row->unitVector);
+    writer.write(grid.row->sampleSpacing);
+    writer.write(grid.col->unitVector);
+    writer.write(grid.col->sampleSpacing);
+
+    writer.write(data.position->arpPoly);
+    writer.write(data.scpcoa->arpPos);
+    writer.write(data.scpcoa->arpVel);
+    writer.write(static_cast<sys::Int32_T>(data.scpcoa->sideOfTrack.value));
+
+    const six::sicd::PFA* const pfa = data.pfa.get();
+    writer.writeFlag(pfa != NULL);
+    if (pfa)
+    {
+        writer.write(pfa->polarAnglePoly);
+        writer.write(pfa->spatialFrequencyScaleFactorPoly);
+    }
+
+    const six::sicd::INCA* const inca =
+            data.rma.get() ? data.rma->inca.get() : NULL;
+    writer.writeFlag(inca != NULL);
+    if (inca)
+    {
+        writer.write(inca->timeCAPoly);
+        writer.write(inca->dopplerRateScaleFactorPoly);
+        writer.write(inca->rangeCA);
+    }
+
+    writeErrorStatistics(data.errorStatistics.get(), writer);
+    return writer.toString();
+}
+
+std::auto_ptr<six::sicd::ComplexData>
+CompactModelState::decodeComplexData(const std::string& state)
+{
+    StateReader reader(state);
+    readHeader(six::DataType::COMPLEX, reader);
+
+    std::auto_ptr<six::sicd::ComplexData> data(new six::sicd::ComplexData());
+
+    reader.read(data->collectionInformation->coreName);
+    reader.read(data->collectionInformation->collectorName);
+    data->collectionInformation->radarMode =
+            six::RadarModeType(reader.read<sys::Int32_T>());
+    reader.read(data->timeline->collectStart);
+
+    six::sicd::ImageData& imageData(*data->imageData);
+    imageData.numRows = static_cast<size_t>(reader.read<sys::Uint64_T>());
+    imageData.numCols = static_cast<size_t>(reader.read<sys::Uint64_T>());
+    imageData.firstRow = static_cast<size_t>(reader.read<sys::Uint64_T>());
+    imageData.firstCol = static_cast<size_t>(reader.read<sys::Uint64_T>());
+    readRowCol(reader, imageData.scpPixel);
+
+    reader.read(data->geoData->scp.ecf);
+    data->geoData->scp.llh.setLat(reader.read<double>());
+    data->geoData->scp.llh.setLon(reader.read<double>());
+    data->geoData->scp.llh.setAlt(reader.read<double>());
+
+    six::sicd::Grid& grid(*data->grid);
+    grid.type = six::ComplexImageGridType(reader.read<sys::Int32_T>());
+    reader.read(grid.timeCOAPoly);
+    reader.read(grid.row->unitVector);
+    reader.read(grid.row->sampleSpacing);
+    reader.read(grid.col->unitVector);
+    reader.read(grid.col->sampleSpacing);
+
+    reader.read(data->position->arpPoly);
+    reader.read(data->scpcoa->arpPos);
+    reader.read(data->scpcoa->arpVel);
+    data->scpcoa->sideOfTrack =
+            six::SideOfTrackType(reader.read<sys::Int32_T>());
+
+    if (reader.readFlag())
+    {
+        data->pfa.reset(new six::sicd::PFA());
+        reader.read(data->pfa->polarAnglePoly);
+        reader.read(data->pfa->spatialFrequencyScaleFactorPoly);
+    }
+
+    if (reader.readFlag())
+    {
+        data->rma.reset(new six::sicd::RMA());
+        data->rma->inca.reset(new six::sicd::INCA());
+        reader.read(data->rma->inca->timeCAPoly);
+        reader.read(data->rma->inca->dopplerRateScaleFactorPoly);
+        reader.read(data->rma->inca->rangeCA);
+    }
+
+    readErrorStatistics(reader, data->errorStatistics);
+    reader.checkEnd();
+    return data;
+}
+
+std::string CompactModelState::encode(const six::sidd::DerivedData& data)
+{
+    const six::sidd::Projection& projection(*data.measurement->projection);
+    if (projection.projectionType != six::ProjectionType::PLANE &&
+        projection.projectionType != six::ProjectionType::GEOGRAPHIC)
+    {
+        throw except::Exception(Ctxt(
+                "Compact model state doesn't support " +
+                projection.projectionType.toString() + " projections"));
+    }
+    const six::sidd::MeasurableProjection& measurable(
+            static_cast<const six::sidd::MeasurableProjection&>(projection));
+
+    StateWriter writer;
+    writeHeader(six::DataType::DERIVED, writer);
+
+    writer.write(data.productCreation->productName);
+
+    const bool hasCollection = data.exploitationFeatures.get() &&
+            !data.exploitationFeatures->collections.empty();
+    writer.writeFlag(hasCollection);
+    if (hasCollection)
+    {
+        const six::sidd::Collection& collection(
+                *data.exploitationFeatures->collections[0]);
+        writer.write(collection.identifier);
+        writer.write(collection.information->sensorName);
+        writer.write(static_cast<sys::Int32_T>(
+                collection.information->radarMode.value));
+        writer.write(collection.information->collectionDateTime);
+        writer.write(collection.information->collectionDuration);
+    }
+
+    writer.write(static_cast<sys::Int32_T>(projection.projectionType.value));
+    writeRowCol(data.measurement->pixelFootprint, writer);
+    writer.write(data.measurement->arpPoly);
+    writer.write(measurable.referencePoint.ecef);
+    writeRowCol(measurable.referencePoint.rowCol, writer);
+    writeRowCol(measurable.sampleSpacing, writer);
+    writer.write(measurable.timeCOAPoly);
+    if (projection.projectionType == six::ProjectionType::PLANE)
+    {
+        const six::sidd::PlaneProjection& plane(
+                static_cast<const six::sidd::PlaneProjection&>(projection));
+        writer.write(plane.productPlane.rowUnitVector);
+        writer.write(plane.productPlane.colUnitVector);
+    }
+
+    const six::sidd::GeometricChip* const chip =
+            data.downstreamReprocessing.get() ?
+                    data.downstreamReprocessing->geometricChip.get() : NULL;
+    writer.writeFlag(chip != NULL);
+    if (chip)
+    {
+        writeRowCol(chip->chipSize, writer);
+        writeRowCol(chip->originalUpperLeftCoordinate, writer);
+        writeRowCol(chip->originalUpperRightCoordinate, writer);
+        writeRowCol(chip->originalLowerLeftCoordinate, writer);
+        writeRowCol(chip->originalLowerRightCoordinate, writer);
+    }
+
+    writeErrorStatistics(data.errorStatistics.get(), writer);
+    return writer.toString();
+}
+
+std::auto_ptr<six::sidd::DerivedData>
+CompactModelState::decodeDerivedData(const std::string& state)
+{
+    StateReader reader(state);
+    readHeader(six::DataType::DERIVED, reader);
+
+    std::auto_ptr<six::sidd::DerivedData> data(new six::sidd::DerivedData());
+
+    reader.read(data->productCreation->productName);
+
+    if (reader.readFlag())
+    {
+        data->exploitationFeatures.reset(
+                new six::sidd::ExploitationFeatures(1));
+        six::sidd::Collection& collection(
+                *data->exploitationFeatures->collections[0]);
+        reader.read(collection.identifier);
+        reader.read(collection.information->sensorName);
+        collection.information->radarMode =
+                six::RadarModeType(reader.read<sys::Int32_T>());
+        reader.read(collection.information->collectionDateTime);
+        reader.read(collection.information->collectionDuration);
+    }
+
+    const six::ProjectionType projectionType(reader.read<sys::Int32_T>());
+    if (projectionType != six::ProjectionType::PLANE &&
+        projectionType != six::ProjectionType::GEOGRAPHIC)
+    {
+        throw except::Exception(Ctxt(
+                "Compact model state doesn't support " +
+                projectionType.toString() + " projections"));
+    }
+
+    data->measurement.reset(new six::sidd::Measurement(projectionType));
+    readRowCol(reader, data->measurement->pixelFootprint);
+    reader.read(data->measurement->arpPoly);
+
+    six::sidd::MeasurableProjection& measurable(
+            static_cast<six::sidd::MeasurableProjection&>(
+                    *data->measurement->projection));
+    reader.read(measurable.referencePoint.ecef);
+    readRowCol(reader, measurable.referencePoint.rowCol);
+    readRowCol(reader, measurable.sampleSpacing);
+    reader.read(measurable.timeCOAPoly);
+    if (projectionType == six::ProjectionType::PLANE)
+    {
+        six::sidd::PlaneProjection& plane(
+                static_cast<six::sidd::PlaneProjection&>(measurable));
+        reader.read(plane.productPlane.rowUnitVector);
+        reader.read(plane.productPlane.colUnitVector);
+    }
+
+    if (reader.readFlag())
+    {
+        data->downstreamReprocessing.reset(
+                new six::sidd::DownstreamReprocessing());
+        data->downstreamReprocessing->geometricChip.reset(
+                new six::sidd::GeometricChip());
+        six::sidd::GeometricChip& chip(
+                *data->downstreamReprocessing->geometricChip);
+        readRowCol(reader, chip.chipSize);
+        readRowCol(reader, chip.originalUpperLeftCoordinate);
+        readRowCol(reader, chip.originalUpperRightCoordinate);
+        readRowCol(reader, chip.originalLowerLeftCoordinate);
+        readRowCol(reader, chip.originalLowerRightCoordinate);
+    }
+
+    readErrorStatistics(reader, data->errorStatistics);
+    reader.checkEnd();
+    return data;
+}
+}
+}
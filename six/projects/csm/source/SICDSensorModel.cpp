@@ -30,6 +30,7 @@
 #include <six/NITFReadControl.h>
 #include <six/sicd/ComplexXMLControl.h>
 #include <six/sicd/Utilities.h>
+#include <six/csm/CompactModelState.h>
 
 namespace six
 {
@@ -311,6 +312,20 @@ std::string SICDSensorModel::getSensorMode() const
     }
 }
 
+std::string SICDSensorModel::getCompactModelState() const
+{
+    try
+    {
+        return NAME + std::string(" ") + CompactModelState::encode(*mData);
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SICDSensorModel::getCompactModelState");
+    }
+}
+
 six::DateTime SICDSensorModel::getReferenceDateAndTimeImpl() const
 {
     return mData->timeline->collectStart;
@@ -405,12 +420,20 @@ void SICDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
                            "SICDSensorModel::replaceModelStateImpl");
     }
 
-    const std::string sensorModelXML = sensorModelState.substr(idx + 1);
+    const std::string sensorModelData = sensorModelState.substr(idx + 1);
 
     try
     {
+        if (CompactModelState::isCompact(sensorModelData))
+        {
+            mData = CompactModelState::decodeComplexData(sensorModelData);
+            mSensorModelState = sensorModelState;
+            reinitialize();
+            return;
+        }
+
         io::StringStream stream;
-        stream.write(sensorModelXML.c_str(), sensorModelXML.length());
+        stream.write(sensorModelData.c_str(), sensorModelData.length());
 
         xml::lite::MinidomParser domParser;
         domParser.parse(stream);
@@ -30,6 +30,7 @@
 #include <six/NITFReadControl.h>
 #include <six/sidd/DerivedXMLControl.h>
 #include <six/sidd/Utilities.h>
+#include <six/csm/CompactModelState.h>
 
 namespace six
 {
@@ -330,6 +331,20 @@ std::string SIDDSensorModel::getSensorMode() const
     }
 }
 
+std::string SIDDSensorModel::getCompactModelState() const
+{
+    try
+    {
+        return NAME + std::string(" ") + CompactModelState::encode(*mData);
+    }
+    catch (const except::Exception& ex)
+    {
+        throw csm::Error(csm::Error::UNKNOWN_ERROR,
+                           ex.getMessage(),
+                           "SIDDSensorModel::getCompactModelState");
+    }
+}
+
 six::DateTime SIDDSensorModel::getReferenceDateAndTimeImpl() const
 {
     // TODO: If there's more than one collection, what should we use?
@@ -410,12 +425,20 @@ void SIDDSensorModel::replaceModelStateImpl(const std::string& sensorModelState)
                            "SIDDSensorModel::replaceModelStateImpl");
     }
 
-    const std::string sensorModelXML = sensorModelState.substr(idx + 1);
+    const std::string sensorModelData = sensorModelState.substr(idx + 1);
 
     try
     {
+        if (CompactModelState::isCompact(sensorModelData))
+        {
+            mData = CompactModelState::decodeDerivedData(sensorModelData);
+            mSensorModelState = sensorModelState;
+            reinitialize();
+            return;
+        }
+
         io::StringStream stream;
-        stream.write(sensorModelXML.c_str(), sensorModelXML.length());
+        stream.write(sensorModelData.c_str(), sensorModelData.length());
 
         xml::lite::MinidomParser domParser;
         domParser.parse(stream);
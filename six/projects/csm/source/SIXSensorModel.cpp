@@ -20,10 +20,16 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
 
 #include "Error.h"
+#include <mt/CriticalSection.h>
+#include <mt/ThreadPlanner.h>
+#include <sys/OS.h>
+#include <tasks/TaskScheduler.h>
 #include <six/NITFReadControl.h>
 #include <six/csm/SIXSensorModel.h>
 
@@ -41,6 +47,16 @@ double cube(double val)
     return (val * val * val);
 }
 
+// Below this many points per chunk, handing off to the pool costs more than
+// it saves
+const size_t MIN_BULK_POINTS_PER_THREAD = 64;
+
+// Exact comparison - memoized results are only reused for the same point
+bool isSamePoint(const scene::Vector3& lhs, const scene::Vector3& rhs)
+{
+    return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
+}
+
 math::linear::MatrixMxN<3, 3>
 pseudoInverse(const math::linear::MatrixMxN<3, 3>& m)
 {
@@ -129,19 +145,22 @@ namespace CSM
 {
 const char SIXSensorModel::FAMILY[] = CSM_GEOMETRIC_MODEL_FAMILY CSM_RASTER_FAMILY;
 
-SIXSensorModel::SIXSensorModel()
+SIXSensorModel::SIXSensorModel() :
+    mUseAnalyticPartials(true),
+    mUseCompactModelState(false)
 {
 }
 
 std::string SIXSensorModel::getModelState() const
 {
-    return mSensorModelState;
+    return mUseCompactModelState ? getCompactModelState() : mSensorModelState;
 }
 
 void SIXSensorModel::replaceModelState(const std::string& argState)
 {
     if (!argState.empty())
     {
+        clearPartialsMemo();
         replaceModelStateImpl(argState);
     }
 }
@@ -456,8 +475,7 @@ csm::RasterGM::SensorPartials SIXSensorModel::computeSensorPartials(
         const types::RowCol<double> pixelPt = fromPixel(imagePt);
 
         const math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(sceneGroundPt,
-                                                        pixelPt);
+                getSensorPartials(sceneGroundPt, pixelPt);
 
         // TODO: Currently no way to determine the actual precision that was
         //       achieved, so setting it to the desired precision
@@ -525,8 +543,7 @@ SIXSensorModel::computeAllSensorPartials(
 
         const types::RowCol<double> pixelPt = fromPixel(imagePt);
         const math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(sceneGroundPt,
-                                                        pixelPt);
+                getSensorPartials(sceneGroundPt, pixelPt);
 
         // TODO: Currently no way to determine the actual precision that was
         //       achieved, so setting it to the desired precision
@@ -555,6 +572,82 @@ SIXSensorModel::computeAllSensorPartials(
     }
 }
 
+math::linear::MatrixMxN<2, 7>
+SIXSensorModel::getSensorPartials(const scene::Vector3& groundPt,
+                                  const types::RowCol<double>& imageGridPt) const
+{
+    // Only the memo is guarded so concurrent callers don't serialize on the
+    // projection itself
+    const scene::AdjustableParams params(mProjection->getAdjustableParams());
+    {
+        mt::CriticalSection<sys::Mutex> guard(&mPartialsMutex);
+        if (mPartialsMemo.isValid &&
+            isSamePoint(mPartialsMemo.groundPt, groundPt) &&
+            mPartialsMemo.imageGridPt.row == imageGridPt.row &&
+            mPartialsMemo.imageGridPt.col == imageGridPt.col &&
+            std::equal(params.mParams,
+                       params.mParams + scene::AdjustableParams::NUM_PARAMS,
+                       mPartialsMemo.params.mParams))
+        {
+            return mPartialsMemo.partials;
+        }
+    }
+
+    math::linear::MatrixMxN<2, 7> partials;
+    bool haveAnalyticPartials = false;
+    if (mUseAnalyticPartials)
+    {
+        try
+        {
+            partials = mProjection->sceneToImageSensorPartialsAnalytic(
+                    groundPt, imageGridPt);
+            haveAnalyticPartials = true;
+        }
+        catch (const except::Exception&)
+        {
+            // Degenerate geometry - finite differences may still work
+        }
+    }
+    if (!haveAnalyticPartials)
+    {
+        partials = mProjection->sceneToImageSensorPartials(groundPt,
+                                                           imageGridPt);
+    }
+
+    mt::CriticalSection<sys::Mutex> guard(&mPartialsMutex);
+    mPartialsMemo.groundPt = groundPt;
+    mPartialsMemo.imageGridPt = imageGridPt;
+    mPartialsMemo.params = params;
+    mPartialsMemo.partials = partials;
+    mPartialsMemo.isValid = true;
+    return partials;
+}
+
+math::linear::MatrixMxN<2, 3>
+SIXSensorModel::getGroundPartials(const scene::Vector3& groundPt,
+                                  const types::RowCol<double>& imageGridPt) const
+{
+    if (mUseAnalyticPartials)
+    {
+        try
+        {
+            return mProjection->sceneToImagePartialsAnalytic(groundPt,
+                                                             imageGridPt);
+        }
+        catch (const except::Exception&)
+        {
+            // Degenerate geometry - finite differences may still work
+        }
+    }
+    return mProjection->sceneToImagePartials(groundPt, imageGridPt);
+}
+
+void SIXSensorModel::clearPartialsMemo() const
+{
+    mt::CriticalSection<sys::Mutex> guard(&mPartialsMutex);
+    mPartialsMemo.isValid = false;
+}
+
 csm::EcefCoord SIXSensorModel::getReferencePoint() const
 {
     return toEcefCoord(mGeometry->getReferencePosition());
@@ -664,6 +757,51 @@ csm::ImageCoord SIXSensorModel::groundToImage(
     }
 }
 
+csm::ImageCoordCovar SIXSensorModel::groundToImageCovarImpl(
+        const csm::EcefCoordCovar& groundPt,
+        double desiredPrecision,
+        double* achievedPrecision) const
+{
+    const csm::ImageCoord imagePt = groundToImageImpl(groundPt,
+                                                      desiredPrecision,
+                                                      achievedPrecision);
+    const scene::Vector3 scenePt(toVector3(groundPt));
+    types::RowCol<double> pixelPt(fromPixel(imagePt));
+    // m^2
+    // NOTE: See mSensorCovariance member variable definition in header
+    //       for why we're not computing the sensor covariance for this
+    //       point
+    const math::linear::MatrixMxN<3, 3> userCovar(groundPt.covariance);
+    const math::linear::MatrixMxN<2, 7> sensorPartials =
+            getSensorPartials(scenePt, pixelPt);
+    const math::linear::MatrixMxN<2, 3> imagePartials =
+            getGroundPartials(scenePt, pixelPt);
+    const math::linear::MatrixMxN<2, 2> unmodeledCovar =
+            mProjection->getUnmodeledErrorCovariance(pixelPt);
+    const math::linear::MatrixMxN<2, 2> errorCovar =
+            unmodeledCovar +
+            (imagePartials * userCovar * imagePartials.transpose()) +
+            (sensorPartials * mSensorCovariance *
+             sensorPartials.transpose());
+    csm::ImageCoordCovar csmErrorCovar;
+    types::RowCol<double> ss = getSampleSpacing();
+    csmErrorCovar.line = imagePt.line;
+    csmErrorCovar.samp = imagePt.samp;
+    csmErrorCovar.covariance[0] =
+            errorCovar[0][0] / (ss.row * ss.row);
+    csmErrorCovar.covariance[1] =
+            errorCovar[0][1] /
+            (ss.row *
+             ss.col);
+    csmErrorCovar.covariance[2] =
+            errorCovar[1][0] /
+            (ss.row *
+             ss.col);
+    csmErrorCovar.covariance[3] =
+            errorCovar[1][1] / (ss.col * ss.col);
+    return csmErrorCovar;
+}
+
 csm::ImageCoordCovar SIXSensorModel::groundToImage(
         const csm::EcefCoordCovar& groundPt,
         double desiredPrecision,
@@ -672,44 +810,9 @@ csm::ImageCoordCovar SIXSensorModel::groundToImage(
 {
     try
     {
-        const csm::ImageCoord imagePt = groundToImageImpl(groundPt,
-                                                          desiredPrecision,
-                                                          achievedPrecision);
-        const scene::Vector3 scenePt(toVector3(groundPt));
-        types::RowCol<double> pixelPt(fromPixel(imagePt));
-        // m^2
-        // NOTE: See mSensorCovariance member variable definition in header
-        //       for why we're not computing the sensor covariance for this
-        //       point
-        const math::linear::MatrixMxN<3, 3> userCovar(groundPt.covariance);
-        const math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(scenePt);
-        const math::linear::MatrixMxN<2, 3> imagePartials =
-                mProjection->sceneToImagePartials(scenePt);
-        const math::linear::MatrixMxN<2, 2> unmodeledCovar =
-                mProjection->getUnmodeledErrorCovariance(pixelPt);
-        const math::linear::MatrixMxN<2, 2> errorCovar =
-                unmodeledCovar +
-                (imagePartials * userCovar * imagePartials.transpose()) +
-                (sensorPartials * mSensorCovariance *
-                 sensorPartials.transpose());
-        csm::ImageCoordCovar csmErrorCovar;
-        types::RowCol<double> ss = getSampleSpacing();
-        csmErrorCovar.line = imagePt.line;
-        csmErrorCovar.samp = imagePt.samp;
-        csmErrorCovar.covariance[0] =
-                errorCovar[0][0] / (ss.row * ss.row);
-        csmErrorCovar.covariance[1] =
-                errorCovar[0][1] /
-                (ss.row *
-                 ss.col);
-        csmErrorCovar.covariance[2] =
-                errorCovar[1][0] /
-                (ss.row *
-                 ss.col);
-        csmErrorCovar.covariance[3] =
-                errorCovar[1][1] / (ss.col * ss.col);
-        return csmErrorCovar;
+        return groundToImageCovarImpl(groundPt,
+                                      desiredPrecision,
+                                      achievedPrecision);
     }
     catch (const except::Exception& ex)
     {
@@ -719,6 +822,29 @@ csm::ImageCoordCovar SIXSensorModel::groundToImage(
     }
 }
 
+csm::EcefCoord SIXSensorModel::imageToGroundImpl(
+        const csm::ImageCoord& imagePt,
+        double height,
+        double desiredPrecision,
+        double* achievedPrecision) const
+{
+    const types::RowCol<double> imagePtMeters = fromPixel(imagePt);
+
+    // TODO: imageToScene() supports specifying a height threshold in
+    //       meters but it's not obvious how to convert that to a desired
+    //       precision in pixels.  Likewise, not clear how to determine
+    //       the achieved precision in pixels afterwards.
+    const scene::Vector3 groundPt =
+            mProjection->imageToScene(imagePtMeters, height);
+
+    if (achievedPrecision)
+    {
+        *achievedPrecision = desiredPrecision;
+    }
+
+    return toEcefCoord(groundPt);
+}
+
 csm::EcefCoord SIXSensorModel::imageToGround(
         const csm::ImageCoord& imagePt,
         double height,
@@ -728,21 +854,10 @@ csm::EcefCoord SIXSensorModel::imageToGround(
 {
     try
     {
-        const types::RowCol<double> imagePtMeters = fromPixel(imagePt);
-
-        // TODO: imageToScene() supports specifying a height threshold in
-        //       meters but it's not obvious how to convert that to a desired
-        //       precision in pixels.  Likewise, not clear how to determine
-        //       the achieved precision in pixels afterwards.
-        const scene::Vector3 groundPt =
-                mProjection->imageToScene(imagePtMeters, height);
-
-        if (achievedPrecision)
-        {
-            *achievedPrecision = desiredPrecision;
-        }
-
-        return toEcefCoord(groundPt);
+        return imageToGroundImpl(imagePt,
+                                 height,
+                                 desiredPrecision,
+                                 achievedPrecision);
     }
     catch (const except::Exception& ex)
     {
@@ -752,92 +867,105 @@ csm::EcefCoord SIXSensorModel::imageToGround(
     }
 }
 
-csm::EcefCoordCovar SIXSensorModel::imageToGround(
+csm::EcefCoordCovar SIXSensorModel::imageToGroundCovarImpl(
         const csm::ImageCoordCovar& imagePt,
         double height,
         double heightVariance,
         double desiredPrecision,
-        double* achievedPrecision,
-        csm::WarningList* warnings) const
+        double* achievedPrecision) const
 {
-    try
-    {
-        const csm::EcefCoord groundPt = imageToGround(imagePt,
+    const csm::EcefCoord groundPt = imageToGroundImpl(imagePt,
                                                       height,
                                                       desiredPrecision,
-                                                      achievedPrecision,
-                                                      warnings);
-
-        const double a = scene::WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS;
-        const double b = scene::WGS84EllipsoidModel::POLAR_RADIUS_METERS;
-        const scene::Vector3 scenePt(toVector3(groundPt));
-        types::RowCol<double> pixelPt(fromPixel((csm::ImageCoord&) imagePt));
-
-        // NOTE: See mSensorCovariance member variable definition in header
-        //       for why we're not computing the sensor covariance for this
-        //       point
-        const math::linear::MatrixMxN<2, 2> userCovar(imagePt.covariance);
-        math::linear::MatrixMxN<2, 2> unmodeledCovar =
-                mProjection->getUnmodeledErrorCovariance(pixelPt);
-        math::linear::MatrixMxN<2, 3> groundPartials =
-                mProjection->sceneToImagePartials(scenePt);
-        math::linear::MatrixMxN<2, 7> sensorPartials =
-                mProjection->sceneToImageSensorPartials(scenePt);
-
-        math::linear::MatrixMxN<10, 10> fullCovar(0.0);
-        unmodeledCovar = unmodeledCovar + userCovar;
-        fullCovar.addInPlace(unmodeledCovar, 0, 0);
-        fullCovar[2][2] = heightVariance;
-        fullCovar.addInPlace(mSensorCovariance, 3, 3);
-        types::RowCol<double> ss = getSampleSpacing();
-        for (size_t ii = 0; ii < 3; ++ii)
-        {
-            groundPartials[0][ii] /= ss.row;
-            groundPartials[1][ii] /= ss.col;
-        }
+                                                      achievedPrecision);
+
+    const double a = scene::WGS84EllipsoidModel::EQUATORIAL_RADIUS_METERS;
+    const double b = scene::WGS84EllipsoidModel::POLAR_RADIUS_METERS;
+    const scene::Vector3 scenePt(toVector3(groundPt));
+    types::RowCol<double> pixelPt(fromPixel((csm::ImageCoord&) imagePt));
+
+    // NOTE: See mSensorCovariance member variable definition in header
+    //       for why we're not computing the sensor covariance for this
+    //       point
+    const math::linear::MatrixMxN<2, 2> userCovar(imagePt.covariance);
+    math::linear::MatrixMxN<2, 2> unmodeledCovar =
+            mProjection->getUnmodeledErrorCovariance(pixelPt);
+    math::linear::MatrixMxN<2, 3> groundPartials =
+            getGroundPartials(scenePt, pixelPt);
+    math::linear::MatrixMxN<2, 7> sensorPartials =
+            getSensorPartials(scenePt, pixelPt);
+
+    math::linear::MatrixMxN<10, 10> fullCovar(0.0);
+    unmodeledCovar = unmodeledCovar + userCovar;
+    fullCovar.addInPlace(unmodeledCovar, 0, 0);
+    fullCovar[2][2] = heightVariance;
+    fullCovar.addInPlace(mSensorCovariance, 3, 3);
+    types::RowCol<double> ss = getSampleSpacing();
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        groundPartials[0][ii] /= ss.row;
+        groundPartials[1][ii] /= ss.col;
+    }
 
-        for (size_t ii = 0; ii < 7; ++ii)
-        {
-            sensorPartials[0][ii] /= ss.row;
-            sensorPartials[1][ii] /= ss.col;
-        }
+    for (size_t ii = 0; ii < 7; ++ii)
+    {
+        sensorPartials[0][ii] /= ss.row;
+        sensorPartials[1][ii] /= ss.col;
+    }
 
-        math::linear::MatrixMxN<3, 3> B(0.0);
-        B.addInPlace(groundPartials, 0, 0);
-        B[2][0] = 2 * groundPt.x / square(a + height);
-        B[2][1] = 2 * groundPt.y / square(a + height);
-        B[2][2] = 2 * groundPt.z / square(b + height);
+    math::linear::MatrixMxN<3, 3> B(0.0);
+    B.addInPlace(groundPartials, 0, 0);
+    B[2][0] = 2 * groundPt.x / square(a + height);
+    B[2][1] = 2 * groundPt.y / square(a + height);
+    B[2][2] = 2 * groundPt.z / square(b + height);
 
-        math::linear::MatrixMxN<3, 10> A(0.0);
-        A[2][2] = -2.0 * ((square(groundPt.x) + square(groundPt.y)) /
-                          cube(a + height) +
-                  square(groundPt.z) / cube(b + height));
-        A.addInPlace(sensorPartials, 0, 3);
-        A[0][0] = A[1][1] = 1.0;
+    math::linear::MatrixMxN<3, 10> A(0.0);
+    A[2][2] = -2.0 * ((square(groundPt.x) + square(groundPt.y)) /
+                      cube(a + height) +
+              square(groundPt.z) / cube(b + height));
+    A.addInPlace(sensorPartials, 0, 3);
+    A[0][0] = A[1][1] = 1.0;
 
-        const math::linear::MatrixMxN<3, 3> Q = A * fullCovar * A.transpose();
+    const math::linear::MatrixMxN<3, 3> Q = A * fullCovar * A.transpose();
 
-        const math::linear::MatrixMxN<3, 3> Qinv = inverse(Q);
+    const math::linear::MatrixMxN<3, 3> Qinv = inverse(Q);
 
-        const math::linear::MatrixMxN<3, 3> imageToGroundCovarInv =
-                B.transpose() * Qinv * B;
+    const math::linear::MatrixMxN<3, 3> imageToGroundCovarInv =
+            B.transpose() * Qinv * B;
 
-        const math::linear::MatrixMxN<3, 3> errorCovar =
-                inverse(imageToGroundCovarInv);
+    const math::linear::MatrixMxN<3, 3> errorCovar =
+            inverse(imageToGroundCovarInv);
 
-        csm::EcefCoordCovar csmErrorCovar;
-        csmErrorCovar.x = groundPt.x;
-        csmErrorCovar.y = groundPt.y;
-        csmErrorCovar.z = groundPt.z;
-        for (size_t ii = 0; ii < 3; ++ii)
+    csm::EcefCoordCovar csmErrorCovar;
+    csmErrorCovar.x = groundPt.x;
+    csmErrorCovar.y = groundPt.y;
+    csmErrorCovar.z = groundPt.z;
+    for (size_t ii = 0; ii < 3; ++ii)
+    {
+        for (size_t jj = 0; jj < 3; ++jj)
         {
-            for (size_t jj = 0; jj < 3; ++jj)
-            {
-                csmErrorCovar.covariance[ii * 3 + jj] = errorCovar[ii][jj];
-            }
+            csmErrorCovar.covariance[ii * 3 + jj] = errorCovar[ii][jj];
         }
+    }
+
+    return csmErrorCovar;
+}
 
-        return csmErrorCovar;
+csm::EcefCoordCovar SIXSensorModel::imageToGround(
+        const csm::ImageCoordCovar& imagePt,
+        double height,
+        double heightVariance,
+        double desiredPrecision,
+        double* achievedPrecision,
+        csm::WarningList* ) const
+{
+    try
+    {
+        return imageToGroundCovarImpl(imagePt,
+                                      height,
+                                      heightVariance,
+                                      desiredPrecision,
+                                      achievedPrecision);
     }
     catch (const except::Exception& ex)
     {
@@ -858,6 +986,215 @@ csm::EcefLocus SIXSensorModel::imageToRemoteImagingLocus(
                        "SIXSensorModel::imageToRemoteImagingLocus");
 }
 
+SIXSensorModel::BulkPoints::BulkPoints() :
+    groundPts(NULL),
+    groundCovarPts(NULL),
+    imagePts(NULL),
+    imageCovarPts(NULL),
+    heights(NULL),
+    heightVariances(NULL),
+    imageOutput(NULL),
+    imageCovarOutput(NULL),
+    groundOutput(NULL),
+    groundCovarOutput(NULL),
+    valid(NULL)
+{
+}
+
+// Projects one contiguous chunk of the points per element
+class SIXSensorModel::BulkProjector
+{
+public:
+    BulkProjector(const SIXSensorModel& model,
+                  const BulkPoints& points,
+                  size_t numPoints,
+                  std::vector<size_t>& numFailed) :
+        mModel(model),
+        mPoints(points),
+        mPlanner(numPoints, numFailed.size()),
+        mNumFailed(numFailed)
+    {
+    }
+
+    void operator()(size_t chunk) const
+    {
+        size_t start(0);
+        size_t numPoints(0);
+        if (!mPlanner.getThreadInfo(chunk, start, numPoints))
+        {
+            return;
+        }
+
+        size_t numFailed = 0;
+        const size_t end = start + numPoints;
+        for (size_t ii = start; ii < end; ++ii)
+        {
+            if (!mModel.projectPoint(mPoints, ii))
+            {
+                ++numFailed;
+            }
+        }
+        mNumFailed[chunk] = numFailed;
+    }
+
+private:
+    const SIXSensorModel& mModel;
+    const BulkPoints& mPoints;
+    const mt::ThreadPlanner mPlanner;
+    std::vector<size_t>& mNumFailed;
+};
+
+bool SIXSensorModel::projectPoint(const BulkPoints& points, size_t index) const
+{
+    static const double DESIRED_PRECISION = 0.001;
+
+    bool valid;
+    try
+    {
+        if (points.groundPts)
+        {
+            points.imageOutput[index] = groundToImageImpl(
+                    points.groundPts[index], DESIRED_PRECISION, NULL);
+        }
+        else if (points.groundCovarPts)
+        {
+            points.imageCovarOutput[index] = groundToImageCovarImpl(
+                    points.groundCovarPts[index], DESIRED_PRECISION, NULL);
+        }
+        else if (points.imagePts)
+        {
+            points.groundOutput[index] = imageToGroundImpl(
+                    points.imagePts[index], points.heights[index],
+                    DESIRED_PRECISION, NULL);
+        }
+        else
+        {
+            points.groundCovarOutput[index] = imageToGroundCovarImpl(
+                    points.imageCovarPts[index], points.heights[index],
+                    points.heightVariances[index], DESIRED_PRECISION, NULL);
+        }
+        valid = true;
+    }
+    catch (const except::Exception& )
+    {
+        valid = false;
+    }
+    catch (const csm::Error& )
+    {
+        valid = false;
+    }
+
+    if (!valid)
+    {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        if (points.imageOutput)
+        {
+            points.imageOutput[index] = csm::ImageCoord(nan, nan);
+        }
+        else if (points.imageCovarOutput)
+        {
+            points.imageCovarOutput[index] =
+                    csm::ImageCoordCovar(nan, nan, nan, nan, nan);
+        }
+        else if (points.groundOutput)
+        {
+            points.groundOutput[index] = csm::EcefCoord(nan, nan, nan);
+        }
+        else
+        {
+            csm::EcefCoordCovar& groundPt(points.groundCovarOutput[index]);
+            groundPt = csm::EcefCoordCovar(nan, nan, nan);
+            std::fill_n(groundPt.covariance, 9, nan);
+        }
+    }
+
+    if (points.valid)
+    {
+        points.valid[index] = valid;
+    }
+    return valid;
+}
+
+size_t SIXSensorModel::runBulk(const BulkPoints& points,
+                               size_t numPoints,
+                               size_t numThreads) const
+{
+    if (numThreads == 0)
+    {
+        numThreads = tasks::SharedTaskScheduler::getInstance().getNumThreads();
+    }
+    numThreads = std::max<size_t>(
+            std::min(numThreads, numPoints / MIN_BULK_POINTS_PER_THREAD), 1);
+
+    // Each chunk counts its own failures so the workers never share a
+    // counter
+    std::vector<size_t> numFailed(numThreads, 0);
+    tasks::parallelFor(numThreads, numThreads,
+                       BulkProjector(*this, points, numPoints, numFailed),
+                       "csm.SIXSensorModel.bulk");
+
+    return std::accumulate(numFailed.begin(), numFailed.end(),
+                           static_cast<size_t>(0));
+}
+
+size_t SIXSensorModel::bulkGroundToImage(const csm::EcefCoord* groundPts,
+                                         size_t numPoints,
+                                         csm::ImageCoord* imagePts,
+                                         bool* valid,
+                                         size_t numThreads) const
+{
+    BulkPoints points;
+    points.groundPts = groundPts;
+    points.imageOutput = imagePts;
+    points.valid = valid;
+    return runBulk(points, numPoints, numThreads);
+}
+
+size_t SIXSensorModel::bulkGroundToImage(const csm::EcefCoordCovar* groundPts,
+                                         size_t numPoints,
+                                         csm::ImageCoordCovar* imagePts,
+                                         bool* valid,
+                                         size_t numThreads) const
+{
+    BulkPoints points;
+    points.groundCovarPts = groundPts;
+    points.imageCovarOutput = imagePts;
+    points.valid = valid;
+    return runBulk(points, numPoints, numThreads);
+}
+
+size_t SIXSensorModel::bulkImageToGround(const csm::ImageCoord* imagePts,
+                                         const double* heights,
+                                         size_t numPoints,
+                                         csm::EcefCoord* groundPts,
+                                         bool* valid,
+                                         size_t numThreads) const
+{
+    BulkPoints points;
+    points.imagePts = imagePts;
+    points.heights = heights;
+    points.groundOutput = groundPts;
+    points.valid = valid;
+    return runBulk(points, numPoints, numThreads);
+}
+
+size_t SIXSensorModel::bulkImageToGround(const csm::ImageCoordCovar* imagePts,
+                                         const double* heights,
+                                         const double* heightVariances,
+                                         size_t numPoints,
+                                         csm::EcefCoordCovar* groundPts,
+                                         bool* valid,
+                                         size_t numThreads) const
+{
+    BulkPoints points;
+    points.imageCovarPts = imagePts;
+    points.heights = heights;
+    points.heightVariances = heightVariances;
+    points.groundCovarOutput = groundPts;
+    points.valid = valid;
+    return runBulk(points, numPoints, numThreads);
+}
+
 csm::EcefVector SIXSensorModel::getIlluminationDirection(
         const csm::EcefCoord& groundPt) const
 {
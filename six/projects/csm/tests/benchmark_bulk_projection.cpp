@@ -0,0 +1,194 @@
+/* =========================================================================
+ * This file is part of the CSM SICD Plugin
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * The CSM SICD Plugin is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times projecting a grid of points one at a time through the CSM API
+// against the bulk methods, and checks that they produce the same results.
+// Usage: benchmark_bulk_projection <SICD pathname> [plugin data dir]
+//                                  [number of points] [number of threads]
+
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <sys/OS.h>
+#include <sys/Path.h>
+#include <sys/StopWatch.h>
+#include <six/csm/SICDSensorModel.h>
+
+namespace
+{
+void printResult(const std::string& name, size_t numPoints, double elapsedMS)
+{
+    std::cout << std::left << std::setw(32) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(14)
+              << numPoints / (elapsedMS / 1000) << " points/sec\n";
+}
+
+double diff(const csm::ImageCoord& lhs, const csm::ImageCoord& rhs)
+{
+    return std::max(std::abs(lhs.line - rhs.line),
+                    std::abs(lhs.samp - rhs.samp));
+}
+
+double diff(const csm::EcefCoord& lhs, const csm::EcefCoord& rhs)
+{
+    return std::max(std::abs(lhs.x - rhs.x),
+                    std::max(std::abs(lhs.y - rhs.y),
+                             std::abs(lhs.z - rhs.z)));
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        if (argc < 2)
+        {
+            std::cerr << "Usage: " << sys::Path::basename(argv[0])
+                      << " <SICD pathname> [plugin data dir]"
+                      << " [number of points] [number of threads]\n";
+            return 1;
+        }
+        const std::string dataDir((argc > 2) ? argv[2] : "");
+        const size_t numPoints = (argc > 3) ? ::atoi(argv[3]) : 100000;
+        const size_t numThreads = (argc > 4) ?
+                ::atoi(argv[4]) : sys::OS().getNumCPUs();
+
+        csm::Isd isd(argv[1]);
+        const six::CSM::SICDSensorModel model(isd, dataDir);
+
+        // SIXSensorModel's overrides hide RasterGM's default arguments
+        const csm::RasterGM& rasterModel(model);
+
+        // Spread the points evenly over the image
+        const csm::ImageVector size = model.getImageSize();
+        const size_t side = static_cast<size_t>(
+                std::ceil(std::sqrt(static_cast<double>(numPoints))));
+        std::vector<csm::ImageCoord> imagePts(numPoints);
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            imagePts[ii].line = size.line * (ii / side) / side;
+            imagePts[ii].samp = size.samp * (ii % side) / side;
+        }
+        const std::vector<double> heights(numPoints, 0.0);
+
+        // Image to ground
+        std::vector<csm::EcefCoord> groundPts(numPoints);
+        sys::RealTimeStopWatch imageWatch;
+        imageWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            groundPts[ii] = rasterModel.imageToGround(imagePts[ii],
+                                                      heights[ii]);
+        }
+        printResult("imageToGround", numPoints, imageWatch.stop());
+
+        std::vector<csm::EcefCoord> bulkGroundPts(numPoints);
+        sys::RealTimeStopWatch bulkImageWatch;
+        bulkImageWatch.start();
+        model.bulkImageToGround(&imagePts[0], &heights[0], numPoints,
+                                &bulkGroundPts[0], NULL, 1);
+        printResult("bulkImageToGround (1 thread)", numPoints,
+                    bulkImageWatch.stop());
+
+        std::vector<csm::EcefCoord> threadedGroundPts(numPoints);
+        sys::RealTimeStopWatch threadedImageWatch;
+        threadedImageWatch.start();
+        const size_t numImageFailed = model.bulkImageToGround(
+                &imagePts[0], &heights[0], numPoints, &threadedGroundPts[0],
+                NULL, numThreads);
+        std::ostringstream imageLabel;
+        imageLabel << "bulkImageToGround (" << numThreads << " threads)";
+        printResult(imageLabel.str(), numPoints, threadedImageWatch.stop());
+
+        // Ground to image
+        std::vector<csm::ImageCoord> outImagePts(numPoints);
+        sys::RealTimeStopWatch groundWatch;
+        groundWatch.start();
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            outImagePts[ii] = rasterModel.groundToImage(groundPts[ii]);
+        }
+        printResult("groundToImage", numPoints, groundWatch.stop());
+
+        std::vector<csm::ImageCoord> bulkImagePts(numPoints);
+        sys::RealTimeStopWatch bulkGroundWatch;
+        bulkGroundWatch.start();
+        model.bulkGroundToImage(&groundPts[0], numPoints, &bulkImagePts[0],
+                                NULL, 1);
+        printResult("bulkGroundToImage (1 thread)", numPoints,
+                    bulkGroundWatch.stop());
+
+        std::vector<csm::ImageCoord> threadedImagePts(numPoints);
+        sys::RealTimeStopWatch threadedGroundWatch;
+        threadedGroundWatch.start();
+        const size_t numGroundFailed = model.bulkGroundToImage(
+                &groundPts[0], numPoints, &threadedImagePts[0], NULL,
+                numThreads);
+        std::ostringstream groundLabel;
+        groundLabel << "bulkGroundToImage (" << numThreads << " threads)";
+        printResult(groundLabel.str(), numPoints, threadedGroundWatch.stop());
+
+        double maxGroundDiff = 0.0;
+        double maxImageDiff = 0.0;
+        for (size_t ii = 0; ii < numPoints; ++ii)
+        {
+            maxGroundDiff = std::max(maxGroundDiff,
+                                     diff(groundPts[ii], bulkGroundPts[ii]));
+            maxGroundDiff = std::max(maxGroundDiff,
+                                     diff(groundPts[ii],
+                                          threadedGroundPts[ii]));
+            maxImageDiff = std::max(maxImageDiff,
+                                    diff(outImagePts[ii], bulkImagePts[ii]));
+            maxImageDiff = std::max(maxImageDiff,
+                                    diff(outImagePts[ii],
+                                         threadedImagePts[ii]));
+        }
+
+        std::cout << "\nFailed points: " << numImageFailed << " image, "
+                  << numGroundFailed << " ground\n"
+                  << "Max difference: " << std::scientific << maxGroundDiff
+                  << " m, " << maxImageDiff << " pixels\n";
+
+        return (numImageFailed == 0 && numGroundFailed == 0 &&
+                maxGroundDiff == 0.0 && maxImageDiff == 0.0) ? 0 : 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (const csm::Error& ex)
+    {
+        std::cerr << "Caught CSM error: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}
@@ -0,0 +1,207 @@
+/* =========================================================================
+ * This file is part of the CSM SICD Plugin
+ * =========================================================================
+ *
+ * (C) Copyright 2004 - 2018, MDA Information Systems LLC
+ *
+ * The CSM SICD Plugin is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not,
+ * see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// Times saving and restoring the sensor model state as XML and as a
+// CompactModelState, and checks that both restore the same projection.
+// Restoring includes building the projection model, as the sensor models
+// do.
+// Usage: benchmark_model_state <SICD or SIDD pathname> [iterations]
+
+#include <stdlib.h>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include <sys/StopWatch.h>
+#include <io/StringStream.h>
+#include <logging/NullLogger.h>
+#include <six/NITFReadControl.h>
+#include <six/XMLControlFactory.h>
+#include <six/sicd/ComplexXMLControl.h>
+#include <six/sicd/Utilities.h>
+#include <six/sidd/DerivedXMLControl.h>
+#include <six/sidd/Utilities.h>
+#include <six/csm/CompactModelState.h>
+
+namespace
+{
+void printResult(const std::string& name, size_t iterations, double elapsedMS)
+{
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12)
+              << elapsedMS * 1000 / iterations << " us\n";
+}
+
+std::auto_ptr<scene::ProjectionModel> getProjectionModel(const six::Data& data)
+{
+    if (data.getDataType() == six::DataType::COMPLEX)
+    {
+        const six::sicd::ComplexData& complexData(
+                static_cast<const six::sicd::ComplexData&>(data));
+        const std::auto_ptr<scene::SceneGeometry> geometry(
+                six::sicd::Utilities::getSceneGeometry(&complexData));
+        return std::auto_ptr<scene::ProjectionModel>(
+                six::sicd::Utilities::getProjectionModel(&complexData,
+                                                         geometry.get()));
+    }
+
+    return six::sidd::Utilities::getProjectionModel(
+            &static_cast<const six::sidd::DerivedData&>(data));
+}
+
+std::string encode(const six::Data& data)
+{
+    if (data.getDataType() == six::DataType::COMPLEX)
+    {
+        return six::CSM::CompactModelState::encode(
+                static_cast<const six::sicd::ComplexData&>(data));
+    }
+    return six::CSM::CompactModelState::encode(
+            static_cast<const six::sidd::DerivedData&>(data));
+}
+
+std::auto_ptr<six::Data> decode(six::DataType dataType,
+                                const std::string& state)
+{
+    if (dataType == six::DataType::COMPLEX)
+    {
+        return std::auto_ptr<six::Data>(
+                six::CSM::CompactModelState::decodeComplexData(state));
+    }
+    return std::auto_ptr<six::Data>(
+            six::CSM::CompactModelState::decodeDerivedData(state));
+}
+
+std::auto_ptr<six::Data> parseXML(const six::XMLControlRegistry& registry,
+                                  const std::string& xml)
+{
+    io::StringStream stream;
+    stream.write(xml.c_str(), xml.length());
+    logging::NullLogger logger;
+    return six::parseData(registry, stream, std::vector<std::string>(),
+                          logger);
+}
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        if (argc < 2)
+        {
+            std::cerr << "Usage: " << sys::Path::basename(argv[0])
+                      << " <SICD or SIDD pathname> [iterations]\n";
+            return 1;
+        }
+        const std::string pathname(argv[1]);
+        const size_t iterations = (argc > 2) ? ::atoi(argv[2]) : 100;
+
+        six::XMLControlRegistry registry;
+        registry.addCreator(six::DataType::COMPLEX,
+                new six::XMLControlCreatorT<six::sicd::ComplexXMLControl>());
+        registry.addCreator(six::DataType::DERIVED,
+                new six::XMLControlCreatorT<six::sidd::DerivedXMLControl>());
+
+        six::NITFReadControl reader;
+        reader.setXMLControlRegistry(&registry);
+        reader.load(pathname);
+        const six::Data& data(*reader.getContainer()->getData(0));
+
+        // Save
+        std::string xml;
+        sys::RealTimeStopWatch xmlSaveWatch;
+        xmlSaveWatch.start();
+        for (size_t ii = 0; ii < iterations; ++ii)
+        {
+            xml = six::toXMLString(&data, &registry);
+        }
+        const double xmlSaveMS = xmlSaveWatch.stop();
+
+        std::string compact;
+        sys::RealTimeStopWatch compactSaveWatch;
+        compactSaveWatch.start();
+        for (size_t ii = 0; ii < iterations; ++ii)
+        {
+            compact = encode(data);
+        }
+        const double compactSaveMS = compactSaveWatch.stop();
+
+        // Restore
+        std::auto_ptr<scene::ProjectionModel> xmlModel;
+        sys::RealTimeStopWatch xmlRestoreWatch;
+        xmlRestoreWatch.start();
+        for (size_t ii = 0; ii < iterations; ++ii)
+        {
+            xmlModel = getProjectionModel(*parseXML(registry, xml));
+        }
+        const double xmlRestoreMS = xmlRestoreWatch.stop();
+
+        std::auto_ptr<scene::ProjectionModel> compactModel;
+        sys::RealTimeStopWatch compactRestoreWatch;
+        compactRestoreWatch.start();
+        for (size_t ii = 0; ii < iterations; ++ii)
+        {
+            compactModel = getProjectionModel(
+                    *decode(data.getDataType(), compact));
+        }
+        const double compactRestoreMS = compactRestoreWatch.stop();
+
+        std::cout << data.getDataType().toString() << ": " << xml.length()
+                  << " byte XML state, " << compact.length()
+                  << " byte compact state\n\n";
+        printResult("XML save", iterations, xmlSaveMS);
+        printResult("XML restore", iterations, xmlRestoreMS);
+        printResult("Compact save", iterations, compactSaveMS);
+        printResult("Compact restore", iterations, compactRestoreMS);
+
+        // Both models should project identically
+        double maxDiff = 0.0;
+        for (int row = -1; row <= 1; ++row)
+        {
+            for (int col = -1; col <= 1; ++col)
+            {
+                const types::RowCol<double> imagePt(row * 500.0, col * 500.0);
+                const scene::Vector3 xmlPt =
+                        xmlModel->imageToScene(imagePt, 0.0);
+                const scene::Vector3 compactPt =
+                        compactModel->imageToScene(imagePt, 0.0);
+                maxDiff = std::max(maxDiff, (xmlPt - compactPt).norm());
+            }
+        }
+        std::cout << "\nMax projection difference: " << std::scientific
+                  << maxDiff << " m\n";
+
+        return (maxDiff == 0.0) ? 0 : 1;
+    }
+    catch (const except::Exception& ex)
+    {
+        std::cerr << "Caught exception: " << ex.getMessage() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cerr << "Caught unknown exception\n";
+        return 1;
+    }
+}